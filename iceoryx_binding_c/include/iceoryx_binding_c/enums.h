@@ -117,6 +117,7 @@ enum iox_AllocationResult
     AllocationResult_UNDEFINED_ERROR,
     AllocationResult_INVALID_PARAMETER_FOR_CHUNK,
     AllocationResult_INVALID_PARAMETER_FOR_REQUEST_HEADER,
+    AllocationResult_CHUNK_QUOTA_EXCEEDED,
     AllocationResult_SUCCESS,
 };
 
@@ -145,6 +146,7 @@ enum iox_WaitSetResult
 {
     WaitSetResult_WAIT_SET_FULL,
     WaitSetResult_ALREADY_ATTACHED,
+    WaitSetResult_UNABLE_TO_CREATE_FILE_DESCRIPTOR,
     WaitSetResult_UNDEFINED_ERROR,
     WaitSetResult_SUCCESS
 };
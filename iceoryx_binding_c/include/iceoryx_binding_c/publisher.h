@@ -128,6 +128,14 @@ void iox_pub_release_chunk(iox_pub_t const self, void* const userPayload);
 /// @param[in] userPayload pointer to the user-payload of the chunk which should be send
 void iox_pub_publish_chunk(iox_pub_t const self, void* const userPayload);
 
+/// @brief sends multiple previously allocated chunks with a single call, every subscriber is notified once after it
+///        received the chunks instead of once per chunk
+/// @param[in] self handle of the publisher
+/// @param[in] userPayloads array of pointers to the user-payloads of the chunks which should be send, they are
+///             send in the order of the array
+/// @param[in] numberOfChunks the number of elements in userPayloads
+void iox_pub_publish_chunks(iox_pub_t const self, void* const* const userPayloads, const uint64_t numberOfChunks);
+
 /// @brief offers the service
 /// @param[in] self handle of the publisher
 void iox_pub_offer(iox_pub_t const self);
@@ -106,7 +106,20 @@ ENUM iox_SubscribeState iox_sub_get_subscription_state(iox_sub_t const self);
 ///         an enum which describes the error
 ENUM iox_ChunkReceiveResult iox_sub_take_chunk(iox_sub_t const self, const void** const userPayload);
 
-/// @brief release a previously acquired chunk (via iox_sub_take_chunk)
+/// @brief retrieve multiple received chunks with a single call
+/// @param[in] self handle to the subscriber
+/// @param[in] userPayloads preallocated array with at least maxNumberOfChunks elements in which the pointers to the
+///             user-payloads of the chunks are stored, the oldest chunk first
+/// @param[in] maxNumberOfChunks the maximum number of chunks which should be retrieved
+/// @param[in] numberOfChunks pointer in which the number of chunks stored in userPayloads is written
+/// @return if at least one chunk could be received it returns ChunkReceiveResult_SUCCESS otherwise
+///         an enum which describes the error; chunks exceeding the maximum number of held chunks stay in the queue
+ENUM iox_ChunkReceiveResult iox_sub_take_chunks(iox_sub_t const self,
+                                                const void** const userPayloads,
+                                                const uint64_t maxNumberOfChunks,
+                                                uint64_t* const numberOfChunks);
+
+/// @brief release a previously acquired chunk (via iox_sub_take_chunk or iox_sub_take_chunks)
 /// @param[in] self handle to the subscriber
 /// @param[in] userPayload pointer to the user-payload of chunk which should be released
 void iox_sub_release_chunk(iox_sub_t const self, const void* const userPayload);
@@ -20,6 +20,7 @@
 #include "iceoryx_binding_c/internal/cpp2c_enum_translation.hpp"
 #include "iceoryx_binding_c/internal/cpp2c_publisher.hpp"
 #include "iceoryx_binding_c/internal/cpp2c_service_description_translation.hpp"
+#include "iceoryx_hoofs/cxx/algorithm.hpp"
 #include "iceoryx_posh/internal/popo/ports/publisher_port_user.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 
@@ -164,6 +165,25 @@ void iox_pub_publish_chunk(iox_pub_t const self, void* const userPayload)
     PublisherPortUser(self->m_portData).sendChunk(ChunkHeader::fromUserPayload(userPayload));
 }
 
+void iox_pub_publish_chunks(iox_pub_t const self, void* const* const userPayloads, const uint64_t numberOfChunks)
+{
+    iox::cxx::Expects(userPayloads != nullptr || numberOfChunks == 0U);
+
+    // a publisher cannot hold more chunks than this at once, a valid call is sent with a single batch
+    constexpr uint64_t MAX_CHUNKS_PER_BATCH{MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY};
+    ChunkHeader* chunkHeaders[MAX_CHUNKS_PER_BATCH];
+    PublisherPortUser publisher(self->m_portData);
+    for (uint64_t offset = 0U; offset < numberOfChunks; offset += MAX_CHUNKS_PER_BATCH)
+    {
+        const uint64_t numberOfChunksInBatch = algorithm::min(numberOfChunks - offset, MAX_CHUNKS_PER_BATCH);
+        for (uint64_t i = 0U; i < numberOfChunksInBatch; ++i)
+        {
+            chunkHeaders[i] = ChunkHeader::fromUserPayload(userPayloads[offset + i]);
+        }
+        publisher.sendChunks(chunkHeaders, numberOfChunksInBatch);
+    }
+}
+
 void iox_pub_offer(iox_pub_t const self)
 {
     PublisherPortUser(self->m_portData).offer();
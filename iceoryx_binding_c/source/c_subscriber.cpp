@@ -163,6 +163,30 @@ iox_ChunkReceiveResult iox_sub_take_chunk(iox_sub_t const self, const void** con
     return ChunkReceiveResult_SUCCESS;
 }
 
+iox_ChunkReceiveResult iox_sub_take_chunks(iox_sub_t const self,
+                                           const void** const userPayloads,
+                                           const uint64_t maxNumberOfChunks,
+                                           uint64_t* const numberOfChunks)
+{
+    iox::cxx::Expects(userPayloads != nullptr || maxNumberOfChunks == 0U);
+    iox::cxx::Expects(numberOfChunks != nullptr);
+
+    uint64_t index{0U};
+    auto result = SubscriberPortUser(self->m_portData)
+                      .tryGetChunks(maxNumberOfChunks, [&](const ChunkHeader* const chunkHeader) {
+                          userPayloads[index] = chunkHeader->userPayload();
+                          ++index;
+                      });
+    if (result.has_error())
+    {
+        *numberOfChunks = 0U;
+        return cpp2c::chunkReceiveResult(result.get_error());
+    }
+
+    *numberOfChunks = result.value();
+    return ChunkReceiveResult_SUCCESS;
+}
+
 void iox_sub_release_chunk(iox_sub_t const self, const void* const userPayload)
 {
     SubscriberPortUser(self->m_portData).releaseChunk(ChunkHeader::fromUserPayload(userPayload));
@@ -35,29 +35,23 @@ extern "C" {
 #include "iceoryx_binding_c/wait_set.h"
 }
 
-static uint64_t notification_info_vector_to_c_array(const WaitSet<>::NotificationInfoVector& triggerVector,
-                                                    iox_notification_info_t* notificationInfoArray,
-                                                    const uint64_t notificationInfoArrayCapacity,
-                                                    uint64_t* missedElements)
+template <typename WaitCall>
+static uint64_t wait_into_c_array(const WaitCall& waitCall,
+                                  iox_notification_info_t* notificationInfoArray,
+                                  const uint64_t notificationInfoArrayCapacity,
+                                  uint64_t* missedElements)
 {
+    // the notification infos are written directly into the array of the caller, without an intermediate vector
     uint64_t notificationInfoArraySize = 0U;
-    uint64_t triggerVectorSize = triggerVector.size();
-    if (triggerVectorSize > notificationInfoArrayCapacity)
-    {
-        *missedElements = triggerVectorSize - notificationInfoArrayCapacity;
-        notificationInfoArraySize = notificationInfoArrayCapacity;
-    }
-    else
-    {
-        *missedElements = 0U;
-        notificationInfoArraySize = triggerVectorSize;
-    }
-
-    for (uint64_t i = 0U; i < notificationInfoArraySize; ++i)
-    {
-        notificationInfoArray[i] = triggerVector[i];
-    }
-
+    const uint64_t numberOfNotificationInfos = waitCall([&](const NotificationInfo& notificationInfo) {
+        if (notificationInfoArraySize < notificationInfoArrayCapacity)
+        {
+            notificationInfoArray[notificationInfoArraySize] = &notificationInfo;
+            ++notificationInfoArraySize;
+        }
+    });
+
+    *missedElements = numberOfNotificationInfos - notificationInfoArraySize;
     return notificationInfoArraySize;
 }
 
@@ -86,10 +80,13 @@ uint64_t iox_ws_timed_wait(iox_ws_t const self,
     iox::cxx::Expects(self != nullptr);
     iox::cxx::Expects(missedElements != nullptr);
 
-    return notification_info_vector_to_c_array(self->timedWait(units::Duration(timeout)),
-                                               notificationInfoArray,
-                                               notificationInfoArrayCapacity,
-                                               missedElements);
+    return wait_into_c_array(
+        [&](const WaitSet<>::NotificationInfoVisitor& visitor) {
+            return self->timedWaitAndVisit(units::Duration(timeout), visitor);
+        },
+        notificationInfoArray,
+        notificationInfoArrayCapacity,
+        missedElements);
 }
 
 uint64_t iox_ws_wait(iox_ws_t const self,
@@ -100,8 +97,11 @@ uint64_t iox_ws_wait(iox_ws_t const self,
     iox::cxx::Expects(self != nullptr);
     iox::cxx::Expects(missedElements != nullptr);
 
-    return notification_info_vector_to_c_array(
-        self->wait(), notificationInfoArray, notificationInfoArrayCapacity, missedElements);
+    return wait_into_c_array(
+        [&](const WaitSet<>::NotificationInfoVisitor& visitor) { return self->waitAndVisit(visitor); },
+        notificationInfoArray,
+        notificationInfoArrayCapacity,
+        missedElements);
 }
 
 uint64_t iox_ws_size(iox_ws_t const self)
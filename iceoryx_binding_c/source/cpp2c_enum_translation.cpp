@@ -69,6 +69,8 @@ iox_AllocationResult allocationResult(const iox::popo::AllocationError value) no
         return AllocationResult_INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER;
     case AllocationError::INVALID_PARAMETER_FOR_REQUEST_HEADER:
         return AllocationResult_INVALID_PARAMETER_FOR_REQUEST_HEADER;
+    case AllocationError::CHUNK_QUOTA_EXCEEDED:
+        return AllocationResult_CHUNK_QUOTA_EXCEEDED;
     }
     return AllocationResult_UNDEFINED_ERROR;
 }
@@ -109,6 +111,8 @@ iox_WaitSetResult waitSetResult(const iox::popo::WaitSetError value) noexcept
         return WaitSetResult_WAIT_SET_FULL;
     case WaitSetError::ALREADY_ATTACHED:
         return WaitSetResult_ALREADY_ATTACHED;
+    case WaitSetError::UNABLE_TO_CREATE_FILE_DESCRIPTOR:
+        return WaitSetResult_UNABLE_TO_CREATE_FILE_DESCRIPTOR;
     }
     return WaitSetResult_UNDEFINED_ERROR;
 }
@@ -337,6 +337,31 @@ TEST_F(iox_pub_test, sendDeliversChunk)
     EXPECT_TRUE(static_cast<DummySample*>(maybeSharedChunk->getUserPayload())->dummy == 4711);
 }
 
+TEST_F(iox_pub_test, sendMultipleChunksDeliversThemInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "99cb25ec-b7d2-48a0-a8d2-7ac533d9bef0");
+    constexpr uint64_t NUMBER_OF_CHUNKS{3U};
+    void* chunks[NUMBER_OF_CHUNKS];
+    iox_pub_offer(&m_sut);
+    this->Subscribe(&m_publisherPortData);
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        ASSERT_EQ(iox_pub_loan_chunk(&m_sut, &chunks[i], 100), AllocationResult_SUCCESS);
+        static_cast<DummySample*>(chunks[i])->dummy = i;
+    }
+    iox_pub_publish_chunks(&m_sut, chunks, NUMBER_OF_CHUNKS);
+
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> m_chunkQueuePopper(&m_chunkQueueData);
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto maybeSharedChunk = m_chunkQueuePopper.tryPop();
+        ASSERT_TRUE(maybeSharedChunk.has_value());
+        EXPECT_TRUE(*maybeSharedChunk == chunks[i]);
+        EXPECT_THAT(static_cast<DummySample*>(maybeSharedChunk->getUserPayload())->dummy, Eq(i));
+    }
+    EXPECT_FALSE(m_chunkQueuePopper.tryPop().has_value());
+}
+
 TEST_F(iox_pub_test, correctServiceDescriptionReturned)
 {
     ::testing::Test::RecordProperty("TEST_ID", "4f91cb12-fbfa-4bad-ad59-ab2579f83fbe");
@@ -279,6 +279,79 @@ TEST_F(iox_sub_test, receiveChunkWhenToManyChunksAreHold)
     EXPECT_EQ(iox_sub_take_chunk(m_sut, &chunk), ChunkReceiveResult_TOO_MANY_CHUNKS_HELD_IN_PARALLEL);
 }
 
+TEST_F(iox_sub_test, takeChunksWhenThereAreNoneReturnsNoChunkAvailable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "61bf19c4-d6ff-47c1-8040-62fb0b69a5c1");
+    this->Subscribe(&m_portPtr);
+    const void* chunks[4U];
+    uint64_t numberOfChunks = 1U;
+    EXPECT_EQ(iox_sub_take_chunks(m_sut, chunks, 4U, &numberOfChunks), ChunkReceiveResult_NO_CHUNK_AVAILABLE);
+    EXPECT_THAT(numberOfChunks, Eq(0U));
+}
+
+TEST_F(iox_sub_test, takeChunksReceivesAllQueuedChunksInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "225dbb4d-0b4d-4a58-aebb-0f53bea8f547");
+    this->Subscribe(&m_portPtr);
+    constexpr uint64_t NUMBER_OF_PUSHED_CHUNKS{3U};
+    for (uint64_t i = 0U; i < NUMBER_OF_PUSHED_CHUNKS; ++i)
+    {
+        auto sharedChunk = getChunkFromMemoryManager();
+        *static_cast<uint64_t*>(sharedChunk.getUserPayload()) = i;
+        m_chunkPusher.push(sharedChunk);
+    }
+
+    const void* chunks[5U];
+    uint64_t numberOfChunks = 0U;
+    ASSERT_EQ(iox_sub_take_chunks(m_sut, chunks, 5U, &numberOfChunks), ChunkReceiveResult_SUCCESS);
+    ASSERT_THAT(numberOfChunks, Eq(NUMBER_OF_PUSHED_CHUNKS));
+    for (uint64_t i = 0U; i < NUMBER_OF_PUSHED_CHUNKS; ++i)
+    {
+        EXPECT_THAT(*static_cast<const uint64_t*>(chunks[i]), Eq(i));
+    }
+    EXPECT_FALSE(iox_sub_has_chunks(m_sut));
+}
+
+TEST_F(iox_sub_test, takeChunksReceivesAtMostTheMaximumNumberOfChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "349aa6f6-6b4e-4862-9e83-ae54f4737f6c");
+    this->Subscribe(&m_portPtr);
+    for (uint64_t i = 0U; i < 3U; ++i)
+    {
+        m_chunkPusher.push(getChunkFromMemoryManager());
+    }
+
+    const void* chunks[2U];
+    uint64_t numberOfChunks = 0U;
+    ASSERT_EQ(iox_sub_take_chunks(m_sut, chunks, 2U, &numberOfChunks), ChunkReceiveResult_SUCCESS);
+    EXPECT_THAT(numberOfChunks, Eq(2U));
+    ASSERT_EQ(iox_sub_take_chunks(m_sut, chunks, 2U, &numberOfChunks), ChunkReceiveResult_SUCCESS);
+    EXPECT_THAT(numberOfChunks, Eq(1U));
+}
+
+TEST_F(iox_sub_test, takeChunksWhenTooManyChunksAreHeldKeepsTheChunksInTheQueue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "64f0d140-b2d2-460c-9399-8e6da0622c16");
+    this->Subscribe(&m_portPtr);
+    const void* chunk = nullptr;
+    for (uint64_t i = 0U; i < MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY + 1U; ++i)
+    {
+        m_chunkPusher.push(getChunkFromMemoryManager());
+        ASSERT_EQ(iox_sub_take_chunk(m_sut, &chunk), ChunkReceiveResult_SUCCESS);
+    }
+
+    m_chunkPusher.push(getChunkFromMemoryManager());
+    const void* chunks[2U];
+    uint64_t numberOfChunks = 0U;
+    EXPECT_EQ(iox_sub_take_chunks(m_sut, chunks, 2U, &numberOfChunks),
+              ChunkReceiveResult_TOO_MANY_CHUNKS_HELD_IN_PARALLEL);
+    EXPECT_THAT(numberOfChunks, Eq(0U));
+
+    iox_sub_release_chunk(m_sut, chunk);
+    EXPECT_EQ(iox_sub_take_chunks(m_sut, chunks, 2U, &numberOfChunks), ChunkReceiveResult_SUCCESS);
+    EXPECT_THAT(numberOfChunks, Eq(1U));
+}
+
 TEST_F(iox_sub_test, releaseChunkWorks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "53619897-cad8-4377-a877-4ec6971308fa");
@@ -533,6 +533,24 @@ TEST_F(iox_ws_test, MissedElementsIsCorrectWhenSomethingWasMissed)
     EXPECT_EQ(m_missedElements, 4U);
 }
 
+TEST_F(iox_ws_test, TimedWaitMissedElementsIsCorrectWhenSomethingWasMissed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "66741333-d5ef-479d-9781-9e36711def2f");
+    for (uint64_t i = 0U; i < 12U; ++i)
+    {
+        iox_ws_attach_user_trigger_event(m_sut, m_userTrigger[i], i, userTriggerCallback);
+        iox_user_trigger_trigger(m_userTrigger[i]);
+    }
+
+    EXPECT_EQ(iox_ws_timed_wait(m_sut, m_timeout, m_eventInfoStorage, 8U, &m_missedElements), 8U);
+
+    EXPECT_EQ(m_missedElements, 4U);
+    for (uint64_t i = 0U; i < 8U; ++i)
+    {
+        EXPECT_EQ(iox_notification_info_get_notification_id(m_eventInfoStorage[i]), i);
+    }
+}
+
 TEST_F(iox_ws_test, MissedElementsIsCorrectWhenAllWereMissed)
 {
     ::testing::Test::RecordProperty("TEST_ID", "502a351f-3388-40a2-bf77-96c019b986f1");
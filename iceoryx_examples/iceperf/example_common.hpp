@@ -28,7 +28,9 @@ enum class Technology
 {
     ALL,
     ICEORYX_CPP_API,
+    ICEORYX_CPP_STATIC_API,
     ICEORYX_C_API,
+    ICEORYX_C_BULK_API,
     POSIX_MESSAGE_QUEUE,
     UNIX_DOMAIN_SOCKET
 };
@@ -20,23 +20,29 @@
 #include <chrono>
 #include <thread>
 
-Iceoryx::Iceoryx(const iox::capro::IdString_t& publisherName, const iox::capro::IdString_t& subscriberName) noexcept
-    : m_publisher({"IcePerf", publisherName, "C++-API"}, iox::popo::PublisherOptions{1U})
-    , m_subscriber({"IcePerf", subscriberName, "C++-API"}, iox::popo::SubscriberOptions{1U, 1U})
+template <typename PublisherType, typename SubscriberType>
+IceoryxApi<PublisherType, SubscriberType>::IceoryxApi(const iox::capro::IdString_t& publisherName,
+                                                      const iox::capro::IdString_t& subscriberName,
+                                                      const iox::capro::IdString_t& eventName) noexcept
+    : m_publisher({"IcePerf", publisherName, eventName}, iox::popo::PublisherOptions{1U})
+    , m_subscriber({"IcePerf", subscriberName, eventName}, iox::popo::SubscriberOptions{1U, 1U})
 {
 }
 
-void Iceoryx::initLeader() noexcept
+template <typename PublisherType, typename SubscriberType>
+void IceoryxApi<PublisherType, SubscriberType>::initLeader() noexcept
 {
     init();
 }
 
-void Iceoryx::initFollower() noexcept
+template <typename PublisherType, typename SubscriberType>
+void IceoryxApi<PublisherType, SubscriberType>::initFollower() noexcept
 {
     init();
 }
 
-void Iceoryx::init() noexcept
+template <typename PublisherType, typename SubscriberType>
+void IceoryxApi<PublisherType, SubscriberType>::init() noexcept
 {
     std::cout << "Waiting for: subscription" << std::flush;
     while (m_subscriber.getSubscriptionState() != iox::SubscribeState::SUBSCRIBED)
@@ -52,7 +58,8 @@ void Iceoryx::init() noexcept
     std::cout << " [ success ]" << std::endl;
 }
 
-void Iceoryx::shutdown() noexcept
+template <typename PublisherType, typename SubscriberType>
+void IceoryxApi<PublisherType, SubscriberType>::shutdown() noexcept
 {
     m_subscriber.unsubscribe();
 
@@ -67,7 +74,9 @@ void Iceoryx::shutdown() noexcept
     std::cout << " [ finished ]" << std::endl;
 }
 
-void Iceoryx::sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept
+template <typename PublisherType, typename SubscriberType>
+void IceoryxApi<PublisherType, SubscriberType>::sendPerfTopic(const uint32_t payloadSizeInBytes,
+                                                              const RunFlag runFlag) noexcept
 {
     m_publisher.loan(payloadSizeInBytes).and_then([&](auto& userPayload) {
         auto sendSample = static_cast<PerfTopic*>(userPayload);
@@ -79,7 +88,8 @@ void Iceoryx::sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag run
     });
 }
 
-PerfTopic Iceoryx::receivePerfTopic() noexcept
+template <typename PublisherType, typename SubscriberType>
+PerfTopic IceoryxApi<PublisherType, SubscriberType>::receivePerfTopic() noexcept
 {
     bool hasReceivedSample{false};
     PerfTopic receivedSample;
@@ -95,3 +105,18 @@ PerfTopic Iceoryx::receivePerfTopic() noexcept
 
     return receivedSample;
 }
+
+template class IceoryxApi<iox::popo::UntypedPublisher, iox::popo::UntypedSubscriber>;
+template class IceoryxApi<iox::popo::StaticUntypedPublisher<IcePerfPortPolicy>,
+                          iox::popo::StaticUntypedSubscriber<IcePerfPortPolicy>>;
+
+Iceoryx::Iceoryx(const iox::capro::IdString_t& publisherName, const iox::capro::IdString_t& subscriberName) noexcept
+    : IceoryxApi(publisherName, subscriberName, "C++-API")
+{
+}
+
+IceoryxStatic::IceoryxStatic(const iox::capro::IdString_t& publisherName,
+                             const iox::capro::IdString_t& subscriberName) noexcept
+    : IceoryxApi(publisherName, subscriberName, "C++-Static-API")
+{
+}
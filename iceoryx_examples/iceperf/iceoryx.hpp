@@ -19,13 +19,20 @@
 
 #include "base.hpp"
 #include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/popo/static_publisher.hpp"
+#include "iceoryx_posh/popo/static_subscriber.hpp"
 #include "iceoryx_posh/popo/untyped_publisher.hpp"
 #include "iceoryx_posh/popo/untyped_subscriber.hpp"
 
-class Iceoryx : public IcePerfBase
+/// @brief the iceoryx C++ API benchmark, parameterized with the publisher and subscriber types to compare the
+/// generic ports with the ports whose options are fixed at compile time
+template <typename PublisherType, typename SubscriberType>
+class IceoryxApi : public IcePerfBase
 {
   public:
-    Iceoryx(const iox::capro::IdString_t& publisherName, const iox::capro::IdString_t& subscriberName) noexcept;
+    IceoryxApi(const iox::capro::IdString_t& publisherName,
+               const iox::capro::IdString_t& subscriberName,
+               const iox::capro::IdString_t& eventName) noexcept;
     void initLeader() noexcept override;
     void initFollower() noexcept override;
     void shutdown() noexcept override;
@@ -35,8 +42,27 @@ class Iceoryx : public IcePerfBase
     void sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept override;
     PerfTopic receivePerfTopic() noexcept override;
 
-    iox::popo::UntypedPublisher m_publisher;
-    iox::popo::UntypedSubscriber m_subscriber;
+    PublisherType m_publisher;
+    SubscriberType m_subscriber;
+};
+
+/// @brief the same options as iox::popo::PublisherOptions{1U} and iox::popo::SubscriberOptions{1U, 1U} of the
+/// generic benchmark
+using IcePerfPortPolicy = iox::popo::StaticPortPolicy<iox::popo::QueueFullPolicy::DISCARD_OLDEST_DATA,
+                                                      iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA,
+                                                      1U>;
+
+class Iceoryx : public IceoryxApi<iox::popo::UntypedPublisher, iox::popo::UntypedSubscriber>
+{
+  public:
+    Iceoryx(const iox::capro::IdString_t& publisherName, const iox::capro::IdString_t& subscriberName) noexcept;
+};
+
+class IceoryxStatic : public IceoryxApi<iox::popo::StaticUntypedPublisher<IcePerfPortPolicy>,
+                                        iox::popo::StaticUntypedSubscriber<IcePerfPortPolicy>>
+{
+  public:
+    IceoryxStatic(const iox::capro::IdString_t& publisherName, const iox::capro::IdString_t& subscriberName) noexcept;
 };
 
 #endif // IOX_EXAMPLES_ICEPERF_ICEORYX_HPP
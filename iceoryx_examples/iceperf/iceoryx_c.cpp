@@ -114,3 +114,57 @@ PerfTopic IceoryxC::receivePerfTopic() noexcept
 
     return receivedSample;
 }
+
+IceoryxCBulk::IceoryxCBulk(const iox::capro::IdString_t& publisherName,
+                           const iox::capro::IdString_t& subscriberName) noexcept
+    : IceoryxC(publisherName, subscriberName)
+    , m_waitSet(iox_ws_init(&m_waitSetStorage))
+{
+    iox_ws_attach_subscriber_state(m_waitSet, m_subscriber, SubscriberState_HAS_DATA, 0U, NULL);
+}
+
+IceoryxCBulk::~IceoryxCBulk()
+{
+    iox_ws_detach_subscriber_state(m_waitSet, m_subscriber, SubscriberState_HAS_DATA);
+    iox_ws_deinit(m_waitSet);
+}
+
+void IceoryxCBulk::sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept
+{
+    void* userPayload = nullptr;
+    if (iox_pub_loan_chunk(m_publisher, &userPayload, payloadSizeInBytes) == AllocationResult_SUCCESS)
+    {
+        auto sendSample = static_cast<PerfTopic*>(userPayload);
+        sendSample->payloadSize = payloadSizeInBytes;
+        sendSample->runFlag = runFlag;
+        sendSample->subPackets = 1;
+        iox_pub_publish_chunks(m_publisher, &userPayload, 1U);
+    }
+}
+
+PerfTopic IceoryxCBulk::receivePerfTopic() noexcept
+{
+    PerfTopic receivedSample;
+    const void* userPayloads[MAX_CHUNKS_PER_TAKE];
+    uint64_t numberOfChunks{0U};
+
+    do
+    {
+        iox_notification_info_t notificationArray[1U];
+        uint64_t missedElements{0U};
+        iox_ws_wait(m_waitSet, notificationArray, 1U, &missedElements);
+
+        if (iox_sub_take_chunks(m_subscriber, userPayloads, MAX_CHUNKS_PER_TAKE, &numberOfChunks)
+            == ChunkReceiveResult_SUCCESS)
+        {
+            // the newest sample is the relevant one, older ones can only be leftovers of the history
+            receivedSample = *(static_cast<const PerfTopic*>(userPayloads[numberOfChunks - 1U]));
+            for (uint64_t i = 0U; i < numberOfChunks; ++i)
+            {
+                iox_sub_release_chunk(m_subscriber, userPayloads[i]);
+            }
+        }
+    } while (numberOfChunks == 0U);
+
+    return receivedSample;
+}
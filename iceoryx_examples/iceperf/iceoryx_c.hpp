@@ -22,6 +22,7 @@
 extern "C" {
 #include "iceoryx_binding_c/publisher.h"
 #include "iceoryx_binding_c/subscriber.h"
+#include "iceoryx_binding_c/wait_set.h"
 }
 
 class IceoryxC : public IcePerfBase
@@ -33,6 +34,10 @@ class IceoryxC : public IcePerfBase
     void initFollower() noexcept override;
     void shutdown() noexcept override;
 
+  protected:
+    iox_pub_t m_publisher;
+    iox_sub_t m_subscriber;
+
   private:
     void init() noexcept;
     void sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept override;
@@ -40,8 +45,24 @@ class IceoryxC : public IcePerfBase
 
     iox_pub_storage_t m_publisherStorage;
     iox_sub_storage_t m_subscriberStorage;
-    iox_pub_t m_publisher;
-    iox_sub_t m_subscriber;
+};
+
+/// @brief Uses the bulk functions of the C API, i.e. iox_pub_publish_chunks and iox_sub_take_chunks, and blocks in
+/// iox_ws_wait instead of busy polling the subscriber
+class IceoryxCBulk : public IceoryxC
+{
+  public:
+    static constexpr uint64_t MAX_CHUNKS_PER_TAKE{8U};
+
+    IceoryxCBulk(const iox::capro::IdString_t& publisherName, const iox::capro::IdString_t& subscriberName) noexcept;
+    ~IceoryxCBulk();
+
+  private:
+    void sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept override;
+    PerfTopic receivePerfTopic() noexcept override;
+
+    iox_ws_storage_t m_waitSetStorage;
+    iox_ws_t m_waitSet;
 };
 
 #endif // IOX_EXAMPLES_ICEPERF_ICEORYX_HPP
@@ -113,12 +113,26 @@ int IcePerfFollower::run() noexcept
         doMeasurement(iceoryx);
     }
 
+    if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::ICEORYX_CPP_STATIC_API)
+    {
+        std::cout << std::endl << "****** ICEORYX STATIC API ********" << std::endl;
+        IceoryxStatic iceoryxStatic(PUBLISHER, SUBSCRIBER);
+        doMeasurement(iceoryxStatic);
+    }
+
     if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::ICEORYX_C_API)
     {
         std::cout << std::endl << "******   ICEORYX C API    ********" << std::endl;
         IceoryxC iceoryxc(PUBLISHER, SUBSCRIBER);
         doMeasurement(iceoryxc);
     }
+
+    if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::ICEORYX_C_BULK_API)
+    {
+        std::cout << std::endl << "****** ICEORYX C BULK API ********" << std::endl;
+        IceoryxCBulk iceoryxcBulk(PUBLISHER, SUBSCRIBER);
+        doMeasurement(iceoryxcBulk);
+    }
     //! [create an run technologies]
 
     return EXIT_SUCCESS;
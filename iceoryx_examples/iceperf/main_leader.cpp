@@ -53,7 +53,9 @@ int main(int argc, char* argv[])
             std::cout << "-t, --technology <TYPE>           Selects the type of technology to benchmark" << std::endl;
             std::cout << "                                  <TYPE> {all," << std::endl;
             std::cout << "                                          iceoryx-cpp-api," << std::endl;
+            std::cout << "                                          iceoryx-cpp-static-api," << std::endl;
             std::cout << "                                          iceoryx-c-api," << std::endl;
+            std::cout << "                                          iceoryx-c-bulk-api," << std::endl;
             std::cout << "                                          posix-message-queue," << std::endl;
             std::cout << "                                          unix-domain-sockets}" << std::endl;
             std::cout << "                                  default = 'all'" << std::endl;
@@ -90,10 +92,18 @@ int main(int argc, char* argv[])
             {
                 settings.technology = Technology::ICEORYX_CPP_API;
             }
+            else if (strcmp(optarg, "iceoryx-cpp-static-api") == 0)
+            {
+                settings.technology = Technology::ICEORYX_CPP_STATIC_API;
+            }
             else if (strcmp(optarg, "iceoryx-c-api") == 0)
             {
                 settings.technology = Technology::ICEORYX_C_API;
             }
+            else if (strcmp(optarg, "iceoryx-c-bulk-api") == 0)
+            {
+                settings.technology = Technology::ICEORYX_C_BULK_API;
+            }
             else if (strcmp(optarg, "posix-message-queue") == 0)
             {
                 settings.technology = Technology::POSIX_MESSAGE_QUEUE;
@@ -104,8 +114,8 @@ int main(int argc, char* argv[])
             }
             else
             {
-                std::cerr << "Options for 'technology' are 'all', 'iceoryx-cpp-api', 'iceoryx-c-api', "
-                             "'posix-message-queue' and 'unix-domain-sockets'!"
+                std::cerr << "Options for 'technology' are 'all', 'iceoryx-cpp-api', 'iceoryx-cpp-static-api', "
+                             "'iceoryx-c-api', 'iceoryx-c-bulk-api', 'posix-message-queue' and 'unix-domain-sockets'!"
                           << std::endl;
                 return EXIT_FAILURE;
             }
@@ -19,6 +19,7 @@
 
 #include "iceoryx_hoofs/cxx/optional.hpp"
 #include "iceoryx_hoofs/cxx/type_traits.hpp"
+#include "iceoryx_hoofs/internal/cxx/fnv1a_hash.hpp"
 #include "iceoryx_hoofs/internal/cxx/string_internal.hpp"
 
 #include <algorithm>
@@ -675,6 +676,17 @@ template <uint64_t Capacity>
 inline std::ostream& operator<<(std::ostream& stream, const string<Capacity>& str) noexcept;
 } // namespace cxx
 } // namespace iox
+
+namespace std
+{
+/// @brief hash of the fixed string, enables the usage as key in unordered containers
+template <uint64_t Capacity>
+struct hash<iox::cxx::string<Capacity>>
+{
+    /// @brief computes the 64 bit FNV-1a hash of the characters of the string
+    size_t operator()(const iox::cxx::string<Capacity>& str) const noexcept;
+};
+} // namespace std
 #include "iceoryx_hoofs/internal/cxx/string.inl"
 
 #endif // IOX_HOOFS_CXX_STRING_HPP
@@ -25,6 +25,7 @@
 #include "iceoryx_hoofs/internal/concurrent/sofi.hpp"
 
 #include <cstdint>
+#include <type_traits>
 
 namespace iox
 {
@@ -91,6 +92,19 @@ class VariantQueue
     ///         otherwise the optional contains nullopt_t
     optional<ValueType> pop() noexcept;
 
+    /// @brief pushs an element into the fifo without the runtime dispatch over the queue type
+    /// @tparam Type of the underlying queue, must be the type the VariantQueue was constructed with
+    /// @param[in] value value which should be added in the fifo
+    /// @return see push
+    template <VariantQueueTypes Type>
+    optional<ValueType> push(const ValueType& value) noexcept;
+
+    /// @brief pops an element from the fifo without the runtime dispatch over the queue type
+    /// @tparam Type of the underlying queue, must be the type the VariantQueue was constructed with
+    /// @return see pop
+    template <VariantQueueTypes Type>
+    optional<ValueType> pop() noexcept;
+
     /// @brief returns true if empty otherwise true
     bool empty() const noexcept;
 
@@ -123,6 +137,24 @@ class VariantQueue
     /// @endcode
     fifo_t& getUnderlyingFiFo() noexcept;
 
+  private:
+    template <VariantQueueTypes Type>
+    using QueueTypeTag = std::integral_constant<VariantQueueTypes, Type>;
+
+    optional<ValueType> pushTo(QueueTypeTag<VariantQueueTypes::FiFo_SingleProducerSingleConsumer>,
+                               const ValueType& value) noexcept;
+    optional<ValueType> pushTo(QueueTypeTag<VariantQueueTypes::SoFi_SingleProducerSingleConsumer>,
+                               const ValueType& value) noexcept;
+    optional<ValueType> pushTo(QueueTypeTag<VariantQueueTypes::FiFo_MultiProducerSingleConsumer>,
+                               const ValueType& value) noexcept;
+    optional<ValueType> pushTo(QueueTypeTag<VariantQueueTypes::SoFi_MultiProducerSingleConsumer>,
+                               const ValueType& value) noexcept;
+
+    optional<ValueType> popFrom(QueueTypeTag<VariantQueueTypes::FiFo_SingleProducerSingleConsumer>) noexcept;
+    optional<ValueType> popFrom(QueueTypeTag<VariantQueueTypes::SoFi_SingleProducerSingleConsumer>) noexcept;
+    optional<ValueType> popFrom(QueueTypeTag<VariantQueueTypes::FiFo_MultiProducerSingleConsumer>) noexcept;
+    optional<ValueType> popFrom(QueueTypeTag<VariantQueueTypes::SoFi_MultiProducerSingleConsumer>) noexcept;
+
   private:
     VariantQueueTypes m_type;
     fifo_t m_fifo;
@@ -0,0 +1,73 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_HOOFS_CONCURRENT_FUTEX_EVENT_HPP
+#define IOX_HOOFS_CONCURRENT_FUTEX_EVENT_HPP
+
+#include "iceoryx_hoofs/cxx/expected.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/semaphore_interface.hpp"
+#include "iceoryx_hoofs/internal/units/duration.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace concurrent
+{
+/// @brief Counting inter-process event which can be placed in shared memory. It provides the same interface as the
+///        posix::UnnamedSemaphore but post and tryWait are plain atomic operations; the futex syscall is only used
+///        when a waiter has to block or a blocked waiter has to be woken up.
+/// @note On platforms without futex the blocking wait falls back to a sleeping wait
+class FutexEvent
+{
+  public:
+    explicit FutexEvent(const uint32_t initialValue = 0U) noexcept;
+    ~FutexEvent() noexcept = default;
+
+    FutexEvent(const FutexEvent&) = delete;
+    FutexEvent(FutexEvent&&) = delete;
+    FutexEvent& operator=(const FutexEvent&) = delete;
+    FutexEvent& operator=(FutexEvent&&) = delete;
+
+    /// @brief Increments the event counter by one and wakes up one waiter
+    /// @return SemaphoreError::SEMAPHORE_OVERFLOW when the counter would overflow
+    cxx::expected<posix::SemaphoreError> post() noexcept;
+
+    /// @brief Decrements the event counter by one, blocks while the counter is zero
+    cxx::expected<posix::SemaphoreError> wait() noexcept;
+
+    /// @brief Decrements the event counter by one when it is greater than zero
+    /// @return true when the counter was decremented, otherwise false
+    cxx::expected<bool, posix::SemaphoreError> tryWait() noexcept;
+
+    /// @brief Decrements the event counter by one, blocks at most for the given timeout while the counter is zero
+    /// @return SemaphoreWaitState::NO_TIMEOUT when the counter was decremented, otherwise SemaphoreWaitState::TIMEOUT
+    cxx::expected<posix::SemaphoreWaitState, posix::SemaphoreError> timedWait(const units::Duration& timeout) noexcept;
+
+  private:
+    bool tryDecrement() noexcept;
+    cxx::expected<posix::SemaphoreError> blockWhileZero(const struct timespec* relativeTimeout) noexcept;
+
+  private:
+    std::atomic<uint32_t> m_counter{0U};
+    std::atomic<uint32_t> m_numberOfWaiters{0U};
+};
+
+} // namespace concurrent
+} // namespace iox
+
+#endif // IOX_HOOFS_CONCURRENT_FUTEX_EVENT_HPP
@@ -0,0 +1,106 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_HOOFS_CONCURRENT_FUTEX_LOCK_HPP
+#define IOX_HOOFS_CONCURRENT_FUTEX_LOCK_HPP
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace concurrent
+{
+/// @brief Recursive inter-process lock which can be placed in shared memory. The futex word contains the process id of
+///        the owner, therefore the uncontended lock and unlock are a single atomic operation without a syscall and
+///        the lock of a terminated process can be detected and broken.
+/// @code
+///     concurrent::FutexLock lock;
+///     {
+///         std::lock_guard<concurrent::FutexLock> guard(lock);
+///         // ...
+///     }
+///
+///     // in the cleanup routine of the process which detected the crash, e.g. RouDi
+///     lock.forceUnlockOfDeadOwner(pidOfCrashedProcess);
+/// @endcode
+/// @note A lock is only broken when the owning process has terminated, which is checked with a process file
+///       descriptor or, where not available, with the null signal. A process which still exists, e.g. a hanging
+///       application whose keep alive has expired, keeps its lock.
+/// @note All processes which share a lock must be in the same pid namespace, the same restriction as for the process
+///       monitoring of RouDi
+/// @note On platforms without futex (see iox::platform::IOX_SUPPORT_FUTEX) the contended lock falls back to a
+///       polling wait
+class FutexLock
+{
+  public:
+    FutexLock() noexcept = default;
+    ~FutexLock() noexcept = default;
+
+    FutexLock(const FutexLock&) = delete;
+    FutexLock(FutexLock&&) = delete;
+    FutexLock& operator=(const FutexLock&) = delete;
+    FutexLock& operator=(FutexLock&&) = delete;
+
+    /// @brief Acquires the lock, blocks when another thread holds the lock. Can be called recursively.
+    void lock() noexcept;
+
+    /// @brief Releases the lock
+    /// @return false when the calling thread does not hold the lock, otherwise true
+    bool unlock() noexcept;
+
+    /// @brief Acquires the lock without blocking
+    /// @return true when the lock was acquired, otherwise false
+    // NOLINTNEXTLINE(readability-identifier-naming) C++ STL code guidelines
+    bool try_lock() noexcept;
+
+    /// @brief Acquires the lock without blocking. When the lock is held by a process which has terminated the lock is
+    ///        taken over.
+    /// @attention the data protected by the lock may be in an inconsistent state when the lock was taken over
+    /// @return true when the lock was acquired, false when it is held by another thread of the calling process or by
+    ///         a process which still exists
+    bool tryLockOrRecoverFromDeadOwner() noexcept;
+
+    /// @brief Releases the lock when it is held by the given process and the process has terminated and wakes up all
+    ///        waiters
+    /// @param[in] processId of the dead process
+    /// @return true when the lock was held by the terminated process and was released, otherwise false
+    bool forceUnlockOfDeadOwner(const uint32_t processId) noexcept;
+
+    /// @brief returns the process id of the owner or 0 when the lock is free
+    uint32_t ownerProcessId() const noexcept;
+
+  private:
+    bool isOwnedByCallingThread() const noexcept;
+    void setCallingThreadAsOwner() noexcept;
+
+  private:
+    static constexpr uint32_t UNLOCKED{0U};
+    static constexpr uint32_t WAITERS_FLAG{1U << 31U};
+    static constexpr uint32_t OWNER_MASK{~WAITERS_FLAG};
+
+    /// @brief the futex word, contains the process id of the owner and the WAITERS_FLAG
+    std::atomic<uint32_t> m_state{UNLOCKED};
+    /// @brief identifies the owning thread within the owning process; required for the recursive locking
+    std::atomic<uint64_t> m_ownerThread{0U};
+    /// @brief only accessed by the owning thread
+    uint64_t m_recursionCount{0U};
+};
+
+} // namespace concurrent
+} // namespace iox
+
+#endif // IOX_HOOFS_CONCURRENT_FUTEX_LOCK_HPP
@@ -0,0 +1,49 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_HOOFS_CXX_FNV1A_HASH_HPP
+#define IOX_HOOFS_CXX_FNV1A_HASH_HPP
+
+#include <cstdint>
+
+namespace iox
+{
+namespace cxx
+{
+constexpr uint64_t FNV1A_OFFSET_BASIS{14695981039346656037U};
+constexpr uint64_t FNV1A_PRIME{1099511628211U};
+
+/// @brief computes the 64 bit FNV-1a hash of the given bytes
+/// @param[in] data pointer to the first byte
+/// @param[in] size number of bytes
+/// @param[in] hashValue start value; the hash of concatenated data is computed by passing the result of the previous
+///            call
+/// @return the hash value
+constexpr uint64_t
+fnv1aHash(const char* const data, const uint64_t size, uint64_t hashValue = FNV1A_OFFSET_BASIS) noexcept
+{
+    for (uint64_t i = 0U; i < size; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) the size is provided by the caller
+        hashValue ^= static_cast<uint8_t>(data[i]);
+        hashValue *= FNV1A_PRIME;
+    }
+    return hashValue;
+}
+} // namespace cxx
+} // namespace iox
+
+#endif // IOX_HOOFS_CXX_FNV1A_HASH_HPP
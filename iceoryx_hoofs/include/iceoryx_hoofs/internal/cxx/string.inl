@@ -659,4 +659,15 @@ inline constexpr const char& string<Capacity>::operator[](const uint64_t pos) co
 } // namespace cxx
 } // namespace iox
 
+namespace std
+{
+template <uint64_t Capacity>
+inline size_t hash<iox::cxx::string<Capacity>>::operator()(const iox::cxx::string<Capacity>& str) const noexcept
+{
+    const uint64_t hashValue = iox::cxx::fnv1aHash(str.c_str(), str.size());
+    // size_t might be smaller than 64 bit, the conversion is left to std::hash
+    return hash<uint64_t>()(hashValue);
+}
+} // namespace std
+
 #endif // IOX_HOOFS_CXX_STRING_INL
@@ -55,36 +55,13 @@ optional<ValueType> VariantQueue<ValueType, Capacity>::push(const ValueType& val
     switch (m_type)
     {
     case VariantQueueTypes::FiFo_SingleProducerSingleConsumer:
-    {
-        auto hadSpace =
-            m_fifo.template get_at_index<static_cast<uint64_t>(VariantQueueTypes::FiFo_SingleProducerSingleConsumer)>()
-                ->push(value);
-
-        return (hadSpace) ? cxx::nullopt : cxx::make_optional<ValueType>(value);
-    }
+        return pushTo(QueueTypeTag<VariantQueueTypes::FiFo_SingleProducerSingleConsumer>(), value);
     case VariantQueueTypes::SoFi_SingleProducerSingleConsumer:
-    {
-        ValueType overriddenValue;
-        auto hadSpace =
-            m_fifo.template get_at_index<static_cast<uint64_t>(VariantQueueTypes::SoFi_SingleProducerSingleConsumer)>()
-                ->push(value, overriddenValue);
-
-        return (hadSpace) ? cxx::nullopt : cxx::make_optional<ValueType>(overriddenValue);
-    }
+        return pushTo(QueueTypeTag<VariantQueueTypes::SoFi_SingleProducerSingleConsumer>(), value);
     case VariantQueueTypes::FiFo_MultiProducerSingleConsumer:
-    {
-        auto hadSpace =
-            m_fifo.template get_at_index<static_cast<uint64_t>(VariantQueueTypes::FiFo_MultiProducerSingleConsumer)>()
-                ->tryPush(value);
-
-        return (hadSpace) ? cxx::nullopt : cxx::make_optional<ValueType>(value);
-    }
+        return pushTo(QueueTypeTag<VariantQueueTypes::FiFo_MultiProducerSingleConsumer>(), value);
     case VariantQueueTypes::SoFi_MultiProducerSingleConsumer:
-    {
-        return m_fifo
-            .template get_at_index<static_cast<uint64_t>(VariantQueueTypes::FiFo_MultiProducerSingleConsumer)>()
-            ->push(value);
-    }
+        return pushTo(QueueTypeTag<VariantQueueTypes::SoFi_MultiProducerSingleConsumer>(), value);
     }
 
     return cxx::nullopt;
@@ -96,32 +73,114 @@ inline optional<ValueType> VariantQueue<ValueType, Capacity>::pop() noexcept
     switch (m_type)
     {
     case VariantQueueTypes::FiFo_SingleProducerSingleConsumer:
-    {
-        return m_fifo
-            .template get_at_index<static_cast<uint64_t>(VariantQueueTypes::FiFo_SingleProducerSingleConsumer)>()
-            ->pop();
-    }
+        return popFrom(QueueTypeTag<VariantQueueTypes::FiFo_SingleProducerSingleConsumer>());
     case VariantQueueTypes::SoFi_SingleProducerSingleConsumer:
-    {
-        ValueType returnType;
-        auto hasReturnType =
-            m_fifo.template get_at_index<static_cast<uint64_t>(VariantQueueTypes::SoFi_SingleProducerSingleConsumer)>()
-                ->pop(returnType);
-
-        return (hasReturnType) ? make_optional<ValueType>(returnType) : cxx::nullopt;
-    }
+        return popFrom(QueueTypeTag<VariantQueueTypes::SoFi_SingleProducerSingleConsumer>());
     case VariantQueueTypes::FiFo_MultiProducerSingleConsumer:
+        return popFrom(QueueTypeTag<VariantQueueTypes::FiFo_MultiProducerSingleConsumer>());
     case VariantQueueTypes::SoFi_MultiProducerSingleConsumer:
-    {
-        return m_fifo
-            .template get_at_index<static_cast<uint64_t>(VariantQueueTypes::FiFo_MultiProducerSingleConsumer)>()
-            ->pop();
-    }
+        return popFrom(QueueTypeTag<VariantQueueTypes::SoFi_MultiProducerSingleConsumer>());
     }
 
     return cxx::nullopt;
 }
 
+template <typename ValueType, uint64_t Capacity>
+template <VariantQueueTypes Type>
+inline optional<ValueType> VariantQueue<ValueType, Capacity>::push(const ValueType& value) noexcept
+{
+    return pushTo(QueueTypeTag<Type>(), value);
+}
+
+template <typename ValueType, uint64_t Capacity>
+template <VariantQueueTypes Type>
+inline optional<ValueType> VariantQueue<ValueType, Capacity>::pop() noexcept
+{
+    return popFrom(QueueTypeTag<Type>());
+}
+
+template <typename ValueType, uint64_t Capacity>
+inline optional<ValueType>
+VariantQueue<ValueType, Capacity>::pushTo(QueueTypeTag<VariantQueueTypes::FiFo_SingleProducerSingleConsumer>,
+                                          const ValueType& value) noexcept
+{
+    auto hadSpace =
+        m_fifo.template get_at_index<static_cast<uint64_t>(VariantQueueTypes::FiFo_SingleProducerSingleConsumer)>()
+            ->push(value);
+
+    return (hadSpace) ? cxx::nullopt : cxx::make_optional<ValueType>(value);
+}
+
+template <typename ValueType, uint64_t Capacity>
+inline optional<ValueType>
+VariantQueue<ValueType, Capacity>::pushTo(QueueTypeTag<VariantQueueTypes::SoFi_SingleProducerSingleConsumer>,
+                                          const ValueType& value) noexcept
+{
+    ValueType overriddenValue;
+    auto hadSpace =
+        m_fifo.template get_at_index<static_cast<uint64_t>(VariantQueueTypes::SoFi_SingleProducerSingleConsumer)>()
+            ->push(value, overriddenValue);
+
+    return (hadSpace) ? cxx::nullopt : cxx::make_optional<ValueType>(overriddenValue);
+}
+
+template <typename ValueType, uint64_t Capacity>
+inline optional<ValueType>
+VariantQueue<ValueType, Capacity>::pushTo(QueueTypeTag<VariantQueueTypes::FiFo_MultiProducerSingleConsumer>,
+                                          const ValueType& value) noexcept
+{
+    auto hadSpace =
+        m_fifo.template get_at_index<static_cast<uint64_t>(VariantQueueTypes::FiFo_MultiProducerSingleConsumer)>()
+            ->tryPush(value);
+
+    return (hadSpace) ? cxx::nullopt : cxx::make_optional<ValueType>(value);
+}
+
+template <typename ValueType, uint64_t Capacity>
+inline optional<ValueType>
+VariantQueue<ValueType, Capacity>::pushTo(QueueTypeTag<VariantQueueTypes::SoFi_MultiProducerSingleConsumer>,
+                                          const ValueType& value) noexcept
+{
+    // both multi producer queue types use the same underlying queue
+    return m_fifo.template get_at_index<static_cast<uint64_t>(VariantQueueTypes::FiFo_MultiProducerSingleConsumer)>()
+        ->push(value);
+}
+
+template <typename ValueType, uint64_t Capacity>
+inline optional<ValueType>
+VariantQueue<ValueType, Capacity>::popFrom(QueueTypeTag<VariantQueueTypes::FiFo_SingleProducerSingleConsumer>) noexcept
+{
+    return m_fifo.template get_at_index<static_cast<uint64_t>(VariantQueueTypes::FiFo_SingleProducerSingleConsumer)>()
+        ->pop();
+}
+
+template <typename ValueType, uint64_t Capacity>
+inline optional<ValueType>
+VariantQueue<ValueType, Capacity>::popFrom(QueueTypeTag<VariantQueueTypes::SoFi_SingleProducerSingleConsumer>) noexcept
+{
+    ValueType returnType;
+    auto hasReturnType =
+        m_fifo.template get_at_index<static_cast<uint64_t>(VariantQueueTypes::SoFi_SingleProducerSingleConsumer)>()
+            ->pop(returnType);
+
+    return (hasReturnType) ? make_optional<ValueType>(returnType) : cxx::nullopt;
+}
+
+template <typename ValueType, uint64_t Capacity>
+inline optional<ValueType>
+VariantQueue<ValueType, Capacity>::popFrom(QueueTypeTag<VariantQueueTypes::FiFo_MultiProducerSingleConsumer>) noexcept
+{
+    return m_fifo.template get_at_index<static_cast<uint64_t>(VariantQueueTypes::FiFo_MultiProducerSingleConsumer)>()
+        ->pop();
+}
+
+template <typename ValueType, uint64_t Capacity>
+inline optional<ValueType>
+VariantQueue<ValueType, Capacity>::popFrom(QueueTypeTag<VariantQueueTypes::SoFi_MultiProducerSingleConsumer>) noexcept
+{
+    return popFrom(QueueTypeTag<VariantQueueTypes::FiFo_MultiProducerSingleConsumer>());
+}
+
 template <typename ValueType, uint64_t Capacity>
 inline bool VariantQueue<ValueType, Capacity>::empty() const noexcept
 {
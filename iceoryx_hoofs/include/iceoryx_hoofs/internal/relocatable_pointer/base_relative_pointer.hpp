@@ -21,6 +21,7 @@
 #include "iceoryx_hoofs/cxx/newtype.hpp"
 #include "iceoryx_hoofs/internal/relocatable_pointer/pointer_repository.hpp"
 
+#include <atomic>
 #include <cstdint>
 
 namespace iox
@@ -66,6 +67,7 @@ class BaseRelativePointer
     using ptr_t = void*;
     using const_ptr_t = const void* const;
     using offset_t = std::uintptr_t;
+    using UnregisteredIdHandler_t = void (*)(const id_underlying_t);
 
     /// @brief constructs a BaseRelativePointer pointing to the same pointee as ptr in a segment identified by id
     /// @param[in] ptr the pointer whose pointee shall be the same for this
@@ -146,6 +148,14 @@ class BaseRelativePointer
     /// @brief unregisters all ptr id pairs (leads to initial state)
     static void unregisterAll() noexcept;
 
+    /// @brief sets a handler which is called when the base pointer of a valid but unregistered id is requested; the
+    /// handler may register the segment of the id, which is then used to resolve the pointer. This allows to map
+    /// segments lazily on first access.
+    /// @param[in] handler to call, nullptr removes the handler
+    /// @note the handler is called from every thread which resolves such a pointer, it must serialize the
+    /// registration itself
+    static void setUnregisteredIdHandler(const UnregisteredIdHandler_t handler) noexcept;
+
     /// @brief get the offset from id and ptr
     /// @param[in] id is the id of the segment and is used to get the base pointer
     /// @param[in] ptr is the pointer whose offset should be calculated
@@ -187,6 +197,11 @@ class BaseRelativePointer
   protected:
     ~BaseRelativePointer() noexcept = default;
 
+  private:
+    static std::atomic<UnregisteredIdHandler_t>& unregisteredIdHandler() noexcept;
+
+  protected:
+
     // BaseRelativePointer only used with RelativePointer
     // NOLINTBEGIN(cppcoreguidelines-non-private-member-variables-in-classes)
     id_underlying_t m_id{NULL_POINTER_ID};
@@ -21,6 +21,7 @@
 #include "iceoryx_hoofs/cxx/vector.hpp"
 #include <iostream>
 
+#include <atomic>
 #include <cassert>
 #include <limits>
 
@@ -35,16 +36,22 @@ constexpr uint64_t MAX_POINTER_REPO_CAPACITY{10000U};
 /// Up to CAPACITY segments can be registered with MIN_ID = 1 to MAX_ID = CAPACITY - 1
 /// id 0 is reserved and allows relative pointers to behave like normal pointers
 /// (which is equivalent to measure the offset relative to 0).
+/// @note The registration of an id is published with release semantic and the lookups acquire it. Therefore a segment
+/// can be registered while other threads resolve relative pointers. The register and unregister calls must not be
+/// called concurrently with each other.
 template <typename id_t, typename ptr_t, uint64_t CAPACITY = MAX_POINTER_REPO_CAPACITY>
 class PointerRepository
 {
   private:
     struct Info
     {
-        ptr_t basePtr{nullptr};
-        ptr_t endPtr{nullptr};
+        /// @brief the segment is registered when the base pointer is not null; the end pointer is written before
+        std::atomic<ptr_t> basePtr{nullptr};
+        std::atomic<ptr_t> endPtr{nullptr};
     };
 
+    void publish(const id_t id, const ptr_t ptr, const uint64_t size) noexcept;
+
     /// @note 0 is a special purpose id and reserved
     /// id 0 is reserved to interpret the offset just as a raw pointer,
     /// i.e. its corresponding base ptr is 0
@@ -102,14 +109,12 @@ class PointerRepository
     void print() const noexcept;
 
   private:
-    /// @todo: if required protect vector against concurrent modification
-    /// whether this is required depends on the use case, we currently do not need it
     /// we control the ids, so if they are consecutive we only need a vector/array to get the address
     /// this variable exists once per application using relative pointers,
     /// and each needs to initialize it via register calls above
 
     iox::cxx::vector<Info, CAPACITY> m_info;
-    uint64_t m_maxRegistered{0U};
+    std::atomic<uint64_t> m_maxRegistered{0U};
 };
 } // namespace rp
 } // namespace iox
@@ -30,6 +30,24 @@ inline PointerRepository<id_t, ptr_t, CAPACITY>::PointerRepository() noexcept
 {
 }
 
+template <typename id_t, typename ptr_t, uint64_t CAPACITY>
+inline void
+PointerRepository<id_t, ptr_t, CAPACITY>::publish(const id_t id, const ptr_t ptr, const uint64_t size) noexcept
+{
+    // AXIVION Next Construct AutosarC++19_03-A5.2.4 : Cast is needed for pointer arithmetic and casted back to
+    // the original type
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    m_info[id].endPtr.store(reinterpret_cast<ptr_t>(reinterpret_cast<uintptr_t>(ptr) + size - 1U),
+                            std::memory_order_relaxed);
+    // the base pointer publishes the entry, a thread which sees it sees the end pointer and the mapped memory as well
+    m_info[id].basePtr.store(ptr, std::memory_order_release);
+
+    if (id > m_maxRegistered.load(std::memory_order_relaxed))
+    {
+        m_maxRegistered.store(id, std::memory_order_release);
+    }
+}
+
 template <typename id_t, typename ptr_t, uint64_t CAPACITY>
 inline bool PointerRepository<id_t, ptr_t, CAPACITY>::registerPtr(id_t id, ptr_t ptr, uint64_t size) noexcept
 {
@@ -37,18 +55,9 @@ inline bool PointerRepository<id_t, ptr_t, CAPACITY>::registerPtr(id_t id, ptr_t
     {
         return false;
     }
-    if (m_info[id].basePtr == nullptr)
+    if (m_info[id].basePtr.load(std::memory_order_relaxed) == nullptr)
     {
-        m_info[id].basePtr = ptr;
-        // AXIVION Next Construct AutosarC++19_03-A5.2.4 : Cast is needed for pointer arithmetic and casted back to
-        // the original type
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-        m_info[id].endPtr = reinterpret_cast<ptr_t>(reinterpret_cast<uintptr_t>(ptr) + size - 1U);
-
-        if (id > m_maxRegistered)
-        {
-            m_maxRegistered = id;
-        }
+        publish(id, ptr, size);
         return true;
     }
     return false;
@@ -59,18 +68,9 @@ inline id_t PointerRepository<id_t, ptr_t, CAPACITY>::registerPtr(const ptr_t pt
 {
     for (id_t id = 1U; id <= MAX_ID; ++id)
     {
-        if (m_info[id].basePtr == nullptr)
+        if (m_info[id].basePtr.load(std::memory_order_relaxed) == nullptr)
         {
-            m_info[id].basePtr = ptr;
-            // AXIVION Next Construct AutosarC++19_03-A5.2.4 : Cast is needed for pointer arithmetic and casted back
-            // to the original type
-            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-            m_info[id].endPtr = reinterpret_cast<ptr_t>(reinterpret_cast<uintptr_t>(ptr) + size - 1U);
-
-            if (id > m_maxRegistered)
-            {
-                m_maxRegistered = id;
-            }
+            publish(id, ptr, size);
             return id;
         }
     }
@@ -83,9 +83,9 @@ inline bool PointerRepository<id_t, ptr_t, CAPACITY>::unregisterPtr(id_t id) noe
 {
     if (id <= MAX_ID && id >= MIN_ID)
     {
-        if (m_info[id].basePtr != nullptr)
+        if (m_info[id].basePtr.load(std::memory_order_relaxed) != nullptr)
         {
-            m_info[id].basePtr = nullptr;
+            m_info[id].basePtr.store(nullptr, std::memory_order_release);
 
             /// @note do not search for next lower registered index but we could do it here
             return true;
@@ -100,9 +100,9 @@ inline void PointerRepository<id_t, ptr_t, CAPACITY>::unregisterAll() noexcept
 {
     for (auto& info : m_info)
     {
-        info.basePtr = nullptr;
+        info.basePtr.store(nullptr, std::memory_order_release);
     }
-    m_maxRegistered = 0U;
+    m_maxRegistered.store(0U, std::memory_order_release);
 }
 
 template <typename id_t, typename ptr_t, uint64_t CAPACITY>
@@ -110,7 +110,7 @@ inline ptr_t PointerRepository<id_t, ptr_t, CAPACITY>::getBasePtr(id_t id) const
 {
     if (id <= MAX_ID && id >= MIN_ID)
     {
-        return m_info[id].basePtr;
+        return m_info[id].basePtr.load(std::memory_order_acquire);
     }
 
     /// @note for id 0 nullptr is returned, meaning we will later interpret a relative pointer by casting the offset
@@ -123,10 +123,12 @@ inline ptr_t PointerRepository<id_t, ptr_t, CAPACITY>::getBasePtr(id_t id) const
 template <typename id_t, typename ptr_t, uint64_t CAPACITY>
 inline id_t PointerRepository<id_t, ptr_t, CAPACITY>::searchId(ptr_t ptr) const noexcept
 {
-    for (id_t id = 1U; id <= m_maxRegistered; ++id)
+    const auto maxRegistered = m_maxRegistered.load(std::memory_order_acquire);
+    for (id_t id = 1U; id <= maxRegistered; ++id)
     {
         // return first id where the ptr is in the corresponding interval
-        if (ptr >= m_info[id].basePtr && ptr <= m_info[id].endPtr)
+        const auto basePtr = m_info[id].basePtr.load(std::memory_order_acquire);
+        if (basePtr != nullptr && ptr >= basePtr && ptr <= m_info[id].endPtr.load(std::memory_order_relaxed))
         {
             return id;
         }
@@ -150,7 +152,7 @@ inline void PointerRepository<id_t, ptr_t, CAPACITY>::print() const noexcept
 {
     for (id_t id = 0U; id < m_info.size(); ++id)
     {
-        auto ptr = m_info[id].basePtr;
+        auto ptr = m_info[id].basePtr.load(std::memory_order_acquire);
         if (ptr != nullptr)
         {
             std::cout << id << " ---> " << ptr << std::endl;
@@ -0,0 +1,43 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_HOOFS_GENERIC_PLATFORM_FUTEX_HPP
+#define IOX_HOOFS_GENERIC_PLATFORM_FUTEX_HPP
+
+#include "iceoryx_hoofs/platform/time.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+// shared by all platforms; platforms without a futex (see iox::platform::IOX_SUPPORT_FUTEX) compile the fallback in
+// generic/source/futex.cpp which polls with a short sleep instead of blocking and where iox_futex_wake has no effect
+
+/// @brief Blocks the calling thread as long as the value at address is equal to expectedValue or until it is woken up
+///        by iox_futex_wake. Works across process boundaries when address is located in shared memory.
+/// @param[in] address of the futex word
+/// @param[in] expectedValue the thread is only blocked when the futex word contains this value
+/// @param[in] relativeTimeout maximum time to block, nullptr blocks without timeout
+/// @return 0 when woken up, otherwise -1 and errno is set (EAGAIN when the value differs, ETIMEDOUT, EINTR)
+/// @note spurious wakeups are possible, the caller has to recheck its condition
+int iox_futex_wait(std::atomic<uint32_t>* address, const uint32_t expectedValue, const struct timespec* relativeTimeout);
+
+/// @brief Wakes up threads which are blocked in iox_futex_wait on the same address
+/// @param[in] address of the futex word
+/// @param[in] numberOfWaiters the maximum number of threads which are woken up
+/// @return the number of woken up threads or -1 on error
+int iox_futex_wake(std::atomic<uint32_t>* address, const uint32_t numberOfWaiters);
+
+#endif // IOX_HOOFS_GENERIC_PLATFORM_FUTEX_HPP
@@ -0,0 +1,65 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_HOOFS_GENERIC_PLATFORM_NUMA_HPP
+#define IOX_HOOFS_GENERIC_PLATFORM_NUMA_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+// shared by all platforms; platforms without NUMA support compile the fallback in generic/source/numa.cpp which
+// reports ENOSYS and places everything on node 0
+
+/// @brief memory policies which can be applied with iox_numa_set_memory_policy
+enum iox_numa_policy_t
+{
+    /// @brief the pages are placed on the first node of the node mask, other nodes are used when it is out of memory
+    IOX_NUMA_POLICY_PREFERRED,
+    /// @brief the pages are placed only on the nodes of the node mask
+    IOX_NUMA_POLICY_BIND,
+    /// @brief the pages are distributed round-robin over the nodes of the node mask
+    IOX_NUMA_POLICY_INTERLEAVE
+};
+
+/// @brief the node mask of the NUMA functions has one bit per node, therefore only the first 64 nodes can be used
+constexpr uint32_t IOX_NUMA_MAX_NODES{64U};
+
+/// @brief Applies a memory policy to the pages of a memory range. Pages which are already in use by the calling
+///        process only are migrated to the nodes of the policy.
+/// @param[in] address start of the memory range, must be aligned to the page size
+/// @param[in] length of the memory range in bytes
+/// @param[in] policy which is applied
+/// @param[in] nodeMask bit n selects the node n
+/// @return 0 on success, otherwise -1 and errno is set (ENOSYS when the platform has no NUMA support)
+int iox_numa_set_memory_policy(void* address,
+                               const size_t length,
+                               const iox_numa_policy_t policy,
+                               const uint64_t nodeMask);
+
+/// @brief Acquires the NUMA node of the CPU the calling thread is currently running on
+/// @param[out] node the NUMA node, 0 when the platform has no NUMA support
+/// @return 0 on success, otherwise -1 and errno is set
+int iox_numa_get_current_node(uint32_t* node);
+
+/// @brief Acquires the NUMA nodes of memory pages of the calling process
+/// @param[in] pages addresses within the pages
+/// @param[in] numberOfPages number of entries of pages and nodes
+/// @param[out] nodes the node of every page or a negative errno value, e.g. -ENOENT when the page is not yet touched
+/// @return 0 on success, otherwise -1 and errno is set (ENOSYS when the platform has no NUMA support)
+int iox_numa_get_page_nodes(const void* const* pages, const size_t numberOfPages, int* nodes);
+
+#endif // IOX_HOOFS_GENERIC_PLATFORM_NUMA_HPP
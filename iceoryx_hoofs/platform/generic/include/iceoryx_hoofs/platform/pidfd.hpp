@@ -0,0 +1,59 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_HOOFS_GENERIC_PLATFORM_PIDFD_HPP
+#define IOX_HOOFS_GENERIC_PLATFORM_PIDFD_HPP
+
+#include "iceoryx_hoofs/platform/types.hpp"
+
+// shared by all platforms; platforms without process file descriptors compile the fallback in generic/source/pidfd.cpp
+// which reports ENOSYS
+
+/// @brief Opens a process file descriptor which becomes readable when the process terminates
+/// @param[in] pid of the process
+/// @return the file descriptor on success, otherwise -1 and errno is set (ENOSYS when the platform has no process file
+///         descriptors)
+int iox_pidfd_open(pid_t pid);
+
+/// @brief Checks without blocking whether the process of a process file descriptor has terminated
+/// @param[in] pidfd process file descriptor acquired with iox_pidfd_open
+/// @return 1 when the process has terminated, 0 when it is still running, otherwise -1 and errno is set
+int iox_pidfd_has_exited(int pidfd);
+
+/// @brief Creates a set of process file descriptors which can be waited for with iox_pidfd_set_wait
+/// @return the file descriptor of the set on success, otherwise -1 and errno is set (ENOSYS when the platform has no
+///         process file descriptors)
+int iox_pidfd_set_create(void);
+
+/// @brief Adds a process file descriptor to a set; it is removed from the set when it is closed
+/// @param[in] pidfdSet the set acquired with iox_pidfd_set_create
+/// @param[in] pidfd process file descriptor acquired with iox_pidfd_open
+/// @return 0 on success, otherwise -1 and errno is set
+int iox_pidfd_set_add(int pidfdSet, int pidfd);
+
+/// @brief Waits until a process of the set has terminated or the timeout has expired
+/// @param[in] pidfdSet the set acquired with iox_pidfd_set_create
+/// @param[in] timeoutInMs the timeout in milliseconds
+/// @return the number of terminated processes which were reported, 0 on timeout, otherwise -1 and errno is set
+int iox_pidfd_set_wait(int pidfdSet, int timeoutInMs);
+
+/// @brief Closes a process file descriptor or a set of them
+/// @param[in] fd the file descriptor to close
+/// @return 0 on success, otherwise -1 and errno is set
+int iox_pidfd_close(int fd);
+
+#endif // IOX_HOOFS_GENERIC_PLATFORM_PIDFD_HPP
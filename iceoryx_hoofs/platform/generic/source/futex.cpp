@@ -0,0 +1,57 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/platform/futex.hpp"
+#include "iceoryx_hoofs/platform/errno.hpp"
+
+#include <chrono>
+#include <thread>
+
+/// @brief there is no futex on this platform, therefore the waiter sleeps for a short time and reports a spurious
+///        wakeup; all users of iox_futex_wait have to recheck their condition anyway
+static constexpr std::chrono::microseconds FUTEX_FALLBACK_SLEEP_TIME{100};
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+int iox_futex_wait(std::atomic<uint32_t>* address, const uint32_t expectedValue, const struct timespec* relativeTimeout)
+{
+    if (address->load() != expectedValue)
+    {
+        errno = EAGAIN;
+        return -1;
+    }
+
+    auto sleepTime = std::chrono::duration_cast<std::chrono::nanoseconds>(FUTEX_FALLBACK_SLEEP_TIME);
+    if (relativeTimeout != nullptr)
+    {
+        const auto timeout =
+            std::chrono::seconds(relativeTimeout->tv_sec) + std::chrono::nanoseconds(relativeTimeout->tv_nsec);
+        if (timeout <= sleepTime)
+        {
+            std::this_thread::sleep_for(timeout);
+            errno = ETIMEDOUT;
+            return -1;
+        }
+    }
+
+    std::this_thread::sleep_for(sleepTime);
+    return 0;
+}
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+int iox_futex_wake(std::atomic<uint32_t>*, const uint32_t)
+{
+    return 0;
+}
@@ -0,0 +1,41 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_hoofs/platform/numa.hpp"
+#include "iceoryx_hoofs/platform/errno.hpp"
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+int iox_numa_set_memory_policy(void*, const size_t, const iox_numa_policy_t, const uint64_t)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+int iox_numa_get_current_node(uint32_t* node)
+{
+    // without NUMA support all memory and CPUs belong to node 0
+    *node = 0U;
+    return 0;
+}
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+int iox_numa_get_page_nodes(const void* const*, const size_t, int*)
+{
+    errno = ENOSYS;
+    return -1;
+}
@@ -0,0 +1,61 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_hoofs/platform/pidfd.hpp"
+#include "iceoryx_hoofs/platform/errno.hpp"
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+int iox_pidfd_open(pid_t)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+int iox_pidfd_has_exited(int)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+int iox_pidfd_set_create(void)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+int iox_pidfd_set_add(int, int)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+int iox_pidfd_set_wait(int, int)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+int iox_pidfd_close(int)
+{
+    errno = ENOSYS;
+    return -1;
+}
@@ -0,0 +1,41 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/platform/futex.hpp"
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "the futex word must be a plain 32 bit integer");
+static_assert(ATOMIC_INT_LOCK_FREE == 2, "the futex word must be lock free");
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+int iox_futex_wait(std::atomic<uint32_t>* address, const uint32_t expectedValue, const struct timespec* relativeTimeout)
+{
+    // no FUTEX_PRIVATE_FLAG since the futex word is shared between processes
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) required by the syscall interface
+    return static_cast<int>(syscall(
+        SYS_futex, reinterpret_cast<uint32_t*>(address), FUTEX_WAIT, expectedValue, relativeTimeout, nullptr, 0));
+}
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+int iox_futex_wake(std::atomic<uint32_t>* address, const uint32_t numberOfWaiters)
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) required by the syscall interface
+    return static_cast<int>(
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(address), FUTEX_WAKE, numberOfWaiters, nullptr, nullptr, 0));
+}
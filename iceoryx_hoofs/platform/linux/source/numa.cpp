@@ -0,0 +1,80 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_hoofs/platform/numa.hpp"
+
+#include <linux/mempolicy.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+int iox_numa_set_memory_policy(void* address,
+                               const size_t length,
+                               const iox_numa_policy_t policy,
+                               const uint64_t nodeMask)
+{
+    int mode{MPOL_PREFERRED};
+    unsigned long mask{static_cast<unsigned long>(nodeMask)};
+    switch (policy)
+    {
+    case IOX_NUMA_POLICY_PREFERRED:
+        // a preferred policy has only a single node
+        mode = MPOL_PREFERRED;
+        mask = mask & (~mask + 1U);
+        break;
+    case IOX_NUMA_POLICY_BIND:
+        mode = MPOL_BIND;
+        break;
+    case IOX_NUMA_POLICY_INTERLEAVE:
+        mode = MPOL_INTERLEAVE;
+        break;
+    }
+
+    // the kernel evaluates maxnode - 1 bits of the node mask
+    constexpr unsigned long MAX_NODE{IOX_NUMA_MAX_NODES + 1U};
+    return static_cast<int>(syscall(SYS_mbind, address, length, mode, &mask, MAX_NODE, MPOL_MF_MOVE));
+}
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+int iox_numa_get_current_node(uint32_t* node)
+{
+    unsigned int cpu{0U};
+    unsigned int currentNode{0U};
+#if defined(__GLIBC__) && defined(__GLIBC_PREREQ)
+#if __GLIBC_PREREQ(2, 29)
+    // the glibc wrapper uses the vDSO and is therefore much cheaper than the syscall
+    const int result = getcpu(&cpu, &currentNode);
+#else
+    const int result = static_cast<int>(syscall(SYS_getcpu, &cpu, &currentNode, nullptr));
+#endif
+#else
+    const int result = static_cast<int>(syscall(SYS_getcpu, &cpu, &currentNode, nullptr));
+#endif
+    if (result == 0)
+    {
+        *node = currentNode;
+    }
+    return result;
+}
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+int iox_numa_get_page_nodes(const void* const* pages, const size_t numberOfPages, int* nodes)
+{
+    // without target nodes move_pages only reports the node of every page
+    return static_cast<int>(syscall(SYS_move_pages, 0, numberOfPages, pages, nullptr, nodes, 0));
+}
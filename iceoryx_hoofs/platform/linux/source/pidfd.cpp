@@ -0,0 +1,84 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_hoofs/platform/pidfd.hpp"
+
+#include <cerrno>
+#include <poll.h>
+#include <sys/epoll.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+int iox_pidfd_open(pid_t pid)
+{
+#if defined(SYS_pidfd_open)
+    // available since Linux 5.3; the file descriptor is close-on-exec
+    return static_cast<int>(syscall(SYS_pidfd_open, pid, 0));
+#else
+    static_cast<void>(pid);
+    errno = ENOSYS;
+    return -1;
+#endif
+}
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+int iox_pidfd_has_exited(int pidfd)
+{
+    pollfd fd{pidfd, POLLIN, 0};
+    const int result = poll(&fd, 1U, 0);
+    if (result < 0)
+    {
+        return -1;
+    }
+    if ((fd.revents & POLLNVAL) != 0)
+    {
+        errno = EBADF;
+        return -1;
+    }
+    return (result > 0) ? 1 : 0;
+}
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+int iox_pidfd_set_create(void)
+{
+    return epoll_create1(EPOLL_CLOEXEC);
+}
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+int iox_pidfd_set_add(int pidfdSet, int pidfd)
+{
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.fd = pidfd;
+    return epoll_ctl(pidfdSet, EPOLL_CTL_ADD, pidfd, &event);
+}
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+int iox_pidfd_set_wait(int pidfdSet, int timeoutInMs)
+{
+    // the caller checks all its processes after a wakeup, therefore the individual events are not required
+    constexpr int MAX_EVENTS{16};
+    epoll_event events[MAX_EVENTS];
+    return epoll_wait(pidfdSet, &events[0], MAX_EVENTS, timeoutInMs);
+}
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+int iox_pidfd_close(int fd)
+{
+    return close(fd);
+}
@@ -55,6 +55,9 @@ int pthread_mutex_lock(pthread_mutex_t* mutex);
 int pthread_mutex_trylock(pthread_mutex_t* mutex);
 int pthread_mutex_unlock(pthread_mutex_t* mutex);
 
+/// @brief there is no fork on windows, the handlers are never called
+int pthread_atfork(void (*prepare)(void), void (*parent)(void), void (*child)(void));
+
 using iox_pthread_t = HANDLE;
 using iox_pthread_attr_t = void;
 
@@ -221,3 +221,8 @@ int pthread_mutex_unlock(pthread_mutex_t* mutex)
     }
     return 0;
 }
+
+int pthread_atfork(void (*)(void), void (*)(void), void (*)(void))
+{
+    return 0;
+}
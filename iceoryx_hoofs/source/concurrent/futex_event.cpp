@@ -0,0 +1,124 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/concurrent/futex_event.hpp"
+#include "iceoryx_hoofs/platform/errno.hpp"
+#include "iceoryx_hoofs/platform/futex.hpp"
+
+#include <chrono>
+#include <limits>
+
+namespace iox
+{
+namespace concurrent
+{
+FutexEvent::FutexEvent(const uint32_t initialValue) noexcept
+    : m_counter(initialValue)
+{
+}
+
+cxx::expected<posix::SemaphoreError> FutexEvent::post() noexcept
+{
+    uint32_t counter = m_counter.load(std::memory_order_relaxed);
+    do
+    {
+        if (counter == std::numeric_limits<uint32_t>::max())
+        {
+            return cxx::error<posix::SemaphoreError>(posix::SemaphoreError::SEMAPHORE_OVERFLOW);
+        }
+    } while (!m_counter.compare_exchange_weak(counter, counter + 1U, std::memory_order_seq_cst));
+
+    // pairs with the increment of m_numberOfWaiters in blockWhileZero; either the waiter sees the new counter value
+    // in the futex wait or the post sees the waiter and wakes it up
+    if (m_numberOfWaiters.load(std::memory_order_seq_cst) > 0U)
+    {
+        iox_futex_wake(&m_counter, 1U);
+    }
+    return cxx::success<>();
+}
+
+bool FutexEvent::tryDecrement() noexcept
+{
+    uint32_t counter = m_counter.load(std::memory_order_relaxed);
+    while (counter > 0U)
+    {
+        if (m_counter.compare_exchange_weak(counter, counter - 1U, std::memory_order_acquire))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+cxx::expected<posix::SemaphoreError> FutexEvent::blockWhileZero(const struct timespec* relativeTimeout) noexcept
+{
+    m_numberOfWaiters.fetch_add(1U, std::memory_order_seq_cst);
+    const int result = iox_futex_wait(&m_counter, 0U, relativeTimeout);
+    const int errnum = errno;
+    m_numberOfWaiters.fetch_sub(1U, std::memory_order_relaxed);
+
+    // EAGAIN, EINTR and ETIMEDOUT are handled by the caller which rechecks the counter and the deadline
+    if (result == -1 && errnum != EAGAIN && errnum != EINTR && errnum != ETIMEDOUT)
+    {
+        return cxx::error<posix::SemaphoreError>(posix::SemaphoreError::INVALID_SEMAPHORE_HANDLE);
+    }
+    return cxx::success<>();
+}
+
+cxx::expected<posix::SemaphoreError> FutexEvent::wait() noexcept
+{
+    while (!tryDecrement())
+    {
+        auto result = blockWhileZero(nullptr);
+        if (result.has_error())
+        {
+            return result;
+        }
+    }
+    return cxx::success<>();
+}
+
+cxx::expected<bool, posix::SemaphoreError> FutexEvent::tryWait() noexcept
+{
+    return cxx::success<bool>(tryDecrement());
+}
+
+cxx::expected<posix::SemaphoreWaitState, posix::SemaphoreError>
+FutexEvent::timedWait(const units::Duration& timeout) noexcept
+{
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::nanoseconds(timeout.toNanoseconds());
+    while (!tryDecrement())
+    {
+        const auto now = std::chrono::steady_clock::now();
+        if (now >= deadline)
+        {
+            return cxx::success<posix::SemaphoreWaitState>(posix::SemaphoreWaitState::TIMEOUT);
+        }
+
+        const auto remainingTime = units::Duration::fromNanoseconds(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - now).count());
+        const struct timespec relativeTimeout = remainingTime.timespec();
+        auto result = blockWhileZero(&relativeTimeout);
+        if (result.has_error())
+        {
+            return cxx::error<posix::SemaphoreError>(result.get_error());
+        }
+    }
+    return cxx::success<posix::SemaphoreWaitState>(posix::SemaphoreWaitState::NO_TIMEOUT);
+}
+
+} // namespace concurrent
+} // namespace iox
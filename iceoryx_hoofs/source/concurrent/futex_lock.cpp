@@ -0,0 +1,247 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/concurrent/futex_lock.hpp"
+#include "iceoryx_hoofs/platform/errno.hpp"
+#include "iceoryx_hoofs/platform/futex.hpp"
+#include "iceoryx_hoofs/platform/pidfd.hpp"
+#include "iceoryx_hoofs/platform/pthread.hpp"
+#include "iceoryx_hoofs/platform/signal.hpp"
+#include "iceoryx_hoofs/platform/unistd.hpp"
+#include "iceoryx_hoofs/posix_wrapper/posix_call.hpp"
+
+#include <limits>
+
+namespace iox
+{
+namespace concurrent
+{
+namespace
+{
+void updateProcessIdAfterFork() noexcept;
+
+/// @brief getpid is a syscall, therefore the process id is cached; the child of a fork updates the cached value
+///        before it returns from fork
+std::atomic<uint32_t>& cachedProcessId() noexcept
+{
+    static std::atomic<uint32_t> processId{[] {
+        pthread_atfork(nullptr, nullptr, &updateProcessIdAfterFork);
+        return static_cast<uint32_t>(getpid());
+    }()};
+    return processId;
+}
+
+void updateProcessIdAfterFork() noexcept
+{
+    // the child must not be mistaken for the owner of the locks which the parent holds
+    cachedProcessId().store(static_cast<uint32_t>(getpid()), std::memory_order_relaxed);
+}
+
+uint32_t processIdOfCallingProcess() noexcept
+{
+    return cachedProcessId().load(std::memory_order_relaxed);
+}
+
+/// @brief identifies the thread within the process for the recursive locking, the value 0 is reserved for 'no owner'
+uint64_t callingThreadId() noexcept
+{
+    static std::atomic<uint64_t> threadCounter{1U};
+    thread_local uint64_t threadId{threadCounter.fetch_add(1U, std::memory_order_relaxed)};
+    return threadId;
+}
+
+/// @brief a process which cannot be checked is considered to be alive, therefore a lock is never taken over by mistake
+bool hasProcessTerminated(const uint32_t processId) noexcept
+{
+    const auto pid = static_cast<pid_t>(processId);
+    const int pidfd = iox_pidfd_open(pid);
+    if (pidfd >= 0)
+    {
+        // the process file descriptor also reports a terminated process which was not yet reaped by its parent
+        const bool hasExited = iox_pidfd_has_exited(pidfd) == 1;
+        iox_pidfd_close(pidfd);
+        return hasExited;
+    }
+    if (errno == ESRCH)
+    {
+        return true;
+    }
+
+    // without a process file descriptor the termination is checked with the null signal
+    static constexpr int32_t ERROR_CODE = -1;
+    static constexpr int NULL_SIGNAL = 0;
+    auto checkResult =
+        posix::posixCall(kill)(pid, NULL_SIGNAL).failureReturnValue(ERROR_CODE).ignoreErrnos(ESRCH, EPERM).evaluate();
+    return !checkResult.has_error() && checkResult->errnum == ESRCH;
+}
+} // namespace
+
+constexpr uint32_t FutexLock::UNLOCKED;
+constexpr uint32_t FutexLock::WAITERS_FLAG;
+constexpr uint32_t FutexLock::OWNER_MASK;
+
+bool FutexLock::isOwnedByCallingThread() const noexcept
+{
+    return (m_state.load(std::memory_order_relaxed) & OWNER_MASK) == processIdOfCallingProcess()
+           && m_ownerThread.load(std::memory_order_relaxed) == callingThreadId();
+}
+
+void FutexLock::setCallingThreadAsOwner() noexcept
+{
+    m_ownerThread.store(callingThreadId(), std::memory_order_relaxed);
+    m_recursionCount = 1U;
+}
+
+void FutexLock::lock() noexcept
+{
+    if (isOwnedByCallingThread())
+    {
+        ++m_recursionCount;
+        return;
+    }
+
+    const uint32_t processId = processIdOfCallingProcess();
+
+    uint32_t state{UNLOCKED};
+    if (!m_state.compare_exchange_strong(state, processId, std::memory_order_acquire, std::memory_order_relaxed))
+    {
+        while (true)
+        {
+            if (state == UNLOCKED)
+            {
+                // other threads may still be blocked, therefore the waiters flag is kept when acquiring the lock
+                // after a contention
+                if (m_state.compare_exchange_weak(
+                        state, processId | WAITERS_FLAG, std::memory_order_acquire, std::memory_order_relaxed))
+                {
+                    break;
+                }
+                continue;
+            }
+
+            if ((state & WAITERS_FLAG) == 0U)
+            {
+                if (!m_state.compare_exchange_weak(
+                        state, state | WAITERS_FLAG, std::memory_order_relaxed, std::memory_order_relaxed))
+                {
+                    continue;
+                }
+                state |= WAITERS_FLAG;
+            }
+
+            iox_futex_wait(&m_state, state, nullptr);
+            state = m_state.load(std::memory_order_relaxed);
+        }
+    }
+
+    setCallingThreadAsOwner();
+}
+
+bool FutexLock::unlock() noexcept
+{
+    if (!isOwnedByCallingThread())
+    {
+        return false;
+    }
+
+    --m_recursionCount;
+    if (m_recursionCount > 0U)
+    {
+        return true;
+    }
+
+    m_ownerThread.store(0U, std::memory_order_relaxed);
+    if ((m_state.exchange(UNLOCKED, std::memory_order_release) & WAITERS_FLAG) != 0U)
+    {
+        iox_futex_wake(&m_state, 1U);
+    }
+    return true;
+}
+
+bool FutexLock::try_lock() noexcept
+{
+    if (isOwnedByCallingThread())
+    {
+        ++m_recursionCount;
+        return true;
+    }
+
+    uint32_t state{UNLOCKED};
+    if (m_state.compare_exchange_strong(
+            state, processIdOfCallingProcess(), std::memory_order_acquire, std::memory_order_relaxed))
+    {
+        setCallingThreadAsOwner();
+        return true;
+    }
+    return false;
+}
+
+bool FutexLock::tryLockOrRecoverFromDeadOwner() noexcept
+{
+    if (try_lock())
+    {
+        return true;
+    }
+
+    // a lock held by another thread of this process is never taken over
+    const uint32_t processId = processIdOfCallingProcess();
+    uint32_t state = m_state.load(std::memory_order_relaxed);
+    const uint32_t ownerProcessId = state & OWNER_MASK;
+    if (ownerProcessId == UNLOCKED || ownerProcessId == processId || !hasProcessTerminated(ownerProcessId))
+    {
+        return false;
+    }
+
+    // the waiters flag is kept so that the blocked threads are woken up with the next unlock
+    if (m_state.compare_exchange_strong(state,
+                                        processId | (state & WAITERS_FLAG),
+                                        std::memory_order_acquire,
+                                        std::memory_order_relaxed))
+    {
+        setCallingThreadAsOwner();
+        return true;
+    }
+    return false;
+}
+
+bool FutexLock::forceUnlockOfDeadOwner(const uint32_t processId) noexcept
+{
+    uint32_t state = m_state.load(std::memory_order_relaxed);
+    if (processId == UNLOCKED || (state & OWNER_MASK) != processId || !hasProcessTerminated(processId))
+    {
+        return false;
+    }
+
+    while ((state & OWNER_MASK) == processId)
+    {
+        if (m_state.compare_exchange_weak(state, UNLOCKED, std::memory_order_acq_rel, std::memory_order_relaxed))
+        {
+            m_ownerThread.store(0U, std::memory_order_relaxed);
+            m_recursionCount = 0U;
+            iox_futex_wake(&m_state, std::numeric_limits<int32_t>::max());
+            return true;
+        }
+    }
+    return false;
+}
+
+uint32_t FutexLock::ownerProcessId() const noexcept
+{
+    return m_state.load(std::memory_order_relaxed) & OWNER_MASK;
+}
+
+} // namespace concurrent
+} // namespace iox
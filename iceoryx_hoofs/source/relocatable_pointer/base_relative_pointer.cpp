@@ -124,7 +124,21 @@ bool BaseRelativePointer::unregisterPtr(const id_t id) noexcept
 // NOLINTNEXTLINE(performance-unnecessary-value-param)
 BaseRelativePointer::ptr_t BaseRelativePointer::getBasePtr(const id_t id) noexcept
 {
-    return getRepository().getBasePtr(static_cast<id_underlying_t>(id));
+    const auto rawId = static_cast<id_underlying_t>(id);
+    auto* basePtr = getRepository().getBasePtr(rawId);
+
+    // id 0 is the raw pointer id and has no base pointer
+    if (basePtr == nullptr && rawId != 0U && rawId < MAX_POINTER_REPO_CAPACITY)
+    {
+        auto handler = unregisteredIdHandler().load(std::memory_order_acquire);
+        if (handler != nullptr)
+        {
+            handler(rawId);
+            basePtr = getRepository().getBasePtr(rawId);
+        }
+    }
+
+    return basePtr;
 }
 
 void BaseRelativePointer::unregisterAll() noexcept
@@ -132,6 +146,17 @@ void BaseRelativePointer::unregisterAll() noexcept
     getRepository().unregisterAll();
 }
 
+void BaseRelativePointer::setUnregisteredIdHandler(const UnregisteredIdHandler_t handler) noexcept
+{
+    unregisteredIdHandler().store(handler, std::memory_order_release);
+}
+
+std::atomic<BaseRelativePointer::UnregisteredIdHandler_t>& BaseRelativePointer::unregisteredIdHandler() noexcept
+{
+    static std::atomic<UnregisteredIdHandler_t> handler{nullptr};
+    return handler;
+}
+
 // NOLINTJUSTIFICATION NewType size is comparable to an integer, hence pass by value is preferred
 // NOLINTNEXTLINE(performance-unnecessary-value-param)
 BaseRelativePointer::offset_t BaseRelativePointer::getOffset(const id_t id, const_ptr_t ptr) noexcept
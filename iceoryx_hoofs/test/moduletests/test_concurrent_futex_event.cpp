@@ -0,0 +1,171 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/concurrent/futex_event.hpp"
+#include "iceoryx_hoofs/testing/watch_dog.hpp"
+#include "test.hpp"
+
+#include <atomic>
+#include <limits>
+#include <thread>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::units::duration_literals;
+using iox::concurrent::FutexEvent;
+using iox::posix::SemaphoreError;
+using iox::posix::SemaphoreWaitState;
+
+class FutexEvent_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        deadlockWatchdog.watchAndActOnFailure([] { std::terminate(); });
+    }
+
+    FutexEvent sut;
+    Watchdog deadlockWatchdog{5_s};
+};
+
+TEST_F(FutexEvent_test, TryWaitFailsWithoutPost)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e86a8e7c-6a4e-4bbd-8d69-6ba845774e3d");
+    auto result = sut.tryWait();
+    ASSERT_FALSE(result.has_error());
+    EXPECT_FALSE(*result);
+}
+
+TEST_F(FutexEvent_test, TryWaitConsumesEveryPostExactlyOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "256db9da-145b-4353-91f1-a0998d087573");
+    constexpr uint64_t NUMBER_OF_POSTS{5U};
+    for (uint64_t i = 0U; i < NUMBER_OF_POSTS; ++i)
+    {
+        ASSERT_FALSE(sut.post().has_error());
+    }
+
+    for (uint64_t i = 0U; i < NUMBER_OF_POSTS; ++i)
+    {
+        EXPECT_TRUE(*sut.tryWait());
+    }
+    EXPECT_FALSE(*sut.tryWait());
+}
+
+TEST_F(FutexEvent_test, InitialValueIsConsumable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9f69b510-3cd2-48b0-b1c2-addf445a10a8");
+    FutexEvent sutWithInitialValue(2U);
+    EXPECT_TRUE(*sutWithInitialValue.tryWait());
+    EXPECT_FALSE(sutWithInitialValue.wait().has_error());
+    EXPECT_FALSE(*sutWithInitialValue.tryWait());
+}
+
+TEST_F(FutexEvent_test, PostFailsOnOverflow)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d1245ca8-54a7-4152-9745-08453d7aa0e0");
+    FutexEvent sutAtMaximum(std::numeric_limits<uint32_t>::max());
+    auto result = sutAtMaximum.post();
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(SemaphoreError::SEMAPHORE_OVERFLOW));
+}
+
+TEST_F(FutexEvent_test, TimedWaitTimesOutWithoutPost)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0000053c-5544-4a8c-b485-da11fea9fd0c");
+    const auto timeout = 10_ms;
+    const auto start = std::chrono::steady_clock::now();
+    auto result = sut.timedWait(timeout);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(*result, Eq(SemaphoreWaitState::TIMEOUT));
+    EXPECT_THAT(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count(),
+                Ge(static_cast<int64_t>(timeout.toNanoseconds())));
+}
+
+TEST_F(FutexEvent_test, TimedWaitSucceedsAfterPost)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "de249e7a-c408-413e-8035-ff017150e35d");
+    ASSERT_FALSE(sut.post().has_error());
+    auto result = sut.timedWait(1_s);
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(*result, Eq(SemaphoreWaitState::NO_TIMEOUT));
+}
+
+TEST_F(FutexEvent_test, WaitBlocksUntilPost)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1f642733-34f1-4cf7-b2a8-765d2bbfe997");
+    std::atomic_bool hasReturned{false};
+    std::thread waiter([&] {
+        EXPECT_FALSE(sut.wait().has_error());
+        hasReturned.store(true);
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_FALSE(hasReturned.load());
+    ASSERT_FALSE(sut.post().has_error());
+    waiter.join();
+
+    EXPECT_TRUE(hasReturned.load());
+    EXPECT_FALSE(*sut.tryWait());
+}
+
+TEST_F(FutexEvent_test, TimedWaitIsWokenUpByPostBeforeTimeout)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "49317b30-1fd9-41ad-a10c-7c9430251ece");
+    SemaphoreWaitState waitState{SemaphoreWaitState::TIMEOUT};
+    std::thread waiter([&] { waitState = sut.timedWait(4_s).value(); });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    ASSERT_FALSE(sut.post().has_error());
+    waiter.join();
+
+    EXPECT_THAT(waitState, Eq(SemaphoreWaitState::NO_TIMEOUT));
+}
+
+TEST_F(FutexEvent_test, NoPostIsLostWithConcurrentPostersAndWaiters)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5695087a-f1d7-40f4-ba72-a02717f8a846");
+    constexpr uint64_t NUMBER_OF_THREADS{2U};
+    constexpr uint64_t NUMBER_OF_POSTS{10000U};
+
+    std::vector<std::thread> threads;
+    for (uint64_t i = 0U; i < NUMBER_OF_THREADS; ++i)
+    {
+        threads.emplace_back([&] {
+            for (uint64_t k = 0U; k < NUMBER_OF_POSTS; ++k)
+            {
+                EXPECT_FALSE(sut.wait().has_error());
+            }
+        });
+        threads.emplace_back([&] {
+            for (uint64_t k = 0U; k < NUMBER_OF_POSTS; ++k)
+            {
+                EXPECT_FALSE(sut.post().has_error());
+            }
+        });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    EXPECT_FALSE(*sut.tryWait());
+}
+
+} // namespace
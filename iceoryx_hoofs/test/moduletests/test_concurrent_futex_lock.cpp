@@ -0,0 +1,324 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/concurrent/futex_lock.hpp"
+#include "iceoryx_hoofs/platform/mman.hpp"
+#include "iceoryx_hoofs/platform/signal.hpp"
+#include "iceoryx_hoofs/platform/unistd.hpp"
+#include "iceoryx_hoofs/platform/wait.hpp"
+#include "iceoryx_hoofs/testing/watch_dog.hpp"
+#include "test.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::units::duration_literals;
+using iox::concurrent::FutexLock;
+
+uint32_t processIdOfCallingProcess()
+{
+    return static_cast<uint32_t>(getpid());
+}
+
+class FutexLock_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        deadlockWatchdog.watchAndActOnFailure([] { std::terminate(); });
+    }
+
+    FutexLock sut;
+    Watchdog deadlockWatchdog{5_s};
+};
+
+TEST_F(FutexLock_test, LockAndUnlockSucceeds)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cec41237-2ba2-4394-860a-08d4305c8126");
+    sut.lock();
+    EXPECT_THAT(sut.ownerProcessId(), Eq(processIdOfCallingProcess()));
+    EXPECT_TRUE(sut.unlock());
+    EXPECT_THAT(sut.ownerProcessId(), Eq(0U));
+}
+
+TEST_F(FutexLock_test, UnlockWithoutLockFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fba9ccba-01b1-4c10-95ab-efb8d8b03f98");
+    EXPECT_FALSE(sut.unlock());
+}
+
+TEST_F(FutexLock_test, LockIsRecursive)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c8df0867-4028-40d3-957e-c3f3a967fa3d");
+    sut.lock();
+    sut.lock();
+    EXPECT_TRUE(sut.try_lock());
+
+    EXPECT_TRUE(sut.unlock());
+    EXPECT_TRUE(sut.unlock());
+    EXPECT_THAT(sut.ownerProcessId(), Eq(processIdOfCallingProcess()));
+    EXPECT_TRUE(sut.unlock());
+    EXPECT_THAT(sut.ownerProcessId(), Eq(0U));
+    EXPECT_FALSE(sut.unlock());
+}
+
+TEST_F(FutexLock_test, TryLockFromOtherThreadFailsWhenLocked)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9f96cb9a-7c09-4626-891a-89ac48f36682");
+    sut.lock();
+
+    bool hasAcquiredLock{true};
+    bool hasReleasedLock{true};
+    std::thread t([&] {
+        hasAcquiredLock = sut.try_lock();
+        hasReleasedLock = sut.unlock();
+    });
+    t.join();
+
+    EXPECT_FALSE(hasAcquiredLock);
+    EXPECT_FALSE(hasReleasedLock);
+    EXPECT_TRUE(sut.unlock());
+}
+
+TEST_F(FutexLock_test, TryLockFromOtherThreadSucceedsWhenUnlocked)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "274c4302-6835-4079-916d-38dd518ac9e6");
+    bool hasAcquiredLock{false};
+    std::thread t([&] {
+        hasAcquiredLock = sut.try_lock();
+        sut.unlock();
+    });
+    t.join();
+
+    EXPECT_TRUE(hasAcquiredLock);
+    EXPECT_THAT(sut.ownerProcessId(), Eq(0U));
+}
+
+TEST_F(FutexLock_test, LockBlocksUntilOtherThreadUnlocks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4264cd32-30e6-45c0-b755-829d53c72ea0");
+    std::atomic_bool hasAcquiredLock{false};
+    sut.lock();
+
+    std::thread t([&] {
+        sut.lock();
+        hasAcquiredLock.store(true);
+        sut.unlock();
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_FALSE(hasAcquiredLock.load());
+    EXPECT_TRUE(sut.unlock());
+    t.join();
+
+    EXPECT_TRUE(hasAcquiredLock.load());
+    EXPECT_THAT(sut.ownerProcessId(), Eq(0U));
+}
+
+TEST_F(FutexLock_test, ConcurrentIncrementsAreSerialized)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3049a46a-9fc6-4a3e-9929-4bb024573c3f");
+    constexpr uint64_t NUMBER_OF_THREADS{4U};
+    constexpr uint64_t NUMBER_OF_INCREMENTS{10000U};
+    uint64_t counter{0U};
+
+    std::vector<std::thread> threads;
+    for (uint64_t i = 0U; i < NUMBER_OF_THREADS; ++i)
+    {
+        threads.emplace_back([&] {
+            for (uint64_t k = 0U; k < NUMBER_OF_INCREMENTS; ++k)
+            {
+                std::lock_guard<FutexLock> guard(sut);
+                ++counter;
+            }
+        });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    EXPECT_THAT(counter, Eq(NUMBER_OF_THREADS * NUMBER_OF_INCREMENTS));
+    EXPECT_THAT(sut.ownerProcessId(), Eq(0U));
+}
+
+TEST_F(FutexLock_test, ForceUnlockOfDeadOwnerFailsWhenProcessIsNotTheOwner)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a2aa44d4-5649-4da2-a1a5-555fa9ec0ddf");
+    sut.lock();
+    EXPECT_FALSE(sut.forceUnlockOfDeadOwner(processIdOfCallingProcess() ^ 1U));
+    EXPECT_TRUE(sut.unlock());
+    EXPECT_FALSE(sut.forceUnlockOfDeadOwner(processIdOfCallingProcess()));
+}
+
+TEST_F(FutexLock_test, ForceUnlockOfDeadOwnerFailsWhenOwningProcessIsAlive)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "10773fdd-aef0-45ab-a8cd-19169a133fc3");
+    // a finished thread which never unlocked leaves the lock to the calling process which is still alive
+    std::thread owner([&] { sut.lock(); });
+    owner.join();
+
+    EXPECT_FALSE(sut.forceUnlockOfDeadOwner(processIdOfCallingProcess()));
+    EXPECT_THAT(sut.ownerProcessId(), Eq(processIdOfCallingProcess()));
+}
+
+TEST_F(FutexLock_test, TryLockOrRecoverFromDeadOwnerFailsWhenOtherThreadOfSameProcessIsOwner)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1b201bc9-eada-44e1-b9d8-8d2061f312db");
+    std::thread owner([&] { sut.lock(); });
+    owner.join();
+
+    EXPECT_FALSE(sut.tryLockOrRecoverFromDeadOwner());
+    EXPECT_THAT(sut.ownerProcessId(), Eq(processIdOfCallingProcess()));
+}
+
+#if !defined(_WIN32)
+class FutexLockInSharedMemory_test : public FutexLock_test
+{
+  public:
+    struct SharedData
+    {
+        FutexLock lock;
+        std::atomic_bool isLockedByChild{false};
+    };
+
+    void SetUp() override
+    {
+        FutexLock_test::SetUp();
+        void* memory = mmap(nullptr, sizeof(SharedData), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+        ASSERT_NE(memory, MAP_FAILED);
+        sharedData = new (memory) SharedData();
+    }
+
+    void TearDown() override
+    {
+        if (sharedData != nullptr)
+        {
+            sharedData->~SharedData();
+            munmap(sharedData, sizeof(SharedData));
+        }
+    }
+
+    /// @brief the child acquires the lock and either terminates without unlocking or stays alive until it is killed
+    pid_t forkChildWhichAcquiresLock(const bool staysAlive)
+    {
+        auto childProcessId = fork();
+        if (childProcessId == 0)
+        {
+            sharedData->lock.lock();
+            sharedData->isLockedByChild.store(true);
+            constexpr uint64_t MAX_NUMBER_OF_SLEEPS{1000U};
+            for (uint64_t i = 0U; staysAlive && i < MAX_NUMBER_OF_SLEEPS; ++i)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+            _exit(0);
+        }
+        return childProcessId;
+    }
+
+    SharedData* sharedData{nullptr};
+};
+
+TEST_F(FutexLockInSharedMemory_test, ForceUnlockOfDeadOwnerReleasesLockOfTerminatedProcessAndWakesUpWaiter)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1f5215f3-f94a-4ed1-95f3-11530508e0ba");
+    auto childProcessId = forkChildWhichAcquiresLock(false);
+    ASSERT_NE(childProcessId, -1);
+    int status{0};
+    waitpid(childProcessId, &status, 0);
+    ASSERT_TRUE(sharedData->isLockedByChild.load());
+
+    std::atomic_bool hasAcquiredLock{false};
+    std::thread waiter([&] {
+        sharedData->lock.lock();
+        hasAcquiredLock.store(true);
+        sharedData->lock.unlock();
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_FALSE(hasAcquiredLock.load());
+    EXPECT_TRUE(sharedData->lock.forceUnlockOfDeadOwner(static_cast<uint32_t>(childProcessId)));
+    waiter.join();
+
+    EXPECT_TRUE(hasAcquiredLock.load());
+    EXPECT_THAT(sharedData->lock.ownerProcessId(), Eq(0U));
+}
+
+TEST_F(FutexLockInSharedMemory_test, TryLockOrRecoverFromDeadOwnerTakesOverLockOfTerminatedProcess)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b2b5f8de-3045-4acb-993a-4f7fbb7bf38f");
+    auto childProcessId = forkChildWhichAcquiresLock(false);
+    ASSERT_NE(childProcessId, -1);
+    int status{0};
+    waitpid(childProcessId, &status, 0);
+
+    EXPECT_THAT(sharedData->lock.ownerProcessId(), Eq(static_cast<uint32_t>(childProcessId)));
+    EXPECT_TRUE(sharedData->lock.tryLockOrRecoverFromDeadOwner());
+    EXPECT_THAT(sharedData->lock.ownerProcessId(), Eq(processIdOfCallingProcess()));
+    EXPECT_TRUE(sharedData->lock.unlock());
+}
+
+TEST_F(FutexLockInSharedMemory_test, LockOfLivingProcessIsNotRecoveredUntilItIsTerminated)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3b6066ec-6d2e-4366-a1a0-a76714770987");
+    auto childProcessId = forkChildWhichAcquiresLock(true);
+    ASSERT_NE(childProcessId, -1);
+    while (!sharedData->isLockedByChild.load())
+    {
+        std::this_thread::yield();
+    }
+
+    EXPECT_FALSE(sharedData->lock.tryLockOrRecoverFromDeadOwner());
+    EXPECT_FALSE(sharedData->lock.forceUnlockOfDeadOwner(static_cast<uint32_t>(childProcessId)));
+    EXPECT_THAT(sharedData->lock.ownerProcessId(), Eq(static_cast<uint32_t>(childProcessId)));
+
+    kill(childProcessId, SIGKILL);
+    int status{0};
+    waitpid(childProcessId, &status, 0);
+
+    EXPECT_TRUE(sharedData->lock.tryLockOrRecoverFromDeadOwner());
+    EXPECT_TRUE(sharedData->lock.unlock());
+}
+
+TEST_F(FutexLock_test, ForkedProcessDoesNotOwnTheLockOfTheParent)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3681dbe1-269e-4473-a423-f3d6063f9155");
+    const uint32_t parentProcessId = processIdOfCallingProcess();
+    sut.lock();
+
+    auto childProcessId = fork();
+    ASSERT_NE(childProcessId, -1);
+    if (childProcessId == 0)
+    {
+        // the copy of the lock in the child is still held by the parent and must not be acquired recursively
+        const bool isLockedByParent = sut.ownerProcessId() == parentProcessId && !sut.try_lock() && !sut.unlock();
+        _exit(isLockedByParent ? 0 : 1);
+    }
+    int status{0};
+    waitpid(childProcessId, &status, 0);
+
+    ASSERT_TRUE(WIFEXITED(status));
+    EXPECT_THAT(WEXITSTATUS(status), Eq(0));
+    EXPECT_TRUE(sut.unlock());
+}
+#endif
+
+} // namespace
@@ -0,0 +1,60 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/cxx/fnv1a_hash.hpp"
+
+#include "test.hpp"
+
+#include <cstring>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::cxx;
+
+uint64_t hashOf(const char* const data)
+{
+    return fnv1aHash(data, strlen(data));
+}
+
+TEST(fnv1aHash_test, EmptyDataResultsInOffsetBasis)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ab4eea50-9638-40bf-944b-86a14ff168e4");
+    EXPECT_THAT(hashOf(""), Eq(FNV1A_OFFSET_BASIS));
+}
+
+TEST(fnv1aHash_test, HashMatchesReferenceValues)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4e8f2d0e-de83-41c5-b5ed-2a518880a053");
+    EXPECT_THAT(hashOf("a"), Eq(0xaf63dc4c8601ec8cU));
+    EXPECT_THAT(hashOf("foobar"), Eq(0x85944171f73967e8U));
+}
+
+TEST(fnv1aHash_test, ChainedHashEqualsHashOfConcatenatedData)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4a0ee898-6b21-4336-80c1-0040af0eb2e0");
+    const uint64_t chainedHash = fnv1aHash("bar", 3U, fnv1aHash("foo", 3U));
+    EXPECT_THAT(chainedHash, Eq(hashOf("foobar")));
+}
+
+TEST(fnv1aHash_test, HashIsUsableInConstantExpressions)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "40cbb16c-9dec-4989-a405-3012c11c6812");
+    constexpr uint64_t HASH{fnv1aHash("a", 1U)};
+    EXPECT_THAT(HASH, Eq(0xaf63dc4c8601ec8cU));
+}
+
+} // namespace
@@ -3695,4 +3695,21 @@ TEST(String10, InsertCxxStringAtPositionGreaterStringSizeFails)
     EXPECT_THAT(sut.size(), Eq(expectedString.size()));
     EXPECT_THAT(sut, Eq(expectedString));
 }
+
+TEST(String10, HashOfEqualStringsWithDifferentCapacityIsEqual)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "429a21ac-9313-4a1f-9d36-fc6749e27d0a");
+    const string<10U> sut("Muesli");
+    const string<100U> sameContent("Muesli");
+    EXPECT_THAT(std::hash<string<10U>>()(sut), Eq(std::hash<string<100U>>()(sameContent)));
+}
+
+TEST(String10, HashOfDifferentStringsDiffers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ba8491c5-6293-4d34-8ecb-d520bff1d228");
+    const string<10U> sut("Muesli");
+    const string<10U> otherContent("Muesly");
+    EXPECT_THAT(std::hash<string<10U>>()(sut), Ne(std::hash<string<10U>>()(otherContent)));
+    EXPECT_THAT(std::hash<string<10U>>()(string<10U>()), Ne(std::hash<string<10U>>()(sut)));
+}
 } // namespace
@@ -146,4 +146,56 @@ TEST_F(VariantQueue_test, underlyingTypeIsEmptyWhenCreated)
     VariantQueue<int, 5> sut(static_cast<VariantQueueTypes>(0));
     EXPECT_THAT(sut.getUnderlyingFiFo().template get_at_index<0>()->empty(), Eq(true));
 }
+template <VariantQueueTypes Type>
+void pushAndPopWithStaticQueueType()
+{
+    VariantQueue<int, 5> sut(Type);
+    EXPECT_FALSE(sut.template push<Type>(1337).has_value());
+    EXPECT_FALSE(sut.template push<Type>(4711).has_value());
+
+    auto element = sut.template pop<Type>();
+    ASSERT_THAT(element.has_value(), Eq(true));
+    EXPECT_THAT(element.value(), Eq(1337));
+    element = sut.pop();
+    ASSERT_THAT(element.has_value(), Eq(true));
+    EXPECT_THAT(element.value(), Eq(4711));
+    EXPECT_FALSE(sut.template pop<Type>().has_value());
+}
+
+TEST_F(VariantQueue_test, popsElementsWhichWerePushedWithStaticQueueType)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1edcafd2-6391-41a2-8c75-2011db008ae4");
+    pushAndPopWithStaticQueueType<VariantQueueTypes::FiFo_SingleProducerSingleConsumer>();
+    pushAndPopWithStaticQueueType<VariantQueueTypes::SoFi_SingleProducerSingleConsumer>();
+    pushAndPopWithStaticQueueType<VariantQueueTypes::FiFo_MultiProducerSingleConsumer>();
+    pushAndPopWithStaticQueueType<VariantQueueTypes::SoFi_MultiProducerSingleConsumer>();
+}
+
+template <VariantQueueTypes Type>
+void compareOverflowOfStaticAndRuntimeQueueType()
+{
+    constexpr int NUMBER_OF_PUSHES{5};
+    VariantQueue<int, 2> staticSut(Type);
+    VariantQueue<int, 2> runtimeSut(Type);
+
+    for (int i = 0; i < NUMBER_OF_PUSHES; ++i)
+    {
+        auto staticOverflow = staticSut.template push<Type>(i);
+        auto runtimeOverflow = runtimeSut.push(i);
+        ASSERT_THAT(staticOverflow.has_value(), Eq(runtimeOverflow.has_value()));
+        if (staticOverflow.has_value())
+        {
+            EXPECT_THAT(staticOverflow.value(), Eq(runtimeOverflow.value()));
+        }
+    }
+}
+
+TEST_F(VariantQueue_test, overflowWithStaticQueueTypeReturnsSameValueAsRuntimeDispatch)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7aa77af8-c2ba-4c84-9449-1ffb1a27313c");
+    compareOverflowOfStaticAndRuntimeQueueType<VariantQueueTypes::FiFo_SingleProducerSingleConsumer>();
+    compareOverflowOfStaticAndRuntimeQueueType<VariantQueueTypes::SoFi_SingleProducerSingleConsumer>();
+    compareOverflowOfStaticAndRuntimeQueueType<VariantQueueTypes::FiFo_MultiProducerSingleConsumer>();
+    compareOverflowOfStaticAndRuntimeQueueType<VariantQueueTypes::SoFi_MultiProducerSingleConsumer>();
+}
 } // namespace
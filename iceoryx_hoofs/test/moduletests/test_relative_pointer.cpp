@@ -555,4 +555,48 @@ TYPED_TEST(RelativePointer_test, DefaultConstructedRelativePtrIsNull)
     EXPECT_EQ(rp2, nullptr);
 }
 
+void* lazilyRegisteredSegment{nullptr};
+uint64_t numberOfUnregisteredIdHandlerCalls{0U};
+
+void registerSegmentLazily(const BaseRelativePointer::id_underlying_t id)
+{
+    ++numberOfUnregisteredIdHandlerCalls;
+    BaseRelativePointer::registerPtr(BaseRelativePointer::id_t{id}, lazilyRegisteredSegment, SHARED_MEMORY_SIZE);
+}
+
+TYPED_TEST(RelativePointer_test, UnregisteredIdIsResolvedWithTheSegmentRegisteredByTheHandler)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "821e7f71-65a4-4533-97a1-cdd35f5ab1ac");
+    constexpr uint64_t ID{13U};
+    constexpr uint64_t OFFSET{SHARED_MEMORY_SIZE / 4U};
+    lazilyRegisteredSegment = this->partitionPtr(1U);
+    numberOfUnregisteredIdHandlerCalls = 0U;
+    BaseRelativePointer::setUnregisteredIdHandler(registerSegmentLazily);
+
+    RelativePointer<TypeParam> sut(OFFSET, BaseRelativePointer::id_t{ID});
+
+    // NOLINTJUSTIFICATION Pointer arithmetic needed for tests
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic, cppcoreguidelines-pro-type-reinterpret-cast)
+    EXPECT_EQ(sut.get(), reinterpret_cast<TypeParam*>(this->partitionPtr(1U) + OFFSET));
+    EXPECT_EQ(sut.get(), reinterpret_cast<TypeParam*>(this->partitionPtr(1U) + OFFSET));
+    EXPECT_EQ(numberOfUnregisteredIdHandlerCalls, 1U);
+
+    BaseRelativePointer::setUnregisteredIdHandler(nullptr);
+}
+
+TYPED_TEST(RelativePointer_test, UnregisteredIdHandlerIsNotCalledForRawPointerId)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7adc064c-85e7-41cf-86e2-ca6239a4fa90");
+    numberOfUnregisteredIdHandlerCalls = 0U;
+    BaseRelativePointer::setUnregisteredIdHandler(registerSegmentLazily);
+
+    TypeParam value{};
+    RelativePointer<TypeParam> sut(&value);
+
+    EXPECT_EQ(sut.get(), &value);
+    EXPECT_EQ(numberOfUnregisteredIdHandlerCalls, 0U);
+
+    BaseRelativePointer::setUnregisteredIdHandler(nullptr);
+}
+
 } // namespace
@@ -29,7 +29,9 @@ option(DDS_GATEWAY "Builds the iceoryx dds gateway - enables internode communica
 option(DOWNLOAD_TOML_LIB "Download cpptoml via the CMake ExternalProject module" ON)
 option(EXAMPLES "Build all iceoryx examples" OFF)
 option(INTROSPECTION "Builds the introspection client which requires the ncurses library with an activated terminfo feature" OFF)
+option(MEMPOOL_ADVISOR "Builds the iox-mempool-advisor tool to derive a mempool config from a mempool profile" OFF)
 option(ONE_TO_MANY_ONLY "Restricts communication to 1:n pattern" OFF)
+option(RECORD_REPLAY "Builds the iox-record and iox-replay tools to record and replay topics" OFF)
 option(ROUDI_ENVIRONMENT "Build RouDi Environment for testing, is enabled when building tests" OFF)
 option(SANITIZE "Build with sanitizers" OFF)
 option(TEST_WITH_ADDITIONAL_USER "Build Test with additional user accounts for testing access control" OFF)
@@ -41,6 +43,8 @@ if(BUILD_ALL)
   set(EXAMPLES ON)
   set(BUILD_TEST ON)
   set(INTROSPECTION ON)
+  set(MEMPOOL_ADVISOR ON)
+  set(RECORD_REPLAY ON)
   set(BINDING_C ON)
   set(DDS_GATEWAY ON)
 endif()
@@ -85,7 +89,9 @@ function(show_config_options)
   message("          DOWNLOAD_TOML_LIB....................: " ${DOWNLOAD_TOML_LIB})
   message("          EXAMPLES.............................: " ${EXAMPLES})
   message("          INTROSPECTION........................: " ${INTROSPECTION})
+  message("          MEMPOOL_ADVISOR......................: " ${MEMPOOL_ADVISOR})
   message("          ONE_TO_MANY_ONLY ....................: " ${ONE_TO_MANY_ONLY})
+  message("          RECORD_REPLAY........................: " ${RECORD_REPLAY})
   message("          ROUDI_ENVIRONMENT....................: " ${ROUDI_ENVIRONMENT} ${ROUDI_ENV_HINT})
   message("          SANITIZE.............................: " ${SANITIZE})
   message("          TEST_WITH_ADDITIONAL_USER ...........: " ${TEST_WITH_ADDITIONAL_USER})
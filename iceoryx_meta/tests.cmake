@@ -44,6 +44,10 @@ if (BUILD_TEST)
         endif()
     endforeach()
 
+    if("cxx_std_20" IN_LIST CMAKE_CXX_COMPILE_FEATURES)
+        list(APPEND INTEGRATIONTEST_CMD COMMAND ./posh/test/posh_coroutinetests --gtest_filter=-*.TimingTest_* --gtest_output=xml:${CMAKE_BINARY_DIR}/testresults/posh_CoroutineTestResults.xml)
+    endif()
+
     add_custom_target( all_tests
         ${MODULETEST_CMD}
         ${MOCKTEST_CMD}
@@ -62,6 +62,21 @@ if(NOT IOX_MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY)
 endif()
 message(STATUS "[i] IOX_MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY:" ${IOX_MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY})
 
+if(NOT IOX_MAX_RESPONSES_PROCESSED_SIMULTANEOUSLY)
+    set(IOX_MAX_RESPONSES_PROCESSED_SIMULTANEOUSLY 16)
+endif()
+message(STATUS "[i] IOX_MAX_RESPONSES_PROCESSED_SIMULTANEOUSLY:" ${IOX_MAX_RESPONSES_PROCESSED_SIMULTANEOUSLY})
+
+if(NOT IOX_MAX_RESPONSE_QUEUE_CAPACITY)
+    set(IOX_MAX_RESPONSE_QUEUE_CAPACITY 16)
+endif()
+message(STATUS "[i] IOX_MAX_RESPONSE_QUEUE_CAPACITY:" ${IOX_MAX_RESPONSE_QUEUE_CAPACITY})
+
+if(NOT IOX_MAX_OUTSTANDING_REQUESTS_PER_CLIENT)
+    set(IOX_MAX_OUTSTANDING_REQUESTS_PER_CLIENT 256)
+endif()
+message(STATUS "[i] IOX_MAX_OUTSTANDING_REQUESTS_PER_CLIENT:" ${IOX_MAX_OUTSTANDING_REQUESTS_PER_CLIENT})
+
 # note: don't change IOX_INTERNAL_MAX_NUMBER_OF_NOTIFIERS value because it could break the C-Binding
 #if(NOT IOX_MAX_NUMBER_OF_NOTIFIERS)
 set(IOX_INTERNAL_MAX_NUMBER_OF_NOTIFIERS 256)
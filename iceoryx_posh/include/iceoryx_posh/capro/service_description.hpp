@@ -58,11 +58,14 @@ enum class Interfaces : uint16_t
     MTA,
     /// @brief Robot Operating System 1
     ROS1,
+    /// @brief Shared memory bridge between two iceoryx systems on the same host
+    SHM_BRIDGE,
     /// @brief End of enum
     INTERFACE_END
 };
 
-constexpr const char* INTERFACE_NAMES[] = {"INTERNAL", "ESOC", "SOMEIP", "AMQP", "DDS", "SIGNAL", "MTA", "ROS1", "END"};
+constexpr const char* INTERFACE_NAMES[] = {
+    "INTERNAL", "ESOC", "SOMEIP", "AMQP", "MQTT", "DDS", "SIGNAL", "MTA", "ROS1", "SHM_BRIDGE", "END"};
 
 /// @brief Scope of a service description
 enum class Scope : uint16_t
@@ -148,10 +151,17 @@ class ServiceDescription
     ClassHash getClassHash() const noexcept;
     ///@}
 
+    /// @brief Returns the 64-Bit hash of the service, instance and event string. It is computed once on construction
+    /// and is used to speed up comparisons and lookups.
+    uint64_t getHash() const noexcept;
+
     /// @brief Returns the interface form where the service is coming from.
     Interfaces getSourceInterface() const noexcept;
 
   private:
+    static uint64_t
+    computeHash(const IdString_t& service, const IdString_t& instance, const IdString_t& event) noexcept;
+
     /// @brief string representation of the service
     IdString_t m_serviceString;
     /// @brief string representation of the instance
@@ -162,6 +172,9 @@ class ServiceDescription
     /// @brief 128-Bit class hash (32-Bit * 4)
     ClassHash m_classHash{0, 0, 0, 0};
 
+    /// @brief 64-Bit hash of the string IDs, stored alongside the strings to be available in shared memory
+    uint64_t m_hash{0U};
+
     /// @brief How far this service should be propagated
     Scope m_scope{Scope::WORLDWIDE};
 
@@ -100,6 +100,7 @@ namespace iox
     error(POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_DESTROY) \
     error(POPO__CONDITION_NOTIFIER_INDEX_TOO_LARGE) \
     error(POPO__CONDITION_NOTIFIER_SEMAPHORE_CORRUPT_IN_NOTIFY) \
+    error(POPO__COROUTINE_SCHEDULER_UNABLE_TO_ATTACH_AWAITABLE) \
     error(POPO__NOTIFICATION_INFO_TYPE_INCONSISTENCY_IN_GET_ORIGIN) \
     error(POPO__TRIGGER_INVALID_RESET_CALLBACK) \
     error(POPO__TRIGGER_INVALID_HAS_TRIGGERED_CALLBACK) \
@@ -120,6 +121,8 @@ namespace iox
     error(MEPOO__INTROSPECTION_CONTAINER_FULL) \
     error(MEPOO__CANNOT_ALLOCATE_CHUNK) \
     error(MEPOO__MAXIMUM_NUMBER_OF_MEMPOOLS_REACHED) \
+    error(MEPOO__MEMPOOL_EXTENT_LIMIT_REACHED) \
+    error(MEPOO__MEMPOOL_EXTENT_UNABLE_TO_CREATE_SHARED_MEMORY_OBJECT) \
     error(PORT_POOL__PUBLISHERLIST_OVERFLOW) \
     error(PORT_POOL__SUBSCRIBERLIST_OVERFLOW) \
     error(PORT_POOL__CLIENTLIST_OVERFLOW) \
@@ -127,6 +130,7 @@ namespace iox
     error(PORT_POOL__INTERFACELIST_OVERFLOW) \
     error(PORT_POOL__NODELIST_OVERFLOW) \
     error(PORT_POOL__CONDITION_VARIABLE_LIST_OVERFLOW) \
+    error(PORT_POOL__RUNTIME_REQUEST_CHANNEL_LIST_OVERFLOW) \
     error(PORT_MANAGER__PORT_POOL_UNAVAILABLE) \
     error(PORT_MANAGER__INTROSPECTION_MEMORY_MANAGER_UNAVAILABLE) \
     error(PORT_MANAGER__HANDLE_PUBLISHER_PORTS_INVALID_CAPRO_MESSAGE) \
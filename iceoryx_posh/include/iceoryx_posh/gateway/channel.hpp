@@ -22,6 +22,7 @@
 #include "iceoryx_hoofs/cxx/expected.hpp"
 #include "iceoryx_hoofs/cxx/optional.hpp"
 #include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/gateway/codec.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 
 #include <memory>
@@ -52,6 +53,9 @@ enum class ChannelError : uint8_t
 /// cleaning them up when the channel is discarded.
 /// This can be achieved via the Channel::create method.
 ///
+/// A channel can have a codec stage which encodes the payloads before they are handed to the external terminal and
+/// decodes them in the other direction. The codec stage is shared by all copies of the channel.
+///
 template <typename IceoryxTerminal, typename ExternalTerminal>
 class Channel
 {
@@ -59,11 +63,14 @@ class Channel
     using IceoryxTerminalPool = cxx::ObjectPool<IceoryxTerminal, MAX_CHANNEL_NUMBER>;
     using ExternalTerminalPtr = std::shared_ptr<ExternalTerminal>;
     using ExternalTerminalPool = cxx::ObjectPool<ExternalTerminal, MAX_CHANNEL_NUMBER>;
+    using ChannelCodecPtr = std::shared_ptr<ChannelCodec>;
+    using ChannelCodecPool = cxx::ObjectPool<ChannelCodec, MAX_CHANNEL_NUMBER>;
 
   public:
     constexpr Channel(const capro::ServiceDescription& service,
                       const IceoryxTerminalPtr iceoryxTerminal,
-                      const ExternalTerminalPtr externalTerminal) noexcept;
+                      const ExternalTerminalPtr externalTerminal,
+                      const ChannelCodecPtr codec = nullptr) noexcept;
 
     constexpr bool operator==(const Channel<IceoryxTerminal, ExternalTerminal>& rhs) const noexcept;
 
@@ -71,23 +78,37 @@ class Channel
     /// @brief create Creates a channel for the given service whose terminals reside in a static object pool.
     /// @param service The service to create the channel for.
     /// @param options The PublisherOptions or SubscriberOptions with historyCapacity and queueCapacity.
+    /// @param codec The codec of the codec stage of the channel, CodecType::NONE creates no codec stage.
+    /// @param codecMaxPayloadSize The largest payload which is delta encoded, the buffers of the codec stage are
+    /// allocated once for this size.
     /// @return A copy of the created channel, if successful.
     ///
     template <typename IceoryxPubSubOptions>
     static cxx::expected<Channel, ChannelError> create(const capro::ServiceDescription& service,
-                                                       const IceoryxPubSubOptions& options) noexcept;
+                                                       const IceoryxPubSubOptions& options,
+                                                       const CodecType codec = CodecType::NONE,
+                                                       const uint32_t codecMaxPayloadSize =
+                                                           ChannelCodec::DEFAULT_MAX_PAYLOAD_SIZE) noexcept;
 
     capro::ServiceDescription getServiceDescription() const noexcept;
     IceoryxTerminalPtr getIceoryxTerminal() const noexcept;
     ExternalTerminalPtr getExternalTerminal() const noexcept;
 
+    ///
+    /// @brief getCodec Returns the codec stage of the channel.
+    /// @return The codec stage or a nullptr if the payloads are forwarded raw.
+    ///
+    ChannelCodecPtr getCodec() const noexcept;
+
   private:
     static IceoryxTerminalPool s_iceoryxTerminals;
     static ExternalTerminalPool s_externalTerminals;
+    static ChannelCodecPool s_codecs;
 
     capro::ServiceDescription m_service;
     IceoryxTerminalPtr m_iceoryxTerminal;
     ExternalTerminalPtr m_externalTerminal;
+    ChannelCodecPtr m_codec;
 };
 
 } // namespace gw
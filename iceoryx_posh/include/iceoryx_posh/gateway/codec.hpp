@@ -0,0 +1,214 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_GW_CODEC_HPP
+#define IOX_POSH_GW_CODEC_HPP
+
+#include "iceoryx_hoofs/cxx/expected.hpp"
+#include "iceoryx_hoofs/cxx/optional.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace iox
+{
+namespace gw
+{
+/// @brief The codecs of the codec stage of a gateway channel
+enum class CodecType : uint8_t
+{
+    /// @brief the payload is forwarded raw
+    NONE,
+    /// @brief LZ4-style block compression
+    LZ,
+    /// @brief XOR of the payload with the previous payload of the channel
+    XOR_DELTA,
+    /// @brief XOR delta followed by the block compression
+    XOR_DELTA_LZ
+};
+
+/// @brief the names of the codecs as used in the gateway config, in the order of CodecType
+constexpr const char* CODEC_TYPE_STRINGS[] = {"none", "lz", "xor-delta", "xor-delta-lz"};
+
+const char* asStringLiteral(const CodecType codec) noexcept;
+
+enum class CodecError : uint8_t
+{
+    BUFFER_TOO_SMALL,
+    INVALID_DATA,
+    MISSING_REFERENCE
+};
+
+const char* asStringLiteral(const CodecError error) noexcept;
+
+namespace lz
+{
+/// @brief Compresses a block in the LZ4 block format, i.e. a sequence of literal runs and matches with an offset of at
+/// most 64 KB into the already decoded data
+/// @param[in] source the data to compress
+/// @param[in] sourceSize the size of the data
+/// @param[in] destination the buffer for the compressed block
+/// @param[in] destinationCapacity the size of the buffer
+/// @return the size of the compressed block or CodecError::BUFFER_TOO_SMALL if it does not fit into the buffer
+cxx::expected<uint64_t, CodecError> compress(const uint8_t* const source,
+                                             const uint64_t sourceSize,
+                                             uint8_t* const destination,
+                                             const uint64_t destinationCapacity) noexcept;
+
+/// @brief Decompresses a block which was compressed with compress
+/// @param[in] source the compressed block
+/// @param[in] sourceSize the size of the compressed block
+/// @param[in] destination the buffer for the decompressed data
+/// @param[in] destinationCapacity the size of the buffer
+/// @return the size of the decompressed data, CodecError::INVALID_DATA if the block is malformed or
+/// CodecError::BUFFER_TOO_SMALL if the data does not fit into the buffer
+cxx::expected<uint64_t, CodecError> decompress(const uint8_t* const source,
+                                               const uint64_t sourceSize,
+                                               uint8_t* const destination,
+                                               const uint64_t destinationCapacity) noexcept;
+} // namespace lz
+
+/// @brief the statistics of a codec stage
+struct CodecStatistics
+{
+    uint64_t m_encodedFrames{0U};
+    uint64_t m_keyFrames{0U};
+    uint64_t m_decodedFrames{0U};
+    uint64_t m_codecErrors{0U};
+    /// @brief sum of the payload sizes of the encoded frames
+    uint64_t m_rawBytes{0U};
+    /// @brief sum of the sizes of the encoded frames, including the frame header
+    uint64_t m_encodedBytes{0U};
+    uint64_t m_encodeTimeInNanoseconds{0U};
+    uint64_t m_decodeTimeInNanoseconds{0U};
+
+    /// @brief returns raw bytes / encoded bytes or 0 if nothing was encoded yet
+    double compressionRatio() const noexcept;
+};
+
+/// @brief The codec stage of a gateway channel. The sending side of the gateway encodes a payload into a frame before
+/// it is handed to the external system, the receiving side decodes the frame into a loaned chunk.
+///
+/// A frame starts with a FrameHeader followed by the encoded payload. The delta codecs keep the previous payload
+/// as reference and a frame which is the first one, has a different size than the reference or is the
+/// KEY_FRAME_INTERVAL-th one is a key frame without delta. A delta frame carries its index since the key frame, a
+/// decoder detects a lost frame and recovers with the next key frame.
+/// The buffers for the reference and the delta are allocated once on construction for payloads of up to
+/// maxPayloadSize bytes. A larger payload is always a key frame and does not become the reference, therefore the
+/// encoder and the decoder of a channel must use the same maxPayloadSize.
+/// Compression is skipped for a frame when the compressed payload would not be smaller than the raw one.
+///
+/// @note encode and decode are not thread-safe, each direction of a channel must be used by one thread only; the
+/// statistics can be read from any thread
+class ChannelCodec
+{
+  public:
+    static constexpr uint64_t KEY_FRAME_INTERVAL{32U};
+    static constexpr uint32_t DEFAULT_MAX_PAYLOAD_SIZE{1024U * 1024U};
+
+    struct FrameHeader
+    {
+        static constexpr uint8_t DELTA{1U};
+        static constexpr uint8_t COMPRESSED{2U};
+
+        uint8_t m_codec{0U};
+        uint8_t m_flags{0U};
+        /// @brief the number of frames since the last key frame, 0 for a key frame
+        uint16_t m_frameIndex{0U};
+        uint32_t m_payloadSize{0U};
+    };
+
+    /// @param[in] codec of the channel
+    /// @param[in] maxPayloadSize the largest payload which is delta encoded, only used by the delta codecs
+    explicit ChannelCodec(const CodecType codec, const uint32_t maxPayloadSize = DEFAULT_MAX_PAYLOAD_SIZE) noexcept;
+
+    ChannelCodec(const ChannelCodec&) = delete;
+    ChannelCodec(ChannelCodec&&) = delete;
+    ChannelCodec& operator=(const ChannelCodec&) = delete;
+    ChannelCodec& operator=(ChannelCodec&&) = delete;
+    ~ChannelCodec() noexcept = default;
+
+    CodecType codec() const noexcept;
+
+    uint32_t maxPayloadSize() const noexcept;
+
+    /// @brief returns the buffer size which is required to encode a payload of the given size
+    static uint64_t maxEncodedSize(const uint32_t payloadSize) noexcept;
+
+    /// @brief encodes a payload into a frame
+    /// @param[in] payload to encode
+    /// @param[in] payloadSize size of the payload
+    /// @param[in] frame the buffer for the frame, must have at least maxEncodedSize(payloadSize) bytes
+    /// @param[in] frameCapacity size of the buffer
+    /// @return the size of the frame
+    cxx::expected<uint64_t, CodecError> encode(const void* const payload,
+                                               const uint32_t payloadSize,
+                                               void* const frame,
+                                               const uint64_t frameCapacity) noexcept;
+
+    /// @brief returns the size of the payload which is encoded in the frame
+    cxx::expected<uint32_t, CodecError> decodedSize(const void* const frame, const uint64_t frameSize) const noexcept;
+
+    /// @brief decodes a frame
+    /// @param[in] frame to decode
+    /// @param[in] frameSize size of the frame
+    /// @param[in] payload the buffer for the payload, must have at least decodedSize bytes
+    /// @param[in] payloadCapacity size of the buffer
+    /// @return the size of the payload, CodecError::MISSING_REFERENCE when a delta frame cannot be decoded since the
+    /// previous frame was lost
+    cxx::expected<uint32_t, CodecError> decode(const void* const frame,
+                                               const uint64_t frameSize,
+                                               void* const payload,
+                                               const uint64_t payloadCapacity) noexcept;
+
+    CodecStatistics statistics() const noexcept;
+
+  private:
+    bool usesDelta() const noexcept;
+    bool usesCompression() const noexcept;
+    cxx::expected<uint32_t, CodecError> decodeFrame(const void* const frame,
+                                                    const uint64_t frameSize,
+                                                    void* const payload,
+                                                    const uint64_t payloadCapacity) noexcept;
+
+  private:
+    CodecType m_codec{CodecType::NONE};
+    uint32_t m_maxPayloadSize{0U};
+    // the buffers have a size of m_maxPayloadSize and are never resized
+    std::vector<uint8_t> m_encodeReference;
+    std::vector<uint8_t> m_decodeReference;
+    std::vector<uint8_t> m_delta;
+    cxx::optional<uint32_t> m_encodeReferenceSize;
+    cxx::optional<uint32_t> m_decodeReferenceSize;
+    uint64_t m_framesSinceKeyFrame{0U};
+    uint64_t m_decodeFrameIndex{0U};
+
+    std::atomic<uint64_t> m_encodedFrames{0U};
+    std::atomic<uint64_t> m_keyFrames{0U};
+    std::atomic<uint64_t> m_decodedFrames{0U};
+    std::atomic<uint64_t> m_codecErrors{0U};
+    std::atomic<uint64_t> m_rawBytes{0U};
+    std::atomic<uint64_t> m_encodedBytes{0U};
+    std::atomic<uint64_t> m_encodeTimeInNanoseconds{0U};
+    std::atomic<uint64_t> m_decodeTimeInNanoseconds{0U};
+};
+
+} // namespace gw
+} // namespace iox
+
+#endif // IOX_POSH_GW_CODEC_HPP
@@ -19,6 +19,7 @@
 
 #include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/gateway/codec.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 
 namespace iox
@@ -33,6 +34,10 @@ struct GatewayConfig
     struct ServiceEntry
     {
         capro::ServiceDescription m_serviceDescription;
+        /// @brief the codec of the codec stage of the channel for the service
+        gw::CodecType m_codec{gw::CodecType::NONE};
+        /// @brief the largest payload which is delta encoded by the codec stage
+        uint32_t m_codecMaxPayloadSize{gw::ChannelCodec::DEFAULT_MAX_PAYLOAD_SIZE};
     };
     iox::cxx::vector<ServiceEntry, MAX_GATEWAY_SERVICES> m_configuredServices;
 
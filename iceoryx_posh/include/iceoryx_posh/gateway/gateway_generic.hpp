@@ -26,10 +26,13 @@
 #include "iceoryx_hoofs/internal/concurrent/smart_lock.hpp"
 #include "iceoryx_hoofs/internal/units/duration.hpp"
 #include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/gateway/codec.hpp"
 #include "iceoryx_posh/gateway/gateway_base.hpp"
 #include "iceoryx_posh/gateway/gateway_config.hpp"
 #include "iceoryx_posh/iceoryx_posh_config.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/popo/publisher.hpp"
+#include "iceoryx_posh/roudi/introspection_types.hpp"
 
 #include <atomic>
 #include <thread>
@@ -99,6 +102,8 @@ class GatewayGeneric : public gateway_t
     /// later access.
     /// @param service The service to create a channel for.
     /// @param options The PublisherOptions or SubscriberOptions with historyCapacity and queueCapacity.
+    /// @param codec The codec of the codec stage of the channel, CodecType::NONE forwards the payloads raw.
+    /// @param codecMaxPayloadSize The largest payload which is delta encoded by the codec stage.
     /// @return an expected containing a copy of the added channel, otherwise an error
     ///
     /// @note Wildcard services are not allowed and will be ignored.
@@ -113,7 +118,10 @@ class GatewayGeneric : public gateway_t
     ///
     template <typename IceoryxPubSubOptions>
     cxx::expected<channel_t, GatewayError> addChannel(const capro::ServiceDescription& service,
-                                                      const IceoryxPubSubOptions& options) noexcept;
+                                                      const IceoryxPubSubOptions& options,
+                                                      const CodecType codec = CodecType::NONE,
+                                                      const uint32_t codecMaxPayloadSize =
+                                                          ChannelCodec::DEFAULT_MAX_PAYLOAD_SIZE) noexcept;
 
     ///
     /// @brief findChannel Searches for a channel for the given service in the internally stored collection and returns
@@ -137,8 +145,32 @@ class GatewayGeneric : public gateway_t
     ///
     cxx::expected<GatewayError> discardChannel(const capro::ServiceDescription& service) noexcept;
 
+    ///
+    /// @brief enableCodecIntrospection Publishes the statistics of the codec stages of the channels with every
+    /// discovery period. The topic is {"Introspection", <runtime name>, "GatewayCodec"} with one sample per channel.
+    /// @note Must be called before runMultithreaded.
+    ///
+    void enableCodecIntrospection() noexcept;
+
+    ///
+    /// @brief publishCodecIntrospection Publishes the statistics of the codec stages of all channels. This is done by
+    /// the discovery loop when the codec introspection is enabled and only needs to be called by gateways which do
+    /// not use runMultithreaded.
+    ///
+    void publishCodecIntrospection() noexcept;
+
+    ///
+    /// @brief waitForData Blocks the forwarding thread between two forwarding cycles. The default implementation
+    /// sleeps for the remaining forwarding period, an event-driven gateway returns as soon as new data is available.
+    /// @param timeout The remaining time of the forwarding period.
+    ///
+    virtual void waitForData(const units::Duration& timeout) noexcept;
+
   private:
+    using CodecIntrospectionPublisher = popo::Publisher<roudi::GatewayCodecIntrospectionTopic>;
+
     ConcurrentChannelVector m_channels;
+    cxx::optional<CodecIntrospectionPublisher> m_codecIntrospectionPublisher;
 
     std::atomic_bool m_isRunning{false};
 
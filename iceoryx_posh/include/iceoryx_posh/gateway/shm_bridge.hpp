@@ -0,0 +1,164 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_GW_SHM_BRIDGE_HPP
+#define IOX_POSH_GW_SHM_BRIDGE_HPP
+
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/internal/units/duration.hpp"
+#include "iceoryx_posh/gateway/channel.hpp"
+#include "iceoryx_posh/gateway/gateway_generic.hpp"
+#include "iceoryx_posh/gateway/shm_bridge_transfer.hpp"
+#include "iceoryx_posh/internal/runtime/shared_memory_user.hpp"
+#include "iceoryx_posh/popo/listener.hpp"
+#include "iceoryx_posh/popo/untyped_publisher.hpp"
+#include "iceoryx_posh/popo/untyped_subscriber.hpp"
+
+#include <string>
+#include <vector>
+
+namespace iox
+{
+namespace gw
+{
+static constexpr units::Duration SHM_BRIDGE_DISCOVERY_PERIOD = 1000_ms;
+/// @brief the bridge is woken up by new data, the forwarding period is the longest time it waits for it
+static constexpr units::Duration SHM_BRIDGE_FORWARDING_PERIOD = 50_ms;
+/// @brief the time the sender waits for the receiver to finish reading a closed lane before its chunks are released
+static constexpr units::Duration SHM_BRIDGE_CLOSE_TIMEOUT = 100_ms;
+static constexpr uint32_t SHM_BRIDGE_SUBSCRIBER_QUEUE_CAPACITY = 128U;
+
+/// @brief The external terminal of a shared memory bridge channel, it refers to a lane of the transfer segment.
+struct ShmBridgeLane
+{
+    ShmBridgeLane(const capro::IdString_t& service,
+                  const capro::IdString_t& instance,
+                  const capro::IdString_t& event) noexcept;
+
+    uint32_t m_laneIndex{0U};
+    uint64_t m_activation{0U};
+    /// @brief sender only, the user-payloads of the chunks in the lane indexed by their descriptor index
+    const void* m_heldChunks[ShmBridgeLaneData::CAPACITY]{};
+    /// @brief sender only, all chunks with a smaller descriptor index are released
+    uint64_t m_releasedIndex{0U};
+};
+
+/// @brief The half of a shared memory bridge in the iceoryx system where the data is published. It subscribes to the
+/// offered services and hands the location of every received chunk to the receiver via a lane of the transfer
+/// segment. The chunk is held until the receiver copied it. The head chunk of a multi-chunk sample is dropped, its
+/// parts are not bridged.
+template <typename channel_t = Channel<popo::UntypedSubscriber, ShmBridgeLane>,
+          typename gateway_t = GatewayGeneric<channel_t>>
+class ShmBridgeSender : public gateway_t
+{
+  public:
+    /// @brief Creates a bridge with SHM_BRIDGE set as interface
+    /// @param[in] transfer the transfer segment created with ShmBridgeTransfer::create
+    explicit ShmBridgeSender(ShmBridgeTransfer&& transfer) noexcept;
+    ~ShmBridgeSender() noexcept;
+
+    void loadConfiguration(const config::GatewayConfig& config) noexcept;
+    void discover(const capro::CaproMessage& msg) noexcept;
+    void forward(const channel_t& channel) noexcept;
+
+  protected:
+    /// @brief publishes the lanes written in the last forwarding cycle to the receiver and waits until a subscriber
+    /// received data or the receiver consumed a batch
+    void waitForData(const units::Duration& timeout) noexcept;
+
+    /// @brief returns the shared memory which contains the chunk; by default it is one of the data segments or
+    /// mempool extents mapped by the runtime
+    virtual cxx::optional<runtime::SharedMemoryUser::SharedMemoryLocation>
+    findSharedMemory(const mepoo::ChunkHeader* const chunkHeader) noexcept;
+
+  private:
+    struct SegmentCacheEntry
+    {
+        const uint8_t* m_baseAddress{nullptr};
+        uint64_t m_size{0U};
+        uint32_t m_segmentIndex{0U};
+    };
+
+    cxx::expected<channel_t, GatewayError> setupChannel(const capro::ServiceDescription& service) noexcept;
+    void closeChannel(const channel_t& channel) noexcept;
+    void releaseChunks(const channel_t& channel, const uint64_t untilIndex) noexcept;
+    cxx::expected<ShmBridgeChunkDescriptor, ShmBridgeError>
+    describeChunk(const mepoo::ChunkHeader* const chunkHeader) noexcept;
+    static void onDataReceived(popo::UntypedSubscriber* const subscriber, ShmBridgeTransferData* const transfer);
+
+  private:
+    ShmBridgeTransfer m_transfer;
+    popo::Listener m_listener;
+    std::vector<SegmentCacheEntry> m_segmentCache;
+    bool m_hasPendingBatch{false};
+};
+
+/// @brief The half of a shared memory bridge in the iceoryx system where the data is republished. It follows the
+/// lanes of the sender and copies every chunk of a lane with a single memcpy into a chunk of its own publisher. The
+/// shared memories of the sending system are mapped read-only.
+/// @note the publishers have SHM_BRIDGE as source interface, a sender in the same iceoryx system does not bridge the
+/// republished services back
+template <typename channel_t = Channel<popo::UntypedPublisher, ShmBridgeLane>,
+          typename gateway_t = GatewayGeneric<channel_t>>
+class ShmBridgeReceiver : public gateway_t
+{
+  public:
+    /// @brief Creates a bridge with SHM_BRIDGE set as interface
+    /// @param[in] transferSegmentPath path of the transfer segment of the sender
+    /// @param[in] peerShmDirectory the directory under which the shared memories of the sending system are visible
+    ShmBridgeReceiver(const std::string& transferSegmentPath, const std::string& peerShmDirectory) noexcept;
+    ~ShmBridgeReceiver() noexcept;
+
+    /// @brief the services are announced by the sender, the configuration is not used
+    void loadConfiguration(const config::GatewayConfig& config) noexcept;
+    void discover(const capro::CaproMessage& msg) noexcept;
+    void forward(const channel_t& channel) noexcept;
+
+  protected:
+    /// @brief connects to the sender, updates the channels to the lanes of the sender and waits for the next batch
+    void waitForData(const units::Duration& timeout) noexcept;
+
+    /// @brief creates and discards channels for the lanes which were opened and closed by the sender
+    /// @return true when the lanes changed
+    bool synchronizeLanes() noexcept;
+
+  private:
+    struct LaneState
+    {
+        uint64_t m_activation{0U};
+        capro::ServiceDescription m_service;
+    };
+
+    bool connect() noexcept;
+    void disconnect() noexcept;
+    void republish(popo::UntypedPublisher& publisher, const mepoo::ChunkHeader* const peerChunk) noexcept;
+
+  private:
+    std::string m_transferSegmentPath;
+    cxx::optional<ShmBridgeTransfer> m_transfer;
+    ShmBridgePeerSegments m_peerSegments;
+    std::vector<LaneState> m_lanes;
+    uint64_t m_laneGeneration{0U};
+    bool m_isWaitingForSender{false};
+};
+
+} // namespace gw
+} // namespace iox
+
+#include "iceoryx_posh/internal/gateway/shm_bridge.inl"
+
+#endif // IOX_POSH_GW_SHM_BRIDGE_HPP
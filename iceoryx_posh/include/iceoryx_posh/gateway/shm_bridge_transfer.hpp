@@ -0,0 +1,195 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_GW_SHM_BRIDGE_TRANSFER_HPP
+#define IOX_POSH_GW_SHM_BRIDGE_TRANSFER_HPP
+
+#include "iceoryx_hoofs/cxx/algorithm.hpp"
+#include "iceoryx_hoofs/cxx/expected.hpp"
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/internal/concurrent/futex_event.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/memory_map.hpp"
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace iox
+{
+namespace gw
+{
+enum class ShmBridgeError : uint8_t
+{
+    UNABLE_TO_CREATE_TRANSFER_SEGMENT,
+    UNABLE_TO_OPEN_TRANSFER_SEGMENT,
+    INCOMPATIBLE_TRANSFER_SEGMENT,
+    UNABLE_TO_MAP_PEER_SEGMENT,
+    INVALID_CHUNK,
+    MULTI_CHUNK_SAMPLE,
+    TOO_MANY_SEGMENTS,
+    TOO_MANY_LANES
+};
+
+const char* asStringLiteral(const ShmBridgeError error) noexcept;
+
+/// @brief the location of a chunk of the sending iceoryx system
+struct ShmBridgeChunkDescriptor
+{
+    /// @brief index of the shared memory in the segment name table of the transfer segment
+    uint32_t m_segmentIndex{0U};
+    uint32_t m_reserved{0U};
+    /// @brief offset of the ChunkHeader from the start of the shared memory
+    uint64_t m_chunkOffset{0U};
+};
+
+/// @brief A single producer single consumer ring of chunk descriptors for one channel of the bridge. The sender holds
+/// the chunks of the descriptors until the receiver moved the read index past them.
+struct ShmBridgeLaneData
+{
+    static constexpr uint64_t CAPACITY{algorithm::min(64U, MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY)};
+
+    /// @brief true while the sender forwards the service of the lane
+    std::atomic<bool> m_isOpen{false};
+    /// @brief incremented by the sender whenever the lane is opened, lets the receiver detect a reused lane
+    std::atomic<uint64_t> m_activation{0U};
+    capro::ServiceDescription m_service;
+    std::atomic<uint64_t> m_writeIndex{0U};
+    std::atomic<uint64_t> m_readIndex{0U};
+    ShmBridgeChunkDescriptor m_descriptors[CAPACITY];
+};
+
+/// @brief the content of the transfer segment which is shared by the two halves of a bridge
+struct ShmBridgeTransferData
+{
+    static constexpr uint64_t MAGIC{0x69637368627269U};
+    static constexpr uint32_t VERSION{1U};
+    static constexpr uint32_t MAX_LANES{MAX_CHANNEL_NUMBER};
+    static constexpr uint32_t MAX_SEGMENTS{MAX_SHM_SEGMENTS * (1U + 2U * MAX_NUMBER_OF_MEMPOOL_EXTENTS)};
+
+    uint64_t m_magic{MAGIC};
+    uint32_t m_version{VERSION};
+    uint32_t m_chunkHeaderVersion{mepoo::ChunkHeader::CHUNK_HEADER_VERSION};
+    /// @brief incremented by the sender whenever a lane is opened or closed
+    std::atomic<uint64_t> m_laneGeneration{0U};
+    /// @brief posted by the sender after it wrote a batch of descriptors
+    concurrent::FutexEvent m_dataAvailable;
+    /// @brief posted by the receiver after it consumed a batch and by the sender when a subscriber received data
+    concurrent::FutexEvent m_senderWakeUp;
+    std::atomic<uint32_t> m_numberOfSegments{0U};
+    ShmName_t m_segmentNames[MAX_SEGMENTS];
+    ShmBridgeLaneData m_lanes[MAX_LANES];
+};
+
+/// @brief The transfer segment of a shared memory bridge. The sender creates it in its own shared memory
+/// directory, the receiver opens it via the path under which this directory is visible in its namespace.
+class ShmBridgeTransfer
+{
+  public:
+    static constexpr const char TRANSFER_SEGMENT_PREFIX[] = "iox_shm_bridge_";
+
+    /// @brief returns the name of the transfer segment of the bridge with the given name
+    static ShmName_t transferSegmentName(const ShmName_t& bridgeName) noexcept;
+
+    /// @brief creates the transfer segment, an existing segment of the same name is purged
+    /// @param[in] bridgeName the name of the bridge
+    static cxx::expected<ShmBridgeTransfer, ShmBridgeError> create(const ShmName_t& bridgeName) noexcept;
+
+    /// @brief opens the transfer segment which was created by the sender
+    /// @param[in] path of the transfer segment, e.g. "/dev/shm/iox_shm_bridge_<name>"
+    static cxx::expected<ShmBridgeTransfer, ShmBridgeError> open(const std::string& path) noexcept;
+
+    ShmBridgeTransfer(const ShmBridgeTransfer&) = delete;
+    ShmBridgeTransfer& operator=(const ShmBridgeTransfer&) = delete;
+    ShmBridgeTransfer(ShmBridgeTransfer&& rhs) noexcept = default;
+    ShmBridgeTransfer& operator=(ShmBridgeTransfer&& rhs) noexcept = default;
+    ~ShmBridgeTransfer() noexcept = default;
+
+    ShmBridgeTransferData& data() noexcept;
+    const ShmBridgeTransferData& data() const noexcept;
+
+    /// @brief opens an unused lane for the service
+    /// @return the index of the lane or ShmBridgeError::TOO_MANY_LANES
+    cxx::expected<uint32_t, ShmBridgeError> openLane(const capro::ServiceDescription& service) noexcept;
+
+    /// @brief closes the lane, it is reused when all of its descriptors were consumed
+    void closeLane(const uint32_t laneIndex) noexcept;
+
+    /// @brief returns the index of the shared memory in the segment name table, the name is added when it is unknown
+    cxx::expected<uint32_t, ShmBridgeError> segmentIndex(const ShmName_t& sharedMemoryName) noexcept;
+
+    /// @brief true when the sender replaced or removed the opened transfer segment, e.g. after a restart
+    bool isStale() const noexcept;
+
+  private:
+    ShmBridgeTransfer(posix::SharedMemoryObject&& sharedMemory) noexcept;
+    ShmBridgeTransfer(const std::string& path, const uint64_t inode, posix::MemoryMap&& memoryMap) noexcept;
+
+  private:
+    cxx::optional<posix::SharedMemoryObject> m_sharedMemory;
+    cxx::optional<posix::MemoryMap> m_memoryMap;
+    std::string m_path;
+    uint64_t m_inode{0U};
+    ShmBridgeTransferData* m_data{nullptr};
+};
+
+/// @brief Maps the shared memories of the sending iceoryx system read-only on first access of one of their chunks and
+/// resolves the chunk descriptors of the transfer segment. Every descriptor is checked against the bounds of its
+/// shared memory before the chunk is accessed.
+class ShmBridgePeerSegments
+{
+  public:
+    /// @param[in] peerShmDirectory the directory under which the shared memories of the sender are visible
+    explicit ShmBridgePeerSegments(const std::string& peerShmDirectory) noexcept;
+
+    ShmBridgePeerSegments(const ShmBridgePeerSegments&) = delete;
+    ShmBridgePeerSegments(ShmBridgePeerSegments&&) = delete;
+    ShmBridgePeerSegments& operator=(const ShmBridgePeerSegments&) = delete;
+    ShmBridgePeerSegments& operator=(ShmBridgePeerSegments&&) = delete;
+    ~ShmBridgePeerSegments() noexcept = default;
+
+    /// @brief returns the chunk of the descriptor, the shared memory of the chunk is mapped when necessary
+    /// @return ShmBridgeError::MULTI_CHUNK_SAMPLE for the head chunk of a multi-chunk sample, it cannot be copied
+    cxx::expected<const mepoo::ChunkHeader*, ShmBridgeError>
+    resolve(const ShmBridgeTransferData& transfer, const ShmBridgeChunkDescriptor& descriptor) noexcept;
+
+    /// @brief unmaps all shared memories, e.g. when the sender was restarted
+    void clear() noexcept;
+
+  private:
+    struct PeerSegment
+    {
+        uint64_t m_size{0U};
+        cxx::optional<posix::MemoryMap> m_memoryMap;
+    };
+
+    cxx::expected<PeerSegment*, ShmBridgeError> segment(const ShmBridgeTransferData& transfer,
+                                                        const uint32_t segmentIndex) noexcept;
+
+  private:
+    std::string m_peerShmDirectory;
+    std::vector<PeerSegment> m_segments;
+};
+
+} // namespace gw
+} // namespace iox
+
+#endif // IOX_POSH_GW_SHM_BRIDGE_TRANSFER_HPP
@@ -19,6 +19,7 @@
 #define IOX_POSH_GW_TOML_FILE_CONFIG_PARSER_HPP
 
 #include "iceoryx_hoofs/cxx/expected.hpp"
+#include "iceoryx_hoofs/cxx/optional.hpp"
 #include "iceoryx_posh/gateway/gateway_config.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 
@@ -38,7 +39,8 @@ enum TomlGatewayConfigParseError
     INCOMPLETE_SERVICE_DESCRIPTION,
     INVALID_SERVICE_DESCRIPTION,
     EXCEPTION_IN_PARSER,
-    MAXIMUM_NUMBER_OF_ENTRIES_EXCEEDED
+    MAXIMUM_NUMBER_OF_ENTRIES_EXCEEDED,
+    INVALID_CODEC
 };
 
 constexpr const char* TOML_GATEWAY_CONFIG_FILE_PARSE_ERROR_STRINGS[] = {"FILE_NOT_FOUND",
@@ -46,7 +48,8 @@ constexpr const char* TOML_GATEWAY_CONFIG_FILE_PARSE_ERROR_STRINGS[] = {"FILE_NO
                                                                         "INCOMPLETE_SERVICE_DESCRIPTION",
                                                                         "INVALID_SERVICE_DESCRIPTION",
                                                                         "EXCEPTION_IN_PARSER",
-                                                                        "MAXIMUM_NUMBER_OF_ENTRIES_EXCEEDED"};
+                                                                        "MAXIMUM_NUMBER_OF_ENTRIES_EXCEEDED",
+                                                                        "INVALID_CODEC"};
 
 static constexpr const char REGEX_VALID_CHARACTERS[] = "^[a-zA-Z_][a-zA-Z0-9_]*$";
 
@@ -55,6 +58,8 @@ static constexpr const char GATEWAY_CONFIG_SERVICE_TABLE_NAME[] = "services";
 static constexpr const char GATEWAY_CONFIG_SERVICE_NAME[] = "service";
 static constexpr const char GATEWAY_CONFIG_SERVICE_INSTANCE_NAME[] = "instance";
 static constexpr const char GATEWAY_CONFIG_SERVICE_EVENT_NAME[] = "event";
+static constexpr const char GATEWAY_CONFIG_SERVICE_CODEC_NAME[] = "codec";
+static constexpr const char GATEWAY_CONFIG_SERVICE_CODEC_MAX_PAYLOAD_SIZE_NAME[] = "codec-max-payload-size";
 
 ///
 /// @brief The TomlGatewayConfigParser class provides methods for parsing gateway configs from toml text files.
@@ -70,6 +75,8 @@ class TomlGatewayConfigParser
 
   private:
     static bool hasInvalidCharacter(const std::string& s) noexcept;
+    static cxx::optional<gw::CodecType> toCodecType(const std::string& s) noexcept;
+    static bool isValidCodecMaxPayloadSize(const int64_t size) noexcept;
 };
 
 } // namespace config
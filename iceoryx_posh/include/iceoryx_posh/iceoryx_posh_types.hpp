@@ -28,6 +28,7 @@
 #include "iceoryx_posh/iceoryx_posh_deployment.hpp"
 
 #include <cstdint>
+#include <limits>
 
 namespace iox
 {
@@ -65,6 +66,8 @@ constexpr uint32_t MAX_SUBSCRIBERS = build::IOX_MAX_SUBSCRIBERS;
 constexpr uint32_t MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY =
     build::IOX_MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY;
 constexpr uint32_t MAX_SUBSCRIBER_QUEUE_CAPACITY = MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY;
+/// The window of the latest chunks of a subscriber can keep as many chunks as a user is allowed to hold
+constexpr uint32_t MAX_SUBSCRIBER_WINDOW_SIZE = MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY;
 // Introspection is using the following publisherPorts, which reduced the number of ports available for the user
 // 1x publisherPort mempool introspection
 // 1x publisherPort process introspection
@@ -86,8 +89,11 @@ constexpr uint32_t MAX_GATEWAY_SERVICES = 2 * MAX_CHANNEL_NUMBER;
 // Client
 constexpr uint32_t MAX_CLIENTS = build::IOX_MAX_SUBSCRIBERS; /// @todo
 constexpr uint32_t MAX_REQUESTS_ALLOCATED_SIMULTANEOUSLY = 4U;
-constexpr uint32_t MAX_RESPONSES_PROCESSED_SIMULTANEOUSLY = 16U;
-constexpr uint32_t MAX_RESPONSE_QUEUE_CAPACITY = 16U;
+constexpr uint32_t MAX_RESPONSES_PROCESSED_SIMULTANEOUSLY = build::IOX_MAX_RESPONSES_PROCESSED_SIMULTANEOUSLY;
+constexpr uint32_t MAX_RESPONSE_QUEUE_CAPACITY = build::IOX_MAX_RESPONSE_QUEUE_CAPACITY;
+/// @brief capacity of the in-flight table of the AsyncClient; ClientOptions::maxOutstandingRequests limits the number
+/// of outstanding requests at runtime
+constexpr uint32_t MAX_OUTSTANDING_REQUESTS_PER_CLIENT = build::IOX_MAX_OUTSTANDING_REQUESTS_PER_CLIENT;
 // Server
 constexpr uint32_t MAX_SERVERS = build::IOX_MAX_PUBLISHERS; /// @todo
 constexpr uint32_t MAX_CLIENTS_PER_SERVER = 256U;
@@ -111,6 +117,14 @@ constexpr uint32_t MAX_NUMBER_OF_EVENTS_PER_LISTENER = MAX_NUMBER_OF_NOTIFIERS;
 // Memory
 constexpr uint32_t MAX_NUMBER_OF_MEMPOOLS = 32U;
 constexpr uint32_t MAX_SHM_SEGMENTS = 100U;
+/// @brief maximum number of mempool extents which can be added to a segment at runtime
+constexpr uint32_t MAX_NUMBER_OF_MEMPOOL_EXTENTS = 16U;
+/// @brief maximum number of publishers of a segment which can have a chunk quota at the same time
+constexpr uint32_t MAX_NUMBER_OF_CHUNK_QUOTAS = 64U;
+/// @brief number of NUMA nodes which can be used for the placement of segments and mempools
+constexpr uint32_t MAX_NUMBER_OF_NUMA_NODES = 8U;
+/// @brief the memory is not placed on a specific NUMA node
+constexpr uint32_t NO_NUMA_NODE = std::numeric_limits<uint32_t>::max();
 
 constexpr uint32_t MAX_NUMBER_OF_MEMORY_PROVIDER = 8U;
 constexpr uint32_t MAX_NUMBER_OF_MEMORY_BLOCKS_PER_MEMORY_PROVIDER = 64U;
@@ -28,6 +28,7 @@ template <typename IceoryxTerminal>
 using IceoryxTerminalPool = cxx::ObjectPool<IceoryxTerminal, MAX_CHANNEL_NUMBER>;
 template <typename ExternalTerminal>
 using ExternalTerminalPool = cxx::ObjectPool<ExternalTerminal, MAX_CHANNEL_NUMBER>;
+using ChannelCodecPool = cxx::ObjectPool<ChannelCodec, MAX_CHANNEL_NUMBER>;
 
 // Statics
 template <typename IceoryxTerminal, typename ExternalTerminal>
@@ -36,15 +37,19 @@ IceoryxTerminalPool<IceoryxTerminal>
 template <typename IceoryxTerminal, typename ExternalTerminal>
 ExternalTerminalPool<ExternalTerminal>
     Channel<IceoryxTerminal, ExternalTerminal>::s_externalTerminals = ExternalTerminalPool();
+template <typename IceoryxTerminal, typename ExternalTerminal>
+ChannelCodecPool Channel<IceoryxTerminal, ExternalTerminal>::s_codecs = ChannelCodecPool();
 
 template <typename IceoryxTerminal, typename ExternalTerminal>
 inline constexpr Channel<IceoryxTerminal, ExternalTerminal>::Channel(
     const capro::ServiceDescription& service,
     const IceoryxTerminalPtr iceoryxTerminal,
-    const ExternalTerminalPtr externalTerminal) noexcept
+    const ExternalTerminalPtr externalTerminal,
+    const ChannelCodecPtr codec) noexcept
     : m_service(service)
     , m_iceoryxTerminal(iceoryxTerminal)
     , m_externalTerminal(externalTerminal)
+    , m_codec(codec)
 {
 }
 
@@ -59,7 +64,9 @@ template <typename IceoryxTerminal, typename ExternalTerminal>
 template <typename IceoryxPubSubOptions>
 inline cxx::expected<Channel<IceoryxTerminal, ExternalTerminal>, ChannelError>
 Channel<IceoryxTerminal, ExternalTerminal>::create(const capro::ServiceDescription& service,
-                                                   const IceoryxPubSubOptions& options) noexcept
+                                                   const IceoryxPubSubOptions& options,
+                                                   const CodecType codec,
+                                                   const uint32_t codecMaxPayloadSize) noexcept
 {
     // Create objects in the pool.
     auto rawIceoryxTerminalPtr = s_iceoryxTerminals.create(std::forward<const capro::ServiceDescription&>(service),
@@ -81,7 +88,18 @@ Channel<IceoryxTerminal, ExternalTerminal>::create(const capro::ServiceDescripti
     auto externalTerminalPtr =
         ExternalTerminalPtr(rawExternalTerminalPtr, [](ExternalTerminal* const p) { s_externalTerminals.free(p); });
 
-    return cxx::success<Channel>(Channel(service, iceoryxTerminalPtr, externalTerminalPtr));
+    ChannelCodecPtr codecPtr;
+    if (codec != CodecType::NONE)
+    {
+        auto rawCodecPtr = s_codecs.create(codec, codecMaxPayloadSize);
+        if (rawCodecPtr == nullptr)
+        {
+            return cxx::error<ChannelError>(ChannelError::OBJECT_POOL_FULL);
+        }
+        codecPtr = ChannelCodecPtr(rawCodecPtr, [](ChannelCodec* const p) { s_codecs.free(p); });
+    }
+
+    return cxx::success<Channel>(Channel(service, iceoryxTerminalPtr, externalTerminalPtr, codecPtr));
 }
 
 template <typename IceoryxTerminal, typename ExternalTerminal>
@@ -103,6 +121,12 @@ Channel<IceoryxTerminal, ExternalTerminal>::getExternalTerminal() const noexcept
     return m_externalTerminal;
 }
 
+template <typename IceoryxTerminal, typename ExternalTerminal>
+inline std::shared_ptr<ChannelCodec> Channel<IceoryxTerminal, ExternalTerminal>::getCodec() const noexcept
+{
+    return m_codec;
+}
+
 } // namespace gw
 } // namespace iox
 
@@ -21,6 +21,7 @@
 #include "iceoryx_dust/cxx/file_reader.hpp"
 #include "iceoryx_posh/gateway/gateway_generic.hpp"
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
 
 // ================================================== Public ================================================== //
 
@@ -76,7 +77,9 @@ template <typename channel_t, typename gateway_t>
 template <typename IceoryxPubSubOptions>
 inline cxx::expected<channel_t, GatewayError>
 GatewayGeneric<channel_t, gateway_t>::addChannel(const capro::ServiceDescription& service,
-                                                 const IceoryxPubSubOptions& options) noexcept
+                                                 const IceoryxPubSubOptions& options,
+                                                 const CodecType codec,
+                                                 const uint32_t codecMaxPayloadSize) noexcept
 {
     // Filter out wildcard services
     if (service.getServiceIDString() == capro::IdString_t(cxx::TruncateToCapacity, "*")
@@ -99,7 +102,9 @@ GatewayGeneric<channel_t, gateway_t>::addChannel(const capro::ServiceDescription
                                          service.getEventIDString(),
                                          {0U, 0U, 0U, 0U},
                                          this->getInterface()},
-                                        options);
+                                        options,
+                                        codec,
+                                        codecMaxPayloadSize);
         if (result.has_error())
         {
             return cxx::error<GatewayError>(GatewayError::UNSUCCESSFUL_CHANNEL_CREATION);
@@ -161,6 +166,66 @@ GatewayGeneric<channel_t, gateway_t>::discardChannel(const capro::ServiceDescrip
     }
 }
 
+template <typename channel_t, typename gateway_t>
+inline void GatewayGeneric<channel_t, gateway_t>::enableCodecIntrospection() noexcept
+{
+    if (m_codecIntrospectionPublisher.has_value())
+    {
+        return;
+    }
+    popo::PublisherOptions options;
+    options.historyCapacity = 1U;
+    m_codecIntrospectionPublisher.emplace(
+        capro::ServiceDescription(roudi::INTROSPECTION_SERVICE_ID,
+                                  capro::IdString_t(cxx::TruncateToCapacity,
+                                                    runtime::PoshRuntime::getInstance().getInstanceName()),
+                                  roudi::INTROSPECTION_GATEWAY_CODEC_EVENT_ID),
+        options);
+}
+
+template <typename channel_t, typename gateway_t>
+inline void GatewayGeneric<channel_t, gateway_t>::publishCodecIntrospection() noexcept
+{
+    if (!m_codecIntrospectionPublisher.has_value())
+    {
+        return;
+    }
+    forEachChannel([this](channel_t& channel) {
+        auto codec = channel.getCodec();
+        if (!codec)
+        {
+            return;
+        }
+        const auto service = channel.getServiceDescription();
+        const auto statistics = codec->statistics();
+        m_codecIntrospectionPublisher->loan()
+            .and_then([&](auto& sample) {
+                sample->m_caproServiceID = service.getServiceIDString();
+                sample->m_caproInstanceID = service.getInstanceIDString();
+                sample->m_caproEventMethodID = service.getEventIDString();
+                sample->m_codec = cxx::string<roudi::MAX_CODEC_NAME_LENGTH>(cxx::TruncateToCapacity,
+                                                                            asStringLiteral(codec->codec()));
+                sample->m_encodedFrames = statistics.m_encodedFrames;
+                sample->m_keyFrames = statistics.m_keyFrames;
+                sample->m_decodedFrames = statistics.m_decodedFrames;
+                sample->m_codecErrors = statistics.m_codecErrors;
+                sample->m_rawBytes = statistics.m_rawBytes;
+                sample->m_encodedBytes = statistics.m_encodedBytes;
+                sample->m_compressionRatio = statistics.compressionRatio();
+                sample->m_encodeTimeInNanoseconds = statistics.m_encodeTimeInNanoseconds;
+                sample->m_decodeTimeInNanoseconds = statistics.m_decodeTimeInNanoseconds;
+                sample.publish();
+            })
+            .or_else([](auto& error) { LogWarn() << "Could not publish the codec introspection: " << error; });
+    });
+}
+
+template <typename channel_t, typename gateway_t>
+inline void GatewayGeneric<channel_t, gateway_t>::waitForData(const units::Duration& timeout) noexcept
+{
+    std::this_thread::sleep_for(std::chrono::nanoseconds(timeout.toNanoseconds()));
+}
+
 // ================================================== Private ================================================== //
 
 template <typename channel_t, typename gateway_t>
@@ -174,6 +239,7 @@ inline void GatewayGeneric<channel_t, gateway_t>::discoveryLoop() noexcept
         {
             discover(msg);
         }
+        publishCodecIntrospection();
         std::this_thread::sleep_until(startTime + std::chrono::milliseconds(m_discoveryPeriod.toMilliseconds()));
     }
 }
@@ -183,9 +249,13 @@ inline void GatewayGeneric<channel_t, gateway_t>::forwardingLoop() noexcept
 {
     while (m_isRunning.load(std::memory_order_relaxed))
     {
-        auto startTime = std::chrono::steady_clock::now();
+        auto endTime = std::chrono::steady_clock::now() + std::chrono::nanoseconds(m_forwardingPeriod.toNanoseconds());
         forEachChannel([this](channel_t channel) { this->forward(channel); });
-        std::this_thread::sleep_until(startTime + std::chrono::milliseconds(m_forwardingPeriod.toMilliseconds()));
+        auto now = std::chrono::steady_clock::now();
+        if (now < endTime)
+        {
+            waitForData(units::Duration(std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - now)));
+        }
     };
 }
 
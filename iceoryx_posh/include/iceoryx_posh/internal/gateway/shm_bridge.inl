@@ -0,0 +1,588 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_GW_SHM_BRIDGE_INL
+#define IOX_POSH_GW_SHM_BRIDGE_INL
+
+#include "iceoryx_posh/internal/log/posh_logging.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/roudi/introspection_types.hpp"
+
+#include "iceoryx_posh/gateway/shm_bridge.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+namespace iox
+{
+namespace gw
+{
+inline ShmBridgeLane::ShmBridgeLane(const capro::IdString_t&,
+                                    const capro::IdString_t&,
+                                    const capro::IdString_t&) noexcept
+{
+}
+
+// ================================================ ShmBridgeSender ================================================ //
+
+template <typename channel_t, typename gateway_t>
+inline ShmBridgeSender<channel_t, gateway_t>::ShmBridgeSender(ShmBridgeTransfer&& transfer) noexcept
+    : gateway_t(capro::Interfaces::SHM_BRIDGE, SHM_BRIDGE_DISCOVERY_PERIOD, SHM_BRIDGE_FORWARDING_PERIOD)
+    , m_transfer(std::move(transfer))
+{
+}
+
+template <typename channel_t, typename gateway_t>
+inline ShmBridgeSender<channel_t, gateway_t>::~ShmBridgeSender() noexcept
+{
+    // the threads call into this class and must be stopped before its members are destroyed
+    this->shutdown();
+    std::vector<channel_t> channels;
+    this->forEachChannel([&](channel_t& channel) { channels.push_back(channel); });
+    for (const auto& channel : channels)
+    {
+        IOX_DISCARD_RESULT(this->discardChannel(channel.getServiceDescription()));
+        closeChannel(channel);
+    }
+}
+
+template <typename channel_t, typename gateway_t>
+inline void ShmBridgeSender<channel_t, gateway_t>::loadConfiguration(const config::GatewayConfig& config) noexcept
+{
+    LogDebug() << "[ShmBridgeSender] Configuring gateway...";
+    for (const auto& service : config.m_configuredServices)
+    {
+        if (!this->findChannel(service.m_serviceDescription).has_value())
+        {
+            IOX_DISCARD_RESULT(setupChannel(service.m_serviceDescription));
+        }
+    }
+}
+
+template <typename channel_t, typename gateway_t>
+inline void ShmBridgeSender<channel_t, gateway_t>::discover(const capro::CaproMessage& msg) noexcept
+{
+    LogDebug() << "[ShmBridgeSender] <CaproMessage> " << msg.m_type
+               << " { Service: " << msg.m_serviceDescription.getServiceIDString()
+               << ", Instance: " << msg.m_serviceDescription.getInstanceIDString()
+               << ", Event: " << msg.m_serviceDescription.getEventIDString() << " }";
+
+    if (msg.m_serviceDescription.getServiceIDString() == capro::IdString_t(roudi::INTROSPECTION_SERVICE_ID))
+    {
+        return;
+    }
+    if (msg.m_serviceType != capro::CaproServiceType::PUBLISHER)
+    {
+        return;
+    }
+
+    switch (msg.m_type)
+    {
+    case capro::CaproMessageType::OFFER:
+    {
+        if (!this->findChannel(msg.m_serviceDescription).has_value())
+        {
+            IOX_DISCARD_RESULT(setupChannel(msg.m_serviceDescription));
+        }
+        break;
+    }
+    case capro::CaproMessageType::STOP_OFFER:
+    {
+        auto channel = this->findChannel(msg.m_serviceDescription);
+        if (channel.has_value())
+        {
+            // after the channel is discarded the forwarding thread does not access it anymore
+            IOX_DISCARD_RESULT(this->discardChannel(msg.m_serviceDescription));
+            closeChannel(channel.value());
+        }
+        break;
+    }
+    default:
+    {
+        break;
+    }
+    }
+}
+
+template <typename channel_t, typename gateway_t>
+inline void ShmBridgeSender<channel_t, gateway_t>::forward(const channel_t& channel) noexcept
+{
+    auto subscriber = channel.getIceoryxTerminal();
+    auto lane = channel.getExternalTerminal();
+    auto& laneData = m_transfer.data().m_lanes[lane->m_laneIndex];
+
+    releaseChunks(channel, laneData.m_readIndex.load(std::memory_order_acquire));
+
+    const uint64_t startIndex = laneData.m_writeIndex.load(std::memory_order_relaxed);
+    uint64_t writeIndex = startIndex;
+    // the held chunks and the unread descriptors share the ring, a slot is reused when its chunk was released
+    while (writeIndex - lane->m_releasedIndex < ShmBridgeLaneData::CAPACITY)
+    {
+        auto takeResult = subscriber->take();
+        if (takeResult.has_error())
+        {
+            break;
+        }
+        const void* userPayload = takeResult.value();
+        auto descriptor = describeChunk(mepoo::ChunkHeader::fromUserPayload(userPayload));
+        if (descriptor.has_error())
+        {
+            LogWarn() << "[ShmBridgeSender] Dropping a chunk: " << asStringLiteral(descriptor.get_error());
+            subscriber->release(userPayload);
+            continue;
+        }
+        laneData.m_descriptors[writeIndex % ShmBridgeLaneData::CAPACITY] = descriptor.value();
+        lane->m_heldChunks[writeIndex % ShmBridgeLaneData::CAPACITY] = userPayload;
+        ++writeIndex;
+    }
+
+    if (writeIndex != startIndex)
+    {
+        laneData.m_writeIndex.store(writeIndex, std::memory_order_release);
+        m_hasPendingBatch = true;
+    }
+}
+
+template <typename channel_t, typename gateway_t>
+inline void ShmBridgeSender<channel_t, gateway_t>::waitForData(const units::Duration& timeout) noexcept
+{
+    auto& transfer = m_transfer.data();
+    // one notification for all lanes which were written in this forwarding cycle
+    if (m_hasPendingBatch)
+    {
+        m_hasPendingBatch = false;
+        IOX_DISCARD_RESULT(transfer.m_dataAvailable.post());
+    }
+
+    IOX_DISCARD_RESULT(transfer.m_senderWakeUp.timedWait(timeout));
+    while (transfer.m_senderWakeUp.tryWait().value_or(false))
+    {
+    }
+}
+
+template <typename channel_t, typename gateway_t>
+inline cxx::optional<runtime::SharedMemoryUser::SharedMemoryLocation>
+ShmBridgeSender<channel_t, gateway_t>::findSharedMemory(const mepoo::ChunkHeader* const chunkHeader) noexcept
+{
+    return runtime::SharedMemoryUser::findSharedMemory(chunkHeader);
+}
+
+// ---------------------------------------------------- Private ---------------------------------------------------- //
+
+template <typename channel_t, typename gateway_t>
+inline cxx::expected<channel_t, GatewayError>
+ShmBridgeSender<channel_t, gateway_t>::setupChannel(const capro::ServiceDescription& service) noexcept
+{
+    LogDebug() << "[ShmBridgeSender] Setting up channel for service: {" << service.getServiceIDString() << ", "
+               << service.getInstanceIDString() << ", " << service.getEventIDString() << "}";
+
+    auto laneIndex = m_transfer.openLane(service);
+    if (laneIndex.has_error())
+    {
+        LogError() << "[ShmBridgeSender] Unable to bridge the service: " << asStringLiteral(laneIndex.get_error());
+        return cxx::error<GatewayError>(GatewayError::UNSUCCESSFUL_CHANNEL_CREATION);
+    }
+
+    popo::SubscriberOptions options;
+    options.queueCapacity = SHM_BRIDGE_SUBSCRIBER_QUEUE_CAPACITY;
+    auto channel = this->addChannel(service, options);
+    if (channel.has_error())
+    {
+        m_transfer.closeLane(laneIndex.value());
+        return channel;
+    }
+
+    auto& laneData = m_transfer.data().m_lanes[laneIndex.value()];
+    auto lane = channel->getExternalTerminal();
+    lane->m_laneIndex = laneIndex.value();
+    lane->m_activation = laneData.m_activation.load(std::memory_order_relaxed);
+    lane->m_releasedIndex = laneData.m_writeIndex.load(std::memory_order_relaxed);
+
+    auto subscriber = channel->getIceoryxTerminal();
+    subscriber->subscribe();
+    // without a notification the subscriber is polled with every forwarding period
+    m_listener
+        .attachEvent(*subscriber,
+                     popo::SubscriberEvent::DATA_RECEIVED,
+                     popo::createNotificationCallback(onDataReceived, m_transfer.data()))
+        .or_else([](auto) {
+            LogWarn() << "[ShmBridgeSender] Unable to attach the subscriber to the listener, it will be polled";
+        });
+
+    // the receiver creates its publisher when it is woken up
+    IOX_DISCARD_RESULT(m_transfer.data().m_dataAvailable.post());
+    return channel;
+}
+
+template <typename channel_t, typename gateway_t>
+inline void ShmBridgeSender<channel_t, gateway_t>::closeChannel(const channel_t& channel) noexcept
+{
+    auto subscriber = channel.getIceoryxTerminal();
+    auto lane = channel.getExternalTerminal();
+    auto& transfer = m_transfer.data();
+    auto& laneData = transfer.m_lanes[lane->m_laneIndex];
+
+    m_listener.detachEvent(*subscriber, popo::SubscriberEvent::DATA_RECEIVED);
+    m_transfer.closeLane(lane->m_laneIndex);
+    IOX_DISCARD_RESULT(transfer.m_dataAvailable.post());
+
+    // the receiver might still copy one of the chunks, it drops the remaining descriptors when it sees the closed
+    // lane; a receiver which does not respond in time is not waited for
+    const uint64_t writeIndex = laneData.m_writeIndex.load(std::memory_order_relaxed);
+    const auto deadline = std::chrono::steady_clock::now()
+                          + std::chrono::nanoseconds(SHM_BRIDGE_CLOSE_TIMEOUT.toNanoseconds());
+    while (laneData.m_readIndex.load(std::memory_order_acquire) < writeIndex
+           && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    releaseChunks(channel, writeIndex);
+    subscriber->unsubscribe();
+}
+
+template <typename channel_t, typename gateway_t>
+inline void ShmBridgeSender<channel_t, gateway_t>::releaseChunks(const channel_t& channel,
+                                                                 const uint64_t untilIndex) noexcept
+{
+    auto subscriber = channel.getIceoryxTerminal();
+    auto lane = channel.getExternalTerminal();
+    for (; lane->m_releasedIndex < untilIndex; ++lane->m_releasedIndex)
+    {
+        subscriber->release(lane->m_heldChunks[lane->m_releasedIndex % ShmBridgeLaneData::CAPACITY]);
+    }
+}
+
+template <typename channel_t, typename gateway_t>
+inline cxx::expected<ShmBridgeChunkDescriptor, ShmBridgeError>
+ShmBridgeSender<channel_t, gateway_t>::describeChunk(const mepoo::ChunkHeader* const chunkHeader) noexcept
+{
+    if (chunkHeader->isMultiChunk())
+    {
+        return cxx::error<ShmBridgeError>(ShmBridgeError::MULTI_CHUNK_SAMPLE);
+    }
+
+    const auto address = reinterpret_cast<const uint8_t*>(chunkHeader);
+    auto toDescriptor = [&](const SegmentCacheEntry& entry) {
+        ShmBridgeChunkDescriptor descriptor;
+        descriptor.m_segmentIndex = entry.m_segmentIndex;
+        descriptor.m_chunkOffset = static_cast<uint64_t>(address - entry.m_baseAddress);
+        return cxx::success<ShmBridgeChunkDescriptor>(descriptor);
+    };
+
+    for (const auto& entry : m_segmentCache)
+    {
+        if (address >= entry.m_baseAddress && address < entry.m_baseAddress + entry.m_size)
+        {
+            return toDescriptor(entry);
+        }
+    }
+
+    auto location = findSharedMemory(chunkHeader);
+    if (!location.has_value())
+    {
+        return cxx::error<ShmBridgeError>(ShmBridgeError::INVALID_CHUNK);
+    }
+    auto segmentIndex = m_transfer.segmentIndex(location->m_sharedMemoryName);
+    if (segmentIndex.has_error())
+    {
+        return cxx::error<ShmBridgeError>(segmentIndex.get_error());
+    }
+
+    SegmentCacheEntry entry;
+    entry.m_baseAddress = static_cast<const uint8_t*>(location->m_baseAddress);
+    entry.m_size = location->m_size;
+    entry.m_segmentIndex = segmentIndex.value();
+    m_segmentCache.push_back(entry);
+    return toDescriptor(entry);
+}
+
+template <typename channel_t, typename gateway_t>
+inline void ShmBridgeSender<channel_t, gateway_t>::onDataReceived(popo::UntypedSubscriber* const,
+                                                                 ShmBridgeTransferData* const transfer)
+{
+    IOX_DISCARD_RESULT(transfer->m_senderWakeUp.post());
+}
+
+// =============================================== ShmBridgeReceiver =============================================== //
+
+template <typename channel_t, typename gateway_t>
+inline ShmBridgeReceiver<channel_t, gateway_t>::ShmBridgeReceiver(const std::string& transferSegmentPath,
+                                                                  const std::string& peerShmDirectory) noexcept
+    : gateway_t(capro::Interfaces::SHM_BRIDGE, SHM_BRIDGE_DISCOVERY_PERIOD, SHM_BRIDGE_FORWARDING_PERIOD)
+    , m_transferSegmentPath(transferSegmentPath)
+    , m_peerSegments(peerShmDirectory)
+    , m_lanes(ShmBridgeTransferData::MAX_LANES)
+{
+}
+
+template <typename channel_t, typename gateway_t>
+inline ShmBridgeReceiver<channel_t, gateway_t>::~ShmBridgeReceiver() noexcept
+{
+    // the threads call into this class and must be stopped before its members are destroyed
+    this->shutdown();
+}
+
+template <typename channel_t, typename gateway_t>
+inline void ShmBridgeReceiver<channel_t, gateway_t>::loadConfiguration(const config::GatewayConfig&) noexcept
+{
+}
+
+template <typename channel_t, typename gateway_t>
+inline void ShmBridgeReceiver<channel_t, gateway_t>::discover(const capro::CaproMessage&) noexcept
+{
+}
+
+template <typename channel_t, typename gateway_t>
+inline void ShmBridgeReceiver<channel_t, gateway_t>::forward(const channel_t& channel) noexcept
+{
+    if (!m_transfer.has_value())
+    {
+        return;
+    }
+
+    auto lane = channel.getExternalTerminal();
+    auto& transfer = m_transfer->data();
+    auto& laneData = transfer.m_lanes[lane->m_laneIndex];
+    if (!laneData.m_isOpen.load(std::memory_order_acquire)
+        || laneData.m_activation.load(std::memory_order_relaxed) != lane->m_activation)
+    {
+        return;
+    }
+
+    const uint64_t readIndex = laneData.m_readIndex.load(std::memory_order_relaxed);
+    const uint64_t writeIndex = laneData.m_writeIndex.load(std::memory_order_acquire);
+    if (readIndex == writeIndex)
+    {
+        return;
+    }
+
+    auto publisher = channel.getIceoryxTerminal();
+    for (uint64_t index = readIndex; index < writeIndex; ++index)
+    {
+        m_peerSegments.resolve(transfer, laneData.m_descriptors[index % ShmBridgeLaneData::CAPACITY])
+            .and_then([&](const mepoo::ChunkHeader* peerChunk) { this->republish(*publisher, peerChunk); })
+            .or_else([](auto& error) {
+                LogWarn() << "[ShmBridgeReceiver] Dropping a chunk: " << asStringLiteral(error);
+            });
+    }
+
+    // the sender releases the chunks of the batch and reuses their slots
+    laneData.m_readIndex.store(writeIndex, std::memory_order_release);
+    IOX_DISCARD_RESULT(transfer.m_senderWakeUp.post());
+}
+
+// --------------------------------------------------- Protected --------------------------------------------------- //
+
+template <typename channel_t, typename gateway_t>
+inline void ShmBridgeReceiver<channel_t, gateway_t>::waitForData(const units::Duration& timeout) noexcept
+{
+    if (!m_transfer.has_value() && !connect())
+    {
+        std::this_thread::sleep_for(std::chrono::nanoseconds(timeout.toNanoseconds()));
+        return;
+    }
+
+    // new channels are forwarded right away, the lane might already contain data
+    if (synchronizeLanes())
+    {
+        return;
+    }
+
+    auto& transfer = m_transfer->data();
+    auto waitResult = transfer.m_dataAvailable.timedWait(timeout);
+    if (!waitResult.has_error() && waitResult.value() == posix::SemaphoreWaitState::NO_TIMEOUT)
+    {
+        while (transfer.m_dataAvailable.tryWait().value_or(false))
+        {
+        }
+    }
+    else if (m_transfer->isStale())
+    {
+        LogInfo() << "[ShmBridgeReceiver] The sender has been restarted or stopped";
+        disconnect();
+    }
+}
+
+template <typename channel_t, typename gateway_t>
+inline bool ShmBridgeReceiver<channel_t, gateway_t>::synchronizeLanes() noexcept
+{
+    if (!m_transfer.has_value())
+    {
+        return false;
+    }
+
+    auto& transfer = m_transfer->data();
+    const uint64_t laneGeneration = transfer.m_laneGeneration.load(std::memory_order_acquire);
+    if (laneGeneration == m_laneGeneration)
+    {
+        return false;
+    }
+    m_laneGeneration = laneGeneration;
+
+    // a service can move to another lane, therefore all outdated channels are discarded before new ones are created
+    for (uint32_t laneIndex = 0U; laneIndex < ShmBridgeTransferData::MAX_LANES; ++laneIndex)
+    {
+        auto& laneData = transfer.m_lanes[laneIndex];
+        auto& laneState = m_lanes[laneIndex];
+        const bool isOpen = laneData.m_isOpen.load(std::memory_order_acquire);
+        if (laneState.m_activation != 0U
+            && (!isOpen || laneData.m_activation.load(std::memory_order_relaxed) != laneState.m_activation))
+        {
+            IOX_DISCARD_RESULT(this->discardChannel(laneState.m_service));
+            laneState.m_activation = 0U;
+        }
+        if (!isOpen)
+        {
+            // the chunks of a closed lane are released by the sender, unread descriptors are dropped
+            const uint64_t writeIndex = laneData.m_writeIndex.load(std::memory_order_acquire);
+            if (laneData.m_readIndex.load(std::memory_order_relaxed) < writeIndex)
+            {
+                laneData.m_readIndex.store(writeIndex, std::memory_order_release);
+            }
+        }
+    }
+
+    for (uint32_t laneIndex = 0U; laneIndex < ShmBridgeTransferData::MAX_LANES; ++laneIndex)
+    {
+        auto& laneData = transfer.m_lanes[laneIndex];
+        auto& laneState = m_lanes[laneIndex];
+        const uint64_t activation = laneData.m_activation.load(std::memory_order_relaxed);
+        if (!laneData.m_isOpen.load(std::memory_order_acquire) || activation == laneState.m_activation)
+        {
+            continue;
+        }
+
+        const auto& service = laneData.m_service;
+        capro::ServiceDescription bridgedService(service.getServiceIDString(),
+                                                 service.getInstanceIDString(),
+                                                 service.getEventIDString(),
+                                                 service.getClassHash(),
+                                                 capro::Interfaces::SHM_BRIDGE);
+        // the sender could have closed and reused the lane while the service was copied
+        if (!laneData.m_isOpen.load(std::memory_order_acquire)
+            || laneData.m_activation.load(std::memory_order_acquire) != activation)
+        {
+            continue;
+        }
+
+        LogDebug() << "[ShmBridgeReceiver] Setting up channel for service: {"
+                   << bridgedService.getServiceIDString() << ", " << bridgedService.getInstanceIDString() << ", "
+                   << bridgedService.getEventIDString() << "}";
+        this->addChannel(bridgedService, popo::PublisherOptions())
+            .and_then([&](auto& channel) {
+                auto lane = channel.getExternalTerminal();
+                lane->m_laneIndex = laneIndex;
+                lane->m_activation = activation;
+                laneState.m_activation = activation;
+                laneState.m_service = bridgedService;
+            })
+            .or_else([&](auto) {
+                LogError() << "[ShmBridgeReceiver] Unable to set up a channel for the service: {"
+                           << bridgedService.getServiceIDString() << ", " << bridgedService.getInstanceIDString()
+                           << ", " << bridgedService.getEventIDString() << "}";
+            });
+    }
+
+    IOX_DISCARD_RESULT(transfer.m_senderWakeUp.post());
+    return true;
+}
+
+// ---------------------------------------------------- Private ---------------------------------------------------- //
+
+template <typename channel_t, typename gateway_t>
+inline bool ShmBridgeReceiver<channel_t, gateway_t>::connect() noexcept
+{
+    auto transfer = ShmBridgeTransfer::open(m_transferSegmentPath);
+    if (transfer.has_error())
+    {
+        // the sender is usually just not started yet, this is logged once
+        if (!m_isWaitingForSender || transfer.get_error() != ShmBridgeError::UNABLE_TO_OPEN_TRANSFER_SEGMENT)
+        {
+            LogWarn() << "[ShmBridgeReceiver] Waiting for the sender at \"" << m_transferSegmentPath
+                      << "\": " << asStringLiteral(transfer.get_error());
+        }
+        m_isWaitingForSender = true;
+        return false;
+    }
+
+    LogInfo() << "[ShmBridgeReceiver] Connected to the sender at \"" << m_transferSegmentPath << "\"";
+    m_isWaitingForSender = false;
+    m_transfer.emplace(std::move(transfer.value()));
+    m_laneGeneration = 0U;
+    return true;
+}
+
+template <typename channel_t, typename gateway_t>
+inline void ShmBridgeReceiver<channel_t, gateway_t>::disconnect() noexcept
+{
+    for (auto& laneState : m_lanes)
+    {
+        if (laneState.m_activation != 0U)
+        {
+            IOX_DISCARD_RESULT(this->discardChannel(laneState.m_service));
+            laneState.m_activation = 0U;
+        }
+    }
+    m_peerSegments.clear();
+    m_transfer.reset();
+}
+
+template <typename channel_t, typename gateway_t>
+inline void ShmBridgeReceiver<channel_t, gateway_t>::republish(popo::UntypedPublisher& publisher,
+                                                               const mepoo::ChunkHeader* const peerChunk) noexcept
+{
+    // this is safe, it is just used to check if the alignment doesn't exceed the alignment of the ChunkHeader but
+    // since this is data from a valid chunk, we can assume that the alignment was correct
+    constexpr uint32_t USER_HEADER_ALIGNMENT{1U};
+    publisher
+        .loan(peerChunk->userPayloadSize(),
+              peerChunk->userPayloadAlignment(),
+              peerChunk->userHeaderSize(),
+              USER_HEADER_ALIGNMENT)
+        .and_then([&](void* userPayload) {
+            auto chunkHeader = mepoo::ChunkHeader::fromUserPayload(userPayload);
+            const auto peerBegin = reinterpret_cast<const uint8_t*>(peerChunk) + sizeof(mepoo::ChunkHeader);
+            const auto begin = reinterpret_cast<uint8_t*>(chunkHeader) + sizeof(mepoo::ChunkHeader);
+            const auto peerUserPayload = static_cast<const uint8_t*>(peerChunk->userPayload());
+            // the layout behind the ChunkHeader only depends on the sizes and alignments of the user-header and
+            // user-payload; with the same layout both are copied at once
+            if (peerUserPayload - peerBegin == static_cast<uint8_t*>(userPayload) - begin)
+            {
+                std::memcpy(begin, peerBegin, static_cast<uint64_t>(peerUserPayload - peerBegin)
+                                                  + peerChunk->userPayloadSize());
+            }
+            else
+            {
+                if (peerChunk->userHeaderSize() > 0U)
+                {
+                    std::memcpy(chunkHeader->userHeader(), peerChunk->userHeader(), peerChunk->userHeaderSize());
+                }
+                std::memcpy(userPayload, peerUserPayload, peerChunk->userPayloadSize());
+            }
+            publisher.publish(userPayload);
+        })
+        .or_else([](auto& error) {
+            LogError() << "[ShmBridgeReceiver] Could not loan chunk! Error code: " << static_cast<uint64_t>(error);
+        });
+}
+
+} // namespace gw
+} // namespace iox
+
+#endif // IOX_POSH_GW_SHM_BRIDGE_INL
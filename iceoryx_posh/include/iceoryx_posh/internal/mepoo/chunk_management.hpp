@@ -19,6 +19,7 @@
 
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_hoofs/internal/relocatable_pointer/relative_pointer.hpp"
+#include "iceoryx_hoofs/internal/relocatable_pointer/relative_pointer_data.hpp"
 
 #include <atomic>
 #include <cstdint>
@@ -29,6 +30,8 @@ namespace iox
 namespace mepoo
 {
 class MemPool;
+class MemPoolAccounting;
+class MemPoolQuota;
 struct ChunkHeader;
 
 struct ChunkManagement
@@ -37,15 +40,31 @@ struct ChunkManagement
     using referenceCounterBase_t = uint64_t;
     using referenceCounter_t = std::atomic<referenceCounterBase_t>;
 
+    /// @brief value of m_owner when no port holds a reference outside of its containers
+    static constexpr uint64_t NO_OWNER{0U};
+
     ChunkManagement(const cxx::not_null<base_t*> chunkHeader,
                     const cxx::not_null<MemPool*> mempool,
-                    const cxx::not_null<MemPool*> chunkManagementPool) noexcept;
+                    const cxx::not_null<MemPool*> chunkManagementPool,
+                    MemPoolAccounting* const memPoolAccounting = nullptr,
+                    MemPoolQuota* const memPoolQuota = nullptr) noexcept;
 
     iox::rp::RelativePointer<base_t> m_chunkHeader;
     referenceCounter_t m_referenceCounter{1U};
     /// @todo optimization: check if this can be replaced by an offset relative to the this pointer
     iox::rp::RelativePointer<MemPool> m_mempool;
     iox::rp::RelativePointer<MemPool> m_chunkManagementPool;
+    /// @brief the accounting and the quota of the publisher the chunk was acquired with, the chunk is released to them
+    /// after it was returned to the mempool
+    iox::rp::RelativePointer<MemPoolAccounting> m_memPoolAccounting;
+    iox::rp::RelativePointer<MemPoolQuota> m_memPoolQuota;
+    /// @brief the unique id of the port which holds a reference to the chunk outside of its containers, e.g. while
+    /// the chunk is delivered; when the process of the port terminates in this state, RouDi releases this reference
+    std::atomic<uint64_t> m_owner{NO_OWNER};
+    /// @brief the next part of a multi-chunk sample; the parts are chained to the head chunk and released together
+    /// with it. The RelativePointerData is written with a single store to keep the chain consistent for the cleanup
+    /// by RouDi.
+    iox::rp::RelativePointerData m_nextPart;
 };
 } // namespace mepoo
 } // namespace iox
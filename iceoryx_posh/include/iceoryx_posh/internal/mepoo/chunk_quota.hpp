@@ -0,0 +1,169 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_MEPOO_CHUNK_QUOTA_HPP
+#define IOX_POSH_MEPOO_CHUNK_QUOTA_HPP
+
+#include "iceoryx_hoofs/cxx/expected.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace mepoo
+{
+/// @brief The chunks a publisher holds from a single mempool. The reserved and the used chunks are stored in one
+/// atomic to classify every chunk consistently as reserved or unreserved when it is released.
+class MemPoolQuota
+{
+  public:
+    MemPoolQuota() noexcept = default;
+    MemPoolQuota(const MemPoolQuota&) = delete;
+    MemPoolQuota(MemPoolQuota&&) = delete;
+    MemPoolQuota& operator=(const MemPoolQuota&) = delete;
+    MemPoolQuota& operator=(MemPoolQuota&&) = delete;
+    ~MemPoolQuota() noexcept = default;
+
+    /// @brief resets the quota for a new publisher
+    /// @param[in] requestedReservation number of chunks which shall be reserved when the mempool is used the first time
+    /// @param[in] maxChunks the publisher may hold at the same time, 0 means unlimited
+    void reset(const uint32_t requestedReservation, const uint32_t maxChunks) noexcept;
+
+    uint32_t getReservedChunks() const noexcept;
+    uint32_t getUsedChunks() const noexcept;
+
+  private:
+    friend class MemPoolAccounting;
+
+    static constexpr uint64_t RESERVED_CHUNKS_SHIFT{32U};
+    static constexpr uint64_t USED_CHUNKS_MASK{(uint64_t{1U} << RESERVED_CHUNKS_SHIFT) - 1U};
+
+    static uint64_t pack(const uint32_t reservedChunks, const uint32_t usedChunks) noexcept;
+    static uint32_t reservedChunks(const uint64_t state) noexcept;
+    static uint32_t usedChunks(const uint64_t state) noexcept;
+
+    std::atomic<uint64_t> m_reservedAndUsedChunks{0U};
+    uint32_t m_requestedReservation{0U};
+    uint32_t m_maxChunks{0U};
+    /// @note only accessed by the thread which acquires chunks for the publisher
+    bool m_hasReservation{false};
+};
+
+/// @brief The chunk quota of a publisher with a MemPoolQuota for every mempool of a MemoryManager. The quotas are
+/// owned by the MemoryManager since the chunks of a publisher can outlive it.
+class ChunkQuota
+{
+  public:
+    enum class State : uint32_t
+    {
+        FREE,
+        IN_USE,
+        RELEASED
+    };
+
+    ChunkQuota() noexcept = default;
+    ChunkQuota(const ChunkQuota&) = delete;
+    ChunkQuota(ChunkQuota&&) = delete;
+    ChunkQuota& operator=(const ChunkQuota&) = delete;
+    ChunkQuota& operator=(ChunkQuota&&) = delete;
+    ~ChunkQuota() noexcept = default;
+
+    /// @brief returns the quota of the mempool with the given index
+    /// @param[in] memPoolIndex must be smaller than MAX_NUMBER_OF_MEMPOOLS
+    MemPoolQuota& memPoolQuota(const uint32_t memPoolIndex) noexcept;
+    const MemPoolQuota& memPoolQuota(const uint32_t memPoolIndex) const noexcept;
+
+    /// @brief returns true if no chunk of any mempool is held with this quota
+    bool isDrained() const noexcept;
+
+    std::atomic<State> m_state{State::FREE};
+
+  private:
+    MemPoolQuota m_memPoolQuotas[MAX_NUMBER_OF_MEMPOOLS];
+};
+
+/// @brief Lock-free accounting of the chunks of a mempool and its extents. The chunks reserved by publishers are kept
+/// free for them, all other requests share the remaining chunks. A chunk is accounted before it is taken from the
+/// mempool and after it is returned to it, therefore the accounting never promises more chunks than are free.
+/// @note Requests without a quota only have to be accounted while chunks are reserved, see hasReservedChunks. The
+/// chunks which were taken without accounting are derived from the chunks in use in the mempool. Requests which race
+/// with the first reservation in a mempool can therefore take a reserved chunk.
+class MemPoolAccounting
+{
+  public:
+    enum class Error
+    {
+        CHUNK_QUOTA_EXCEEDED,
+        NO_UNRESERVED_CHUNKS
+    };
+
+    explicit MemPoolAccounting(const uint32_t capacity) noexcept;
+    MemPoolAccounting(const MemPoolAccounting&) = delete;
+    MemPoolAccounting(MemPoolAccounting&&) = delete;
+    MemPoolAccounting& operator=(const MemPoolAccounting&) = delete;
+    MemPoolAccounting& operator=(MemPoolAccounting&&) = delete;
+    ~MemPoolAccounting() noexcept = default;
+
+    /// @brief returns true if chunks are reserved; only then a request without a quota has to be accounted
+    bool hasReservedChunks() const noexcept;
+
+    /// @brief accounts a chunk before it is taken from the mempool; the reservation of the quota is made with the
+    /// first chunk
+    /// @param[in] memPoolQuota of the requesting publisher, nullptr if it has no quota
+    /// @param[in] usedChunks the number of chunks which are in use in the mempool and its extents
+    /// @return an error if the quota is exceeded or if all unreserved chunks are used
+    cxx::expected<Error> acquireChunk(MemPoolQuota* const memPoolQuota, const uint32_t usedChunks) noexcept;
+
+    /// @brief accounts a chunk after it was returned to the mempool
+    /// @param[in] memPoolQuota the chunk was acquired with, nullptr if it was acquired without one
+    void releaseChunk(MemPoolQuota* const memPoolQuota) noexcept;
+
+    /// @brief returns the reservation of a quota whose publisher is gone; chunks which are still held with the quota
+    /// are accounted as unreserved
+    void returnReservation(MemPoolQuota& memPoolQuota) noexcept;
+
+    /// @brief increases the number of chunks, e.g. when a mempool extent was added
+    void addCapacity(const uint32_t numberOfChunks) noexcept;
+
+    uint32_t getCapacity() const noexcept;
+    uint32_t getReservedChunks() const noexcept;
+    /// @brief returns the number of used chunks which are not reserved and were accounted
+    uint32_t getUnreservedUsedChunks() const noexcept;
+
+    /// @brief returns the number of chunk requests which were rejected by a quota or due to the reservations
+    uint64_t getNumberOfRejectedRequests() const noexcept;
+
+  private:
+    uint32_t reserve(const uint32_t numberOfChunks, const uint32_t usedChunks) noexcept;
+    bool acquireUnreservedChunk(const uint32_t usedChunks) noexcept;
+    /// @brief returns the number of used chunks which are not reserved, including the ones without accounting
+    uint32_t unreservedUsedChunks(const uint32_t unreservedUsedChunks, const uint32_t usedChunks) const noexcept;
+    cxx::expected<Error> reject(const Error error) noexcept;
+
+    std::atomic<uint32_t> m_capacity{0U};
+    std::atomic<uint32_t> m_reservedChunks{0U};
+    std::atomic<uint32_t> m_reservedUsedChunks{0U};
+    std::atomic<uint32_t> m_unreservedUsedChunks{0U};
+    std::atomic<uint64_t> m_rejectedRequests{0U};
+};
+
+} // namespace mepoo
+} // namespace iox
+
+#endif // IOX_POSH_MEPOO_CHUNK_QUOTA_HPP
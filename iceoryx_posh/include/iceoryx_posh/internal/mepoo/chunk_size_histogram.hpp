@@ -0,0 +1,83 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_MEPOO_CHUNK_SIZE_HISTOGRAM_HPP
+#define IOX_POSH_MEPOO_CHUNK_SIZE_HISTOGRAM_HPP
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace mepoo
+{
+/// @brief Lock-free histogram of requested sizes which can be placed in shared memory. Every power of two is split
+/// into 4 buckets, therefore the upper bound of a bucket overestimates the sizes recorded in it by at most 25%.
+/// Sizes up to MIN_BUCKET_UPPER_BOUND share the first bucket.
+/// @note The histogram is shared by all writers of a segment. To avoid an atomic read-modify-write on a shared cache
+/// line for every chunk request, every thread counts its requests per histogram and bucket locally and adds them to
+/// the histogram only at the 1st, 2nd, 4th, ... request up to SAMPLE_INTERVAL and at every SAMPLE_INTERVAL-th request
+/// beyond. The count is therefore a lower estimate, the requests of a thread which were not added yet are less than
+/// half of its local count and less than SAMPLE_INTERVAL. Whether a bucket was hit at all is always exact.
+class ChunkSizeHistogram
+{
+  public:
+    static constexpr uint64_t MIN_BUCKET_UPPER_BOUND{8U};
+    static constexpr uint64_t MAX_SIZE{uint64_t{1U} << 32U};
+    static constexpr uint32_t NUMBER_OF_BUCKETS{117U};
+    static constexpr uint64_t SAMPLE_INTERVAL{64U};
+
+    ChunkSizeHistogram() noexcept = default;
+    ChunkSizeHistogram(const ChunkSizeHistogram&) = delete;
+    ChunkSizeHistogram(ChunkSizeHistogram&&) = delete;
+    ChunkSizeHistogram& operator=(const ChunkSizeHistogram&) = delete;
+    ChunkSizeHistogram& operator=(ChunkSizeHistogram&&) = delete;
+    ~ChunkSizeHistogram() noexcept = default;
+
+    /// @brief counts the size in its bucket, see the class description for when the count becomes visible; sizes
+    /// larger than MAX_SIZE are recorded in the last bucket
+    /// @param[in] size to record
+    void record(const uint64_t size) noexcept;
+
+    /// @brief returns the number of recorded sizes in a bucket, a lower estimate when more than one size was recorded
+    /// @param[in] bucket index of the bucket, must be smaller than NUMBER_OF_BUCKETS
+    uint64_t count(const uint32_t bucket) const noexcept;
+
+    /// @brief returns the index of the bucket a size is recorded in
+    static uint32_t bucketIndex(const uint64_t size) noexcept;
+
+    /// @brief returns the largest size which is recorded in a bucket; the smallest one is the upper bound of the
+    /// previous bucket plus one
+    static uint64_t bucketUpperBound(const uint32_t bucket) noexcept;
+
+  private:
+    static constexpr uint32_t SUB_BUCKET_BITS{2U};
+    static constexpr uint32_t SUB_BUCKETS{1U << SUB_BUCKET_BITS};
+    /// @brief the first octave which is split into sub buckets, 2^3 == MIN_BUCKET_UPPER_BOUND
+    static constexpr uint32_t FIRST_OCTAVE{3U};
+
+    static uint64_t uniqueId() noexcept;
+
+    /// @brief distinguishes the histogram from a previous one at the same address for the local counts of a thread
+    const uint64_t m_uniqueId{uniqueId()};
+    std::atomic<uint64_t> m_counts[NUMBER_OF_BUCKETS]{};
+};
+
+} // namespace mepoo
+} // namespace iox
+
+#endif // IOX_POSH_MEPOO_CHUNK_SIZE_HISTOGRAM_HPP
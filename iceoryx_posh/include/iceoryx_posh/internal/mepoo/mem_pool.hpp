@@ -36,12 +36,14 @@ struct MemPoolInfo
     MemPoolInfo(const uint32_t usedChunks,
                 const uint32_t minFreeChunks,
                 const uint32_t numChunks,
-                const uint32_t chunkSize) noexcept;
+                const uint32_t chunkSize,
+                const uint64_t allocationFailures) noexcept;
 
     uint32_t m_usedChunks{0};
     uint32_t m_minFreeChunks{0};
     uint32_t m_numChunks{0};
     uint32_t m_chunkSize{0};
+    uint64_t m_allocationFailures{0};
 };
 
 class MemPool
@@ -61,11 +63,20 @@ class MemPool
     MemPool& operator=(MemPool&&) = delete;
 
     void* getChunk() noexcept;
+    /// @brief same as getChunk but without printing an error when the mempool is exhausted; used when the request
+    /// can be served by a mempool extent
+    void* tryGetChunk() noexcept;
     uint32_t getChunkSize() const noexcept;
     uint32_t getChunkCount() const noexcept;
     uint32_t getUsedChunks() const noexcept;
     uint32_t getMinFree() const noexcept;
+    /// @brief returns the number of getChunk calls which failed since the mempool had no free chunk left
+    uint64_t getAllocationFailures() const noexcept;
     MemPoolInfo getInfo() const noexcept;
+    /// @brief returns the start of the memory of the chunks, e.g. to place it on a NUMA node
+    void* getChunkMemory() const noexcept;
+    /// @brief returns the size of the memory of the chunks
+    uint64_t getChunkMemorySize() const noexcept;
 
     void freeChunk(const void* chunk) noexcept;
 
@@ -84,6 +95,7 @@ class MemPool
     std::atomic<uint32_t> m_usedChunks{0U};
     std::atomic<uint32_t> m_minFree{0U};
     /// @todo: end
+    std::atomic<uint64_t> m_allocationFailures{0U};
 
     freeList_t m_freeIndices;
 };
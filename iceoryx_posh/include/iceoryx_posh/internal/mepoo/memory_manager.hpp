@@ -17,13 +17,17 @@
 #ifndef IOX_POSH_MEPOO_MEMORY_MANAGER_HPP
 #define IOX_POSH_MEPOO_MEMORY_MANAGER_HPP
 
+#include "iceoryx_hoofs/cxx/function_ref.hpp"
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/chunk_quota.hpp"
+#include "iceoryx_posh/internal/mepoo/chunk_size_histogram.hpp"
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/mepoo/chunk_settings.hpp"
 
+#include <atomic>
 #include <cstdint>
 #include <limits>
 
@@ -51,6 +55,7 @@ class MemoryManager
         NO_MEMPOOLS_AVAILABLE,
         NO_MEMPOOL_FOR_REQUESTED_CHUNK_SIZE,
         MEMPOOL_OUT_OF_CHUNKS,
+        CHUNK_QUOTA_EXCEEDED,
     };
 
     MemoryManager() noexcept = default;
@@ -64,28 +69,143 @@ class MemoryManager
                                 posix::Allocator& managementAllocator,
                                 posix::Allocator& chunkMemoryAllocator) noexcept;
 
-    /// @brief Obtains a chunk from the mempools
+    /// @brief Obtains a chunk from the mempools; when the fitting mempool is exhausted the chunk is taken from one of
+    /// its mempool extents. When there are fitting mempools on multiple NUMA nodes, the one on the node of the caller
+    /// is preferred and the others are used when it is exhausted.
     /// @param[in] chunkSettings for the requested chunk
+    /// @param[in] chunkQuota of the requesting publisher, nullptr if the chunk is taken from the unreserved chunks
     /// @return a SharedChunk if successful, otherwise a MemoryManager::Error
-    cxx::expected<SharedChunk, Error> getChunk(const ChunkSettings& chunkSettings) noexcept;
+    cxx::expected<SharedChunk, Error> getChunk(const ChunkSettings& chunkSettings,
+                                               ChunkQuota* const chunkQuota = nullptr) noexcept;
+
+    /// @brief acquires a chunk quota for a publisher; the reservation in a mempool is made when the publisher
+    /// requests its first chunk from it
+    /// @param[in] reservedChunksPerMemPool number of chunks which are kept free for the publisher in every mempool it
+    /// uses
+    /// @param[in] maxChunksPerMemPool number of chunks the publisher may hold from a mempool, 0 means unlimited
+    /// @return the quota or nullptr if all quotas are in use
+    ChunkQuota* acquireChunkQuota(const uint32_t reservedChunksPerMemPool, const uint32_t maxChunksPerMemPool) noexcept;
+
+    /// @brief releases the chunk quota of a publisher which is gone; its reservations are returned immediately, the
+    /// quota is reused when all chunks which were acquired with it are released
+    void releaseChunkQuota(ChunkQuota* const chunkQuota) noexcept;
+
+    /// @brief returns the number of chunks of the mempool with the given index which are reserved by publishers
+    uint32_t getNumberOfReservedChunks(const uint32_t memPoolIndex) const noexcept;
+
+    /// @brief returns the number of chunk requests for the mempool with the given index which were rejected due to a
+    /// chunk quota or the reservations of other publishers
+    uint64_t getNumberOfRejectedChunkRequests(const uint32_t memPoolIndex) const noexcept;
 
     uint32_t getNumberOfMemPools() const noexcept;
 
     MemPoolInfo getMemPoolInfo(const uint32_t index) const noexcept;
 
+    /// @brief returns the NUMA node of the mempool with the given index or NO_NUMA_NODE when it has none
+    uint32_t getMemPoolNumaNode(const uint32_t index) const noexcept;
+
+    /// @brief samples the pages of the mempool with the given index and its extents and counts how many of them are
+    /// located on every NUMA node
+    /// @param[in] index of the mempool
+    /// @param[out] pagesPerNode the number of sampled pages per node
+    void sampleMemPoolNumaDistribution(const uint32_t index,
+                                       uint32_t (&pagesPerNode)[MAX_NUMBER_OF_NUMA_NODES]) const noexcept;
+
+    /// @brief adds a mempool extent with the configured extent chunk count to the mempool with the given index
+    /// @param[in] memPoolIndex index of the mempool to extend, the mempool must have an extent chunk count
+    /// @param[in] managementAllocator for the free lists and the chunk management of the extent
+    /// @param[in] chunkMemoryAllocator for the chunks of the extent
+    /// @note must only be called by a single thread, e.g. the one of RouDi which monitors the mempools
+    void addMemPoolExtent(const uint32_t memPoolIndex,
+                          posix::Allocator& managementAllocator,
+                          posix::Allocator& chunkMemoryAllocator) noexcept;
+
+    uint32_t getNumberOfMemPoolExtents() const noexcept;
+
+    MemPoolInfo getMemPoolExtentInfo(const uint32_t index) const noexcept;
+
+    /// @brief returns the number of chunks a mempool extent of the mempool with the given index has, 0 if the
+    /// mempool cannot grow
+    uint32_t getExtentChunkCount(const uint32_t memPoolIndex) const noexcept;
+
+    /// @brief returns the number of free chunks of the mempool with the given index including its extents
+    uint32_t getNumberOfFreeChunks(const uint32_t memPoolIndex) const noexcept;
+
+    /// @brief records a chunk request which is served without getChunk, e.g. by reusing the previous chunk of a
+    /// publisher; getChunk records its requests itself
+    /// @param[in] chunkSettings of the requested chunk
+    void recordChunkRequest(const ChunkSettings& chunkSettings) noexcept;
+
+    /// @brief returns the histogram of the requested chunk-payload sizes, including the failed requests
+    const ChunkSizeHistogram& getRequestedChunkPayloadSizes() const noexcept;
+
+    /// @brief returns the number of getChunk calls which failed since no mempool has a large enough chunk size
+    uint64_t getNumberOfTooLargeRequests() const noexcept;
+
+    /// @brief returns the number of chunk managements including the ones of the mempool extents; they are indexed in
+    /// the order of their creation, therefore the index of a chunk management does not change when extents are added
+    uint64_t getNumberOfChunkManagements() const noexcept;
+
+    /// @brief Releases the references to chunks which are held by lost owners, i.e. ports whose process terminated
+    /// while they held a chunk outside of their containers, see SharedChunk::setOwner
+    /// @param[in] firstChunkManagement index of the first chunk management to check
+    /// @param[in] numberOfChunkManagements number of chunk managements to check
+    /// @param[in] isLostOwner returns true when the provided unique port id belongs to a lost owner
+    /// @return the number of released references
+    /// @note must only be called by a single thread, e.g. the one of RouDi which monitors the processes
+    uint32_t releaseChunksOfLostOwners(const uint64_t firstChunkManagement,
+                                       const uint64_t numberOfChunkManagements,
+                                       const cxx::function_ref<bool(const uint64_t)> isLostOwner) noexcept;
+
+    /// @brief returns the number of chunks of the mempool with the given index and its extents which were released by
+    /// releaseChunksOfLostOwners
+    uint64_t getNumberOfReclaimedChunks(const uint32_t memPoolIndex) const noexcept;
+
     static uint64_t requiredChunkMemorySize(const MePooConfig& mePooConfig) noexcept;
     static uint64_t requiredManagementMemorySize(const MePooConfig& mePooConfig) noexcept;
     static uint64_t requiredFullMemorySize(const MePooConfig& mePooConfig) noexcept;
 
+    static uint64_t requiredExtentChunkMemorySize(const uint32_t chunkSize, const uint32_t numberOfChunks) noexcept;
+    static uint64_t requiredExtentManagementMemorySize(const uint32_t numberOfChunks) noexcept;
+
   private:
+    /// @brief Additional chunks of the chunk size of a mempool which are added at runtime. The chunks and their
+    /// chunk management are allocated from memory which is created with the extent.
+    struct MemPoolExtent
+    {
+        MemPoolExtent(const uint32_t memPoolIndex,
+                      const uint32_t chunkSize,
+                      const uint32_t numberOfChunks,
+                      posix::Allocator& managementAllocator,
+                      posix::Allocator& chunkMemoryAllocator) noexcept;
+
+        uint32_t m_memPoolIndex{0U};
+        MemPool m_memPool;
+        MemPool m_chunkManagementPool;
+    };
+
     static uint32_t sizeWithChunkHeaderStruct(const MaxChunkPayloadSize_t size) noexcept;
 
     void printMemPoolVector(log::LogStream& log) const noexcept;
     void addMemPool(posix::Allocator& managementAllocator,
                     posix::Allocator& chunkMemoryAllocator,
                     const cxx::greater_or_equal<uint32_t, MemPool::CHUNK_MEMORY_ALIGNMENT> chunkPayloadSize,
-                    const cxx::greater_or_equal<uint32_t, 1> numberOfChunks) noexcept;
+                    const cxx::greater_or_equal<uint32_t, 1> numberOfChunks,
+                    const uint32_t numaNode) noexcept;
+    bool isValidNumaNodeForMemPool(const uint32_t chunkSize, const uint32_t numaNode) const noexcept;
     void generateChunkManagementPool(posix::Allocator& managementAllocator) noexcept;
+    static void clearChunkManagements(MemPool& chunkManagementPool) noexcept;
+    bool releaseChunkOfLostOwner(ChunkManagement& chunkManagement,
+                                 const cxx::function_ref<bool(const uint64_t)> isLostOwner) noexcept;
+    uint32_t getMemPoolIndex(const MemPool* const memPool) const noexcept;
+    uint32_t findMemPoolOnCurrentNumaNode(const uint32_t firstMemPool, const uint32_t endOfMemPools) const noexcept;
+    uint32_t getNumberOfUsedChunks(const uint32_t memPoolIndex) const noexcept;
+    cxx::expected<SharedChunk, Error> getChunkFromMemPool(const uint32_t memPoolIndex,
+                                                          const ChunkSettings& chunkSettings,
+                                                          ChunkQuota* const chunkQuota) noexcept;
+    void* getChunkFromMemPoolExtents(const uint32_t memPoolIndex,
+                                     MemPool*& memPool,
+                                     MemPool*& chunkManagementPool) noexcept;
 
   private:
     bool m_denyAddMemPool{false};
@@ -93,6 +213,21 @@ class MemoryManager
 
     cxx::vector<MemPool, MAX_NUMBER_OF_MEMPOOLS> m_memPoolVector;
     cxx::vector<MemPool, 1> m_chunkManagementPool;
+    cxx::vector<uint32_t, MAX_NUMBER_OF_MEMPOOLS> m_extentChunkCounts;
+    cxx::vector<uint32_t, MAX_NUMBER_OF_MEMPOOLS> m_memPoolNumaNodes;
+    /// @brief true when there are mempools with the same chunk size on different NUMA nodes
+    bool m_hasMemPoolsOnMultipleNumaNodes{false};
+    cxx::vector<MemPoolAccounting, MAX_NUMBER_OF_MEMPOOLS> m_memPoolAccountings;
+    ChunkQuota m_chunkQuotas[MAX_NUMBER_OF_CHUNK_QUOTAS];
+
+    /// @note the extents are only accessed via data() up to m_numberOfMemPoolExtents, which is published after the
+    /// extent is constructed, since they are added while other processes are acquiring chunks
+    cxx::vector<MemPoolExtent, MAX_NUMBER_OF_MEMPOOL_EXTENTS> m_memPoolExtents;
+    std::atomic<uint32_t> m_numberOfMemPoolExtents{0U};
+
+    ChunkSizeHistogram m_requestedChunkPayloadSizes;
+    std::atomic<uint64_t> m_numberOfTooLargeRequests{0U};
+    std::atomic<uint64_t> m_numberOfReclaimedChunks[MAX_NUMBER_OF_MEMPOOLS]{};
 };
 
 /// @brief Converts the MemoryManager::Error to a string literal
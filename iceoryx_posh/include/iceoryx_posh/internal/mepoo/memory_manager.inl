@@ -31,6 +31,8 @@ inline constexpr const char* asStringLiteral(const MemoryManager::Error value) n
         return "MemoryManager::Error::NO_MEMPOOL_FOR_REQUESTED_CHUNK_SIZE";
     case MemoryManager::Error::MEMPOOL_OUT_OF_CHUNKS:
         return "MemoryManager::Error::MEMPOOL_OUT_OF_CHUNKS";
+    case MemoryManager::Error::CHUNK_QUOTA_EXCEEDED:
+        return "MemoryManager::Error::CHUNK_QUOTA_EXCEEDED";
     }
 
     return "[Undefined MemoryManager::Error]";
@@ -17,6 +17,8 @@
 #ifndef IOX_POSH_MEPOO_MEPOO_SEGMENT_HPP
 #define IOX_POSH_MEPOO_MEPOO_SEGMENT_HPP
 
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_hoofs/internal/posix_wrapper/access_control.hpp"
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object.hpp"
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
@@ -24,6 +26,9 @@
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iceoryx_posh/mepoo/numa_placement.hpp"
+
+#include <atomic>
 
 namespace iox
 {
@@ -33,11 +38,23 @@ template <typename SharedMemoryObjectType = posix::SharedMemoryObject, typename
 class MePooSegment
 {
   public:
+    /// @brief Shared memory of a mempool extent. Each extent has a chunk memory with the access rights of the segment
+    /// and a management memory with the chunk management, which is writable for the readers too since they modify
+    /// the reference counter. Applications map the extent memory lazily when they resolve a pointer to it.
+    struct ExtentMemory
+    {
+        ShmName_t m_sharedMemoryName;
+        uint64_t m_size{0U};
+        uint64_t m_segmentId{0U};
+        bool m_isChunkMemory{false};
+    };
+
     MePooSegment(const MePooConfig& mempoolConfig,
                  posix::Allocator& managementAllocator,
                  const posix::PosixGroup& readerGroup,
                  const posix::PosixGroup& writerGroup,
-                 const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo()) noexcept;
+                 const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo(),
+                 const NumaPlacement& numaPlacement = NumaPlacement()) noexcept;
 
     posix::PosixGroup getWriterGroup() const noexcept;
     posix::PosixGroup getReaderGroup() const noexcept;
@@ -46,9 +63,30 @@ class MePooSegment
 
     uint64_t getSegmentId() const noexcept;
 
+    /// @brief adds a mempool extent to every mempool with an extent chunk count which has less than half of an
+    /// extent free
+    void growMemPools() noexcept;
+
+    /// @brief creates the shared memory for a mempool extent and adds the extent to the mempool with the given index;
+    /// the first failure after a successfully added extent is reported to the error handler with ErrorLevel::MODERATE
+    /// @return true if the extent was added, false if the maximum number of extents is reached or the shared memory
+    /// could not be created
+    bool addMemPoolExtent(const uint32_t memPoolIndex) noexcept;
+
+    /// @brief returns the extent memory which is registered with the given segment id
+    cxx::optional<ExtentMemory> findExtentMemory(const uint64_t segmentId) const noexcept;
+
   protected:
     SharedMemoryObjectType createSharedMemoryObject(const MePooConfig& mempoolConfig,
                                                     const posix::PosixGroup& writerGroup) noexcept;
+    bool applyAccessRights(const int fileHandle, const posix::AccessController::Permission readerPermission) noexcept;
+    cxx::optional<SharedMemoryObjectType> createExtentMemory(const ShmName_t& name,
+                                                             const uint64_t size,
+                                                             const bool isChunkMemory) noexcept;
+    void registerExtentMemory(const ShmName_t& name,
+                              SharedMemoryObjectType& extentMemory,
+                              const bool isChunkMemory) noexcept;
+    void reportExtentFailure(const PoshError error) noexcept;
 
   protected:
     SharedMemoryObjectType m_sharedMemoryObject;
@@ -57,6 +95,13 @@ class MePooSegment
     posix::PosixGroup m_writerGroup;
     uint64_t m_segmentId;
     iox::mepoo::MemoryInfo m_memoryInfo;
+    NumaPlacement m_numaPlacement;
+
+    /// @note the extent memories are read by the applications via data() up to m_numberOfExtentMemories
+    cxx::vector<SharedMemoryObjectType, 2U * MAX_NUMBER_OF_MEMPOOL_EXTENTS> m_extentSharedMemoryObjects;
+    cxx::vector<ExtentMemory, 2U * MAX_NUMBER_OF_MEMPOOL_EXTENTS> m_extentMemories;
+    std::atomic<uint32_t> m_numberOfExtentMemories{0U};
+    bool m_isExtentFailureReported{false};
 
     static constexpr cxx::perms SEGMENT_PERMISSIONS =
         cxx::perms::owner_read | cxx::perms::owner_write | cxx::perms::group_read | cxx::perms::group_write;
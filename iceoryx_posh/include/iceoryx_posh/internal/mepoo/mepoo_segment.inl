@@ -17,6 +17,7 @@
 #ifndef IOX_POSH_MEPOO_MEPOO_SEGMENT_INL
 #define IOX_POSH_MEPOO_MEPOO_SEGMENT_INL
 
+#include "iceoryx_hoofs/cxx/convert.hpp"
 #include "iceoryx_hoofs/internal/relocatable_pointer/relative_pointer.hpp"
 #include "iceoryx_posh/error_handling/error_handling.hpp"
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
@@ -37,30 +38,42 @@ inline MePooSegment<SharedMemoryObjectType, MemoryManagerType>::MePooSegment(
     posix::Allocator& managementAllocator,
     const posix::PosixGroup& readerGroup,
     const posix::PosixGroup& writerGroup,
-    const iox::mepoo::MemoryInfo& memoryInfo) noexcept
+    const iox::mepoo::MemoryInfo& memoryInfo,
+    const NumaPlacement& numaPlacement) noexcept
     : m_sharedMemoryObject(std::move(createSharedMemoryObject(mempoolConfig, writerGroup)))
     , m_readerGroup(readerGroup)
     , m_writerGroup(writerGroup)
     , m_memoryInfo(memoryInfo)
+    , m_numaPlacement(numaPlacement)
+{
+    if (!applyAccessRights(m_sharedMemoryObject.getFileHandle(), posix::AccessController::Permission::READ))
+    {
+        errorHandler(PoshError::MEPOO__SEGMENT_COULD_NOT_APPLY_POSIX_RIGHTS_TO_SHARED_MEMORY);
+    }
+
+    // the memory manager places the mempools with a NUMA node afterwards
+    applyNumaPlacement(m_sharedMemoryObject.getBaseAddress(), m_sharedMemoryObject.getSizeInBytes(), m_numaPlacement);
+
+    m_memoryManager.configureMemoryManager(mempoolConfig, managementAllocator, m_sharedMemoryObject.getAllocator());
+    m_sharedMemoryObject.finalizeAllocation();
+}
+
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline bool MePooSegment<SharedMemoryObjectType, MemoryManagerType>::applyAccessRights(
+    const int fileHandle, const posix::AccessController::Permission readerPermission) noexcept
 {
     using namespace posix;
     AccessController accessController;
-    if (!(readerGroup == writerGroup))
+    if (!(m_readerGroup == m_writerGroup))
     {
-        accessController.addGroupPermission(AccessController::Permission::READ, readerGroup.getName());
+        accessController.addGroupPermission(readerPermission, m_readerGroup.getName());
     }
-    accessController.addGroupPermission(AccessController::Permission::READWRITE, writerGroup.getName());
+    accessController.addGroupPermission(AccessController::Permission::READWRITE, m_writerGroup.getName());
     accessController.addPermissionEntry(AccessController::Category::USER, AccessController::Permission::READWRITE);
     accessController.addPermissionEntry(AccessController::Category::GROUP, AccessController::Permission::READWRITE);
     accessController.addPermissionEntry(AccessController::Category::OTHERS, AccessController::Permission::NONE);
 
-    if (!accessController.writePermissionsToFile(m_sharedMemoryObject.getFileHandle()))
-    {
-        errorHandler(PoshError::MEPOO__SEGMENT_COULD_NOT_APPLY_POSIX_RIGHTS_TO_SHARED_MEMORY);
-    }
-
-    m_memoryManager.configureMemoryManager(mempoolConfig, managementAllocator, m_sharedMemoryObject.getAllocator());
-    m_sharedMemoryObject.finalizeAllocation();
+    return accessController.writePermissionsToFile(fileHandle);
 }
 
 template <typename SharedMemoryObjectType, typename MemoryManagerType>
@@ -118,6 +131,149 @@ inline uint64_t MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getSegm
     return m_segmentId;
 }
 
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline void MePooSegment<SharedMemoryObjectType, MemoryManagerType>::growMemPools() noexcept
+{
+    for (uint32_t i = 0U; i < m_memoryManager.getNumberOfMemPools(); ++i)
+    {
+        const auto extentChunkCount = m_memoryManager.getExtentChunkCount(i);
+        if (extentChunkCount > 0U && m_memoryManager.getNumberOfFreeChunks(i) < (extentChunkCount + 1U) / 2U)
+        {
+            if (!addMemPoolExtent(i))
+            {
+                return;
+            }
+        }
+    }
+}
+
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline bool
+MePooSegment<SharedMemoryObjectType, MemoryManagerType>::addMemPoolExtent(const uint32_t memPoolIndex) noexcept
+{
+    const auto chunkSize = m_memoryManager.getMemPoolInfo(memPoolIndex).m_chunkSize;
+    if (m_memoryManager.getNumberOfMemPoolExtents() >= MAX_NUMBER_OF_MEMPOOL_EXTENTS)
+    {
+        LogError() << "Unable to add an extent to the mempool with chunk size " << chunkSize
+                   << " of the segment with writer group " << m_writerGroup.getName() << " since all "
+                   << MAX_NUMBER_OF_MEMPOOL_EXTENTS << " extents are in use";
+        reportExtentFailure(PoshError::MEPOO__MEMPOOL_EXTENT_LIMIT_REACHED);
+        return false;
+    }
+
+    const auto extentChunkCount = m_memoryManager.getExtentChunkCount(memPoolIndex);
+
+    // the extents are named like the segment after the writer group, a leftover of a crashed RouDi or of a failed
+    // attempt is purged when the name is used again
+    const std::string extentName = std::string(m_writerGroup.getName().c_str()) + "_extent_"
+                                   + cxx::convert::toString(m_memoryManager.getNumberOfMemPoolExtents());
+    const ShmName_t chunkMemoryName{cxx::TruncateToCapacity, extentName};
+    const ShmName_t managementMemoryName{cxx::TruncateToCapacity, extentName + "_mgmt"};
+
+    auto chunkMemory = createExtentMemory(
+        chunkMemoryName, MemoryManagerType::requiredExtentChunkMemorySize(chunkSize, extentChunkCount), true);
+    auto managementMemory = createExtentMemory(
+        managementMemoryName, MemoryManagerType::requiredExtentManagementMemorySize(extentChunkCount), false);
+    if (!chunkMemory.has_value() || !managementMemory.has_value())
+    {
+        LogError() << "Unable to create the shared memory for an extent of the mempool with chunk size " << chunkSize
+                   << " of the segment with writer group " << m_writerGroup.getName();
+        reportExtentFailure(PoshError::MEPOO__MEMPOOL_EXTENT_UNABLE_TO_CREATE_SHARED_MEMORY_OBJECT);
+        return false;
+    }
+    m_isExtentFailureReported = false;
+
+    // the extent memory must be published before the chunks can be acquired, since applications look it up when
+    // they resolve a pointer to a chunk of the extent
+    m_extentSharedMemoryObjects.emplace_back(std::move(chunkMemory.value()));
+    auto& chunkMemoryObject = m_extentSharedMemoryObjects.back();
+    applyNumaPlacement(chunkMemoryObject.getBaseAddress(), chunkMemoryObject.getSizeInBytes(), m_numaPlacement);
+    m_extentSharedMemoryObjects.emplace_back(std::move(managementMemory.value()));
+    auto& managementMemoryObject = m_extentSharedMemoryObjects.back();
+    registerExtentMemory(chunkMemoryName, chunkMemoryObject, true);
+    registerExtentMemory(managementMemoryName, managementMemoryObject, false);
+    m_numberOfExtentMemories.store(static_cast<uint32_t>(m_extentMemories.size()), std::memory_order_release);
+
+    m_memoryManager.addMemPoolExtent(
+        memPoolIndex, managementMemoryObject.getAllocator(), chunkMemoryObject.getAllocator());
+    chunkMemoryObject.finalizeAllocation();
+    managementMemoryObject.finalizeAllocation();
+
+    LogInfo() << "Added an extent with " << extentChunkCount << " chunks to the mempool with chunk size " << chunkSize
+              << " of the segment with writer group " << m_writerGroup.getName();
+    return true;
+}
+
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline cxx::optional<SharedMemoryObjectType>
+MePooSegment<SharedMemoryObjectType, MemoryManagerType>::createExtentMemory(const ShmName_t& name,
+                                                                            const uint64_t size,
+                                                                            const bool isChunkMemory) noexcept
+{
+    cxx::optional<SharedMemoryObjectType> extentMemory;
+    typename SharedMemoryObjectType::Builder()
+        .name(name)
+        .memorySizeInBytes(size)
+        .accessMode(posix::AccessMode::READ_WRITE)
+        .openMode(posix::OpenMode::PURGE_AND_CREATE)
+        .permissions(SEGMENT_PERMISSIONS)
+        .create()
+        .and_then([&](auto& sharedMemoryObject) { extentMemory.emplace(std::move(sharedMemoryObject)); });
+
+    if (!extentMemory.has_value())
+    {
+        return cxx::nullopt;
+    }
+
+    const auto readerPermission =
+        isChunkMemory ? posix::AccessController::Permission::READ : posix::AccessController::Permission::READWRITE;
+    if (!applyAccessRights(extentMemory->getFileHandle(), readerPermission))
+    {
+        return cxx::nullopt;
+    }
+
+    return extentMemory;
+}
+
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline void MePooSegment<SharedMemoryObjectType, MemoryManagerType>::registerExtentMemory(
+    const ShmName_t& name, SharedMemoryObjectType& extentMemory, const bool isChunkMemory) noexcept
+{
+    const auto segmentId = static_cast<uint64_t>(
+        rp::BaseRelativePointer::registerPtr(extentMemory.getBaseAddress(), extentMemory.getSizeInBytes()));
+    m_extentMemories.emplace_back(ExtentMemory{name, extentMemory.getSizeInBytes(), segmentId, isChunkMemory});
+
+    LogDebug() << "Roudi registered mempool extent " << name << " with size " << extentMemory.getSizeInBytes()
+               << " to id " << segmentId;
+}
+
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline void MePooSegment<SharedMemoryObjectType, MemoryManagerType>::reportExtentFailure(const PoshError error) noexcept
+{
+    // growMemPools is called cyclically, the shortage is reported once and not on every retry
+    if (!m_isExtentFailureReported)
+    {
+        m_isExtentFailureReported = true;
+        errorHandler(error, ErrorLevel::MODERATE);
+    }
+}
+
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline cxx::optional<typename MePooSegment<SharedMemoryObjectType, MemoryManagerType>::ExtentMemory>
+MePooSegment<SharedMemoryObjectType, MemoryManagerType>::findExtentMemory(const uint64_t segmentId) const noexcept
+{
+    const auto numberOfExtentMemories = m_numberOfExtentMemories.load(std::memory_order_acquire);
+    for (uint32_t i = 0U; i < numberOfExtentMemories; ++i)
+    {
+        const auto& extentMemory = m_extentMemories.data()[i];
+        if (extentMemory.m_segmentId == segmentId)
+        {
+            return extentMemory;
+        }
+    }
+    return cxx::nullopt;
+}
+
 template <typename SharedMemoryObjectType, typename MemoryManagerType>
 inline void MePooSegment<SharedMemoryObjectType, MemoryManagerType>::setSegmentId(const uint64_t segmentId) noexcept
 {
@@ -17,6 +17,7 @@
 #ifndef IOX_POSH_MEPOO_SEGMENT_MANAGER_HPP
 #define IOX_POSH_MEPOO_SEGMENT_MANAGER_HPP
 
+#include "iceoryx_hoofs/cxx/function_ref.hpp"
 #include "iceoryx_hoofs/cxx/optional.hpp"
 #include "iceoryx_hoofs/cxx/string.hpp"
 #include "iceoryx_hoofs/cxx/vector.hpp"
@@ -89,6 +90,12 @@ class SegmentManager
     SegmentMappingContainer getSegmentMappings(const posix::PosixUser& user) noexcept;
     SegmentUserInformation getSegmentInformationWithWriteAccessForUser(const posix::PosixUser& user) noexcept;
 
+    /// @brief calls the provided callable with every segment in the order of the segment config
+    void forEachSegment(const cxx::function_ref<void(SegmentType&)> callable) noexcept;
+
+    /// @brief adds mempool extents to the growable mempools of all segments which run low on chunks
+    void growMemPools() noexcept;
+
     static uint64_t requiredManagementMemorySize(const SegmentConfig& config) noexcept;
     static uint64_t requiredChunkMemorySize(const SegmentConfig& config) noexcept;
     static uint64_t requiredFullMemorySize(const SegmentConfig& config) noexcept;
@@ -45,7 +45,12 @@ inline void SegmentManager<SegmentType>::createSegment(const SegmentConfig::Segm
     auto readerGroup = iox::posix::PosixGroup(segmentEntry.m_readerGroup);
     auto writerGroup = iox::posix::PosixGroup(segmentEntry.m_writerGroup);
     m_segmentContainer.emplace_back(
-        segmentEntry.m_mempoolConfig, *m_managementAllocator, readerGroup, writerGroup, segmentEntry.m_memoryInfo);
+        segmentEntry.m_mempoolConfig,
+        *m_managementAllocator,
+        readerGroup,
+        writerGroup,
+        segmentEntry.m_memoryInfo,
+        segmentEntry.m_numaPlacement);
 }
 
 template <typename SegmentType>
@@ -132,6 +137,24 @@ SegmentManager<SegmentType>::getSegmentInformationWithWriteAccessForUser(const p
     return segmentInfo;
 }
 
+template <typename SegmentType>
+inline void SegmentManager<SegmentType>::forEachSegment(const cxx::function_ref<void(SegmentType&)> callable) noexcept
+{
+    for (auto& segment : m_segmentContainer)
+    {
+        callable(segment);
+    }
+}
+
+template <typename SegmentType>
+inline void SegmentManager<SegmentType>::growMemPools() noexcept
+{
+    for (auto& segment : m_segmentContainer)
+    {
+        segment.growMemPools();
+    }
+}
+
 template <typename SegmentType>
 uint64_t SegmentManager<SegmentType>::requiredManagementMemorySize(const SegmentConfig& config) noexcept
 {
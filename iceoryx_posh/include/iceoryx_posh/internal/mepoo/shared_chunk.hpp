@@ -49,6 +49,25 @@ class SharedChunk
 
     ChunkManagement* release() noexcept;
 
+    /// @brief Marks the reference of this SharedChunk as held by the given port outside of the port's containers. If
+    /// the process of the port terminates before resetOwner is called, RouDi releases the reference.
+    /// @param[in] owner the unique id of the port
+    void setOwner(const popo::UniquePortId owner) noexcept;
+
+    /// @brief must be called before the reference which was marked with setOwner is released or stored
+    void resetOwner() noexcept;
+
+    /// @brief Chains a chunk as part of the multi-chunk sample this chunk is the head of. The part is released
+    /// together with this chunk.
+    /// @param[in] part the chunk to chain, the reference is taken over; it must not have other owners
+    void addPart(SharedChunk&& part) noexcept;
+
+    /// @brief returns true if parts are chained to this chunk
+    bool hasParts() const noexcept;
+
+    /// @brief releases the parts which are chained to this chunk
+    void releaseParts() noexcept;
+
     bool operator==(const SharedChunk& rhs) const noexcept;
     /// @todo use the newtype pattern to avoid the void pointer
     bool operator==(const void* const rhs) const noexcept;
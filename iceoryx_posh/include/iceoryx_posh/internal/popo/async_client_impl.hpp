@@ -0,0 +1,136 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_POPO_ASYNC_CLIENT_IMPL_HPP
+#define IOX_POSH_POPO_ASYNC_CLIENT_IMPL_HPP
+
+#include "iceoryx_hoofs/internal/units/duration.hpp"
+#include "iceoryx_posh/internal/popo/client_impl.hpp"
+#include "iceoryx_posh/internal/popo/in_flight_requests.hpp"
+#include "iceoryx_posh/popo/response_future.hpp"
+
+namespace iox
+{
+namespace popo
+{
+enum class AsyncSendError
+{
+    TOO_MANY_REQUESTS_IN_FLIGHT,
+    NO_CONNECT_REQUESTED,
+    SERVER_NOT_AVAILABLE,
+    INVALID_REQUEST
+};
+
+/// @brief Converts the AsyncSendError to a string literal
+/// @param[in] value to convert to a string literal
+/// @return pointer to a string literal
+inline constexpr const char* asStringLiteral(const AsyncSendError value) noexcept;
+
+/// @brief Convenience stream operator to easily use the `asStringLiteral` function with std::ostream
+/// @param[in] stream sink to write the message to
+/// @param[in] value to convert to a string literal
+/// @return the reference to `stream` which was provided as input parameter
+inline std::ostream& operator<<(std::ostream& stream, AsyncSendError value) noexcept;
+
+/// @brief Convenience stream operator to easily use the `asStringLiteral` function with iox::log::LogStream
+/// @param[in] stream sink to write the message to
+/// @param[in] value to convert to a string literal
+/// @return the reference to `stream` which was provided as input parameter
+inline log::LogStream& operator<<(log::LogStream& stream, AsyncSendError value) noexcept;
+
+/// @brief The AsyncClientImpl class implements the asynchronous typed client API
+/// @note Not intended for public usage! Use the `AsyncClient` instead!
+template <typename Req, typename Res, typename BaseClientT = BaseClient<>>
+class AsyncClientImpl : public ClientImpl<Req, Res, BaseClientT>
+{
+    using Impl = ClientImpl<Req, Res, BaseClientT>;
+
+  public:
+    using Callback_t = typename InFlightRequests<Res>::Callback_t;
+
+    /// @brief Constructor for an asynchronous client
+    /// @param[in] service is the ServiceDescription for the new client
+    /// @param[in] clientOptions like the queue capacity and the maximum number of outstanding requests; the requests in
+    /// flight are also limited to the response queue capacity, so that their responses cannot overflow the queue
+    explicit AsyncClientImpl(const capro::ServiceDescription& service,
+                             const ClientOptions& clientOptions = {}) noexcept;
+    virtual ~AsyncClientImpl() noexcept;
+
+    AsyncClientImpl(const AsyncClientImpl&) = delete;
+    AsyncClientImpl(AsyncClientImpl&&) = delete;
+    AsyncClientImpl& operator=(const AsyncClientImpl&) = delete;
+    AsyncClientImpl& operator=(AsyncClientImpl&&) = delete;
+
+    /// @brief Sends the given Request and provides a future for its response
+    /// @param[in] request to send; the sequence id of the request header is assigned by the client
+    /// @param[in] timeout after which the future fails with AsyncResponseError::TIMED_OUT if there is no response
+    /// @return the future of the response or an error if the request could not be sent
+    cxx::expected<ResponseFuture<Res>, AsyncSendError>
+    sendAsync(Request<Req>&& request, const units::Duration timeout = units::Duration::max()) noexcept;
+
+    /// @brief Sends the given Request and calls the callback with its response
+    /// @param[in] request to send; the sequence id of the request header is assigned by the client
+    /// @param[in] callback which is called from processResponses with the response, when the timeout expired or when
+    /// the request is cancelled
+    /// @param[in] timeout after which the callback is called with AsyncResponseError::TIMED_OUT
+    /// @return the sequence id of the request which can be used to cancel it or an error if the request could not be
+    /// sent; the callback is not called when an error is returned
+    cxx::expected<int64_t, AsyncSendError> sendAsync(Request<Req>&& request,
+                                                     const Callback_t& callback,
+                                                     const units::Duration timeout = units::Duration::max()) noexcept;
+
+    /// @brief Correlates the received responses with the requests in flight and times out the expired requests
+    /// @return the number of responses which were taken from the response queue
+    /// @note Must be called regularly from the thread which uses the client and its futures, e.g. after the
+    /// timedWait of a WaitSet to which ClientEvent::RESPONSE_RECEIVED is attached returned. The callbacks of timed
+    /// out requests are only called from here, therefore the wait should not exceed timeUntilNextTimeout. When
+    /// MAX_RESPONSES_PROCESSED_SIMULTANEOUSLY responses are held by futures which are not yet taken, the remaining
+    /// responses stay in the queue until a future is taken.
+    uint64_t processResponses() noexcept;
+
+    /// @brief returns the time until the earliest timeout of the requests in flight, zero if it already expired and
+    /// units::Duration::max() if no request has a timeout; it is meant as the timeout of the wait for the responses
+    units::Duration timeUntilNextTimeout() const noexcept;
+
+    /// @brief Cancels a request which was sent with a callback; the callback is called with
+    /// AsyncResponseError::CANCELLED
+    /// @return false if the request is not in flight
+    bool cancel(const int64_t sequenceId) noexcept;
+
+    /// @brief returns the number of requests which are in flight or whose response was not yet taken
+    uint64_t numberOfRequestsInFlight() const noexcept;
+
+  protected:
+    using BaseClientT::port;
+
+  private:
+    // the requests must be tracked by the in-flight table; sending or taking behind its back is not possible
+    using Impl::send;
+    using Impl::take;
+
+    cxx::expected<int64_t, AsyncSendError> sendTracked(Request<Req>&& request, const int64_t sequenceId) noexcept;
+    static uint64_t deadline(const units::Duration timeout) noexcept;
+
+  private:
+    InFlightRequests<Res> m_inFlightRequests;
+};
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/async_client_impl.inl"
+
+#endif // IOX_POSH_POPO_ASYNC_CLIENT_IMPL_HPP
@@ -0,0 +1,193 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_POPO_ASYNC_CLIENT_IMPL_INL
+#define IOX_POSH_POPO_ASYNC_CLIENT_IMPL_INL
+
+#include "iceoryx_posh/internal/popo/async_client_impl.hpp"
+
+#include <algorithm>
+
+namespace iox
+{
+namespace popo
+{
+inline constexpr const char* asStringLiteral(const AsyncSendError value) noexcept
+{
+    switch (value)
+    {
+    case AsyncSendError::TOO_MANY_REQUESTS_IN_FLIGHT:
+        return "AsyncSendError::TOO_MANY_REQUESTS_IN_FLIGHT";
+    case AsyncSendError::NO_CONNECT_REQUESTED:
+        return "AsyncSendError::NO_CONNECT_REQUESTED";
+    case AsyncSendError::SERVER_NOT_AVAILABLE:
+        return "AsyncSendError::SERVER_NOT_AVAILABLE";
+    case AsyncSendError::INVALID_REQUEST:
+        return "AsyncSendError::INVALID_REQUEST";
+    }
+
+    return "[Undefined AsyncSendError]";
+}
+
+inline std::ostream& operator<<(std::ostream& stream, AsyncSendError value) noexcept
+{
+    stream << asStringLiteral(value);
+    return stream;
+}
+
+inline log::LogStream& operator<<(log::LogStream& stream, AsyncSendError value) noexcept
+{
+    stream << asStringLiteral(value);
+    return stream;
+}
+
+template <typename Req, typename Res, typename BaseClientT>
+inline AsyncClientImpl<Req, Res, BaseClientT>::AsyncClientImpl(const capro::ServiceDescription& service,
+                                                               const ClientOptions& clientOptions) noexcept
+    : Impl(service, clientOptions)
+    , m_inFlightRequests(std::min({clientOptions.maxOutstandingRequests,
+                                   clientOptions.responseQueueCapacity,
+                                   ClientChunkQueueData_t::MAX_CAPACITY}))
+{
+}
+
+template <typename Req, typename Res, typename BaseClientT>
+inline AsyncClientImpl<Req, Res, BaseClientT>::~AsyncClientImpl() noexcept
+{
+    BaseClientT::m_trigger.reset();
+}
+
+template <typename Req, typename Res, typename BaseClientT>
+inline uint64_t AsyncClientImpl<Req, Res, BaseClientT>::deadline(const units::Duration timeout) noexcept
+{
+    if (timeout == units::Duration::max())
+    {
+        return InFlightRequests<Res>::NO_DEADLINE;
+    }
+
+    const auto now = InFlightRequests<Res>::now();
+    const auto timeoutInNanoseconds = timeout.toNanoseconds();
+    return (timeoutInNanoseconds >= InFlightRequests<Res>::NO_DEADLINE - now) ? InFlightRequests<Res>::NO_DEADLINE
+                                                                               : now + timeoutInNanoseconds;
+}
+
+template <typename Req, typename Res, typename BaseClientT>
+inline cxx::expected<int64_t, AsyncSendError>
+AsyncClientImpl<Req, Res, BaseClientT>::sendTracked(Request<Req>&& request, const int64_t sequenceId) noexcept
+{
+    request.getRequestHeader().setSequenceId(sequenceId);
+    auto result = Impl::send(std::move(request));
+    if (!result.has_error())
+    {
+        return cxx::success<int64_t>(sequenceId);
+    }
+
+    m_inFlightRequests.remove(sequenceId);
+    switch (result.get_error())
+    {
+    case ClientSendError::NO_CONNECT_REQUESTED:
+        return cxx::error<AsyncSendError>(AsyncSendError::NO_CONNECT_REQUESTED);
+    case ClientSendError::SERVER_NOT_AVAILABLE:
+        return cxx::error<AsyncSendError>(AsyncSendError::SERVER_NOT_AVAILABLE);
+    case ClientSendError::INVALID_REQUEST:
+        break;
+    }
+    return cxx::error<AsyncSendError>(AsyncSendError::INVALID_REQUEST);
+}
+
+template <typename Req, typename Res, typename BaseClientT>
+inline cxx::expected<ResponseFuture<Res>, AsyncSendError>
+AsyncClientImpl<Req, Res, BaseClientT>::sendAsync(Request<Req>&& request, const units::Duration timeout) noexcept
+{
+    auto sequenceId = m_inFlightRequests.add(deadline(timeout));
+    if (!sequenceId.has_value())
+    {
+        return cxx::error<AsyncSendError>(AsyncSendError::TOO_MANY_REQUESTS_IN_FLIGHT);
+    }
+
+    auto result = sendTracked(std::move(request), sequenceId.value());
+    if (result.has_error())
+    {
+        return cxx::error<AsyncSendError>(result.get_error());
+    }
+    return cxx::success<ResponseFuture<Res>>(ResponseFuture<Res>(m_inFlightRequests, sequenceId.value()));
+}
+
+template <typename Req, typename Res, typename BaseClientT>
+inline cxx::expected<int64_t, AsyncSendError> AsyncClientImpl<Req, Res, BaseClientT>::sendAsync(
+    Request<Req>&& request, const Callback_t& callback, const units::Duration timeout) noexcept
+{
+    auto sequenceId = m_inFlightRequests.add(deadline(timeout), callback);
+    if (!sequenceId.has_value())
+    {
+        return cxx::error<AsyncSendError>(AsyncSendError::TOO_MANY_REQUESTS_IN_FLIGHT);
+    }
+
+    return sendTracked(std::move(request), sequenceId.value());
+}
+
+template <typename Req, typename Res, typename BaseClientT>
+inline uint64_t AsyncClientImpl<Req, Res, BaseClientT>::processResponses() noexcept
+{
+    uint64_t numberOfResponses{0U};
+    // a response which is taken while MAX_RESPONSES_PROCESSED_SIMULTANEOUSLY responses are held would be released by
+    // the port, therefore it stays in the queue until a future is taken
+    while (m_inFlightRequests.numberOfReadyResponses() < MAX_RESPONSES_PROCESSED_SIMULTANEOUSLY)
+    {
+        auto result = Impl::take();
+        if (result.has_error())
+        {
+            break;
+        }
+        ++numberOfResponses;
+        // a response without pending request, e.g. one which timed out, is released when the result goes out of scope
+        m_inFlightRequests.complete(std::move(result.value()));
+    }
+
+    m_inFlightRequests.expire(InFlightRequests<Res>::now());
+    return numberOfResponses;
+}
+
+template <typename Req, typename Res, typename BaseClientT>
+inline units::Duration AsyncClientImpl<Req, Res, BaseClientT>::timeUntilNextTimeout() const noexcept
+{
+    const auto nextDeadline = m_inFlightRequests.nextDeadline();
+    if (nextDeadline == InFlightRequests<Res>::NO_DEADLINE)
+    {
+        return units::Duration::max();
+    }
+
+    const auto now = InFlightRequests<Res>::now();
+    return units::Duration::fromNanoseconds((nextDeadline > now) ? nextDeadline - now : 0U);
+}
+
+template <typename Req, typename Res, typename BaseClientT>
+inline bool AsyncClientImpl<Req, Res, BaseClientT>::cancel(const int64_t sequenceId) noexcept
+{
+    return m_inFlightRequests.cancel(sequenceId);
+}
+
+template <typename Req, typename Res, typename BaseClientT>
+inline uint64_t AsyncClientImpl<Req, Res, BaseClientT>::numberOfRequestsInFlight() const noexcept
+{
+    return m_inFlightRequests.size();
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_ASYNC_CLIENT_IMPL_INL
@@ -0,0 +1,195 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_POPO_AWAITABLE_CLIENT_INL
+#define IOX_POSH_POPO_AWAITABLE_CLIENT_INL
+
+#include "iceoryx_posh/popo/awaitable_client.hpp"
+
+namespace iox
+{
+namespace popo
+{
+inline constexpr const char* asStringLiteral(const AsyncCallError value) noexcept
+{
+    switch (value)
+    {
+    case AsyncCallError::TOO_MANY_REQUESTS_IN_FLIGHT:
+        return "AsyncCallError::TOO_MANY_REQUESTS_IN_FLIGHT";
+    case AsyncCallError::NO_CONNECT_REQUESTED:
+        return "AsyncCallError::NO_CONNECT_REQUESTED";
+    case AsyncCallError::SERVER_NOT_AVAILABLE:
+        return "AsyncCallError::SERVER_NOT_AVAILABLE";
+    case AsyncCallError::INVALID_REQUEST:
+        return "AsyncCallError::INVALID_REQUEST";
+    case AsyncCallError::TIMED_OUT:
+        return "AsyncCallError::TIMED_OUT";
+    case AsyncCallError::CANCELLED:
+        return "AsyncCallError::CANCELLED";
+    }
+
+    return "[Undefined AsyncCallError]";
+}
+
+inline std::ostream& operator<<(std::ostream& stream, AsyncCallError value) noexcept
+{
+    stream << asStringLiteral(value);
+    return stream;
+}
+
+inline log::LogStream& operator<<(log::LogStream& stream, AsyncCallError value) noexcept
+{
+    stream << asStringLiteral(value);
+    return stream;
+}
+
+template <typename Req, typename Res>
+inline AwaitableClient<Req, Res>::CallAwaiter::CallAwaiter(AwaitableClient& client,
+                                                           Request<Req>&& request,
+                                                           const units::Duration timeout) noexcept
+    : m_client(&client)
+    , m_request(std::move(request))
+    , m_timeout(timeout)
+{
+}
+
+template <typename Req, typename Res>
+inline AwaitableClient<Req, Res>::CallAwaiter::~CallAwaiter() noexcept
+{
+    if (m_isPending)
+    {
+        // the callback is called synchronously by cancel and must not resume the destroyed coroutine
+        m_isPending = false;
+        m_client->cancel(m_sequenceId);
+    }
+}
+
+template <typename Req, typename Res>
+inline bool AwaitableClient<Req, Res>::CallAwaiter::await_ready() const noexcept
+{
+    return false;
+}
+
+template <typename Req, typename Res>
+inline bool AwaitableClient<Req, Res>::CallAwaiter::await_suspend(std::coroutine_handle<> handle) noexcept
+{
+    m_handle = handle;
+    auto sendResult = m_client->sendAsync(
+        std::move(m_request.value()), [this](auto& result) { onResult(result); }, m_timeout);
+    m_request.reset();
+
+    if (sendResult.has_error())
+    {
+        m_result.emplace(cxx::error<AsyncCallError>(toCallError(sendResult.get_error())));
+        return false;
+    }
+
+    m_sequenceId = sendResult.value();
+    m_isPending = true;
+    return true;
+}
+
+template <typename Req, typename Res>
+inline typename AwaitableClient<Req, Res>::CallResult_t AwaitableClient<Req, Res>::CallAwaiter::await_resume() noexcept
+{
+    return std::move(m_result.value());
+}
+
+template <typename Req, typename Res>
+inline void AwaitableClient<Req, Res>::CallAwaiter::onResult(typename InFlightRequests<Res>::Result_t& result) noexcept
+{
+    if (!m_isPending)
+    {
+        return;
+    }
+    m_isPending = false;
+
+    if (result.has_error())
+    {
+        m_result.emplace(cxx::error<AsyncCallError>(toCallError(result.get_error())));
+    }
+    else
+    {
+        m_result.emplace(cxx::success<Response<const Res>>(std::move(result.value())));
+    }
+    m_client->m_scheduler.resume(m_handle);
+}
+
+template <typename Req, typename Res>
+inline AwaitableClient<Req, Res>::AwaitableClient(CoroutineScheduler& scheduler,
+                                                  const capro::ServiceDescription& service,
+                                                  const ClientOptions& clientOptions) noexcept
+    : Impl(service, clientOptions)
+    , m_scheduler(scheduler)
+{
+    // the responses are processed on every run of the scheduler to evaluate the timeouts of the calls as well; the
+    // scheduler does not wait beyond the earliest timeout
+    m_scheduler
+        .attach(
+            *this,
+            ClientEvent::RESPONSE_RECEIVED,
+            [this] { Impl::processResponses(); },
+            [this] { return Impl::timeUntilNextTimeout(); })
+        .and_then([this](auto& id) { m_attachmentId = id; })
+        .or_else([](auto& error) {
+            LogError() << "Unable to attach the AwaitableClient to the CoroutineScheduler: "
+                       << static_cast<uint64_t>(error);
+            errorHandler(PoshError::POPO__COROUTINE_SCHEDULER_UNABLE_TO_ATTACH_AWAITABLE, ErrorLevel::SEVERE);
+        });
+}
+
+template <typename Req, typename Res>
+inline AwaitableClient<Req, Res>::~AwaitableClient() noexcept
+{
+    m_scheduler.detach(*this, ClientEvent::RESPONSE_RECEIVED, m_attachmentId);
+}
+
+template <typename Req, typename Res>
+inline typename AwaitableClient<Req, Res>::CallAwaiter
+AwaitableClient<Req, Res>::call(Request<Req>&& request, const units::Duration timeout) noexcept
+{
+    return CallAwaiter(*this, std::move(request), timeout);
+}
+
+template <typename Req, typename Res>
+inline AsyncCallError AwaitableClient<Req, Res>::toCallError(const AsyncSendError error) noexcept
+{
+    switch (error)
+    {
+    case AsyncSendError::TOO_MANY_REQUESTS_IN_FLIGHT:
+        return AsyncCallError::TOO_MANY_REQUESTS_IN_FLIGHT;
+    case AsyncSendError::NO_CONNECT_REQUESTED:
+        return AsyncCallError::NO_CONNECT_REQUESTED;
+    case AsyncSendError::SERVER_NOT_AVAILABLE:
+        return AsyncCallError::SERVER_NOT_AVAILABLE;
+    case AsyncSendError::INVALID_REQUEST:
+        break;
+    }
+    return AsyncCallError::INVALID_REQUEST;
+}
+
+template <typename Req, typename Res>
+inline AsyncCallError AwaitableClient<Req, Res>::toCallError(const AsyncResponseError error) noexcept
+{
+    // a call is never PENDING when it is resumed and the request of a call is in flight until it is resumed
+    return (error == AsyncResponseError::TIMED_OUT) ? AsyncCallError::TIMED_OUT : AsyncCallError::CANCELLED;
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_AWAITABLE_CLIENT_INL
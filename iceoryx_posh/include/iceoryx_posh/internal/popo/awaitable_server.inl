@@ -0,0 +1,90 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_POPO_AWAITABLE_SERVER_INL
+#define IOX_POSH_POPO_AWAITABLE_SERVER_INL
+
+#include "iceoryx_posh/popo/awaitable_server.hpp"
+
+namespace iox
+{
+namespace popo
+{
+template <typename Req, typename Res>
+inline AwaitableServer<Req, Res>::AwaitableServer(CoroutineScheduler& scheduler,
+                                                  const capro::ServiceDescription& service,
+                                                  const ServerOptions& serverOptions) noexcept
+    : Impl(service, serverOptions)
+    , m_scheduler(scheduler)
+{
+    m_scheduler.attach(*this, ServerEvent::REQUEST_RECEIVED, [this] { onRequestReceived(); })
+        .and_then([this](auto& id) { m_attachmentId = id; })
+        .or_else([](auto& error) {
+            LogError() << "Unable to attach the AwaitableServer to the CoroutineScheduler: "
+                       << static_cast<uint64_t>(error);
+            errorHandler(PoshError::POPO__COROUTINE_SCHEDULER_UNABLE_TO_ATTACH_AWAITABLE, ErrorLevel::SEVERE);
+        });
+}
+
+template <typename Req, typename Res>
+inline AwaitableServer<Req, Res>::~AwaitableServer() noexcept
+{
+    m_scheduler.detach(*this, ServerEvent::REQUEST_RECEIVED, m_attachmentId);
+}
+
+template <typename Req, typename Res>
+inline typename AwaitableServer<Req, Res>::Awaiter_t AwaitableServer<Req, Res>::nextRequest() noexcept
+{
+    return Awaiter_t(*this);
+}
+
+template <typename Req, typename Res>
+inline bool AwaitableServer<Req, Res>::isEmpty(const TakeResult_t& result) noexcept
+{
+    return result.has_error()
+           && (result.get_error() == ServerRequestResult::NO_PENDING_REQUESTS
+               || result.get_error() == ServerRequestResult::NO_PENDING_REQUESTS_AND_SERVER_DOES_NOT_OFFER);
+}
+
+template <typename Req, typename Res>
+inline void AwaitableServer<Req, Res>::setAwaiter(Awaiter_t* awaiter) noexcept
+{
+    cxx::Expects(m_awaiter == nullptr && "only one coroutine can await the AwaitableServer at a time");
+    m_awaiter = awaiter;
+}
+
+template <typename Req, typename Res>
+inline void AwaitableServer<Req, Res>::onRequestReceived() noexcept
+{
+    if (m_awaiter == nullptr)
+    {
+        // the requests are taken by the next call of nextRequest()
+        return;
+    }
+
+    auto handle = m_awaiter->tryTake();
+    if (handle)
+    {
+        m_awaiter = nullptr;
+        m_scheduler.resume(handle);
+    }
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_AWAITABLE_SERVER_INL
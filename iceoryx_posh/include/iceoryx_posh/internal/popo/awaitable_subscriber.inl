@@ -0,0 +1,88 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_POPO_AWAITABLE_SUBSCRIBER_INL
+#define IOX_POSH_POPO_AWAITABLE_SUBSCRIBER_INL
+
+#include "iceoryx_posh/popo/awaitable_subscriber.hpp"
+
+namespace iox
+{
+namespace popo
+{
+template <typename T, typename H>
+inline AwaitableSubscriber<T, H>::AwaitableSubscriber(CoroutineScheduler& scheduler,
+                                                      const capro::ServiceDescription& service,
+                                                      const SubscriberOptions& subscriberOptions) noexcept
+    : Impl(service, subscriberOptions)
+    , m_scheduler(scheduler)
+{
+    m_scheduler.attach(*this, SubscriberEvent::DATA_RECEIVED, [this] { onDataReceived(); })
+        .and_then([this](auto& id) { m_attachmentId = id; })
+        .or_else([](auto& error) {
+            LogError() << "Unable to attach the AwaitableSubscriber to the CoroutineScheduler: "
+                       << static_cast<uint64_t>(error);
+            errorHandler(PoshError::POPO__COROUTINE_SCHEDULER_UNABLE_TO_ATTACH_AWAITABLE, ErrorLevel::SEVERE);
+        });
+}
+
+template <typename T, typename H>
+inline AwaitableSubscriber<T, H>::~AwaitableSubscriber() noexcept
+{
+    m_scheduler.detach(*this, SubscriberEvent::DATA_RECEIVED, m_attachmentId);
+}
+
+template <typename T, typename H>
+inline typename AwaitableSubscriber<T, H>::Awaiter_t AwaitableSubscriber<T, H>::next() noexcept
+{
+    return Awaiter_t(*this);
+}
+
+template <typename T, typename H>
+inline bool AwaitableSubscriber<T, H>::isEmpty(const TakeResult_t& result) noexcept
+{
+    return result.has_error() && result.get_error() == ChunkReceiveResult::NO_CHUNK_AVAILABLE;
+}
+
+template <typename T, typename H>
+inline void AwaitableSubscriber<T, H>::setAwaiter(Awaiter_t* awaiter) noexcept
+{
+    cxx::Expects(m_awaiter == nullptr && "only one coroutine can await the AwaitableSubscriber at a time");
+    m_awaiter = awaiter;
+}
+
+template <typename T, typename H>
+inline void AwaitableSubscriber<T, H>::onDataReceived() noexcept
+{
+    if (m_awaiter == nullptr)
+    {
+        // the samples are taken by the next call of next()
+        return;
+    }
+
+    auto handle = m_awaiter->tryTake();
+    if (handle)
+    {
+        m_awaiter = nullptr;
+        m_scheduler.resume(handle);
+    }
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_AWAITABLE_SUBSCRIBER_INL
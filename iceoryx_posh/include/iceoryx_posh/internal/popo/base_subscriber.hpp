@@ -102,6 +102,10 @@ class BaseSubscriber
     /// @brief Releases any unread queued data.
     void releaseQueuedData() noexcept;
 
+    /// @brief Releases the data in the window of the latest samples, see SubscriberOptions::windowSize.
+    /// @return false if the window is still in use by a SampleWindow, then nothing is released
+    bool releaseWindow() noexcept;
+
     friend class NotificationAttorney;
     friend class iox::runtime::ServiceDiscovery;
 
@@ -124,6 +128,10 @@ class BaseSubscriber
     /// port
     cxx::expected<const mepoo::ChunkHeader*, ChunkReceiveResult> takeChunk() noexcept;
 
+    /// @brief moves the received chunks into the window of the latest chunks
+    /// @return the window of the latest chunks
+    const SubscriberPortData::ChunkWindow_t& updateWindow() noexcept;
+
     void invalidateTrigger(const uint64_t trigger) noexcept;
 
     /// @brief Only usable by the WaitSet, not for public use. Attaches the triggerHandle to the internal trigger.
@@ -163,6 +171,8 @@ class BaseSubscriber
   protected:
     port_t m_port{nullptr};
     TriggerHandle m_trigger;
+    /// @brief set while a SampleWindow refers to the window of the latest chunks
+    bool m_isWindowInUse{false};
 };
 
 } // namespace popo
@@ -93,12 +93,30 @@ inline cxx::expected<const mepoo::ChunkHeader*, ChunkReceiveResult> BaseSubscrib
     return m_port.tryGetChunk();
 }
 
+template <typename port_t>
+inline const SubscriberPortData::ChunkWindow_t& BaseSubscriber<port_t>::updateWindow() noexcept
+{
+    m_port.updateWindow();
+    return m_port.getWindow();
+}
+
 template <typename port_t>
 inline void BaseSubscriber<port_t>::releaseQueuedData() noexcept
 {
     m_port.releaseQueuedChunks();
 }
 
+template <typename port_t>
+inline bool BaseSubscriber<port_t>::releaseWindow() noexcept
+{
+    if (m_isWindowInUse)
+    {
+        return false;
+    }
+    m_port.releaseWindow();
+    return true;
+}
+
 template <typename port_t>
 inline void BaseSubscriber<port_t>::invalidateTrigger(const uint64_t uniqueTriggerId) noexcept
 {
@@ -17,6 +17,7 @@
 #ifndef IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_DISTRIBUTOR_HPP
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_DISTRIBUTOR_HPP
 
+#include "iceoryx_hoofs/cxx/generic_raii.hpp"
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_hoofs/internal/cxx/adaptive_wait.hpp"
 #include "iceoryx_hoofs/internal/cxx/unique_id.hpp"
@@ -59,6 +60,13 @@ enum class ChunkDistributorError
 /// container to cleanup could be in an inconsistent state as the application was hard terminated while changing it.
 /// We would need a container like the UsedChunkList to have one that is robust against such inconsistencies....
 /// A perfect job for our future selves
+///
+/// Single consumer fast path:
+/// When there is exactly one queue, no history and the delivery does not block, the chunks are delivered without the
+/// lock. The sender enters the FastPathGate instead, which is closed by every call that changes the stored queues and
+/// opened again when the ChunkDistributor is still a 1:1 connection. A second queue therefore transparently switches
+/// back to the locked delivery. A sender which terminated inside of the gate is handled by RouDi, which closes the
+/// gate with closeAbandonedFastPath before the port of the terminated process is shut down.
 template <typename ChunkDistributorDataType>
 class ChunkDistributor
 {
@@ -102,6 +110,25 @@ class ChunkDistributor
     /// @return the number of queues the chunk was delivered to
     uint64_t deliverToAllStoredQueues(mepoo::SharedChunk chunk) noexcept;
 
+    /// @brief Like deliverToAllStoredQueues but the ConsumerTooSlowPolicy and the history capacity are taken from the
+    /// PortPolicy at compile time, the corresponding runtime checks are omitted
+    /// @tparam PortPolicy provides SUBSCRIBER_TOO_SLOW_POLICY and HISTORY_CAPACITY which must match the
+    /// ChunkDistributorData
+    /// @param[in] chunk is the SharedChunk to be delivered
+    /// @return the number of queues the chunk was delivered to
+    template <typename PortPolicy>
+    uint64_t deliverToAllStoredQueues(mepoo::SharedChunk chunk) noexcept;
+
+    /// @brief Deliver multiple shared chunks to all the stored chunk queues. The stored queues are locked once and
+    /// every queue is notified once after it received all chunks. The chunks will be added to the chunk history
+    /// @param[in] chunks array of the SharedChunks to be delivered, they are delivered in the order of the array
+    /// @param[in] numberOfChunks the number of elements in chunks
+    /// @return the number of deliveries, i.e. the number of queues each chunk was delivered to, summed up
+    /// @note With ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER the chunks are delivered one by one like with
+    /// deliverToAllStoredQueues, a blocked producer has to notify the consumer about the chunks it delivered so far
+    uint64_t deliverMultipleToAllStoredQueues(const mepoo::SharedChunk* const chunks,
+                                              const uint64_t numberOfChunks) noexcept;
+
     /// @brief Deliver the provided shared chunk to the chunk queue with the provided ID. The chunk will NOT be added
     /// to the chunk history
     /// @param[in] uniqueQueueId is an unique ID which identifies the queue to which this chunk shall be delivered
@@ -139,6 +166,16 @@ class ChunkDistributor
     /// @brief cleanup the used shrared memory chunks
     void cleanup() noexcept;
 
+    /// @brief Get the information whether the chunks are delivered via the single consumer fast path
+    /// @return true if the fast path is active, false if the chunks are delivered with the lock
+    bool isFastPathActive() const noexcept;
+
+    /// @brief Closes the fast path without waiting for the sender, which never leaves it when it terminated while
+    /// delivering a chunk
+    /// @attention Contract is that the sending process does not use the ChunkDistributor anymore, e.g. RouDi calls
+    /// this before the port of a terminated process is shut down
+    void closeAbandonedFastPath() noexcept;
+
   protected:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
@@ -146,6 +183,19 @@ class ChunkDistributor
     bool pushToQueue(cxx::not_null<ChunkQueueData_t* const> queue, mepoo::SharedChunk chunk) noexcept;
 
   private:
+    /// @brief opens the fast path gate when the stored queues allow a lock-free delivery; must be called with the
+    /// lock held and the gate closed
+    void openFastPathIfPossible() noexcept;
+
+    /// @brief delivers the chunk to the single stored queue without the lock
+    /// @return false when the fast path is not active and the chunk was not delivered
+    bool tryDeliverViaFastPath(mepoo::SharedChunk chunk) noexcept;
+
+    /// @brief pushes all chunks to the queue and notifies it once afterwards
+    void pushMultipleToQueue(cxx::not_null<ChunkQueueData_t* const> queue,
+                             const mepoo::SharedChunk* const chunks,
+                             const uint64_t numberOfChunks) noexcept;
+
     MemberType_t* m_chunkDistrubutorDataPtr{nullptr};
 };
 
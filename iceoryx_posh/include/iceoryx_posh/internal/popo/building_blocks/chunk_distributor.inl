@@ -50,6 +50,9 @@ ChunkDistributor<ChunkDistributorDataType>::tryAddQueue(cxx::not_null<ChunkQueue
                                                         const uint64_t requestedHistory) noexcept
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
+    // the fast path must not deliver while the queues are changed
+    cxx::GenericRAII fastPathGuard([&] { getMembers()->m_fastPathGate.close(); },
+                                   [&] { openFastPathIfPossible(); });
 
     const auto alreadyKnownReceiver =
         std::find_if(getMembers()->m_queues.begin(),
@@ -101,6 +104,9 @@ inline cxx::expected<ChunkDistributorError> ChunkDistributor<ChunkDistributorDat
     cxx::not_null<ChunkQueueData_t* const> queueToRemove) noexcept
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
+    // the fast path must not deliver while the queues are changed
+    cxx::GenericRAII fastPathGuard([&] { getMembers()->m_fastPathGate.close(); },
+                                   [&] { openFastPathIfPossible(); });
 
     const auto iter = std::find(getMembers()->m_queues.begin(), getMembers()->m_queues.end(), queueToRemove);
     if (iter != getMembers()->m_queues.end())
@@ -120,6 +126,7 @@ template <typename ChunkDistributorDataType>
 inline void ChunkDistributor<ChunkDistributorDataType>::removeAllQueues() noexcept
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
+    getMembers()->m_fastPathGate.close();
 
     getMembers()->m_queues.clear();
 }
@@ -135,6 +142,11 @@ inline bool ChunkDistributor<ChunkDistributorDataType>::hasStoredQueues() const
 template <typename ChunkDistributorDataType>
 inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQueues(mepoo::SharedChunk chunk) noexcept
 {
+    if (tryDeliverViaFastPath(chunk))
+    {
+        return 1U;
+    }
+
     uint64_t numberOfQueuesTheChunkWasDeliveredTo{0U};
     typename ChunkDistributorDataType::QueueContainer_t remainingQueues;
     {
@@ -215,6 +227,99 @@ inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQu
     return numberOfQueuesTheChunkWasDeliveredTo;
 }
 
+template <typename ChunkDistributorDataType>
+template <typename PortPolicy>
+inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQueues(mepoo::SharedChunk chunk) noexcept
+{
+    // the blocking delivery depends on the QueueFullPolicy of each queue which is only known at runtime
+    if (PortPolicy::SUBSCRIBER_TOO_SLOW_POLICY == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER)
+    {
+        return deliverToAllStoredQueues(chunk);
+    }
+
+    if (PortPolicy::HISTORY_CAPACITY == 0U && tryDeliverViaFastPath(chunk))
+    {
+        return 1U;
+    }
+
+    uint64_t numberOfQueuesTheChunkWasDeliveredTo{0U};
+    typename MemberType_t::LockGuard_t lock(*getMembers());
+
+    for (auto& queue : getMembers()->m_queues)
+    {
+        if (!pushToQueue(queue.get(), chunk))
+        {
+            ChunkQueuePusher_t(queue.get()).lostAChunk();
+        }
+        ++numberOfQueuesTheChunkWasDeliveredTo;
+    }
+
+    if (PortPolicy::HISTORY_CAPACITY > 0U)
+    {
+        addToHistoryWithoutDelivery(chunk);
+    }
+
+    return numberOfQueuesTheChunkWasDeliveredTo;
+}
+
+template <typename ChunkDistributorDataType>
+inline uint64_t
+ChunkDistributor<ChunkDistributorDataType>::deliverMultipleToAllStoredQueues(const mepoo::SharedChunk* const chunks,
+                                                                             const uint64_t numberOfChunks) noexcept
+{
+    if (getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER)
+    {
+        uint64_t numberOfDeliveries{0U};
+        for (uint64_t i = 0U; i < numberOfChunks; ++i)
+        {
+            numberOfDeliveries += deliverToAllStoredQueues(chunks[i]);
+        }
+        return numberOfDeliveries;
+    }
+
+    if (getMembers()->m_fastPathGate.tryEnter())
+    {
+        // the stored queues are only changed while the gate is closed
+        pushMultipleToQueue(getMembers()->m_queues.front().get(), chunks, numberOfChunks);
+        getMembers()->m_fastPathGate.leave();
+        return numberOfChunks;
+    }
+
+    uint64_t numberOfDeliveries{0U};
+    {
+        typename MemberType_t::LockGuard_t lock(*getMembers());
+        for (auto& queue : getMembers()->m_queues)
+        {
+            pushMultipleToQueue(queue.get(), chunks, numberOfChunks);
+            numberOfDeliveries += numberOfChunks;
+        }
+    }
+
+    for (uint64_t i = 0U; i < numberOfChunks; ++i)
+    {
+        addToHistoryWithoutDelivery(chunks[i]);
+    }
+
+    return numberOfDeliveries;
+}
+
+template <typename ChunkDistributorDataType>
+inline void
+ChunkDistributor<ChunkDistributorDataType>::pushMultipleToQueue(cxx::not_null<ChunkQueueData_t* const> queue,
+                                                                const mepoo::SharedChunk* const chunks,
+                                                                const uint64_t numberOfChunks) noexcept
+{
+    ChunkQueuePusher_t pusher(queue);
+    for (uint64_t i = 0U; i < numberOfChunks; ++i)
+    {
+        if (!pusher.pushWithoutNotification(chunks[i]))
+        {
+            pusher.lostAChunk();
+        }
+    }
+    pusher.notify(numberOfChunks);
+}
+
 template <typename ChunkDistributorDataType>
 inline bool ChunkDistributor<ChunkDistributorDataType>::pushToQueue(cxx::not_null<ChunkQueueData_t* const> queue,
                                                                     mepoo::SharedChunk chunk) noexcept
@@ -222,6 +327,56 @@ inline bool ChunkDistributor<ChunkDistributorDataType>::pushToQueue(cxx::not_nul
     return ChunkQueuePusher_t(queue).push(chunk);
 }
 
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::openFastPathIfPossible() noexcept
+{
+    auto& queues = getMembers()->m_queues;
+    if (queues.size() != 1U || getMembers()->m_historyCapacity != 0U)
+    {
+        return;
+    }
+
+    // a blocking delivery has to release the lock while waiting for the consumer
+    bool willWaitForConsumer = getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    if (willWaitForConsumer && queues.front()->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER)
+    {
+        return;
+    }
+
+    getMembers()->m_fastPathGate.open();
+}
+
+template <typename ChunkDistributorDataType>
+inline bool ChunkDistributor<ChunkDistributorDataType>::tryDeliverViaFastPath(mepoo::SharedChunk chunk) noexcept
+{
+    if (!getMembers()->m_fastPathGate.tryEnter())
+    {
+        return false;
+    }
+
+    // the stored queues are only changed while the gate is closed
+    auto queue = getMembers()->m_queues.front().get();
+    if (!pushToQueue(queue, chunk))
+    {
+        ChunkQueuePusher_t(queue).lostAChunk();
+    }
+
+    getMembers()->m_fastPathGate.leave();
+    return true;
+}
+
+template <typename ChunkDistributorDataType>
+inline bool ChunkDistributor<ChunkDistributorDataType>::isFastPathActive() const noexcept
+{
+    return getMembers()->m_fastPathGate.isOpen();
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::closeAbandonedFastPath() noexcept
+{
+    getMembers()->m_fastPathGate.closeAbandoned();
+}
+
 template <typename ChunkDistributorDataType>
 inline cxx::expected<ChunkDistributorError>
 ChunkDistributor<ChunkDistributorDataType>::deliverToQueue(const cxx::UniqueId uniqueQueueId,
@@ -246,6 +401,9 @@ ChunkDistributor<ChunkDistributorDataType>::deliverToQueue(const cxx::UniqueId u
 
         bool isBlockingQueue = (willWaitForConsumer && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER);
 
+        // the fast path pushes without the lock, the gate must be entered to not push concurrently to the queue
+        const bool isFastPathEntered = getMembers()->m_fastPathGate.tryEnter();
+
         retry = false;
         if (!pushToQueue(queue.get(), chunk))
         {
@@ -258,6 +416,11 @@ ChunkDistributor<ChunkDistributorDataType>::deliverToQueue(const cxx::UniqueId u
                 ChunkQueuePusher_t(queue.get()).lostAChunk();
             }
         }
+
+        if (isFastPathEntered)
+        {
+            getMembers()->m_fastPathGate.leave();
+        }
     } while (retry);
 
     return cxx::success<>();
@@ -338,17 +501,17 @@ inline void ChunkDistributor<ChunkDistributorDataType>::clearHistory() noexcept
 template <typename ChunkDistributorDataType>
 inline void ChunkDistributor<ChunkDistributorDataType>::cleanup() noexcept
 {
-    if (getMembers()->tryLock())
+    // a lock which is held by a terminated process is taken over, the lock of a process which still exists, e.g. after
+    // its keep alive expired, is not; the history only contains chunk references which can be released
+    if (getMembers()->tryLockOrRecoverFromDeadOwner())
     {
         clearHistory();
         getMembers()->unlock();
     }
     else
     {
-        /// @todo currently we have a deadlock / mutex destroy vulnerability if the ThreadSafePolicy is used
-        /// and a sending application dies when having the lock for sending. If the RouDi daemon wants to
-        /// cleanup or does discovery changes we have a deadlock or an exception when destroying the mutex
-        /// As long as we don't have a multi-threaded lock-free ChunkDistributor or another concept we die here
+        /// @todo the lock is held by a living process, e.g. the sending application still publishes while RouDi
+        /// wants to cleanup; as long as we don't have a multi-threaded lock-free ChunkDistributor we die here
         errorHandler(PoshError::POPO__CHUNK_DISTRIBUTOR_CLEANUP_DEADLOCK_BECAUSE_BAD_APPLICATION_TERMINATION,
                      ErrorLevel::FATAL);
     }
@@ -26,6 +26,7 @@
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/fast_path_gate.hpp"
 #include "iceoryx_posh/popo/port_queue_policies.hpp"
 
 #include <cstdint>
@@ -60,6 +61,10 @@ struct ChunkDistributorData : public LockingPolicy
         cxx::vector<mepoo::ShmSafeUnmanagedChunk, ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY>;
     HistoryContainer_t m_history;
     const ConsumerTooSlowPolicy m_consumerTooSlowPolicy;
+
+    /// @brief open while there is exactly one queue, no history and no blocking delivery; the chunks are then
+    /// delivered without the lock and m_queues must only be changed while the gate is closed
+    FastPathGate m_fastPathGate;
 };
 
 } // namespace popo
@@ -48,6 +48,8 @@ struct ChunkQueueData : public LockingPolicy
     std::atomic_bool m_queueHasLostChunks{false};
 
     rp::RelativePointer<ConditionVariableData> m_conditionVariableDataPtr;
+    /// @brief mirrors m_conditionVariableDataPtr, allows the pusher to skip the lock when nobody waits for the queue
+    std::atomic_bool m_isConditionVariableSet{false};
     cxx::optional<uint64_t> m_conditionVariableNotificationIndex;
     const QueueFullPolicy m_queueFullPolicy;
 };
@@ -50,6 +50,12 @@ class ChunkQueuePopper
     /// @return optional for a shared chunk that is set if the queue is not empty
     cxx::optional<mepoo::SharedChunk> tryPop() noexcept;
 
+    /// @brief pop a chunk from the chunk queue without the runtime dispatch over the queue type
+    /// @tparam QueueType of the underlying queue, must be the type the queue was created with
+    /// @return optional for a shared chunk that is set if the queue is not empty
+    template <cxx::VariantQueueTypes QueueType>
+    cxx::optional<mepoo::SharedChunk> tryPop() noexcept;
+
     /// @brief check if chunks were lost and reset flag
     /// @return true if the underlying queue has lost chunks due to an overflow since the last call of this method
     bool hasLostChunks() noexcept;
@@ -96,6 +102,10 @@ class ChunkQueuePopper
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 
+  private:
+    cxx::optional<mepoo::SharedChunk>
+    toSharedChunk(const cxx::optional<mepoo::ShmSafeUnmanagedChunk>& maybeUnmanagedChunk) noexcept;
+
   private:
     MemberType_t* m_chunkQueueDataPtr;
 };
@@ -48,12 +48,25 @@ ChunkQueuePopper<ChunkQueueDataType>::getMembers() noexcept
 template <typename ChunkQueueDataType>
 inline cxx::optional<mepoo::SharedChunk> ChunkQueuePopper<ChunkQueueDataType>::tryPop() noexcept
 {
-    auto retVal = getMembers()->m_queue.pop();
+    return toSharedChunk(getMembers()->m_queue.pop());
+}
+
+template <typename ChunkQueueDataType>
+template <cxx::VariantQueueTypes QueueType>
+inline cxx::optional<mepoo::SharedChunk> ChunkQueuePopper<ChunkQueueDataType>::tryPop() noexcept
+{
+    return toSharedChunk(getMembers()->m_queue.template pop<QueueType>());
+}
 
+template <typename ChunkQueueDataType>
+inline cxx::optional<mepoo::SharedChunk> ChunkQueuePopper<ChunkQueueDataType>::toSharedChunk(
+    const cxx::optional<mepoo::ShmSafeUnmanagedChunk>& maybeUnmanagedChunk) noexcept
+{
     // check if queue had an element that was poped and return if so
-    if (retVal.has_value())
+    if (maybeUnmanagedChunk.has_value())
     {
-        auto chunk = retVal.value().releaseToSharedChunk();
+        auto unmanagedChunk = maybeUnmanagedChunk.value();
+        auto chunk = unmanagedChunk.releaseToSharedChunk();
 
         auto receivedChunkHeaderVersion = chunk.getChunkHeader()->chunkHeaderVersion();
         if (receivedChunkHeaderVersion != mepoo::ChunkHeader::CHUNK_HEADER_VERSION)
@@ -131,6 +144,7 @@ inline void ChunkQueuePopper<ChunkQueueDataType>::setConditionVariable(Condition
 
     getMembers()->m_conditionVariableDataPtr = &conditionVariableDataRef;
     getMembers()->m_conditionVariableNotificationIndex.emplace(notificationIndex);
+    getMembers()->m_isConditionVariableSet.store(true, std::memory_order_seq_cst);
 }
 
 template <typename ChunkQueueDataType>
@@ -138,6 +152,7 @@ inline void ChunkQueuePopper<ChunkQueueDataType>::unsetConditionVariable() noexc
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
+    getMembers()->m_isConditionVariableSet.store(false, std::memory_order_relaxed);
     getMembers()->m_conditionVariableDataPtr = nullptr;
     getMembers()->m_conditionVariableNotificationIndex.reset();
 }
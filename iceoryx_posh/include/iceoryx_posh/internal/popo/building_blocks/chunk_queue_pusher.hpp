@@ -50,6 +50,19 @@ class ChunkQueuePusher
     /// @return false if a queue overflow occurred, otherwise true
     bool push(mepoo::SharedChunk chunk) noexcept;
 
+    /// @brief push a new chunk to the chunk queue without notifying the condition variable, e.g. to deliver multiple
+    /// chunks with a single notification
+    /// @param[in] shared chunk object
+    /// @return false if a queue overflow occurred, otherwise true
+    /// @attention notify has to be called after the last chunk, otherwise a waiting consumer is not woken up
+    bool pushWithoutNotification(mepoo::SharedChunk chunk) noexcept;
+
+    /// @brief notify the condition variable of the chunk queue, if there is one, about the chunks which were pushed
+    /// with pushWithoutNotification
+    /// @param[in] numberOfPushedChunks the number of chunks pushed since the last notification, nothing is notified
+    /// when it is zero
+    void notify(const uint64_t numberOfPushedChunks) noexcept;
+
     /// @brief tell the queue that it lost a chunk (e.g. because push failed and there will be no retry)
     void lostAChunk() noexcept;
 
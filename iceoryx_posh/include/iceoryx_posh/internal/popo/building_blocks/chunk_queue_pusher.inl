@@ -17,7 +17,6 @@
 #ifndef IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_QUEUE_PUSHER_INL
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_QUEUE_PUSHER_INL
 
-
 namespace iox
 {
 namespace popo
@@ -45,6 +44,14 @@ ChunkQueuePusher<ChunkQueueDataType>::getMembers() noexcept
 
 template <typename ChunkQueueDataType>
 inline bool ChunkQueuePusher<ChunkQueueDataType>::push(mepoo::SharedChunk chunk) noexcept
+{
+    const bool hasNoQueueOverflow = pushWithoutNotification(chunk);
+    notify(1U);
+    return hasNoQueueOverflow;
+}
+
+template <typename ChunkQueueDataType>
+inline bool ChunkQueuePusher<ChunkQueueDataType>::pushWithoutNotification(mepoo::SharedChunk chunk) noexcept
 {
     auto pushRet = getMembers()->m_queue.push(chunk);
     bool hasQueueOverflow = false;
@@ -57,6 +64,21 @@ inline bool ChunkQueuePusher<ChunkQueueDataType>::push(mepoo::SharedChunk chunk)
         hasQueueOverflow = true;
     }
 
+    return !hasQueueOverflow;
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePusher<ChunkQueueDataType>::notify(const uint64_t numberOfPushedChunks) noexcept
+{
+    if (numberOfPushedChunks == 0U)
+    {
+        return;
+    }
+
+    // pairs with the store in ChunkQueuePopper::setConditionVariable; a condition variable which is set after this
+    // check is attached to a queue which already contains the chunk
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (getMembers()->m_isConditionVariableSet.load(std::memory_order_relaxed))
     {
         typename MemberType_t::LockGuard_t lock(*getMembers());
         if (getMembers()->m_conditionVariableDataPtr)
@@ -66,8 +88,6 @@ inline bool ChunkQueuePusher<ChunkQueueDataType>::push(mepoo::SharedChunk chunk)
                 .notify();
         }
     }
-
-    return !hasQueueOverflow;
 }
 
 template <typename ChunkQueueDataType>
@@ -18,6 +18,7 @@
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_RECEIVER_HPP
 
 #include "iceoryx_hoofs/cxx/expected.hpp"
+#include "iceoryx_hoofs/cxx/function_ref.hpp"
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_hoofs/cxx/optional.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_popper.hpp"
@@ -79,6 +80,24 @@ class ChunkReceiver : public ChunkQueuePopper<typename ChunkReceiverDataType::Ch
     /// or if there are no new chunks in the underlying queue
     cxx::expected<const mepoo::ChunkHeader*, ChunkReceiveResult> tryGet() noexcept;
 
+    /// @brief Like tryGet but without the runtime dispatch over the queue type
+    /// @tparam QueueType of the underlying queue, must be the type the queue was created with
+    /// @return New chunk header, ChunkReceiveResult on error
+    /// or if there are no new chunks in the underlying queue
+    template <cxx::VariantQueueTypes QueueType>
+    cxx::expected<const mepoo::ChunkHeader*, ChunkReceiveResult> tryGet() noexcept;
+
+    /// @brief Tries to get up to maxNumberOfChunks received chunks with a single call. A chunk is only taken from the
+    /// underlying queue when it can be held, if the maximum number of held chunks is reached the remaining chunks stay
+    /// in the queue instead of being dropped like with tryGet
+    /// @param[in] maxNumberOfChunks the maximum number of chunks to get
+    /// @param[in] callable which is called with the chunk header of every received chunk, the oldest chunk first
+    /// @return the number of chunks handed to the callable, ChunkReceiveResult on error if not a single chunk could be
+    /// received
+    cxx::expected<uint64_t, ChunkReceiveResult>
+    tryGetMultiple(const uint64_t maxNumberOfChunks,
+                   const cxx::function_ref<void(const mepoo::ChunkHeader*)> callable) noexcept;
+
     /// @brief Release a chunk that was obtained with get
     /// @param[in] chunkHeader, pointer to the ChunkHeader to release
     void release(const mepoo::ChunkHeader* const chunkHeader) noexcept;
@@ -91,6 +110,9 @@ class ChunkReceiver : public ChunkQueuePopper<typename ChunkReceiverDataType::Ch
   private:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
+
+    cxx::expected<const mepoo::ChunkHeader*, ChunkReceiveResult>
+    storeInChunksInUse(const cxx::optional<mepoo::SharedChunk>& maybeChunk) noexcept;
 };
 
 } // namespace popo
@@ -75,11 +75,24 @@ template <typename ChunkReceiverDataType>
 inline cxx::expected<const mepoo::ChunkHeader*, ChunkReceiveResult>
 ChunkReceiver<ChunkReceiverDataType>::tryGet() noexcept
 {
-    auto popRet = this->tryPop();
+    return storeInChunksInUse(this->tryPop());
+}
+
+template <typename ChunkReceiverDataType>
+template <cxx::VariantQueueTypes QueueType>
+inline cxx::expected<const mepoo::ChunkHeader*, ChunkReceiveResult>
+ChunkReceiver<ChunkReceiverDataType>::tryGet() noexcept
+{
+    return storeInChunksInUse(this->template tryPop<QueueType>());
+}
 
-    if (popRet.has_value())
+template <typename ChunkReceiverDataType>
+inline cxx::expected<const mepoo::ChunkHeader*, ChunkReceiveResult>
+ChunkReceiver<ChunkReceiverDataType>::storeInChunksInUse(const cxx::optional<mepoo::SharedChunk>& maybeChunk) noexcept
+{
+    if (maybeChunk.has_value())
     {
-        auto sharedChunk = *popRet;
+        auto sharedChunk = *maybeChunk;
 
         // if the application holds too many chunks, don't provide more
         if (getMembers()->m_chunksInUse.insert(sharedChunk))
@@ -97,6 +110,38 @@ ChunkReceiver<ChunkReceiverDataType>::tryGet() noexcept
     return cxx::error<ChunkReceiveResult>(ChunkReceiveResult::NO_CHUNK_AVAILABLE);
 }
 
+template <typename ChunkReceiverDataType>
+inline cxx::expected<uint64_t, ChunkReceiveResult>
+ChunkReceiver<ChunkReceiverDataType>::tryGetMultiple(
+    const uint64_t maxNumberOfChunks, const cxx::function_ref<void(const mepoo::ChunkHeader*)> callable) noexcept
+{
+    auto& chunksInUse = getMembers()->m_chunksInUse;
+    uint64_t numberOfChunks{0U};
+    while (numberOfChunks < maxNumberOfChunks && chunksInUse.hasFreeSpace())
+    {
+        auto maybeChunk = this->tryPop();
+        if (!maybeChunk.has_value())
+        {
+            break;
+        }
+
+        // cannot fail since there is free space and only the runtime inserts chunks
+        cxx::Ensures(chunksInUse.insert(*maybeChunk));
+        callable(maybeChunk->getChunkHeader());
+        ++numberOfChunks;
+    }
+
+    if (numberOfChunks == 0U && maxNumberOfChunks > 0U)
+    {
+        if (!chunksInUse.hasFreeSpace() && !this->empty())
+        {
+            return cxx::error<ChunkReceiveResult>(ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL);
+        }
+        return cxx::error<ChunkReceiveResult>(ChunkReceiveResult::NO_CHUNK_AVAILABLE);
+    }
+    return cxx::success<uint64_t>(numberOfChunks);
+}
+
 template <typename ChunkReceiverDataType>
 inline void ChunkReceiver<ChunkReceiverDataType>::release(const mepoo::ChunkHeader* const chunkHeader) noexcept
 {
@@ -20,6 +20,7 @@
 #include "iceoryx_hoofs/cxx/expected.hpp"
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_hoofs/internal/cxx/unique_id.hpp"
 #include "iceoryx_posh/error_handling/error_handling.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
@@ -27,6 +28,7 @@
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_sender_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/unique_port_id.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/mepoo/multi_chunk_table.hpp"
 
 namespace iox
 {
@@ -40,6 +42,7 @@ enum class AllocationError
     TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL,
     INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER,
     INVALID_PARAMETER_FOR_REQUEST_HEADER,
+    CHUNK_QUOTA_EXCEEDED,
 };
 } // namespace popo
 
@@ -106,6 +109,24 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
                                                                     const uint32_t userHeaderSize,
                                                                     const uint32_t userHeaderAlignment) noexcept;
 
+    /// @brief Allocate a multi-chunk sample. The head chunk contains a MultiChunkTable as user-payload and every part
+    /// is a chunk of its own from the best fitting mempool. The parts are chained to the head chunk and released together
+    /// with it, i.e. the head chunk is used like any other chunk to send or release the multi-chunk sample.
+    /// @param[in] originId, the unique id of the entity which requested this allocate
+    /// @param[in] partSizes, the user-payload sizes of the parts
+    /// @param[in] partAlignment, alignment of the user-payload of the parts
+    /// @param[in] userHeaderSize, size of the user-header of the head chunk; use iox::CHUNK_NO_USER_HEADER_SIZE to
+    /// omit a user-header
+    /// @param[in] userHeaderAlignment, alignment of the user-header of the head chunk; use
+    /// iox::CHUNK_NO_USER_HEADER_ALIGNMENT to omit a user-header
+    /// @return on success pointer to the ChunkHeader of the head chunk, error if not
+    cxx::expected<mepoo::ChunkHeader*, AllocationError>
+    tryAllocateMultiChunk(const UniquePortId originId,
+                          const mepoo::MultiChunkTable::PartSizes_t& partSizes,
+                          const uint32_t partAlignment,
+                          const uint32_t userHeaderSize,
+                          const uint32_t userHeaderAlignment) noexcept;
+
     /// @brief Release an allocated chunk without sending it
     /// @param[in] chunkHeader, pointer to the ChunkHeader to release
     void release(const mepoo::ChunkHeader* const chunkHeader) noexcept;
@@ -116,6 +137,24 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
     /// @return the number of receiver the chunk was send to
     uint64_t send(mepoo::ChunkHeader* const chunkHeader) noexcept;
 
+    /// @brief Like send but the ConsumerTooSlowPolicy and the history capacity are taken from the PortPolicy at
+    /// compile time
+    /// @tparam PortPolicy provides SUBSCRIBER_TOO_SLOW_POLICY and HISTORY_CAPACITY which must match the ChunkSenderData
+    /// @param[in] chunkHeader, pointer to the ChunkHeader to send; the ownership of the pointer is transferred to this
+    /// method
+    /// @return the number of receiver the chunk was send to
+    template <typename PortPolicy>
+    uint64_t send(mepoo::ChunkHeader* const chunkHeader) noexcept;
+
+    /// @brief Send multiple allocated chunks to all connected ChunkQueuePopper, every queue is notified once after it
+    /// received the last chunk
+    /// @param[in] chunkHeaders array of pointers to the ChunkHeaders to send in the order of the array; the ownership
+    /// of the pointers is transferred to this method
+    /// @param[in] numberOfChunks the number of elements in chunkHeaders, must not exceed the number of chunks which can
+    /// be allocated simultaneously
+    /// @return the number of deliveries, i.e. the number of receivers each chunk was send to, summed up
+    uint64_t sendMultiple(mepoo::ChunkHeader* const* const chunkHeaders, const uint64_t numberOfChunks) noexcept;
+
     /// @brief Send an allocated chunk to a specific ChunkQueuePopper
     /// @param[in] chunkHeader, pointer to the ChunkHeader to send; the ownership of the pointer is transferred to this
     /// method
@@ -145,8 +184,15 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
     /// @param[in] chunkHeader of the chunk that shall be send
     /// @param[in][out] chunk that corresponds to the chunk header
     /// @return true if there was a matching chunk with this header, false if not
+    /// @note the reference of chunk is marked with the origin of the chunk as owner, the caller must call resetOwner
+    /// when the chunk is delivered
     bool getChunkReadyForSend(const mepoo::ChunkHeader* const chunkHeader, mepoo::SharedChunk& chunk) noexcept;
 
+    /// @brief allocates a chunk with the provided settings and stores it in the chunks in use
+    /// @return the SharedChunk which is also stored in the chunks in use
+    cxx::expected<mepoo::SharedChunk, AllocationError>
+    allocateChunk(const UniquePortId originId, const mepoo::ChunkSettings& chunkSettings) noexcept;
+
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 };
@@ -35,6 +35,8 @@ from<mepoo::MemoryManager::Error, popo::AllocationError>(const mepoo::MemoryMana
         return popo::AllocationError::NO_MEMPOOLS_AVAILABLE;
     case mepoo::MemoryManager::Error::MEMPOOL_OUT_OF_CHUNKS:
         return popo::AllocationError::RUNNING_OUT_OF_CHUNKS;
+    case mepoo::MemoryManager::Error::CHUNK_QUOTA_EXCEEDED:
+        return popo::AllocationError::CHUNK_QUOTA_EXCEEDED;
     }
     return popo::AllocationError::UNDEFINED_ERROR;
 }
@@ -58,6 +60,8 @@ inline constexpr const char* asStringLiteral(const AllocationError value) noexce
         return "AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER";
     case AllocationError::INVALID_PARAMETER_FOR_REQUEST_HEADER:
         return "AllocationError::INVALID_PARAMETER_FOR_REQUEST_HEADER";
+    case AllocationError::CHUNK_QUOTA_EXCEEDED:
+        return "AllocationError::CHUNK_QUOTA_EXCEEDED";
     }
 
     return "[Undefined AllocationError]";
@@ -102,10 +106,6 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
                                               const uint32_t userHeaderSize,
                                               const uint32_t userHeaderAlignment) noexcept
 {
-    // use the chunk stored in m_lastChunkUnmanaged if:
-    //   - there is a valid chunk
-    //   - there is no other owner
-    //   - the new user-payload still fits in it
     const auto chunkSettingsResult =
         mepoo::ChunkSettings::create(userPayloadSize, userPayloadAlignment, userHeaderSize, userHeaderAlignment);
     if (chunkSettingsResult.has_error())
@@ -113,7 +113,79 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
         return cxx::error<AllocationError>(AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER);
     }
 
-    const auto& chunkSettings = chunkSettingsResult.value();
+    auto allocationResult = allocateChunk(originId, chunkSettingsResult.value());
+    if (allocationResult.has_error())
+    {
+        return cxx::error<AllocationError>(allocationResult.get_error());
+    }
+    return cxx::success<mepoo::ChunkHeader*>(allocationResult.value().getChunkHeader());
+}
+
+template <typename ChunkSenderDataType>
+inline cxx::expected<mepoo::ChunkHeader*, AllocationError>
+ChunkSender<ChunkSenderDataType>::tryAllocateMultiChunk(const UniquePortId originId,
+                                                        const mepoo::MultiChunkTable::PartSizes_t& partSizes,
+                                                        const uint32_t partAlignment,
+                                                        const uint32_t userHeaderSize,
+                                                        const uint32_t userHeaderAlignment) noexcept
+{
+    // all settings are checked before anything is allocated
+    cxx::vector<mepoo::ChunkSettings, mepoo::MultiChunkTable::MAX_NUMBER_OF_PARTS> partSettings;
+    for (const auto partSize : partSizes)
+    {
+        const auto chunkSettingsResult = mepoo::ChunkSettings::create(partSize, partAlignment);
+        if (chunkSettingsResult.has_error())
+        {
+            return cxx::error<AllocationError>(AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER);
+        }
+        partSettings.emplace_back(chunkSettingsResult.value());
+    }
+    const auto headChunkSettingsResult = mepoo::ChunkSettings::create(
+        sizeof(mepoo::MultiChunkTable), alignof(mepoo::MultiChunkTable), userHeaderSize, userHeaderAlignment);
+    if (headChunkSettingsResult.has_error())
+    {
+        return cxx::error<AllocationError>(AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER);
+    }
+
+    // the head chunk is stored in the chunks in use first, the parts which are chained to it are released with it
+    // when the process terminates
+    auto allocationResult = allocateChunk(originId, headChunkSettingsResult.value());
+    if (allocationResult.has_error())
+    {
+        return cxx::error<AllocationError>(allocationResult.get_error());
+    }
+    auto& headChunk = allocationResult.value();
+    headChunk.getChunkHeader()->setMultiChunk();
+    auto multiChunkTable = new (headChunk.getUserPayload()) mepoo::MultiChunkTable();
+
+    for (const auto& chunkSettings : partSettings)
+    {
+        auto getChunkResult = getMembers()->m_memoryMgr->getChunk(chunkSettings, getMembers()->m_chunkQuota.get());
+        if (getChunkResult.has_error())
+        {
+            release(headChunk.getChunkHeader());
+            /// @todo iox-#1012 use cxx::error<E2>::from(E1); once available
+            return cxx::error<AllocationError>(cxx::into<AllocationError>(getChunkResult.get_error()));
+        }
+
+        auto& partChunk = getChunkResult.value();
+        partChunk.getChunkHeader()->setOriginId(originId);
+        multiChunkTable->addPart(partChunk.getUserPayload(), chunkSettings.userPayloadSize());
+        headChunk.addPart(std::move(partChunk));
+    }
+
+    return cxx::success<mepoo::ChunkHeader*>(headChunk.getChunkHeader());
+}
+
+template <typename ChunkSenderDataType>
+inline cxx::expected<mepoo::SharedChunk, AllocationError>
+ChunkSender<ChunkSenderDataType>::allocateChunk(const UniquePortId originId,
+                                                const mepoo::ChunkSettings& chunkSettings) noexcept
+{
+    // use the chunk stored in m_lastChunkUnmanaged if:
+    //   - there is a valid chunk
+    //   - there is no other owner
+    //   - the new user-payload still fits in it
     const uint32_t requiredChunkSize = chunkSettings.requiredChunkSize();
 
     auto& lastChunkUnmanaged = getMembers()->m_lastChunkUnmanaged;
@@ -123,12 +195,22 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
     if (lastChunkChunkHeader && (lastChunkChunkHeader->chunkSize() >= requiredChunkSize))
     {
         auto sharedChunk = lastChunkUnmanaged.cloneToSharedChunk();
-        if (getMembers()->m_chunksInUse.insert(sharedChunk))
+        sharedChunk.setOwner(originId);
+        const bool isChunkInUse = getMembers()->m_chunksInUse.insert(sharedChunk);
+        sharedChunk.resetOwner();
+        if (isChunkInUse)
         {
+            // the parts of a reused multi-chunk sample are not used anymore
+            if (sharedChunk.hasParts())
+            {
+                sharedChunk.releaseParts();
+            }
             auto chunkSize = lastChunkChunkHeader->chunkSize();
             lastChunkChunkHeader->~ChunkHeader();
             new (lastChunkChunkHeader) mepoo::ChunkHeader(chunkSize, chunkSettings);
-            return cxx::success<mepoo::ChunkHeader*>(lastChunkChunkHeader);
+            lastChunkChunkHeader->setOriginId(originId);
+            getMembers()->m_memoryMgr->recordChunkRequest(chunkSettings);
+            return cxx::success<mepoo::SharedChunk>(std::move(sharedChunk));
         }
         else
         {
@@ -137,24 +219,27 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
     }
     else
     {
-        // BEGIN of critical section, chunk will be lost if the process terminates in this section
         // get a new chunk
-        auto getChunkResult = getMembers()->m_memoryMgr->getChunk(chunkSettings);
+        auto getChunkResult = getMembers()->m_memoryMgr->getChunk(chunkSettings, getMembers()->m_chunkQuota.get());
 
         if (!getChunkResult.has_error())
         {
             auto& chunk = getChunkResult.value();
+            // the owner allows RouDi to release the reference of 'chunk' if the process terminates before the chunk
+            // is stored in m_chunksInUse
+            chunk.setOwner(originId);
+            chunk.getChunkHeader()->setOriginId(originId);
 
             // if the application allocated too much chunks, return no more chunks
             if (getMembers()->m_chunksInUse.insert(chunk))
             {
-                // END of critical section
-                chunk.getChunkHeader()->setOriginId(originId);
-                return cxx::success<mepoo::ChunkHeader*>(chunk.getChunkHeader());
+                chunk.resetOwner();
+                return cxx::success<mepoo::SharedChunk>(std::move(chunk));
             }
             else
             {
                 // release the allocated chunk
+                chunk.resetOwner();
                 chunk = nullptr;
                 return cxx::error<AllocationError>(AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL);
             }
@@ -183,36 +268,89 @@ inline uint64_t ChunkSender<ChunkSenderDataType>::send(mepoo::ChunkHeader* const
 {
     uint64_t numberOfReceiverTheChunkWasDelivered{0};
     mepoo::SharedChunk chunk(nullptr);
-    // BEGIN of critical section, chunk will be lost if the process terminates in this section
+    // the reference of 'chunk' is owned by the port while it is delivered, see getChunkReadyForSend
     if (getChunkReadyForSend(chunkHeader, chunk))
     {
         numberOfReceiverTheChunkWasDelivered = this->deliverToAllStoredQueues(chunk);
 
         getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
         getMembers()->m_lastChunkUnmanaged = chunk;
+        chunk.resetOwner();
+    }
+
+    return numberOfReceiverTheChunkWasDelivered;
+}
+
+template <typename ChunkSenderDataType>
+template <typename PortPolicy>
+inline uint64_t ChunkSender<ChunkSenderDataType>::send(mepoo::ChunkHeader* const chunkHeader) noexcept
+{
+    uint64_t numberOfReceiverTheChunkWasDelivered{0};
+    mepoo::SharedChunk chunk(nullptr);
+    // the reference of 'chunk' is owned by the port while it is delivered, see getChunkReadyForSend
+    if (getChunkReadyForSend(chunkHeader, chunk))
+    {
+        numberOfReceiverTheChunkWasDelivered = this->template deliverToAllStoredQueues<PortPolicy>(chunk);
+
+        getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
+        getMembers()->m_lastChunkUnmanaged = chunk;
+        chunk.resetOwner();
     }
-    // END of critical section
 
     return numberOfReceiverTheChunkWasDelivered;
 }
 
+template <typename ChunkSenderDataType>
+inline uint64_t ChunkSender<ChunkSenderDataType>::sendMultiple(mepoo::ChunkHeader* const* const chunkHeaders,
+                                                               const uint64_t numberOfChunks) noexcept
+{
+    cxx::Expects(numberOfChunks <= ChunkSenderDataType::MAX_CHUNKS_ALLOCATED_SIMULTANEOUSLY);
+
+    cxx::vector<mepoo::SharedChunk, ChunkSenderDataType::MAX_CHUNKS_ALLOCATED_SIMULTANEOUSLY> chunks;
+    for (uint64_t i = 0U; i < numberOfChunks; ++i)
+    {
+        mepoo::SharedChunk chunk(nullptr);
+        // the references of 'chunks' are owned by the port while they are delivered, see getChunkReadyForSend
+        if (getChunkReadyForSend(chunkHeaders[i], chunk))
+        {
+            chunks.emplace_back(std::move(chunk));
+        }
+    }
+
+    if (chunks.empty())
+    {
+        return 0U;
+    }
+
+    const auto numberOfDeliveries = this->deliverMultipleToAllStoredQueues(chunks.data(), chunks.size());
+
+    getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
+    getMembers()->m_lastChunkUnmanaged = chunks.back();
+    for (auto& chunk : chunks)
+    {
+        chunk.resetOwner();
+    }
+
+    return numberOfDeliveries;
+}
+
 template <typename ChunkSenderDataType>
 inline bool ChunkSender<ChunkSenderDataType>::sendToQueue(mepoo::ChunkHeader* const chunkHeader,
                                                           const cxx::UniqueId uniqueQueueId,
                                                           const uint32_t lastKnownQueueIndex) noexcept
 {
     mepoo::SharedChunk chunk(nullptr);
-    // BEGIN of critical section, chunk will be lost if the process terminates in this section
+    // the reference of 'chunk' is owned by the port while it is delivered, see getChunkReadyForSend
     if (getChunkReadyForSend(chunkHeader, chunk))
     {
         auto deliveryResult = this->deliverToQueue(uniqueQueueId, lastKnownQueueIndex, chunk);
 
         getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
         getMembers()->m_lastChunkUnmanaged = chunk;
+        chunk.resetOwner();
 
         return !deliveryResult.has_error();
     }
-    // END of critical section
 
     return false;
 }
@@ -221,15 +359,15 @@ template <typename ChunkSenderDataType>
 inline void ChunkSender<ChunkSenderDataType>::pushToHistory(mepoo::ChunkHeader* const chunkHeader) noexcept
 {
     mepoo::SharedChunk chunk(nullptr);
-    // BEGIN of critical section, chunk will be lost if the process terminates in this section
+    // the reference of 'chunk' is owned by the port while it is delivered, see getChunkReadyForSend
     if (getChunkReadyForSend(chunkHeader, chunk))
     {
         this->addToHistoryWithoutDelivery(chunk);
 
         getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
         getMembers()->m_lastChunkUnmanaged = chunk;
+        chunk.resetOwner();
     }
-    // END of critical section
 }
 
 template <typename ChunkSenderDataType>
@@ -259,6 +397,9 @@ inline bool ChunkSender<ChunkSenderDataType>::getChunkReadyForSend(const mepoo::
 {
     if (getMembers()->m_chunksInUse.remove(chunkHeader, chunk))
     {
+        // the chunk is neither in m_chunksInUse nor delivered; the owner allows RouDi to release the reference of
+        // 'chunk' if the process terminates before the caller calls resetOwner
+        chunk.setOwner(chunk.getChunkHeader()->originId());
         chunk.getChunkHeader()->setSequenceNumber(getMembers()->m_sequenceNumber++);
         return true;
     }
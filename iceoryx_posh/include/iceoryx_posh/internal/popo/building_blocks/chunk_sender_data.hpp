@@ -39,11 +39,15 @@ struct ChunkSenderData : public ChunkDistributorDataType
 
     using ChunkDistributorData_t = ChunkDistributorDataType;
 
+    static constexpr uint32_t MAX_CHUNKS_ALLOCATED_SIMULTANEOUSLY{MaxChunksAllocatedSimultaneously};
+
     const rp::RelativePointer<mepoo::MemoryManager> m_memoryMgr;
     mepoo::MemoryInfo m_memoryInfo;
     UsedChunkList<MaxChunksAllocatedSimultaneously> m_chunksInUse;
     mepoo::SequenceNumber_t m_sequenceNumber{0U};
     mepoo::ShmSafeUnmanagedChunk m_lastChunkUnmanaged;
+    /// @brief the quota the chunks are acquired with, nullptr if the chunks are taken from the unreserved chunks
+    rp::RelativePointer<mepoo::ChunkQuota> m_chunkQuota;
 };
 
 } // namespace popo
@@ -20,6 +20,7 @@
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
+#include "iceoryx_posh/popo/wait_strategy.hpp"
 
 namespace iox
 {
@@ -31,7 +32,10 @@ class ConditionListener
   public:
     using NotificationVector_t = cxx::vector<cxx::BestFittingType_t<MAX_NUMBER_OF_NOTIFIERS>, MAX_NUMBER_OF_NOTIFIERS>;
 
-    explicit ConditionListener(ConditionVariableData& condVarData) noexcept;
+    /// @param[in] condVarData the condition variable the listener waits on
+    /// @param[in] waitStrategy defines if and how long the listener polls for notifications before it blocks
+    explicit ConditionListener(ConditionVariableData& condVarData,
+                               const WaitStrategy& waitStrategy = WaitStrategy()) noexcept;
     ~ConditionListener() noexcept = default;
     ConditionListener(const ConditionListener& rhs) = delete;
     ConditionListener(ConditionListener&& rhs) noexcept = delete;
@@ -73,9 +77,13 @@ class ConditionListener
     void resetSemaphore() noexcept;
 
     NotificationVector_t waitImpl(const cxx::function_ref<bool()>& waitCall) noexcept;
+    /// @brief polls the notification flag according to the WaitStrategy
+    /// @return true if a notification arrived or destroy was called while polling, otherwise false
+    bool pollForNotification() noexcept;
 
   private:
     ConditionVariableData* m_condVarDataPtr{nullptr};
+    WaitStrategy m_waitStrategy;
     std::atomic_bool m_toBeDestroyed{false};
 };
 
@@ -17,6 +17,8 @@
 #ifndef IOX_POSH_POPO_BUILDING_BLOCKS_CONDITION_VARIABLE_DATA_HPP
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CONDITION_VARIABLE_DATA_HPP
 
+#include "iceoryx_hoofs/cxx/string.hpp"
+#include "iceoryx_hoofs/platform/un.hpp"
 #include "iceoryx_hoofs/posix_wrapper/unnamed_semaphore.hpp"
 #include "iceoryx_posh/error_handling/error_handling.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
@@ -27,6 +29,9 @@ namespace iox
 {
 namespace popo
 {
+/// @brief the path of a unix domain socket, see NotificationSocket
+using NotificationSocketPath_t = cxx::string<sizeof(sockaddr_un::sun_path) - 1U>;
+
 struct ConditionVariableData
 {
     ConditionVariableData() noexcept;
@@ -42,7 +47,17 @@ struct ConditionVariableData
     RuntimeName_t m_runtimeName;
     std::atomic_bool m_toBeDestroyed{false};
     std::atomic_bool m_activeNotifications[MAX_NUMBER_OF_NOTIFIERS];
+    /// @brief set by the first notify call after the listener consumed it; further notify calls do not post the
+    /// semaphore until the listener consumed the flag again. Only modified with read-modify-write operations to keep
+    /// the release sequence of the notifiers intact
     std::atomic_bool m_wasNotified{false};
+    /// @brief set while the ConditionListener polls m_wasNotified; the notifier does not need to post the semaphore
+    std::atomic_bool m_isListenerPolling{false};
+    /// @brief set while a NotificationSocket of the listening process is bound to m_notificationSocketPath; the
+    /// notifier signals the socket in addition to the semaphore
+    std::atomic_bool m_isNotificationSocketEnabled{false};
+    /// @brief only written by the listening process before m_isNotificationSocketEnabled is set
+    NotificationSocketPath_t m_notificationSocketPath;
 };
 
 } // namespace popo
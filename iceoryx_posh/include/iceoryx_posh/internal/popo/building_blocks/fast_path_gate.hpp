@@ -0,0 +1,79 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_FAST_PATH_GATE_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_FAST_PATH_GATE_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Guards the lock-free delivery of the ChunkDistributor to a single queue. The sender enters the gate with a
+///        single atomic operation instead of taking the lock of the ChunkDistributor. RouDi closes the gate before the
+///        connected queues are changed and opens it again when the distributor is still a 1:1 connection.
+///        When the sender terminated while delivering a chunk it never leaves the gate. Whether the sender is gone is
+///        known by the process monitoring of RouDi, which closes such an abandoned gate with closeAbandoned.
+/// @note the gate is placed in shared memory and contains no pointers
+class FastPathGate
+{
+  public:
+    FastPathGate() noexcept = default;
+    ~FastPathGate() noexcept = default;
+
+    FastPathGate(const FastPathGate&) = delete;
+    FastPathGate(FastPathGate&&) = delete;
+    FastPathGate& operator=(const FastPathGate&) = delete;
+    FastPathGate& operator=(FastPathGate&&) = delete;
+
+    /// @brief enters the gate; waits when another thread is inside
+    /// @return true when the gate was entered, false when the gate is closed
+    bool tryEnter() noexcept;
+
+    /// @brief leaves a previously entered gate
+    void leave() noexcept;
+
+    /// @brief closes the gate, waits until the thread which is inside has left
+    void close() noexcept;
+
+    /// @brief closes the gate without waiting for the thread which is inside
+    /// @attention must only be called when the sender does not use the gate anymore, e.g. by RouDi when the process
+    ///            of the sender terminated
+    void closeAbandoned() noexcept;
+
+    /// @brief opens a closed gate
+    void open() noexcept;
+
+    /// @brief returns true when the gate is open
+    bool isOpen() const noexcept;
+
+  private:
+    static constexpr uint32_t OPEN{0U};
+    static constexpr uint32_t CLOSED{std::numeric_limits<uint32_t>::max()};
+    static constexpr uint32_t INSIDE{1U};
+
+    /// @brief OPEN, CLOSED or INSIDE when a thread is inside
+    std::atomic<uint32_t> m_state{CLOSED};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_FAST_PATH_GATE_HPP
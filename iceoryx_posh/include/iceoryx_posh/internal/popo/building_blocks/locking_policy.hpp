@@ -16,12 +16,29 @@
 #ifndef IOX_POSH_POPO_BUILDING_BLOCKS_LOCKING_POLICY_HPP
 #define IOX_POSH_POPO_BUILDING_BLOCKS_LOCKING_POLICY_HPP
 
+#include "iceoryx_hoofs/internal/concurrent/futex_lock.hpp"
 #include "iceoryx_hoofs/internal/posix_wrapper/mutex.hpp"
+#include "iceoryx_hoofs/platform/platform_settings.hpp"
+
+#include <type_traits>
 
 namespace iox
 {
 namespace popo
 {
+namespace internal
+{
+/// @brief recursive posix mutex for the platforms without futex where the FutexLock would poll
+class RecursiveMutex : public posix::mutex
+{
+  public:
+    RecursiveMutex() noexcept
+        : posix::mutex(true)
+    {
+    }
+};
+} // namespace internal
+
 class ThreadSafePolicy
 {
   public:
@@ -30,8 +47,15 @@ class ThreadSafePolicy
     void unlock() const noexcept;
     bool tryLock() const noexcept;
 
+    /// @brief like tryLock but takes over the lock when it is held by another process; must only be called when
+    ///        the owner of the lock is known to be terminated, e.g. by RouDi during the cleanup of a process
+    /// @note the posix mutex which is used on platforms without futex cannot be taken over
+    bool tryLockOrRecoverFromDeadOwner() const noexcept;
+
   private:
-    mutable posix::mutex m_mutex{true}; // recursive lock
+    using Lock_t =
+        std::conditional<platform::IOX_SUPPORT_FUTEX, concurrent::FutexLock, internal::RecursiveMutex>::type;
+    mutable Lock_t m_mutex; // recursive lock
 };
 
 class SingleThreadedPolicy
@@ -41,6 +65,7 @@ class SingleThreadedPolicy
     void lock() const noexcept;
     void unlock() const noexcept;
     bool tryLock() const noexcept;
+    bool tryLockOrRecoverFromDeadOwner() const noexcept;
 };
 
 } // namespace popo
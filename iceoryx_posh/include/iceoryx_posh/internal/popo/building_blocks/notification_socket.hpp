@@ -0,0 +1,94 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_NOTIFICATION_SOCKET_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_NOTIFICATION_SOCKET_HPP
+
+#include "iceoryx_hoofs/cxx/expected.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+enum class NotificationSocketError
+{
+    ALREADY_ENABLED,
+    PATH_TOO_LONG,
+    UNABLE_TO_CREATE_SOCKET,
+    UNABLE_TO_BIND_SOCKET
+};
+
+/// @brief Makes the notifications of a ConditionVariableData observable with a file descriptor, so that they can be
+/// multiplexed with sockets, timers and signals in a single epoll/poll/select call.
+/// @details The listening process binds a datagram socket to a unix domain socket path and publishes the path in the
+/// ConditionVariableData. The first notify call after the listener consumed the notifications sends a single byte to
+/// this socket in addition to the semaphore post, therefore the file descriptor becomes readable. The datagrams
+/// are drained by the listener before it collects the notifications; a notification which arrives after the drain
+/// makes the file descriptor readable again. An eventfd is not used since it cannot be signaled by the notifiers of
+/// other processes.
+/// @note Not thread-safe, it belongs to the ConditionListener of the WaitSet which created it
+class NotificationSocket
+{
+  public:
+    /// @brief creates the socket and enables the socket notification of the condition variable
+    /// @param[in] condVarData which shall signal the socket
+    /// @return the NotificationSocket or the reason why it could not be created
+    static cxx::expected<NotificationSocket, NotificationSocketError>
+    create(ConditionVariableData& condVarData) noexcept;
+
+    NotificationSocket(const NotificationSocket&) = delete;
+    NotificationSocket& operator=(const NotificationSocket&) = delete;
+    NotificationSocket(NotificationSocket&& rhs) noexcept;
+    NotificationSocket& operator=(NotificationSocket&& rhs) noexcept;
+
+    /// @brief disables the socket notification of the condition variable, closes and removes the socket
+    ~NotificationSocket() noexcept;
+
+    /// @brief returns the file descriptor which becomes readable when the condition variable was notified
+    int32_t getFileDescriptor() const noexcept;
+
+    /// @brief receives all pending datagrams without blocking; must be called before the notifications are collected
+    void drain() noexcept;
+
+    /// @brief makes the file descriptor readable again without a notification, e.g. for a state based trigger which
+    /// is still satisfied after the notifications were collected
+    void rearm() noexcept;
+
+    /// @brief signals the socket of the condition variable; used by the ConditionNotifier
+    /// @param[in] condVarData whose m_isNotificationSocketEnabled was observed to be set
+    /// @note A full socket buffer or a socket which was removed in the meantime is ignored, in both cases there is
+    /// nothing to wake up
+    static void notify(const ConditionVariableData& condVarData) noexcept;
+
+  private:
+    NotificationSocket(ConditionVariableData& condVarData, const int32_t fileDescriptor) noexcept;
+    void destroy() noexcept;
+
+  private:
+    static constexpr int32_t INVALID_FD{-1};
+
+    ConditionVariableData* m_condVarDataPtr{nullptr};
+    int32_t m_fileDescriptor{INVALID_FD};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_NOTIFICATION_SOCKET_HPP
@@ -0,0 +1,90 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_POPO_CHUNK_WINDOW_HPP
+#define IOX_POSH_POPO_CHUNK_WINDOW_HPP
+
+#include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
+#include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief A ring of the latest received chunks of a subscriber. A new chunk takes over the reference of the queue and
+///        replaces the oldest chunk when the window is full, i.e. neither the UsedChunkList nor additional reference
+///        counting is involved for a chunk which is kept in the window.
+///        Like the UsedChunkList, the chunks are stored in an array of ShmSafeUnmanagedChunk to enable RouDi to release
+///        them under all circumstances when the application terminates.
+template <uint32_t Capacity>
+class ChunkWindow
+{
+    static_assert(Capacity > 0, "ChunkWindow Capacity must be larger than 0!");
+
+  public:
+    static constexpr uint32_t CAPACITY{Capacity};
+
+    /// @brief Constructs an empty ChunkWindow
+    /// @param[in] windowSize the number of latest chunks which are kept, limited to the Capacity; zero disables the
+    /// window
+    explicit ChunkWindow(const uint64_t windowSize = 0U) noexcept;
+
+    /// @brief Adds a chunk as the latest chunk, the oldest chunk is released if the window is full
+    /// @param[in] chunk to store in the window, it must not be empty
+    /// @return false if the window is disabled, the chunk is released then
+    /// @note only from runtime context
+    bool push(mepoo::SharedChunk&& chunk) noexcept;
+
+    /// @brief Releases all chunks of the window
+    /// @note only from runtime context
+    void clear() noexcept;
+
+    /// @brief Releases all chunks of the window, independent of the current state of the ring
+    /// @note from RouDi context once the applications walked the plank. It is unsafe to call this if the application is
+    /// still running.
+    void cleanup() noexcept;
+
+    /// @brief returns the number of chunks in the window
+    uint32_t size() const noexcept;
+
+    /// @brief returns the number of latest chunks the window keeps
+    uint32_t windowSize() const noexcept;
+
+    /// @brief returns the ChunkHeader of a chunk in the window
+    /// @param[in] index of the chunk, 0 is the oldest and size() - 1 the latest chunk; must be smaller than size()
+    const mepoo::ChunkHeader* getChunkHeader(const uint32_t index) const noexcept;
+
+  private:
+    using DataElement_t = mepoo::ShmSafeUnmanagedChunk;
+
+    std::atomic_flag m_synchronizer = ATOMIC_FLAG_INIT;
+    uint32_t m_windowSize{0U};
+    uint32_t m_oldest{0U};
+    uint32_t m_size{0U};
+    DataElement_t m_chunks[Capacity];
+};
+
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/chunk_window.inl"
+
+#endif // IOX_POSH_POPO_CHUNK_WINDOW_HPP
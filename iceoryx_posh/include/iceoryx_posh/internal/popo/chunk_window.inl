@@ -0,0 +1,125 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_POPO_CHUNK_WINDOW_INL
+#define IOX_POSH_POPO_CHUNK_WINDOW_INL
+
+#include "iceoryx_hoofs/cxx/algorithm.hpp"
+#include "iceoryx_hoofs/cxx/requires.hpp"
+#include "iceoryx_posh/internal/popo/chunk_window.hpp"
+
+namespace iox
+{
+namespace popo
+{
+template <uint32_t Capacity>
+constexpr uint32_t ChunkWindow<Capacity>::CAPACITY;
+
+template <uint32_t Capacity>
+inline ChunkWindow<Capacity>::ChunkWindow(const uint64_t windowSize) noexcept
+    : m_windowSize(static_cast<uint32_t>(algorithm::min(windowSize, static_cast<uint64_t>(Capacity))))
+{
+    static_assert(sizeof(DataElement_t) <= 8U, "The size of the data element type must not exceed 64 bit!");
+    static_assert(std::is_trivially_copyable<DataElement_t>::value,
+                  "The data element type must be trivially copyable!");
+
+    m_synchronizer.clear(std::memory_order_release);
+}
+
+template <uint32_t Capacity>
+inline bool ChunkWindow<Capacity>::push(mepoo::SharedChunk&& chunk) noexcept
+{
+    if (m_windowSize == 0U)
+    {
+        return false;
+    }
+
+    uint32_t index{0U};
+    if (m_size < m_windowSize)
+    {
+        index = (m_oldest + m_size) % m_windowSize;
+        ++m_size;
+    }
+    else
+    {
+        index = m_oldest;
+        m_oldest = (m_oldest + 1U) % m_windowSize;
+        // the oldest chunk is released before its slot is overwritten; the slot must never reference a chunk whose
+        // reference was already dropped, RouDi would release it a second time
+        m_chunks[index].releaseToSharedChunk();
+    }
+
+    m_chunks[index] = DataElement_t(std::move(chunk));
+
+    // pairs with the acquire in cleanup, RouDi sees the chunks of the window when the process terminated
+    m_synchronizer.clear(std::memory_order_release);
+    return true;
+}
+
+template <uint32_t Capacity>
+inline void ChunkWindow<Capacity>::clear() noexcept
+{
+    for (uint32_t i = 0U; i < m_size; ++i)
+    {
+        m_chunks[(m_oldest + i) % m_windowSize].releaseToSharedChunk();
+    }
+    m_oldest = 0U;
+    m_size = 0U;
+
+    m_synchronizer.clear(std::memory_order_release);
+}
+
+template <uint32_t Capacity>
+inline void ChunkWindow<Capacity>::cleanup() noexcept
+{
+    m_synchronizer.test_and_set(std::memory_order_acquire);
+
+    for (auto& data : m_chunks)
+    {
+        if (!data.isLogicalNullptr())
+        {
+            // release ownership by creating a SharedChunk
+            data.releaseToSharedChunk();
+        }
+    }
+    m_oldest = 0U;
+    m_size = 0U;
+}
+
+template <uint32_t Capacity>
+inline uint32_t ChunkWindow<Capacity>::size() const noexcept
+{
+    return m_size;
+}
+
+template <uint32_t Capacity>
+inline uint32_t ChunkWindow<Capacity>::windowSize() const noexcept
+{
+    return m_windowSize;
+}
+
+template <uint32_t Capacity>
+inline const mepoo::ChunkHeader* ChunkWindow<Capacity>::getChunkHeader(const uint32_t index) const noexcept
+{
+    cxx::Expects(index < m_size);
+    return m_chunks[(m_oldest + index) % m_windowSize].getChunkHeader();
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_CHUNK_WINDOW_INL
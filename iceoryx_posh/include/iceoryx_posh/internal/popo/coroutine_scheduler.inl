@@ -0,0 +1,157 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_POPO_COROUTINE_SCHEDULER_INL
+#define IOX_POSH_POPO_COROUTINE_SCHEDULER_INL
+
+#include "iceoryx_posh/popo/coroutine_scheduler.hpp"
+
+#include <algorithm>
+
+namespace iox
+{
+namespace popo
+{
+inline CoroutineScheduler::CoroutineScheduler() noexcept
+{
+}
+
+inline CoroutineScheduler::CoroutineScheduler(const Executor_t& executor) noexcept
+    : m_executor(executor)
+{
+}
+
+inline uint64_t CoroutineScheduler::runOnce() noexcept
+{
+    const auto timeout = timeUntilNextTimeout();
+    if (timeout == units::Duration::max())
+    {
+        return dispatch(m_waitSet.wait());
+    }
+    return dispatch(m_waitSet.timedWait(timeout));
+}
+
+inline uint64_t CoroutineScheduler::runOnce(const units::Duration timeout) noexcept
+{
+    return dispatch(m_waitSet.timedWait(std::min(timeout, timeUntilNextTimeout())));
+}
+
+inline units::Duration CoroutineScheduler::timeUntilNextTimeout() const noexcept
+{
+    auto timeout = units::Duration::max();
+    for (const auto& attachment : m_attachments)
+    {
+        if (attachment.has_value() && attachment->timeUntilNextTimeout)
+        {
+            timeout = std::min(timeout, attachment->timeUntilNextTimeout());
+        }
+    }
+    return timeout;
+}
+
+inline void CoroutineScheduler::markForDestruction() noexcept
+{
+    m_waitSet.markForDestruction();
+}
+
+inline void CoroutineScheduler::resume(std::coroutine_handle<> handle) noexcept
+{
+    if (m_executor)
+    {
+        m_executor(handle);
+    }
+    else
+    {
+        handle.resume();
+    }
+}
+
+inline uint64_t CoroutineScheduler::dispatch(const WaitSet<>::NotificationInfoVector& notifications) noexcept
+{
+    // the notification infos belong to the triggers of the WaitSet and become invalid when a resumed coroutine
+    // destroys its awaitable, therefore only the ids are used
+    cxx::vector<uint64_t, CAPACITY> ids;
+    for (auto notification : notifications)
+    {
+        ids.emplace_back(notification->getNotificationId());
+    }
+
+    auto callHandler = [this](const uint64_t id) {
+        if (id < CAPACITY && m_attachments[id].has_value())
+        {
+            // the handler is copied since the coroutine which it resumes could detach it
+            auto handler = m_attachments[id]->handler;
+            handler();
+        }
+    };
+
+    for (auto id : ids)
+    {
+        callHandler(id);
+    }
+
+    for (uint64_t id = 0U; id < CAPACITY; ++id)
+    {
+        if (m_attachments[id].has_value() && m_attachments[id]->timeUntilNextTimeout)
+        {
+            callHandler(id);
+        }
+    }
+
+    return ids.size();
+}
+
+template <typename T, typename EventType>
+inline cxx::expected<uint64_t, WaitSetError>
+CoroutineScheduler::attach(T& eventOrigin,
+                           const EventType eventType,
+                           const Handler_t& handler,
+                           const TimeoutProvider_t& timeUntilNextTimeout) noexcept
+{
+    for (uint64_t id = 0U; id < CAPACITY; ++id)
+    {
+        if (m_attachments[id].has_value())
+        {
+            continue;
+        }
+
+        auto result = m_waitSet.attachEvent(eventOrigin, eventType, id);
+        if (result.has_error())
+        {
+            return cxx::error<WaitSetError>(result.get_error());
+        }
+        m_attachments[id].emplace(Attachment{handler, timeUntilNextTimeout});
+        return cxx::success<uint64_t>(id);
+    }
+
+    return cxx::error<WaitSetError>(WaitSetError::WAIT_SET_FULL);
+}
+
+template <typename T, typename EventType>
+inline void CoroutineScheduler::detach(T& eventOrigin, const EventType eventType, const uint64_t id) noexcept
+{
+    m_waitSet.detachEvent(eventOrigin, eventType);
+    if (id < CAPACITY)
+    {
+        m_attachments[id].reset();
+    }
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_COROUTINE_SCHEDULER_INL
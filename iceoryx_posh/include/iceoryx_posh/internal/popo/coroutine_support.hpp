@@ -0,0 +1,29 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_POPO_COROUTINE_SUPPORT_HPP
+#define IOX_POSH_POPO_COROUTINE_SUPPORT_HPP
+
+/// @brief The awaitables are optional and only available when the including translation unit is compiled with C++20
+/// coroutine support; the iceoryx libraries themselves do not depend on it.
+#if !defined(__cpp_impl_coroutine) || (__cpp_impl_coroutine < 201902L)
+#error "The iceoryx awaitables require C++20 coroutines, e.g. compile with -std=c++20"
+#endif
+
+#include <coroutine>
+
+#endif // IOX_POSH_POPO_COROUTINE_SUPPORT_HPP
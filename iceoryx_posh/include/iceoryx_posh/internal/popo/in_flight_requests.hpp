@@ -0,0 +1,181 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_POPO_IN_FLIGHT_REQUESTS_HPP
+#define IOX_POSH_POPO_IN_FLIGHT_REQUESTS_HPP
+
+#include "iceoryx_hoofs/cxx/expected.hpp"
+#include "iceoryx_hoofs/cxx/function.hpp"
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/log/logstream.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/popo/response.hpp"
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The reasons why no response is provided for a request which was sent with the AsyncClient
+enum class AsyncResponseError
+{
+    /// @brief the response has not yet arrived
+    PENDING,
+    /// @brief the response did not arrive before the timeout of the request expired
+    TIMED_OUT,
+    /// @brief the request was cancelled by the user
+    CANCELLED,
+    /// @brief there is no request which waits for a response, e.g. the response was already taken
+    NO_PENDING_REQUEST
+};
+
+/// @brief Converts the AsyncResponseError to a string literal
+/// @param[in] value to convert to a string literal
+/// @return pointer to a string literal
+inline constexpr const char* asStringLiteral(const AsyncResponseError value) noexcept;
+
+/// @brief Convenience stream operator to easily use the `asStringLiteral` function with std::ostream
+/// @param[in] stream sink to write the message to
+/// @param[in] value to convert to a string literal
+/// @return the reference to `stream` which was provided as input parameter
+inline std::ostream& operator<<(std::ostream& stream, AsyncResponseError value) noexcept;
+
+/// @brief Convenience stream operator to easily use the `asStringLiteral` function with iox::log::LogStream
+/// @param[in] stream sink to write the message to
+/// @param[in] value to convert to a string literal
+/// @return the reference to `stream` which was provided as input parameter
+inline log::LogStream& operator<<(log::LogStream& stream, AsyncResponseError value) noexcept;
+
+/// @brief The fixed-capacity correlation table of the AsyncClient. It stores the requests which are in flight and
+/// correlates the incoming responses by the sequence id of the request.
+/// @details The sequence ids are assigned by the table such that the slot of a request is the sequence id modulo the
+/// capacity. A lookup is therefore a single index operation and a late response of a request which timed out or was
+/// cancelled is detected by the mismatching sequence id of the slot.
+/// @note Not thread-safe, like the client which owns it; the table, the client and the futures must be used from the
+/// same thread
+/// @note Not intended for public usage! Use the `AsyncClient` and `ResponseFuture` instead!
+template <typename Res>
+class InFlightRequests
+{
+  public:
+    using Response_t = Response<const Res>;
+    using Result_t = cxx::expected<Response_t, AsyncResponseError>;
+    /// @brief called with the response or the reason why there is none; the response can be moved out of the result
+    using Callback_t = cxx::function<void(Result_t&)>;
+
+    static constexpr uint64_t CAPACITY{MAX_OUTSTANDING_REQUESTS_PER_CLIENT};
+    static constexpr uint64_t NO_DEADLINE{std::numeric_limits<uint64_t>::max()};
+
+    /// @brief creates the table
+    /// @param[in] maxOutstandingRequests limits the number of requests in flight, at most CAPACITY
+    explicit InFlightRequests(const uint64_t maxOutstandingRequests) noexcept;
+
+    InFlightRequests(const InFlightRequests&) = delete;
+    InFlightRequests(InFlightRequests&&) = delete;
+    InFlightRequests& operator=(const InFlightRequests&) = delete;
+    InFlightRequests& operator=(InFlightRequests&&) = delete;
+    ~InFlightRequests() noexcept = default;
+
+    /// @brief adds a request whose response is collected with take
+    /// @param[in] deadline in nanoseconds of the steady clock or NO_DEADLINE
+    /// @return the sequence id of the request or nullopt when the maximum number of outstanding requests is reached
+    cxx::optional<int64_t> add(const uint64_t deadline) noexcept;
+
+    /// @brief adds a request whose response is delivered to the callback
+    /// @param[in] deadline in nanoseconds of the steady clock or NO_DEADLINE
+    /// @param[in] callback which is called with the response, when the request timed out or when it was cancelled
+    /// @return the sequence id of the request or nullopt when the maximum number of outstanding requests is reached
+    cxx::optional<int64_t> add(const uint64_t deadline, const Callback_t& callback) noexcept;
+
+    /// @brief removes the request without calling its callback, e.g. when it could not be sent
+    void remove(const int64_t sequenceId) noexcept;
+
+    /// @brief correlates the response with its request
+    /// @param[in] response to correlate by the sequence id of its response header
+    /// @return false if there is no request waiting for the response; the response is released then
+    bool complete(Response_t&& response) noexcept;
+
+    /// @brief times out all requests whose deadline has passed
+    /// @param[in] now in nanoseconds of the steady clock
+    void expire(const uint64_t now) noexcept;
+
+    /// @brief returns the earliest deadline of the requests which wait for their response or NO_DEADLINE
+    uint64_t nextDeadline() const noexcept;
+
+    /// @brief cancels a request which waits for its response
+    /// @return false if there is no such request
+    bool cancel(const int64_t sequenceId) noexcept;
+
+    /// @brief returns whether take provides a result other than AsyncResponseError::PENDING
+    /// @param[in] now in nanoseconds of the steady clock; a request whose deadline has passed is timed out
+    bool isReady(const int64_t sequenceId, const uint64_t now) const noexcept;
+
+    /// @brief takes the response of a request which was added without callback; the request is removed from the table
+    /// unless the response is still pending
+    /// @param[in] now in nanoseconds of the steady clock; a request whose deadline has passed is timed out
+    Result_t take(const int64_t sequenceId, const uint64_t now) noexcept;
+
+    /// @brief returns the number of requests which are in flight or whose result was not yet taken
+    uint64_t size() const noexcept;
+
+    /// @brief returns the number of responses which are stored in the table and not yet taken
+    uint64_t numberOfReadyResponses() const noexcept;
+
+    /// @brief returns the current time in nanoseconds of the steady clock, which is the clock of the deadlines
+    static uint64_t now() noexcept;
+
+  private:
+    enum class State : uint8_t
+    {
+        FREE,
+        PENDING,
+        READY,
+        TIMED_OUT
+    };
+
+    struct Slot
+    {
+        int64_t sequenceId{-1};
+        State state{State::FREE};
+        uint64_t deadline{NO_DEADLINE};
+        cxx::optional<Response_t> response;
+        Callback_t callback;
+    };
+
+    cxx::optional<int64_t> acquireSlot(const uint64_t deadline) noexcept;
+    Slot* find(const int64_t sequenceId) noexcept;
+    const Slot* find(const int64_t sequenceId) const noexcept;
+    void release(Slot& slot) noexcept;
+    void notify(Slot& slot, Result_t&& result) noexcept;
+
+  private:
+    std::array<Slot, CAPACITY> m_slots;
+    uint64_t m_maxOutstandingRequests{CAPACITY};
+    uint64_t m_size{0U};
+    uint64_t m_numberOfReadyResponses{0U};
+    int64_t m_nextSequenceId{0};
+};
+
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/in_flight_requests.inl"
+
+#endif // IOX_POSH_POPO_IN_FLIGHT_REQUESTS_HPP
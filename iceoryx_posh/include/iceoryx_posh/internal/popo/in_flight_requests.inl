@@ -0,0 +1,307 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_POPO_IN_FLIGHT_REQUESTS_INL
+#define IOX_POSH_POPO_IN_FLIGHT_REQUESTS_INL
+
+#include "iceoryx_posh/internal/popo/in_flight_requests.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+namespace iox
+{
+namespace popo
+{
+inline constexpr const char* asStringLiteral(const AsyncResponseError value) noexcept
+{
+    switch (value)
+    {
+    case AsyncResponseError::PENDING:
+        return "AsyncResponseError::PENDING";
+    case AsyncResponseError::TIMED_OUT:
+        return "AsyncResponseError::TIMED_OUT";
+    case AsyncResponseError::CANCELLED:
+        return "AsyncResponseError::CANCELLED";
+    case AsyncResponseError::NO_PENDING_REQUEST:
+        return "AsyncResponseError::NO_PENDING_REQUEST";
+    }
+
+    return "[Undefined AsyncResponseError]";
+}
+
+inline std::ostream& operator<<(std::ostream& stream, AsyncResponseError value) noexcept
+{
+    stream << asStringLiteral(value);
+    return stream;
+}
+
+inline log::LogStream& operator<<(log::LogStream& stream, AsyncResponseError value) noexcept
+{
+    stream << asStringLiteral(value);
+    return stream;
+}
+
+template <typename Res>
+inline InFlightRequests<Res>::InFlightRequests(const uint64_t maxOutstandingRequests) noexcept
+    : m_maxOutstandingRequests(std::min(maxOutstandingRequests, CAPACITY))
+{
+}
+
+template <typename Res>
+inline cxx::optional<int64_t> InFlightRequests<Res>::add(const uint64_t deadline) noexcept
+{
+    return acquireSlot(deadline);
+}
+
+template <typename Res>
+inline cxx::optional<int64_t> InFlightRequests<Res>::add(const uint64_t deadline, const Callback_t& callback) noexcept
+{
+    auto sequenceId = acquireSlot(deadline);
+    if (sequenceId.has_value())
+    {
+        find(sequenceId.value())->callback = callback;
+    }
+    return sequenceId;
+}
+
+template <typename Res>
+inline cxx::optional<int64_t> InFlightRequests<Res>::acquireSlot(const uint64_t deadline) noexcept
+{
+    if (m_size >= m_maxOutstandingRequests)
+    {
+        return cxx::nullopt;
+    }
+
+    // the sequence ids need not be contiguous; skipping the ids whose slot is still occupied by a long running request
+    // keeps the lookup a single index operation. Since m_size < CAPACITY there is always a free slot.
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        const int64_t sequenceId = m_nextSequenceId;
+        m_nextSequenceId = (m_nextSequenceId == std::numeric_limits<int64_t>::max()) ? 0 : m_nextSequenceId + 1;
+
+        auto& slot = m_slots[static_cast<uint64_t>(sequenceId) % CAPACITY];
+        if (slot.state == State::FREE)
+        {
+            slot.sequenceId = sequenceId;
+            slot.state = State::PENDING;
+            slot.deadline = deadline;
+            ++m_size;
+            return sequenceId;
+        }
+    }
+
+    return cxx::nullopt;
+}
+
+template <typename Res>
+inline typename InFlightRequests<Res>::Slot* InFlightRequests<Res>::find(const int64_t sequenceId) noexcept
+{
+    return const_cast<Slot*>(static_cast<const InFlightRequests*>(this)->find(sequenceId));
+}
+
+template <typename Res>
+inline const typename InFlightRequests<Res>::Slot*
+InFlightRequests<Res>::find(const int64_t sequenceId) const noexcept
+{
+    if (sequenceId < 0)
+    {
+        return nullptr;
+    }
+
+    auto& slot = m_slots[static_cast<uint64_t>(sequenceId) % CAPACITY];
+    if (slot.state == State::FREE || slot.sequenceId != sequenceId)
+    {
+        return nullptr;
+    }
+    return &slot;
+}
+
+template <typename Res>
+inline void InFlightRequests<Res>::release(Slot& slot) noexcept
+{
+    if (slot.state == State::READY)
+    {
+        --m_numberOfReadyResponses;
+    }
+    slot.response.reset();
+    slot.callback = Callback_t();
+    slot.sequenceId = -1;
+    slot.state = State::FREE;
+    slot.deadline = NO_DEADLINE;
+    --m_size;
+}
+
+template <typename Res>
+inline void InFlightRequests<Res>::notify(Slot& slot, Result_t&& result) noexcept
+{
+    // the slot is released before the callback is called, this allows the callback to send a new request
+    auto callback = std::move(slot.callback);
+    release(slot);
+    callback(result);
+}
+
+template <typename Res>
+inline void InFlightRequests<Res>::remove(const int64_t sequenceId) noexcept
+{
+    auto slot = find(sequenceId);
+    if (slot != nullptr)
+    {
+        release(*slot);
+    }
+}
+
+template <typename Res>
+inline bool InFlightRequests<Res>::complete(Response_t&& response) noexcept
+{
+    auto slot = find(response.getResponseHeader().getSequenceId());
+    if (slot == nullptr || slot->state != State::PENDING)
+    {
+        return false;
+    }
+
+    if (slot->callback)
+    {
+        notify(*slot, cxx::success<Response_t>(std::move(response)));
+    }
+    else
+    {
+        slot->response.emplace(std::move(response));
+        slot->state = State::READY;
+        ++m_numberOfReadyResponses;
+    }
+    return true;
+}
+
+template <typename Res>
+inline void InFlightRequests<Res>::expire(const uint64_t now) noexcept
+{
+    for (auto& slot : m_slots)
+    {
+        if (slot.state != State::PENDING || slot.deadline > now)
+        {
+            continue;
+        }
+
+        if (slot.callback)
+        {
+            notify(slot, cxx::error<AsyncResponseError>(AsyncResponseError::TIMED_OUT));
+        }
+        else
+        {
+            slot.state = State::TIMED_OUT;
+        }
+    }
+}
+
+template <typename Res>
+inline uint64_t InFlightRequests<Res>::nextDeadline() const noexcept
+{
+    uint64_t nextDeadline{NO_DEADLINE};
+    for (const auto& slot : m_slots)
+    {
+        if (slot.state == State::PENDING)
+        {
+            nextDeadline = std::min(nextDeadline, slot.deadline);
+        }
+    }
+    return nextDeadline;
+}
+
+template <typename Res>
+inline bool InFlightRequests<Res>::cancel(const int64_t sequenceId) noexcept
+{
+    auto slot = find(sequenceId);
+    if (slot == nullptr)
+    {
+        return false;
+    }
+
+    if (slot->callback)
+    {
+        notify(*slot, cxx::error<AsyncResponseError>(AsyncResponseError::CANCELLED));
+    }
+    else
+    {
+        release(*slot);
+    }
+    return true;
+}
+
+template <typename Res>
+inline bool InFlightRequests<Res>::isReady(const int64_t sequenceId, const uint64_t now) const noexcept
+{
+    auto slot = find(sequenceId);
+    return slot == nullptr || slot->state != State::PENDING || slot->deadline <= now;
+}
+
+template <typename Res>
+inline typename InFlightRequests<Res>::Result_t InFlightRequests<Res>::take(const int64_t sequenceId,
+                                                                           const uint64_t now) noexcept
+{
+    auto slot = find(sequenceId);
+    if (slot == nullptr || slot->callback)
+    {
+        return cxx::error<AsyncResponseError>(AsyncResponseError::NO_PENDING_REQUEST);
+    }
+
+    // the future times out on its own, independent of whether processResponses was called after the deadline
+    if (slot->state == State::PENDING && slot->deadline <= now)
+    {
+        slot->state = State::TIMED_OUT;
+    }
+
+    switch (slot->state)
+    {
+    case State::READY:
+    {
+        Result_t result = cxx::success<Response_t>(std::move(slot->response.value()));
+        release(*slot);
+        return result;
+    }
+    case State::TIMED_OUT:
+        release(*slot);
+        return cxx::error<AsyncResponseError>(AsyncResponseError::TIMED_OUT);
+    default:
+        return cxx::error<AsyncResponseError>(AsyncResponseError::PENDING);
+    }
+}
+
+template <typename Res>
+inline uint64_t InFlightRequests<Res>::size() const noexcept
+{
+    return m_size;
+}
+
+template <typename Res>
+inline uint64_t InFlightRequests<Res>::numberOfReadyResponses() const noexcept
+{
+    return m_numberOfReadyResponses;
+}
+
+template <typename Res>
+inline uint64_t InFlightRequests<Res>::now() noexcept
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_IN_FLIGHT_REQUESTS_INL
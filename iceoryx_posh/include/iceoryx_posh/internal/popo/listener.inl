@@ -101,9 +101,16 @@ inline ListenerImpl<Capacity>::ListenerImpl() noexcept
 }
 
 template <uint64_t Capacity>
-inline ListenerImpl<Capacity>::ListenerImpl(ConditionVariableData& conditionVariable) noexcept
+inline ListenerImpl<Capacity>::ListenerImpl(const WaitStrategy& waitStrategy) noexcept
+    : ListenerImpl(*runtime::PoshRuntime::getInstance().getMiddlewareConditionVariable(), waitStrategy)
+{
+}
+
+template <uint64_t Capacity>
+inline ListenerImpl<Capacity>::ListenerImpl(ConditionVariableData& conditionVariable,
+                                            const WaitStrategy& waitStrategy) noexcept
     : m_conditionVariableData(&conditionVariable)
-    , m_conditionListener(conditionVariable)
+    , m_conditionListener(conditionVariable, waitStrategy)
 {
     m_thread = std::thread(&ListenerImpl<Capacity>::threadLoop, this);
 }
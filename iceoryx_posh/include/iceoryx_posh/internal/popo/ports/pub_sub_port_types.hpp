@@ -19,8 +19,11 @@
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_receiver_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
+#include "iceoryx_posh/internal/popo/chunk_window.hpp"
+#include "iceoryx_posh/popo/port_queue_policies.hpp"
 
 #include <cstdint>
+#include <type_traits>
 
 namespace iox
 {
@@ -33,6 +36,22 @@ using SubscriberChunkQueueData_t = ChunkQueueData<DefaultChunkQueueConfig, Threa
 using SubscriberChunkReceiverData_t =
     ChunkReceiverData<MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY, SubscriberChunkQueueData_t>;
 
+using SubscriberChunkWindow_t = ChunkWindow<MAX_SUBSCRIBER_WINDOW_SIZE>;
+
+/// @brief The type of the subscriber queue which is created by RouDi for the given QueueFullPolicy
+/// @tparam CommunicationPolicy build::OneToManyPolicy or build::ManyToManyPolicy
+template <typename CommunicationPolicy = build::CommunicationPolicy>
+constexpr cxx::VariantQueueTypes subscriberQueueType(const QueueFullPolicy queueFullPolicy) noexcept
+{
+    return std::is_same<CommunicationPolicy, build::OneToManyPolicy>::value
+               ? ((queueFullPolicy == QueueFullPolicy::DISCARD_OLDEST_DATA)
+                      ? cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer
+                      : cxx::VariantQueueTypes::FiFo_SingleProducerSingleConsumer)
+               : ((queueFullPolicy == QueueFullPolicy::DISCARD_OLDEST_DATA)
+                      ? cxx::VariantQueueTypes::SoFi_MultiProducerSingleConsumer
+                      : cxx::VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+}
+
 } // namespace popo
 } // namespace iox
 
@@ -43,6 +43,14 @@ struct PublisherPortData : public BasePortData
                       const PublisherOptions& publisherOptions,
                       const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo()) noexcept;
 
+    PublisherPortData(const PublisherPortData&) = delete;
+    PublisherPortData(PublisherPortData&&) = delete;
+    PublisherPortData& operator=(const PublisherPortData&) = delete;
+    PublisherPortData& operator=(PublisherPortData&&) = delete;
+
+    /// @brief releases the chunk quota of the publisher
+    ~PublisherPortData() noexcept;
+
     using ChunkQueueData_t = SubscriberPortData::ChunkQueueData_t;
     using ChunkDistributorData_t =
         ChunkDistributorData<DefaultChunkDistributorConfig, ThreadSafePolicy, ChunkQueuePusher<ChunkQueueData_t>>;
@@ -26,6 +26,7 @@
 #include "iceoryx_posh/internal/popo/ports/base_port.hpp"
 #include "iceoryx_posh/internal/popo/ports/publisher_port_data.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/mepoo/multi_chunk_table.hpp"
 
 namespace iox
 {
@@ -63,6 +64,21 @@ class PublisherPortUser : public BasePort
                      const uint32_t userHeaderSize = 0U,
                      const uint32_t userHeaderAlignment = 1U) noexcept;
 
+    /// @brief Allocate a multi-chunk sample, the head chunk contains the MultiChunkTable with the parts as
+    /// user-payload; the head chunk is used like any other chunk to send or free the multi-chunk sample
+    /// @param[in] partSizes, the user-payload sizes of the parts
+    /// @param[in] partAlignment, alignment of the user-payload of the parts
+    /// @param[in] userHeaderSize, size of the user-header of the head chunk; use iox::CHUNK_NO_USER_HEADER_SIZE to
+    /// omit a user-header
+    /// @param[in] userHeaderAlignment, alignment of the user-header of the head chunk; use
+    /// iox::CHUNK_NO_USER_HEADER_ALIGNMENT to omit a user-header
+    /// @return on success pointer to the ChunkHeader of the head chunk, error if not
+    cxx::expected<mepoo::ChunkHeader*, AllocationError>
+    tryAllocateMultiChunk(const mepoo::MultiChunkTable::PartSizes_t& partSizes,
+                          const uint32_t partAlignment,
+                          const uint32_t userHeaderSize = 0U,
+                          const uint32_t userHeaderAlignment = 1U) noexcept;
+
     /// @brief Free an allocated chunk without sending it
     /// @param[in] chunkHeader, pointer to the ChunkHeader to free
     void releaseChunk(mepoo::ChunkHeader* const chunkHeader) noexcept;
@@ -71,6 +87,20 @@ class PublisherPortUser : public BasePort
     /// @param[in] chunkHeader, pointer to the ChunkHeader to send
     void sendChunk(mepoo::ChunkHeader* const chunkHeader) noexcept;
 
+    /// @brief Send an allocated chunk to all connected subscriber ports with the compile time options of the PortPolicy
+    /// @tparam PortPolicy provides SUBSCRIBER_TOO_SLOW_POLICY and HISTORY_CAPACITY which must match the options the
+    /// port was created with
+    /// @param[in] chunkHeader, pointer to the ChunkHeader to send
+    template <typename PortPolicy>
+    void sendChunk(mepoo::ChunkHeader* const chunkHeader) noexcept;
+
+    /// @brief Send multiple allocated chunks to all connected subscriber ports, every subscriber is notified once
+    /// after it received the last chunk
+    /// @param[in] chunkHeaders array of pointers to the ChunkHeaders to send in the order of the array
+    /// @param[in] numberOfChunks the number of elements in chunkHeaders, must not exceed
+    /// MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY
+    void sendChunks(mepoo::ChunkHeader* const* const chunkHeaders, const uint64_t numberOfChunks) noexcept;
+
     /// @brief Returns the last sent chunk if there is one
     /// @return pointer to the ChunkHeader of the last sent Chunk if there is one, empty optional if not
     cxx::optional<const mepoo::ChunkHeader*> tryGetPreviousChunk() const noexcept;
@@ -96,7 +126,21 @@ class PublisherPortUser : public BasePort
     ChunkSender<PublisherPortData::ChunkSenderData_t> m_chunkSender;
 };
 
+/// @brief PublisherPortUser which sends the chunks with the compile time options of the PortPolicy
+template <typename PortPolicy>
+class StaticPublisherPortUser : public PublisherPortUser
+{
+  public:
+    using PublisherPortUser::PublisherPortUser;
+
+    /// @brief Send an allocated chunk to all connected subscriber ports
+    /// @param[in] chunkHeader, pointer to the ChunkHeader to send
+    void sendChunk(mepoo::ChunkHeader* const chunkHeader) noexcept;
+};
+
 } // namespace popo
 } // namespace iox
 
+#include "iceoryx_posh/internal/popo/ports/publisher_port_user.inl"
+
 #endif // IOX_POSH_POPO_PORTS_PUBLISHER_PORT_USER_HPP
@@ -0,0 +1,52 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_POPO_PORTS_PUBLISHER_PORT_USER_INL
+#define IOX_POSH_POPO_PORTS_PUBLISHER_PORT_USER_INL
+
+#include "iceoryx_posh/internal/popo/ports/publisher_port_user.hpp"
+
+namespace iox
+{
+namespace popo
+{
+template <typename PortPolicy>
+inline void PublisherPortUser::sendChunk(mepoo::ChunkHeader* const chunkHeader) noexcept
+{
+    const auto offerRequested = getMembers()->m_offeringRequested.load(std::memory_order_relaxed);
+
+    if (offerRequested)
+    {
+        m_chunkSender.template send<PortPolicy>(chunkHeader);
+    }
+    else
+    {
+        // see the non-template sendChunk why the chunk is put into the history
+        m_chunkSender.pushToHistory(chunkHeader);
+    }
+}
+
+template <typename PortPolicy>
+inline void StaticPublisherPortUser<PortPolicy>::sendChunk(mepoo::ChunkHeader* const chunkHeader) noexcept
+{
+    PublisherPortUser::sendChunk<PortPolicy>(chunkHeader);
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_PORTS_PUBLISHER_PORT_USER_INL
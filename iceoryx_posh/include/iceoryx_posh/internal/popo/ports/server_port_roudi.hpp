@@ -67,6 +67,11 @@ class ServerPortRouDi : public BasePort
     /// Caution: Contract is that user process is no more running when cleanup is called
     void releaseAllChunks() noexcept;
 
+    /// @brief close the lock-free delivery of the server without waiting for a user process which terminated while
+    /// delivering a chunk
+    /// Caution: Contract is that user process is no more running when this is called
+    void closeAbandonedFastPath() noexcept;
+
   private:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
@@ -44,9 +44,13 @@ struct SubscriberPortData : public BasePortData
     ///       (move relevant types and constants there)
     using ChunkQueueData_t = iox::popo::SubscriberChunkQueueData_t;
     using ChunkReceiverData_t = iox::popo::SubscriberChunkReceiverData_t;
+    using ChunkWindow_t = iox::popo::SubscriberChunkWindow_t;
 
     ChunkReceiverData_t m_chunkReceiverData;
 
+    /// @brief the latest chunks which were moved out of the queue with SubscriberPortUser::updateWindow
+    ChunkWindow_t m_chunkWindow;
+
     SubscriberOptions m_options;
 
     std::atomic_bool m_subscribeRequested{false};
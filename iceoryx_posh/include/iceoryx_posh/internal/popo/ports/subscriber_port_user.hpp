@@ -68,6 +68,23 @@ class SubscriberPortUser : public BasePort
     /// or if there are no new chunks in the underlying queue
     cxx::expected<const mepoo::ChunkHeader*, ChunkReceiveResult> tryGetChunk() noexcept;
 
+    /// @brief Like tryGetChunk but without the runtime dispatch over the queue type
+    /// @tparam QueueType of the underlying queue, must be the type RouDi created the queue with
+    /// @return New chunk header, ChunkReceiveResult on error
+    /// or if there are no new chunks in the underlying queue
+    template <cxx::VariantQueueTypes QueueType>
+    cxx::expected<const mepoo::ChunkHeader*, ChunkReceiveResult> tryGetChunk() noexcept;
+
+    /// @brief Tries to get up to maxNumberOfChunks chunks from the queue with a single call, the oldest chunk is
+    /// stored first. Chunks which cannot be held since the maximum number of held chunks is reached stay in the queue.
+    /// @param[in] maxNumberOfChunks the maximum number of chunks to get
+    /// @param[in] callable which is called with the chunk header of every received chunk, the oldest chunk first
+    /// @return the number of chunks handed to the callable, ChunkReceiveResult on error if not a single chunk could be
+    /// received
+    cxx::expected<uint64_t, ChunkReceiveResult>
+    tryGetChunks(const uint64_t maxNumberOfChunks,
+                 const cxx::function_ref<void(const mepoo::ChunkHeader*)> callable) noexcept;
+
     /// @brief Release a chunk that was obtained with tryGetChunk
     /// @param[in] chunkHeader, pointer to the ChunkHeader to release
     void releaseChunk(const mepoo::ChunkHeader* const chunkHeader) noexcept;
@@ -75,6 +92,18 @@ class SubscriberPortUser : public BasePort
     /// @brief Release all the chunks that are currently queued up.
     void releaseQueuedChunks() noexcept;
 
+    /// @brief Moves all chunks from the queue into the window of the latest chunks, the oldest chunks of the window
+    /// are released when it is full. Nothing is done if the window is disabled, see SubscriberOptions::windowSize.
+    /// @return the number of chunks which were moved into the window
+    uint64_t updateWindow() noexcept;
+
+    /// @brief access to the window of the latest chunks
+    /// @return the window which is changed by updateWindow and releaseWindow
+    const SubscriberPortData::ChunkWindow_t& getWindow() const noexcept;
+
+    /// @brief Release all the chunks of the window of the latest chunks
+    void releaseWindow() noexcept;
+
     /// @brief check if there are chunks in the queue
     /// @return if there are chunks in the queue return true, otherwise false
     bool hasNewChunks() const noexcept;
@@ -100,8 +129,22 @@ class SubscriberPortUser : public BasePort
     ChunkReceiver<SubscriberPortData::ChunkReceiverData_t> m_chunkReceiver;
 };
 
+/// @brief SubscriberPortUser which takes the chunks from the queue type of the PortPolicy
+template <typename PortPolicy>
+class StaticSubscriberPortUser : public SubscriberPortUser
+{
+  public:
+    using SubscriberPortUser::SubscriberPortUser;
+
+    /// @brief Tries to get the next chunk from the queue
+    /// @return New chunk header, ChunkReceiveResult on error
+    /// or if there are no new chunks in the underlying queue
+    cxx::expected<const mepoo::ChunkHeader*, ChunkReceiveResult> tryGetChunk() noexcept;
+};
+
 } // namespace popo
 } // namespace iox
 
+#include "iceoryx_posh/internal/popo/ports/subscriber_port_user.inl"
 
 #endif
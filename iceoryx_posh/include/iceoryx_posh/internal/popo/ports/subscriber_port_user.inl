@@ -0,0 +1,43 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_POPO_PORTS_SUBSCRIBER_PORT_USER_INL
+#define IOX_POSH_POPO_PORTS_SUBSCRIBER_PORT_USER_INL
+
+#include "iceoryx_posh/internal/popo/ports/subscriber_port_user.hpp"
+
+namespace iox
+{
+namespace popo
+{
+template <cxx::VariantQueueTypes QueueType>
+inline cxx::expected<const mepoo::ChunkHeader*, ChunkReceiveResult> SubscriberPortUser::tryGetChunk() noexcept
+{
+    return m_chunkReceiver.template tryGet<QueueType>();
+}
+
+template <typename PortPolicy>
+inline cxx::expected<const mepoo::ChunkHeader*, ChunkReceiveResult>
+StaticSubscriberPortUser<PortPolicy>::tryGetChunk() noexcept
+{
+    return SubscriberPortUser::tryGetChunk<PortPolicy::QUEUE_TYPE>();
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_PORTS_SUBSCRIBER_PORT_USER_INL
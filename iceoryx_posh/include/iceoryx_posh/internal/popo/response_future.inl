@@ -0,0 +1,110 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_POPO_RESPONSE_FUTURE_INL
+#define IOX_POSH_POPO_RESPONSE_FUTURE_INL
+
+#include "iceoryx_posh/popo/response_future.hpp"
+
+namespace iox
+{
+namespace popo
+{
+template <typename Res>
+inline ResponseFuture<Res>::ResponseFuture(InFlightRequests<Res>& inFlightRequests, const int64_t sequenceId) noexcept
+    : m_inFlightRequests(&inFlightRequests)
+    , m_sequenceId(sequenceId)
+{
+}
+
+template <typename Res>
+inline ResponseFuture<Res>::ResponseFuture(ResponseFuture&& rhs) noexcept
+{
+    *this = std::move(rhs);
+}
+
+template <typename Res>
+inline ResponseFuture<Res>& ResponseFuture<Res>::operator=(ResponseFuture&& rhs) noexcept
+{
+    if (this != &rhs)
+    {
+        cancel();
+        m_inFlightRequests = rhs.m_inFlightRequests;
+        m_sequenceId = rhs.m_sequenceId;
+        m_detachReason = rhs.m_detachReason;
+        rhs.detach(AsyncResponseError::NO_PENDING_REQUEST);
+    }
+    return *this;
+}
+
+template <typename Res>
+inline ResponseFuture<Res>::~ResponseFuture() noexcept
+{
+    cancel();
+}
+
+template <typename Res>
+inline int64_t ResponseFuture<Res>::getSequenceId() const noexcept
+{
+    return m_sequenceId;
+}
+
+template <typename Res>
+inline bool ResponseFuture<Res>::isReady() const noexcept
+{
+    return m_inFlightRequests == nullptr || m_inFlightRequests->isReady(m_sequenceId, InFlightRequests<Res>::now());
+}
+
+template <typename Res>
+inline cxx::expected<Response<const Res>, AsyncResponseError> ResponseFuture<Res>::take() noexcept
+{
+    if (m_inFlightRequests == nullptr)
+    {
+        return cxx::error<AsyncResponseError>(m_detachReason);
+    }
+
+    auto result = m_inFlightRequests->take(m_sequenceId, InFlightRequests<Res>::now());
+    if (result.has_error() && result.get_error() == AsyncResponseError::PENDING)
+    {
+        return result;
+    }
+
+    detach(AsyncResponseError::NO_PENDING_REQUEST);
+    return result;
+}
+
+template <typename Res>
+inline void ResponseFuture<Res>::cancel() noexcept
+{
+    if (m_inFlightRequests != nullptr)
+    {
+        m_inFlightRequests->cancel(m_sequenceId);
+        detach(AsyncResponseError::CANCELLED);
+    }
+}
+
+template <typename Res>
+inline void ResponseFuture<Res>::detach(const AsyncResponseError reason) noexcept
+{
+    m_inFlightRequests = nullptr;
+    m_detachReason = reason;
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_RESPONSE_FUTURE_INL
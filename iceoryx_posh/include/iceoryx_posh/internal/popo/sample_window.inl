@@ -0,0 +1,181 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_POPO_SAMPLE_WINDOW_INL
+#define IOX_POSH_POPO_SAMPLE_WINDOW_INL
+
+#include "iceoryx_posh/popo/sample_window.hpp"
+
+namespace iox
+{
+namespace popo
+{
+template <typename T, typename H>
+inline SampleWindow<T, H>::ConstIterator::ConstIterator(const SampleWindow& sampleWindow,
+                                                        const uint64_t index) noexcept
+    : m_sampleWindow(&sampleWindow)
+    , m_index(index)
+{
+}
+
+template <typename T, typename H>
+inline const T& SampleWindow<T, H>::ConstIterator::operator*() const noexcept
+{
+    return *m_sampleWindow->getUserPayload(m_index);
+}
+
+template <typename T, typename H>
+inline const T* SampleWindow<T, H>::ConstIterator::operator->() const noexcept
+{
+    return m_sampleWindow->getUserPayload(m_index);
+}
+
+template <typename T, typename H>
+inline typename SampleWindow<T, H>::ConstIterator& SampleWindow<T, H>::ConstIterator::operator++() noexcept
+{
+    ++m_index;
+    return *this;
+}
+
+template <typename T, typename H>
+inline bool SampleWindow<T, H>::ConstIterator::operator==(const ConstIterator& rhs) const noexcept
+{
+    return m_sampleWindow == rhs.m_sampleWindow && m_index == rhs.m_index;
+}
+
+template <typename T, typename H>
+inline bool SampleWindow<T, H>::ConstIterator::operator!=(const ConstIterator& rhs) const noexcept
+{
+    return !(*this == rhs);
+}
+
+template <typename T, typename H>
+inline SampleWindow<T, H>::SampleWindow(const Window_t& window, bool& isWindowInUse) noexcept
+    : m_window(&window)
+    , m_isWindowInUse(&isWindowInUse)
+{
+    isWindowInUse = true;
+}
+
+template <typename T, typename H>
+inline SampleWindow<T, H>::SampleWindow(SampleWindow&& rhs) noexcept
+    : m_window(rhs.m_window)
+    , m_isWindowInUse(rhs.m_isWindowInUse)
+{
+    rhs.m_isWindowInUse = nullptr;
+}
+
+template <typename T, typename H>
+inline SampleWindow<T, H>& SampleWindow<T, H>::operator=(SampleWindow&& rhs) noexcept
+{
+    if (this != &rhs)
+    {
+        release();
+        m_window = rhs.m_window;
+        m_isWindowInUse = rhs.m_isWindowInUse;
+        rhs.m_isWindowInUse = nullptr;
+    }
+    return *this;
+}
+
+template <typename T, typename H>
+inline SampleWindow<T, H>::~SampleWindow() noexcept
+{
+    release();
+}
+
+template <typename T, typename H>
+inline void SampleWindow<T, H>::release() noexcept
+{
+    if (m_isWindowInUse != nullptr)
+    {
+        *m_isWindowInUse = false;
+        m_isWindowInUse = nullptr;
+    }
+}
+
+template <typename T, typename H>
+inline uint64_t SampleWindow<T, H>::size() const noexcept
+{
+    return m_window->size();
+}
+
+template <typename T, typename H>
+inline bool SampleWindow<T, H>::empty() const noexcept
+{
+    return m_window->size() == 0U;
+}
+
+template <typename T, typename H>
+template <typename S, typename>
+inline const S& SampleWindow<T, H>::operator[](const uint64_t index) const noexcept
+{
+    return *getUserPayload(index);
+}
+
+template <typename T, typename H>
+template <typename S, typename>
+inline const S& SampleWindow<T, H>::front() const noexcept
+{
+    return *getUserPayload(0U);
+}
+
+template <typename T, typename H>
+template <typename S, typename>
+inline const S& SampleWindow<T, H>::back() const noexcept
+{
+    return *getUserPayload(size() - 1U);
+}
+
+template <typename T, typename H>
+inline const T* SampleWindow<T, H>::getUserPayload(const uint64_t index) const noexcept
+{
+    return static_cast<const T*>(getChunkHeader(index)->userPayload());
+}
+
+template <typename T, typename H>
+inline const mepoo::ChunkHeader* SampleWindow<T, H>::getChunkHeader(const uint64_t index) const noexcept
+{
+    cxx::Expects(index < size());
+    return m_window->getChunkHeader(static_cast<uint32_t>(index));
+}
+
+template <typename T, typename H>
+template <typename R, typename>
+inline const R& SampleWindow<T, H>::getUserHeader(const uint64_t index) const noexcept
+{
+    return *static_cast<const R*>(getChunkHeader(index)->userHeader());
+}
+
+template <typename T, typename H>
+template <typename S, typename>
+inline typename SampleWindow<T, H>::ConstIterator SampleWindow<T, H>::begin() const noexcept
+{
+    return ConstIterator(*this, 0U);
+}
+
+template <typename T, typename H>
+template <typename S, typename>
+inline typename SampleWindow<T, H>::ConstIterator SampleWindow<T, H>::end() const noexcept
+{
+    return ConstIterator(*this, size());
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_SAMPLE_WINDOW_INL
@@ -0,0 +1,57 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_POPO_STATIC_PORT_POLICY_INL
+#define IOX_POSH_POPO_STATIC_PORT_POLICY_INL
+
+#include "iceoryx_posh/popo/static_port_policy.hpp"
+
+namespace iox
+{
+namespace popo
+{
+template <QueueFullPolicy QueueFull, ConsumerTooSlowPolicy SubscriberTooSlow, uint64_t HistoryCapacity>
+constexpr QueueFullPolicy StaticPortPolicy<QueueFull, SubscriberTooSlow, HistoryCapacity>::QUEUE_FULL_POLICY;
+template <QueueFullPolicy QueueFull, ConsumerTooSlowPolicy SubscriberTooSlow, uint64_t HistoryCapacity>
+constexpr ConsumerTooSlowPolicy
+    StaticPortPolicy<QueueFull, SubscriberTooSlow, HistoryCapacity>::SUBSCRIBER_TOO_SLOW_POLICY;
+template <QueueFullPolicy QueueFull, ConsumerTooSlowPolicy SubscriberTooSlow, uint64_t HistoryCapacity>
+constexpr uint64_t StaticPortPolicy<QueueFull, SubscriberTooSlow, HistoryCapacity>::HISTORY_CAPACITY;
+template <QueueFullPolicy QueueFull, ConsumerTooSlowPolicy SubscriberTooSlow, uint64_t HistoryCapacity>
+constexpr cxx::VariantQueueTypes StaticPortPolicy<QueueFull, SubscriberTooSlow, HistoryCapacity>::QUEUE_TYPE;
+
+template <QueueFullPolicy QueueFull, ConsumerTooSlowPolicy SubscriberTooSlow, uint64_t HistoryCapacity>
+inline PublisherOptions
+StaticPortPolicy<QueueFull, SubscriberTooSlow, HistoryCapacity>::apply(PublisherOptions options) noexcept
+{
+    options.subscriberTooSlowPolicy = SUBSCRIBER_TOO_SLOW_POLICY;
+    options.historyCapacity = HISTORY_CAPACITY;
+    return options;
+}
+
+template <QueueFullPolicy QueueFull, ConsumerTooSlowPolicy SubscriberTooSlow, uint64_t HistoryCapacity>
+inline SubscriberOptions
+StaticPortPolicy<QueueFull, SubscriberTooSlow, HistoryCapacity>::apply(SubscriberOptions options) noexcept
+{
+    options.queueFullPolicy = QUEUE_FULL_POLICY;
+    return options;
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_STATIC_PORT_POLICY_INL
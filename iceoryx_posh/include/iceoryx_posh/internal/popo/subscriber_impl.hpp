@@ -20,6 +20,7 @@
 
 #include "iceoryx_posh/internal/popo/base_subscriber.hpp"
 #include "iceoryx_posh/internal/popo/typed_port_api_trait.hpp"
+#include "iceoryx_posh/popo/sample_window.hpp"
 
 namespace iox
 {
@@ -52,6 +53,16 @@ class SubscriberImpl : public BaseSubscriberType
     ///
     cxx::expected<Sample<const T, const H>, ChunkReceiveResult> take() noexcept;
 
+    ///
+    /// @brief Moves all samples from the receive queue into the window of the latest samples, the oldest samples are
+    /// released when the window is full. The window must be enabled with SubscriberOptions::windowSize.
+    /// @return A read-only view of the latest samples or nullopt while the view of a previous call is still alive.
+    /// The samples are kept in the window until the view is destroyed.
+    /// @details In contrast to take, the samples are not tracked individually; this avoids the bookkeeping of every
+    /// sample when only the latest samples are of interest.
+    ///
+    cxx::optional<SampleWindow<T, H>> takeWindow() noexcept;
+
     using PortType = typename BaseSubscriberType::PortType;
 
   protected:
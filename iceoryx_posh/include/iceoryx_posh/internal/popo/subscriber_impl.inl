@@ -48,6 +48,16 @@ SubscriberImpl<T, H, BaseSubscriberType>::take() noexcept
     return cxx::success<Sample<const T, const H>>(std::move(samplePtr));
 }
 
+template <typename T, typename H, typename BaseSubscriberType>
+inline cxx::optional<SampleWindow<T, H>> SubscriberImpl<T, H, BaseSubscriberType>::takeWindow() noexcept
+{
+    if (BaseSubscriberType::m_isWindowInUse)
+    {
+        return cxx::nullopt;
+    }
+    return SampleWindow<T, H>(BaseSubscriberType::updateWindow(), BaseSubscriberType::m_isWindowInUse);
+}
+
 template <typename T, typename H, typename BaseSubscriberType>
 inline SubscriberImpl<T, H, BaseSubscriberType>::~SubscriberImpl() noexcept
 {
@@ -0,0 +1,109 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_POPO_TAKE_AWAITER_HPP
+#define IOX_POSH_POPO_TAKE_AWAITER_HPP
+
+#include "iceoryx_posh/internal/popo/coroutine_support.hpp"
+
+#include "iceoryx_hoofs/cxx/optional.hpp"
+
+namespace iox
+{
+namespace popo
+{
+namespace internal
+{
+/// @brief Awaits the next successful take of an awaitable port. The port provides
+///     - TakeResult_t, the result type of its take method
+///     - static bool isEmpty(const TakeResult_t&), which returns true when there was nothing to take
+///     - void setAwaiter(TakeAwaiter*), which registers the awaiter; the port calls tryTake on its event and resumes the
+///       returned coroutine
+/// @note Not intended for public usage! Use `co_await subscriber.next()` and `co_await server.nextRequest()` instead!
+template <typename AwaitablePort>
+class TakeAwaiter
+{
+  public:
+    using Result_t = typename AwaitablePort::TakeResult_t;
+
+    explicit TakeAwaiter(AwaitablePort& port) noexcept;
+
+    bool await_ready() noexcept;
+    void await_suspend(std::coroutine_handle<> handle) noexcept;
+    Result_t await_resume() noexcept;
+
+    /// @brief called by the port when its event occurred
+    /// @return the handle of the coroutine to resume or nullptr when there was nothing to take
+    std::coroutine_handle<> tryTake() noexcept;
+
+  private:
+    bool take() noexcept;
+
+  private:
+    AwaitablePort* m_port{nullptr};
+    std::coroutine_handle<> m_handle;
+    cxx::optional<Result_t> m_result;
+};
+
+template <typename AwaitablePort>
+inline TakeAwaiter<AwaitablePort>::TakeAwaiter(AwaitablePort& port) noexcept
+    : m_port(&port)
+{
+}
+
+template <typename AwaitablePort>
+inline bool TakeAwaiter<AwaitablePort>::await_ready() noexcept
+{
+    return take();
+}
+
+template <typename AwaitablePort>
+inline void TakeAwaiter<AwaitablePort>::await_suspend(std::coroutine_handle<> handle) noexcept
+{
+    m_handle = handle;
+    m_port->setAwaiter(this);
+}
+
+template <typename AwaitablePort>
+inline typename TakeAwaiter<AwaitablePort>::Result_t TakeAwaiter<AwaitablePort>::await_resume() noexcept
+{
+    return std::move(m_result.value());
+}
+
+template <typename AwaitablePort>
+inline std::coroutine_handle<> TakeAwaiter<AwaitablePort>::tryTake() noexcept
+{
+    return take() ? m_handle : std::coroutine_handle<>();
+}
+
+template <typename AwaitablePort>
+inline bool TakeAwaiter<AwaitablePort>::take() noexcept
+{
+    auto result = m_port->take();
+    if (AwaitablePort::isEmpty(result))
+    {
+        return false;
+    }
+    m_result.emplace(std::move(result));
+    return true;
+}
+
+} // namespace internal
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_TAKE_AWAITER_HPP
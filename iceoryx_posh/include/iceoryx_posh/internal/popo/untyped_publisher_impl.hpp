@@ -19,6 +19,7 @@
 #define IOX_POSH_POPO_UNTYPED_PUBLISHER_IMPL_HPP
 
 #include "iceoryx_posh/internal/popo/base_publisher.hpp"
+#include "iceoryx_posh/mepoo/multi_chunk_table.hpp"
 #include "iceoryx_posh/popo/sample.hpp"
 
 namespace iox
@@ -53,6 +54,22 @@ class UntypedPublisherImpl : public BasePublisherType
          const uint32_t userHeaderSize = iox::CHUNK_NO_USER_HEADER_SIZE,
          const uint32_t userHeaderAlignment = iox::CHUNK_NO_USER_HEADER_ALIGNMENT) noexcept;
 
+    ///
+    /// @brief Get a multi-chunk sample from loaned shared memory. The data is scattered over parts with the provided
+    /// sizes, each part is a chunk of its own from the best fitting mempool.
+    /// @param partSizes The user-payload sizes of the parts.
+    /// @param partAlignment The user-payload alignment of the parts.
+    /// @return A pointer to the MultiChunkTable which is the user-payload of the head chunk or an AllocationError if
+    ///         the head chunk or one of the parts could not be loaned.
+    /// @note The MultiChunkTable is published and released like a user-payload returned by loan; the parts are
+    ///       published and released together with it.
+    ///
+    cxx::expected<mepoo::MultiChunkTable*, AllocationError>
+    loanMultiChunk(const mepoo::MultiChunkTable::PartSizes_t& partSizes,
+                   const uint32_t partAlignment = iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT,
+                   const uint32_t userHeaderSize = iox::CHUNK_NO_USER_HEADER_SIZE,
+                   const uint32_t userHeaderAlignment = iox::CHUNK_NO_USER_HEADER_ALIGNMENT) noexcept;
+
     ///
     /// @brief Publish the provided memory chunk.
     /// @param userPayload Pointer to the user-payload of the allocated shared memory chunk.
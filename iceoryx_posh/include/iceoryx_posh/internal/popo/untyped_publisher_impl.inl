@@ -56,6 +56,25 @@ UntypedPublisherImpl<BasePublisherType>::loan(const uint32_t userPayloadSize,
     }
 }
 
+template <typename BasePublisherType>
+inline cxx::expected<mepoo::MultiChunkTable*, AllocationError>
+UntypedPublisherImpl<BasePublisherType>::loanMultiChunk(const mepoo::MultiChunkTable::PartSizes_t& partSizes,
+                                                        const uint32_t partAlignment,
+                                                        const uint32_t userHeaderSize,
+                                                        const uint32_t userHeaderAlignment) noexcept
+{
+    auto result = port().tryAllocateMultiChunk(partSizes, partAlignment, userHeaderSize, userHeaderAlignment);
+    if (result.has_error())
+    {
+        return cxx::error<AllocationError>(result.get_error());
+    }
+    else
+    {
+        auto multiChunkTable = static_cast<mepoo::MultiChunkTable*>(result.value()->userPayload());
+        return cxx::success<mepoo::MultiChunkTable*>(multiChunkTable);
+    }
+}
+
 template <typename BasePublisherType>
 inline void UntypedPublisherImpl<BasePublisherType>::release(void* const userPayload) noexcept
 {
@@ -23,6 +23,7 @@
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/popo/base_subscriber.hpp"
+#include "iceoryx_posh/popo/sample_window.hpp"
 
 namespace iox
 {
@@ -67,6 +68,15 @@ class UntypedSubscriberImpl : public BaseSubscriberType
     ///
     void release(const void* const userPayload) noexcept;
 
+    ///
+    /// @brief Moves all chunks from the receive queue into the window of the latest chunks, the oldest chunks are
+    /// released when the window is full. The window must be enabled with SubscriberOptions::windowSize.
+    /// @return A read-only view of the latest chunks or nullopt while the view of a previous call is still alive.
+    /// The chunks are kept in the window until the view is destroyed.
+    /// @details The chunks of the window must not be released with `release`.
+    ///
+    cxx::optional<SampleWindow<void>> takeWindow() noexcept;
+
   protected:
     using BaseSubscriber::port;
 };
@@ -49,6 +49,16 @@ inline void UntypedSubscriberImpl<BaseSubscriberType>::release(const void* const
     port().releaseChunk(chunkHeader);
 }
 
+template <typename BaseSubscriberType>
+inline cxx::optional<SampleWindow<void>> UntypedSubscriberImpl<BaseSubscriberType>::takeWindow() noexcept
+{
+    if (BaseSubscriber::m_isWindowInUse)
+    {
+        return cxx::nullopt;
+    }
+    return SampleWindow<void>(BaseSubscriber::updateWindow(), BaseSubscriber::m_isWindowInUse);
+}
+
 template <typename BaseSubscriberType>
 inline UntypedSubscriberImpl<BaseSubscriberType>::~UntypedSubscriberImpl() noexcept
 {
@@ -53,6 +53,11 @@ class UsedChunkList
     /// @note only from runtime context
     bool insert(mepoo::SharedChunk chunk) noexcept;
 
+    /// @brief Checks whether another chunk can be inserted
+    /// @return true if the list is not full
+    /// @note only from runtime context
+    bool hasFreeSpace() const noexcept;
+
     /// @brief Removes a chunk from the list
     /// @param[in] chunkHeader to look for a corresponding SharedChunk
     /// @param[out] chunk which is removed
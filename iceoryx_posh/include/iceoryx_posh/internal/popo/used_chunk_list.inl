@@ -63,6 +63,12 @@ bool UsedChunkList<Capacity>::insert(mepoo::SharedChunk chunk) noexcept
     }
 }
 
+template <uint32_t Capacity>
+bool UsedChunkList<Capacity>::hasFreeSpace() const noexcept
+{
+    return m_freeListHead != INVALID_INDEX;
+}
+
 template <uint32_t Capacity>
 bool UsedChunkList<Capacity>::remove(const mepoo::ChunkHeader* chunkHeader, mepoo::SharedChunk& chunk) noexcept
 {
@@ -28,9 +28,15 @@ inline WaitSet<Capacity>::WaitSet() noexcept
 }
 
 template <uint64_t Capacity>
-inline WaitSet<Capacity>::WaitSet(ConditionVariableData& condVarData) noexcept
+inline WaitSet<Capacity>::WaitSet(const WaitStrategy& waitStrategy) noexcept
+    : WaitSet(*runtime::PoshRuntime::getInstance().getMiddlewareConditionVariable(), waitStrategy)
+{
+}
+
+template <uint64_t Capacity>
+inline WaitSet<Capacity>::WaitSet(ConditionVariableData& condVarData, const WaitStrategy& waitStrategy) noexcept
     : m_conditionVariableDataPtr(&condVarData)
-    , m_conditionListener(condVarData)
+    , m_conditionListener(condVarData, waitStrategy)
 {
     for (uint64_t i = 0U; i < Capacity; ++i)
     {
@@ -42,6 +48,8 @@ template <uint64_t Capacity>
 inline WaitSet<Capacity>::~WaitSet() noexcept
 {
     removeAllTriggers();
+    // the socket disables itself in the condition variable, which is released to RouDi by the destruction flag
+    m_notificationSocket.reset();
     m_conditionVariableDataPtr->m_toBeDestroyed.store(true, std::memory_order_relaxed);
 }
 
@@ -272,10 +280,23 @@ inline typename WaitSet<Capacity>::NotificationInfoVector WaitSet<Capacity>::wai
 }
 
 template <uint64_t Capacity>
-inline typename WaitSet<Capacity>::NotificationInfoVector
-WaitSet<Capacity>::createVectorWithTriggeredTriggers() noexcept
+inline uint64_t WaitSet<Capacity>::timedWaitAndVisit(const units::Duration timeout,
+                                                     const NotificationInfoVisitor& visitor) noexcept
 {
-    NotificationInfoVector triggers;
+    return waitAndVisitTriggeredTriggers([this, timeout] { return this->m_conditionListener.timedWait(timeout); },
+                                         visitor);
+}
+
+template <uint64_t Capacity>
+inline uint64_t WaitSet<Capacity>::waitAndVisit(const NotificationInfoVisitor& visitor) noexcept
+{
+    return waitAndVisitTriggeredTriggers([this] { return this->m_conditionListener.wait(); }, visitor);
+}
+
+template <uint64_t Capacity>
+inline uint64_t WaitSet<Capacity>::visitTriggeredTriggers(const NotificationInfoVisitor& visitor) noexcept
+{
+    uint64_t numberOfTriggeredTriggers{0U};
     if (!m_activeNotifications.empty())
     {
         for (uint64_t i = m_activeNotifications.size() - 1U;; --i)
@@ -286,7 +307,8 @@ WaitSet<Capacity>::createVectorWithTriggeredTriggers() noexcept
 
             if (!doRemoveNotificationId && trigger->isStateConditionSatisfied())
             {
-                cxx::Expects(triggers.push_back(&m_triggerArray[index]->getNotificationInfo()));
+                visitor(m_triggerArray[index]->getNotificationInfo());
+                ++numberOfTriggeredTriggers;
                 doRemoveNotificationId = (trigger->getTriggerType() == TriggerType::EVENT_BASED);
             }
 
@@ -302,7 +324,7 @@ WaitSet<Capacity>::createVectorWithTriggeredTriggers() noexcept
         }
     }
 
-    return triggers;
+    return numberOfTriggeredTriggers;
 }
 
 template <uint64_t Capacity>
@@ -323,20 +345,75 @@ template <uint64_t Capacity>
 inline typename WaitSet<Capacity>::NotificationInfoVector
 WaitSet<Capacity>::waitAndReturnTriggeredTriggers(const WaitFunction& wait) noexcept
 {
+    NotificationInfoVector triggers;
+    waitAndVisitTriggeredTriggers(wait, [&](const NotificationInfo& notificationInfo) {
+        cxx::Expects(triggers.push_back(&notificationInfo));
+    });
+    return triggers;
+}
+
+template <uint64_t Capacity>
+inline uint64_t WaitSet<Capacity>::waitAndVisitTriggeredTriggers(const WaitFunction& wait,
+                                                                 const NotificationInfoVisitor& visitor) noexcept
+{
+    // the socket is drained before the listener consumes the notifications, a notification which arrives afterwards
+    // signals the socket again
+    if (m_notificationSocket)
+    {
+        m_notificationSocket->drain();
+    }
+
     if (m_conditionListener.wasNotified())
     {
         this->acquireNotifications(wait);
     }
 
-    NotificationInfoVector triggers = createVectorWithTriggeredTriggers();
+    uint64_t numberOfTriggeredTriggers = visitTriggeredTriggers(visitor);
+
+    if (numberOfTriggeredTriggers == 0U)
+    {
+        acquireNotifications(wait);
+        numberOfTriggeredTriggers = visitTriggeredTriggers(visitor);
+    }
+
+    rearmNotificationSocket();
+    return numberOfTriggeredTriggers;
+}
+
+template <uint64_t Capacity>
+inline void WaitSet<Capacity>::rearmNotificationSocket() noexcept
+{
+    if (!m_notificationSocket)
+    {
+        return;
+    }
 
-    if (!triggers.empty())
+    // a state based trigger which is still satisfied is returned by the next wait as well, without a new
+    // notification; the external reactor would not call it when the file descriptor stays drained
+    for (const auto index : m_activeNotifications)
     {
-        return triggers;
+        const auto& trigger = m_triggerArray[index];
+        if (trigger && trigger->getTriggerType() == TriggerType::STATE_BASED && trigger->isStateConditionSatisfied())
+        {
+            m_notificationSocket->rearm();
+            return;
+        }
     }
+}
 
-    acquireNotifications(wait);
-    return createVectorWithTriggeredTriggers();
+template <uint64_t Capacity>
+inline cxx::expected<int32_t, WaitSetError> WaitSet<Capacity>::getFileDescriptor() noexcept
+{
+    if (!m_notificationSocket)
+    {
+        auto result = NotificationSocket::create(*m_conditionVariableDataPtr);
+        if (result.has_error())
+        {
+            return cxx::error<WaitSetError>(WaitSetError::UNABLE_TO_CREATE_FILE_DESCRIPTOR);
+        }
+        m_notificationSocket.emplace(std::move(result.value()));
+    }
+    return cxx::success<int32_t>(m_notificationSocket->getFileDescriptor());
 }
 
 template <uint64_t Capacity>
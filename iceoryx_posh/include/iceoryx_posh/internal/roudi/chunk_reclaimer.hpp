@@ -0,0 +1,89 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_ROUDI_CHUNK_RECLAIMER_HPP
+#define IOX_POSH_ROUDI_CHUNK_RECLAIMER_HPP
+
+#include "iceoryx_hoofs/cxx/vector.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/unique_port_id.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief Reclaims the chunks which are lost when a process terminates while one of its ports holds a chunk outside
+/// of its containers, e.g. while the chunk is delivered. The ports of a terminated process are added as lost owners
+/// and the chunk managements of all memory managers are swept incrementally for references held by them; every
+/// sweep step checks a bounded number of chunk managements to keep the time in the monitoring thread of RouDi short.
+class ChunkReclaimer
+{
+  public:
+    static constexpr uint64_t DEFAULT_CHUNK_MANAGEMENTS_PER_SWEEP_STEP{4096U};
+    /// @brief the number of lost owners which can wait for a sweep
+    static constexpr uint32_t MAX_LOST_OWNERS{MAX_PUBLISHERS + MAX_CLIENTS + MAX_SERVERS};
+
+    using MemoryManagerList_t = cxx::vector<mepoo::MemoryManager*, MAX_SHM_SEGMENTS>;
+
+    /// @param[in] chunkManagementsPerSweepStep the number of chunk managements which are checked with one sweep step
+    explicit ChunkReclaimer(
+        const uint64_t chunkManagementsPerSweepStep = DEFAULT_CHUNK_MANAGEMENTS_PER_SWEEP_STEP) noexcept;
+
+    /// @brief adds a port of a terminated process; the chunks it still owns are reclaimed by the next full sweep
+    /// @param[in] owner the unique id of the port
+    /// @return false if too many lost owners are waiting for a sweep, the chunks of the port stay lost then
+    bool addLostOwner(const popo::UniquePortId owner) noexcept;
+
+    /// @brief returns true if lost owners are waiting for a sweep or a sweep is in progress
+    bool isSweepPending() const noexcept;
+
+    /// @brief Checks the next chunk managements for references of lost owners and releases them. A sweep starts with
+    /// the lost owners which were added until then and is finished when all chunk managements were checked; owners
+    /// which are added in the meantime are handled by the following sweep.
+    /// @param[in] memoryManagers the memory managers to sweep, they must be provided in the same order with every step
+    /// @return the number of chunks which were reclaimed in this step
+    uint64_t sweepStep(const MemoryManagerList_t& memoryManagers) noexcept;
+
+    /// @brief returns the number of chunks which were reclaimed since the creation of the ChunkReclaimer
+    uint64_t getNumberOfReclaimedChunks() const noexcept;
+
+    /// @brief returns the number of completed sweeps
+    uint64_t getNumberOfSweeps() const noexcept;
+
+  private:
+    bool isLostOwner(const uint64_t owner) const noexcept;
+    void finishSweep() noexcept;
+
+  private:
+    uint64_t m_chunkManagementsPerSweepStep{DEFAULT_CHUNK_MANAGEMENTS_PER_SWEEP_STEP};
+    /// @brief sorted lost owners of the current sweep
+    cxx::vector<uint64_t, MAX_LOST_OWNERS> m_sweptOwners;
+    cxx::vector<uint64_t, MAX_LOST_OWNERS> m_pendingOwners;
+    uint64_t m_memoryManagerIndex{0U};
+    uint64_t m_chunkManagementIndex{0U};
+    uint64_t m_reclaimedChunksOfSweep{0U};
+    uint64_t m_numberOfReclaimedChunks{0U};
+    uint64_t m_numberOfSweeps{0U};
+};
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_CHUNK_RECLAIMER_HPP
@@ -0,0 +1,118 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_ROUDI_HASH_BUCKET_INDEX_HPP
+#define IOX_POSH_ROUDI_HASH_BUCKET_INDEX_HPP
+
+#include "iceoryx_hoofs/cxx/function_ref.hpp"
+#include "iceoryx_hoofs/cxx/optional.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace roudi
+{
+namespace internal
+{
+/// @brief returns the smallest power of two which is not smaller than the value
+constexpr uint64_t nextPowerOfTwo(const uint64_t value, const uint64_t powerOfTwo = 1U) noexcept
+{
+    return (powerOfTwo >= value) ? powerOfTwo : nextPowerOfTwo(value, powerOfTwo * 2U);
+}
+} // namespace internal
+
+/// @brief Fixed capacity multi index from a 64 bit hash to values. The entries are chained per bucket and taken from
+/// a static pool, therefore no heap memory is used. It is the lookup structure of RouDi for the processes by name and
+/// for the ports by service description.
+/// @tparam T type of the values, e.g. a pointer or an iterator into the indexed container
+/// @tparam Capacity maximum number of entries
+/// @note entries with the same hash are not distinguished, the user has to compare the actual key in the callables
+template <typename T, uint64_t Capacity>
+class HashBucketIndex
+{
+  public:
+    static_assert(Capacity > 0U, "The capacity must be greater than zero!");
+    static_assert(Capacity < UINT32_MAX, "The capacity exceeds the supported range!");
+
+    HashBucketIndex() noexcept;
+    ~HashBucketIndex() noexcept = default;
+
+    HashBucketIndex(const HashBucketIndex&) = delete;
+    HashBucketIndex(HashBucketIndex&&) = delete;
+    HashBucketIndex& operator=(const HashBucketIndex&) = delete;
+    HashBucketIndex& operator=(HashBucketIndex&&) = delete;
+
+    /// @brief adds an entry
+    /// @param[in] hash of the key of the value
+    /// @param[in] value to add
+    /// @return false when the capacity is exhausted, otherwise true
+    bool add(const uint64_t hash, const T& value) noexcept;
+
+    /// @brief removes the first entry with the given hash for which the predicate returns true
+    /// @param[in] hash of the key of the value
+    /// @param[in] predicate which identifies the entry
+    /// @return true when an entry was removed, otherwise false
+    bool remove(const uint64_t hash, const cxx::function_ref<bool(const T&)> predicate) noexcept;
+
+    /// @brief returns the first value with the given hash for which the predicate returns true
+    /// @param[in] hash of the key of the value
+    /// @param[in] predicate which identifies the value
+    /// @return the value or nullopt when there is none
+    cxx::optional<T> find(const uint64_t hash, const cxx::function_ref<bool(const T&)> predicate) const noexcept;
+
+    /// @brief applies the callable to all values with the given hash
+    /// @param[in] hash of the key of the values
+    /// @param[in] callable which is applied to the values; must not add or remove entries of the index
+    void forEach(const uint64_t hash, const cxx::function_ref<void(const T&)> callable) const noexcept;
+
+    /// @brief removes all entries
+    void clear() noexcept;
+
+    /// @brief returns the number of entries
+    uint64_t size() const noexcept;
+
+    /// @brief returns the maximum number of entries
+    static constexpr uint64_t capacity() noexcept;
+
+  private:
+    static uint64_t bucketOf(const uint64_t hash) noexcept;
+
+    static constexpr uint32_t INVALID_INDEX{UINT32_MAX};
+    /// @brief the smallest power of two which is not smaller than the capacity, the load factor stays below one
+    static constexpr uint64_t NUMBER_OF_BUCKETS{internal::nextPowerOfTwo(Capacity)};
+
+    struct Entry
+    {
+        uint64_t hash{0U};
+        uint32_t next{INVALID_INDEX};
+        cxx::optional<T> value;
+    };
+
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    uint32_t m_buckets[NUMBER_OF_BUCKETS];
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    Entry m_entries[Capacity];
+    uint32_t m_freeListHead{0U};
+    uint64_t m_size{0U};
+};
+
+} // namespace roudi
+} // namespace iox
+
+#include "iceoryx_posh/internal/roudi/hash_bucket_index.inl"
+
+#endif // IOX_POSH_ROUDI_HASH_BUCKET_INDEX_HPP
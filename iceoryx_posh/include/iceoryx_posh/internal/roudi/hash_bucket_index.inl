@@ -0,0 +1,150 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_ROUDI_HASH_BUCKET_INDEX_INL
+#define IOX_POSH_ROUDI_HASH_BUCKET_INDEX_INL
+
+#include "iceoryx_posh/internal/roudi/hash_bucket_index.hpp"
+
+namespace iox
+{
+namespace roudi
+{
+template <typename T, uint64_t Capacity>
+constexpr uint32_t HashBucketIndex<T, Capacity>::INVALID_INDEX;
+
+template <typename T, uint64_t Capacity>
+constexpr uint64_t HashBucketIndex<T, Capacity>::NUMBER_OF_BUCKETS;
+
+template <typename T, uint64_t Capacity>
+inline HashBucketIndex<T, Capacity>::HashBucketIndex() noexcept
+{
+    clear();
+}
+
+template <typename T, uint64_t Capacity>
+inline uint64_t HashBucketIndex<T, Capacity>::bucketOf(const uint64_t hash) noexcept
+{
+    return hash & (NUMBER_OF_BUCKETS - 1U);
+}
+
+template <typename T, uint64_t Capacity>
+inline bool HashBucketIndex<T, Capacity>::add(const uint64_t hash, const T& value) noexcept
+{
+    if (m_freeListHead == INVALID_INDEX)
+    {
+        return false;
+    }
+
+    const auto index = m_freeListHead;
+    auto& entry = m_entries[index];
+    m_freeListHead = entry.next;
+
+    auto& bucket = m_buckets[bucketOf(hash)];
+    entry.hash = hash;
+    entry.value.emplace(value);
+    entry.next = bucket;
+    bucket = index;
+    ++m_size;
+    return true;
+}
+
+template <typename T, uint64_t Capacity>
+inline bool HashBucketIndex<T, Capacity>::remove(const uint64_t hash,
+                                                 const cxx::function_ref<bool(const T&)> predicate) noexcept
+{
+    // points to the link which refers to the current entry, either the bucket or the next index of the predecessor
+    uint32_t* link = &m_buckets[bucketOf(hash)];
+    while (*link != INVALID_INDEX)
+    {
+        auto& entry = m_entries[*link];
+        if (entry.hash == hash && predicate(*entry.value))
+        {
+            const auto index = *link;
+            *link = entry.next;
+            entry.value.reset();
+            entry.next = m_freeListHead;
+            m_freeListHead = index;
+            --m_size;
+            return true;
+        }
+        link = &entry.next;
+    }
+    return false;
+}
+
+template <typename T, uint64_t Capacity>
+inline cxx::optional<T>
+HashBucketIndex<T, Capacity>::find(const uint64_t hash, const cxx::function_ref<bool(const T&)> predicate) const
+    noexcept
+{
+    for (auto index = m_buckets[bucketOf(hash)]; index != INVALID_INDEX; index = m_entries[index].next)
+    {
+        const auto& entry = m_entries[index];
+        if (entry.hash == hash && predicate(*entry.value))
+        {
+            return entry.value;
+        }
+    }
+    return cxx::nullopt;
+}
+
+template <typename T, uint64_t Capacity>
+inline void HashBucketIndex<T, Capacity>::forEach(const uint64_t hash,
+                                                  const cxx::function_ref<void(const T&)> callable) const noexcept
+{
+    for (auto index = m_buckets[bucketOf(hash)]; index != INVALID_INDEX; index = m_entries[index].next)
+    {
+        const auto& entry = m_entries[index];
+        if (entry.hash == hash)
+        {
+            callable(*entry.value);
+        }
+    }
+}
+
+template <typename T, uint64_t Capacity>
+inline void HashBucketIndex<T, Capacity>::clear() noexcept
+{
+    for (auto& bucket : m_buckets)
+    {
+        bucket = INVALID_INDEX;
+    }
+    for (uint64_t i = 0U; i < Capacity; ++i)
+    {
+        m_entries[i].value.reset();
+        m_entries[i].next = (i + 1U < Capacity) ? static_cast<uint32_t>(i + 1U) : INVALID_INDEX;
+    }
+    m_freeListHead = 0U;
+    m_size = 0U;
+}
+
+template <typename T, uint64_t Capacity>
+inline uint64_t HashBucketIndex<T, Capacity>::size() const noexcept
+{
+    return m_size;
+}
+
+template <typename T, uint64_t Capacity>
+inline constexpr uint64_t HashBucketIndex<T, Capacity>::capacity() noexcept
+{
+    return Capacity;
+}
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_HASH_BUCKET_INDEX_INL
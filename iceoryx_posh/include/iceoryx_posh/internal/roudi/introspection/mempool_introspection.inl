@@ -160,6 +160,11 @@ MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::copyMemPoolI
         dst.m_numChunks = src.m_numChunks;
         dst.m_chunkSize = src.m_chunkSize;
         dst.m_chunkPayloadSize = src.m_chunkSize - static_cast<uint32_t>(sizeof(mepoo::ChunkHeader));
+        dst.m_reservedChunks = memoryManager.getNumberOfReservedChunks(i);
+        dst.m_rejectedChunkRequests = memoryManager.getNumberOfRejectedChunkRequests(i);
+        dst.m_reclaimedChunks = memoryManager.getNumberOfReclaimedChunks(i);
+        dst.m_numaNode = memoryManager.getMemPoolNumaNode(i);
+        memoryManager.sampleMemPoolNumaDistribution(i, dst.m_sampledPagesPerNumaNode);
     }
 }
 
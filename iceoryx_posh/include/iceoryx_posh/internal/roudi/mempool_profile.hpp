@@ -0,0 +1,97 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_ROUDI_MEMPOOL_PROFILE_HPP
+#define IOX_POSH_ROUDI_MEMPOOL_PROFILE_HPP
+
+#include "iceoryx_hoofs/cxx/expected.hpp"
+#include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
+#include "iceoryx_posh/internal/mepoo/chunk_size_histogram.hpp"
+#include "iceoryx_posh/internal/mepoo/segment_manager.hpp"
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief The usage profile of the mempools of all segments, recorded by the MemoryManager of every segment. It is
+/// written by RouDi on shutdown and used by iox-mempool-advisor to derive a configuration from the actual usage.
+///
+/// The file is line based, the order of the lines is the order of the segments and mempools in the config:
+/// @code
+///     iceoryx-mempool-profile 1
+///     segment <writer group> <reader group>
+///     mempool <chunk-payload size> <number of chunks> <max used chunks> <allocation failures>
+///     requests <largest chunk-payload size of the histogram bucket> <number of requests>
+///     too-large-requests <number of requests without a fitting mempool>
+/// @endcode
+/// Only histogram buckets with at least one request are written. The number of requests is sampled by
+/// ChunkSizeHistogram and therefore an estimate.
+
+constexpr const char MEMPOOL_PROFILE_HEADER[] = "iceoryx-mempool-profile";
+constexpr uint32_t MEMPOOL_PROFILE_VERSION{1U};
+
+struct MemPoolProfile
+{
+    uint32_t m_chunkPayloadSize{0U};
+    uint32_t m_numberOfChunks{0U};
+    uint32_t m_maxUsedChunks{0U};
+    uint64_t m_allocationFailures{0U};
+};
+
+struct SegmentProfile
+{
+    struct RequestCount
+    {
+        uint64_t m_maxChunkPayloadSize{0U};
+        uint64_t m_count{0U};
+    };
+
+    posix::PosixGroup::groupName_t m_writerGroup;
+    posix::PosixGroup::groupName_t m_readerGroup;
+    std::vector<MemPoolProfile> m_mempools;
+    /// @brief the non empty buckets of the histogram of the requested chunk-payload sizes, ordered by size
+    std::vector<RequestCount> m_requests;
+    uint64_t m_tooLargeRequests{0U};
+};
+
+using SegmentProfiles_t = std::vector<SegmentProfile>;
+
+enum class MemPoolProfileError
+{
+    INVALID_HEADER,
+    INCOMPATIBLE_VERSION,
+    INVALID_LINE,
+    ENTRY_WITHOUT_SEGMENT
+};
+
+/// @brief collects the current usage profile of all segments
+SegmentProfiles_t createMemPoolProfile(mepoo::SegmentManager<>& segmentManager) noexcept;
+
+/// @brief writes the profile in the format described above
+void writeMemPoolProfile(std::ostream& stream, const SegmentProfiles_t& profile) noexcept;
+
+/// @brief parses a profile which was written with writeMemPoolProfile
+cxx::expected<SegmentProfiles_t, MemPoolProfileError> readMemPoolProfile(std::istream& stream) noexcept;
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_MEMPOOL_PROFILE_HPP
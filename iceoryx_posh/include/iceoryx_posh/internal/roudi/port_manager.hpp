@@ -17,6 +17,7 @@
 #ifndef IOX_POSH_ROUDI_PORT_MANAGER_HPP
 #define IOX_POSH_ROUDI_PORT_MANAGER_HPP
 
+#include "iceoryx_hoofs/cxx/function_ref.hpp"
 #include "iceoryx_hoofs/cxx/optional.hpp"
 #include "iceoryx_hoofs/cxx/type_traits.hpp"
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object.hpp"
@@ -36,7 +37,9 @@
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_single_producer.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_user.hpp"
 #include "iceoryx_posh/internal/roudi/introspection/port_introspection.hpp"
+#include "iceoryx_posh/internal/roudi/service_port_index.hpp"
 #include "iceoryx_posh/internal/roudi/service_registry.hpp"
+#include "iceoryx_posh/internal/roudi/service_registry_update.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_message.hpp"
 #include "iceoryx_posh/internal/runtime/node_data.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
@@ -123,6 +126,17 @@ class PortManager
     cxx::expected<popo::ConditionVariableData*, PortPoolError>
     acquireConditionVariableData(const RuntimeName_t& runtimeName) noexcept;
 
+    cxx::expected<runtime::RuntimeRequestChannelData*, PortPoolError>
+    acquireRuntimeRequestChannelData(const RuntimeName_t& runtimeName) noexcept;
+
+    /// @brief Releases a request channel. It is not released by deletePortsOfProcess since the response to the
+    /// TERMINATION request of the runtime is sent via the request channel after the ports were deleted.
+    /// @param [in] requestChannelData which was acquired with acquireRuntimeRequestChannelData
+    void releaseRuntimeRequestChannelData(const runtime::RuntimeRequestChannelData* const requestChannelData) noexcept;
+
+    /// @brief returns the doorbell which is rung by the runtimes when a request was written to their request channel
+    concurrent::FutexEvent& runtimeRequestDoorbell() noexcept;
+
     /// @brief Used to unblock potential locks in the shutdown phase of a process
     /// @param [in] name of the process runtime which is about to shut down
     void unblockProcessShutdown(const RuntimeName_t& runtimeName) noexcept;
@@ -132,6 +146,13 @@ class PortManager
 
     void deletePortsOfProcess(const RuntimeName_t& runtimeName) noexcept;
 
+    /// @brief calls the provided callable with the unique id of every port of the process which acquires chunks, i.e.
+    /// the publisher, server and client ports
+    /// @param[in] runtimeName of the process
+    /// @param[in] callable which is called with the unique id of the port
+    void forEachChunkSenderOfProcess(const RuntimeName_t& runtimeName,
+                                     const cxx::function_ref<void(const popo::UniquePortId)> callable) noexcept;
+
   protected:
     void makeAllPublisherPortsToStopOffer() noexcept;
 
@@ -170,9 +191,18 @@ class PortManager
     bool isCompatiblePubSub(const PublisherPortRouDiType& publisher,
                             const SubscriberPortType& subscriber) const noexcept;
 
+    /// @brief dispatches the message to all publishers with the service description of the subscriber
+    /// @note A non-internal publisher with the same interface as the message is skipped to avoid cyclic connections in
+    /// gateways. Before the ports were indexed, such a publisher stopped the whole loop over the port pool, i.e. the
+    /// result depended on the order of the ports in the pool. Now only this publisher is skipped and all other
+    /// publishers of the service are still matched.
+    /// @return true if at least one compatible publisher was found, otherwise false
     bool sendToAllMatchingPublisherPorts(const capro::CaproMessage& message,
                                          SubscriberPortType& subscriberSource) noexcept;
 
+    /// @brief dispatches the message to all subscribers with the service description of the publisher
+    /// @note A non-internal subscriber with the same interface as the message is skipped like in
+    /// sendToAllMatchingPublisherPorts, all other subscribers of the service are still matched.
     void sendToAllMatchingSubscriberPorts(const capro::CaproMessage& message,
                                           PublisherPortRouDiType& publisherSource) noexcept;
 
@@ -200,7 +230,13 @@ class PortManager
 
     bool isInternal(const capro::ServiceDescription& service) const noexcept;
 
-    void publishServiceRegistry() const noexcept;
+    /// @brief publishes the change of the service registry; every SERVICE_REGISTRY_SNAPSHOT_INTERVAL-th update or when
+    /// a previous update could not be published a snapshot is published instead
+    void publishServiceRegistryChange(const ServiceRegistryUpdate::Type type,
+                                      const capro::ServiceDescription& service) noexcept;
+
+    /// @brief publishes a snapshot with all entries of the service registry
+    void publishServiceRegistrySnapshot() noexcept;
 
     const ServiceRegistry& serviceRegistry() const noexcept;
 
@@ -212,6 +248,14 @@ class PortManager
     cxx::vector<capro::ServiceDescription, NUMBER_OF_INTERNAL_PUBLISHERS> m_internalServices;
     cxx::optional<PublisherPortRouDiType::MemberType_t*> m_serviceRegistryPublisherPortData;
 
+    // the ports of the PortPool by the hash of their service description, used for matching the ports
+    ServicePortIndex<PublisherPortRouDiType::MemberType_t, MAX_PUBLISHERS> m_publisherPortIndex;
+    ServicePortIndex<SubscriberPortType::MemberType_t, MAX_SUBSCRIBERS> m_subscriberPortIndex;
+    ServicePortIndex<popo::ServerPortData, MAX_SERVERS> m_serverPortIndex;
+    ServicePortIndex<popo::ClientPortData, MAX_CLIENTS> m_clientPortIndex;
+    uint64_t m_serviceRegistryVersion{0U};
+    bool m_isServiceRegistrySnapshotRequired{true};
+
     // some ports for the service registry requires special handling
     // as we cannot send registry information if it was not created yet
     cxx::expected<PublisherPortRouDiType::MemberType_t*, PortPoolError>
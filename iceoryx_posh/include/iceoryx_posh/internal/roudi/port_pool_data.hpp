@@ -27,6 +27,7 @@
 #include "iceoryx_posh/internal/popo/ports/server_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_data.hpp"
 #include "iceoryx_posh/internal/runtime/node_data.hpp"
+#include "iceoryx_posh/internal/runtime/runtime_request_channel_data.hpp"
 
 namespace iox
 {
@@ -63,6 +64,10 @@ struct PortPoolData
 
     FixedPositionContainer<iox::popo::ServerPortData, MAX_SERVERS> m_serverPortMembers;
     FixedPositionContainer<iox::popo::ClientPortData, MAX_CLIENTS> m_clientPortMembers;
+
+    FixedPositionContainer<runtime::RuntimeRequestChannelData, MAX_PROCESS_NUMBER> m_runtimeRequestChannelMembers;
+    /// @brief rung by the runtimes when a request was written to their RuntimeRequestChannelData
+    concurrent::FutexEvent m_runtimeRequestDoorbell;
 };
 
 } // namespace roudi
@@ -23,6 +23,7 @@
 #include "iceoryx_posh/internal/roudi/introspection/process_introspection.hpp"
 #include "iceoryx_posh/internal/roudi/port_manager.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_interface_user.hpp"
+#include "iceoryx_posh/internal/runtime/runtime_request_channel.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iceoryx_posh/version/compatibility_check_level.hpp"
 #include "iceoryx_posh/version/version_info.hpp"
@@ -45,25 +46,38 @@ class Process
     /// @param [in] isMonitored indicates if the process should be monitored for being alive
     /// @param [in] dataSegmentId is an identifier for the shm data segment
     /// @param [in] sessionId is an ID generated by RouDi to prevent sending outdated IPC channel transmission
+    /// @param [in] requestChannelData is the shared memory request channel of the process, if it has one
     Process(const RuntimeName_t& name,
             const uint32_t pid,
             const posix::PosixUser& user,
             const bool isMonitored,
-            const uint64_t sessionId) noexcept;
+            const uint64_t sessionId,
+            runtime::RuntimeRequestChannelData* const requestChannelData = nullptr) noexcept;
 
     Process(const Process& other) = delete;
     Process& operator=(const Process& other) = delete;
     /// @note the move cTor and assignment operator are already implicitly deleted because of the atomic
     Process(Process&& other) = delete;
     Process& operator=(Process&& other) = delete;
-    ~Process() noexcept = default;
+    ~Process() noexcept;
 
     uint32_t getPid() const noexcept;
 
     const RuntimeName_t getName() const noexcept;
 
+    /// @brief Sends the message to the process. When a request from the shared memory request channel is in progress
+    /// the message is the response to this request and is sent via the request channel.
     void sendViaIpcChannel(const runtime::IpcMessage& data) noexcept;
 
+    /// @brief Takes the pending request from the shared memory request channel of the process
+    /// @return the request or nullopt if there is none
+    cxx::optional<runtime::IpcMessage> takePendingRequest() noexcept;
+
+    /// @brief The shared memory request channel of the process. It is not released together with the process since
+    /// the runtime may still read the response to its last request.
+    /// @return the request channel data or nullptr if the process has none
+    runtime::RuntimeRequestChannelData* getRequestChannelData() const noexcept;
+
     /// @brief The session ID which is used to check outdated IPC channel transmissions for this process
     /// @return the session ID for this process
     uint64_t getSessionId() noexcept;
@@ -76,13 +90,28 @@ class Process
 
     bool isMonitored() const noexcept;
 
+    /// @brief The process file descriptor which becomes readable when the process terminates. It is only acquired for
+    /// monitored processes on platforms which support it.
+    /// @return the file descriptor or nullopt if there is none
+    cxx::optional<int32_t> getPidFileDescriptor() const noexcept;
+
+    /// @brief Checks via the process file descriptor whether the process has terminated
+    /// @return true when the process has terminated, false when it is still running or there is no process file
+    /// descriptor
+    bool hasTerminated() const noexcept;
+
   private:
+    static constexpr int32_t INVALID_PID_FILE_DESCRIPTOR{-1};
+
     const uint32_t m_pid{0U};
     runtime::IpcInterfaceUser m_ipcChannel;
+    runtime::RuntimeRequestChannelData* m_requestChannelData{nullptr};
+    cxx::optional<runtime::RuntimeRequestChannel> m_requestChannel;
     mepoo::TimePointNs_t m_timestamp;
     posix::PosixUser m_user;
     bool m_isMonitored{true};
     std::atomic<uint64_t> m_sessionId{0U};
+    int32_t m_pidFileDescriptor{INVALID_PID_FILE_DESCRIPTOR};
 };
 
 } // namespace roudi
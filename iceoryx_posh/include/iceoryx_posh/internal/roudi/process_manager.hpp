@@ -18,11 +18,15 @@
 #define IOX_POSH_ROUDI_PROCESS_MANAGER_HPP
 
 #include "iceoryx_hoofs/cxx/list.hpp"
+#include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
 #include "iceoryx_posh/internal/mepoo/segment_manager.hpp"
+#include "iceoryx_posh/internal/roudi/chunk_reclaimer.hpp"
+#include "iceoryx_posh/internal/roudi/hash_bucket_index.hpp"
 #include "iceoryx_posh/internal/roudi/introspection/process_introspection.hpp"
 #include "iceoryx_posh/internal/roudi/port_manager.hpp"
 #include "iceoryx_posh/internal/roudi/process.hpp"
+#include "iceoryx_posh/internal/roudi/process_termination_monitor.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_interface_user.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iceoryx_posh/version/compatibility_check_level.hpp"
@@ -49,15 +53,25 @@ class ProcessManager : public ProcessManagerInterface
     using ProcessList_t = cxx::list<Process, MAX_PROCESS_NUMBER>;
     using PortConfigInfo = iox::runtime::PortConfigInfo;
 
+    struct RuntimeRequest
+    {
+        RuntimeName_t runtimeName;
+        runtime::IpcMessage message;
+    };
+    using RuntimeRequestList_t = cxx::vector<RuntimeRequest, MAX_PROCESS_NUMBER>;
+
     enum class TerminationFeedback
     {
         SEND_ACK_TO_PROCESS,
         DO_NOT_SEND_ACK_TO_PROCESS
     };
 
+    /// @param [in] processTerminationMonitor optional monitor to which the monitored processes are added; without it
+    /// terminated processes are only detected by the keep alive timeout
     ProcessManager(RouDiMemoryInterface& roudiMemoryInterface,
                    PortManager& portManager,
-                   const version::CompatibilityCheckLevel compatibilityCheckLevel) noexcept;
+                   const version::CompatibilityCheckLevel compatibilityCheckLevel,
+                   ProcessTerminationMonitor* const processTerminationMonitor = nullptr) noexcept;
     virtual ~ProcessManager() noexcept override = default;
 
     ProcessManager(const ProcessManager& other) = delete;
@@ -148,13 +162,23 @@ class ProcessManager : public ProcessManagerInterface
 
     void initIntrospection(ProcessIntrospectionType* processIntrospection) noexcept;
 
+    /// @brief monitors the processes, updates the discovery, continues the sweep for chunks which were lost by
+    /// terminated processes and releases the request channels of removed processes which are not used anymore
     void run() noexcept;
 
+    /// @brief returns the number of chunks which were lost by terminated processes and reclaimed
+    uint64_t getNumberOfReclaimedChunks() const noexcept;
+
     popo::PublisherPortData* addIntrospectionPublisherPort(const capro::ServiceDescription& service) noexcept;
 
     /// @brief Notify the application that it sent an unsupported message
     void sendMessageNotSupportedToRuntime(const RuntimeName_t& name) noexcept;
 
+    /// @brief Takes the pending requests from the shared memory request channels of all processes. The responses are
+    /// sent via the request channels when the requests are processed.
+    /// @return the requests together with the name of the requesting runtime
+    RuntimeRequestList_t takePendingRuntimeRequests() noexcept;
+
 
   private:
     cxx::optional<Process*> findProcess(const RuntimeName_t& name) noexcept;
@@ -162,6 +186,23 @@ class ProcessManager : public ProcessManagerInterface
     void monitorProcesses() noexcept;
     void discoveryUpdate() noexcept override;
 
+    /// @brief Adds the ports of a process which has terminated to the lost owners of the chunk reclaimer; the ports
+    /// of a process which is still running are not added, e.g. when it was removed due to the keep alive timeout
+    /// @param [in] process which is removed
+    void addLostChunkOwnersOfProcess(const Process& process) noexcept;
+
+    /// @brief performs the next step of the sweep for chunks which were lost by terminated processes
+    void reclaimLostChunks() noexcept;
+
+    /// @brief Releases the request channel of a removed process when its runtime cannot access it anymore, otherwise
+    /// the release is postponed to releasePendingRequestChannels
+    /// @param [in] process which is removed
+    /// @param [in] feedback whether a TERMINATION_ACK was sent to the process
+    void releaseRequestChannelOfProcess(const Process& process, const TerminationFeedback feedback) noexcept;
+
+    /// @brief Releases the postponed request channels whose runtime has taken the TERMINATION_ACK or has terminated
+    void releasePendingRequestChannels() noexcept;
+
     /// @param [in] name of the process; this is equal to the IPC channel name, which is used for communication
     /// @param [in] pid is the host system process id
     /// @param [in] user is user used in the operating system for this process
@@ -184,6 +225,14 @@ class ProcessManager : public ProcessManagerInterface
     /// @return Returns true if the process was found and removed from the internal list.
     bool searchForProcessAndRemoveIt(const RuntimeName_t& name, const TerminationFeedback feedback) noexcept;
 
+    /// @brief Looks up the process in m_processIndex
+    /// @param [in] name of the process
+    /// @return the iterator into m_processList or nullopt when there is no process with this name
+    cxx::optional<ProcessList_t::iterator> findInProcessIndex(const RuntimeName_t& name) noexcept;
+
+    /// @brief Removes the given process from m_processIndex, the process list is not changed
+    void removeFromProcessIndex(const ProcessList_t::iterator& processIter) noexcept;
+
     /// @brief Removes the given process from the managed client process list and the respective resources in shared
     /// memory
     /// @param [in] processIter The process which should be removed.
@@ -227,8 +276,21 @@ class ProcessManager : public ProcessManagerInterface
     mepoo::MemoryManager* m_introspectionMemoryManager{nullptr};
     rp::BaseRelativePointer::id_underlying_t m_mgmtSegmentId{rp::BaseRelativePointer::NULL_POINTER_ID};
     ProcessList_t m_processList;
+    /// @brief index into m_processList for constant time lookups of a process by its name
+    HashBucketIndex<ProcessList_t::iterator, MAX_PROCESS_NUMBER> m_processIndex;
     ProcessIntrospectionType* m_processIntrospection{nullptr};
     version::CompatibilityCheckLevel m_compatibilityCheckLevel;
+    ProcessTerminationMonitor* m_processTerminationMonitor{nullptr};
+    ChunkReclaimer m_chunkReclaimer;
+
+    struct PendingRequestChannelRelease
+    {
+        runtime::RuntimeRequestChannelData* requestChannelData{nullptr};
+        uint32_t pid{0U};
+        bool isTerminationAckSent{false};
+    };
+    /// @brief request channels of removed processes which may still be accessed by their runtime
+    cxx::vector<PendingRequestChannelRelease, MAX_PROCESS_NUMBER> m_pendingRequestChannelReleases;
 };
 
 } // namespace roudi
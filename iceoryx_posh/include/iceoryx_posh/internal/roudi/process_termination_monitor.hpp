@@ -0,0 +1,65 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_ROUDI_PROCESS_TERMINATION_MONITOR_HPP
+#define IOX_POSH_ROUDI_PROCESS_TERMINATION_MONITOR_HPP
+
+#include "iceoryx_hoofs/internal/units/duration.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief Waits for the termination of the registered processes with the process file descriptors of the platform.
+/// This allows RouDi to clean up a crashed application right away instead of waiting for the keep alive timeout. On
+/// platforms without process file descriptors the monitor is not available, wait() then just sleeps and the keep
+/// alive timeout detects terminated processes.
+class ProcessTerminationMonitor
+{
+  public:
+    ProcessTerminationMonitor() noexcept;
+    ~ProcessTerminationMonitor() noexcept;
+
+    ProcessTerminationMonitor(const ProcessTerminationMonitor&) = delete;
+    ProcessTerminationMonitor(ProcessTerminationMonitor&&) = delete;
+    ProcessTerminationMonitor& operator=(const ProcessTerminationMonitor&) = delete;
+    ProcessTerminationMonitor& operator=(ProcessTerminationMonitor&&) = delete;
+
+    /// @brief returns true when the platform supports the monitoring of processes via process file descriptors
+    bool isAvailable() const noexcept;
+
+    /// @brief adds a process to the monitored processes; the process is removed when the pid file descriptor is closed
+    /// @param[in] pidFileDescriptor of the process, see Process::getPidFileDescriptor
+    /// @return true if the process is monitored, false otherwise
+    bool add(const int32_t pidFileDescriptor) noexcept;
+
+    /// @brief blocks until a monitored process has terminated or the timeout has expired
+    /// @param[in] timeout the maximum time to wait
+    /// @return true when a monitored process has terminated, false on timeout
+    bool wait(const units::Duration timeout) noexcept;
+
+  private:
+    static constexpr int32_t INVALID_FILE_DESCRIPTOR{-1};
+    int32_t m_pidFileDescriptorSet{INVALID_FILE_DESCRIPTOR};
+};
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_PROCESS_TERMINATION_MONITOR_HPP
@@ -60,12 +60,14 @@ class RouDi
             const bool killProcessesInDestructor = true,
             const RuntimeMessagesThreadStart RuntimeMessagesThreadStart = RuntimeMessagesThreadStart::IMMEDIATE,
             const version::CompatibilityCheckLevel compatibilityCheckLevel = version::CompatibilityCheckLevel::PATCH,
-            const units::Duration processKillDelay = roudi::PROCESS_DEFAULT_KILL_DELAY) noexcept
+            const units::Duration processKillDelay = roudi::PROCESS_DEFAULT_KILL_DELAY,
+            const roudi::ConfigFilePathString_t& mempoolProfilePath = "") noexcept
             : m_monitoringMode(monitoringMode)
             , m_killProcessesInDestructor(killProcessesInDestructor)
             , m_runtimesMessagesThreadStart(RuntimeMessagesThreadStart)
             , m_compatibilityCheckLevel(compatibilityCheckLevel)
             , m_processKillDelay(processKillDelay)
+            , m_mempoolProfilePath(mempoolProfilePath)
         {
         }
 
@@ -74,6 +76,8 @@ class RouDi
         const RuntimeMessagesThreadStart m_runtimesMessagesThreadStart;
         const version::CompatibilityCheckLevel m_compatibilityCheckLevel;
         const units::Duration m_processKillDelay;
+        /// @brief the usage profile of the mempools is written to this file on shutdown, nothing is written if empty
+        const roudi::ConfigFilePathString_t m_mempoolProfilePath;
     };
 
     RouDi& operator=(const RouDi& other) = delete;
@@ -86,8 +90,8 @@ class RouDi
     virtual ~RouDi() noexcept;
 
   protected:
-    /// @brief Starts the thread processing messages from the runtimes
-    /// Once this is done, applications can register and Roudi is fully operational.
+    /// @brief Starts the threads processing messages from the runtimes, i.e. from RouDi's IPC channel and from the
+    /// shared memory request channels. Once this is done, applications can register and Roudi is fully operational.
     void startProcessRuntimeMessagesThread() noexcept;
 
     /// @brief Stops threads and kills all process known to RouDi
@@ -95,6 +99,7 @@ class RouDi
     ///
     /// @note Intentionally not virtual to be able to call it in derived class
     void shutdown() noexcept;
+
     virtual void processMessage(const runtime::IpcMessage& message,
                                 const iox::runtime::IpcMessageType& cmd,
                                 const RuntimeName_t& runtimeName) noexcept;
@@ -127,8 +132,17 @@ class RouDi
   private:
     void processRuntimeMessages() noexcept;
 
+    /// @brief serves the requests of the runtimes which use a shared memory request channel; all pending requests are
+    /// processed with one wakeup of the doorbell
+    /// @note the requests are processed one after another since they are serialized by the ProcessManager lock anyway;
+    /// the PortPool, the port indices of the PortManager and the service registry are not thread safe
+    void processRuntimeRequestChannels() noexcept;
+
     void monitorAndDiscoveryUpdate() noexcept;
 
+    /// @brief writes the usage profile of the mempools to RoudiStartupParameters::m_mempoolProfilePath
+    void dumpMemPoolProfile() noexcept;
+
     cxx::GenericRAII m_unregisterRelativePtr{[] { rp::BaseRelativePointer::unregisterAll(); }};
     bool m_killProcessesInDestructor;
     std::atomic_bool m_runMonitoringAndDiscoveryThread;
@@ -148,11 +162,14 @@ class RouDi
         };
     }};
     PortManager* m_portManager{nullptr};
+    /// @note must be declared before m_prcMgr since the ProcessManager adds the processes to it
+    ProcessTerminationMonitor m_processTerminationMonitor;
     concurrent::smart_lock<ProcessManager> m_prcMgr;
 
   private:
     std::thread m_monitoringAndDiscoveryThread;
     std::thread m_handleRuntimeMessageThread;
+    std::thread m_handleRuntimeRequestChannelThread;
 
   protected:
     ProcessIntrospectionType m_processIntrospection;
@@ -161,6 +178,7 @@ class RouDi
   private:
     roudi::MonitoringMode m_monitoringMode{roudi::MonitoringMode::ON};
     units::Duration m_processKillDelay;
+    roudi::ConfigFilePathString_t m_mempoolProfilePath;
 };
 
 } // namespace roudi
@@ -0,0 +1,67 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_ROUDI_SERVICE_PORT_INDEX_HPP
+#define IOX_POSH_ROUDI_SERVICE_PORT_INDEX_HPP
+
+#include "iceoryx_hoofs/cxx/function_ref.hpp"
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/internal/roudi/hash_bucket_index.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief Maps the hash of the service description of a port to the port. It is used by the PortManager to find the
+/// ports with a given service description without iterating over all ports in the PortPool.
+/// @tparam PortData_t type of the port data, e.g. popo::PublisherPortData; the port data must not be moved while it
+/// is contained in the index
+/// @tparam Capacity maximum number of ports, must not be smaller than the capacity of the PortPool for this port type
+/// @note the index lives in the RouDi process only, the port data in the shared memory is not changed
+template <typename PortData_t, uint64_t Capacity>
+class ServicePortIndex
+{
+  public:
+    /// @brief adds the port with its current service description; exceeding the capacity is a fatal error
+    /// @param[in] port to add
+    void add(PortData_t* const port) noexcept;
+
+    /// @brief removes the port, does nothing if the port is not contained
+    /// @param[in] port to remove
+    void remove(const PortData_t* const port) noexcept;
+
+    /// @brief applies the callable to all ports with the given service description
+    /// @param[in] service description of the ports
+    /// @param[in] callable which is applied to the ports; must not add or remove ports of the index
+    void forEach(const capro::ServiceDescription& service,
+                 const cxx::function_ref<void(PortData_t* const)> callable) const noexcept;
+
+    /// @brief returns the number of ports in the index
+    uint64_t size() const noexcept;
+
+  private:
+    HashBucketIndex<PortData_t*, Capacity> m_ports;
+};
+
+} // namespace roudi
+} // namespace iox
+
+#include "iceoryx_posh/internal/roudi/service_port_index.inl"
+
+#endif // IOX_POSH_ROUDI_SERVICE_PORT_INDEX_HPP
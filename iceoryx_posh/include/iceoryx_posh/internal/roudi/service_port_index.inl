@@ -0,0 +1,65 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_ROUDI_SERVICE_PORT_INDEX_INL
+#define IOX_POSH_ROUDI_SERVICE_PORT_INDEX_INL
+
+#include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_hoofs/cxx/requires.hpp"
+#include "iceoryx_posh/internal/roudi/service_port_index.hpp"
+
+namespace iox
+{
+namespace roudi
+{
+template <typename PortData_t, uint64_t Capacity>
+inline void ServicePortIndex<PortData_t, Capacity>::add(PortData_t* const port) noexcept
+{
+    const bool isAdded = m_ports.add(port->m_serviceDescription.getHash(), port);
+    cxx::Ensures(isAdded && "The capacity of the ServicePortIndex is smaller than the one of the PortPool!");
+}
+
+template <typename PortData_t, uint64_t Capacity>
+inline void ServicePortIndex<PortData_t, Capacity>::remove(const PortData_t* const port) noexcept
+{
+    IOX_DISCARD_RESULT(m_ports.remove(port->m_serviceDescription.getHash(),
+                                      [&](PortData_t* const& indexedPort) { return indexedPort == port; }));
+}
+
+template <typename PortData_t, uint64_t Capacity>
+inline void ServicePortIndex<PortData_t, Capacity>::forEach(
+    const capro::ServiceDescription& service, const cxx::function_ref<void(PortData_t* const)> callable) const noexcept
+{
+    m_ports.forEach(service.getHash(), [&](PortData_t* const& port) {
+        // ports with a different service description but the same hash are skipped
+        if (port->m_serviceDescription == service)
+        {
+            callable(port);
+        }
+    });
+}
+
+template <typename PortData_t, uint64_t Capacity>
+inline uint64_t ServicePortIndex<PortData_t, Capacity>::size() const noexcept
+{
+    return m_ports.size();
+}
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_SERVICE_PORT_INDEX_INL
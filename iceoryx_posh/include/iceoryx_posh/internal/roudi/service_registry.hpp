@@ -76,6 +76,11 @@ class ServiceRegistry
     /// @param[in] serviceDescription, service to be removed
     void removeServer(const capro::ServiceDescription& serviceDescription) noexcept;
 
+    /// @brief Replaces all entries of the registry, e.g. with the entries of a snapshot of another registry
+    /// @param[in] entries, pointer to the first of the entries with unique service descriptions
+    /// @param[in] numberOfEntries, number of entries; entries exceeding the capacity are discarded
+    void restore(const ServiceDescriptionEntry* const entries, const uint32_t numberOfEntries) noexcept;
+
     /// @brief Removes given service description from registry if service is found,
     ///        all occurences are removed
     /// @param[in] serviceDescription, service to be removed
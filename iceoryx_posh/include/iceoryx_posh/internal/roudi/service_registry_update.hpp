@@ -0,0 +1,114 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_ROUDI_SERVICE_REGISTRY_UPDATE_HPP
+#define IOX_POSH_ROUDI_SERVICE_REGISTRY_UPDATE_HPP
+
+#include "iceoryx_hoofs/cxx/algorithm.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/roudi/service_registry.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief Every n-th update of the service registry is a snapshot. The history of the service registry publisher and
+/// the queue of the service discovery subscriber hold n updates, therefore a consumer always finds the latest snapshot
+/// and all the changes which followed it, even when updates were discarded due to a full queue.
+constexpr uint64_t SERVICE_REGISTRY_SNAPSHOT_INTERVAL{algorithm::min(MAX_PUBLISHER_HISTORY, uint64_t{16U})};
+
+/// @brief An update of the service registry as it is published by RouDi. It is either a snapshot with all entries of
+/// the registry or a single change. The entries are stored in the chunk directly behind this header.
+/// @code
+///     // producer
+///     auto update = ServiceRegistryUpdate::createSnapshot(chunk->userPayload(), version, registry);
+///     // consumer
+///     update->applyTo(replicatedRegistry);
+/// @endcode
+class ServiceRegistryUpdate
+{
+  public:
+    using Entry_t = ServiceRegistry::ServiceDescriptionEntry;
+
+    enum class Type : uint8_t
+    {
+        SNAPSHOT,
+        ADD_PUBLISHER,
+        REMOVE_PUBLISHER,
+        ADD_SERVER,
+        REMOVE_SERVER
+    };
+
+    /// @brief the size of an update with the given number of entries, a change has exactly one entry
+    static constexpr uint64_t requiredSize(const uint32_t numberOfEntries) noexcept;
+
+    /// @brief the size of a snapshot of the given registry
+    static uint64_t requiredSnapshotSize(const ServiceRegistry& registry) noexcept;
+
+    /// @brief creates a snapshot of the registry
+    /// @param[in] memory with the size of requiredSnapshotSize and the alignment of ServiceRegistryUpdate
+    /// @param[in] version of the update
+    /// @param[in] registry to take the snapshot of
+    static ServiceRegistryUpdate*
+    createSnapshot(void* const memory, const uint64_t version, const ServiceRegistry& registry) noexcept;
+
+    /// @brief creates a change of a single service description
+    /// @param[in] memory with the size of requiredSize(1) and the alignment of ServiceRegistryUpdate
+    /// @param[in] version of the update
+    /// @param[in] type of the change, must not be SNAPSHOT
+    /// @param[in] service which was changed
+    static ServiceRegistryUpdate* createChange(void* const memory,
+                                               const uint64_t version,
+                                               const Type type,
+                                               const capro::ServiceDescription& service) noexcept;
+
+    ServiceRegistryUpdate(const ServiceRegistryUpdate&) = delete;
+    ServiceRegistryUpdate(ServiceRegistryUpdate&&) = delete;
+    ServiceRegistryUpdate& operator=(const ServiceRegistryUpdate&) = delete;
+    ServiceRegistryUpdate& operator=(ServiceRegistryUpdate&&) = delete;
+    ~ServiceRegistryUpdate() noexcept = default;
+
+    uint64_t version() const noexcept;
+    Type type() const noexcept;
+    uint32_t numberOfEntries() const noexcept;
+
+    /// @brief applies the update to the registry; a snapshot replaces the whole content of the registry
+    void applyTo(ServiceRegistry& registry) const noexcept;
+
+  private:
+    ServiceRegistryUpdate(const uint64_t version, const Type type, const uint32_t numberOfEntries) noexcept;
+
+    Entry_t* entries() noexcept;
+    const Entry_t* entries() const noexcept;
+
+  private:
+    uint64_t m_version{0U};
+    Type m_type{Type::SNAPSHOT};
+    uint32_t m_numberOfEntries{0U};
+};
+
+constexpr uint64_t ServiceRegistryUpdate::requiredSize(const uint32_t numberOfEntries) noexcept
+{
+    return sizeof(ServiceRegistryUpdate) + numberOfEntries * sizeof(Entry_t);
+}
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_SERVICE_REGISTRY_UPDATE_HPP
@@ -20,6 +20,7 @@
 
 #include "iceoryx_posh/internal/runtime/ipc_interface_creator.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_interface_user.hpp"
+#include "iceoryx_posh/internal/runtime/runtime_request_channel.hpp"
 
 namespace iox
 {
@@ -47,6 +48,11 @@ class IpcRuntimeInterface
     /// @return true if sending was successful, false if not
     bool sendKeepalive() noexcept;
 
+    /// @brief sends the subsequent requests via the shared memory request channel which RouDi provided with the
+    /// registration; without such a channel the IPC channel is used
+    /// @note the management segment must be mapped before this call
+    void enableSharedMemoryRequestChannel() noexcept;
+
     /// @brief send a request to the RouDi daemon
     /// @param[in] msg request to RouDi
     /// @param[out] answer response from RouDi
@@ -79,6 +85,8 @@ class IpcRuntimeInterface
   private:
     RuntimeName_t m_runtimeName;
     cxx::optional<rp::BaseRelativePointer::offset_t> m_segmentManagerAddressOffset;
+    rp::BaseRelativePointer::offset_t m_requestChannelOffset{rp::BaseRelativePointer::NULL_POINTER_OFFSET};
+    cxx::optional<RuntimeRequestChannel> m_requestChannel;
     IpcInterfaceCreator m_AppIpcInterface;
     IpcInterfaceUser m_RoudiIpcInterface;
     uint64_t m_shmTopicSize{0U};
@@ -104,6 +104,9 @@ class PoshRuntimeImpl : public PoshRuntime
     cxx::expected<popo::ConditionVariableData*, IpcMessageErrorType>
     requestConditionVariableFromRoudi(const IpcMessage& sendBuffer) noexcept;
 
+    /// @brief maps the data segment the chunks of the ports of this runtime are acquired from
+    void mapWritableDataSegment() noexcept;
+
     mutable posix::mutex m_appIpcRequestMutex{false};
 
     IpcRuntimeInterface m_ipcChannelInterface;
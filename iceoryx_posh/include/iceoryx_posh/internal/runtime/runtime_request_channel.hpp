@@ -0,0 +1,71 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_RUNTIME_RUNTIME_REQUEST_CHANNEL_HPP
+#define IOX_POSH_RUNTIME_RUNTIME_REQUEST_CHANNEL_HPP
+
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_message.hpp"
+#include "iceoryx_posh/internal/runtime/runtime_request_channel_data.hpp"
+
+namespace iox
+{
+namespace runtime
+{
+/// @brief Transfers requests from a runtime to RouDi and the responses back via a RuntimeRequestChannelData in the
+/// management segment. The runtime uses sendRequest and waitForResponse, RouDi uses takeRequest and sendResponse.
+class RuntimeRequestChannel
+{
+  public:
+    explicit RuntimeRequestChannel(RuntimeRequestChannelData& data) noexcept;
+
+    /// @brief writes the request into the channel and rings the doorbell
+    /// @param[in] request to send
+    /// @return false when the request does not fit into the channel or a request is still ongoing
+    bool sendRequest(const IpcMessage& request) noexcept;
+
+    /// @brief blocks until RouDi wrote the response to the last request
+    /// @param[out] response from RouDi
+    /// @return true if a response was received, false if not
+    bool waitForResponse(IpcMessage& response) noexcept;
+
+    /// @brief takes a pending request for processing, subsequent calls return nullopt until the response was sent
+    /// @return the pending request or nullopt when there is none
+    cxx::optional<IpcMessage> takeRequest() noexcept;
+
+    /// @brief writes the response to the request which was taken with takeRequest
+    /// @param[in] response to send
+    /// @return false when no request is in progress or the response does not fit into the channel; in the latter case
+    /// an empty response is sent
+    bool sendResponse(const IpcMessage& response) noexcept;
+
+    /// @brief returns true if a request was taken and the response is not yet sent
+    bool isRequestInProgress() const noexcept;
+
+    /// @brief returns true if the response was sent and is not yet taken by the runtime
+    bool isResponsePending() const noexcept;
+
+  private:
+    bool write(const IpcMessage& message) noexcept;
+
+  private:
+    RuntimeRequestChannelData* m_data{nullptr};
+};
+
+} // namespace runtime
+} // namespace iox
+
+#endif // IOX_POSH_RUNTIME_RUNTIME_REQUEST_CHANNEL_HPP
@@ -0,0 +1,68 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_RUNTIME_RUNTIME_REQUEST_CHANNEL_DATA_HPP
+#define IOX_POSH_RUNTIME_RUNTIME_REQUEST_CHANNEL_DATA_HPP
+
+#include "iceoryx_hoofs/internal/concurrent/futex_event.hpp"
+#include "iceoryx_hoofs/internal/relocatable_pointer/relative_pointer.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace runtime
+{
+/// @brief Per process request/response slot in the management segment. The runtime writes a request into the
+/// message buffer and rings the doorbell which is shared by all runtimes; RouDi serves all pending requests per wakeup
+/// and writes the response into the same buffer.
+/// @note the requests of a runtime are serialized, therefore a single slot is sufficient
+struct RuntimeRequestChannelData
+{
+    static constexpr uint64_t MAX_MESSAGE_SIZE{2048U};
+
+    enum class State : uint32_t
+    {
+        IDLE,
+        REQUEST_PENDING,
+        REQUEST_IN_PROGRESS,
+        RESPONSE_READY
+    };
+
+    /// @param[in] runtimeName name of the runtime which uses the channel
+    /// @param[in] doorbell which is rung when a request was written
+    RuntimeRequestChannelData(const RuntimeName_t& runtimeName, concurrent::FutexEvent& doorbell) noexcept;
+
+    RuntimeRequestChannelData(const RuntimeRequestChannelData&) = delete;
+    RuntimeRequestChannelData(RuntimeRequestChannelData&&) = delete;
+    RuntimeRequestChannelData& operator=(const RuntimeRequestChannelData&) = delete;
+    RuntimeRequestChannelData& operator=(RuntimeRequestChannelData&&) = delete;
+    ~RuntimeRequestChannelData() noexcept = default;
+
+    RuntimeName_t m_runtimeName;
+    rp::RelativePointer<concurrent::FutexEvent> m_doorbell;
+    concurrent::FutexEvent m_responseEvent;
+    std::atomic<State> m_state{State::IDLE};
+    uint64_t m_messageSize{0U};
+    char m_message[MAX_MESSAGE_SIZE];
+};
+
+} // namespace runtime
+} // namespace iox
+
+#endif // IOX_POSH_RUNTIME_RUNTIME_REQUEST_CHANNEL_DATA_HPP
@@ -32,6 +32,14 @@ namespace runtime
 class SharedMemoryUser
 {
   public:
+    /// @brief a data segment or mempool extent which is mapped into the process
+    struct SharedMemoryLocation
+    {
+        ShmName_t m_sharedMemoryName;
+        const void* m_baseAddress{nullptr};
+        uint64_t m_size{0U};
+    };
+
     /// @brief Constructor
     /// @param[in] topicSize size of the shared memory management segment
     /// @param[in] segmentManagerAddr adress of the segment manager that does the final mapping of memory in the process
@@ -41,13 +49,28 @@ class SharedMemoryUser
                      const uint64_t segmentId,
                      const rp::BaseRelativePointer::offset_t segmentManagerAddressOffset) noexcept;
 
+    /// @brief maps the data segment the user can write to, e.g. when the first publisher is created, to not map it
+    /// with the first chunk which is acquired
+    void mapWritableDataSegment() const noexcept;
+
+    /// @brief returns the data segment or mempool extent which contains the address, e.g. to let another process
+    /// map the memory of a chunk by its shared memory name
+    /// @param[in] address in a mapped data segment or mempool extent
+    /// @return the shared memory or a nullopt if the address is not in a mapped data segment or mempool extent
+    static cxx::optional<SharedMemoryLocation> findSharedMemory(const void* const address) noexcept;
+
   private:
-    void openDataSegments(const uint64_t segmentId,
-                          const rp::BaseRelativePointer::offset_t segmentManagerAddressOffset) noexcept;
+    /// @brief records the data segments the user can access; they are mapped on demand
+    void registerDataSegments(const uint64_t segmentId,
+                              const rp::BaseRelativePointer::offset_t segmentManagerAddressOffset) noexcept;
+
+    /// @brief maps the data segment or the mempool extent memory with the given segment id; it is registered as
+    /// handler for unregistered segment ids of relative pointers, hence a segment is mapped when the first relative
+    /// pointer into it is resolved
+    static void mapSegment(const rp::BaseRelativePointer::id_underlying_t segmentId) noexcept;
 
   private:
     cxx::optional<posix::SharedMemoryObject> m_shmObject;
-    cxx::vector<posix::SharedMemoryObject, MAX_SHM_SEGMENTS> m_dataShmObjects;
     static constexpr cxx::perms SHM_SEGMENT_PERMISSIONS =
         cxx::perms::owner_read | cxx::perms::owner_write | cxx::perms::group_read | cxx::perms::group_write;
 };
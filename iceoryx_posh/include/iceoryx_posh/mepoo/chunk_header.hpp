@@ -138,6 +138,11 @@ struct ChunkHeader
     /// @brief the serquence number of the chunk
     uint64_t sequenceNumber() const noexcept;
 
+    /// @brief A multi-chunk sample is a head chunk with a MultiChunkTable as user-payload and parts which are chunks of
+    /// their own; only the head chunk is delivered to the subscriber
+    /// @return true if the chunk is the head chunk of a multi-chunk sample
+    bool isMultiChunk() const noexcept;
+
   private:
     template <typename T>
     friend class popo::ChunkSender;
@@ -146,8 +151,12 @@ struct ChunkHeader
 
     void setSequenceNumber(const uint64_t sequenceNumber) noexcept;
 
+    void setMultiChunk() noexcept;
+
     uint64_t overflowSafeUsedSizeOfChunk() const noexcept;
 
+    static constexpr uint8_t MULTI_CHUNK_FLAG{0x01U};
+
   private:
     // the order of these members must be changed carefully and if this happens, the m_chunkHeaderVersion
     // needs to be adapted in order to be able to detect incompatibilities between publisher/subscriber
@@ -157,8 +166,8 @@ struct ChunkHeader
     // size of the whole chunk, including the header
     uint32_t m_chunkSize{0U};
     uint8_t m_chunkHeaderVersion{CHUNK_HEADER_VERSION};
-    // reserved for future functionality and used to indicate the padding bytes; currently not used and set to `0`
-    uint8_t m_reserved{0};
+    // bit field for additional properties of the chunk, see the *_FLAG constants; the unused bits are set to `0`
+    uint8_t m_flags{0U};
     // currently just a placeholder
     uint16_t m_userHeaderId{NO_USER_HEADER};
     popo::UniquePortId m_originId{popo::InvalidPortId};
@@ -35,13 +35,24 @@ struct MePooConfig
     struct Entry
     {
         /// @brief set the size and count of memory chunks
-        Entry(uint32_t f_size, uint32_t f_chunkCount) noexcept
+        /// @param[in] f_extentChunkCount number of chunks RouDi adds at runtime with a mempool extent when the
+        /// mempool runs low on chunks; 0 means the mempool cannot grow
+        /// @param[in] f_numaNode NUMA node the chunks are preferably placed on; there can be one mempool with the same
+        /// size per node and MemoryManager::getChunk prefers the one on the node of the caller
+        Entry(uint32_t f_size,
+              uint32_t f_chunkCount,
+              uint32_t f_extentChunkCount = 0U,
+              uint32_t f_numaNode = NO_NUMA_NODE) noexcept
             : m_size(f_size)
             , m_chunkCount(f_chunkCount)
+            , m_extentChunkCount(f_extentChunkCount)
+            , m_numaNode(f_numaNode)
         {
         }
         uint32_t m_size{0};
         uint32_t m_chunkCount{0};
+        uint32_t m_extentChunkCount{0};
+        uint32_t m_numaNode{NO_NUMA_NODE};
     };
 
     using MePooConfigContainerType = cxx::vector<Entry, MAX_NUMBER_OF_MEMPOOLS>;
@@ -0,0 +1,103 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_MEPOO_MULTI_CHUNK_TABLE_HPP
+#define IOX_POSH_MEPOO_MULTI_CHUNK_TABLE_HPP
+
+#include "iceoryx_hoofs/cxx/vector.hpp"
+#include "iceoryx_hoofs/internal/relocatable_pointer/relative_pointer_data.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+template <typename T>
+class ChunkSender;
+}
+
+namespace mepoo
+{
+/// @brief The user-payload of the head chunk of a multi-chunk sample. The data of a multi-chunk sample is scattered
+/// over parts, each part is a chunk of its own from the best fitting mempool. The parts are allocated together with
+/// the head chunk, chained to it and released together with it, i.e. a multi-chunk sample is published, taken and
+/// released like any other sample.
+/// On the publisher side the table is used to fill the parts, on the subscriber side it is the gather view of the
+/// data.
+class MultiChunkTable
+{
+  public:
+    static constexpr uint32_t MAX_NUMBER_OF_PARTS{16U};
+
+    using PartSizes_t = cxx::vector<uint32_t, MAX_NUMBER_OF_PARTS>;
+
+    MultiChunkTable() noexcept = default;
+
+    MultiChunkTable(const MultiChunkTable&) = delete;
+    MultiChunkTable(MultiChunkTable&&) = delete;
+    MultiChunkTable& operator=(const MultiChunkTable&) = delete;
+    MultiChunkTable& operator=(MultiChunkTable&&) = delete;
+
+    /// @brief returns the number of parts
+    uint32_t numberOfParts() const noexcept;
+
+    /// @brief returns the sum of the sizes of all parts
+    uint64_t totalSize() const noexcept;
+
+    /// @brief returns the user-payload of a part
+    /// @param[in] index of the part, must be smaller than numberOfParts()
+    void* part(const uint32_t index) noexcept;
+
+    /// @brief returns the user-payload of a part
+    /// @param[in] index of the part, must be smaller than numberOfParts()
+    const void* part(const uint32_t index) const noexcept;
+
+    /// @brief returns the size of a part
+    /// @param[in] index of the part, must be smaller than numberOfParts()
+    uint32_t partSize(const uint32_t index) const noexcept;
+
+    /// @brief Copies the parts in their order into a contiguous buffer, for consumers which cannot work on the
+    /// scattered data
+    /// @param[in] destination the buffer to copy to
+    /// @param[in] destinationSize the size of the buffer
+    /// @return the number of bytes which were copied, at most destinationSize
+    uint64_t gather(void* const destination, const uint64_t destinationSize) const noexcept;
+
+  private:
+    template <typename T>
+    friend class popo::ChunkSender;
+
+    /// @brief appends a part
+    /// @return false if the table is full
+    bool addPart(void* const userPayload, const uint32_t size) noexcept;
+
+    struct Part
+    {
+        rp::RelativePointerData m_userPayload;
+        uint64_t m_size{0U};
+    };
+
+    uint32_t m_numberOfParts{0U};
+    uint64_t m_totalSize{0U};
+    Part m_parts[MAX_NUMBER_OF_PARTS];
+};
+
+} // namespace mepoo
+} // namespace iox
+
+#endif // IOX_POSH_MEPOO_MULTI_CHUNK_TABLE_HPP
@@ -0,0 +1,92 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_MEPOO_NUMA_PLACEMENT_HPP
+#define IOX_POSH_MEPOO_NUMA_PLACEMENT_HPP
+
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace mepoo
+{
+/// @brief how the pages of a memory are distributed over the NUMA nodes
+enum class NumaPolicy : uint8_t
+{
+    /// @brief the kernel places a page on the node of the CPU which touches it first
+    DEFAULT,
+    /// @brief the pages are placed on the first node of the node mask, other nodes are used when it is out of memory
+    PREFERRED,
+    /// @brief the pages are placed only on the nodes of the node mask
+    BIND,
+    /// @brief the pages are distributed round-robin over the nodes of the node mask
+    INTERLEAVE
+};
+
+/// @brief converts the NumaPolicy to a string literal
+const char* asStringLiteral(const NumaPolicy policy) noexcept;
+
+/// @brief converts the name of a policy as used in the config file, e.g. "preferred", to a NumaPolicy
+cxx::optional<NumaPolicy> numaPolicyFromString(const char* const name) noexcept;
+
+/// @brief The NUMA placement of a shared memory, e.g. of a segment or of the management memory of RouDi
+struct NumaPlacement
+{
+    NumaPolicy m_policy{NumaPolicy::DEFAULT};
+    /// @brief bit n selects the NUMA node n; only the first MAX_NUMBER_OF_NUMA_NODES nodes can be used
+    uint64_t m_nodeMask{0U};
+
+    /// @brief creates a placement on a single node
+    static NumaPlacement onNode(const uint32_t node, const NumaPolicy policy = NumaPolicy::PREFERRED) noexcept;
+
+    /// @brief true when the placement is left to the kernel
+    bool isDefault() const noexcept;
+
+    /// @brief true when the policy has at least one node and all nodes are less than MAX_NUMBER_OF_NUMA_NODES
+    bool isValid() const noexcept;
+
+    bool operator==(const NumaPlacement& rhs) const noexcept;
+};
+
+/// @brief Applies the placement to the memory. Only the pages which are completely within the memory are placed.
+/// Pages which are already touched by the calling process are migrated, e.g. since RouDi zeroes the shared memory on
+/// creation.
+/// @param[in] memory the start of the memory
+/// @param[in] size of the memory in bytes
+/// @param[in] placement which is applied, nothing happens for the default placement
+/// @return false when the placement could not be applied, e.g. when the platform has no NUMA support
+bool applyNumaPlacement(void* const memory, const uint64_t size, const NumaPlacement& placement) noexcept;
+
+/// @brief returns the NUMA node of the CPU the calling thread is running on, 0 when the platform has no NUMA support
+uint32_t getCurrentNumaNode() noexcept;
+
+/// @brief Samples pages of the memory and counts how many of them are located on every NUMA node. Pages which are not
+/// yet touched or are located on nodes beyond MAX_NUMBER_OF_NUMA_NODES are not counted.
+/// @param[in] memory the start of the memory
+/// @param[in] size of the memory in bytes
+/// @param[out] pagesPerNode the number of sampled pages per node
+void sampleNumaDistribution(const void* const memory,
+                            const uint64_t size,
+                            uint32_t (&pagesPerNode)[MAX_NUMBER_OF_NUMA_NODES]) noexcept;
+
+} // namespace mepoo
+} // namespace iox
+
+#endif // IOX_POSH_MEPOO_NUMA_PLACEMENT_HPP
@@ -18,6 +18,7 @@
 
 #include "iceoryx_posh/mepoo/memory_info.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iceoryx_posh/mepoo/numa_placement.hpp"
 
 #include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
@@ -34,11 +35,13 @@ struct SegmentConfig
         SegmentEntry(const posix::PosixGroup::groupName_t& readerGroup,
                      const posix::PosixGroup::groupName_t& writerGroup,
                      const MePooConfig& memPoolConfig,
-                     iox::mepoo::MemoryInfo memoryInfo = iox::mepoo::MemoryInfo()) noexcept
+                     iox::mepoo::MemoryInfo memoryInfo = iox::mepoo::MemoryInfo(),
+                     const NumaPlacement& numaPlacement = NumaPlacement()) noexcept
             : m_readerGroup(readerGroup)
             , m_writerGroup(writerGroup)
             , m_mempoolConfig(memPoolConfig)
             , m_memoryInfo(memoryInfo)
+            , m_numaPlacement(numaPlacement)
 
         {
         }
@@ -47,6 +50,9 @@ struct SegmentConfig
         posix::PosixGroup::groupName_t m_writerGroup;
         MePooConfig m_mempoolConfig;
         iox::mepoo::MemoryInfo m_memoryInfo;
+        /// @brief placement of the chunk memory of the segment and its mempool extents; the NUMA node of a mempool
+        /// takes precedence for the chunks of this mempool
+        NumaPlacement m_numaPlacement;
     };
 
     cxx::vector<SegmentEntry, MAX_SHM_SEGMENTS> m_sharedMemorySegments;
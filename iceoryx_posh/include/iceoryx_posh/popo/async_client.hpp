@@ -0,0 +1,59 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_POPO_ASYNC_CLIENT_HPP
+#define IOX_POSH_POPO_ASYNC_CLIENT_HPP
+
+#include "iceoryx_posh/internal/popo/async_client_impl.hpp"
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The AsyncClient class for the request-response messaging pattern in iceoryx. It assigns the sequence ids of
+/// the requests and correlates the responses with a future or a callback per request.
+/// @param[in] Req type of request data
+/// @param[in] Res type of response data
+/// @code
+/// iox::popo::AsyncClient<AddRequest, AddResponse> client({"Example", "Request-Response", "Add"});
+/// client.loan(1U, 2U).and_then([&](auto& request) {
+///     client.sendAsync(std::move(request), 100_ms).and_then([&](auto& future) {
+///         futures.push_back(std::move(future));
+///     });
+/// });
+/// // in the thread of the client, e.g. after a WaitSet to which ClientEvent::RESPONSE_RECEIVED is attached woke up
+/// waitset.timedWait(client.timeUntilNextTimeout());
+/// client.processResponses();
+/// futures.front().take().and_then([](auto& response) { std::cout << response->sum << std::endl; });
+/// @endcode
+template <typename Req, typename Res>
+class AsyncClient : public AsyncClientImpl<Req, Res>
+{
+    using Impl = AsyncClientImpl<Req, Res>;
+
+  public:
+    using AsyncClientImpl<Req, Res>::AsyncClientImpl;
+
+    virtual ~AsyncClient() noexcept
+    {
+        Impl::m_trigger.reset();
+    }
+};
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_ASYNC_CLIENT_HPP
@@ -0,0 +1,135 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_POPO_AWAITABLE_CLIENT_HPP
+#define IOX_POSH_POPO_AWAITABLE_CLIENT_HPP
+
+#include "iceoryx_posh/internal/popo/async_client_impl.hpp"
+#include "iceoryx_posh/popo/coroutine_scheduler.hpp"
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The reasons why `co_await client.call(request)` provides no response
+enum class AsyncCallError
+{
+    TOO_MANY_REQUESTS_IN_FLIGHT,
+    NO_CONNECT_REQUESTED,
+    SERVER_NOT_AVAILABLE,
+    INVALID_REQUEST,
+    TIMED_OUT,
+    CANCELLED
+};
+
+/// @brief Converts the AsyncCallError to a string literal
+/// @param[in] value to convert to a string literal
+/// @return pointer to a string literal
+inline constexpr const char* asStringLiteral(const AsyncCallError value) noexcept;
+
+/// @brief Convenience stream operator to easily use the `asStringLiteral` function with std::ostream
+/// @param[in] stream sink to write the message to
+/// @param[in] value to convert to a string literal
+/// @return the reference to `stream` which was provided as input parameter
+inline std::ostream& operator<<(std::ostream& stream, AsyncCallError value) noexcept;
+
+/// @brief Convenience stream operator to easily use the `asStringLiteral` function with iox::log::LogStream
+/// @param[in] stream sink to write the message to
+/// @param[in] value to convert to a string literal
+/// @return the reference to `stream` which was provided as input parameter
+inline log::LogStream& operator<<(log::LogStream& stream, AsyncCallError value) noexcept;
+
+/// @brief An AsyncClient whose responses can be awaited in a coroutine with `co_await client.call(request)`. The
+/// responses are correlated and the timeouts are evaluated by the CoroutineScheduler, which resumes the coroutine with
+/// the response or the reason why there is none.
+/// @param[in] Req type of request data
+/// @param[in] Res type of response data
+/// @note Any number of coroutines can await calls in parallel, up to ClientOptions::maxOutstandingRequests. The client
+/// must not be destroyed while a coroutine awaits a call.
+template <typename Req, typename Res>
+class AwaitableClient : public AsyncClientImpl<Req, Res>
+{
+    using Impl = AsyncClientImpl<Req, Res>;
+
+  public:
+    using CallResult_t = cxx::expected<Response<const Res>, AsyncCallError>;
+
+    /// @brief Awaits the response of a request which is sent when the awaiting coroutine is suspended
+    class CallAwaiter
+    {
+      public:
+        CallAwaiter(AwaitableClient& client, Request<Req>&& request, const units::Duration timeout) noexcept;
+        /// @brief cancels the request when the awaiting coroutine is destroyed before it was resumed
+        ~CallAwaiter() noexcept;
+
+        CallAwaiter(const CallAwaiter&) = delete;
+        CallAwaiter(CallAwaiter&&) = delete;
+        CallAwaiter& operator=(const CallAwaiter&) = delete;
+        CallAwaiter& operator=(CallAwaiter&&) = delete;
+
+        bool await_ready() const noexcept;
+        bool await_suspend(std::coroutine_handle<> handle) noexcept;
+        CallResult_t await_resume() noexcept;
+
+      private:
+        void onResult(typename InFlightRequests<Res>::Result_t& result) noexcept;
+
+      private:
+        AwaitableClient* m_client{nullptr};
+        cxx::optional<Request<Req>> m_request;
+        units::Duration m_timeout;
+        std::coroutine_handle<> m_handle;
+        int64_t m_sequenceId{0};
+        bool m_isPending{false};
+        cxx::optional<CallResult_t> m_result;
+    };
+
+    /// @brief Constructor for an awaitable client
+    /// @param[in] scheduler which dispatches the events of the client, it must outlive the client
+    /// @param[in] service is the ServiceDescription for the new client
+    /// @param[in] clientOptions like the queue capacity and the maximum number of outstanding requests
+    AwaitableClient(CoroutineScheduler& scheduler,
+                    const capro::ServiceDescription& service,
+                    const ClientOptions& clientOptions = {}) noexcept;
+    virtual ~AwaitableClient() noexcept;
+
+    AwaitableClient(const AwaitableClient&) = delete;
+    AwaitableClient(AwaitableClient&&) = delete;
+    AwaitableClient& operator=(const AwaitableClient&) = delete;
+    AwaitableClient& operator=(AwaitableClient&&) = delete;
+
+    /// @brief sends the request and awaits its response
+    /// @param[in] request to send; the sequence id of the request header is assigned by the client
+    /// @param[in] timeout after which the call fails with AsyncCallError::TIMED_OUT if there is no response
+    /// @return an awaiter which provides the response or the AsyncCallError
+    CallAwaiter call(Request<Req>&& request, const units::Duration timeout = units::Duration::max()) noexcept;
+
+  private:
+    static AsyncCallError toCallError(const AsyncSendError error) noexcept;
+    static AsyncCallError toCallError(const AsyncResponseError error) noexcept;
+
+  private:
+    CoroutineScheduler& m_scheduler;
+    uint64_t m_attachmentId{0U};
+};
+
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/awaitable_client.inl"
+
+#endif // IOX_POSH_POPO_AWAITABLE_CLIENT_HPP
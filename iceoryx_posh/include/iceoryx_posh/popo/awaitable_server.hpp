@@ -0,0 +1,82 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_POPO_AWAITABLE_SERVER_HPP
+#define IOX_POSH_POPO_AWAITABLE_SERVER_HPP
+
+#include "iceoryx_posh/internal/popo/server_impl.hpp"
+#include "iceoryx_posh/internal/popo/take_awaiter.hpp"
+#include "iceoryx_posh/popo/coroutine_scheduler.hpp"
+
+namespace iox
+{
+namespace popo
+{
+/// @brief A Server whose requests can be awaited in a coroutine with `co_await server.nextRequest()`. The coroutine is
+/// resumed by the CoroutineScheduler when a request was received.
+/// @param[in] Req type of request data
+/// @param[in] Res type of response data
+/// @note Only one coroutine can await the server at a time. The server must not be destroyed while a coroutine awaits
+/// it, the coroutine would never be resumed.
+template <typename Req, typename Res>
+class AwaitableServer : public ServerImpl<Req, Res>
+{
+    using Impl = ServerImpl<Req, Res>;
+
+  public:
+    using TakeResult_t = cxx::expected<Request<const Req>, ServerRequestResult>;
+    using Awaiter_t = internal::TakeAwaiter<AwaitableServer>;
+
+    /// @brief Constructor for an awaitable server
+    /// @param[in] scheduler which dispatches the events of the server, it must outlive the server
+    /// @param[in] service is the ServiceDescription for the new server
+    /// @param[in] serverOptions like the queue capacity and queue full policy by a server
+    AwaitableServer(CoroutineScheduler& scheduler,
+                    const capro::ServiceDescription& service,
+                    const ServerOptions& serverOptions = {}) noexcept;
+    virtual ~AwaitableServer() noexcept;
+
+    AwaitableServer(const AwaitableServer&) = delete;
+    AwaitableServer(AwaitableServer&&) = delete;
+    AwaitableServer& operator=(const AwaitableServer&) = delete;
+    AwaitableServer& operator=(AwaitableServer&&) = delete;
+
+    /// @brief awaits the next request
+    /// @return an awaiter which provides the request or the ServerRequestResult if taking failed for another reason
+    /// than an empty queue, e.g. when too many requests are held in parallel
+    Awaiter_t nextRequest() noexcept;
+
+    static bool isEmpty(const TakeResult_t& result) noexcept;
+
+  private:
+    friend Awaiter_t;
+
+    void setAwaiter(Awaiter_t* awaiter) noexcept;
+    void onRequestReceived() noexcept;
+
+  private:
+    CoroutineScheduler& m_scheduler;
+    uint64_t m_attachmentId{0U};
+    Awaiter_t* m_awaiter{nullptr};
+};
+
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/awaitable_server.inl"
+
+#endif // IOX_POSH_POPO_AWAITABLE_SERVER_HPP
@@ -0,0 +1,82 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_POPO_AWAITABLE_SUBSCRIBER_HPP
+#define IOX_POSH_POPO_AWAITABLE_SUBSCRIBER_HPP
+
+#include "iceoryx_posh/internal/popo/subscriber_impl.hpp"
+#include "iceoryx_posh/internal/popo/take_awaiter.hpp"
+#include "iceoryx_posh/popo/coroutine_scheduler.hpp"
+
+namespace iox
+{
+namespace popo
+{
+/// @brief A Subscriber whose samples can be awaited in a coroutine with `co_await subscriber.next()`. The coroutine is
+/// resumed by the CoroutineScheduler when a sample was received.
+/// @param[in] T user payload type
+/// @param[in] H user header type
+/// @note Only one coroutine can await the subscriber at a time. The subscriber must not be destroyed while a coroutine
+/// awaits it, the coroutine would never be resumed.
+template <typename T, typename H = mepoo::NoUserHeader>
+class AwaitableSubscriber : public SubscriberImpl<T, H>
+{
+    using Impl = SubscriberImpl<T, H>;
+
+  public:
+    using TakeResult_t = cxx::expected<Sample<const T, const H>, ChunkReceiveResult>;
+    using Awaiter_t = internal::TakeAwaiter<AwaitableSubscriber>;
+
+    /// @brief Constructor for an awaitable subscriber
+    /// @param[in] scheduler which dispatches the events of the subscriber, it must outlive the subscriber
+    /// @param[in] service is the ServiceDescription for the new subscriber
+    /// @param[in] subscriberOptions like the queue capacity and history requested by a subscriber
+    AwaitableSubscriber(CoroutineScheduler& scheduler,
+                        const capro::ServiceDescription& service,
+                        const SubscriberOptions& subscriberOptions = SubscriberOptions()) noexcept;
+    virtual ~AwaitableSubscriber() noexcept;
+
+    AwaitableSubscriber(const AwaitableSubscriber&) = delete;
+    AwaitableSubscriber(AwaitableSubscriber&&) = delete;
+    AwaitableSubscriber& operator=(const AwaitableSubscriber&) = delete;
+    AwaitableSubscriber& operator=(AwaitableSubscriber&&) = delete;
+
+    /// @brief awaits the next sample
+    /// @return an awaiter which provides the sample or the ChunkReceiveResult if taking failed for another reason than
+    /// an empty queue, e.g. when too many samples are held in parallel
+    Awaiter_t next() noexcept;
+
+    static bool isEmpty(const TakeResult_t& result) noexcept;
+
+  private:
+    friend Awaiter_t;
+
+    void setAwaiter(Awaiter_t* awaiter) noexcept;
+    void onDataReceived() noexcept;
+
+  private:
+    CoroutineScheduler& m_scheduler;
+    uint64_t m_attachmentId{0U};
+    Awaiter_t* m_awaiter{nullptr};
+};
+
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/awaitable_subscriber.inl"
+
+#endif // IOX_POSH_POPO_AWAITABLE_SUBSCRIBER_HPP
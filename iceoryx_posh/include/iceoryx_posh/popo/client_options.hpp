@@ -49,6 +49,12 @@ struct ClientOptions
     /// @note Corresponds with ServerOptions::requestQueueFullPolicy
     ConsumerTooSlowPolicy serverTooSlowPolicy{ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA};
 
+    /// @brief The maximum number of requests the AsyncClient keeps in flight, i.e. which are sent and wait for their
+    /// response; it is limited to MAX_OUTSTANDING_REQUESTS_PER_CLIENT and to the responseQueueCapacity, otherwise the
+    /// responses of the requests in flight could overflow the response queue
+    /// @note The plain Client and UntypedClient do not track their requests and ignore this option
+    uint64_t maxOutstandingRequests{MAX_OUTSTANDING_REQUESTS_PER_CLIENT};
+
     /// @brief serialization of the ClientOptions
     cxx::Serialization serialize() const noexcept;
     /// @brief deserialization of the ClientOptions
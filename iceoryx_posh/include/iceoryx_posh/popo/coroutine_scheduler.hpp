@@ -0,0 +1,136 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_POPO_COROUTINE_SCHEDULER_HPP
+#define IOX_POSH_POPO_COROUTINE_SCHEDULER_HPP
+
+#include "iceoryx_posh/internal/popo/coroutine_support.hpp"
+
+#include "iceoryx_hoofs/cxx/function.hpp"
+#include "iceoryx_hoofs/cxx/vector.hpp"
+#include "iceoryx_posh/popo/wait_set.hpp"
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Dispatches the events of the awaitable ports (AwaitableSubscriber, AwaitableClient, AwaitableServer) and
+/// resumes the coroutines which wait for them. The scheduler is driven by the thread of the user's executor by calling
+/// runOnce; the events are received with a WaitSet, therefore no additional thread is required.
+/// @note The scheduler must outlive the awaitable ports which are attached to it. Like the WaitSet it is not
+/// thread-safe, the awaitable ports must be used from the thread which calls runOnce.
+/// @code
+/// iox::popo::CoroutineScheduler scheduler;
+/// iox::popo::AwaitableSubscriber<RadarObject> subscriber(scheduler, {"Radar", "FrontLeft", "Object"});
+/// auto task = [&]() -> MyTask {
+///     while (true)
+///     {
+///         auto sample = co_await subscriber.next();
+///         ...
+///     }
+/// }();
+/// while (keepRunning)
+/// {
+///     scheduler.runOnce();
+/// }
+/// @endcode
+class CoroutineScheduler
+{
+  public:
+    static constexpr uint64_t CAPACITY{WaitSet<>::CAPACITY};
+    /// @brief resumes a coroutine, e.g. by posting it to the queue of an executor
+    using Executor_t = cxx::function<void(std::coroutine_handle<>)>;
+    using Handler_t = cxx::function<void()>;
+    /// @brief returns the time until the handler has to be called without an event, e.g. to evaluate timeouts
+    using TimeoutProvider_t = cxx::function<units::Duration()>;
+
+    /// @brief creates a scheduler which resumes the coroutines inline in runOnce
+    CoroutineScheduler() noexcept;
+
+    /// @brief creates a scheduler which resumes the coroutines with the provided executor
+    /// @param[in] executor which is called from runOnce with every coroutine which is ready to be resumed
+    explicit CoroutineScheduler(const Executor_t& executor) noexcept;
+
+    CoroutineScheduler(const CoroutineScheduler&) = delete;
+    CoroutineScheduler(CoroutineScheduler&&) = delete;
+    CoroutineScheduler& operator=(const CoroutineScheduler&) = delete;
+    CoroutineScheduler& operator=(CoroutineScheduler&&) = delete;
+    ~CoroutineScheduler() noexcept = default;
+
+    /// @brief waits until at least one event occurred or the earliest timeout of the attached events expired, e.g.
+    /// the timeout of an AwaitableClient::call, and dispatches the events
+    /// @return the number of dispatched events
+    uint64_t runOnce() noexcept;
+
+    /// @brief like runOnce but waits at most for the provided timeout
+    /// @param[in] timeout for the wait, a zero timeout only polls
+    /// @return the number of dispatched events
+    uint64_t runOnce(const units::Duration timeout) noexcept;
+
+    /// @brief wakes up runOnce and makes it return immediately from now on; non-reversible, like
+    /// WaitSet::markForDestruction
+    void markForDestruction() noexcept;
+
+    /// @brief resumes a coroutine with the executor
+    /// @note Used by the awaitables, can be used for custom awaitables as well
+    void resume(std::coroutine_handle<> handle) noexcept;
+
+    /// @brief attaches an event whose handler is called from runOnce
+    /// @param[in] eventOrigin the class from which the event originates
+    /// @param[in] eventType the event specified by the class
+    /// @param[in] handler which is called when the event occurred
+    /// @param[in] timeUntilNextTimeout optional; when provided, the handler is additionally called on every runOnce
+    /// and runOnce waits at most for the returned time, e.g. to evaluate timeouts
+    /// @return the id of the attachment or the error of the WaitSet
+    /// @note Used by the awaitables, can be used for custom awaitables as well
+    template <typename T, typename EventType>
+    cxx::expected<uint64_t, WaitSetError> attach(T& eventOrigin,
+                                                  const EventType eventType,
+                                                  const Handler_t& handler,
+                                                  const TimeoutProvider_t& timeUntilNextTimeout = {}) noexcept;
+
+    /// @brief detaches an event which was attached with attach
+    /// @param[in] eventOrigin the class from which the event originates
+    /// @param[in] eventType the event specified by the class
+    /// @param[in] id which was returned by attach
+    template <typename T, typename EventType>
+    void detach(T& eventOrigin, const EventType eventType, const uint64_t id) noexcept;
+
+  private:
+    uint64_t dispatch(const WaitSet<>::NotificationInfoVector& notifications) noexcept;
+    units::Duration timeUntilNextTimeout() const noexcept;
+
+  private:
+    struct Attachment
+    {
+        Handler_t handler;
+        TimeoutProvider_t timeUntilNextTimeout;
+    };
+
+    WaitSet<> m_waitSet;
+    Executor_t m_executor;
+    // the handlers are looked up by the notification id; a handler whose awaitable was destroyed by a coroutine which
+    // was resumed earlier in the same dispatch is therefore skipped instead of being called on a dangling origin
+    cxx::optional<Attachment> m_attachments[CAPACITY];
+};
+
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/coroutine_scheduler.inl"
+
+#endif // IOX_POSH_POPO_COROUTINE_SCHEDULER_HPP
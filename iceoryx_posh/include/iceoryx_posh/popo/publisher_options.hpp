@@ -43,6 +43,13 @@ struct PublisherOptions
     /// @brief The option whether the publisher should block when the subscriber queue is full
     ConsumerTooSlowPolicy subscriberTooSlowPolicy{ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA};
 
+    /// @brief The number of chunks which are kept free for the publisher in every mempool it loans from; the
+    /// reservation is made with the first loan from a mempool
+    uint32_t reservedChunks{0U};
+
+    /// @brief The maximum number of chunks the publisher may hold from a mempool at the same time, 0 means unlimited
+    uint32_t maxChunksPerMemPool{0U};
+
     /// @brief serialization of the PublisherOptions
     cxx::Serialization serialize() const noexcept;
     /// @brief deserialization of the PublisherOptions
@@ -0,0 +1,80 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_POPO_RESPONSE_FUTURE_HPP
+#define IOX_POSH_POPO_RESPONSE_FUTURE_HPP
+
+#include "iceoryx_posh/internal/popo/in_flight_requests.hpp"
+
+namespace iox
+{
+namespace popo
+{
+template <typename Req, typename Res, typename BaseClientT>
+class AsyncClientImpl;
+
+/// @brief A lightweight handle to the response of a request which was sent with the AsyncClient. The response is
+/// correlated by the client when AsyncClient::processResponses is called, the future only refers to the in-flight
+/// table of the client. The timeout of the request is evaluated by the future itself.
+/// @note The future must not outlive the client which created it. It is not thread-safe and must be used from the
+/// thread which calls AsyncClient::processResponses.
+/// @note Destroying a future whose response was not taken cancels the request; a late response is released then.
+template <typename Res>
+class ResponseFuture
+{
+  public:
+    ResponseFuture(const ResponseFuture&) = delete;
+    ResponseFuture& operator=(const ResponseFuture&) = delete;
+    ResponseFuture(ResponseFuture&& rhs) noexcept;
+    ResponseFuture& operator=(ResponseFuture&& rhs) noexcept;
+    ~ResponseFuture() noexcept;
+
+    /// @brief returns the sequence id which was assigned to the request
+    int64_t getSequenceId() const noexcept;
+
+    /// @brief returns true when take does not fail with AsyncResponseError::PENDING anymore, i.e. the response arrived,
+    /// the request timed out or the future has no pending request
+    bool isReady() const noexcept;
+
+    /// @brief takes the response
+    /// @return the response or AsyncResponseError::PENDING if it has not yet arrived; any other error is final and the
+    /// future has no pending request afterwards
+    cxx::expected<Response<const Res>, AsyncResponseError> take() noexcept;
+
+    /// @brief cancels the request; a response which arrives later is released without being provided
+    void cancel() noexcept;
+
+  private:
+    template <typename, typename, typename>
+    friend class AsyncClientImpl;
+
+    ResponseFuture(InFlightRequests<Res>& inFlightRequests, const int64_t sequenceId) noexcept;
+
+    void detach(const AsyncResponseError reason) noexcept;
+
+  private:
+    InFlightRequests<Res>* m_inFlightRequests{nullptr};
+    int64_t m_sequenceId{-1};
+    AsyncResponseError m_detachReason{AsyncResponseError::NO_PENDING_REQUEST};
+};
+
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/response_future.inl"
+
+#endif // IOX_POSH_POPO_RESPONSE_FUTURE_HPP
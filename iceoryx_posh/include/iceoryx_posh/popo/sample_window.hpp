@@ -0,0 +1,131 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_POPO_SAMPLE_WINDOW_HPP
+#define IOX_POSH_POPO_SAMPLE_WINDOW_HPP
+
+#include "iceoryx_posh/internal/popo/ports/subscriber_port_data.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+
+#include <cstdint>
+#include <type_traits>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The SampleWindow is a read-only view of the latest samples of a subscriber, see
+/// SubscriberOptions::windowSize. The samples are held by the subscriber and not by the view. While a view is alive the
+/// subscriber rejects takeWindow and releaseWindow, hence the samples it refers to cannot be released underneath it.
+/// The view is movable but not copyable and must not outlive the subscriber it was taken from.
+/// @tparam T user payload type, void for the untyped subscriber
+/// @tparam H user header type
+template <typename T, typename H = mepoo::NoUserHeader>
+class SampleWindow
+{
+    template <typename S>
+    using TypedOnly = std::enable_if_t<std::is_same<S, T>::value && !std::is_void<S>::value, S>;
+
+    template <typename R>
+    using HasUserHeader =
+        std::enable_if_t<std::is_same<R, H>::value && !std::is_same<R, mepoo::NoUserHeader>::value, R>;
+
+  public:
+    using Window_t = SubscriberPortData::ChunkWindow_t;
+
+    /// @brief iterates over the samples from the oldest to the latest one
+    class ConstIterator
+    {
+      public:
+        ConstIterator(const SampleWindow& sampleWindow, const uint64_t index) noexcept;
+
+        const T& operator*() const noexcept;
+        const T* operator->() const noexcept;
+        ConstIterator& operator++() noexcept;
+        bool operator==(const ConstIterator& rhs) const noexcept;
+        bool operator!=(const ConstIterator& rhs) const noexcept;
+
+      private:
+        const SampleWindow* m_sampleWindow{nullptr};
+        uint64_t m_index{0U};
+    };
+
+    /// @brief creates a view of the window and marks it as in use until the view is destroyed
+    /// @param[in] window of the latest samples
+    /// @param[in] isWindowInUse flag of the subscriber which rejects takeWindow and releaseWindow while it is set
+    SampleWindow(const Window_t& window, bool& isWindowInUse) noexcept;
+
+    SampleWindow(const SampleWindow&) = delete;
+    SampleWindow& operator=(const SampleWindow&) = delete;
+    SampleWindow(SampleWindow&& rhs) noexcept;
+    SampleWindow& operator=(SampleWindow&& rhs) noexcept;
+
+    /// @brief hands the window back to the subscriber, the next takeWindow or releaseWindow is accepted again
+    ~SampleWindow() noexcept;
+
+    /// @brief returns the number of samples in the window
+    uint64_t size() const noexcept;
+
+    /// @brief returns true if there are no samples in the window
+    bool empty() const noexcept;
+
+    /// @brief access to the user-payload of a sample
+    /// @param[in] index of the sample, 0 is the oldest and size() - 1 the latest sample; must be smaller than size()
+    template <typename S = T, typename = TypedOnly<S>>
+    const S& operator[](const uint64_t index) const noexcept;
+
+    /// @brief access to the oldest sample, the window must not be empty
+    template <typename S = T, typename = TypedOnly<S>>
+    const S& front() const noexcept;
+
+    /// @brief access to the latest sample, the window must not be empty
+    template <typename S = T, typename = TypedOnly<S>>
+    const S& back() const noexcept;
+
+    /// @brief returns the user-payload of a sample
+    /// @param[in] index of the sample, 0 is the oldest and size() - 1 the latest sample; must be smaller than size()
+    const T* getUserPayload(const uint64_t index) const noexcept;
+
+    /// @brief returns the ChunkHeader of a sample
+    /// @param[in] index of the sample, 0 is the oldest and size() - 1 the latest sample; must be smaller than size()
+    const mepoo::ChunkHeader* getChunkHeader(const uint64_t index) const noexcept;
+
+    /// @brief returns the user-header of a sample
+    /// @param[in] index of the sample, 0 is the oldest and size() - 1 the latest sample; must be smaller than size()
+    template <typename R = H, typename = HasUserHeader<R>>
+    const R& getUserHeader(const uint64_t index) const noexcept;
+
+    template <typename S = T, typename = TypedOnly<S>>
+    ConstIterator begin() const noexcept;
+
+    template <typename S = T, typename = TypedOnly<S>>
+    ConstIterator end() const noexcept;
+
+  private:
+    void release() noexcept;
+
+  private:
+    const Window_t* m_window{nullptr};
+    bool* m_isWindowInUse{nullptr};
+};
+
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/sample_window.inl"
+
+#endif // IOX_POSH_POPO_SAMPLE_WINDOW_HPP
@@ -0,0 +1,72 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_POPO_STATIC_PORT_POLICY_HPP
+#define IOX_POSH_POPO_STATIC_PORT_POLICY_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/ports/pub_sub_port_types.hpp"
+#include "iceoryx_posh/popo/port_queue_policies.hpp"
+#include "iceoryx_posh/popo/publisher_options.hpp"
+#include "iceoryx_posh/popo/subscriber_options.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Fixes the options of a StaticPublisher and StaticSubscriber at compile time. Sending and receiving then
+/// omits the runtime dispatch over the queue type and the runtime checks of the policies.
+/// @tparam QueueFull the QueueFullPolicy of the subscriber; together with the communication policy of the build it
+/// determines the type of the subscriber queue
+/// @tparam SubscriberTooSlow the ConsumerTooSlowPolicy of the publisher
+/// @tparam HistoryCapacity the history capacity of the publisher
+/// @code
+///     using LatestValuePolicy = iox::popo::StaticPortPolicy<iox::popo::QueueFullPolicy::DISCARD_OLDEST_DATA>;
+///     iox::popo::StaticPublisher<Position, LatestValuePolicy> publisher({"Robot", "Arm", "Position"});
+///     iox::popo::StaticSubscriber<Position, LatestValuePolicy> subscriber({"Robot", "Arm", "Position"});
+/// @endcode
+template <QueueFullPolicy QueueFull = QueueFullPolicy::DISCARD_OLDEST_DATA,
+          ConsumerTooSlowPolicy SubscriberTooSlow = ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA,
+          uint64_t HistoryCapacity = 0U>
+struct StaticPortPolicy
+{
+    static_assert(HistoryCapacity <= MAX_PUBLISHER_HISTORY, "The history capacity exceeds MAX_PUBLISHER_HISTORY");
+
+    static constexpr QueueFullPolicy QUEUE_FULL_POLICY{QueueFull};
+    static constexpr ConsumerTooSlowPolicy SUBSCRIBER_TOO_SLOW_POLICY{SubscriberTooSlow};
+    static constexpr uint64_t HISTORY_CAPACITY{HistoryCapacity};
+    static constexpr cxx::VariantQueueTypes QUEUE_TYPE{subscriberQueueType(QueueFull)};
+
+    /// @brief overwrites the publisher options which are fixed by the policy
+    /// @param[in] options the remaining options of the publisher
+    /// @return the options the publisher port is created with
+    static PublisherOptions apply(PublisherOptions options) noexcept;
+
+    /// @brief overwrites the subscriber options which are fixed by the policy
+    /// @param[in] options the remaining options of the subscriber
+    /// @return the options the subscriber port is created with
+    static SubscriberOptions apply(SubscriberOptions options) noexcept;
+};
+
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/static_port_policy.inl"
+
+#endif // IOX_POSH_POPO_STATIC_PORT_POLICY_HPP
@@ -0,0 +1,75 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_POPO_STATIC_SUBSCRIBER_HPP
+#define IOX_POSH_POPO_STATIC_SUBSCRIBER_HPP
+
+#include "iceoryx_posh/internal/popo/subscriber_impl.hpp"
+#include "iceoryx_posh/internal/popo/untyped_subscriber_impl.hpp"
+#include "iceoryx_posh/popo/static_port_policy.hpp"
+
+namespace iox
+{
+namespace popo
+{
+/// @brief A Subscriber whose options are fixed at compile time by the PortPolicy, see StaticPortPolicy. The options
+/// provided to the constructor which are part of the PortPolicy are overwritten.
+/// @param[in] T user payload type
+/// @param[in] PortPolicy a StaticPortPolicy
+/// @param[in] H user header type
+template <typename T, typename PortPolicy = StaticPortPolicy<>, typename H = mepoo::NoUserHeader>
+class StaticSubscriber : public SubscriberImpl<T, H, BaseSubscriber<StaticSubscriberPortUser<PortPolicy>>>
+{
+    using Impl = SubscriberImpl<T, H, BaseSubscriber<StaticSubscriberPortUser<PortPolicy>>>;
+
+  public:
+    explicit StaticSubscriber(const capro::ServiceDescription& service,
+                              const SubscriberOptions& subscriberOptions = SubscriberOptions())
+        : Impl(service, PortPolicy::apply(subscriberOptions))
+    {
+    }
+
+    virtual ~StaticSubscriber() noexcept
+    {
+        Impl::m_trigger.reset();
+    }
+};
+
+/// @brief An UntypedSubscriber whose options are fixed at compile time by the PortPolicy, see StaticPortPolicy
+/// @param[in] PortPolicy a StaticPortPolicy
+template <typename PortPolicy = StaticPortPolicy<>>
+class StaticUntypedSubscriber : public UntypedSubscriberImpl<BaseSubscriber<StaticSubscriberPortUser<PortPolicy>>>
+{
+    using Impl = UntypedSubscriberImpl<BaseSubscriber<StaticSubscriberPortUser<PortPolicy>>>;
+
+  public:
+    explicit StaticUntypedSubscriber(const capro::ServiceDescription& service,
+                                     const SubscriberOptions& subscriberOptions = SubscriberOptions())
+        : Impl(service, PortPolicy::apply(subscriberOptions))
+    {
+    }
+
+    virtual ~StaticUntypedSubscriber() noexcept
+    {
+        Impl::m_trigger.reset();
+    }
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_STATIC_SUBSCRIBER_HPP
@@ -51,6 +51,13 @@ struct SubscriberOptions
     ///        i.e. require historyCapacity > 0 to be eligible to be connected
     bool requiresPublisherHistorySupport{false};
 
+    /// @brief The number of latest chunks which are kept in the window of the subscriber, see
+    /// Subscriber::takeWindow. Values larger than MAX_SUBSCRIBER_WINDOW_SIZE are limited to it; zero disables the
+    /// window.
+    /// @attention the chunks of the window are held on top of the MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY chunks
+    /// which can be held with take, the mempools have to provide windowSize additional chunks for every such subscriber
+    uint64_t windowSize{0U};
+
     /// @brief serialization of the SubscriberOptions
     cxx::Serialization serialize() const noexcept;
     /// @brief deserialization of the SubscriberOptions
@@ -27,12 +27,14 @@
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/notification_socket.hpp"
 #include "iceoryx_posh/popo/enum_trigger_type.hpp"
 #include "iceoryx_posh/popo/notification_attorney.hpp"
 #include "iceoryx_posh/popo/notification_callback.hpp"
 #include "iceoryx_posh/popo/notification_info.hpp"
 #include "iceoryx_posh/popo/trigger.hpp"
 #include "iceoryx_posh/popo/trigger_handle.hpp"
+#include "iceoryx_posh/popo/wait_strategy.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 
 namespace iox
@@ -45,6 +47,7 @@ enum class WaitSetError : uint8_t
 {
     WAIT_SET_FULL,
     ALREADY_ATTACHED,
+    UNABLE_TO_CREATE_FILE_DESCRIPTOR,
 };
 
 
@@ -61,8 +64,13 @@ class WaitSet
     static constexpr uint64_t CAPACITY = Capacity;
     using TriggerArray = cxx::optional<Trigger>[Capacity];
     using NotificationInfoVector = cxx::vector<const NotificationInfo*, CAPACITY>;
+    using NotificationInfoVisitor = cxx::function_ref<void(const NotificationInfo&)>;
 
     WaitSet() noexcept;
+
+    /// @brief creates a WaitSet which polls for notifications according to the WaitStrategy before it blocks
+    /// @param[in] waitStrategy defines the polling phase of wait() and timedWait()
+    explicit WaitSet(const WaitStrategy& waitStrategy) noexcept;
     ~WaitSet() noexcept;
 
     /// @brief all the Trigger have a pointer pointing to this waitset for cleanup
@@ -203,6 +211,29 @@ class WaitSet
     /// @return NotificationInfoVector of NotificationInfos that have been triggered
     NotificationInfoVector wait() noexcept;
 
+    /// @brief Blocking wait with time limit like timedWait but the triggered NotificationInfos are handed to the
+    /// visitor instead of being collected in a NotificationInfoVector, e.g. to write them directly into a buffer
+    /// @param[in] timeout How long shall we wait for a trigger
+    /// @param[in] visitor called once for every NotificationInfo that has been triggered
+    /// @return the number of NotificationInfos that have been triggered
+    uint64_t timedWaitAndVisit(const units::Duration timeout, const NotificationInfoVisitor& visitor) noexcept;
+
+    /// @brief Blocking wait like wait but the triggered NotificationInfos are handed to the visitor instead of being
+    /// collected in a NotificationInfoVector, e.g. to write them directly into a buffer
+    /// @param[in] visitor called once for every NotificationInfo that has been triggered
+    /// @return the number of NotificationInfos that have been triggered
+    uint64_t waitAndVisit(const NotificationInfoVisitor& visitor) noexcept;
+
+    /// @brief Provides a file descriptor which becomes readable when a trigger of the WaitSet was notified. It allows to
+    /// wait for the WaitSet together with sockets, timers and signals in a single epoll/poll/select call. When it is
+    /// readable, timedWait with a zero timeout returns the triggered triggers without blocking.
+    /// @return the file descriptor or WaitSetError::UNABLE_TO_CREATE_FILE_DESCRIPTOR; the file descriptor is owned by
+    /// the WaitSet and valid as long as the WaitSet lives
+    /// @note The file descriptor is drained by wait and timedWait and must not be read by the user. It is signaled
+    /// once per notification; a state based trigger which is still satisfied at the end of a wait makes it readable
+    /// again, therefore the reactor calls timedWait once more after the user handled the state.
+    cxx::expected<int32_t, WaitSetError> getFileDescriptor() noexcept;
+
     /// @brief Returns the amount of stored Trigger inside of the WaitSet
     uint64_t size() const noexcept;
 
@@ -210,7 +241,7 @@ class WaitSet
     static constexpr uint64_t capacity() noexcept;
 
   protected:
-    explicit WaitSet(ConditionVariableData& condVarData) noexcept;
+    explicit WaitSet(ConditionVariableData& condVarData, const WaitStrategy& waitStrategy = WaitStrategy()) noexcept;
 
   private:
     enum class NoStateEnumUsed : StateEnumIdentifier
@@ -233,7 +264,9 @@ class WaitSet
                                                      const uint64_t originTypeHash) noexcept;
 
     NotificationInfoVector waitAndReturnTriggeredTriggers(const WaitFunction& wait) noexcept;
-    NotificationInfoVector createVectorWithTriggeredTriggers() noexcept;
+    uint64_t waitAndVisitTriggeredTriggers(const WaitFunction& wait, const NotificationInfoVisitor& visitor) noexcept;
+    uint64_t visitTriggeredTriggers(const NotificationInfoVisitor& visitor) noexcept;
+    void rearmNotificationSocket() noexcept;
 
     void removeTrigger(const uint64_t uniqueTriggerId) noexcept;
     void removeAllTriggers() noexcept;
@@ -244,6 +277,7 @@ class WaitSet
     TriggerArray m_triggerArray;
     ConditionVariableData* m_conditionVariableDataPtr{nullptr};
     ConditionListener m_conditionListener;
+    cxx::optional<NotificationSocket> m_notificationSocket;
 
     cxx::stack<uint64_t, Capacity> m_indexRepository;
     ConditionListener::NotificationVector_t m_activeNotifications;
@@ -0,0 +1,49 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_WAIT_STRATEGY_HPP
+#define IOX_POSH_POPO_WAIT_STRATEGY_HPP
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Configures how a WaitSet or Listener waits for notifications. Before the waiting thread blocks on the
+/// semaphore of the condition variable it polls the notification flag, first in a busy loop and then while yielding
+/// the CPU. While the waiter polls, the notifiers do not post the semaphore which saves the syscall on both sides.
+/// @note The default strategy blocks immediately. Polling trades CPU time for wakeup latency and should be used only
+///       when the next notification is expected within a few microseconds.
+struct WaitStrategy
+{
+    /// @brief The number of busy loop iterations which poll the notification flag
+    uint64_t spinRepetitions{0U};
+
+    /// @brief The number of iterations which poll the notification flag and call std::this_thread::yield afterwards
+    uint64_t yieldRepetitions{0U};
+
+    /// @brief returns true if the waiter polls before it blocks
+    constexpr bool isPolling() const noexcept
+    {
+        return (spinRepetitions + yieldRepetitions) > 0U;
+    }
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_WAIT_STRATEGY_HPP
@@ -35,6 +35,7 @@ struct CmdLineArgs_t
     cxx::optional<uint16_t> uniqueRouDiId{cxx::nullopt};
     bool run{true};
     roudi::ConfigFilePathString_t configFilePath;
+    roudi::ConfigFilePathString_t mempoolProfilePath;
 };
 
 inline iox::log::LogStream& operator<<(iox::log::LogStream& logstream, const CmdLineArgs_t& cmdLineArgs) noexcept
@@ -53,6 +54,10 @@ inline iox::log::LogStream& operator<<(iox::log::LogStream& logstream, const Cmd
     {
         logstream << "Config file used is: < none >";
     }
+    if (!cmdLineArgs.mempoolProfilePath.empty())
+    {
+        logstream << "\nMempool profile is written to: " << cmdLineArgs.mempoolProfilePath;
+    }
     return logstream;
 }
 } // namespace config
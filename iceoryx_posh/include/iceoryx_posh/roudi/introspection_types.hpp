@@ -42,6 +42,16 @@ struct MemPoolInfo
     uint32_t m_numChunks{0};
     uint32_t m_chunkSize{0};
     uint32_t m_chunkPayloadSize{0};
+    /// @brief number of chunks which are kept free for publishers with a chunk quota
+    uint32_t m_reservedChunks{0};
+    /// @brief number of chunk requests which were rejected due to a chunk quota or the reservations
+    uint64_t m_rejectedChunkRequests{0};
+    /// @brief number of chunks which were lost by terminated processes and reclaimed by RouDi
+    uint64_t m_reclaimedChunks{0};
+    /// @brief NUMA node the chunks are placed on, NO_NUMA_NODE when the mempool has none
+    uint32_t m_numaNode{NO_NUMA_NODE};
+    /// @brief number of sampled pages of the mempool and its extents which are located on the NUMA node
+    uint32_t m_sampledPagesPerNumaNode[MAX_NUMBER_OF_NUMA_NODES]{};
 };
 
 /// @brief container for MemPoolInfo structs of all available mempools.
@@ -140,6 +150,30 @@ struct ProcessIntrospectionFieldTopic
     cxx::vector<ProcessIntrospectionData, MAX_PROCESS_NUMBER> m_processList;
 };
 
+/// @brief event id of the codec introspection of a gateway; every gateway publishes it with its runtime name as
+/// instance id
+constexpr const char INTROSPECTION_GATEWAY_CODEC_EVENT_ID[] = "GatewayCodec";
+constexpr uint32_t MAX_CODEC_NAME_LENGTH = 16;
+
+/// @brief the topic for the codec introspection of a gateway; one sample is published for every channel with a codec
+struct GatewayCodecIntrospectionTopic
+{
+    capro::IdString_t m_caproServiceID;
+    capro::IdString_t m_caproInstanceID;
+    capro::IdString_t m_caproEventMethodID;
+    cxx::string<MAX_CODEC_NAME_LENGTH> m_codec;
+    uint64_t m_encodedFrames{0};
+    uint64_t m_keyFrames{0};
+    uint64_t m_decodedFrames{0};
+    uint64_t m_codecErrors{0};
+    uint64_t m_rawBytes{0};
+    uint64_t m_encodedBytes{0};
+    /// @brief raw bytes / encoded bytes of all frames encoded so far
+    double m_compressionRatio{0};
+    uint64_t m_encodeTimeInNanoseconds{0};
+    uint64_t m_decodeTimeInNanoseconds{0};
+};
+
 } // namespace roudi
 } // namespace iox
 
@@ -24,6 +24,7 @@
 #include "iceoryx_hoofs/cxx/string.hpp"
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/mepoo/numa_placement.hpp"
 
 #include <cstdint>
 
@@ -39,9 +40,11 @@ class PosixShmMemoryProvider : public MemoryProvider
     /// @param [in] shmName is the name of the posix share memory
     /// @param [in] accessMode defines the read and write access to the memory
     /// @param [in] openMode defines the creation/open mode of the shared memory.
+    /// @param [in] numaPlacement defines on which NUMA nodes the pages of the shared memory are placed
     PosixShmMemoryProvider(const ShmName_t& shmName,
                            const posix::AccessMode accessMode,
-                           const posix::OpenMode openMode) noexcept;
+                           const posix::OpenMode openMode,
+                           const mepoo::NumaPlacement& numaPlacement = mepoo::NumaPlacement()) noexcept;
     ~PosixShmMemoryProvider() noexcept;
 
     PosixShmMemoryProvider(PosixShmMemoryProvider&&) = delete;
@@ -63,6 +66,7 @@ class PosixShmMemoryProvider : public MemoryProvider
     ShmName_t m_shmName;
     posix::AccessMode m_accessMode{posix::AccessMode::READ_ONLY};
     posix::OpenMode m_openMode{posix::OpenMode::OPEN_EXISTING};
+    mepoo::NumaPlacement m_numaPlacement;
     cxx::optional<posix::SharedMemoryObject> m_shmObject;
 
     static constexpr cxx::perms SHM_MEMORY_PERMISSIONS =
@@ -55,6 +55,7 @@ enum class PortPoolError : uint8_t
     SERVER_PORT_LIST_FULL,
     NODE_DATA_LIST_FULL,
     CONDITION_VARIABLE_LIST_FULL,
+    RUNTIME_REQUEST_CHANNEL_LIST_FULL,
     EVENT_VARIABLE_LIST_FULL,
 };
 
@@ -76,6 +77,7 @@ class PortPool
     cxx::vector<runtime::NodeData*, MAX_NODE_NUMBER> getNodeDataList() noexcept;
     cxx::vector<popo::ConditionVariableData*, MAX_NUMBER_OF_CONDITION_VARIABLES>
     getConditionVariableDataList() noexcept;
+    cxx::vector<runtime::RuntimeRequestChannelData*, MAX_PROCESS_NUMBER> getRuntimeRequestChannelDataList() noexcept;
 
     cxx::expected<PublisherPortRouDiType::MemberType_t*, PortPoolError>
     addPublisherPort(const capro::ServiceDescription& serviceDescription,
@@ -140,6 +142,12 @@ class PortPool
     cxx::expected<popo::ConditionVariableData*, PortPoolError>
     addConditionVariableData(const RuntimeName_t& runtimeName) noexcept;
 
+    cxx::expected<runtime::RuntimeRequestChannelData*, PortPoolError>
+    addRuntimeRequestChannelData(const RuntimeName_t& runtimeName) noexcept;
+
+    /// @brief returns the doorbell which is rung by the runtimes when a request was written to their request channel
+    concurrent::FutexEvent& runtimeRequestDoorbell() noexcept;
+
     /// @brief Removes a PublisherPortData from the internal pool
     /// @param[in] portData is a  pointer to the PublisherPortData to be removed
     /// @note after this call the provided PublisherPortData is no longer available for usage
@@ -175,6 +183,11 @@ class PortPool
     /// @note after this call the provided ConditionVariableData is no longer available for usage
     void removeConditionVariableData(const popo::ConditionVariableData* const conditionVariableData) noexcept;
 
+    /// @brief Removes a RuntimeRequestChannelData from the internal pool
+    /// @param[in] requestChannelData is a pointer to the RuntimeRequestChannelData to be removed
+    /// @note after this call the provided RuntimeRequestChannelData is no longer available for usage
+    void removeRuntimeRequestChannelData(const runtime::RuntimeRequestChannelData* const requestChannelData) noexcept;
+
   private:
     PortPoolData* m_portPoolData;
 };
@@ -30,9 +30,7 @@ inline iox::popo::SubscriberPortData* PortPool::constructSubscriber(const capro:
     return m_portPoolData->m_subscriberPortMembers.insert(
         serviceDescription,
         runtimeName,
-        (subscriberOptions.queueFullPolicy == popo::QueueFullPolicy::DISCARD_OLDEST_DATA)
-            ? cxx::VariantQueueTypes::SoFi_MultiProducerSingleConsumer
-            : cxx::VariantQueueTypes::FiFo_MultiProducerSingleConsumer,
+        popo::subscriberQueueType<T>(subscriberOptions.queueFullPolicy),
         subscriberOptions,
         memoryInfo);
 }
@@ -46,9 +44,7 @@ inline iox::popo::SubscriberPortData* PortPool::constructSubscriber(const capro:
     return m_portPoolData->m_subscriberPortMembers.insert(
         serviceDescription,
         runtimeName,
-        (subscriberOptions.queueFullPolicy == popo::QueueFullPolicy::DISCARD_OLDEST_DATA)
-            ? cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer
-            : cxx::VariantQueueTypes::FiFo_SingleProducerSingleConsumer,
+        popo::subscriberQueueType<T>(subscriberOptions.queueFullPolicy),
         subscriberOptions,
         memoryInfo);
 }
@@ -58,6 +58,7 @@ class RouDiApp
 
     version::CompatibilityCheckLevel m_compatibilityCheckLevel{version::CompatibilityCheckLevel::PATCH};
     units::Duration m_processKillDelay{roudi::PROCESS_DEFAULT_KILL_DELAY};
+    roudi::ConfigFilePathString_t m_mempoolProfilePath;
 
   private:
     bool checkAndOptimizeConfig(const RouDiConfig_t& config) noexcept;
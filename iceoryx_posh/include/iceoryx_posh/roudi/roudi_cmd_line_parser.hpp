@@ -69,6 +69,7 @@ class CmdLineParser
     version::CompatibilityCheckLevel m_compatibilityCheckLevel{version::CompatibilityCheckLevel::PATCH};
     cxx::optional<uint16_t> m_uniqueRouDiId;
     units::Duration m_processKillDelay{roudi::PROCESS_DEFAULT_KILL_DELAY};
+    roudi::ConfigFilePathString_t m_mempoolProfilePath;
 };
 
 } // namespace config
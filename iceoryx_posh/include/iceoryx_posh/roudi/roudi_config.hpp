@@ -17,6 +17,7 @@
 #define IOX_POSH_ROUDI_ROUDI_CONFIG_HPP
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/mepoo/numa_placement.hpp"
 
 #include <cstdint>
 
@@ -28,6 +29,10 @@ struct RouDiConfig
 {
     RouDiConfig& setDefaults() noexcept;
     RouDiConfig& optimize() noexcept;
+
+    /// @brief placement of the management memory of RouDi which contains e.g. the chunk queues and the condition
+    /// variables of all ports
+    mepoo::NumaPlacement m_managementNumaPlacement;
 };
 } // namespace config
 } // namespace iox
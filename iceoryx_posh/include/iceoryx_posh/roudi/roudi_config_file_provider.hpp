@@ -35,6 +35,7 @@ namespace roudi
 /// MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED - the max number of mempools per segment is exceeded
 /// MEMPOOL_WITHOUT_CHUNK_SIZE - chunk size not specified for the mempool
 /// MEMPOOL_WITHOUT_CHUNK_COUNT - chunk count not specified for the mempool
+/// INVALID_NUMA_PLACEMENT - unknown NUMA policy, NUMA policy without nodes or a NUMA node which is out of range
 enum class RouDiConfigFileParseError
 {
     NO_GENERAL_SECTION,
@@ -45,6 +46,7 @@ enum class RouDiConfigFileParseError
     MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED,
     MEMPOOL_WITHOUT_CHUNK_SIZE,
     MEMPOOL_WITHOUT_CHUNK_COUNT,
+    INVALID_NUMA_PLACEMENT,
     EXCEPTION_IN_PARSER
 };
 
@@ -56,6 +58,7 @@ constexpr const char* ROUDI_CONFIG_FILE_PARSE_ERROR_STRINGS[] = {"NO_GENERAL_SEC
                                                                  "MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED",
                                                                  "MEMPOOL_WITHOUT_CHUNK_SIZE",
                                                                  "MEMPOOL_WITHOUT_CHUNK_COUNT",
+                                                                 "INVALID_NUMA_PLACEMENT",
                                                                  "EXCEPTION_IN_PARSER"};
 
 /// @brief Base class for a config file provider.
@@ -19,6 +19,7 @@
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/roudi/service_registry.hpp"
+#include "iceoryx_posh/internal/roudi/service_registry_update.hpp"
 #include "iceoryx_posh/popo/subscriber.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 
@@ -59,6 +60,8 @@ class ServiceDiscovery
     /// @param[in] event event string to search for, a nullopt corresponds to a wildcard
     /// @param[in] callableForEach callable to apply to all matching services
     /// @param[in] pattern messaging pattern of the service to search
+    /// @note the callable is applied to a snapshot of the registry without holding a lock, therefore it may call
+    /// findService again; services which are offered or stopped meanwhile are found by the next findService
     void findService(const cxx::optional<capro::IdString_t>& service,
                      const cxx::optional<capro::IdString_t>& instance,
                      const cxx::optional<capro::IdString_t>& event,
@@ -77,13 +80,26 @@ class ServiceDiscovery
     // use dynamic memory to reduce stack usage
     /// @todo #1155 improve solution to avoid stack usage without using dynamic memory
     std::unique_ptr<roudi::ServiceRegistry> m_serviceRegistry{new iox::roudi::ServiceRegistry};
+    /// @brief immutable copy of m_serviceRegistry which findService iterates without holding the mutex; it is replaced
+    /// after updates were applied, a findService which still iterates the previous copy keeps it alive
+    std::shared_ptr<const roudi::ServiceRegistry> m_serviceRegistrySnapshot;
     std::mutex m_serviceRegistryMutex;
+    /// @brief version of the next update which can be applied to m_serviceRegistry; updates are ignored until the first
+    /// snapshot was applied
+    cxx::optional<uint64_t> m_nextServiceRegistryVersion;
 
-    popo::Subscriber<roudi::ServiceRegistry> m_serviceRegistrySubscriber{
+    popo::Subscriber<roudi::ServiceRegistryUpdate> m_serviceRegistrySubscriber{
         {SERVICE_DISCOVERY_SERVICE_NAME, SERVICE_DISCOVERY_INSTANCE_NAME, SERVICE_DISCOVERY_EVENT_NAME},
-        {1U, 1U, iox::NodeName_t("Service Registry"), true}};
+        {roudi::SERVICE_REGISTRY_SNAPSHOT_INTERVAL,
+         roudi::SERVICE_REGISTRY_SNAPSHOT_INTERVAL,
+         iox::NodeName_t("Service Registry"),
+         true}};
 
-    void update();
+    /// @brief applies the pending updates of the service registry in place; must be called with the
+    /// m_serviceRegistryMutex locked
+    /// @return true when at least one update was applied
+    bool update();
+    bool applyUpdate(const roudi::ServiceRegistryUpdate& update);
 };
 
 } // namespace runtime
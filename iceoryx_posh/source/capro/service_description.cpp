@@ -16,6 +16,7 @@
 // SPDX-License-Identifier: Apache-2.0
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_hoofs/cxx/convert.hpp"
+#include "iceoryx_hoofs/internal/cxx/fnv1a_hash.hpp"
 #include <iomanip>
 
 namespace iox
@@ -83,12 +84,32 @@ ServiceDescription::ServiceDescription(const IdString_t& service,
     , m_instanceString{instance}
     , m_eventString{event}
     , m_classHash(classHash)
+    , m_hash(computeHash(service, instance, event))
     , m_interfaceSource(interfaceSource)
 {
 }
 
+uint64_t ServiceDescription::computeHash(const IdString_t& service,
+                                         const IdString_t& instance,
+                                         const IdString_t& event) noexcept
+{
+    // 64-Bit FNV-1a over the string IDs including their null terminators which separate them
+    uint64_t hash{cxx::FNV1A_OFFSET_BASIS};
+    for (const auto id : {&service, &instance, &event})
+    {
+        hash = cxx::fnv1aHash(id->c_str(), id->size() + 1U, hash);
+    }
+    return hash;
+}
+
 bool ServiceDescription::operator==(const ServiceDescription& rhs) const noexcept
 {
+    // different hashes imply different strings, equal hashes still require to compare the strings
+    if (m_hash != rhs.m_hash)
+    {
+        return false;
+    }
+
     if (m_serviceString != rhs.m_serviceString)
     {
         return false;
@@ -178,6 +199,8 @@ ServiceDescription::deserialize(const cxx::Serialization& serialized) noexcept
 
     deserializedObject.m_scope = static_cast<Scope>(scope);
     deserializedObject.m_interfaceSource = static_cast<Interfaces>(interfaceSource);
+    deserializedObject.m_hash = computeHash(
+        deserializedObject.m_serviceString, deserializedObject.m_instanceString, deserializedObject.m_eventString);
 
     return cxx::success<ServiceDescription>(deserializedObject);
 }
@@ -217,6 +240,11 @@ ServiceDescription::ClassHash ServiceDescription::getClassHash() const noexcept
     return m_classHash;
 }
 
+uint64_t ServiceDescription::getHash() const noexcept
+{
+    return m_hash;
+}
+
 Interfaces ServiceDescription::getSourceInterface() const noexcept
 {
     return m_interfaceSource;
@@ -0,0 +1,567 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/gateway/codec.hpp"
+
+#include <chrono>
+#include <cstring>
+
+namespace iox
+{
+namespace gw
+{
+const char* asStringLiteral(const CodecType codec) noexcept
+{
+    switch (codec)
+    {
+    case CodecType::NONE:
+    case CodecType::LZ:
+    case CodecType::XOR_DELTA:
+    case CodecType::XOR_DELTA_LZ:
+        return CODEC_TYPE_STRINGS[static_cast<uint8_t>(codec)];
+    }
+    return "[Undefined CodecType]";
+}
+
+const char* asStringLiteral(const CodecError error) noexcept
+{
+    switch (error)
+    {
+    case CodecError::BUFFER_TOO_SMALL:
+        return "CodecError::BUFFER_TOO_SMALL";
+    case CodecError::INVALID_DATA:
+        return "CodecError::INVALID_DATA";
+    case CodecError::MISSING_REFERENCE:
+        return "CodecError::MISSING_REFERENCE";
+    }
+    return "[Undefined CodecError]";
+}
+
+namespace lz
+{
+namespace
+{
+constexpr uint64_t MIN_MATCH{4U};
+/// the last literals of a block are never part of a match
+constexpr uint64_t LAST_LITERALS{5U};
+/// a match must start at least this many bytes before the end of the block
+constexpr uint64_t MATCH_FIND_LIMIT{12U};
+constexpr uint64_t MAX_OFFSET{65535U};
+constexpr uint32_t HASH_LOG{12U};
+constexpr uint8_t RUN_MASK{15U};
+
+uint32_t read32(const uint8_t* const data) noexcept
+{
+    uint32_t value{0U};
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+uint32_t hash(const uint32_t sequence) noexcept
+{
+    return (sequence * 2654435761U) >> (32U - HASH_LOG);
+}
+
+class BlockWriter
+{
+  public:
+    BlockWriter(uint8_t* const destination, const uint64_t capacity) noexcept
+        : m_destination(destination)
+        , m_capacity(capacity)
+    {
+    }
+
+    bool writeSequence(const uint8_t* const literals,
+                       const uint64_t literalLength,
+                       const uint64_t offset,
+                       const uint64_t matchLength) noexcept
+    {
+        if (m_position >= m_capacity)
+        {
+            return false;
+        }
+        auto& token = m_destination[m_position++];
+        token = static_cast<uint8_t>(((literalLength >= RUN_MASK) ? RUN_MASK : literalLength) << 4U);
+        if (literalLength >= RUN_MASK && !writeLength(literalLength - RUN_MASK))
+        {
+            return false;
+        }
+        if (m_capacity - m_position < literalLength)
+        {
+            return false;
+        }
+        std::memcpy(m_destination + m_position, literals, literalLength);
+        m_position += literalLength;
+
+        if (matchLength == 0U)
+        {
+            return true;
+        }
+
+        if (m_capacity - m_position < 2U)
+        {
+            return false;
+        }
+        m_destination[m_position++] = static_cast<uint8_t>(offset & 0xFFU);
+        m_destination[m_position++] = static_cast<uint8_t>(offset >> 8U);
+
+        const uint64_t encodedMatchLength = matchLength - MIN_MATCH;
+        token = static_cast<uint8_t>(token | ((encodedMatchLength >= RUN_MASK) ? RUN_MASK : encodedMatchLength));
+        return encodedMatchLength < RUN_MASK || writeLength(encodedMatchLength - RUN_MASK);
+    }
+
+    uint64_t size() const noexcept
+    {
+        return m_position;
+    }
+
+  private:
+    bool writeLength(uint64_t length) noexcept
+    {
+        while (length >= 255U)
+        {
+            if (m_position >= m_capacity)
+            {
+                return false;
+            }
+            m_destination[m_position++] = 255U;
+            length -= 255U;
+        }
+        if (m_position >= m_capacity)
+        {
+            return false;
+        }
+        m_destination[m_position++] = static_cast<uint8_t>(length);
+        return true;
+    }
+
+    uint8_t* m_destination{nullptr};
+    uint64_t m_capacity{0U};
+    uint64_t m_position{0U};
+};
+
+bool readLength(const uint8_t* const source, const uint64_t sourceSize, uint64_t& position, uint64_t& length) noexcept
+{
+    uint8_t value{255U};
+    while (value == 255U)
+    {
+        if (position >= sourceSize)
+        {
+            return false;
+        }
+        value = source[position++];
+        length += value;
+    }
+    return true;
+}
+} // namespace
+
+cxx::expected<uint64_t, CodecError> compress(const uint8_t* const source,
+                                             const uint64_t sourceSize,
+                                             uint8_t* const destination,
+                                             const uint64_t destinationCapacity) noexcept
+{
+    BlockWriter writer(destination, destinationCapacity);
+    uint64_t anchor{0U};
+
+    if (sourceSize > MATCH_FIND_LIMIT)
+    {
+        // positions are stored relative to the source, a stale or unset entry is detected by comparing the data
+        uint32_t hashTable[1U << HASH_LOG]{};
+        const uint64_t matchLimit = sourceSize - LAST_LITERALS;
+        uint64_t position{0U};
+
+        while (position <= sourceSize - MATCH_FIND_LIMIT)
+        {
+            const auto sequence = read32(source + position);
+            auto& entry = hashTable[hash(sequence)];
+            const uint64_t reference = entry;
+            entry = static_cast<uint32_t>(position);
+
+            if (reference >= position || position - reference > MAX_OFFSET || read32(source + reference) != sequence)
+            {
+                ++position;
+                continue;
+            }
+
+            uint64_t matchLength{MIN_MATCH};
+            while (position + matchLength < matchLimit
+                   && source[reference + matchLength] == source[position + matchLength])
+            {
+                ++matchLength;
+            }
+
+            if (!writer.writeSequence(source + anchor, position - anchor, position - reference, matchLength))
+            {
+                return cxx::error<CodecError>(CodecError::BUFFER_TOO_SMALL);
+            }
+            position += matchLength;
+            anchor = position;
+        }
+    }
+
+    if (!writer.writeSequence(source + anchor, sourceSize - anchor, 0U, 0U))
+    {
+        return cxx::error<CodecError>(CodecError::BUFFER_TOO_SMALL);
+    }
+    return cxx::success<uint64_t>(writer.size());
+}
+
+cxx::expected<uint64_t, CodecError> decompress(const uint8_t* const source,
+                                               const uint64_t sourceSize,
+                                               uint8_t* const destination,
+                                               const uint64_t destinationCapacity) noexcept
+{
+    uint64_t inputPosition{0U};
+    uint64_t outputPosition{0U};
+
+    while (true)
+    {
+        if (inputPosition >= sourceSize)
+        {
+            return cxx::error<CodecError>(CodecError::INVALID_DATA);
+        }
+        const uint8_t token = source[inputPosition++];
+
+        uint64_t literalLength = token >> 4U;
+        if (literalLength == RUN_MASK && !readLength(source, sourceSize, inputPosition, literalLength))
+        {
+            return cxx::error<CodecError>(CodecError::INVALID_DATA);
+        }
+        if (sourceSize - inputPosition < literalLength)
+        {
+            return cxx::error<CodecError>(CodecError::INVALID_DATA);
+        }
+        if (destinationCapacity - outputPosition < literalLength)
+        {
+            return cxx::error<CodecError>(CodecError::BUFFER_TOO_SMALL);
+        }
+        std::memcpy(destination + outputPosition, source + inputPosition, literalLength);
+        inputPosition += literalLength;
+        outputPosition += literalLength;
+
+        // the last sequence consists only of literals
+        if (inputPosition == sourceSize)
+        {
+            return cxx::success<uint64_t>(outputPosition);
+        }
+
+        if (sourceSize - inputPosition < 2U)
+        {
+            return cxx::error<CodecError>(CodecError::INVALID_DATA);
+        }
+        const uint64_t offset =
+            static_cast<uint64_t>(source[inputPosition]) | (static_cast<uint64_t>(source[inputPosition + 1U]) << 8U);
+        inputPosition += 2U;
+        if (offset == 0U || offset > outputPosition)
+        {
+            return cxx::error<CodecError>(CodecError::INVALID_DATA);
+        }
+
+        uint64_t matchLength = token & RUN_MASK;
+        if (matchLength == RUN_MASK && !readLength(source, sourceSize, inputPosition, matchLength))
+        {
+            return cxx::error<CodecError>(CodecError::INVALID_DATA);
+        }
+        matchLength += MIN_MATCH;
+        if (destinationCapacity - outputPosition < matchLength)
+        {
+            return cxx::error<CodecError>(CodecError::BUFFER_TOO_SMALL);
+        }
+
+        const uint8_t* match = destination + outputPosition - offset;
+        if (offset >= matchLength)
+        {
+            std::memcpy(destination + outputPosition, match, matchLength);
+        }
+        else
+        {
+            // an overlapping match repeats the last offset bytes
+            for (uint64_t i = 0U; i < matchLength; ++i)
+            {
+                destination[outputPosition + i] = match[i];
+            }
+        }
+        outputPosition += matchLength;
+    }
+}
+} // namespace lz
+
+double CodecStatistics::compressionRatio() const noexcept
+{
+    return (m_encodedBytes == 0U) ? 0.0 : static_cast<double>(m_rawBytes) / static_cast<double>(m_encodedBytes);
+}
+
+constexpr uint64_t ChannelCodec::KEY_FRAME_INTERVAL;
+constexpr uint32_t ChannelCodec::DEFAULT_MAX_PAYLOAD_SIZE;
+constexpr uint8_t ChannelCodec::FrameHeader::DELTA;
+constexpr uint8_t ChannelCodec::FrameHeader::COMPRESSED;
+
+ChannelCodec::ChannelCodec(const CodecType codec, const uint32_t maxPayloadSize) noexcept
+    : m_codec(codec)
+    , m_maxPayloadSize(maxPayloadSize)
+{
+    if (usesDelta())
+    {
+        m_encodeReference.resize(m_maxPayloadSize);
+        m_decodeReference.resize(m_maxPayloadSize);
+        m_delta.resize(m_maxPayloadSize);
+    }
+}
+
+CodecType ChannelCodec::codec() const noexcept
+{
+    return m_codec;
+}
+
+uint32_t ChannelCodec::maxPayloadSize() const noexcept
+{
+    return m_maxPayloadSize;
+}
+
+uint64_t ChannelCodec::maxEncodedSize(const uint32_t payloadSize) noexcept
+{
+    // a frame whose payload cannot be compressed is stored raw
+    return sizeof(FrameHeader) + payloadSize;
+}
+
+bool ChannelCodec::usesDelta() const noexcept
+{
+    return m_codec == CodecType::XOR_DELTA || m_codec == CodecType::XOR_DELTA_LZ;
+}
+
+bool ChannelCodec::usesCompression() const noexcept
+{
+    return m_codec == CodecType::LZ || m_codec == CodecType::XOR_DELTA_LZ;
+}
+
+cxx::expected<uint64_t, CodecError> ChannelCodec::encode(const void* const payload,
+                                                         const uint32_t payloadSize,
+                                                         void* const frame,
+                                                         const uint64_t frameCapacity) noexcept
+{
+    if (frameCapacity < maxEncodedSize(payloadSize))
+    {
+        m_codecErrors.fetch_add(1U, std::memory_order_relaxed);
+        return cxx::error<CodecError>(CodecError::BUFFER_TOO_SMALL);
+    }
+
+    const auto startTime = std::chrono::steady_clock::now();
+
+    FrameHeader header;
+    header.m_codec = static_cast<uint8_t>(m_codec);
+    header.m_payloadSize = payloadSize;
+    auto source = static_cast<const uint8_t*>(payload);
+    auto encodedPayload = static_cast<uint8_t*>(frame) + sizeof(FrameHeader);
+
+    if (usesDelta())
+    {
+        const bool isKeyFrame = m_encodeReferenceSize != cxx::make_optional<uint32_t>(payloadSize)
+                                || m_framesSinceKeyFrame + 1U >= KEY_FRAME_INTERVAL;
+        if (isKeyFrame)
+        {
+            m_framesSinceKeyFrame = 0U;
+            m_keyFrames.fetch_add(1U, std::memory_order_relaxed);
+        }
+        else
+        {
+            ++m_framesSinceKeyFrame;
+            for (uint32_t i = 0U; i < payloadSize; ++i)
+            {
+                m_delta[i] = static_cast<uint8_t>(source[i] ^ m_encodeReference[i]);
+            }
+            header.m_flags = static_cast<uint8_t>(header.m_flags | FrameHeader::DELTA);
+            header.m_frameIndex = static_cast<uint16_t>(m_framesSinceKeyFrame);
+        }
+        if (payloadSize <= m_maxPayloadSize)
+        {
+            std::memcpy(m_encodeReference.data(), source, payloadSize);
+            m_encodeReferenceSize.emplace(payloadSize);
+        }
+        else
+        {
+            m_encodeReferenceSize.reset();
+        }
+        if (!isKeyFrame)
+        {
+            source = m_delta.data();
+        }
+    }
+
+    uint64_t encodedPayloadSize{payloadSize};
+    bool isCompressed{false};
+    if (usesCompression())
+    {
+        // the capacity is limited to the payload size, a block which does not become smaller is stored raw
+        lz::compress(source, payloadSize, encodedPayload, payloadSize).and_then([&](const uint64_t compressedSize) {
+            encodedPayloadSize = compressedSize;
+            isCompressed = true;
+        });
+    }
+    if (isCompressed)
+    {
+        header.m_flags = static_cast<uint8_t>(header.m_flags | FrameHeader::COMPRESSED);
+    }
+    else
+    {
+        std::memcpy(encodedPayload, source, payloadSize);
+    }
+    std::memcpy(frame, &header, sizeof(FrameHeader));
+
+    const uint64_t frameSize = sizeof(FrameHeader) + encodedPayloadSize;
+    const auto encodeTime =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime).count();
+    m_encodedFrames.fetch_add(1U, std::memory_order_relaxed);
+    m_rawBytes.fetch_add(payloadSize, std::memory_order_relaxed);
+    m_encodedBytes.fetch_add(frameSize, std::memory_order_relaxed);
+    m_encodeTimeInNanoseconds.fetch_add(static_cast<uint64_t>(encodeTime), std::memory_order_relaxed);
+
+    return cxx::success<uint64_t>(frameSize);
+}
+
+cxx::expected<uint32_t, CodecError> ChannelCodec::decodedSize(const void* const frame,
+                                                              const uint64_t frameSize) const noexcept
+{
+    if (frameSize < sizeof(FrameHeader))
+    {
+        return cxx::error<CodecError>(CodecError::INVALID_DATA);
+    }
+    FrameHeader header;
+    std::memcpy(&header, frame, sizeof(FrameHeader));
+    if (header.m_codec != static_cast<uint8_t>(m_codec))
+    {
+        return cxx::error<CodecError>(CodecError::INVALID_DATA);
+    }
+    return cxx::success<uint32_t>(header.m_payloadSize);
+}
+
+cxx::expected<uint32_t, CodecError> ChannelCodec::decode(const void* const frame,
+                                                         const uint64_t frameSize,
+                                                         void* const payload,
+                                                         const uint64_t payloadCapacity) noexcept
+{
+    const auto startTime = std::chrono::steady_clock::now();
+
+    auto result = decodeFrame(frame, frameSize, payload, payloadCapacity);
+    if (result.has_error())
+    {
+        m_codecErrors.fetch_add(1U, std::memory_order_relaxed);
+        return result;
+    }
+
+    const auto decodeTime =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime).count();
+    m_decodedFrames.fetch_add(1U, std::memory_order_relaxed);
+    m_decodeTimeInNanoseconds.fetch_add(static_cast<uint64_t>(decodeTime), std::memory_order_relaxed);
+    return result;
+}
+
+cxx::expected<uint32_t, CodecError> ChannelCodec::decodeFrame(const void* const frame,
+                                                              const uint64_t frameSize,
+                                                              void* const payload,
+                                                              const uint64_t payloadCapacity) noexcept
+{
+    auto decodedSizeResult = decodedSize(frame, frameSize);
+    if (decodedSizeResult.has_error())
+    {
+        return decodedSizeResult;
+    }
+    const uint32_t payloadSize = decodedSizeResult.value();
+    if (payloadCapacity < payloadSize)
+    {
+        return cxx::error<CodecError>(CodecError::BUFFER_TOO_SMALL);
+    }
+
+    FrameHeader header;
+    std::memcpy(&header, frame, sizeof(FrameHeader));
+    const bool isDelta = (header.m_flags & FrameHeader::DELTA) != 0U;
+    const bool isCompressed = (header.m_flags & FrameHeader::COMPRESSED) != 0U;
+    if ((isDelta && !usesDelta()) || (isCompressed && !usesCompression()))
+    {
+        return cxx::error<CodecError>(CodecError::INVALID_DATA);
+    }
+    if (isDelta
+        && (m_decodeReferenceSize != cxx::make_optional<uint32_t>(payloadSize)
+            || header.m_frameIndex != m_decodeFrameIndex + 1U))
+    {
+        // the previous frame was lost, the decoder recovers with the next key frame
+        m_decodeReferenceSize.reset();
+        return cxx::error<CodecError>(CodecError::MISSING_REFERENCE);
+    }
+
+    auto encodedPayload = static_cast<const uint8_t*>(frame) + sizeof(FrameHeader);
+    const uint64_t encodedPayloadSize = frameSize - sizeof(FrameHeader);
+    auto destination = static_cast<uint8_t*>(payload);
+    if (isCompressed)
+    {
+        auto decompressResult = lz::decompress(encodedPayload, encodedPayloadSize, destination, payloadSize);
+        if (decompressResult.has_error() || decompressResult.value() != payloadSize)
+        {
+            m_decodeReferenceSize.reset();
+            return cxx::error<CodecError>(CodecError::INVALID_DATA);
+        }
+    }
+    else
+    {
+        if (encodedPayloadSize != payloadSize)
+        {
+            m_decodeReferenceSize.reset();
+            return cxx::error<CodecError>(CodecError::INVALID_DATA);
+        }
+        std::memcpy(destination, encodedPayload, payloadSize);
+    }
+
+    if (isDelta)
+    {
+        for (uint32_t i = 0U; i < payloadSize; ++i)
+        {
+            destination[i] = static_cast<uint8_t>(destination[i] ^ m_decodeReference[i]);
+        }
+    }
+    if (usesDelta())
+    {
+        if (payloadSize <= m_maxPayloadSize)
+        {
+            std::memcpy(m_decodeReference.data(), destination, payloadSize);
+            m_decodeReferenceSize.emplace(payloadSize);
+        }
+        else
+        {
+            m_decodeReferenceSize.reset();
+        }
+        m_decodeFrameIndex = header.m_frameIndex;
+    }
+
+    return cxx::success<uint32_t>(payloadSize);
+}
+
+CodecStatistics ChannelCodec::statistics() const noexcept
+{
+    CodecStatistics statistics;
+    statistics.m_encodedFrames = m_encodedFrames.load(std::memory_order_relaxed);
+    statistics.m_keyFrames = m_keyFrames.load(std::memory_order_relaxed);
+    statistics.m_decodedFrames = m_decodedFrames.load(std::memory_order_relaxed);
+    statistics.m_codecErrors = m_codecErrors.load(std::memory_order_relaxed);
+    statistics.m_rawBytes = m_rawBytes.load(std::memory_order_relaxed);
+    statistics.m_encodedBytes = m_encodedBytes.load(std::memory_order_relaxed);
+    statistics.m_encodeTimeInNanoseconds = m_encodeTimeInNanoseconds.load(std::memory_order_relaxed);
+    statistics.m_decodeTimeInNanoseconds = m_decodeTimeInNanoseconds.load(std::memory_order_relaxed);
+    return statistics;
+}
+
+} // namespace gw
+} // namespace iox
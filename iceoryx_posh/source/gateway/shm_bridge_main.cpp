@@ -0,0 +1,143 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_dust/posix_wrapper/signal_watcher.hpp"
+#include "iceoryx_hoofs/platform/getopt.hpp"
+#include "iceoryx_posh/gateway/gateway_config.hpp"
+#include "iceoryx_posh/gateway/shm_bridge.hpp"
+#include "iceoryx_posh/gateway/toml_gateway_config_parser.hpp"
+#include "iceoryx_posh/internal/log/posh_logging.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+
+#include <iostream>
+#include <memory>
+#include <string>
+
+namespace
+{
+void printHelp() noexcept
+{
+    std::cout << "Usage: iox-shm-bridge [options]" << std::endl;
+    std::cout << "Bridges the services of one iceoryx system into another one on the same host." << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << "-h, --help                        Display help." << std::endl;
+    std::cout << "-r, --role <sender|receiver>      The sender runs in the system where the data is published,"
+              << std::endl;
+    std::cout << "                                  the receiver in the system where it is republished." << std::endl;
+    std::cout << "-n, --name <name>                 Name of the bridge, default: \"default\"." << std::endl;
+    std::cout << "-c, --config-file <path>          Gateway config with the services the sender subscribes to"
+              << std::endl;
+    std::cout << "                                  before they are offered." << std::endl;
+    std::cout << "-p, --peer-shm-directory <path>   Receiver only, the directory under which the shared memory"
+              << std::endl;
+    std::cout << "                                  of the sending system is visible, default: \"/dev/shm\"."
+              << std::endl;
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    constexpr option LONG_OPTIONS[] = {{"help", no_argument, nullptr, 'h'},
+                                       {"role", required_argument, nullptr, 'r'},
+                                       {"name", required_argument, nullptr, 'n'},
+                                       {"config-file", required_argument, nullptr, 'c'},
+                                       {"peer-shm-directory", required_argument, nullptr, 'p'},
+                                       {nullptr, 0, nullptr, 0}};
+    constexpr const char* SHORT_OPTIONS = "hr:n:c:p:";
+
+    std::string role;
+    iox::ShmName_t bridgeName{"default"};
+    iox::cxx::optional<iox::roudi::ConfigFilePathString_t> configFilePath;
+    std::string peerShmDirectory{"/dev/shm"};
+
+    int32_t index;
+    int32_t opt{-1};
+    while (opt = getopt_long(argc, argv, SHORT_OPTIONS, LONG_OPTIONS, &index), opt != -1)
+    {
+        switch (opt)
+        {
+        case 'h':
+            printHelp();
+            return EXIT_SUCCESS;
+        case 'r':
+            role = optarg;
+            break;
+        case 'n':
+            bridgeName = iox::ShmName_t(iox::cxx::TruncateToCapacity, optarg);
+            break;
+        case 'c':
+            configFilePath.emplace(iox::cxx::TruncateToCapacity, optarg);
+            break;
+        case 'p':
+            peerShmDirectory = optarg;
+            break;
+        default:
+            printHelp();
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (role != "sender" && role != "receiver")
+    {
+        std::cerr << "The role must be \"sender\" or \"receiver\"" << std::endl;
+        printHelp();
+        return EXIT_FAILURE;
+    }
+
+    iox::runtime::RuntimeName_t runtimeName{"iox-shm-bridge-"};
+    runtimeName.append(iox::cxx::TruncateToCapacity, role);
+    iox::runtime::PoshRuntime::initRuntime(runtimeName);
+
+    if (role == "sender")
+    {
+        auto transfer = iox::gw::ShmBridgeTransfer::create(bridgeName);
+        if (transfer.has_error())
+        {
+            return EXIT_FAILURE;
+        }
+
+        iox::config::GatewayConfig gatewayConfig;
+        auto parseResult = configFilePath.has_value()
+                               ? iox::config::TomlGatewayConfigParser::parse(configFilePath.value())
+                               : iox::config::TomlGatewayConfigParser::parse();
+        parseResult.and_then([&](auto config) { gatewayConfig = config; }).or_else([&](auto err) {
+            iox::LogWarn() << "[Main] Failed to parse gateway config with error: "
+                           << iox::config::TOML_GATEWAY_CONFIG_FILE_PARSE_ERROR_STRINGS[err];
+            iox::LogWarn() << "[Main] Using default configuration.";
+            gatewayConfig.setDefaults();
+        });
+
+        auto sender = std::make_unique<iox::gw::ShmBridgeSender<>>(std::move(transfer.value()));
+        sender->loadConfiguration(gatewayConfig);
+        sender->runMultithreaded();
+
+        // Run until SIGINT or SIGTERM
+        iox::posix::waitForTerminationRequest();
+    }
+    else
+    {
+        const auto transferSegmentName = iox::gw::ShmBridgeTransfer::transferSegmentName(bridgeName);
+        auto receiver = std::make_unique<iox::gw::ShmBridgeReceiver<>>(
+            peerShmDirectory + "/" + transferSegmentName.c_str(), peerShmDirectory);
+        receiver->runMultithreaded();
+
+        // Run until SIGINT or SIGTERM
+        iox::posix::waitForTerminationRequest();
+    }
+
+    return EXIT_SUCCESS;
+}
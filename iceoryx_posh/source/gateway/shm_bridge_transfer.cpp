@@ -0,0 +1,341 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/gateway/shm_bridge_transfer.hpp"
+#include "iceoryx_hoofs/platform/fcntl.hpp"
+#include "iceoryx_hoofs/platform/stat.hpp"
+#include "iceoryx_hoofs/platform/unistd.hpp"
+#include "iceoryx_hoofs/posix_wrapper/posix_call.hpp"
+#include "iceoryx_posh/internal/log/posh_logging.hpp"
+
+#include <cstring>
+#include <new>
+
+namespace iox
+{
+namespace gw
+{
+constexpr const char ShmBridgeTransfer::TRANSFER_SEGMENT_PREFIX[];
+
+const char* asStringLiteral(const ShmBridgeError error) noexcept
+{
+    switch (error)
+    {
+    case ShmBridgeError::UNABLE_TO_CREATE_TRANSFER_SEGMENT:
+        return "ShmBridgeError::UNABLE_TO_CREATE_TRANSFER_SEGMENT";
+    case ShmBridgeError::UNABLE_TO_OPEN_TRANSFER_SEGMENT:
+        return "ShmBridgeError::UNABLE_TO_OPEN_TRANSFER_SEGMENT";
+    case ShmBridgeError::INCOMPATIBLE_TRANSFER_SEGMENT:
+        return "ShmBridgeError::INCOMPATIBLE_TRANSFER_SEGMENT";
+    case ShmBridgeError::UNABLE_TO_MAP_PEER_SEGMENT:
+        return "ShmBridgeError::UNABLE_TO_MAP_PEER_SEGMENT";
+    case ShmBridgeError::INVALID_CHUNK:
+        return "ShmBridgeError::INVALID_CHUNK";
+    case ShmBridgeError::MULTI_CHUNK_SAMPLE:
+        return "ShmBridgeError::MULTI_CHUNK_SAMPLE";
+    case ShmBridgeError::TOO_MANY_SEGMENTS:
+        return "ShmBridgeError::TOO_MANY_SEGMENTS";
+    case ShmBridgeError::TOO_MANY_LANES:
+        return "ShmBridgeError::TOO_MANY_LANES";
+    }
+    return "[Undefined ShmBridgeError]";
+}
+
+namespace
+{
+/// @brief opens and maps a file of the shared memory directory, the file descriptor is not needed after the mapping
+cxx::expected<posix::MemoryMap, ShmBridgeError> mapFile(const std::string& path,
+                                                        const posix::AccessMode accessMode,
+                                                        const ShmBridgeError mappingError,
+                                                        uint64_t& size,
+                                                        uint64_t& inode) noexcept
+{
+    const int oflags = (accessMode == posix::AccessMode::READ_WRITE) ? O_RDWR : O_RDONLY;
+    auto openCall = posix::posixCall(iox_open)(path.c_str(), oflags, 0).failureReturnValue(-1).evaluate();
+    if (openCall.has_error())
+    {
+        // a missing transfer segment is expected while the sender is not started, the caller decides how to report it
+        LogDebug() << "Unable to open \"" << path << "\" : " << openCall.get_error().getHumanReadableErrnum();
+        return cxx::error<ShmBridgeError>(mappingError);
+    }
+    const int32_t fileDescriptor = openCall->value;
+
+    cxx::optional<posix::MemoryMap> memoryMap;
+    struct stat fileStat;
+    if (!posix::posixCall(fstat)(fileDescriptor, &fileStat).failureReturnValue(-1).evaluate().has_error()
+        && fileStat.st_size > 0)
+    {
+        size = static_cast<uint64_t>(fileStat.st_size);
+        inode = fileStat.st_ino;
+        posix::MemoryMapBuilder()
+            .length(size)
+            .fileDescriptor(fileDescriptor)
+            .accessMode(accessMode)
+            .flags(posix::MemoryMapFlags::SHARE_CHANGES)
+            .create()
+            .and_then([&](auto& map) { memoryMap.emplace(std::move(map)); });
+    }
+
+    IOX_DISCARD_RESULT(posix::posixCall(iox_close)(fileDescriptor).failureReturnValue(-1).evaluate());
+
+    if (!memoryMap.has_value())
+    {
+        LogError() << "Unable to map \"" << path << "\"";
+        return cxx::error<ShmBridgeError>(mappingError);
+    }
+    return cxx::success<posix::MemoryMap>(std::move(memoryMap.value()));
+}
+
+bool isInRange(const uint64_t offset, const uint64_t length, const uint64_t size) noexcept
+{
+    return offset <= size && length <= size - offset;
+}
+} // namespace
+
+// ============================================ ShmBridgeTransfer ============================================ //
+
+ShmName_t ShmBridgeTransfer::transferSegmentName(const ShmName_t& bridgeName) noexcept
+{
+    ShmName_t name{TRANSFER_SEGMENT_PREFIX};
+    name.append(cxx::TruncateToCapacity, bridgeName);
+    return name;
+}
+
+cxx::expected<ShmBridgeTransfer, ShmBridgeError> ShmBridgeTransfer::create(const ShmName_t& bridgeName) noexcept
+{
+    const auto name = transferSegmentName(bridgeName);
+    auto sharedMemory =
+        posix::SharedMemoryObjectBuilder()
+            .name(posix::SharedMemory::Name_t(cxx::TruncateToCapacity, name.c_str(), name.size()))
+            .memorySizeInBytes(sizeof(ShmBridgeTransferData))
+            .accessMode(posix::AccessMode::READ_WRITE)
+            .openMode(posix::OpenMode::PURGE_AND_CREATE)
+            .permissions(cxx::perms::owner_read | cxx::perms::owner_write | cxx::perms::group_read
+                         | cxx::perms::group_write)
+            .create();
+    if (sharedMemory.has_error())
+    {
+        LogError() << "Unable to create the shared memory bridge transfer segment \"" << name << "\"";
+        return cxx::error<ShmBridgeError>(ShmBridgeError::UNABLE_TO_CREATE_TRANSFER_SEGMENT);
+    }
+    return cxx::success<ShmBridgeTransfer>(ShmBridgeTransfer(std::move(sharedMemory.value())));
+}
+
+cxx::expected<ShmBridgeTransfer, ShmBridgeError> ShmBridgeTransfer::open(const std::string& path) noexcept
+{
+    uint64_t size{0U};
+    uint64_t inode{0U};
+    auto memoryMap =
+        mapFile(path, posix::AccessMode::READ_WRITE, ShmBridgeError::UNABLE_TO_OPEN_TRANSFER_SEGMENT, size, inode);
+    if (memoryMap.has_error())
+    {
+        return cxx::error<ShmBridgeError>(memoryMap.get_error());
+    }
+
+    const auto data = static_cast<const ShmBridgeTransferData*>(memoryMap->getBaseAddress());
+    if (size != sizeof(ShmBridgeTransferData) || data->m_magic != ShmBridgeTransferData::MAGIC
+        || data->m_version != ShmBridgeTransferData::VERSION
+        || data->m_chunkHeaderVersion != mepoo::ChunkHeader::CHUNK_HEADER_VERSION)
+    {
+        LogError() << "The shared memory bridge transfer segment \"" << path
+                   << "\" was created by an incompatible version";
+        return cxx::error<ShmBridgeError>(ShmBridgeError::INCOMPATIBLE_TRANSFER_SEGMENT);
+    }
+
+    return cxx::success<ShmBridgeTransfer>(ShmBridgeTransfer(path, inode, std::move(memoryMap.value())));
+}
+
+ShmBridgeTransfer::ShmBridgeTransfer(posix::SharedMemoryObject&& sharedMemory) noexcept
+    : m_sharedMemory(std::move(sharedMemory))
+{
+    m_data = new (m_sharedMemory->allocate(sizeof(ShmBridgeTransferData), alignof(ShmBridgeTransferData)))
+        ShmBridgeTransferData();
+    m_sharedMemory->finalizeAllocation();
+}
+
+ShmBridgeTransfer::ShmBridgeTransfer(const std::string& path,
+                                     const uint64_t inode,
+                                     posix::MemoryMap&& memoryMap) noexcept
+    : m_memoryMap(std::move(memoryMap))
+    , m_path(path)
+    , m_inode(inode)
+    , m_data(static_cast<ShmBridgeTransferData*>(m_memoryMap->getBaseAddress()))
+{
+}
+
+ShmBridgeTransferData& ShmBridgeTransfer::data() noexcept
+{
+    return *m_data;
+}
+
+const ShmBridgeTransferData& ShmBridgeTransfer::data() const noexcept
+{
+    return *m_data;
+}
+
+cxx::expected<uint32_t, ShmBridgeError>
+ShmBridgeTransfer::openLane(const capro::ServiceDescription& service) noexcept
+{
+    for (uint32_t laneIndex = 0U; laneIndex < ShmBridgeTransferData::MAX_LANES; ++laneIndex)
+    {
+        auto& lane = m_data->m_lanes[laneIndex];
+        const auto writeIndex = lane.m_writeIndex.load(std::memory_order_relaxed);
+        // a closed lane with descriptors which were not consumed by the receiver cannot be reused since the receiver
+        // might still read them
+        if (lane.m_isOpen.load(std::memory_order_relaxed)
+            || lane.m_readIndex.load(std::memory_order_acquire) < writeIndex)
+        {
+            continue;
+        }
+
+        lane.m_service = service;
+        lane.m_activation.fetch_add(1U, std::memory_order_relaxed);
+        lane.m_isOpen.store(true, std::memory_order_release);
+        m_data->m_laneGeneration.fetch_add(1U, std::memory_order_release);
+        return cxx::success<uint32_t>(laneIndex);
+    }
+    return cxx::error<ShmBridgeError>(ShmBridgeError::TOO_MANY_LANES);
+}
+
+void ShmBridgeTransfer::closeLane(const uint32_t laneIndex) noexcept
+{
+    m_data->m_lanes[laneIndex].m_isOpen.store(false, std::memory_order_release);
+    m_data->m_laneGeneration.fetch_add(1U, std::memory_order_release);
+}
+
+cxx::expected<uint32_t, ShmBridgeError> ShmBridgeTransfer::segmentIndex(const ShmName_t& sharedMemoryName) noexcept
+{
+    const auto numberOfSegments = m_data->m_numberOfSegments.load(std::memory_order_relaxed);
+    for (uint32_t index = 0U; index < numberOfSegments; ++index)
+    {
+        if (m_data->m_segmentNames[index] == sharedMemoryName)
+        {
+            return cxx::success<uint32_t>(index);
+        }
+    }
+
+    if (numberOfSegments >= ShmBridgeTransferData::MAX_SEGMENTS)
+    {
+        return cxx::error<ShmBridgeError>(ShmBridgeError::TOO_MANY_SEGMENTS);
+    }
+    // the name is written before the count is published, the receiver reads only names below the count
+    m_data->m_segmentNames[numberOfSegments] = sharedMemoryName;
+    m_data->m_numberOfSegments.store(numberOfSegments + 1U, std::memory_order_release);
+    return cxx::success<uint32_t>(numberOfSegments);
+}
+
+bool ShmBridgeTransfer::isStale() const noexcept
+{
+    if (m_path.empty())
+    {
+        return false;
+    }
+    struct stat fileStat;
+    auto statCall = posix::posixCall(stat)(m_path.c_str(), &fileStat).failureReturnValue(-1).evaluate();
+    return statCall.has_error() || fileStat.st_ino != m_inode;
+}
+
+// ========================================== ShmBridgePeerSegments ========================================== //
+
+ShmBridgePeerSegments::ShmBridgePeerSegments(const std::string& peerShmDirectory) noexcept
+    : m_peerShmDirectory(peerShmDirectory)
+{
+}
+
+cxx::expected<const mepoo::ChunkHeader*, ShmBridgeError>
+ShmBridgePeerSegments::resolve(const ShmBridgeTransferData& transfer,
+                               const ShmBridgeChunkDescriptor& descriptor) noexcept
+{
+    auto peerSegment = segment(transfer, descriptor.m_segmentIndex);
+    if (peerSegment.has_error())
+    {
+        return cxx::error<ShmBridgeError>(peerSegment.get_error());
+    }
+
+    // the chunk is written by another process, every size is checked before memory behind it is accessed
+    const uint64_t size = peerSegment.value()->m_size;
+    const uint64_t offset = descriptor.m_chunkOffset;
+    if (!isInRange(offset, sizeof(mepoo::ChunkHeader), size) || offset % alignof(mepoo::ChunkHeader) != 0U)
+    {
+        return cxx::error<ShmBridgeError>(ShmBridgeError::INVALID_CHUNK);
+    }
+    const auto base = static_cast<const uint8_t*>(peerSegment.value()->m_memoryMap->getBaseAddress());
+    const auto chunkHeader = reinterpret_cast<const mepoo::ChunkHeader*>(base + offset);
+
+    const uint64_t chunkSize = chunkHeader->chunkSize();
+    const uint64_t userPayloadOffset =
+        static_cast<uint64_t>(static_cast<const uint8_t*>(chunkHeader->userPayload()) - base) - offset;
+    if (chunkHeader->chunkHeaderVersion() != mepoo::ChunkHeader::CHUNK_HEADER_VERSION
+        || !isInRange(offset, chunkSize, size) || userPayloadOffset < sizeof(mepoo::ChunkHeader)
+        || chunkHeader->userHeaderSize() > userPayloadOffset - sizeof(mepoo::ChunkHeader)
+        || !isInRange(userPayloadOffset, chunkHeader->userPayloadSize(), chunkSize))
+    {
+        return cxx::error<ShmBridgeError>(ShmBridgeError::INVALID_CHUNK);
+    }
+    // only the chunk is copied, the relative pointers to the parts would refer to the shared memory of the sender
+    if (chunkHeader->isMultiChunk())
+    {
+        return cxx::error<ShmBridgeError>(ShmBridgeError::MULTI_CHUNK_SAMPLE);
+    }
+    return cxx::success<const mepoo::ChunkHeader*>(chunkHeader);
+}
+
+void ShmBridgePeerSegments::clear() noexcept
+{
+    m_segments.clear();
+}
+
+cxx::expected<ShmBridgePeerSegments::PeerSegment*, ShmBridgeError>
+ShmBridgePeerSegments::segment(const ShmBridgeTransferData& transfer, const uint32_t segmentIndex) noexcept
+{
+    if (segmentIndex >= transfer.m_numberOfSegments.load(std::memory_order_acquire))
+    {
+        return cxx::error<ShmBridgeError>(ShmBridgeError::INVALID_CHUNK);
+    }
+    if (segmentIndex >= m_segments.size())
+    {
+        m_segments.resize(segmentIndex + 1U);
+    }
+
+    auto& peerSegment = m_segments[segmentIndex];
+    if (peerSegment.m_memoryMap.has_value())
+    {
+        return cxx::success<PeerSegment*>(&peerSegment);
+    }
+
+    // the name is a file name in the shared memory directory of the sender, it must not point somewhere else
+    const auto& sharedMemoryName = transfer.m_segmentNames[segmentIndex];
+    if (sharedMemoryName.empty() || std::strchr(sharedMemoryName.c_str(), '/') != nullptr)
+    {
+        return cxx::error<ShmBridgeError>(ShmBridgeError::UNABLE_TO_MAP_PEER_SEGMENT);
+    }
+    uint64_t inode{0U};
+    auto memoryMap = mapFile(m_peerShmDirectory + "/" + sharedMemoryName.c_str(),
+                             posix::AccessMode::READ_ONLY,
+                             ShmBridgeError::UNABLE_TO_MAP_PEER_SEGMENT,
+                             peerSegment.m_size,
+                             inode);
+    if (memoryMap.has_error())
+    {
+        return cxx::error<ShmBridgeError>(memoryMap.get_error());
+    }
+    peerSegment.m_memoryMap.emplace(std::move(memoryMap.value()));
+    return cxx::success<PeerSegment*>(&peerSegment);
+}
+
+} // namespace gw
+} // namespace iox
@@ -80,6 +80,16 @@ iox::config::TomlGatewayConfigParser::parse(const roudi::ConfigFilePathString_t&
             iox::capro::ServiceDescription(iox::capro::IdString_t(iox::cxx::TruncateToCapacity, *serviceName),
                                            iox::capro::IdString_t(iox::cxx::TruncateToCapacity, *instance),
                                            iox::capro::IdString_t(iox::cxx::TruncateToCapacity, *event));
+        auto codec = service->get_as<std::string>(GATEWAY_CONFIG_SERVICE_CODEC_NAME);
+        if (codec)
+        {
+            entry.m_codec = toCodecType(*codec).value();
+        }
+        auto codecMaxPayloadSize = service->get_as<int64_t>(GATEWAY_CONFIG_SERVICE_CODEC_MAX_PAYLOAD_SIZE_NAME);
+        if (codecMaxPayloadSize)
+        {
+            entry.m_codecMaxPayloadSize = static_cast<uint32_t>(*codecMaxPayloadSize);
+        }
         config.m_configuredServices.push_back(entry);
     }
 
@@ -121,11 +131,42 @@ iox::config::TomlGatewayConfigParser::validate(const cpptoml::table& parsedToml)
             return iox::cxx::error<TomlGatewayConfigParseError>(
                 TomlGatewayConfigParseError::INVALID_SERVICE_DESCRIPTION);
         }
+
+        // the codec is optional
+        auto codec = service->get_as<std::string>(GATEWAY_CONFIG_SERVICE_CODEC_NAME);
+        if (codec && !toCodecType(*codec).has_value())
+        {
+            return iox::cxx::error<TomlGatewayConfigParseError>(TomlGatewayConfigParseError::INVALID_CODEC);
+        }
+        auto codecMaxPayloadSize = service->get_as<int64_t>(GATEWAY_CONFIG_SERVICE_CODEC_MAX_PAYLOAD_SIZE_NAME);
+        if (codecMaxPayloadSize && !isValidCodecMaxPayloadSize(*codecMaxPayloadSize))
+        {
+            return iox::cxx::error<TomlGatewayConfigParseError>(TomlGatewayConfigParseError::INVALID_CODEC);
+        }
     }
 
     return iox::cxx::success<>();
 }
 
+iox::cxx::optional<iox::gw::CodecType>
+iox::config::TomlGatewayConfigParser::toCodecType(const std::string& s) noexcept
+{
+    constexpr uint8_t NUMBER_OF_CODECS{static_cast<uint8_t>(iox::gw::CodecType::XOR_DELTA_LZ) + 1U};
+    for (uint8_t i = 0U; i < NUMBER_OF_CODECS; ++i)
+    {
+        if (s == iox::gw::CODEC_TYPE_STRINGS[i])
+        {
+            return iox::cxx::make_optional<iox::gw::CodecType>(static_cast<iox::gw::CodecType>(i));
+        }
+    }
+    return iox::cxx::nullopt;
+}
+
+bool iox::config::TomlGatewayConfigParser::isValidCodecMaxPayloadSize(const int64_t size) noexcept
+{
+    return size > 0 && static_cast<uint64_t>(size) <= std::numeric_limits<uint32_t>::max();
+}
+
 bool iox::config::TomlGatewayConfigParser::hasInvalidCharacter(const std::string& s) noexcept
 {
     // See: https://design.ros2.org/articles/topic_and_service_names.html
@@ -24,6 +24,7 @@ namespace iox
 namespace mepoo
 {
 constexpr uint8_t ChunkHeader::CHUNK_HEADER_VERSION;
+constexpr uint8_t ChunkHeader::MULTI_CHUNK_FLAG;
 
 ChunkHeader::ChunkHeader(const uint32_t chunkSize, const ChunkSettings& chunkSettings) noexcept
     : m_chunkSize(chunkSize)
@@ -222,6 +223,16 @@ void ChunkHeader::setSequenceNumber(const uint64_t sequenceNumber) noexcept
     m_sequenceNumber = sequenceNumber;
 }
 
+bool ChunkHeader::isMultiChunk() const noexcept
+{
+    return (m_flags & MULTI_CHUNK_FLAG) != 0U;
+}
+
+void ChunkHeader::setMultiChunk() noexcept
+{
+    m_flags = static_cast<uint8_t>(m_flags | MULTI_CHUNK_FLAG);
+}
+
 uint64_t ChunkHeader::overflowSafeUsedSizeOfChunk() const noexcept
 {
     return static_cast<uint64_t>(m_userPayloadOffset) + static_cast<uint64_t>(m_userPayloadSize);
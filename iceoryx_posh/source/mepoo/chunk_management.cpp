@@ -22,12 +22,18 @@ namespace iox
 {
 namespace mepoo
 {
+constexpr uint64_t ChunkManagement::NO_OWNER;
+
 ChunkManagement::ChunkManagement(const cxx::not_null<base_t*> chunkHeader,
                                  const cxx::not_null<MemPool*> mempool,
-                                 const cxx::not_null<MemPool*> chunkManagementPool) noexcept
+                                 const cxx::not_null<MemPool*> chunkManagementPool,
+                                 MemPoolAccounting* const memPoolAccounting,
+                                 MemPoolQuota* const memPoolQuota) noexcept
     : m_chunkHeader(chunkHeader)
     , m_mempool(mempool)
     , m_chunkManagementPool(chunkManagementPool)
+    , m_memPoolAccounting(memPoolAccounting)
+    , m_memPoolQuota(memPoolQuota)
 {
     static_assert(alignof(ChunkManagement) <= mepoo::MemPool::CHUNK_MEMORY_ALIGNMENT,
                   "The ChunkManagement must not exceed the alignment of the mempool chunks, which are aligned to "
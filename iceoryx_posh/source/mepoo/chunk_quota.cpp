@@ -0,0 +1,264 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/internal/mepoo/chunk_quota.hpp"
+#include "iceoryx_hoofs/cxx/requires.hpp"
+#include "iceoryx_posh/internal/log/posh_logging.hpp"
+
+#include <algorithm>
+
+namespace iox
+{
+namespace mepoo
+{
+constexpr uint64_t MemPoolQuota::RESERVED_CHUNKS_SHIFT;
+constexpr uint64_t MemPoolQuota::USED_CHUNKS_MASK;
+
+void MemPoolQuota::reset(const uint32_t requestedReservation, const uint32_t maxChunks) noexcept
+{
+    m_requestedReservation = requestedReservation;
+    m_maxChunks = maxChunks;
+    m_hasReservation = false;
+    m_reservedAndUsedChunks.store(0U, std::memory_order_relaxed);
+}
+
+uint32_t MemPoolQuota::getReservedChunks() const noexcept
+{
+    return reservedChunks(m_reservedAndUsedChunks.load(std::memory_order_relaxed));
+}
+
+uint32_t MemPoolQuota::getUsedChunks() const noexcept
+{
+    return usedChunks(m_reservedAndUsedChunks.load(std::memory_order_relaxed));
+}
+
+uint64_t MemPoolQuota::pack(const uint32_t reservedChunks, const uint32_t usedChunks) noexcept
+{
+    return (static_cast<uint64_t>(reservedChunks) << RESERVED_CHUNKS_SHIFT) | usedChunks;
+}
+
+uint32_t MemPoolQuota::reservedChunks(const uint64_t state) noexcept
+{
+    return static_cast<uint32_t>(state >> RESERVED_CHUNKS_SHIFT);
+}
+
+uint32_t MemPoolQuota::usedChunks(const uint64_t state) noexcept
+{
+    return static_cast<uint32_t>(state & USED_CHUNKS_MASK);
+}
+
+MemPoolQuota& ChunkQuota::memPoolQuota(const uint32_t memPoolIndex) noexcept
+{
+    cxx::Expects(memPoolIndex < MAX_NUMBER_OF_MEMPOOLS);
+    return m_memPoolQuotas[memPoolIndex];
+}
+
+const MemPoolQuota& ChunkQuota::memPoolQuota(const uint32_t memPoolIndex) const noexcept
+{
+    cxx::Expects(memPoolIndex < MAX_NUMBER_OF_MEMPOOLS);
+    return m_memPoolQuotas[memPoolIndex];
+}
+
+bool ChunkQuota::isDrained() const noexcept
+{
+    for (const auto& memPoolQuota : m_memPoolQuotas)
+    {
+        if (memPoolQuota.getUsedChunks() != 0U)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+MemPoolAccounting::MemPoolAccounting(const uint32_t capacity) noexcept
+    : m_capacity(capacity)
+{
+}
+
+bool MemPoolAccounting::hasReservedChunks() const noexcept
+{
+    return m_reservedChunks.load(std::memory_order_relaxed) != 0U;
+}
+
+cxx::expected<MemPoolAccounting::Error> MemPoolAccounting::acquireChunk(MemPoolQuota* const memPoolQuota,
+                                                                        const uint32_t usedChunks) noexcept
+{
+    if (memPoolQuota == nullptr)
+    {
+        return acquireUnreservedChunk(usedChunks) ? cxx::expected<Error>(cxx::success<>())
+                                                  : reject(Error::NO_UNRESERVED_CHUNKS);
+    }
+
+    if (!memPoolQuota->m_hasReservation)
+    {
+        memPoolQuota->m_hasReservation = true;
+        const auto reservedChunks = reserve(memPoolQuota->m_requestedReservation, usedChunks);
+        if (reservedChunks < memPoolQuota->m_requestedReservation)
+        {
+            LogWarn() << "Only " << reservedChunks << " of " << memPoolQuota->m_requestedReservation
+                      << " requested chunks could be reserved since the other chunks are reserved or in use";
+        }
+        memPoolQuota->m_reservedAndUsedChunks.fetch_add(MemPoolQuota::pack(reservedChunks, 0U),
+                                                        std::memory_order_relaxed);
+    }
+
+    auto state = memPoolQuota->m_reservedAndUsedChunks.load(std::memory_order_relaxed);
+    while (true)
+    {
+        const auto usedChunks = MemPoolQuota::usedChunks(state);
+        if (memPoolQuota->m_maxChunks != 0U && usedChunks >= memPoolQuota->m_maxChunks)
+        {
+            return reject(Error::CHUNK_QUOTA_EXCEEDED);
+        }
+
+        const bool isReservedChunk = usedChunks < MemPoolQuota::reservedChunks(state);
+        if (!isReservedChunk && !acquireUnreservedChunk(usedChunks))
+        {
+            return reject(Error::NO_UNRESERVED_CHUNKS);
+        }
+
+        if (memPoolQuota->m_reservedAndUsedChunks.compare_exchange_weak(
+                state, state + 1U, std::memory_order_relaxed, std::memory_order_relaxed))
+        {
+            if (isReservedChunk)
+            {
+                m_reservedUsedChunks.fetch_add(1U, std::memory_order_relaxed);
+            }
+            return cxx::success<>();
+        }
+
+        // chunks were released concurrently, they might have freed a reserved chunk
+        if (!isReservedChunk)
+        {
+            m_unreservedUsedChunks.fetch_sub(1U, std::memory_order_relaxed);
+        }
+    }
+}
+
+void MemPoolAccounting::releaseChunk(MemPoolQuota* const memPoolQuota) noexcept
+{
+    if (memPoolQuota != nullptr)
+    {
+        const auto previousState = memPoolQuota->m_reservedAndUsedChunks.fetch_sub(1U, std::memory_order_relaxed);
+        if (MemPoolQuota::usedChunks(previousState) <= MemPoolQuota::reservedChunks(previousState))
+        {
+            m_reservedUsedChunks.fetch_sub(1U, std::memory_order_relaxed);
+            return;
+        }
+    }
+    m_unreservedUsedChunks.fetch_sub(1U, std::memory_order_relaxed);
+}
+
+void MemPoolAccounting::returnReservation(MemPoolQuota& memPoolQuota) noexcept
+{
+    auto state = memPoolQuota.m_reservedAndUsedChunks.load(std::memory_order_relaxed);
+    while (true)
+    {
+        const auto reservedChunks = MemPoolQuota::reservedChunks(state);
+        const auto usedChunks = MemPoolQuota::usedChunks(state);
+        const auto usedReservedChunks = std::min(reservedChunks, usedChunks);
+
+        // the chunks are accounted as unreserved before they lose their reservation to never promise too many chunks
+        m_unreservedUsedChunks.fetch_add(usedReservedChunks, std::memory_order_relaxed);
+        if (memPoolQuota.m_reservedAndUsedChunks.compare_exchange_weak(
+                state, MemPoolQuota::pack(0U, usedChunks), std::memory_order_relaxed, std::memory_order_relaxed))
+        {
+            m_reservedChunks.fetch_sub(reservedChunks, std::memory_order_relaxed);
+            m_reservedUsedChunks.fetch_sub(usedReservedChunks, std::memory_order_relaxed);
+            return;
+        }
+        m_unreservedUsedChunks.fetch_sub(usedReservedChunks, std::memory_order_relaxed);
+    }
+}
+
+void MemPoolAccounting::addCapacity(const uint32_t numberOfChunks) noexcept
+{
+    m_capacity.fetch_add(numberOfChunks, std::memory_order_relaxed);
+}
+
+uint32_t MemPoolAccounting::getCapacity() const noexcept
+{
+    return m_capacity.load(std::memory_order_relaxed);
+}
+
+uint32_t MemPoolAccounting::getReservedChunks() const noexcept
+{
+    return m_reservedChunks.load(std::memory_order_relaxed);
+}
+
+uint32_t MemPoolAccounting::getUnreservedUsedChunks() const noexcept
+{
+    return m_unreservedUsedChunks.load(std::memory_order_relaxed);
+}
+
+uint64_t MemPoolAccounting::getNumberOfRejectedRequests() const noexcept
+{
+    return m_rejectedRequests.load(std::memory_order_relaxed);
+}
+
+uint32_t MemPoolAccounting::reserve(const uint32_t numberOfChunks, const uint32_t usedChunks) noexcept
+{
+    auto reservedChunks = m_reservedChunks.load(std::memory_order_relaxed);
+    uint32_t grantedChunks{0U};
+    do
+    {
+        const uint64_t blockedChunks =
+            static_cast<uint64_t>(reservedChunks)
+            + unreservedUsedChunks(m_unreservedUsedChunks.load(std::memory_order_relaxed), usedChunks);
+        const uint64_t capacity = m_capacity.load(std::memory_order_relaxed);
+        const uint64_t availableChunks = (capacity > blockedChunks) ? capacity - blockedChunks : 0U;
+        grantedChunks = static_cast<uint32_t>(std::min<uint64_t>(numberOfChunks, availableChunks));
+    } while (!m_reservedChunks.compare_exchange_weak(
+        reservedChunks, reservedChunks + grantedChunks, std::memory_order_relaxed, std::memory_order_relaxed));
+    return grantedChunks;
+}
+
+bool MemPoolAccounting::acquireUnreservedChunk(const uint32_t usedChunks) noexcept
+{
+    auto accountedChunks = m_unreservedUsedChunks.load(std::memory_order_relaxed);
+    do
+    {
+        const auto capacity = m_capacity.load(std::memory_order_relaxed);
+        const auto reservedChunks = m_reservedChunks.load(std::memory_order_relaxed);
+        if (reservedChunks >= capacity
+            || unreservedUsedChunks(accountedChunks, usedChunks) >= capacity - reservedChunks)
+        {
+            return false;
+        }
+    } while (!m_unreservedUsedChunks.compare_exchange_weak(
+        accountedChunks, accountedChunks + 1U, std::memory_order_relaxed, std::memory_order_relaxed));
+    return true;
+}
+
+uint32_t MemPoolAccounting::unreservedUsedChunks(const uint32_t unreservedUsedChunks,
+                                                 const uint32_t usedChunks) const noexcept
+{
+    // the chunks which were taken without accounting are only contained in the used chunks of the mempool
+    const auto reservedUsedChunks = m_reservedUsedChunks.load(std::memory_order_relaxed);
+    const auto usedChunksWithoutReservation = (usedChunks > reservedUsedChunks) ? usedChunks - reservedUsedChunks : 0U;
+    return std::max(unreservedUsedChunks, usedChunksWithoutReservation);
+}
+
+cxx::expected<MemPoolAccounting::Error> MemPoolAccounting::reject(const Error error) noexcept
+{
+    m_rejectedRequests.fetch_add(1U, std::memory_order_relaxed);
+    return cxx::error<Error>(error);
+}
+
+} // namespace mepoo
+} // namespace iox
@@ -0,0 +1,164 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/internal/mepoo/chunk_size_histogram.hpp"
+#include "iceoryx_hoofs/cxx/requires.hpp"
+
+#include <limits>
+
+namespace iox
+{
+namespace mepoo
+{
+namespace
+{
+/// @brief the requests a thread counted locally for the histograms it recorded into last
+struct LocalRequestCounts
+{
+    static constexpr uint32_t NUMBER_OF_HISTOGRAMS{4U};
+
+    struct Entry
+    {
+        const ChunkSizeHistogram* m_histogram{nullptr};
+        uint64_t m_histogramId{0U};
+        /// @brief wraps from 2 * SAMPLE_INTERVAL to SAMPLE_INTERVAL to stay in the sampled phase
+        uint8_t m_counts[ChunkSizeHistogram::NUMBER_OF_BUCKETS]{};
+    };
+
+    /// @brief returns the counts of a histogram, the entry of another histogram is reset for it when there is none
+    uint8_t* countsOf(const ChunkSizeHistogram* const histogram, const uint64_t histogramId) noexcept
+    {
+        for (auto& entry : m_entries)
+        {
+            if (entry.m_histogram == histogram && entry.m_histogramId == histogramId)
+            {
+                return entry.m_counts;
+            }
+        }
+
+        // the requests which were not added to the histogram of the replaced entry are lost, the histogram might not
+        // exist anymore
+        auto& entry = m_entries[m_nextEntryToReplace];
+        m_nextEntryToReplace = (m_nextEntryToReplace + 1U) % NUMBER_OF_HISTOGRAMS;
+        entry = Entry();
+        entry.m_histogram = histogram;
+        entry.m_histogramId = histogramId;
+        return entry.m_counts;
+    }
+
+    Entry m_entries[NUMBER_OF_HISTOGRAMS];
+    uint32_t m_nextEntryToReplace{0U};
+};
+
+constexpr uint32_t LocalRequestCounts::NUMBER_OF_HISTOGRAMS;
+} // namespace
+
+constexpr uint64_t ChunkSizeHistogram::MIN_BUCKET_UPPER_BOUND;
+constexpr uint64_t ChunkSizeHistogram::MAX_SIZE;
+constexpr uint32_t ChunkSizeHistogram::NUMBER_OF_BUCKETS;
+constexpr uint64_t ChunkSizeHistogram::SAMPLE_INTERVAL;
+constexpr uint32_t ChunkSizeHistogram::SUB_BUCKET_BITS;
+constexpr uint32_t ChunkSizeHistogram::SUB_BUCKETS;
+constexpr uint32_t ChunkSizeHistogram::FIRST_OCTAVE;
+
+static_assert(ChunkSizeHistogram::NUMBER_OF_BUCKETS == 1U + (32U - 3U) * 4U,
+              "there must be a bucket for every quarter of the octaves up to MAX_SIZE");
+static_assert((ChunkSizeHistogram::SAMPLE_INTERVAL & (ChunkSizeHistogram::SAMPLE_INTERVAL - 1U)) == 0U,
+              "the local counts are added at powers of two up to SAMPLE_INTERVAL");
+static_assert(2U * ChunkSizeHistogram::SAMPLE_INTERVAL <= std::numeric_limits<uint8_t>::max(),
+              "the local counts must fit into an uint8_t");
+
+void ChunkSizeHistogram::record(const uint64_t size) noexcept
+{
+    thread_local LocalRequestCounts localRequestCounts;
+    const auto bucket = bucketIndex(size);
+    auto& localCount = localRequestCounts.countsOf(this, m_uniqueId)[bucket];
+    ++localCount;
+
+    // the local count is added at 1, 2, 4, ..., SAMPLE_INTERVAL, i.e. by the requests since the previous addition,
+    // and at every multiple of SAMPLE_INTERVAL beyond
+    uint64_t requestsToAdd{0U};
+    if (localCount <= SAMPLE_INTERVAL)
+    {
+        if ((localCount & (localCount - 1U)) == 0U)
+        {
+            requestsToAdd = (localCount + 1U) / 2U;
+        }
+    }
+    else if (localCount == 2U * SAMPLE_INTERVAL)
+    {
+        localCount = static_cast<uint8_t>(SAMPLE_INTERVAL);
+        requestsToAdd = SAMPLE_INTERVAL;
+    }
+
+    if (requestsToAdd != 0U)
+    {
+        m_counts[bucket].fetch_add(requestsToAdd, std::memory_order_relaxed);
+    }
+}
+
+uint64_t ChunkSizeHistogram::uniqueId() noexcept
+{
+    // 0 is the id of an unused entry of the local counts
+    static std::atomic<uint64_t> nextId{1U};
+    return nextId.fetch_add(1U, std::memory_order_relaxed);
+}
+
+uint64_t ChunkSizeHistogram::count(const uint32_t bucket) const noexcept
+{
+    cxx::Expects(bucket < NUMBER_OF_BUCKETS);
+    return m_counts[bucket].load(std::memory_order_relaxed);
+}
+
+uint32_t ChunkSizeHistogram::bucketIndex(const uint64_t size) noexcept
+{
+    if (size <= MIN_BUCKET_UPPER_BOUND)
+    {
+        return 0U;
+    }
+    if (size >= MAX_SIZE)
+    {
+        return NUMBER_OF_BUCKETS - 1U;
+    }
+
+    // the buckets are (lower, upper], working with size - 1 maps the upper bound into the bucket
+    const uint64_t value = size - 1U;
+    uint32_t octave = FIRST_OCTAVE;
+    while ((value >> (octave + 1U)) != 0U)
+    {
+        ++octave;
+    }
+    const uint32_t shift = octave - SUB_BUCKET_BITS;
+    const auto subBucket = static_cast<uint32_t>((value >> shift) & (SUB_BUCKETS - 1U));
+    return 1U + (octave - FIRST_OCTAVE) * SUB_BUCKETS + subBucket;
+}
+
+uint64_t ChunkSizeHistogram::bucketUpperBound(const uint32_t bucket) noexcept
+{
+    cxx::Expects(bucket < NUMBER_OF_BUCKETS);
+    if (bucket == 0U)
+    {
+        return MIN_BUCKET_UPPER_BOUND;
+    }
+
+    const uint32_t octave = FIRST_OCTAVE + (bucket - 1U) / SUB_BUCKETS;
+    const uint32_t subBucket = (bucket - 1U) % SUB_BUCKETS;
+    return static_cast<uint64_t>(SUB_BUCKETS + subBucket + 1U) << (octave - SUB_BUCKET_BITS);
+}
+
+} // namespace mepoo
+} // namespace iox
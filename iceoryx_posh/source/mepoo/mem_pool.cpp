@@ -30,11 +30,13 @@ namespace mepoo
 MemPoolInfo::MemPoolInfo(const uint32_t usedChunks,
                          const uint32_t minFreeChunks,
                          const uint32_t numChunks,
-                         const uint32_t chunkSize) noexcept
+                         const uint32_t chunkSize,
+                         const uint64_t allocationFailures) noexcept
     : m_usedChunks(usedChunks)
     , m_minFreeChunks(minFreeChunks)
     , m_numChunks(numChunks)
     , m_chunkSize(chunkSize)
+    , m_allocationFailures(allocationFailures)
 {
 }
 
@@ -77,11 +79,21 @@ void MemPool::adjustMinFree() noexcept
 
 void* MemPool::getChunk() noexcept
 {
-    uint32_t l_index{0U};
-    if (!m_freeIndices.pop(l_index))
+    auto chunk = tryGetChunk();
+    if (chunk == nullptr)
     {
         std::cerr << "Mempool [m_chunkSize = " << m_chunkSize << ", numberOfChunks = " << m_numberOfChunks
                   << ", used_chunks = " << m_usedChunks << " ] has no more space left" << std::endl;
+    }
+    return chunk;
+}
+
+void* MemPool::tryGetChunk() noexcept
+{
+    uint32_t l_index{0U};
+    if (!m_freeIndices.pop(l_index))
+    {
+        m_allocationFailures.fetch_add(1U, std::memory_order_relaxed);
         return nullptr;
     }
 
@@ -131,12 +143,28 @@ uint32_t MemPool::getMinFree() const noexcept
     return m_minFree.load(std::memory_order_relaxed);
 }
 
+uint64_t MemPool::getAllocationFailures() const noexcept
+{
+    return m_allocationFailures.load(std::memory_order_relaxed);
+}
+
+void* MemPool::getChunkMemory() const noexcept
+{
+    return m_rawMemory.get();
+}
+
+uint64_t MemPool::getChunkMemorySize() const noexcept
+{
+    return static_cast<uint64_t>(m_chunkSize) * m_numberOfChunks;
+}
+
 MemPoolInfo MemPool::getInfo() const noexcept
 {
     return {m_usedChunks.load(std::memory_order_relaxed),
             m_minFree.load(std::memory_order_relaxed),
             m_numberOfChunks,
-            m_chunkSize};
+            m_chunkSize,
+            m_allocationFailures.load(std::memory_order_relaxed)};
 }
 
 } // namespace mepoo
@@ -24,9 +24,11 @@
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iceoryx_posh/mepoo/numa_placement.hpp"
 
 #include <algorithm>
 #include <cstdint>
+#include <cstring>
 
 namespace iox
 {
@@ -42,10 +44,34 @@ void MemoryManager::printMemPoolVector(log::LogStream& log) const noexcept
     }
 }
 
+bool MemoryManager::isValidNumaNodeForMemPool(const uint32_t chunkSize, const uint32_t numaNode) const noexcept
+{
+    if (m_memPoolVector.empty() || chunkSize > m_memPoolVector.back().getChunkSize())
+    {
+        return true;
+    }
+    if (chunkSize < m_memPoolVector.back().getChunkSize() || numaNode == NO_NUMA_NODE)
+    {
+        return false;
+    }
+
+    // a mempool with the same chunk size as the previous one must be on another NUMA node than all of them
+    for (uint32_t i = 0U; i < m_memPoolVector.size(); ++i)
+    {
+        if (m_memPoolVector[i].getChunkSize() == chunkSize
+            && (m_memPoolNumaNodes[i] == numaNode || m_memPoolNumaNodes[i] == NO_NUMA_NODE))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 void MemoryManager::addMemPool(posix::Allocator& managementAllocator,
                                posix::Allocator& chunkMemoryAllocator,
                                const cxx::greater_or_equal<uint32_t, MemPool::CHUNK_MEMORY_ALIGNMENT> chunkPayloadSize,
-                               const cxx::greater_or_equal<uint32_t, 1> numberOfChunks) noexcept
+                               const cxx::greater_or_equal<uint32_t, 1> numberOfChunks,
+                               const uint32_t numaNode) noexcept
 {
     uint32_t adjustedChunkSize = sizeWithChunkHeaderStruct(static_cast<uint32_t>(chunkPayloadSize));
     if (m_denyAddMemPool)
@@ -53,7 +79,7 @@ void MemoryManager::addMemPool(posix::Allocator& managementAllocator,
         LogFatal() << "After the generation of the chunk management pool you are not allowed to create new mempools.";
         errorHandler(iox::PoshError::MEPOO__MEMPOOL_ADDMEMPOOL_AFTER_GENERATECHUNKMANAGEMENTPOOL);
     }
-    else if (m_memPoolVector.size() > 0 && adjustedChunkSize <= m_memPoolVector.back().getChunkSize())
+    else if (!isValidNumaNodeForMemPool(adjustedChunkSize, numaNode))
     {
         auto log = LogFatal();
         log << "The following mempools were already added to the mempool handler:";
@@ -61,13 +87,26 @@ void MemoryManager::addMemPool(posix::Allocator& managementAllocator,
         log << "These mempools must be added in an increasing chunk size ordering. The newly added  MemPool [ "
                "ChunkSize = "
             << adjustedChunkSize << ", ChunkPayloadSize = " << static_cast<uint32_t>(chunkPayloadSize)
-            << ", ChunkCount = " << static_cast<uint32_t>(numberOfChunks) << "] breaks that requirement!";
+            << ", ChunkCount = " << static_cast<uint32_t>(numberOfChunks)
+            << "] breaks that requirement! Only mempools on different NUMA nodes can have the same chunk size.";
         log.Flush();
         errorHandler(iox::PoshError::MEPOO__MEMPOOL_CONFIG_MUST_BE_ORDERED_BY_INCREASING_SIZE);
     }
 
+    if (!m_memPoolVector.empty() && adjustedChunkSize == m_memPoolVector.back().getChunkSize())
+    {
+        m_hasMemPoolsOnMultipleNumaNodes = true;
+    }
+
     m_memPoolVector.emplace_back(adjustedChunkSize, numberOfChunks, managementAllocator, chunkMemoryAllocator);
+    m_memPoolNumaNodes.emplace_back(numaNode);
     m_totalNumberOfChunks += numberOfChunks;
+
+    if (numaNode != NO_NUMA_NODE)
+    {
+        auto& memPool = m_memPoolVector.back();
+        applyNumaPlacement(memPool.getChunkMemory(), memPool.getChunkMemorySize(), NumaPlacement::onNode(numaNode));
+    }
 }
 
 void MemoryManager::generateChunkManagementPool(posix::Allocator& managementAllocator) noexcept
@@ -75,6 +114,13 @@ void MemoryManager::generateChunkManagementPool(posix::Allocator& managementAllo
     m_denyAddMemPool = true;
     uint32_t chunkSize = sizeof(ChunkManagement);
     m_chunkManagementPool.emplace_back(chunkSize, m_totalNumberOfChunks, managementAllocator, managementAllocator);
+    clearChunkManagements(m_chunkManagementPool.back());
+}
+
+void MemoryManager::clearChunkManagements(MemPool& chunkManagementPool) noexcept
+{
+    // the sweep for lost chunks also reads the chunk managements which were never used
+    std::memset(chunkManagementPool.getChunkMemory(), 0, chunkManagementPool.getChunkMemorySize());
 }
 
 uint32_t MemoryManager::getNumberOfMemPools() const noexcept
@@ -86,11 +132,359 @@ MemPoolInfo MemoryManager::getMemPoolInfo(const uint32_t index) const noexcept
 {
     if (index >= m_memPoolVector.size())
     {
-        return {0, 0, 0, 0};
+        return {0, 0, 0, 0, 0};
     }
     return m_memPoolVector[index].getInfo();
 }
 
+uint32_t MemoryManager::getMemPoolNumaNode(const uint32_t index) const noexcept
+{
+    if (index >= m_memPoolNumaNodes.size())
+    {
+        return NO_NUMA_NODE;
+    }
+    return m_memPoolNumaNodes[index];
+}
+
+void MemoryManager::sampleMemPoolNumaDistribution(const uint32_t index,
+                                                  uint32_t (&pagesPerNode)[MAX_NUMBER_OF_NUMA_NODES]) const noexcept
+{
+    for (auto& pages : pagesPerNode)
+    {
+        pages = 0U;
+    }
+    if (index >= m_memPoolVector.size())
+    {
+        return;
+    }
+
+    auto addSamples = [&](const MemPool& memPool) {
+        uint32_t samples[MAX_NUMBER_OF_NUMA_NODES];
+        sampleNumaDistribution(memPool.getChunkMemory(), memPool.getChunkMemorySize(), samples);
+        for (uint32_t node = 0U; node < MAX_NUMBER_OF_NUMA_NODES; ++node)
+        {
+            pagesPerNode[node] += samples[node];
+        }
+    };
+
+    addSamples(m_memPoolVector[index]);
+    const auto numberOfExtents = getNumberOfMemPoolExtents();
+    for (uint32_t i = 0U; i < numberOfExtents; ++i)
+    {
+        const auto& extent = m_memPoolExtents.data()[i];
+        if (extent.m_memPoolIndex == index)
+        {
+            addSamples(extent.m_memPool);
+        }
+    }
+}
+
+MemoryManager::MemPoolExtent::MemPoolExtent(const uint32_t memPoolIndex,
+                                            const uint32_t chunkSize,
+                                            const uint32_t numberOfChunks,
+                                            posix::Allocator& managementAllocator,
+                                            posix::Allocator& chunkMemoryAllocator) noexcept
+    : m_memPoolIndex(memPoolIndex)
+    , m_memPool(chunkSize, numberOfChunks, managementAllocator, chunkMemoryAllocator)
+    , m_chunkManagementPool(
+          static_cast<uint32_t>(sizeof(ChunkManagement)), numberOfChunks, managementAllocator, managementAllocator)
+{
+    clearChunkManagements(m_chunkManagementPool);
+}
+
+void MemoryManager::addMemPoolExtent(const uint32_t memPoolIndex,
+                                     posix::Allocator& managementAllocator,
+                                     posix::Allocator& chunkMemoryAllocator) noexcept
+{
+    cxx::Expects(memPoolIndex < m_memPoolVector.size());
+    cxx::Expects(m_extentChunkCounts[memPoolIndex] > 0U);
+    cxx::Expects(m_memPoolExtents.size() < m_memPoolExtents.capacity());
+
+    m_memPoolExtents.emplace_back(memPoolIndex,
+                                  m_memPoolVector[memPoolIndex].getChunkSize(),
+                                  m_extentChunkCounts[memPoolIndex],
+                                  managementAllocator,
+                                  chunkMemoryAllocator);
+    if (m_memPoolNumaNodes[memPoolIndex] != NO_NUMA_NODE)
+    {
+        auto& memPool = m_memPoolExtents.back().m_memPool;
+        applyNumaPlacement(memPool.getChunkMemory(),
+                           memPool.getChunkMemorySize(),
+                           NumaPlacement::onNode(m_memPoolNumaNodes[memPoolIndex]));
+    }
+    m_numberOfMemPoolExtents.store(static_cast<uint32_t>(m_memPoolExtents.size()), std::memory_order_release);
+    m_memPoolAccountings[memPoolIndex].addCapacity(m_extentChunkCounts[memPoolIndex]);
+}
+
+uint32_t MemoryManager::getNumberOfMemPoolExtents() const noexcept
+{
+    return m_numberOfMemPoolExtents.load(std::memory_order_acquire);
+}
+
+MemPoolInfo MemoryManager::getMemPoolExtentInfo(const uint32_t index) const noexcept
+{
+    if (index >= getNumberOfMemPoolExtents())
+    {
+        return {0, 0, 0, 0, 0};
+    }
+    return m_memPoolExtents.data()[index].m_memPool.getInfo();
+}
+
+uint32_t MemoryManager::getExtentChunkCount(const uint32_t memPoolIndex) const noexcept
+{
+    if (memPoolIndex >= m_extentChunkCounts.size())
+    {
+        return 0U;
+    }
+    return m_extentChunkCounts[memPoolIndex];
+}
+
+uint32_t MemoryManager::getNumberOfFreeChunks(const uint32_t memPoolIndex) const noexcept
+{
+    if (memPoolIndex >= m_memPoolVector.size())
+    {
+        return 0U;
+    }
+
+    const auto& memPool = m_memPoolVector[memPoolIndex];
+    uint32_t freeChunks = memPool.getChunkCount() - memPool.getUsedChunks();
+
+    const auto numberOfExtents = getNumberOfMemPoolExtents();
+    for (uint32_t i = 0U; i < numberOfExtents; ++i)
+    {
+        const auto& extent = m_memPoolExtents.data()[i];
+        if (extent.m_memPoolIndex == memPoolIndex)
+        {
+            freeChunks += extent.m_memPool.getChunkCount() - extent.m_memPool.getUsedChunks();
+        }
+    }
+    return freeChunks;
+}
+
+uint32_t MemoryManager::getNumberOfUsedChunks(const uint32_t memPoolIndex) const noexcept
+{
+    uint32_t usedChunks = m_memPoolVector[memPoolIndex].getUsedChunks();
+
+    const auto numberOfExtents = getNumberOfMemPoolExtents();
+    for (uint32_t i = 0U; i < numberOfExtents; ++i)
+    {
+        const auto& extent = m_memPoolExtents.data()[i];
+        if (extent.m_memPoolIndex == memPoolIndex)
+        {
+            usedChunks += extent.m_memPool.getUsedChunks();
+        }
+    }
+    return usedChunks;
+}
+
+void* MemoryManager::getChunkFromMemPoolExtents(const uint32_t memPoolIndex,
+                                                MemPool*& memPool,
+                                                MemPool*& chunkManagementPool) noexcept
+{
+    const auto numberOfExtents = getNumberOfMemPoolExtents();
+    for (uint32_t i = 0U; i < numberOfExtents; ++i)
+    {
+        auto& extent = m_memPoolExtents.data()[i];
+        if (extent.m_memPoolIndex != memPoolIndex)
+        {
+            continue;
+        }
+
+        auto chunk = extent.m_memPool.tryGetChunk();
+        if (chunk != nullptr)
+        {
+            memPool = &extent.m_memPool;
+            chunkManagementPool = &extent.m_chunkManagementPool;
+            return chunk;
+        }
+    }
+    return nullptr;
+}
+
+ChunkQuota* MemoryManager::acquireChunkQuota(const uint32_t reservedChunksPerMemPool,
+                                             const uint32_t maxChunksPerMemPool) noexcept
+{
+    for (auto& chunkQuota : m_chunkQuotas)
+    {
+        auto state = ChunkQuota::State::RELEASED;
+        if (chunkQuota.isDrained())
+        {
+            chunkQuota.m_state.compare_exchange_strong(state, ChunkQuota::State::FREE, std::memory_order_relaxed);
+        }
+
+        state = ChunkQuota::State::FREE;
+        if (chunkQuota.m_state.compare_exchange_strong(state, ChunkQuota::State::IN_USE, std::memory_order_acquire))
+        {
+            for (uint32_t i = 0U; i < MAX_NUMBER_OF_MEMPOOLS; ++i)
+            {
+                chunkQuota.memPoolQuota(i).reset(reservedChunksPerMemPool, maxChunksPerMemPool);
+            }
+            return &chunkQuota;
+        }
+    }
+
+    LogWarn() << "All " << MAX_NUMBER_OF_CHUNK_QUOTAS << " chunk quotas are in use!";
+    return nullptr;
+}
+
+void MemoryManager::releaseChunkQuota(ChunkQuota* const chunkQuota) noexcept
+{
+    if (chunkQuota == nullptr)
+    {
+        return;
+    }
+
+    for (uint32_t i = 0U; i < m_memPoolAccountings.size(); ++i)
+    {
+        m_memPoolAccountings[i].returnReservation(chunkQuota->memPoolQuota(i));
+    }
+    chunkQuota->m_state.store(ChunkQuota::State::RELEASED, std::memory_order_release);
+}
+
+uint32_t MemoryManager::getNumberOfReservedChunks(const uint32_t memPoolIndex) const noexcept
+{
+    if (memPoolIndex >= m_memPoolAccountings.size())
+    {
+        return 0U;
+    }
+    return m_memPoolAccountings[memPoolIndex].getReservedChunks();
+}
+
+uint64_t MemoryManager::getNumberOfRejectedChunkRequests(const uint32_t memPoolIndex) const noexcept
+{
+    if (memPoolIndex >= m_memPoolAccountings.size())
+    {
+        return 0U;
+    }
+    return m_memPoolAccountings[memPoolIndex].getNumberOfRejectedRequests();
+}
+
+const ChunkSizeHistogram& MemoryManager::getRequestedChunkPayloadSizes() const noexcept
+{
+    return m_requestedChunkPayloadSizes;
+}
+
+void MemoryManager::recordChunkRequest(const ChunkSettings& chunkSettings) noexcept
+{
+    // the chunk-payload size is recorded since this is the size a mempool is configured with
+    m_requestedChunkPayloadSizes.record(chunkSettings.requiredChunkSize() - sizeof(ChunkHeader));
+}
+
+uint64_t MemoryManager::getNumberOfTooLargeRequests() const noexcept
+{
+    return m_numberOfTooLargeRequests.load(std::memory_order_relaxed);
+}
+
+uint64_t MemoryManager::getNumberOfChunkManagements() const noexcept
+{
+    uint64_t numberOfChunkManagements{0U};
+    if (!m_chunkManagementPool.empty())
+    {
+        numberOfChunkManagements = m_chunkManagementPool.front().getChunkCount();
+    }
+    const auto numberOfExtents = getNumberOfMemPoolExtents();
+    for (uint32_t i = 0U; i < numberOfExtents; ++i)
+    {
+        numberOfChunkManagements += m_memPoolExtents.data()[i].m_chunkManagementPool.getChunkCount();
+    }
+    return numberOfChunkManagements;
+}
+
+uint32_t MemoryManager::releaseChunksOfLostOwners(const uint64_t firstChunkManagement,
+                                                  const uint64_t numberOfChunkManagements,
+                                                  const cxx::function_ref<bool(const uint64_t)> isLostOwner) noexcept
+{
+    const uint64_t endOfChunkManagements = firstChunkManagement + numberOfChunkManagements;
+    uint32_t releasedChunks{0U};
+    uint64_t beginOfPool{0U};
+
+    auto releaseChunksInPool = [&](MemPool& chunkManagementPool) {
+        const uint64_t endOfPool = beginOfPool + chunkManagementPool.getChunkCount();
+        const uint64_t begin = algorithm::max(firstChunkManagement, beginOfPool);
+        const uint64_t end = algorithm::min(endOfChunkManagements, endOfPool);
+        auto chunkManagements = static_cast<uint8_t*>(chunkManagementPool.getChunkMemory());
+        for (uint64_t i = begin; i < end; ++i)
+        {
+            auto chunkManagement = reinterpret_cast<ChunkManagement*>(
+                chunkManagements + (i - beginOfPool) * chunkManagementPool.getChunkSize());
+            if (releaseChunkOfLostOwner(*chunkManagement, isLostOwner))
+            {
+                ++releasedChunks;
+            }
+        }
+        beginOfPool = endOfPool;
+    };
+
+    if (!m_chunkManagementPool.empty())
+    {
+        releaseChunksInPool(m_chunkManagementPool.front());
+    }
+    const auto numberOfExtents = getNumberOfMemPoolExtents();
+    for (uint32_t i = 0U; i < numberOfExtents && beginOfPool < endOfChunkManagements; ++i)
+    {
+        releaseChunksInPool(m_memPoolExtents.data()[i].m_chunkManagementPool);
+    }
+
+    return releasedChunks;
+}
+
+bool MemoryManager::releaseChunkOfLostOwner(ChunkManagement& chunkManagement,
+                                            const cxx::function_ref<bool(const uint64_t)> isLostOwner) noexcept
+{
+    auto owner = chunkManagement.m_owner.load(std::memory_order_acquire);
+    if (owner == ChunkManagement::NO_OWNER || !isLostOwner(owner))
+    {
+        return false;
+    }
+
+    // the owner of a chunk management is reset before its last reference is released, therefore the lost owner still
+    // holds a reference; it is the only one who would change the owner
+    if (!chunkManagement.m_owner.compare_exchange_strong(owner, ChunkManagement::NO_OWNER, std::memory_order_acq_rel))
+    {
+        return false;
+    }
+
+    const auto memPoolIndex = getMemPoolIndex(chunkManagement.m_mempool.get());
+    if (memPoolIndex < MAX_NUMBER_OF_MEMPOOLS)
+    {
+        m_numberOfReclaimedChunks[memPoolIndex].fetch_add(1U, std::memory_order_relaxed);
+    }
+
+    // takes over the reference of the lost owner and releases it
+    SharedChunk lostChunk(&chunkManagement);
+    return true;
+}
+
+uint32_t MemoryManager::getMemPoolIndex(const MemPool* const memPool) const noexcept
+{
+    for (uint32_t i = 0U; i < m_memPoolVector.size(); ++i)
+    {
+        if (&m_memPoolVector[i] == memPool)
+        {
+            return i;
+        }
+    }
+    const auto numberOfExtents = getNumberOfMemPoolExtents();
+    for (uint32_t i = 0U; i < numberOfExtents; ++i)
+    {
+        const auto& extent = m_memPoolExtents.data()[i];
+        if (&extent.m_memPool == memPool)
+        {
+            return extent.m_memPoolIndex;
+        }
+    }
+    return MAX_NUMBER_OF_MEMPOOLS;
+}
+
+uint64_t MemoryManager::getNumberOfReclaimedChunks(const uint32_t memPoolIndex) const noexcept
+{
+    if (memPoolIndex >= m_memPoolVector.size())
+    {
+        return 0U;
+    }
+    return m_numberOfReclaimedChunks[memPoolIndex].load(std::memory_order_relaxed);
+}
+
 uint32_t MemoryManager::sizeWithChunkHeaderStruct(const MaxChunkPayloadSize_t size) noexcept
 {
     return size + static_cast<uint32_t>(sizeof(ChunkHeader));
@@ -135,38 +529,100 @@ uint64_t MemoryManager::requiredFullMemorySize(const MePooConfig& mePooConfig) n
     return requiredManagementMemorySize(mePooConfig) + requiredChunkMemorySize(mePooConfig);
 }
 
+uint64_t MemoryManager::requiredExtentChunkMemorySize(const uint32_t chunkSize, const uint32_t numberOfChunks) noexcept
+{
+    return cxx::align(static_cast<uint64_t>(numberOfChunks) * chunkSize, MemPool::CHUNK_MEMORY_ALIGNMENT);
+}
+
+uint64_t MemoryManager::requiredExtentManagementMemorySize(const uint32_t numberOfChunks) noexcept
+{
+    // one free list for the chunks and one for the chunk management
+    const uint64_t freeListSize =
+        cxx::align(MemPool::freeList_t::requiredIndexMemorySize(numberOfChunks), MemPool::CHUNK_MEMORY_ALIGNMENT);
+    return 2U * freeListSize
+           + cxx::align(static_cast<uint64_t>(numberOfChunks) * sizeof(ChunkManagement),
+                        MemPool::CHUNK_MEMORY_ALIGNMENT);
+}
+
 void MemoryManager::configureMemoryManager(const MePooConfig& mePooConfig,
                                            posix::Allocator& managementAllocator,
                                            posix::Allocator& chunkMemoryAllocator) noexcept
 {
     for (auto entry : mePooConfig.m_mempoolConfig)
     {
-        addMemPool(managementAllocator, chunkMemoryAllocator, entry.m_size, entry.m_chunkCount);
+        addMemPool(managementAllocator, chunkMemoryAllocator, entry.m_size, entry.m_chunkCount, entry.m_numaNode);
+        m_extentChunkCounts.emplace_back(entry.m_extentChunkCount);
+        m_memPoolAccountings.emplace_back(entry.m_chunkCount);
     }
 
     generateChunkManagementPool(managementAllocator);
 }
 
-cxx::expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const ChunkSettings& chunkSettings) noexcept
+uint32_t MemoryManager::findMemPoolOnCurrentNumaNode(const uint32_t firstMemPool,
+                                                    const uint32_t endOfMemPools) const noexcept
 {
-    void* chunk{nullptr};
-    MemPool* memPoolPointer{nullptr};
-    const auto requiredChunkSize = chunkSettings.requiredChunkSize();
+    const auto currentNumaNode = getCurrentNumaNode();
+    for (uint32_t i = firstMemPool; i < endOfMemPools; ++i)
+    {
+        if (m_memPoolNumaNodes[i] == currentNumaNode)
+        {
+            return i;
+        }
+    }
+    return firstMemPool;
+}
 
-    uint32_t aquiredChunkSize = 0U;
+cxx::expected<SharedChunk, MemoryManager::Error>
+MemoryManager::getChunkFromMemPool(const uint32_t memPoolIndex,
+                                   const ChunkSettings& chunkSettings,
+                                   ChunkQuota* const chunkQuota) noexcept
+{
+    auto& memPoolAccounting = m_memPoolAccountings[memPoolIndex];
+    auto memPoolQuota = (chunkQuota != nullptr) ? &chunkQuota->memPoolQuota(memPoolIndex) : nullptr;
+
+    // a request without a quota only competes with reservations, without them the mempool itself is the limit
+    const bool isAccounted = (memPoolQuota != nullptr) || memPoolAccounting.hasReservedChunks();
+    if (isAccounted)
+    {
+        auto accountingResult = memPoolAccounting.acquireChunk(memPoolQuota, getNumberOfUsedChunks(memPoolIndex));
+        if (accountingResult.has_error())
+        {
+            return cxx::error<Error>((accountingResult.get_error() == MemPoolAccounting::Error::CHUNK_QUOTA_EXCEEDED)
+                                         ? Error::CHUNK_QUOTA_EXCEEDED
+                                         : Error::MEMPOOL_OUT_OF_CHUNKS);
+        }
+    }
 
-    for (auto& memPool : m_memPoolVector)
+    MemPool* memPool = &m_memPoolVector[memPoolIndex];
+    MemPool* chunkManagementPool = &m_chunkManagementPool.front();
+    const auto chunkSize = memPool->getChunkSize();
+    void* chunk = memPool->tryGetChunk();
+    if (chunk == nullptr)
+    {
+        chunk = getChunkFromMemPoolExtents(memPoolIndex, memPool, chunkManagementPool);
+    }
+    if (chunk == nullptr)
     {
-        uint32_t chunkSizeOfMemPool = memPool.getChunkSize();
-        if (chunkSizeOfMemPool >= requiredChunkSize)
+        if (isAccounted)
         {
-            chunk = memPool.getChunk();
-            memPoolPointer = &memPool;
-            aquiredChunkSize = chunkSizeOfMemPool;
-            break;
+            memPoolAccounting.releaseChunk(memPoolQuota);
         }
+        return cxx::error<Error>(Error::MEMPOOL_OUT_OF_CHUNKS);
     }
 
+    auto chunkHeader = new (chunk) ChunkHeader(chunkSize, chunkSettings);
+    auto chunkManagement = new (chunkManagementPool->getChunk()) ChunkManagement(
+        chunkHeader, memPool, chunkManagementPool, isAccounted ? &memPoolAccounting : nullptr, memPoolQuota);
+    return cxx::success<SharedChunk>(SharedChunk(chunkManagement));
+}
+
+cxx::expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const ChunkSettings& chunkSettings,
+                                                                        ChunkQuota* const chunkQuota) noexcept
+{
+    const auto requiredChunkSize = chunkSettings.requiredChunkSize();
+
+    recordChunkRequest(chunkSettings);
+
     if (m_memPoolVector.size() == 0)
     {
         LogFatal() << "There are no mempools available!";
@@ -174,8 +630,18 @@ cxx::expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const C
         errorHandler(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_CHUNK_WITHOUT_MEMPOOL, ErrorLevel::SEVERE);
         return cxx::error<Error>(Error::NO_MEMPOOLS_AVAILABLE);
     }
-    else if (memPoolPointer == nullptr)
+
+    const auto numberOfMemPools = static_cast<uint32_t>(m_memPoolVector.size());
+    uint32_t firstMemPool = 0U;
+    while (firstMemPool < numberOfMemPools && m_memPoolVector[firstMemPool].getChunkSize() < requiredChunkSize)
+    {
+        ++firstMemPool;
+    }
+
+    if (firstMemPool == numberOfMemPools)
     {
+        m_numberOfTooLargeRequests.fetch_add(1U, std::memory_order_relaxed);
+
         auto log = LogFatal();
         log << "The following mempools are available:";
         printMemPoolVector(log);
@@ -185,25 +651,54 @@ cxx::expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const C
         errorHandler(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_CHUNK_IS_TOO_LARGE, ErrorLevel::SEVERE);
         return cxx::error<Error>(Error::NO_MEMPOOL_FOR_REQUESTED_CHUNK_SIZE);
     }
-    else if (chunk == nullptr)
+
+    // mempools with the same chunk size are located on different NUMA nodes
+    uint32_t endOfMemPools = firstMemPool + 1U;
+    uint32_t preferredMemPool = firstMemPool;
+    if (m_hasMemPoolsOnMultipleNumaNodes)
     {
-        auto log = LogError();
-        log << "MemoryManager: unable to acquire a chunk with a chunk-payload size of "
-            << chunkSettings.userPayloadSize();
-        log << "The following mempools are available:";
-        printMemPoolVector(log);
-        log.Flush();
+        const auto chunkSize = m_memPoolVector[firstMemPool].getChunkSize();
+        while (endOfMemPools < numberOfMemPools && m_memPoolVector[endOfMemPools].getChunkSize() == chunkSize)
+        {
+            ++endOfMemPools;
+        }
+        if (endOfMemPools - firstMemPool > 1U)
+        {
+            preferredMemPool = findMemPoolOnCurrentNumaNode(firstMemPool, endOfMemPools);
+        }
+    }
 
-        errorHandler(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS, ErrorLevel::MODERATE);
-        return cxx::error<Error>(Error::MEMPOOL_OUT_OF_CHUNKS);
+    bool isChunkQuotaExceeded{false};
+    for (uint32_t n = 0U; n < endOfMemPools - firstMemPool; ++n)
+    {
+        // the preferred mempool is tried first, then the others with the same chunk size in their order
+        uint32_t memPoolIndex = (n == 0U) ? preferredMemPool : firstMemPool + n - 1U;
+        if (n > 0U && memPoolIndex >= preferredMemPool)
+        {
+            ++memPoolIndex;
+        }
+
+        auto chunk = getChunkFromMemPool(memPoolIndex, chunkSettings, chunkQuota);
+        if (!chunk.has_error())
+        {
+            return chunk;
+        }
+        isChunkQuotaExceeded = isChunkQuotaExceeded || (chunk.get_error() == Error::CHUNK_QUOTA_EXCEEDED);
     }
-    else
+
+    if (isChunkQuotaExceeded)
     {
-        auto chunkHeader = new (chunk) ChunkHeader(aquiredChunkSize, chunkSettings);
-        auto chunkManagement = new (m_chunkManagementPool.front().getChunk())
-            ChunkManagement(chunkHeader, memPoolPointer, &m_chunkManagementPool.front());
-        return cxx::success<SharedChunk>(SharedChunk(chunkManagement));
+        return cxx::error<Error>(Error::CHUNK_QUOTA_EXCEEDED);
     }
+
+    auto log = LogError();
+    log << "MemoryManager: unable to acquire a chunk with a chunk-payload size of " << chunkSettings.userPayloadSize();
+    log << "The following mempools are available:";
+    printMemPoolVector(log);
+    log.Flush();
+
+    errorHandler(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS, ErrorLevel::MODERATE);
+    return cxx::error<Error>(Error::MEMPOOL_OUT_OF_CHUNKS);
 }
 
 std::ostream& operator<<(std::ostream& stream, const MemoryManager::Error value) noexcept
@@ -61,13 +61,16 @@ MePooConfig& MePooConfig::optimize() noexcept
     auto config = m_mempoolConfig;
     m_mempoolConfig.clear();
 
-    std::sort(config.begin(), config.end(), [](const Entry& lhs, const Entry& rhs) { return lhs.m_size < rhs.m_size; });
+    // mempools with the same size on different NUMA nodes are kept separate
+    std::sort(config.begin(), config.end(), [](const Entry& lhs, const Entry& rhs) {
+        return (lhs.m_size < rhs.m_size) || (lhs.m_size == rhs.m_size && lhs.m_numaNode < rhs.m_numaNode);
+    });
 
     MePooConfig::Entry newEntry{0u, 0u};
 
     for (const auto& entry : config)
     {
-        if (entry.m_size != newEntry.m_size)
+        if (entry.m_size != newEntry.m_size || entry.m_numaNode != newEntry.m_numaNode)
         {
             if (newEntry.m_size != 0u)
             {
@@ -75,10 +78,13 @@ MePooConfig& MePooConfig::optimize() noexcept
             }
             newEntry.m_size = entry.m_size;
             newEntry.m_chunkCount = entry.m_chunkCount;
+            newEntry.m_extentChunkCount = entry.m_extentChunkCount;
+            newEntry.m_numaNode = entry.m_numaNode;
         }
         else
         {
             newEntry.m_chunkCount += entry.m_chunkCount;
+            newEntry.m_extentChunkCount = std::max(newEntry.m_extentChunkCount, entry.m_extentChunkCount);
         }
     }
 
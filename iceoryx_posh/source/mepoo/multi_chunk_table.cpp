@@ -0,0 +1,94 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/mepoo/multi_chunk_table.hpp"
+#include "iceoryx_hoofs/cxx/algorithm.hpp"
+#include "iceoryx_hoofs/cxx/requires.hpp"
+#include "iceoryx_hoofs/internal/relocatable_pointer/relative_pointer.hpp"
+
+#include <cstring>
+
+namespace iox
+{
+namespace mepoo
+{
+constexpr uint32_t MultiChunkTable::MAX_NUMBER_OF_PARTS;
+
+uint32_t MultiChunkTable::numberOfParts() const noexcept
+{
+    return m_numberOfParts;
+}
+
+uint64_t MultiChunkTable::totalSize() const noexcept
+{
+    return m_totalSize;
+}
+
+void* MultiChunkTable::part(const uint32_t index) noexcept
+{
+    return const_cast<void*>(static_cast<const MultiChunkTable*>(this)->part(index));
+}
+
+const void* MultiChunkTable::part(const uint32_t index) const noexcept
+{
+    cxx::Expects(index < m_numberOfParts);
+    const auto& userPayload = m_parts[index].m_userPayload;
+    return rp::RelativePointer<void>(userPayload.offset(), rp::BaseRelativePointer::id_t{userPayload.id()}).get();
+}
+
+uint32_t MultiChunkTable::partSize(const uint32_t index) const noexcept
+{
+    cxx::Expects(index < m_numberOfParts);
+    return static_cast<uint32_t>(m_parts[index].m_size);
+}
+
+uint64_t MultiChunkTable::gather(void* const destination, const uint64_t destinationSize) const noexcept
+{
+    uint64_t copiedSize{0U};
+    for (uint32_t i = 0U; i < m_numberOfParts && copiedSize < destinationSize; ++i)
+    {
+        const auto size = algorithm::min(m_parts[i].m_size, destinationSize - copiedSize);
+        std::memcpy(static_cast<uint8_t*>(destination) + copiedSize, part(i), size);
+        copiedSize += size;
+    }
+    return copiedSize;
+}
+
+bool MultiChunkTable::addPart(void* const userPayload, const uint32_t size) noexcept
+{
+    if (m_numberOfParts >= MAX_NUMBER_OF_PARTS)
+    {
+        return false;
+    }
+
+    rp::RelativePointer<void> ptr{userPayload};
+    auto id = ptr.getId();
+    auto offset = ptr.getOffset();
+    cxx::Ensures(id <= rp::RelativePointerData::ID_RANGE && "RelativePointer id must fit into id type!");
+    cxx::Ensures(offset <= rp::RelativePointerData::OFFSET_RANGE
+                 && "RelativePointer offset must fit into offset type!");
+
+    auto& part = m_parts[m_numberOfParts];
+    part.m_userPayload = rp::RelativePointerData(static_cast<rp::RelativePointerData::identifier_t>(id), offset);
+    part.m_size = size;
+    m_totalSize += size;
+    ++m_numberOfParts;
+    return true;
+}
+
+} // namespace mepoo
+} // namespace iox
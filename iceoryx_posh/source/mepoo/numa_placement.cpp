@@ -0,0 +1,211 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/mepoo/numa_placement.hpp"
+#include "iceoryx_hoofs/cxx/algorithm.hpp"
+#include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/system_configuration.hpp"
+#include "iceoryx_hoofs/platform/numa.hpp"
+#include "iceoryx_hoofs/posix_wrapper/posix_call.hpp"
+#include "iceoryx_posh/internal/log/posh_logging.hpp"
+
+#include <cstring>
+
+namespace iox
+{
+namespace mepoo
+{
+namespace
+{
+/// @brief the number of pages which are sampled by sampleNumaDistribution
+constexpr uint64_t NUMBER_OF_SAMPLED_PAGES{64U};
+} // namespace
+
+const char* asStringLiteral(const NumaPolicy policy) noexcept
+{
+    switch (policy)
+    {
+    case NumaPolicy::DEFAULT:
+        return "NumaPolicy::DEFAULT";
+    case NumaPolicy::PREFERRED:
+        return "NumaPolicy::PREFERRED";
+    case NumaPolicy::BIND:
+        return "NumaPolicy::BIND";
+    case NumaPolicy::INTERLEAVE:
+        return "NumaPolicy::INTERLEAVE";
+    }
+
+    return "NumaPolicy::UNDEFINED_VALUE";
+}
+
+cxx::optional<NumaPolicy> numaPolicyFromString(const char* const name) noexcept
+{
+    if (strcmp(name, "default") == 0)
+    {
+        return NumaPolicy::DEFAULT;
+    }
+    if (strcmp(name, "preferred") == 0)
+    {
+        return NumaPolicy::PREFERRED;
+    }
+    if (strcmp(name, "bind") == 0)
+    {
+        return NumaPolicy::BIND;
+    }
+    if (strcmp(name, "interleave") == 0)
+    {
+        return NumaPolicy::INTERLEAVE;
+    }
+    return cxx::nullopt;
+}
+
+NumaPlacement NumaPlacement::onNode(const uint32_t node, const NumaPolicy policy) noexcept
+{
+    NumaPlacement placement;
+    placement.m_policy = policy;
+    placement.m_nodeMask = (node < MAX_NUMBER_OF_NUMA_NODES) ? (1ULL << node) : 0U;
+    return placement;
+}
+
+bool NumaPlacement::isDefault() const noexcept
+{
+    return m_policy == NumaPolicy::DEFAULT;
+}
+
+bool NumaPlacement::isValid() const noexcept
+{
+    if (isDefault())
+    {
+        return true;
+    }
+    constexpr uint64_t VALID_NODES{(1ULL << MAX_NUMBER_OF_NUMA_NODES) - 1U};
+    return m_nodeMask != 0U && (m_nodeMask & ~VALID_NODES) == 0U;
+}
+
+bool NumaPlacement::operator==(const NumaPlacement& rhs) const noexcept
+{
+    return m_policy == rhs.m_policy && m_nodeMask == rhs.m_nodeMask;
+}
+
+bool applyNumaPlacement(void* const memory, const uint64_t size, const NumaPlacement& placement) noexcept
+{
+    if (placement.isDefault())
+    {
+        return true;
+    }
+    if (!placement.isValid())
+    {
+        LogWarn() << "Invalid NUMA placement with the node mask " << log::HexFormat(placement.m_nodeMask);
+        return false;
+    }
+
+    const uint64_t pageSize = posix::pageSize();
+    // NOLINTJUSTIFICATION the page boundaries can only be calculated with the address as integer
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    const auto start = reinterpret_cast<uint64_t>(memory);
+    const uint64_t firstPage = cxx::align(start, pageSize);
+    const uint64_t endOfLastPage = ((start + size) / pageSize) * pageSize;
+    if (endOfLastPage <= firstPage)
+    {
+        return true;
+    }
+
+    iox_numa_policy_t policy{IOX_NUMA_POLICY_PREFERRED};
+    switch (placement.m_policy)
+    {
+    case NumaPolicy::DEFAULT:
+    case NumaPolicy::PREFERRED:
+        policy = IOX_NUMA_POLICY_PREFERRED;
+        break;
+    case NumaPolicy::BIND:
+        policy = IOX_NUMA_POLICY_BIND;
+        break;
+    case NumaPolicy::INTERLEAVE:
+        policy = IOX_NUMA_POLICY_INTERLEAVE;
+        break;
+    }
+
+    // NOLINTJUSTIFICATION the page aligned address is within the memory
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast, performance-no-int-to-ptr)
+    auto result = posix::posixCall(iox_numa_set_memory_policy)(reinterpret_cast<void*>(firstPage),
+                                                                endOfLastPage - firstPage,
+                                                                policy,
+                                                                placement.m_nodeMask)
+                      .failureReturnValue(-1)
+                      .suppressErrorMessagesForErrnos(ENOSYS)
+                      .evaluate();
+    if (result.has_error())
+    {
+        LogWarn() << "Unable to apply the NUMA placement " << asStringLiteral(placement.m_policy)
+                  << " with the node mask " << log::HexFormat(placement.m_nodeMask) << " to " << size
+                  << " bytes of memory";
+        return false;
+    }
+    return true;
+}
+
+uint32_t getCurrentNumaNode() noexcept
+{
+    uint32_t node{0U};
+    if (iox_numa_get_current_node(&node) != 0)
+    {
+        return 0U;
+    }
+    return node;
+}
+
+void sampleNumaDistribution(const void* const memory,
+                            const uint64_t size,
+                            uint32_t (&pagesPerNode)[MAX_NUMBER_OF_NUMA_NODES]) noexcept
+{
+    for (auto& pages : pagesPerNode)
+    {
+        pages = 0U;
+    }
+
+    const uint64_t pageSize = posix::pageSize();
+    const uint64_t numberOfPages = (size + pageSize - 1U) / pageSize;
+    if (memory == nullptr || numberOfPages == 0U)
+    {
+        return;
+    }
+
+    const uint64_t numberOfSamples = algorithm::min(numberOfPages, NUMBER_OF_SAMPLED_PAGES);
+    const uint64_t stride = size / numberOfSamples;
+    const void* pages[NUMBER_OF_SAMPLED_PAGES];
+    int nodes[NUMBER_OF_SAMPLED_PAGES];
+    for (uint64_t i = 0U; i < numberOfSamples; ++i)
+    {
+        pages[i] = static_cast<const uint8_t*>(memory) + i * stride;
+    }
+
+    if (iox_numa_get_page_nodes(&pages[0], numberOfSamples, &nodes[0]) != 0)
+    {
+        return;
+    }
+
+    for (uint64_t i = 0U; i < numberOfSamples; ++i)
+    {
+        if (nodes[i] >= 0 && static_cast<uint32_t>(nodes[i]) < MAX_NUMBER_OF_NUMA_NODES)
+        {
+            ++pagesPerNode[nodes[i]];
+        }
+    }
+}
+
+} // namespace mepoo
+} // namespace iox
@@ -16,7 +16,9 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
+#include "iceoryx_hoofs/cxx/requires.hpp"
 #include "iceoryx_hoofs/internal/relocatable_pointer/relative_pointer.hpp"
+#include "iceoryx_posh/internal/mepoo/chunk_quota.hpp"
 
 namespace iox
 {
@@ -61,9 +63,63 @@ void SharedChunk::decrementReferenceCounter() noexcept
 
 void SharedChunk::freeChunk() noexcept
 {
+    auto memPoolAccounting = m_chunkManagement->m_memPoolAccounting.get();
+    auto memPoolQuota = m_chunkManagement->m_memPoolQuota.get();
+
+    if (hasParts())
+    {
+        releaseParts();
+    }
+
+    // a free chunk management must not have an owner, otherwise the lost chunk sweep could release it once it is reused
+    m_chunkManagement->m_owner.store(ChunkManagement::NO_OWNER, std::memory_order_relaxed);
+
     m_chunkManagement->m_mempool->freeChunk(static_cast<void*>(m_chunkManagement->m_chunkHeader.get()));
     m_chunkManagement->m_chunkManagementPool->freeChunk(m_chunkManagement);
     m_chunkManagement = nullptr;
+
+    if (memPoolAccounting != nullptr)
+    {
+        memPoolAccounting->releaseChunk(memPoolQuota);
+    }
+}
+
+void SharedChunk::addPart(SharedChunk&& part) noexcept
+{
+    auto partChunkManagement = part.release();
+    partChunkManagement->m_nextPart = m_chunkManagement->m_nextPart;
+
+    rp::RelativePointer<ChunkManagement> ptr{partChunkManagement};
+    auto id = ptr.getId();
+    auto offset = ptr.getOffset();
+    cxx::Ensures(id <= rp::RelativePointerData::ID_RANGE && "RelativePointer id must fit into id type!");
+    cxx::Ensures(offset <= rp::RelativePointerData::OFFSET_RANGE
+                 && "RelativePointer offset must fit into offset type!");
+    m_chunkManagement->m_nextPart =
+        rp::RelativePointerData(static_cast<rp::RelativePointerData::identifier_t>(id), offset);
+}
+
+bool SharedChunk::hasParts() const noexcept
+{
+    return m_chunkManagement != nullptr && !m_chunkManagement->m_nextPart.isLogicalNullptr();
+}
+
+void SharedChunk::releaseParts() noexcept
+{
+    auto nextPart = m_chunkManagement->m_nextPart;
+    m_chunkManagement->m_nextPart.reset();
+
+    while (!nextPart.isLogicalNullptr())
+    {
+        auto partChunkManagement =
+            rp::RelativePointer<ChunkManagement>(nextPart.offset(), rp::BaseRelativePointer::id_t{nextPart.id()})
+                .get();
+        nextPart = partChunkManagement->m_nextPart;
+        partChunkManagement->m_nextPart.reset();
+
+        // the chain held the only reference of the part, the d'tor of the SharedChunk releases it
+        SharedChunk part(partChunkManagement);
+    }
 }
 
 SharedChunk& SharedChunk::operator=(const SharedChunk& rhs) noexcept
@@ -144,5 +200,21 @@ ChunkManagement* SharedChunk::release() noexcept
     return returnValue;
 }
 
+void SharedChunk::setOwner(const popo::UniquePortId owner) noexcept
+{
+    if (m_chunkManagement != nullptr)
+    {
+        m_chunkManagement->m_owner.store(static_cast<uint64_t>(owner), std::memory_order_relaxed);
+    }
+}
+
+void SharedChunk::resetOwner() noexcept
+{
+    if (m_chunkManagement != nullptr)
+    {
+        m_chunkManagement->m_owner.store(ChunkManagement::NO_OWNER, std::memory_order_relaxed);
+    }
+}
+
 } // namespace mepoo
 } // namespace iox
@@ -18,12 +18,15 @@
 #include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
 #include "iceoryx_posh/error_handling/error_handling.hpp"
 
+#include <thread>
+
 namespace iox
 {
 namespace popo
 {
-ConditionListener::ConditionListener(ConditionVariableData& condVarData) noexcept
+ConditionListener::ConditionListener(ConditionVariableData& condVarData, const WaitStrategy& waitStrategy) noexcept
     : m_condVarDataPtr(&condVarData)
+    , m_waitStrategy(waitStrategy)
 {
 }
 
@@ -59,6 +62,10 @@ bool ConditionListener::wasNotified() const noexcept
 ConditionListener::NotificationVector_t ConditionListener::wait() noexcept
 {
     return waitImpl([this]() -> bool {
+        if (this->pollForNotification())
+        {
+            return true;
+        }
         if (this->getMembers()->m_semaphore->wait().has_error())
         {
             errorHandler(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_WAIT, ErrorLevel::FATAL);
@@ -71,6 +78,10 @@ ConditionListener::NotificationVector_t ConditionListener::wait() noexcept
 ConditionListener::NotificationVector_t ConditionListener::timedWait(const units::Duration& timeToWait) noexcept
 {
     return waitImpl([this, timeToWait]() -> bool {
+        if (this->pollForNotification())
+        {
+            return true;
+        }
         if (this->getMembers()->m_semaphore->timedWait(timeToWait).has_error())
         {
             errorHandler(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_TIMED_WAIT, ErrorLevel::FATAL);
@@ -88,6 +99,11 @@ ConditionListener::NotificationVector_t ConditionListener::waitImpl(const cxx::f
     bool doReturnAfterNotificationCollection = false;
     while (!m_toBeDestroyed.load(std::memory_order_relaxed))
     {
+        // the notifier skips the semaphore post while m_wasNotified is set, therefore it must be consumed before the
+        // active notifications are collected; the acquire pairs with the release of the notifier so that the active
+        // notifications of all coalesced notify calls are visible
+        getMembers()->m_wasNotified.exchange(false, std::memory_order_acquire);
+
         for (Type_t i = 0U; i < MAX_NUMBER_OF_NOTIFIERS; i++)
         {
             if (getMembers()->m_activeNotifications[i].load(std::memory_order_relaxed))
@@ -107,10 +123,48 @@ ConditionListener::NotificationVector_t ConditionListener::waitImpl(const cxx::f
     return activeNotifications;
 }
 
+bool ConditionListener::pollForNotification() noexcept
+{
+    if (!m_waitStrategy.isPolling())
+    {
+        return false;
+    }
+
+    // the flag is consumed so that a stale m_wasNotified without an active notification cannot cause an endless
+    // polling loop; the acquire pairs with the release in ConditionNotifier::notify so that the active notification is
+    // visible when waitImpl collects them
+    auto hasNotificationArrived = [this] {
+        return (wasNotified() && getMembers()->m_wasNotified.exchange(false, std::memory_order_acquire))
+               || m_toBeDestroyed.load(std::memory_order_relaxed);
+    };
+
+    getMembers()->m_isListenerPolling.store(true, std::memory_order_relaxed);
+    // pairs with the fence in ConditionNotifier::notify; a notifier which does not observe the polling flag will
+    // post the semaphore
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    bool hasArrived = false;
+    for (uint64_t i = 0U; !hasArrived && i < m_waitStrategy.spinRepetitions; ++i)
+    {
+        hasArrived = hasNotificationArrived();
+    }
+    for (uint64_t i = 0U; !hasArrived && i < m_waitStrategy.yieldRepetitions; ++i)
+    {
+        std::this_thread::yield();
+        hasArrived = hasNotificationArrived();
+    }
+
+    getMembers()->m_isListenerPolling.store(false, std::memory_order_relaxed);
+    // a notifier which has seen the polling flag skipped the semaphore post, therefore the notification flag has to
+    // be checked again after the polling flag was reset and before the listener blocks
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    return hasArrived || hasNotificationArrived();
+}
+
 void ConditionListener::resetUnchecked(const uint64_t index) noexcept
 {
     getMembers()->m_activeNotifications[index].store(false, std::memory_order_relaxed);
-    getMembers()->m_wasNotified.store(false, std::memory_order_relaxed);
 }
 
 const ConditionVariableData* ConditionListener::getMembers() const noexcept
@@ -17,6 +17,7 @@
 
 #include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/notification_socket.hpp"
 
 namespace iox
 {
@@ -37,7 +38,31 @@ ConditionNotifier::ConditionNotifier(ConditionVariableData& condVarDataRef, cons
 void ConditionNotifier::notify() noexcept
 {
     getMembers()->m_activeNotifications[m_notificationIndex].store(true, std::memory_order_release);
-    getMembers()->m_wasNotified.store(true, std::memory_order_relaxed);
+
+    // coalescing: a notification which is not yet consumed by the listener has already posted the semaphore or is
+    // observed by the polling listener; the listener consumes m_wasNotified before it collects the active
+    // notifications, therefore this one is collected as well
+    if (getMembers()->m_wasNotified.exchange(true, std::memory_order_acq_rel))
+    {
+        return;
+    }
+
+    // pairs with the fences in ConditionListener::pollForNotification and NotificationSocket::create; either this
+    // notifier observes their flag or they observe m_wasNotified
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    // an external reactor which waits on the file descriptor of the listener is woken up by the socket
+    if (getMembers()->m_isNotificationSocketEnabled.load(std::memory_order_acquire))
+    {
+        NotificationSocket::notify(*getMembers());
+    }
+
+    // a polling listener observes m_wasNotified without the semaphore, so the syscall can be skipped
+    if (getMembers()->m_isListenerPolling.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
     getMembers()->m_semaphore->post().or_else(
         [](auto) { errorHandler(PoshError::POPO__CONDITION_NOTIFIER_SEMAPHORE_CORRUPT_IN_NOTIFY, ErrorLevel::FATAL); });
 }
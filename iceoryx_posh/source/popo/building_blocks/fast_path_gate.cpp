@@ -0,0 +1,86 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/internal/popo/building_blocks/fast_path_gate.hpp"
+#include "iceoryx_hoofs/internal/cxx/adaptive_wait.hpp"
+
+namespace iox
+{
+namespace popo
+{
+constexpr uint32_t FastPathGate::OPEN;
+constexpr uint32_t FastPathGate::CLOSED;
+constexpr uint32_t FastPathGate::INSIDE;
+
+bool FastPathGate::tryEnter() noexcept
+{
+    cxx::internal::adaptive_wait adaptiveWait;
+    uint32_t expected{OPEN};
+    while (!m_state.compare_exchange_weak(expected, INSIDE, std::memory_order_acquire, std::memory_order_relaxed))
+    {
+        if (expected == CLOSED)
+        {
+            return false;
+        }
+        if (expected == INSIDE)
+        {
+            adaptiveWait.wait();
+        }
+        expected = OPEN;
+    }
+    return true;
+}
+
+void FastPathGate::leave() noexcept
+{
+    m_state.store(OPEN, std::memory_order_release);
+}
+
+void FastPathGate::close() noexcept
+{
+    cxx::internal::adaptive_wait adaptiveWait;
+    uint32_t state = m_state.load(std::memory_order_acquire);
+    while (state != CLOSED)
+    {
+        if (state == OPEN && m_state.compare_exchange_strong(state, CLOSED, std::memory_order_acq_rel))
+        {
+            return;
+        }
+        adaptiveWait.wait();
+        state = m_state.load(std::memory_order_acquire);
+    }
+}
+
+void FastPathGate::closeAbandoned() noexcept
+{
+    // a sender which terminated inside of the gate will never leave it, whether the sender is gone is known by the
+    // caller
+    m_state.store(CLOSED, std::memory_order_release);
+}
+
+void FastPathGate::open() noexcept
+{
+    m_state.store(OPEN, std::memory_order_release);
+}
+
+bool FastPathGate::isOpen() const noexcept
+{
+    return m_state.load(std::memory_order_relaxed) != CLOSED;
+}
+
+} // namespace popo
+} // namespace iox
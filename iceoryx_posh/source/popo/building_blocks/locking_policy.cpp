@@ -21,9 +21,47 @@ namespace iox
 {
 namespace popo
 {
+namespace
+{
+/// @brief unifies the interfaces of the FutexLock and the posix mutex which is used on platforms without futex
+template <bool HasFutex>
+struct LockOperations;
+
+template <>
+struct LockOperations<true>
+{
+    static bool lock(concurrent::FutexLock& mutex) noexcept
+    {
+        mutex.lock();
+        return true;
+    }
+
+    static bool tryLockOrRecoverFromDeadOwner(concurrent::FutexLock& mutex) noexcept
+    {
+        return mutex.tryLockOrRecoverFromDeadOwner();
+    }
+};
+
+template <>
+struct LockOperations<false>
+{
+    static bool lock(posix::mutex& mutex) noexcept
+    {
+        return mutex.lock();
+    }
+
+    static bool tryLockOrRecoverFromDeadOwner(posix::mutex& mutex) noexcept
+    {
+        return mutex.try_lock();
+    }
+};
+
+using PlatformLockOperations = LockOperations<platform::IOX_SUPPORT_FUTEX>;
+} // namespace
+
 void ThreadSafePolicy::lock() const noexcept
 {
-    if (!m_mutex.lock())
+    if (!PlatformLockOperations::lock(m_mutex))
     {
         errorHandler(PoshError::POPO__CHUNK_LOCKING_ERROR, ErrorLevel::FATAL);
     }
@@ -42,6 +80,11 @@ bool ThreadSafePolicy::tryLock() const noexcept
     return m_mutex.try_lock();
 }
 
+bool ThreadSafePolicy::tryLockOrRecoverFromDeadOwner() const noexcept
+{
+    return PlatformLockOperations::tryLockOrRecoverFromDeadOwner(m_mutex);
+}
+
 void SingleThreadedPolicy::lock() const noexcept
 {
 }
@@ -55,5 +98,10 @@ bool SingleThreadedPolicy::tryLock() const noexcept
     return true;
 }
 
+bool SingleThreadedPolicy::tryLockOrRecoverFromDeadOwner() const noexcept
+{
+    return true;
+}
+
 } // namespace popo
 } // namespace iox
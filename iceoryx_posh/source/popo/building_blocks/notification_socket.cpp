@@ -0,0 +1,223 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/internal/popo/building_blocks/notification_socket.hpp"
+#include "iceoryx_hoofs/cxx/convert.hpp"
+#include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_hoofs/platform/platform_settings.hpp"
+#include "iceoryx_hoofs/platform/socket.hpp"
+#include "iceoryx_hoofs/platform/unistd.hpp"
+#include "iceoryx_hoofs/posix_wrapper/posix_call.hpp"
+#include "iceoryx_posh/internal/log/posh_logging.hpp"
+
+#include <atomic>
+#include <cstring>
+#include <string>
+
+namespace iox
+{
+namespace popo
+{
+namespace
+{
+constexpr int32_t ERROR_CODE{-1};
+constexpr uint8_t NOTIFICATION_BYTE{1U};
+
+sockaddr_un toSocketAddress(const NotificationSocketPath_t& path) noexcept
+{
+    sockaddr_un address{};
+    address.sun_family = AF_LOCAL;
+    // the path capacity is sizeof(sun_path) - 1, therefore the address stays null terminated
+    std::memcpy(&address.sun_path[0], path.c_str(), path.size());
+    return address;
+}
+
+NotificationSocketPath_t createUniquePath() noexcept
+{
+    static std::atomic<uint64_t> counter{0U};
+    const auto path = std::string(platform::IOX_UDS_SOCKET_PATH_PREFIX) + "iox_notification_"
+                      + cxx::convert::toString(getpid()) + "_"
+                      + cxx::convert::toString(counter.fetch_add(1U, std::memory_order_relaxed));
+    return NotificationSocketPath_t(cxx::TruncateToCapacity, path);
+}
+
+void unlinkPath(const NotificationSocketPath_t& path) noexcept
+{
+    posix::posixCall(unlink)(path.c_str())
+        .failureReturnValue(ERROR_CODE)
+        .ignoreErrnos(ENOENT)
+        .evaluate()
+        .or_else([&](auto& r) {
+            LogWarn() << "Unable to remove the notification socket '" << path << "': " << r.getHumanReadableErrnum();
+        });
+}
+} // namespace
+
+constexpr int32_t NotificationSocket::INVALID_FD;
+
+cxx::expected<NotificationSocket, NotificationSocketError>
+NotificationSocket::create(ConditionVariableData& condVarData) noexcept
+{
+    if (condVarData.m_isNotificationSocketEnabled.load(std::memory_order_relaxed))
+    {
+        return cxx::error<NotificationSocketError>(NotificationSocketError::ALREADY_ENABLED);
+    }
+
+    const auto path = createUniquePath();
+    if (path.size() == NotificationSocketPath_t::capacity())
+    {
+        return cxx::error<NotificationSocketError>(NotificationSocketError::PATH_TOO_LONG);
+    }
+
+    auto socketCall = posix::posixCall(iox_socket)(AF_LOCAL, SOCK_DGRAM, 0).failureReturnValue(ERROR_CODE).evaluate();
+    if (socketCall.has_error())
+    {
+        LogError() << "Unable to create the notification socket: " << socketCall.get_error().getHumanReadableErrnum();
+        return cxx::error<NotificationSocketError>(NotificationSocketError::UNABLE_TO_CREATE_SOCKET);
+    }
+    const int32_t fileDescriptor = socketCall->value;
+
+    // a stale socket of a crashed process with the same pid would let the bind fail
+    unlinkPath(path);
+    auto address = toSocketAddress(path);
+    auto bindCall =
+        posix::posixCall(iox_bind)(fileDescriptor, reinterpret_cast<struct sockaddr*>(&address), sizeof(address))
+            .failureReturnValue(ERROR_CODE)
+            .evaluate();
+    if (bindCall.has_error())
+    {
+        LogError() << "Unable to bind the notification socket to '" << path
+                   << "': " << bindCall.get_error().getHumanReadableErrnum();
+        IOX_DISCARD_RESULT(posix::posixCall(iox_closesocket)(fileDescriptor).failureReturnValue(ERROR_CODE).evaluate());
+        return cxx::error<NotificationSocketError>(NotificationSocketError::UNABLE_TO_BIND_SOCKET);
+    }
+
+    condVarData.m_notificationSocketPath = path;
+    // pairs with the acquire in ConditionNotifier::notify, the path is visible when the flag is observed
+    condVarData.m_isNotificationSocketEnabled.store(true, std::memory_order_release);
+
+    // a notifier which set m_wasNotified before it could observe the flag did not signal the socket, the pending
+    // notification has to make the file descriptor readable nevertheless; pairs with the fence in
+    // ConditionNotifier::notify
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (condVarData.m_wasNotified.load(std::memory_order_relaxed))
+    {
+        notify(condVarData);
+    }
+
+    return cxx::success<NotificationSocket>(NotificationSocket(condVarData, fileDescriptor));
+}
+
+NotificationSocket::NotificationSocket(ConditionVariableData& condVarData, const int32_t fileDescriptor) noexcept
+    : m_condVarDataPtr(&condVarData)
+    , m_fileDescriptor(fileDescriptor)
+{
+}
+
+NotificationSocket::NotificationSocket(NotificationSocket&& rhs) noexcept
+{
+    *this = std::move(rhs);
+}
+
+NotificationSocket& NotificationSocket::operator=(NotificationSocket&& rhs) noexcept
+{
+    if (this != &rhs)
+    {
+        destroy();
+        m_condVarDataPtr = rhs.m_condVarDataPtr;
+        m_fileDescriptor = rhs.m_fileDescriptor;
+        rhs.m_condVarDataPtr = nullptr;
+        rhs.m_fileDescriptor = INVALID_FD;
+    }
+    return *this;
+}
+
+NotificationSocket::~NotificationSocket() noexcept
+{
+    destroy();
+}
+
+void NotificationSocket::destroy() noexcept
+{
+    if (m_fileDescriptor == INVALID_FD)
+    {
+        return;
+    }
+
+    // a notifier which still observes the flag sends to a removed path, which fails silently
+    m_condVarDataPtr->m_isNotificationSocketEnabled.store(false, std::memory_order_relaxed);
+    IOX_DISCARD_RESULT(posix::posixCall(iox_closesocket)(m_fileDescriptor).failureReturnValue(ERROR_CODE).evaluate());
+    unlinkPath(m_condVarDataPtr->m_notificationSocketPath);
+
+    m_condVarDataPtr = nullptr;
+    m_fileDescriptor = INVALID_FD;
+}
+
+void NotificationSocket::rearm() noexcept
+{
+    notify(*m_condVarDataPtr);
+}
+
+int32_t NotificationSocket::getFileDescriptor() const noexcept
+{
+    return m_fileDescriptor;
+}
+
+void NotificationSocket::drain() noexcept
+{
+    uint8_t buffer[16U];
+    bool hasReceived = true;
+    while (hasReceived)
+    {
+        hasReceived = false;
+        posix::posixCall(iox_recvfrom)(m_fileDescriptor, &buffer[0], sizeof(buffer), MSG_DONTWAIT, nullptr, nullptr)
+            .failureReturnValue(ERROR_CODE)
+            .ignoreErrnos(EAGAIN, EWOULDBLOCK)
+            .evaluate()
+            .and_then([&](auto& r) { hasReceived = (r.value > 0); });
+    }
+}
+
+void NotificationSocket::notify(const ConditionVariableData& condVarData) noexcept
+{
+    // one unbound socket per process is sufficient to send to any notification socket; it lives until the process
+    // terminates
+    static const int32_t senderFileDescriptor = [] {
+        auto socketCall =
+            posix::posixCall(iox_socket)(AF_LOCAL, SOCK_DGRAM, 0).failureReturnValue(ERROR_CODE).evaluate();
+        return socketCall.has_error() ? INVALID_FD : socketCall->value;
+    }();
+
+    if (senderFileDescriptor == INVALID_FD)
+    {
+        return;
+    }
+
+    const auto address = toSocketAddress(condVarData.m_notificationSocketPath);
+    IOX_DISCARD_RESULT(posix::posixCall(iox_sendto)(senderFileDescriptor,
+                                                    &NOTIFICATION_BYTE,
+                                                    sizeof(NOTIFICATION_BYTE),
+                                                    MSG_DONTWAIT,
+                                                    reinterpret_cast<const struct sockaddr*>(&address),
+                                                    sizeof(address))
+                           .failureReturnValue(ERROR_CODE)
+                           .ignoreErrnos(EAGAIN, EWOULDBLOCK, ENOENT, ECONNREFUSED)
+                           .evaluate());
+}
+
+} // namespace popo
+} // namespace iox
@@ -252,5 +252,10 @@ void ClientPortRouDi::releaseAllChunks() noexcept
     m_chunkReceiver.releaseAll();
 }
 
+void ClientPortRouDi::closeAbandonedFastPath() noexcept
+{
+    m_chunkSender.closeAbandonedFastPath();
+}
+
 } // namespace popo
 } // namespace iox
@@ -32,6 +32,20 @@ PublisherPortData::PublisherPortData(const capro::ServiceDescription& serviceDes
     , m_options{publisherOptions}
     , m_offeringRequested(publisherOptions.offerOnCreate)
 {
+    if (publisherOptions.reservedChunks > 0U || publisherOptions.maxChunksPerMemPool > 0U)
+    {
+        m_chunkSenderData.m_chunkQuota =
+            memoryManager->acquireChunkQuota(publisherOptions.reservedChunks, publisherOptions.maxChunksPerMemPool);
+    }
+}
+
+PublisherPortData::~PublisherPortData() noexcept
+{
+    auto chunkQuota = m_chunkSenderData.m_chunkQuota.get();
+    if (chunkQuota != nullptr)
+    {
+        m_chunkSenderData.m_memoryMgr->releaseChunkQuota(chunkQuota);
+    }
 }
 
 } // namespace popo
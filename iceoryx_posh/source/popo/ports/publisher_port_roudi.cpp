@@ -121,5 +121,10 @@ void PublisherPortRouDi::releaseAllChunks() noexcept
     m_chunkSender.releaseAll();
 }
 
+void PublisherPortRouDi::closeAbandonedFastPath() noexcept
+{
+    m_chunkSender.closeAbandonedFastPath();
+}
+
 } // namespace popo
 } // namespace iox
@@ -48,6 +48,16 @@ PublisherPortUser::tryAllocateChunk(const uint32_t userPayloadSize,
         getUniqueID(), userPayloadSize, userPayloadAlignment, userHeaderSize, userHeaderAlignment);
 }
 
+cxx::expected<mepoo::ChunkHeader*, AllocationError>
+PublisherPortUser::tryAllocateMultiChunk(const mepoo::MultiChunkTable::PartSizes_t& partSizes,
+                                         const uint32_t partAlignment,
+                                         const uint32_t userHeaderSize,
+                                         const uint32_t userHeaderAlignment) noexcept
+{
+    return m_chunkSender.tryAllocateMultiChunk(
+        getUniqueID(), partSizes, partAlignment, userHeaderSize, userHeaderAlignment);
+}
+
 void PublisherPortUser::releaseChunk(mepoo::ChunkHeader* const chunkHeader) noexcept
 {
     m_chunkSender.release(chunkHeader);
@@ -71,6 +81,23 @@ void PublisherPortUser::sendChunk(mepoo::ChunkHeader* const chunkHeader) noexcep
     }
 }
 
+void PublisherPortUser::sendChunks(mepoo::ChunkHeader* const* const chunkHeaders,
+                                   const uint64_t numberOfChunks) noexcept
+{
+    if (getMembers()->m_offeringRequested.load(std::memory_order_relaxed))
+    {
+        m_chunkSender.sendMultiple(chunkHeaders, numberOfChunks);
+    }
+    else
+    {
+        // like sendChunk, the chunks of a publisher port which is not offered are only put in the history
+        for (uint64_t i = 0U; i < numberOfChunks; ++i)
+        {
+            m_chunkSender.pushToHistory(chunkHeaders[i]);
+        }
+    }
+}
+
 cxx::optional<const mepoo::ChunkHeader*> PublisherPortUser::tryGetPreviousChunk() const noexcept
 {
     return m_chunkSender.tryGetPreviousChunk();
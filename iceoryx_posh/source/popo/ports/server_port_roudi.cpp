@@ -169,5 +169,10 @@ void ServerPortRouDi::releaseAllChunks() noexcept
     m_chunkReceiver.releaseAll();
 }
 
+void ServerPortRouDi::closeAbandonedFastPath() noexcept
+{
+    m_chunkSender.closeAbandonedFastPath();
+}
+
 } // namespace popo
 } // namespace iox
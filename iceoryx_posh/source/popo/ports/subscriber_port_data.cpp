@@ -29,6 +29,7 @@ SubscriberPortData::SubscriberPortData(const capro::ServiceDescription& serviceD
                                        const mepoo::MemoryInfo& memoryInfo) noexcept
     : BasePortData(serviceDescription, runtimeName, subscriberOptions.nodeName)
     , m_chunkReceiverData(queueType, subscriberOptions.queueFullPolicy, memoryInfo)
+    , m_chunkWindow(subscriberOptions.windowSize)
     , m_options{subscriberOptions}
     , m_subscribeRequested(subscriberOptions.subscribeOnCreate)
 {
@@ -45,6 +45,7 @@ SubscriberPortRouDi::MemberType_t* SubscriberPortRouDi::getMembers() noexcept
 void SubscriberPortRouDi::releaseAllChunks() noexcept
 {
     m_chunkReceiver.releaseAll();
+    getMembers()->m_chunkWindow.cleanup();
 }
 
 } // namespace popo
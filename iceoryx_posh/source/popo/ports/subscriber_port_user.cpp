@@ -69,6 +69,13 @@ cxx::expected<const mepoo::ChunkHeader*, ChunkReceiveResult> SubscriberPortUser:
     return m_chunkReceiver.tryGet();
 }
 
+cxx::expected<uint64_t, ChunkReceiveResult>
+SubscriberPortUser::tryGetChunks(const uint64_t maxNumberOfChunks,
+                                 const cxx::function_ref<void(const mepoo::ChunkHeader*)> callable) noexcept
+{
+    return m_chunkReceiver.tryGetMultiple(maxNumberOfChunks, callable);
+}
+
 void SubscriberPortUser::releaseChunk(const mepoo::ChunkHeader* const chunkHeader) noexcept
 {
     m_chunkReceiver.release(chunkHeader);
@@ -79,6 +86,34 @@ void SubscriberPortUser::releaseQueuedChunks() noexcept
     m_chunkReceiver.clear();
 }
 
+uint64_t SubscriberPortUser::updateWindow() noexcept
+{
+    auto& window = getMembers()->m_chunkWindow;
+    if (window.windowSize() == 0U)
+    {
+        return 0U;
+    }
+
+    // the reference of the queue is handed over to the window, there is no additional reference counting
+    uint64_t numberOfChunks{0U};
+    for (auto maybeChunk = m_chunkReceiver.tryPop(); maybeChunk.has_value(); maybeChunk = m_chunkReceiver.tryPop())
+    {
+        window.push(std::move(maybeChunk.value()));
+        ++numberOfChunks;
+    }
+    return numberOfChunks;
+}
+
+const SubscriberPortData::ChunkWindow_t& SubscriberPortUser::getWindow() const noexcept
+{
+    return getMembers()->m_chunkWindow;
+}
+
+void SubscriberPortUser::releaseWindow() noexcept
+{
+    getMembers()->m_chunkWindow.clear();
+}
+
 bool SubscriberPortUser::hasNewChunks() const noexcept
 {
     return !m_chunkReceiver.empty();
@@ -27,7 +27,9 @@ cxx::Serialization PublisherOptions::serialize() const noexcept
         historyCapacity,
         nodeName,
         offerOnCreate,
-        static_cast<std::underlying_type_t<ConsumerTooSlowPolicy>>(subscriberTooSlowPolicy));
+        static_cast<std::underlying_type_t<ConsumerTooSlowPolicy>>(subscriberTooSlowPolicy),
+        reservedChunks,
+        maxChunksPerMemPool);
 }
 
 cxx::expected<PublisherOptions, cxx::Serialization::Error>
@@ -41,7 +43,9 @@ PublisherOptions::deserialize(const cxx::Serialization& serialized) noexcept
     auto deserializationSuccessful = serialized.extract(publisherOptions.historyCapacity,
                                                         publisherOptions.nodeName,
                                                         publisherOptions.offerOnCreate,
-                                                        subscriberTooSlowPolicy);
+                                                        subscriberTooSlowPolicy,
+                                                        publisherOptions.reservedChunks,
+                                                        publisherOptions.maxChunksPerMemPool);
 
     if (!deserializationSuccessful
         || subscriberTooSlowPolicy > static_cast<ConsumerTooSlowPolicyUT>(ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA))
@@ -0,0 +1,133 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/internal/roudi/chunk_reclaimer.hpp"
+#include "iceoryx_hoofs/cxx/algorithm.hpp"
+#include "iceoryx_posh/internal/log/posh_logging.hpp"
+
+#include <algorithm>
+
+namespace iox
+{
+namespace roudi
+{
+constexpr uint64_t ChunkReclaimer::DEFAULT_CHUNK_MANAGEMENTS_PER_SWEEP_STEP;
+constexpr uint32_t ChunkReclaimer::MAX_LOST_OWNERS;
+
+ChunkReclaimer::ChunkReclaimer(const uint64_t chunkManagementsPerSweepStep) noexcept
+    : m_chunkManagementsPerSweepStep(algorithm::max(chunkManagementsPerSweepStep, uint64_t{1U}))
+{
+}
+
+bool ChunkReclaimer::addLostOwner(const popo::UniquePortId owner) noexcept
+{
+    if (!owner.isValid())
+    {
+        return false;
+    }
+    if (!m_pendingOwners.push_back(static_cast<uint64_t>(owner)))
+    {
+        LogWarn() << "Too many ports of terminated processes wait for the sweep for lost chunks, the chunks of port "
+                  << static_cast<uint64_t>(owner) << " will not be reclaimed";
+        return false;
+    }
+    return true;
+}
+
+bool ChunkReclaimer::isSweepPending() const noexcept
+{
+    return !m_sweptOwners.empty() || !m_pendingOwners.empty();
+}
+
+uint64_t ChunkReclaimer::sweepStep(const MemoryManagerList_t& memoryManagers) noexcept
+{
+    if (m_sweptOwners.empty())
+    {
+        if (m_pendingOwners.empty())
+        {
+            return 0U;
+        }
+        m_sweptOwners = m_pendingOwners;
+        m_pendingOwners.clear();
+        std::sort(m_sweptOwners.begin(), m_sweptOwners.end());
+        m_memoryManagerIndex = 0U;
+        m_chunkManagementIndex = 0U;
+        m_reclaimedChunksOfSweep = 0U;
+    }
+
+    uint64_t reclaimedChunks{0U};
+    uint64_t remainingChunkManagements{m_chunkManagementsPerSweepStep};
+    auto isLostOwner = [this](const uint64_t owner) { return this->isLostOwner(owner); };
+    while (remainingChunkManagements > 0U && m_memoryManagerIndex < memoryManagers.size())
+    {
+        auto memoryManager = memoryManagers[m_memoryManagerIndex];
+        // the chunk managements of mempool extents are added at the end, therefore the index stays valid
+        const auto numberOfChunkManagements = memoryManager->getNumberOfChunkManagements();
+        const auto numberToCheck =
+            algorithm::min(remainingChunkManagements, numberOfChunkManagements - m_chunkManagementIndex);
+
+        reclaimedChunks +=
+            memoryManager->releaseChunksOfLostOwners(m_chunkManagementIndex, numberToCheck, isLostOwner);
+        remainingChunkManagements -= numberToCheck;
+        m_chunkManagementIndex += numberToCheck;
+
+        if (m_chunkManagementIndex >= numberOfChunkManagements)
+        {
+            ++m_memoryManagerIndex;
+            m_chunkManagementIndex = 0U;
+        }
+    }
+
+    m_reclaimedChunksOfSweep += reclaimedChunks;
+    m_numberOfReclaimedChunks += reclaimedChunks;
+
+    if (m_memoryManagerIndex >= memoryManagers.size())
+    {
+        finishSweep();
+    }
+
+    return reclaimedChunks;
+}
+
+void ChunkReclaimer::finishSweep() noexcept
+{
+    if (m_reclaimedChunksOfSweep > 0U)
+    {
+        LogWarn() << "Reclaimed " << m_reclaimedChunksOfSweep << " chunks which were lost by " << m_sweptOwners.size()
+                  << " ports of terminated processes";
+    }
+    m_sweptOwners.clear();
+    ++m_numberOfSweeps;
+}
+
+bool ChunkReclaimer::isLostOwner(const uint64_t owner) const noexcept
+{
+    return std::binary_search(m_sweptOwners.begin(), m_sweptOwners.end(), owner);
+}
+
+uint64_t ChunkReclaimer::getNumberOfReclaimedChunks() const noexcept
+{
+    return m_numberOfReclaimedChunks;
+}
+
+uint64_t ChunkReclaimer::getNumberOfSweeps() const noexcept
+{
+    return m_numberOfSweeps;
+}
+
+} // namespace roudi
+} // namespace iox
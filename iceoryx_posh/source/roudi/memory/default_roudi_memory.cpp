@@ -18,6 +18,7 @@
 #include "iceoryx_posh/roudi/memory/default_roudi_memory.hpp"
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+#include "iceoryx_posh/internal/roudi/service_registry_update.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
 
 namespace iox
@@ -27,7 +28,10 @@ namespace roudi
 DefaultRouDiMemory::DefaultRouDiMemory(const RouDiConfig_t& roudiConfig) noexcept
     : m_introspectionMemPoolBlock(introspectionMemPoolConfig())
     , m_segmentManagerBlock(roudiConfig)
-    , m_managementShm(SHM_NAME, posix::AccessMode::READ_WRITE, posix::OpenMode::PURGE_AND_CREATE)
+    , m_managementShm(SHM_NAME,
+                      posix::AccessMode::READ_WRITE,
+                      posix::OpenMode::PURGE_AND_CREATE,
+                      roudiConfig.m_managementNumaPlacement)
 {
     m_managementShm.addMemoryBlock(&m_introspectionMemPoolBlock).or_else([](auto) {
         errorHandler(PoshError::ROUDI__DEFAULT_ROUDI_MEMORY_FAILED_TO_ADD_INTROSPECTION_MEMORY_BLOCK,
@@ -58,6 +62,16 @@ mepoo::MePooConfig DefaultRouDiMemory::introspectionMemPoolConfig() const noexce
     mempoolConfig.m_mempoolConfig.push_back(
         {cxx::align(static_cast<uint32_t>(sizeof(roudi::SubscriberPortChangingIntrospectionFieldTopic)), ALIGNMENT),
          CHUNK_COUNT});
+    // the history of the service registry publisher holds the updates since the last snapshot; the spare chunks are
+    // required for the updates which are currently processed by the consumers
+    constexpr uint32_t SERVICE_REGISTRY_CHANGE_CHUNK_COUNT{2U * SERVICE_REGISTRY_SNAPSHOT_INTERVAL + CHUNK_COUNT};
+    constexpr uint32_t SERVICE_REGISTRY_SNAPSHOT_CHUNK_COUNT{4U};
+    mempoolConfig.m_mempoolConfig.push_back(
+        {cxx::align(static_cast<uint32_t>(ServiceRegistryUpdate::requiredSize(1U)), ALIGNMENT),
+         SERVICE_REGISTRY_CHANGE_CHUNK_COUNT});
+    mempoolConfig.m_mempoolConfig.push_back(
+        {cxx::align(static_cast<uint32_t>(ServiceRegistryUpdate::requiredSize(ServiceRegistry::CAPACITY)), ALIGNMENT),
+         SERVICE_REGISTRY_SNAPSHOT_CHUNK_COUNT});
 
     mempoolConfig.optimize();
     return mempoolConfig;
@@ -32,10 +32,12 @@ constexpr cxx::perms PosixShmMemoryProvider::SHM_MEMORY_PERMISSIONS;
 
 PosixShmMemoryProvider::PosixShmMemoryProvider(const ShmName_t& shmName,
                                                const posix::AccessMode accessMode,
-                                               const posix::OpenMode openMode) noexcept
+                                               const posix::OpenMode openMode,
+                                               const mepoo::NumaPlacement& numaPlacement) noexcept
     : m_shmName(shmName)
     , m_accessMode(accessMode)
     , m_openMode(openMode)
+    , m_numaPlacement(numaPlacement)
 {
 }
 
@@ -76,6 +78,9 @@ cxx::expected<void*, MemoryProviderError> PosixShmMemoryProvider::createMemory(c
         return cxx::error<MemoryProviderError>(MemoryProviderError::MEMORY_CREATION_FAILED);
     }
 
+    // a failed placement is not fatal, the memory is then placed by the kernel
+    mepoo::applyNumaPlacement(baseAddress, size, m_numaPlacement);
+
     return cxx::success<void*>(baseAddress);
 }
 
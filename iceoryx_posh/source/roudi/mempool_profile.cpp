@@ -0,0 +1,173 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/internal/roudi/mempool_profile.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+
+#include <sstream>
+#include <string>
+
+namespace iox
+{
+namespace roudi
+{
+namespace
+{
+constexpr const char SEGMENT_KEY[] = "segment";
+constexpr const char MEMPOOL_KEY[] = "mempool";
+constexpr const char REQUESTS_KEY[] = "requests";
+constexpr const char TOO_LARGE_REQUESTS_KEY[] = "too-large-requests";
+} // namespace
+
+SegmentProfiles_t createMemPoolProfile(mepoo::SegmentManager<>& segmentManager) noexcept
+{
+    SegmentProfiles_t profile;
+    segmentManager.forEachSegment([&](mepoo::MePooSegment<>& segment) {
+        SegmentProfile segmentProfile;
+        segmentProfile.m_writerGroup = segment.getWriterGroup().getName();
+        segmentProfile.m_readerGroup = segment.getReaderGroup().getName();
+
+        auto& memoryManager = segment.getMemoryManager();
+        for (uint32_t i = 0U; i < memoryManager.getNumberOfMemPools(); ++i)
+        {
+            const auto info = memoryManager.getMemPoolInfo(i);
+            MemPoolProfile mempool;
+            mempool.m_chunkPayloadSize = info.m_chunkSize - static_cast<uint32_t>(sizeof(mepoo::ChunkHeader));
+            mempool.m_numberOfChunks = info.m_numChunks;
+            mempool.m_maxUsedChunks = info.m_numChunks - info.m_minFreeChunks;
+            mempool.m_allocationFailures = info.m_allocationFailures;
+            segmentProfile.m_mempools.push_back(mempool);
+        }
+
+        const auto& histogram = memoryManager.getRequestedChunkPayloadSizes();
+        for (uint32_t bucket = 0U; bucket < mepoo::ChunkSizeHistogram::NUMBER_OF_BUCKETS; ++bucket)
+        {
+            const auto count = histogram.count(bucket);
+            if (count > 0U)
+            {
+                segmentProfile.m_requests.push_back({mepoo::ChunkSizeHistogram::bucketUpperBound(bucket), count});
+            }
+        }
+        segmentProfile.m_tooLargeRequests = memoryManager.getNumberOfTooLargeRequests();
+
+        profile.push_back(std::move(segmentProfile));
+    });
+    return profile;
+}
+
+void writeMemPoolProfile(std::ostream& stream, const SegmentProfiles_t& profile) noexcept
+{
+    stream << MEMPOOL_PROFILE_HEADER << " " << MEMPOOL_PROFILE_VERSION << "\n";
+    for (const auto& segment : profile)
+    {
+        stream << SEGMENT_KEY << " " << segment.m_writerGroup << " " << segment.m_readerGroup << "\n";
+        for (const auto& mempool : segment.m_mempools)
+        {
+            stream << MEMPOOL_KEY << " " << mempool.m_chunkPayloadSize << " " << mempool.m_numberOfChunks << " "
+                   << mempool.m_maxUsedChunks << " " << mempool.m_allocationFailures << "\n";
+        }
+        for (const auto& request : segment.m_requests)
+        {
+            stream << REQUESTS_KEY << " " << request.m_maxChunkPayloadSize << " " << request.m_count << "\n";
+        }
+        stream << TOO_LARGE_REQUESTS_KEY << " " << segment.m_tooLargeRequests << "\n";
+    }
+    stream.flush();
+}
+
+cxx::expected<SegmentProfiles_t, MemPoolProfileError> readMemPoolProfile(std::istream& stream) noexcept
+{
+    std::string line;
+    std::string key;
+    uint32_t version{0U};
+    if (!std::getline(stream, line))
+    {
+        return cxx::error<MemPoolProfileError>(MemPoolProfileError::INVALID_HEADER);
+    }
+    std::istringstream header(line);
+    if (!(header >> key >> version) || key != MEMPOOL_PROFILE_HEADER)
+    {
+        return cxx::error<MemPoolProfileError>(MemPoolProfileError::INVALID_HEADER);
+    }
+    if (version != MEMPOOL_PROFILE_VERSION)
+    {
+        return cxx::error<MemPoolProfileError>(MemPoolProfileError::INCOMPATIBLE_VERSION);
+    }
+
+    SegmentProfiles_t profile;
+    while (std::getline(stream, line))
+    {
+        std::istringstream entry(line);
+        if (!(entry >> key))
+        {
+            // empty lines are ignored
+            continue;
+        }
+
+        bool isValid{false};
+        if (key == SEGMENT_KEY)
+        {
+            std::string writer;
+            std::string reader;
+            isValid = static_cast<bool>(entry >> writer >> reader);
+            if (isValid)
+            {
+                SegmentProfile segment;
+                segment.m_writerGroup = posix::PosixGroup::groupName_t(cxx::TruncateToCapacity, writer);
+                segment.m_readerGroup = posix::PosixGroup::groupName_t(cxx::TruncateToCapacity, reader);
+                profile.push_back(std::move(segment));
+            }
+        }
+        else if (profile.empty())
+        {
+            return cxx::error<MemPoolProfileError>(MemPoolProfileError::ENTRY_WITHOUT_SEGMENT);
+        }
+        else if (key == MEMPOOL_KEY)
+        {
+            MemPoolProfile mempool;
+            isValid = static_cast<bool>(entry >> mempool.m_chunkPayloadSize >> mempool.m_numberOfChunks
+                                        >> mempool.m_maxUsedChunks >> mempool.m_allocationFailures);
+            if (isValid)
+            {
+                profile.back().m_mempools.push_back(mempool);
+            }
+        }
+        else if (key == REQUESTS_KEY)
+        {
+            SegmentProfile::RequestCount request;
+            isValid = static_cast<bool>(entry >> request.m_maxChunkPayloadSize >> request.m_count);
+            if (isValid)
+            {
+                profile.back().m_requests.push_back(request);
+            }
+        }
+        else if (key == TOO_LARGE_REQUESTS_KEY)
+        {
+            isValid = static_cast<bool>(entry >> profile.back().m_tooLargeRequests);
+        }
+
+        if (!isValid)
+        {
+            return cxx::error<MemPoolProfileError>(MemPoolProfileError::INVALID_LINE);
+        }
+    }
+
+    return cxx::success<SegmentProfiles_t>(std::move(profile));
+}
+
+} // namespace roudi
+} // namespace iox
@@ -63,7 +63,7 @@ PortManager::PortManager(RouDiMemoryInterface* roudiMemoryInterface) noexcept
     auto introspectionMemoryManager = maybeIntrospectionMemoryManager.value();
 
     popo::PublisherOptions registryPortOptions;
-    registryPortOptions.historyCapacity = 1U;
+    registryPortOptions.historyCapacity = SERVICE_REGISTRY_SNAPSHOT_INTERVAL;
     registryPortOptions.nodeName = iox::NodeName_t("Service Registry");
     registryPortOptions.offerOnCreate = true;
 
@@ -116,6 +116,12 @@ void PortManager::doDiscovery() noexcept
     handleNodes();
 
     handleConditionVariables();
+
+    if (m_isServiceRegistrySnapshotRequired)
+    {
+        // retry if the last update of the service registry could not be published
+        publishServiceRegistrySnapshot();
+    }
 }
 
 void PortManager::handlePublisherPorts() noexcept
@@ -219,6 +225,9 @@ void PortManager::destroyClientPort(popo::ClientPortData* const clientPortData)
     popo::ClientPortRouDi clientPortRoudi(*clientPortData);
     popo::ClientPortUser clientPortUser(*clientPortData);
 
+    // the port is not used by its process anymore, a sender which terminated while delivering a request must not block
+    // the DISCONNECT
+    clientPortRoudi.closeAbandonedFastPath();
     clientPortUser.disconnect();
 
     // process DISCONNECT for this client in RouDi and distribute it
@@ -237,6 +246,7 @@ void PortManager::destroyClientPort(popo::ClientPortData* const clientPortData)
                << "' and with service description '" << clientPortData->m_serviceDescription << "'";
 
     // delete client port from list after DISCONNECT was processed
+    m_clientPortIndex.remove(clientPortData);
     m_portPool->removeClientPort(clientPortData);
 }
 
@@ -305,6 +315,9 @@ void PortManager::destroyServerPort(popo::ServerPortData* const serverPortData)
     popo::ServerPortRouDi serverPortRoudi{*serverPortData};
     popo::ServerPortUser serverPortUser{*serverPortData};
 
+    // the port is not used by its process anymore, a sender which terminated while delivering a response must not block
+    // the STOP_OFFER
+    serverPortRoudi.closeAbandonedFastPath();
     serverPortUser.stopOffer();
 
     // process STOP_OFFER for this server in RouDi and distribute it
@@ -326,6 +339,7 @@ void PortManager::destroyServerPort(popo::ServerPortData* const serverPortData)
                << "' and with service description '" << serverPortData->m_serviceDescription << "'";
 
     // delete server port from list after STOP_OFFER was processed
+    m_serverPortIndex.remove(serverPortData);
     m_portPool->removeServerPort(serverPortData);
 }
 
@@ -498,18 +512,19 @@ bool PortManager::sendToAllMatchingPublisherPorts(const capro::CaproMessage& mes
                                                   SubscriberPortType& subscriberSource) noexcept
 {
     bool publisherFound = false;
-    for (auto publisherPortData : m_portPool->getPublisherPortDataList())
-    {
+    // only the publishers with the service description of the subscriber are considered
+    m_publisherPortIndex.forEach(subscriberSource.getCaProServiceDescription(), [&](auto publisherPortData) {
         PublisherPortRouDiType publisherPort(publisherPortData);
 
         auto messageInterface = message.m_serviceDescription.getSourceInterface();
         auto publisherInterface = publisherPort.getCaProServiceDescription().getSourceInterface();
 
         // internal publisher receive all messages all other publishers receive only messages if
-        // they do not have the same interface otherwise we have cyclic connections in gateways
+        // they do not have the same interface otherwise we have cyclic connections in gateways; the other
+        // publishers of the service are still matched
         if (publisherInterface != capro::Interfaces::INTERNAL && publisherInterface == messageInterface)
         {
-            break;
+            return;
         }
 
         if (isCompatiblePubSub(publisherPort, subscriberSource))
@@ -529,25 +544,26 @@ bool PortManager::sendToAllMatchingPublisherPorts(const capro::CaproMessage& mes
             }
             publisherFound = true;
         }
-    }
+    });
     return publisherFound;
 }
 
 void PortManager::sendToAllMatchingSubscriberPorts(const capro::CaproMessage& message,
                                                    PublisherPortRouDiType& publisherSource) noexcept
 {
-    for (auto subscriberPortData : m_portPool->getSubscriberPortDataList())
-    {
+    // only the subscribers with the service description of the publisher are considered
+    m_subscriberPortIndex.forEach(publisherSource.getCaProServiceDescription(), [&](auto subscriberPortData) {
         SubscriberPortType subscriberPort(subscriberPortData);
 
         auto messageInterface = message.m_serviceDescription.getSourceInterface();
         auto subscriberInterface = subscriberPort.getCaProServiceDescription().getSourceInterface();
 
         // internal subscriber receive all messages all other subscribers receive only messages if
-        // they do not have the same interface otherwise we have cyclic connections in gateways
+        // they do not have the same interface otherwise we have cyclic connections in gateways; the other
+        // subscribers of the service are still matched
         if (subscriberInterface != capro::Interfaces::INTERNAL && subscriberInterface == messageInterface)
         {
-            break;
+            return;
         }
 
         if (isCompatiblePubSub(publisherSource, subscriberPort))
@@ -579,7 +595,7 @@ void PortManager::sendToAllMatchingSubscriberPorts(const capro::CaproMessage& me
                 }
             }
         }
-    }
+    });
 }
 
 bool PortManager::isCompatibleClientServer(const popo::ServerPortRouDi& server,
@@ -602,8 +618,8 @@ bool PortManager::isCompatibleClientServer(const popo::ServerPortRouDi& server,
 void PortManager::sendToAllMatchingClientPorts(const capro::CaproMessage& message,
                                                popo::ServerPortRouDi& serverSource) noexcept
 {
-    for (auto clientPortData : m_portPool->getClientPortDataList())
-    {
+    // only the clients with the service description of the server are considered
+    m_clientPortIndex.forEach(serverSource.getCaProServiceDescription(), [&](auto clientPortData) {
         popo::ClientPortRouDi clientPort(*clientPortData);
         if (isCompatibleClientServer(serverSource, clientPort))
         {
@@ -632,15 +648,15 @@ void PortManager::sendToAllMatchingClientPorts(const capro::CaproMessage& messag
                 }
             }
         }
-    }
+    });
 }
 
 bool PortManager::sendToAllMatchingServerPorts(const capro::CaproMessage& message,
                                                popo::ClientPortRouDi& clientSource) noexcept
 {
     bool serverFound = false;
-    for (auto serverPortData : m_portPool->getServerPortDataList())
-    {
+    // only the servers with the service description of the client are considered
+    m_serverPortIndex.forEach(clientSource.getCaProServiceDescription(), [&](auto serverPortData) {
         popo::ServerPortRouDi serverPort(*serverPortData);
         if (isCompatibleClientServer(serverPort, clientSource))
         {
@@ -660,7 +676,7 @@ bool PortManager::sendToAllMatchingServerPorts(const capro::CaproMessage& messag
             }
             serverFound = true;
         }
-    }
+    });
     return serverFound;
 }
 
@@ -718,6 +734,37 @@ void PortManager::makeAllPublisherPortsToStopOffer() noexcept
     }
 }
 
+void PortManager::forEachChunkSenderOfProcess(
+    const RuntimeName_t& runtimeName, const cxx::function_ref<void(const popo::UniquePortId)> callable) noexcept
+{
+    for (auto port : m_portPool->getPublisherPortDataList())
+    {
+        PublisherPortRouDiType publisher(port);
+        if (runtimeName == publisher.getRuntimeName())
+        {
+            callable(publisher.getUniqueID());
+        }
+    }
+
+    for (auto port : m_portPool->getServerPortDataList())
+    {
+        popo::ServerPortRouDi server(*port);
+        if (runtimeName == server.getRuntimeName())
+        {
+            callable(server.getUniqueID());
+        }
+    }
+
+    for (auto port : m_portPool->getClientPortDataList())
+    {
+        popo::ClientPortRouDi client(*port);
+        if (runtimeName == client.getRuntimeName())
+        {
+            callable(client.getUniqueID());
+        }
+    }
+}
+
 void PortManager::deletePortsOfProcess(const RuntimeName_t& runtimeName) noexcept
 {
     // If we delete all ports from RouDi we need to reset the service registry publisher
@@ -796,6 +843,9 @@ void PortManager::destroyPublisherPort(PublisherPortRouDiType::MemberType_t* con
     PublisherPortRouDiType publisherPortRoudi{publisherPortData};
     PublisherPortUserType publisherPortUser{publisherPortData};
 
+    // the port is not used by its process anymore, a sender which terminated while delivering a chunk must not block
+    // the STOP_OFFER
+    publisherPortRoudi.closeAbandonedFastPath();
     publisherPortUser.stopOffer();
 
     // process STOP_OFFER for this publisher in RouDi and distribute it
@@ -815,6 +865,7 @@ void PortManager::destroyPublisherPort(PublisherPortRouDiType::MemberType_t* con
     LogDebug() << "Destroy publisher port from runtime '" << publisherPortData->m_runtimeName
                << "' and with service description '" << publisherPortData->m_serviceDescription << "'";
     // delete publisher port from list after STOP_OFFER was processed
+    m_publisherPortIndex.remove(publisherPortData);
     m_portPool->removePublisherPort(publisherPortData);
 }
 
@@ -841,6 +892,7 @@ void PortManager::destroySubscriberPort(SubscriberPortType::MemberType_t* const
     LogDebug() << "Destroy subscriber port from runtime '" << subscriberPortData->m_runtimeName
                << "' and with service description '" << subscriberPortData->m_serviceDescription << "'";
     // delete subscriber port from list after UNSUB was processed
+    m_subscriberPortIndex.remove(subscriberPortData);
     m_portPool->removeSubscriberPort(subscriberPortData);
 }
 
@@ -897,6 +949,7 @@ PortManager::acquirePublisherPortDataWithoutDiscovery(const capro::ServiceDescri
         auto publisherPortData = maybePublisherPortData.value();
         if (publisherPortData)
         {
+            m_publisherPortIndex.add(publisherPortData);
             m_portIntrospection.addPublisher(*publisherPortData);
         }
     }
@@ -950,6 +1003,7 @@ PortManager::acquireSubscriberPortData(const capro::ServiceDescription& service,
         auto subscriberPortData = maybeSubscriberPortData.value();
         if (subscriberPortData)
         {
+            m_subscriberPortIndex.add(subscriberPortData);
             m_portIntrospection.addSubscriber(*subscriberPortData);
 
             // we do discovery here for trying to connect with publishers if subscribe on create is desired
@@ -972,6 +1026,7 @@ PortManager::acquireClientPortData(const capro::ServiceDescription& service,
     return m_portPool
         ->addClientPort(service, payloadDataSegmentMemoryManager, runtimeName, clientOptions, portConfigInfo.memoryInfo)
         .and_then([this](auto clientPortData) {
+            m_clientPortIndex.add(clientPortData);
             /// @todo iox-#1128 add to port introspection
 
             // we do discovery here for trying to connect the client if offer on create is desired
@@ -1011,6 +1066,7 @@ PortManager::acquireServerPortData(const capro::ServiceDescription& service,
     return m_portPool
         ->addServerPort(service, payloadDataSegmentMemoryManager, runtimeName, serverOptions, portConfigInfo.memoryInfo)
         .and_then([this](auto serverPortData) {
+            m_serverPortIndex.add(serverPortData);
             /// @todo iox-#1128 add to port introspection
 
             // we do discovery here for trying to connect the waiting client if offer on create is desired
@@ -1035,8 +1091,15 @@ popo::InterfacePortData* PortManager::acquireInterfacePortData(capro::Interfaces
     }
 }
 
-void PortManager::publishServiceRegistry() const noexcept
+void PortManager::publishServiceRegistryChange(const ServiceRegistryUpdate::Type type,
+                                               const capro::ServiceDescription& service) noexcept
 {
+    if (m_isServiceRegistrySnapshotRequired || (m_serviceRegistryVersion % SERVICE_REGISTRY_SNAPSHOT_INTERVAL == 0U))
+    {
+        publishServiceRegistrySnapshot();
+        return;
+    }
+
     if (!m_serviceRegistryPublisherPortData.has_value())
     {
         // should not happen (except during RouDi shutdown)
@@ -1046,19 +1109,48 @@ void PortManager::publishServiceRegistry() const noexcept
     }
     PublisherPortUserType publisher(m_serviceRegistryPublisherPortData.value());
     publisher
-        .tryAllocateChunk(sizeof(ServiceRegistry),
-                          alignof(ServiceRegistry),
+        .tryAllocateChunk(static_cast<uint32_t>(ServiceRegistryUpdate::requiredSize(1U)),
+                          alignof(ServiceRegistryUpdate),
                           CHUNK_NO_USER_HEADER_SIZE,
                           CHUNK_NO_USER_HEADER_ALIGNMENT)
         .and_then([&](auto& chunk) {
-            auto sample = static_cast<ServiceRegistry*>(chunk->userPayload());
-
-            // It's ok to copy as the modifications happen in the same thread and not concurrently
-            *sample = m_serviceRegistry;
+            ServiceRegistryUpdate::createChange(chunk->userPayload(), m_serviceRegistryVersion, type, service);
+            publisher.sendChunk(chunk);
+            ++m_serviceRegistryVersion;
+        })
+        .or_else([&](auto&) {
+            // the consumers would miss the change, the next update has to be a snapshot
+            m_isServiceRegistrySnapshotRequired = true;
+            LogWarn() << "Could not allocate a chunk for the service registry change!";
+        });
+}
 
+void PortManager::publishServiceRegistrySnapshot() noexcept
+{
+    if (!m_serviceRegistryPublisherPortData.has_value())
+    {
+        // should not happen (except during RouDi shutdown)
+        // the port always exists, otherwise we would terminate during startup
+        LogWarn() << "Could not publish service registry!";
+        return;
+    }
+    PublisherPortUserType publisher(m_serviceRegistryPublisherPortData.value());
+    publisher
+        .tryAllocateChunk(static_cast<uint32_t>(ServiceRegistryUpdate::requiredSnapshotSize(m_serviceRegistry)),
+                          alignof(ServiceRegistryUpdate),
+                          CHUNK_NO_USER_HEADER_SIZE,
+                          CHUNK_NO_USER_HEADER_ALIGNMENT)
+        .and_then([&](auto& chunk) {
+            // It's ok to read the registry as the modifications happen in the same thread and not concurrently
+            ServiceRegistryUpdate::createSnapshot(chunk->userPayload(), m_serviceRegistryVersion, m_serviceRegistry);
             publisher.sendChunk(chunk);
+            ++m_serviceRegistryVersion;
+            m_isServiceRegistrySnapshotRequired = false;
         })
-        .or_else([](auto&) { LogWarn() << "Could not allocate a chunk for the service registry!"; });
+        .or_else([&](auto&) {
+            m_isServiceRegistrySnapshotRequired = true;
+            LogWarn() << "Could not allocate a chunk for the service registry snapshot!";
+        });
 }
 
 const ServiceRegistry& PortManager::serviceRegistry() const noexcept
@@ -1068,32 +1160,34 @@ const ServiceRegistry& PortManager::serviceRegistry() const noexcept
 
 void PortManager::addPublisherToServiceRegistry(const capro::ServiceDescription& service) noexcept
 {
-    m_serviceRegistry.addPublisher(service).or_else([&](auto&) {
-        LogWarn() << "Could not add publisher with service description '" << service << "' to service registry!";
-        errorHandler(PoshError::POSH__PORT_MANAGER_COULD_NOT_ADD_SERVICE_TO_REGISTRY, ErrorLevel::MODERATE);
-    });
-    publishServiceRegistry();
+    m_serviceRegistry.addPublisher(service)
+        .and_then([&] { publishServiceRegistryChange(ServiceRegistryUpdate::Type::ADD_PUBLISHER, service); })
+        .or_else([&](auto&) {
+            LogWarn() << "Could not add publisher with service description '" << service << "' to service registry!";
+            errorHandler(PoshError::POSH__PORT_MANAGER_COULD_NOT_ADD_SERVICE_TO_REGISTRY, ErrorLevel::MODERATE);
+        });
 }
 
 void PortManager::removePublisherFromServiceRegistry(const capro::ServiceDescription& service) noexcept
 {
     m_serviceRegistry.removePublisher(service);
-    publishServiceRegistry();
+    publishServiceRegistryChange(ServiceRegistryUpdate::Type::REMOVE_PUBLISHER, service);
 }
 
 void PortManager::addServerToServiceRegistry(const capro::ServiceDescription& service) noexcept
 {
-    m_serviceRegistry.addServer(service).or_else([&](auto&) {
-        LogWarn() << "Could not add server with service description '" << service << "' to service registry!";
-        errorHandler(PoshError::POSH__PORT_MANAGER_COULD_NOT_ADD_SERVICE_TO_REGISTRY, ErrorLevel::MODERATE);
-    });
-    publishServiceRegistry();
+    m_serviceRegistry.addServer(service)
+        .and_then([&] { publishServiceRegistryChange(ServiceRegistryUpdate::Type::ADD_SERVER, service); })
+        .or_else([&](auto&) {
+            LogWarn() << "Could not add server with service description '" << service << "' to service registry!";
+            errorHandler(PoshError::POSH__PORT_MANAGER_COULD_NOT_ADD_SERVICE_TO_REGISTRY, ErrorLevel::MODERATE);
+        });
 }
 
 void PortManager::removeServerFromServiceRegistry(const capro::ServiceDescription& service) noexcept
 {
     m_serviceRegistry.removeServer(service);
-    publishServiceRegistry();
+    publishServiceRegistryChange(ServiceRegistryUpdate::Type::REMOVE_SERVER, service);
 }
 
 cxx::expected<runtime::NodeData*, PortPoolError> PortManager::acquireNodeData(const RuntimeName_t& runtimeName,
@@ -1108,6 +1202,24 @@ PortManager::acquireConditionVariableData(const RuntimeName_t& runtimeName) noex
     return m_portPool->addConditionVariableData(runtimeName);
 }
 
+cxx::expected<runtime::RuntimeRequestChannelData*, PortPoolError>
+PortManager::acquireRuntimeRequestChannelData(const RuntimeName_t& runtimeName) noexcept
+{
+    return m_portPool->addRuntimeRequestChannelData(runtimeName);
+}
+
+void PortManager::releaseRuntimeRequestChannelData(
+    const runtime::RuntimeRequestChannelData* const requestChannelData) noexcept
+{
+    LogDebug() << "Deleted runtime request channel of application " << requestChannelData->m_runtimeName;
+    m_portPool->removeRuntimeRequestChannelData(requestChannelData);
+}
+
+concurrent::FutexEvent& PortManager::runtimeRequestDoorbell() noexcept
+{
+    return m_portPool->runtimeRequestDoorbell();
+}
+
 bool PortManager::isInternal(const capro::ServiceDescription& service) const noexcept
 {
     for (auto& internalService : m_internalServices)
@@ -44,6 +44,12 @@ PortPool::getConditionVariableDataList() noexcept
     return m_portPoolData->m_conditionVariableMembers.content();
 }
 
+cxx::vector<runtime::RuntimeRequestChannelData*, MAX_PROCESS_NUMBER>
+PortPool::getRuntimeRequestChannelDataList() noexcept
+{
+    return m_portPoolData->m_runtimeRequestChannelMembers.content();
+}
+
 cxx::expected<popo::InterfacePortData*, PortPoolError>
 PortPool::addInterfacePort(const RuntimeName_t& runtimeName, const capro::Interfaces interface) noexcept
 {
@@ -94,6 +100,28 @@ PortPool::addConditionVariableData(const RuntimeName_t& runtimeName) noexcept
     }
 }
 
+cxx::expected<runtime::RuntimeRequestChannelData*, PortPoolError>
+PortPool::addRuntimeRequestChannelData(const RuntimeName_t& runtimeName) noexcept
+{
+    if (m_portPoolData->m_runtimeRequestChannelMembers.hasFreeSpace())
+    {
+        auto requestChannelData = m_portPoolData->m_runtimeRequestChannelMembers.insert(
+            runtimeName, m_portPoolData->m_runtimeRequestDoorbell);
+        return cxx::success<runtime::RuntimeRequestChannelData*>(requestChannelData);
+    }
+    else
+    {
+        LogWarn() << "Out of runtime request channels! Requested by runtime '" << runtimeName << "'";
+        errorHandler(PoshError::PORT_POOL__RUNTIME_REQUEST_CHANNEL_LIST_OVERFLOW, ErrorLevel::MODERATE);
+        return cxx::error<PortPoolError>(PortPoolError::RUNTIME_REQUEST_CHANNEL_LIST_FULL);
+    }
+}
+
+concurrent::FutexEvent& PortPool::runtimeRequestDoorbell() noexcept
+{
+    return m_portPoolData->m_runtimeRequestDoorbell;
+}
+
 void PortPool::removeInterfacePort(const popo::InterfacePortData* const portData) noexcept
 {
     m_portPoolData->m_interfacePortMembers.erase(portData);
@@ -109,6 +137,12 @@ void PortPool::removeConditionVariableData(const popo::ConditionVariableData* co
     m_portPoolData->m_conditionVariableMembers.erase(conditionVariableData);
 }
 
+void PortPool::removeRuntimeRequestChannelData(
+    const runtime::RuntimeRequestChannelData* const requestChannelData) noexcept
+{
+    m_portPoolData->m_runtimeRequestChannelMembers.erase(requestChannelData);
+}
+
 cxx::vector<PublisherPortRouDiType::MemberType_t*, MAX_PUBLISHERS> PortPool::getPublisherPortDataList() noexcept
 {
     return m_portPoolData->m_publisherPortMembers.content();
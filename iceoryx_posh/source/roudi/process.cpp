@@ -16,7 +16,9 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/roudi/process.hpp"
+#include "iceoryx_hoofs/platform/pidfd.hpp"
 #include "iceoryx_hoofs/platform/types.hpp"
+#include "iceoryx_hoofs/posix_wrapper/posix_call.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
 
@@ -29,14 +31,49 @@ Process::Process(const RuntimeName_t& name,
                  const uint32_t pid,
                  const posix::PosixUser& user,
                  const bool isMonitored,
-                 const uint64_t sessionId) noexcept
+                 const uint64_t sessionId,
+                 runtime::RuntimeRequestChannelData* const requestChannelData) noexcept
     : m_pid(pid)
     , m_ipcChannel(name)
+    , m_requestChannelData(requestChannelData)
     , m_timestamp(mepoo::BaseClock_t::now())
     , m_user(user)
     , m_isMonitored(isMonitored)
     , m_sessionId(sessionId)
 {
+    if (requestChannelData != nullptr)
+    {
+        m_requestChannel.emplace(*requestChannelData);
+    }
+
+    if (m_isMonitored)
+    {
+        // a process which has already terminated or a platform without process file descriptors is covered by the keep
+        // alive timeout
+        posix::posixCall(iox_pidfd_open)(static_cast<pid_t>(m_pid))
+            .failureReturnValue(INVALID_PID_FILE_DESCRIPTOR)
+            .suppressErrorMessagesForErrnos(ESRCH, ENOSYS)
+            .evaluate()
+            .and_then([this](auto& r) { m_pidFileDescriptor = r.value; })
+            .or_else([this](auto& r) {
+                if (r.errnum != ESRCH && r.errnum != ENOSYS)
+                {
+                    LogWarn() << "Unable to acquire the process file descriptor of '" << getName()
+                              << "'; its termination is detected by the keep alive timeout";
+                }
+            });
+    }
+}
+
+Process::~Process() noexcept
+{
+    if (m_pidFileDescriptor != INVALID_PID_FILE_DESCRIPTOR)
+    {
+        posix::posixCall(iox_pidfd_close)(m_pidFileDescriptor)
+            .failureReturnValue(INVALID_PID_FILE_DESCRIPTOR)
+            .evaluate()
+            .or_else([](auto&) { LogWarn() << "Unable to close the process file descriptor"; });
+    }
 }
 
 uint32_t Process::getPid() const noexcept
@@ -51,6 +88,17 @@ const RuntimeName_t Process::getName() const noexcept
 
 void Process::sendViaIpcChannel(const runtime::IpcMessage& data) noexcept
 {
+    if (m_requestChannel.has_value() && m_requestChannel->isRequestInProgress())
+    {
+        if (!m_requestChannel->sendResponse(data))
+        {
+            LogWarn() << "Process cannot send response over request channel, message size exceeds "
+                      << runtime::RuntimeRequestChannelData::MAX_MESSAGE_SIZE << " bytes";
+            errorHandler(PoshError::POSH__ROUDI_PROCESS_SEND_VIA_IPC_CHANNEL_FAILED, ErrorLevel::MODERATE);
+        }
+        return;
+    }
+
     bool sendSuccess = m_ipcChannel.send(data);
     if (!sendSuccess)
     {
@@ -59,6 +107,20 @@ void Process::sendViaIpcChannel(const runtime::IpcMessage& data) noexcept
     }
 }
 
+cxx::optional<runtime::IpcMessage> Process::takePendingRequest() noexcept
+{
+    if (!m_requestChannel.has_value())
+    {
+        return cxx::nullopt;
+    }
+    return m_requestChannel->takeRequest();
+}
+
+runtime::RuntimeRequestChannelData* Process::getRequestChannelData() const noexcept
+{
+    return m_requestChannelData;
+}
+
 uint64_t Process::getSessionId() noexcept
 {
     return m_sessionId.load(std::memory_order_relaxed);
@@ -84,5 +146,29 @@ bool Process::isMonitored() const noexcept
     return m_isMonitored;
 }
 
+cxx::optional<int32_t> Process::getPidFileDescriptor() const noexcept
+{
+    if (m_pidFileDescriptor == INVALID_PID_FILE_DESCRIPTOR)
+    {
+        return cxx::nullopt;
+    }
+    return m_pidFileDescriptor;
+}
+
+bool Process::hasTerminated() const noexcept
+{
+    if (m_pidFileDescriptor == INVALID_PID_FILE_DESCRIPTOR)
+    {
+        return false;
+    }
+
+    bool hasTerminated{false};
+    posix::posixCall(iox_pidfd_has_exited)(m_pidFileDescriptor)
+        .failureReturnValue(INVALID_PID_FILE_DESCRIPTOR)
+        .evaluate()
+        .and_then([&](auto& r) { hasTerminated = (r.value == 1); });
+    return hasTerminated;
+}
+
 } // namespace roudi
 } // namespace iox
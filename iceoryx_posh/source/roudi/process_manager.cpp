@@ -39,12 +39,30 @@ namespace iox
 {
 namespace roudi
 {
+namespace
+{
+/// @brief checks with the null signal whether the process has terminated, a process which cannot be checked is
+/// considered to be running
+bool hasProcessTerminated(const uint32_t pid) noexcept
+{
+    static constexpr int32_t ERROR_CODE = -1;
+    static constexpr int NULL_SIGNAL = 0;
+    auto checkResult = posix::posixCall(kill)(static_cast<pid_t>(pid), NULL_SIGNAL)
+                           .failureReturnValue(ERROR_CODE)
+                           .ignoreErrnos(ESRCH, EPERM)
+                           .evaluate();
+    return !checkResult.has_error() && checkResult->errnum == ESRCH;
+}
+} // namespace
+
 ProcessManager::ProcessManager(RouDiMemoryInterface& roudiMemoryInterface,
                                PortManager& portManager,
-                               const version::CompatibilityCheckLevel compatibilityCheckLevel) noexcept
+                               const version::CompatibilityCheckLevel compatibilityCheckLevel,
+                               ProcessTerminationMonitor* const processTerminationMonitor) noexcept
     : m_roudiMemoryInterface(roudiMemoryInterface)
     , m_portManager(portManager)
     , m_compatibilityCheckLevel(compatibilityCheckLevel)
+    , m_processTerminationMonitor(processTerminationMonitor)
 {
     bool fatalError{false};
 
@@ -134,6 +152,7 @@ void ProcessManager::printWarningForRegisteredProcessesAndClearProcessList() noe
                   << "' is still running after SIGKILL was sent. RouDi is ignoring this process.";
     }
     m_processList.clear();
+    m_processIndex.clear();
 }
 
 bool ProcessManager::requestShutdownOfProcess(Process& process, ShutdownPolicy shutdownPolicy) noexcept
@@ -259,7 +278,25 @@ bool ProcessManager::addProcess(const RuntimeName_t& name,
         LogError() << "Could not register process '" << name << "' - too many processes";
         return false;
     }
-    m_processList.emplace_back(name, pid, user, isMonitored, sessionId);
+    // without a request channel the process falls back to the IPC channel for its requests
+    runtime::RuntimeRequestChannelData* requestChannelData{nullptr};
+    auto requestChannelOffset = rp::BaseRelativePointer::NULL_POINTER_OFFSET;
+    m_portManager.acquireRuntimeRequestChannelData(name).and_then([&](auto& data) {
+        requestChannelData = data;
+        requestChannelOffset =
+            rp::BaseRelativePointer::getOffset(rp::BaseRelativePointer::id_t{m_mgmtSegmentId}, requestChannelData);
+    });
+
+    auto processIter =
+        m_processList.emplace(m_processList.cend(), name, pid, user, isMonitored, sessionId, requestChannelData);
+    // the index has the capacity of the process list, therefore adding the process cannot fail
+    IOX_DISCARD_RESULT(m_processIndex.add(std::hash<RuntimeName_t>()(name), processIter));
+
+    if (m_processTerminationMonitor != nullptr)
+    {
+        processIter->getPidFileDescriptor().and_then(
+            [&](auto& pidFileDescriptor) { m_processTerminationMonitor->add(pidFileDescriptor); });
+    }
 
     // send REG_ACK and BaseAddrString
     runtime::IpcMessage sendBuffer;
@@ -268,7 +305,7 @@ bool ProcessManager::addProcess(const RuntimeName_t& name,
     auto offset = rp::BaseRelativePointer::getOffset(rp::BaseRelativePointer::id_t{m_mgmtSegmentId}, m_segmentManager);
     sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::REG_ACK)
                << m_roudiMemoryInterface.mgmtMemoryProvider()->size() << offset << transmissionTimestamp
-               << m_mgmtSegmentId << sendKeepAlive;
+               << m_mgmtSegmentId << sendKeepAlive << requestChannelOffset;
 
     m_processList.back().sendViaIpcChannel(sendBuffer);
 
@@ -294,22 +331,18 @@ bool ProcessManager::unregisterProcess(const RuntimeName_t& name) noexcept
 
 bool ProcessManager::searchForProcessAndRemoveIt(const RuntimeName_t& name, const TerminationFeedback feedback) noexcept
 {
-    // we need to search for the process (currently linear search)
-    auto it = m_processList.begin();
-    while (it != m_processList.end())
+    auto entry = findInProcessIndex(name);
+    if (!entry.has_value())
     {
-        auto otherName = it->getName();
-        if (name == otherName)
-        {
-            if (removeProcessAndDeleteRespectiveSharedMemoryObjects(it, feedback))
-            {
-                LogDebug() << "Removed existing application " << name;
-            }
-            return true; // we can assume there are no other processes with this name
-        }
-        ++it;
+        return false;
     }
-    return false;
+
+    auto it = entry.value();
+    if (removeProcessAndDeleteRespectiveSharedMemoryObjects(it, feedback))
+    {
+        LogDebug() << "Removed existing application " << name;
+    }
+    return true;
 }
 
 bool ProcessManager::removeProcessAndDeleteRespectiveSharedMemoryObjects(ProcessList_t::iterator& processIter,
@@ -317,6 +350,7 @@ bool ProcessManager::removeProcessAndDeleteRespectiveSharedMemoryObjects(Process
 {
     if (processIter != m_processList.end())
     {
+        addLostChunkOwnersOfProcess(*processIter);
         m_portManager.deletePortsOfProcess(processIter->getName());
         m_processIntrospection->removeProcess(static_cast<int32_t>(processIter->getPid()));
 
@@ -327,7 +361,10 @@ bool ProcessManager::removeProcessAndDeleteRespectiveSharedMemoryObjects(Process
             sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::TERMINATION_ACK);
             processIter->sendViaIpcChannel(sendBuffer);
         }
+        // the TERMINATION_ACK may have been sent via the request channel, therefore it is released afterwards
+        releaseRequestChannelOfProcess(*processIter, feedback);
 
+        removeFromProcessIndex(processIter);
         processIter = m_processList.erase(processIter); // delete application
         return true;
     }
@@ -673,6 +710,76 @@ void ProcessManager::run() noexcept
 {
     monitorProcesses();
     discoveryUpdate();
+    reclaimLostChunks();
+    releasePendingRequestChannels();
+}
+
+uint64_t ProcessManager::getNumberOfReclaimedChunks() const noexcept
+{
+    return m_chunkReclaimer.getNumberOfReclaimedChunks();
+}
+
+void ProcessManager::addLostChunkOwnersOfProcess(const Process& process) noexcept
+{
+    // without a process file descriptor the termination is checked with the null signal
+    if (process.hasTerminated() || hasProcessTerminated(process.getPid()))
+    {
+        m_portManager.forEachChunkSenderOfProcess(
+            process.getName(), [this](const popo::UniquePortId owner) { m_chunkReclaimer.addLostOwner(owner); });
+    }
+}
+
+void ProcessManager::releaseRequestChannelOfProcess(const Process& process, const TerminationFeedback feedback) noexcept
+{
+    auto requestChannelData = process.getRequestChannelData();
+    if (requestChannelData == nullptr)
+    {
+        return;
+    }
+
+    // a process which is still running may access its request channel, either to take the TERMINATION_ACK or, when it
+    // was removed due to the keep alive timeout, with its next request
+    if (process.hasTerminated() || hasProcessTerminated(process.getPid()))
+    {
+        m_portManager.releaseRuntimeRequestChannelData(requestChannelData);
+        return;
+    }
+
+    // there is one pending release per request channel at most, therefore the capacity is sufficient
+    m_pendingRequestChannelReleases.emplace_back(PendingRequestChannelRelease{
+        requestChannelData, process.getPid(), feedback == TerminationFeedback::SEND_ACK_TO_PROCESS});
+}
+
+void ProcessManager::releasePendingRequestChannels() noexcept
+{
+    for (auto pending = m_pendingRequestChannelReleases.begin(); pending != m_pendingRequestChannelReleases.end();)
+    {
+        // after the runtime has taken the TERMINATION_ACK it does not use its request channel anymore
+        const bool isTerminationAckTaken =
+            pending->isTerminationAckSent
+            && !runtime::RuntimeRequestChannel(*pending->requestChannelData).isResponsePending();
+        if (isTerminationAckTaken || hasProcessTerminated(pending->pid))
+        {
+            m_portManager.releaseRuntimeRequestChannelData(pending->requestChannelData);
+            // the following elements are moved to the position of the erased one
+            m_pendingRequestChannelReleases.erase(pending);
+            continue;
+        }
+        ++pending;
+    }
+}
+
+void ProcessManager::reclaimLostChunks() noexcept
+{
+    if (!m_chunkReclaimer.isSweepPending())
+    {
+        return;
+    }
+
+    ChunkReclaimer::MemoryManagerList_t memoryManagers;
+    m_segmentManager->forEachSegment(
+        [&](mepoo::MePooSegment<>& segment) { memoryManagers.emplace_back(&segment.getMemoryManager()); });
+    m_chunkReclaimer.sweepStep(memoryManagers);
 }
 
 popo::PublisherPortData*
@@ -684,17 +791,40 @@ ProcessManager::addIntrospectionPublisherPort(const capro::ServiceDescription& s
     return m_portManager.acquireInternalPublisherPortData(service, options, m_introspectionMemoryManager);
 }
 
-cxx::optional<Process*> ProcessManager::findProcess(const RuntimeName_t& name) noexcept
+ProcessManager::RuntimeRequestList_t ProcessManager::takePendingRuntimeRequests() noexcept
 {
+    RuntimeRequestList_t requests;
     for (auto& process : m_processList)
     {
-        if (process.getName() == name)
-        {
-            return cxx::make_optional<Process*>(&process);
-        }
+        process.takePendingRequest().and_then(
+            [&](auto& message) { requests.emplace_back(RuntimeRequest{process.getName(), message}); });
     }
+    return requests;
+}
 
-    return cxx::nullopt;
+cxx::optional<Process*> ProcessManager::findProcess(const RuntimeName_t& name) noexcept
+{
+    auto entry = findInProcessIndex(name);
+    if (!entry.has_value())
+    {
+        return cxx::nullopt;
+    }
+    return cxx::make_optional<Process*>(&*entry.value());
+}
+
+cxx::optional<ProcessManager::ProcessList_t::iterator>
+ProcessManager::findInProcessIndex(const RuntimeName_t& name) noexcept
+{
+    return m_processIndex.find(std::hash<RuntimeName_t>()(name),
+                               [&](const ProcessList_t::iterator& process) { return process->getName() == name; });
+}
+
+void ProcessManager::removeFromProcessIndex(const ProcessList_t::iterator& processIter) noexcept
+{
+    IOX_DISCARD_RESULT(m_processIndex.remove(std::hash<RuntimeName_t>()(processIter->getName()),
+                                             [&](const ProcessList_t::iterator& process) {
+                                                 return process == processIter;
+                                             }));
 }
 
 void ProcessManager::monitorProcesses() noexcept
@@ -710,10 +840,21 @@ void ProcessManager::monitorProcesses() noexcept
 
             static_assert(runtime::PROCESS_KEEP_ALIVE_TIMEOUT > runtime::PROCESS_KEEP_ALIVE_INTERVAL,
                           "keep alive timeout too small");
-            if (timediff > runtime::PROCESS_KEEP_ALIVE_TIMEOUT)
+            // the process file descriptor detects a crash right away, the keep alive timeout is the fallback for
+            // platforms without process file descriptors and for hanging processes
+            const bool hasTerminated = processIterator->hasTerminated();
+            if (hasTerminated || timediff > runtime::PROCESS_KEEP_ALIVE_TIMEOUT)
             {
-                LogWarn() << "Application " << processIterator->getName() << " not responding (last response "
-                          << timediff.toMilliseconds() << " milliseconds ago) --> removing it";
+                if (hasTerminated)
+                {
+                    LogWarn() << "Application " << processIterator->getName()
+                              << " terminated without unregistering --> removing it";
+                }
+                else
+                {
+                    LogWarn() << "Application " << processIterator->getName() << " not responding (last response "
+                              << timediff.toMilliseconds() << " milliseconds ago) --> removing it";
+                }
 
                 // note: if we would want to use the removeProcess function, it would search for the process again
                 // (but we already found it and have an iterator to remove it)
@@ -721,11 +862,14 @@ void ProcessManager::monitorProcesses() noexcept
                 // delete all associated subscriber and publisher ports in shared
                 // memory and the associated RouDi discovery ports
                 // @todo Check if ShmManager and Process Manager end up in unintended condition
+                addLostChunkOwnersOfProcess(*processIterator);
                 m_portManager.deletePortsOfProcess(processIterator->getName());
+                releaseRequestChannelOfProcess(*processIterator, TerminationFeedback::DO_NOT_SEND_ACK_TO_PROCESS);
 
                 m_processIntrospection->removeProcess(static_cast<int32_t>(processIterator->getPid()));
 
                 // delete application
+                removeFromProcessIndex(processIterator);
                 processIterator = m_processList.erase(processIterator);
                 continue; // erase returns first element after the removed one --> skip iterator increment
             }
@@ -0,0 +1,103 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/internal/roudi/process_termination_monitor.hpp"
+#include "iceoryx_hoofs/platform/pidfd.hpp"
+#include "iceoryx_hoofs/posix_wrapper/posix_call.hpp"
+#include "iceoryx_posh/internal/log/posh_logging.hpp"
+
+#include <chrono>
+#include <thread>
+
+namespace iox
+{
+namespace roudi
+{
+ProcessTerminationMonitor::ProcessTerminationMonitor() noexcept
+{
+    posix::posixCall(iox_pidfd_set_create)()
+        .failureReturnValue(INVALID_FILE_DESCRIPTOR)
+        .suppressErrorMessagesForErrnos(ENOSYS)
+        .evaluate()
+        .and_then([this](auto& r) { m_pidFileDescriptorSet = r.value; })
+        .or_else([](auto& r) {
+            if (r.errnum == ENOSYS)
+            {
+                LogDebug() << "Process file descriptors are not supported; terminated processes are detected by the "
+                              "keep alive timeout";
+            }
+            else
+            {
+                LogWarn() << "Unable to create the set of process file descriptors; terminated processes are detected "
+                             "by the keep alive timeout";
+            }
+        });
+}
+
+ProcessTerminationMonitor::~ProcessTerminationMonitor() noexcept
+{
+    if (isAvailable())
+    {
+        posix::posixCall(iox_pidfd_close)(m_pidFileDescriptorSet)
+            .failureReturnValue(INVALID_FILE_DESCRIPTOR)
+            .evaluate()
+            .or_else([](auto&) { LogWarn() << "Unable to close the set of process file descriptors"; });
+    }
+}
+
+bool ProcessTerminationMonitor::isAvailable() const noexcept
+{
+    return m_pidFileDescriptorSet != INVALID_FILE_DESCRIPTOR;
+}
+
+bool ProcessTerminationMonitor::add(const int32_t pidFileDescriptor) noexcept
+{
+    if (!isAvailable() || pidFileDescriptor == INVALID_FILE_DESCRIPTOR)
+    {
+        return false;
+    }
+
+    return !posix::posixCall(iox_pidfd_set_add)(m_pidFileDescriptorSet, pidFileDescriptor)
+                .failureReturnValue(INVALID_FILE_DESCRIPTOR)
+                .evaluate()
+                .or_else([](auto&) { LogWarn() << "Unable to monitor the termination of a process"; })
+                .has_error();
+}
+
+bool ProcessTerminationMonitor::wait(const units::Duration timeout) noexcept
+{
+    if (!isAvailable())
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(timeout.toMilliseconds()));
+        return false;
+    }
+
+    bool hasProcessTerminated{false};
+    posix::posixCall(iox_pidfd_set_wait)(m_pidFileDescriptorSet, static_cast<int>(timeout.toMilliseconds()))
+        .failureReturnValue(INVALID_FILE_DESCRIPTOR)
+        .ignoreErrnos(EINTR)
+        .evaluate()
+        .and_then([&](auto& r) { hasProcessTerminated = (r.value > 0); })
+        .or_else([&](auto&) {
+            LogWarn() << "Unable to wait for terminated processes";
+            std::this_thread::sleep_for(std::chrono::milliseconds(timeout.toMilliseconds()));
+        });
+    return hasProcessTerminated;
+}
+
+} // namespace roudi
+} // namespace iox
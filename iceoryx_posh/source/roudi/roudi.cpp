@@ -21,12 +21,15 @@
 #include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
 #include "iceoryx_hoofs/posix_wrapper/thread.hpp"
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
+#include "iceoryx_posh/internal/roudi/mempool_profile.hpp"
 #include "iceoryx_posh/internal/runtime/node_property.hpp"
 #include "iceoryx_posh/popo/subscriber_options.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
 #include "iceoryx_posh/roudi/memory/roudi_memory_manager.hpp"
 #include "iceoryx_posh/runtime/port_config_info.hpp"
 
+#include <fstream>
+
 namespace iox
 {
 namespace roudi
@@ -42,7 +45,8 @@ RouDi::RouDi(RouDiMemoryInterface& roudiMemoryInterface,
     , m_prcMgr(concurrent::ForwardArgsToCTor,
                *m_roudiMemoryInterface,
                portManager,
-               roudiStartupParameters.m_compatibilityCheckLevel)
+               roudiStartupParameters.m_compatibilityCheckLevel,
+               &m_processTerminationMonitor)
     , m_mempoolIntrospection(
           *m_roudiMemoryInterface->introspectionMemoryManager()
                .value(), /// @todo create a RouDiMemoryManagerData struct with all the pointer
@@ -50,6 +54,7 @@ RouDi::RouDi(RouDiMemoryInterface& roudiMemoryInterface,
           PublisherPortUserType(m_prcMgr->addIntrospectionPublisherPort(IntrospectionMempoolService)))
     , m_monitoringMode(roudiStartupParameters.m_monitoringMode)
     , m_processKillDelay(roudiStartupParameters.m_processKillDelay)
+    , m_mempoolProfilePath(roudiStartupParameters.m_mempoolProfilePath)
 {
     if (cxx::isCompiledOn32BitSystem())
     {
@@ -83,6 +88,9 @@ void RouDi::startProcessRuntimeMessagesThread() noexcept
 {
     m_handleRuntimeMessageThread = std::thread(&RouDi::processRuntimeMessages, this);
     posix::setThreadName(m_handleRuntimeMessageThread.native_handle(), "IPC-msg-process");
+
+    m_handleRuntimeRequestChannelThread = std::thread(&RouDi::processRuntimeRequestChannels, this);
+    posix::setThreadName(m_handleRuntimeRequestChannelThread.native_handle(), "Shm-req-process");
 }
 
 void RouDi::shutdown() noexcept
@@ -141,6 +149,30 @@ void RouDi::shutdown() noexcept
         m_handleRuntimeMessageThread.join();
         LogDebug() << "...'IPC-msg-process' thread joined.";
     }
+
+    if (m_handleRuntimeRequestChannelThread.joinable())
+    {
+        LogDebug() << "Joining 'Shm-req-process' thread...";
+        m_handleRuntimeRequestChannelThread.join();
+        LogDebug() << "...'Shm-req-process' thread joined.";
+    }
+
+    if (!m_mempoolProfilePath.empty())
+    {
+        dumpMemPoolProfile();
+    }
+}
+
+void RouDi::dumpMemPoolProfile() noexcept
+{
+    std::ofstream profileFile(m_mempoolProfilePath.c_str());
+    if (!profileFile)
+    {
+        LogError() << "Unable to write the mempool profile to '" << m_mempoolProfilePath << "'";
+        return;
+    }
+    writeMemPoolProfile(profileFile, createMemPoolProfile(*m_roudiMemoryInterface->segmentManager().value()));
+    LogInfo() << "Mempool profile written to '" << m_mempoolProfilePath << "'";
 }
 
 void RouDi::cyclicUpdateHook() noexcept
@@ -154,9 +186,13 @@ void RouDi::monitorAndDiscoveryUpdate() noexcept
     {
         m_prcMgr->run();
 
+        m_roudiMemoryInterface->segmentManager().and_then(
+            [](auto& segmentManager) { segmentManager->growMemPools(); });
+
         cyclicUpdateHook();
 
-        std::this_thread::sleep_for(std::chrono::milliseconds(DISCOVERY_INTERVAL.toMilliseconds()));
+        // wakes up early when a monitored process terminates, therefore its resources are released right away
+        m_processTerminationMonitor.wait(DISCOVERY_INTERVAL);
     }
 }
 
@@ -181,6 +217,38 @@ void RouDi::processRuntimeMessages() noexcept
     }
 }
 
+void RouDi::processRuntimeRequestChannels() noexcept
+{
+    auto& doorbell = m_portManager->runtimeRequestDoorbell();
+    auto hasPendingRing = [&] {
+        auto result = doorbell.tryWait();
+        return !result.has_error() && result.value();
+    };
+
+    while (m_runHandleRuntimeMessageThread)
+    {
+        auto waitResult = doorbell.timedWait(m_runtimeMessagesThreadTimeout);
+        if (waitResult.has_error() || waitResult.value() == posix::SemaphoreWaitState::TIMEOUT)
+        {
+            continue;
+        }
+
+        // every runtime rings the doorbell once per request; since all pending requests are taken at once the
+        // remaining rings are consumed to prevent empty wakeups
+        while (hasPendingRing())
+        {
+        }
+
+        /// @todo processing the requests of independent processes concurrently requires finer-grained locking in the
+        /// PortPool, the PortManager and the service registry instead of the ProcessManager lock
+        for (const auto& request : m_prcMgr->takePendingRuntimeRequests())
+        {
+            auto cmd = runtime::stringToIpcMessageType(request.message.getElementAtIndex(0).c_str());
+            processMessage(request.message, cmd, request.runtimeName);
+        }
+    }
+}
+
 version::VersionInfo RouDi::parseRegisterMessage(const runtime::IpcMessage& message,
                                                  uint32_t& pid,
                                                  uid_t& userId,
@@ -467,7 +535,8 @@ void RouDi::registerProcess(const RuntimeName_t& name,
 
 uint64_t RouDi::getUniqueSessionIdForProcess() noexcept
 {
-    static uint64_t sessionId = 0;
+    // the runtime messages are processed concurrently by the IPC channel and the shared memory request channel threads
+    static std::atomic<uint64_t> sessionId{0U};
     return ++sessionId;
 }
 
@@ -36,10 +36,11 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
                                        {"unique-roudi-id", required_argument, nullptr, 'u'},
                                        {"compatibility", required_argument, nullptr, 'x'},
                                        {"kill-delay", required_argument, nullptr, 'k'},
+                                       {"mempool-profile", required_argument, nullptr, 'p'},
                                        {nullptr, 0, nullptr, 0}};
 
     // colon after shortOption means it requires an argument, two colons mean optional argument
-    constexpr const char* SHORT_OPTIONS = "hvm:l:u:x:k:";
+    constexpr const char* SHORT_OPTIONS = "hvm:l:u:x:k:p:";
     int32_t index;
     int32_t opt{-1};
     while ((opt = getopt_long(argc, argv, SHORT_OPTIONS, LONG_OPTIONS, &index), opt != -1))
@@ -72,6 +73,10 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
                       << std::endl;
             std::cout << "                                  have't responded after trying SIG_TERM first, in seconds."
                       << std::endl;
+            std::cout << "-p, --mempool-profile <FILE>      Writes the mempool usage profile to <FILE> on shutdown."
+                      << std::endl;
+            std::cout << "                                  Use iox-mempool-advisor to derive a config from it."
+                      << std::endl;
 
             m_run = false;
             break;
@@ -164,6 +169,11 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
             }
             break;
         }
+        case 'p':
+        {
+            m_mempoolProfilePath = roudi::ConfigFilePathString_t(cxx::TruncateToCapacity, optarg);
+            break;
+        }
         case 'x':
         {
             if (strcmp(optarg, "off") == 0)
@@ -217,7 +227,8 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
                                                      m_processKillDelay,
                                                      m_uniqueRouDiId,
                                                      m_run,
-                                                     iox::roudi::ConfigFilePathString_t("")});
+                                                     iox::roudi::ConfigFilePathString_t(""),
+                                                     m_mempoolProfilePath});
 } // namespace roudi
 } // namespace config
 } // namespace iox
@@ -90,7 +90,8 @@ cxx::expected<CmdLineArgs_t, CmdLineParserResult> CmdLineParserConfigFileOption:
                                                      m_processKillDelay,
                                                      m_uniqueRouDiId,
                                                      m_run,
-                                                     m_customConfigFilePath});
+                                                     m_customConfigFilePath,
+                                                     m_mempoolProfilePath});
 }
 
 } // namespace config
@@ -32,6 +32,53 @@ namespace iox
 {
 namespace config
 {
+namespace
+{
+/// @brief parses the NUMA placement with the keys "<prefix>numa-policy" and "<prefix>numa-nodes"
+/// @return the placement or nullopt if it is invalid
+cxx::optional<mepoo::NumaPlacement> parseNumaPlacement(const cpptoml::table& table, const std::string& prefix) noexcept
+{
+    auto policyName = table.get_as<std::string>(prefix + "numa-policy");
+    auto nodes = table.get_array_of<int64_t>(prefix + "numa-nodes");
+
+    mepoo::NumaPlacement placement;
+    if (!policyName && !nodes)
+    {
+        return placement;
+    }
+
+    // nodes without a policy are preferred
+    placement.m_policy = mepoo::NumaPolicy::PREFERRED;
+    if (policyName)
+    {
+        auto policy = mepoo::numaPolicyFromString(policyName->c_str());
+        if (!policy.has_value())
+        {
+            return cxx::nullopt;
+        }
+        placement.m_policy = policy.value();
+    }
+
+    if (nodes)
+    {
+        for (const auto node : *nodes)
+        {
+            if (node < 0 || node >= static_cast<int64_t>(MAX_NUMBER_OF_NUMA_NODES))
+            {
+                return cxx::nullopt;
+            }
+            placement.m_nodeMask |= 1ULL << static_cast<uint64_t>(node);
+        }
+    }
+
+    if (!placement.isValid())
+    {
+        return cxx::nullopt;
+    }
+    return placement;
+}
+} // namespace
+
 TomlRouDiConfigFileProvider::TomlRouDiConfigFileProvider(config::CmdLineArgs_t& cmdLineArgs) noexcept
 {
     /// don't print additional output if not running
@@ -97,6 +144,13 @@ TomlRouDiConfigFileProvider::parse() noexcept
             iox::roudi::RouDiConfigFileParseError::INVALID_CONFIG_FILE_VERSION);
     }
 
+    auto managementNumaPlacement = parseNumaPlacement(*general, "management-");
+    if (!managementNumaPlacement.has_value())
+    {
+        return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
+            iox::roudi::RouDiConfigFileParseError::INVALID_NUMA_PLACEMENT);
+    }
+
     auto segments = parsedFile->get_table_array("segment");
     if (!segments)
     {
@@ -111,10 +165,17 @@ TomlRouDiConfigFileProvider::parse() noexcept
     }
 
     iox::RouDiConfig_t parsedConfig;
+    parsedConfig.m_managementNumaPlacement = managementNumaPlacement.value();
     for (auto segment : *segments)
     {
         auto writer = segment->get_as<std::string>("writer").value_or(groupOfCurrentProcess);
         auto reader = segment->get_as<std::string>("reader").value_or(groupOfCurrentProcess);
+        auto numaPlacement = parseNumaPlacement(*segment, "");
+        if (!numaPlacement.has_value())
+        {
+            return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
+                iox::roudi::RouDiConfigFileParseError::INVALID_NUMA_PLACEMENT);
+        }
         iox::mepoo::MePooConfig mempoolConfig;
         auto mempools = segment->get_table_array("mempool");
         if (!mempools)
@@ -133,6 +194,8 @@ TomlRouDiConfigFileProvider::parse() noexcept
         {
             auto chunkSize = mempool->get_as<uint32_t>("size");
             auto chunkCount = mempool->get_as<uint32_t>("count");
+            auto extentChunkCount = mempool->get_as<uint32_t>("extent-count");
+            auto numaNode = mempool->get_as<uint32_t>("numa-node");
             if (!chunkSize)
             {
                 return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
@@ -143,12 +206,22 @@ TomlRouDiConfigFileProvider::parse() noexcept
                 return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
                     iox::roudi::RouDiConfigFileParseError::MEMPOOL_WITHOUT_CHUNK_COUNT);
             }
-            mempoolConfig.addMemPool({*chunkSize, *chunkCount});
+            if (numaNode && *numaNode >= iox::MAX_NUMBER_OF_NUMA_NODES)
+            {
+                return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
+                    iox::roudi::RouDiConfigFileParseError::INVALID_NUMA_PLACEMENT);
+            }
+            mempoolConfig.addMemPool({*chunkSize,
+                                      *chunkCount,
+                                      extentChunkCount ? *extentChunkCount : 0U,
+                                      numaNode ? *numaNode : iox::NO_NUMA_NODE});
         }
         parsedConfig.m_sharedMemorySegments.push_back(
             {iox::posix::PosixGroup::groupName_t(iox::cxx::TruncateToCapacity, reader),
              iox::posix::PosixGroup::groupName_t(iox::cxx::TruncateToCapacity, writer),
-             mempoolConfig});
+             mempoolConfig,
+             iox::mepoo::MemoryInfo(),
+             numaPlacement.value()});
     }
 
     return iox::cxx::success<iox::RouDiConfig_t>(parsedConfig);
@@ -138,6 +138,20 @@ void ServiceRegistry::purge(const capro::ServiceDescription& serviceDescription)
     }
 }
 
+void ServiceRegistry::restore(const ServiceDescriptionEntry* const entries, const uint32_t numberOfEntries) noexcept
+{
+    m_serviceDescriptions.clear();
+    m_freeIndex = NO_INDEX;
+
+    for (uint32_t i = 0U; i < numberOfEntries; ++i)
+    {
+        if (!m_serviceDescriptions.emplace_back(entries[i]))
+        {
+            break;
+        }
+    }
+}
+
 void ServiceRegistry::find(const cxx::optional<capro::IdString_t>& service,
                            const cxx::optional<capro::IdString_t>& instance,
                            const cxx::optional<capro::IdString_t>& event,
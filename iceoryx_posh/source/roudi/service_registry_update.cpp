@@ -0,0 +1,125 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/internal/roudi/service_registry_update.hpp"
+#include "iceoryx_hoofs/cxx/requires.hpp"
+#include "iceoryx_posh/internal/log/posh_logging.hpp"
+
+#include <new>
+
+namespace iox
+{
+namespace roudi
+{
+static_assert(sizeof(ServiceRegistryUpdate) % alignof(ServiceRegistryUpdate::Entry_t) == 0U,
+              "the entries must be aligned when stored behind the ServiceRegistryUpdate");
+static_assert(alignof(ServiceRegistryUpdate) >= alignof(ServiceRegistryUpdate::Entry_t),
+              "the alignment of the update must be sufficient for the entries");
+
+ServiceRegistryUpdate::ServiceRegistryUpdate(const uint64_t version,
+                                             const Type type,
+                                             const uint32_t numberOfEntries) noexcept
+    : m_version(version)
+    , m_type(type)
+    , m_numberOfEntries(numberOfEntries)
+{
+}
+
+uint64_t ServiceRegistryUpdate::requiredSnapshotSize(const ServiceRegistry& registry) noexcept
+{
+    uint32_t numberOfEntries{0U};
+    registry.forEach([&](const Entry_t&) { ++numberOfEntries; });
+    return requiredSize(numberOfEntries);
+}
+
+ServiceRegistryUpdate* ServiceRegistryUpdate::createSnapshot(void* const memory,
+                                                             const uint64_t version,
+                                                             const ServiceRegistry& registry) noexcept
+{
+    auto update = new (memory) ServiceRegistryUpdate(version, Type::SNAPSHOT, 0U);
+    auto entries = update->entries();
+    registry.forEach([&](const Entry_t& entry) {
+        new (&entries[update->m_numberOfEntries]) Entry_t(entry);
+        ++update->m_numberOfEntries;
+    });
+    return update;
+}
+
+ServiceRegistryUpdate* ServiceRegistryUpdate::createChange(void* const memory,
+                                                           const uint64_t version,
+                                                           const Type type,
+                                                           const capro::ServiceDescription& service) noexcept
+{
+    cxx::Expects(type != Type::SNAPSHOT);
+    auto update = new (memory) ServiceRegistryUpdate(version, type, 1U);
+    new (update->entries()) Entry_t(service);
+    return update;
+}
+
+uint64_t ServiceRegistryUpdate::version() const noexcept
+{
+    return m_version;
+}
+
+ServiceRegistryUpdate::Type ServiceRegistryUpdate::type() const noexcept
+{
+    return m_type;
+}
+
+uint32_t ServiceRegistryUpdate::numberOfEntries() const noexcept
+{
+    return m_numberOfEntries;
+}
+
+void ServiceRegistryUpdate::applyTo(ServiceRegistry& registry) const noexcept
+{
+    auto warnOnFullRegistry = [](auto&) {
+        LogWarn() << "Could not apply the service registry update since the registry is full!";
+    };
+
+    switch (m_type)
+    {
+    case Type::SNAPSHOT:
+        registry.restore(entries(), m_numberOfEntries);
+        break;
+    case Type::ADD_PUBLISHER:
+        registry.addPublisher(entries()->serviceDescription).or_else(warnOnFullRegistry);
+        break;
+    case Type::REMOVE_PUBLISHER:
+        registry.removePublisher(entries()->serviceDescription);
+        break;
+    case Type::ADD_SERVER:
+        registry.addServer(entries()->serviceDescription).or_else(warnOnFullRegistry);
+        break;
+    case Type::REMOVE_SERVER:
+        registry.removeServer(entries()->serviceDescription);
+        break;
+    }
+}
+
+ServiceRegistryUpdate::Entry_t* ServiceRegistryUpdate::entries() noexcept
+{
+    return reinterpret_cast<Entry_t*>(reinterpret_cast<uint8_t*>(this) + sizeof(ServiceRegistryUpdate));
+}
+
+const ServiceRegistryUpdate::Entry_t* ServiceRegistryUpdate::entries() const noexcept
+{
+    return reinterpret_cast<const Entry_t*>(reinterpret_cast<const uint8_t*>(this) + sizeof(ServiceRegistryUpdate));
+}
+
+} // namespace roudi
+} // namespace iox
@@ -157,8 +157,32 @@ rp::BaseRelativePointer::offset_t IpcRuntimeInterface::getSegmentManagerAddressO
     return m_segmentManagerAddressOffset.value();
 }
 
+void IpcRuntimeInterface::enableSharedMemoryRequestChannel() noexcept
+{
+    if (m_requestChannelOffset == rp::BaseRelativePointer::NULL_POINTER_OFFSET)
+    {
+        LogDebug() << "RouDi provided no shared memory request channel, requests are sent via the IPC channel";
+        return;
+    }
+
+    auto requestChannelData = static_cast<RuntimeRequestChannelData*>(
+        rp::BaseRelativePointer::getPtr(rp::BaseRelativePointer::id_t{m_segmentId}, m_requestChannelOffset));
+    m_requestChannel.emplace(*requestChannelData);
+}
+
 bool IpcRuntimeInterface::sendRequestToRouDi(const IpcMessage& msg, IpcMessage& answer) noexcept
 {
+    // requests which exceed the request channel are sent via the IPC channel
+    if (m_requestChannel.has_value() && m_requestChannel->sendRequest(msg))
+    {
+        if (!m_requestChannel->waitForResponse(answer))
+        {
+            LogError() << "Could not receive response via the shared memory request channel.\n";
+            return false;
+        }
+        return true;
+    }
+
     if (!m_RoudiIpcInterface.send(msg))
     {
         LogError() << "Could not send request via RouDi IPC channel interface.\n";
@@ -226,7 +250,7 @@ IpcRuntimeInterface::RegAckResult IpcRuntimeInterface::waitForRegAck(int64_t tra
 
             if (stringToIpcMessageType(cmd.c_str()) == IpcMessageType::REG_ACK)
             {
-                constexpr uint32_t REGISTER_ACK_PARAMETERS = 6U;
+                constexpr uint32_t REGISTER_ACK_PARAMETERS = 7U;
                 if (receiveBuffer.getNumberOfElements() != REGISTER_ACK_PARAMETERS)
                 {
                     errorHandler(PoshError::IPC_INTERFACE__REG_ACK_INVALIG_NUMBER_OF_PARAMS);
@@ -242,6 +266,7 @@ IpcRuntimeInterface::RegAckResult IpcRuntimeInterface::waitForRegAck(int64_t tra
                 cxx::convert::fromString(receiveBuffer.getElementAtIndex(3U).c_str(), receivedTimestamp);
                 cxx::convert::fromString(receiveBuffer.getElementAtIndex(4U).c_str(), m_segmentId);
                 cxx::convert::fromString(receiveBuffer.getElementAtIndex(5U).c_str(), m_sendKeepalive);
+                cxx::convert::fromString(receiveBuffer.getElementAtIndex(6U).c_str(), m_requestChannelOffset);
                 if (transmissionTimestamp == receivedTimestamp)
                 {
                     return RegAckResult::SUCCESS;
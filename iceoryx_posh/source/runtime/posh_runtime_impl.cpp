@@ -48,6 +48,14 @@ PoshRuntimeImpl::PoshRuntimeImpl(cxx::optional<const RuntimeName_t*> name, const
                                                       m_ipcChannelInterface.getSegmentManagerAddressOffset()});
     }())
 {
+    m_ipcChannelInterface.enableSharedMemoryRequestChannel();
+}
+
+void PoshRuntimeImpl::mapWritableDataSegment() noexcept
+{
+    // the chunks of publishers, clients and servers are acquired from the writable data segment; mapping it when the
+    // port is created keeps the mapping out of the first loan
+    m_ShmInterface.and_then([](auto& shmInterface) { shmInterface.mapWritableDataSegment(); });
 }
 
 PoshRuntimeImpl::~PoshRuntimeImpl() noexcept
@@ -145,6 +153,7 @@ PoshRuntimeImpl::getMiddlewarePublisher(const capro::ServiceDescription& service
         }
         return nullptr;
     }
+    mapWritableDataSegment();
     return maybePublisher.value();
 }
 
@@ -356,6 +365,7 @@ popo::ClientPortUser::MemberType_t* PoshRuntimeImpl::getMiddlewareClient(const c
         }
         return nullptr;
     }
+    mapWritableDataSegment();
     return maybeClient.value();
 }
 
@@ -458,6 +468,7 @@ popo::ServerPortUser::MemberType_t* PoshRuntimeImpl::getMiddlewareServer(const c
         }
         return nullptr;
     }
+    mapWritableDataSegment();
     return maybeServer.value();
 }
 
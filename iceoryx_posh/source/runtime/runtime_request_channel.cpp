@@ -0,0 +1,121 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/runtime/runtime_request_channel.hpp"
+#include "iceoryx_posh/internal/log/posh_logging.hpp"
+
+#include <cstring>
+
+namespace iox
+{
+namespace runtime
+{
+using State = RuntimeRequestChannelData::State;
+
+RuntimeRequestChannel::RuntimeRequestChannel(RuntimeRequestChannelData& data) noexcept
+    : m_data(&data)
+{
+}
+
+bool RuntimeRequestChannel::write(const IpcMessage& message) noexcept
+{
+    const std::string payload = message.getMessage();
+    if (payload.size() > RuntimeRequestChannelData::MAX_MESSAGE_SIZE)
+    {
+        return false;
+    }
+    std::memcpy(m_data->m_message, payload.data(), payload.size());
+    m_data->m_messageSize = payload.size();
+    return true;
+}
+
+bool RuntimeRequestChannel::sendRequest(const IpcMessage& request) noexcept
+{
+    if (m_data->m_state.load(std::memory_order_relaxed) != State::IDLE || !write(request))
+    {
+        return false;
+    }
+
+    m_data->m_state.store(State::REQUEST_PENDING, std::memory_order_release);
+    if (m_data->m_doorbell->post().has_error())
+    {
+        LogWarn() << "Unable to ring the doorbell of the runtime request channel";
+    }
+    return true;
+}
+
+bool RuntimeRequestChannel::waitForResponse(IpcMessage& response) noexcept
+{
+    while (m_data->m_state.load(std::memory_order_acquire) != State::RESPONSE_READY)
+    {
+        if (m_data->m_responseEvent.wait().has_error())
+        {
+            return false;
+        }
+    }
+
+    response = IpcMessage(std::string(m_data->m_message, m_data->m_messageSize));
+    m_data->m_state.store(State::IDLE, std::memory_order_relaxed);
+    return true;
+}
+
+cxx::optional<IpcMessage> RuntimeRequestChannel::takeRequest() noexcept
+{
+    auto expectedState = State::REQUEST_PENDING;
+    if (!m_data->m_state.compare_exchange_strong(
+            expectedState, State::REQUEST_IN_PROGRESS, std::memory_order_acquire, std::memory_order_relaxed))
+    {
+        return cxx::nullopt;
+    }
+
+    return IpcMessage(std::string(m_data->m_message, m_data->m_messageSize));
+}
+
+bool RuntimeRequestChannel::sendResponse(const IpcMessage& response) noexcept
+{
+    if (!isRequestInProgress())
+    {
+        return false;
+    }
+
+    // the runtime is blocked until a response arrives, therefore an oversized response is replaced by an empty one
+    // which is treated as invalid response by the runtime
+    const bool hasWrittenResponse = write(response);
+    if (!hasWrittenResponse)
+    {
+        m_data->m_messageSize = 0U;
+    }
+
+    m_data->m_state.store(State::RESPONSE_READY, std::memory_order_release);
+    if (m_data->m_responseEvent.post().has_error())
+    {
+        LogWarn() << "Unable to wake up runtime '" << m_data->m_runtimeName << "' waiting for a response";
+    }
+    return hasWrittenResponse;
+}
+
+bool RuntimeRequestChannel::isRequestInProgress() const noexcept
+{
+    return m_data->m_state.load(std::memory_order_relaxed) == State::REQUEST_IN_PROGRESS;
+}
+
+bool RuntimeRequestChannel::isResponsePending() const noexcept
+{
+    return m_data->m_state.load(std::memory_order_relaxed) == State::RESPONSE_READY;
+}
+
+} // namespace runtime
+} // namespace iox
@@ -0,0 +1,32 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/runtime/runtime_request_channel_data.hpp"
+
+namespace iox
+{
+namespace runtime
+{
+constexpr uint64_t RuntimeRequestChannelData::MAX_MESSAGE_SIZE;
+
+RuntimeRequestChannelData::RuntimeRequestChannelData(const RuntimeName_t& runtimeName,
+                                                     concurrent::FutexEvent& doorbell) noexcept
+    : m_runtimeName(runtimeName)
+    , m_doorbell(&doorbell)
+{
+}
+} // namespace runtime
+} // namespace iox
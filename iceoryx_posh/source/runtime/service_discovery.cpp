@@ -25,13 +25,35 @@ ServiceDiscovery::ServiceDiscovery() noexcept
 {
 }
 
-void ServiceDiscovery::update()
+bool ServiceDiscovery::update()
 {
-    // allows us to use update and hence findService concurrently
-    std::lock_guard<std::mutex> lock(m_serviceRegistryMutex);
-    m_serviceRegistrySubscriber.take().and_then([&](popo::Sample<const roudi::ServiceRegistry>& serviceRegistrySample) {
-        *m_serviceRegistry = *serviceRegistrySample;
-    });
+    bool hasAppliedUpdate{false};
+    for (auto sample = m_serviceRegistrySubscriber.take(); !sample.has_error();
+         sample = m_serviceRegistrySubscriber.take())
+    {
+        hasAppliedUpdate |= applyUpdate(*sample.value());
+    }
+    return hasAppliedUpdate;
+}
+
+bool ServiceDiscovery::applyUpdate(const roudi::ServiceRegistryUpdate& update)
+{
+    if (update.type() == roudi::ServiceRegistryUpdate::Type::SNAPSHOT)
+    {
+        update.applyTo(*m_serviceRegistry);
+        m_nextServiceRegistryVersion.emplace(update.version() + 1U);
+        return true;
+    }
+
+    // a change can only be applied in order; if changes were discarded due to the full queue, the queue also
+    // contains a subsequent snapshot which restores the registry
+    if (m_nextServiceRegistryVersion.has_value() && update.version() == *m_nextServiceRegistryVersion)
+    {
+        update.applyTo(*m_serviceRegistry);
+        ++(*m_nextServiceRegistryVersion);
+        return true;
+    }
+    return false;
 }
 
 void ServiceDiscovery::findService(const cxx::optional<capro::IdString_t>& service,
@@ -40,13 +62,23 @@ void ServiceDiscovery::findService(const cxx::optional<capro::IdString_t>& servi
                                    const cxx::function_ref<void(const capro::ServiceDescription&)>& callableForEach,
                                    const popo::MessagingPattern pattern) noexcept
 {
-    update();
+    std::shared_ptr<const roudi::ServiceRegistry> serviceRegistry;
+    {
+        // allows us to use findService concurrently; the registry is updated in place, therefore the callable is
+        // applied to a copy which is only replaced after updates were applied
+        std::lock_guard<std::mutex> lock(m_serviceRegistryMutex);
+        if (update() || !m_serviceRegistrySnapshot)
+        {
+            m_serviceRegistrySnapshot = std::make_shared<const roudi::ServiceRegistry>(*m_serviceRegistry);
+        }
+        serviceRegistry = m_serviceRegistrySnapshot;
+    }
 
     switch (pattern)
     {
     case popo::MessagingPattern::PUB_SUB:
     {
-        m_serviceRegistry->find(
+        serviceRegistry->find(
             service, instance, event, [&](const roudi::ServiceRegistry::ServiceDescriptionEntry& serviceEntry) {
                 if (serviceEntry.publisherCount > 0)
                 {
@@ -57,7 +89,7 @@ void ServiceDiscovery::findService(const cxx::optional<capro::IdString_t>& servi
     }
     case popo::MessagingPattern::REQ_RES:
     {
-        m_serviceRegistry->find(
+        serviceRegistry->find(
             service, instance, event, [&](const roudi::ServiceRegistry::ServiceDescriptionEntry& serviceEntry) {
                 if (serviceEntry.serverCount > 0)
                 {
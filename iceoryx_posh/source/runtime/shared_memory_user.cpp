@@ -22,10 +22,47 @@
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
 #include "iceoryx_posh/internal/mepoo/segment_manager.hpp"
 
+#include <mutex>
+
 namespace iox
 {
 namespace runtime
 {
+namespace
+{
+/// @brief the state of the lazy mapping of the data segments and the mempool extents; it is process wide since the
+/// handler of the relative pointers is a plain function, the mapped segments stay mapped until the process terminates
+/// or a new SharedMemoryUser is created
+struct LazySegmentMapping
+{
+    std::mutex m_mutex;
+    mepoo::SegmentManager<>* m_segmentManager{nullptr};
+    cxx::optional<uint64_t> m_writableSegmentId;
+    mepoo::SegmentManager<>::SegmentMappingContainer m_dataSegments;
+    cxx::vector<uint64_t, MAX_SHM_SEGMENTS + 2U * MAX_NUMBER_OF_MEMPOOL_EXTENTS * MAX_SHM_SEGMENTS> m_mappedIds;
+    cxx::vector<posix::SharedMemoryObject, MAX_SHM_SEGMENTS> m_dataShmObjects;
+    cxx::vector<posix::SharedMemoryObject, 2U * MAX_NUMBER_OF_MEMPOOL_EXTENTS * MAX_SHM_SEGMENTS> m_extentShmObjects;
+};
+
+LazySegmentMapping& lazySegmentMapping() noexcept
+{
+    static LazySegmentMapping mapping;
+    return mapping;
+}
+
+cxx::expected<posix::SharedMemoryObject, posix::SharedMemoryObjectError>
+openSegment(const ShmName_t& name, const uint64_t size, const bool isWritable, const cxx::perms permissions) noexcept
+{
+    return posix::SharedMemoryObjectBuilder()
+        .name(name)
+        .memorySizeInBytes(size)
+        .accessMode(isWritable ? posix::AccessMode::READ_WRITE : posix::AccessMode::READ_ONLY)
+        .openMode(posix::OpenMode::OPEN_EXISTING)
+        .permissions(permissions)
+        .create();
+}
+} // namespace
+
 constexpr cxx::perms SharedMemoryUser::SHM_SEGMENT_PERMISSIONS;
 
 SharedMemoryUser::SharedMemoryUser(const size_t topicSize,
@@ -47,48 +84,175 @@ SharedMemoryUser::SharedMemoryUser(const size_t topicSize,
                        << iox::log::HexFormat(reinterpret_cast<uint64_t>(sharedMemoryObject.getBaseAddress()))
                        << " with size " << sharedMemoryObject.getSizeInBytes() << " to id " << segmentId;
 
-            this->openDataSegments(segmentId, segmentManagerAddressOffset);
+            this->registerDataSegments(segmentId, segmentManagerAddressOffset);
 
             m_shmObject.emplace(std::move(sharedMemoryObject));
         })
         .or_else([](auto&) { errorHandler(PoshError::POSH__SHM_APP_MAPP_ERR); });
 }
 
-void SharedMemoryUser::openDataSegments(const uint64_t segmentId,
-                                        const rp::BaseRelativePointer::offset_t segmentManagerAddressOffset) noexcept
+void SharedMemoryUser::registerDataSegments(
+    const uint64_t segmentId, const rp::BaseRelativePointer::offset_t segmentManagerAddressOffset) noexcept
 {
     auto ptr = rp::BaseRelativePointer::getPtr(rp::BaseRelativePointer::id_t{segmentId}, segmentManagerAddressOffset);
     auto segmentManager = reinterpret_cast<mepoo::SegmentManager<>*>(ptr);
 
     auto segmentMapping = segmentManager->getSegmentMappings(posix::PosixUser::getUserOfCurrentProcess());
-    for (const auto& segment : segmentMapping)
+
+    {
+        auto& mapping = lazySegmentMapping();
+        std::lock_guard<std::mutex> lock(mapping.m_mutex);
+
+        // the segments of a previous SharedMemoryUser must not be resolved anymore
+        for (const auto mappedId : mapping.m_mappedIds)
+        {
+            rp::BaseRelativePointer::unregisterPtr(rp::BaseRelativePointer::id_t{mappedId});
+        }
+        mapping.m_mappedIds.clear();
+        mapping.m_dataShmObjects.clear();
+        mapping.m_extentShmObjects.clear();
+        mapping.m_writableSegmentId.reset();
+
+        mapping.m_segmentManager = segmentManager;
+        mapping.m_dataSegments = segmentMapping;
+        for (const auto& segment : segmentMapping)
+        {
+            if (segment.m_isWritable)
+            {
+                mapping.m_writableSegmentId.emplace(segment.m_segmentId);
+            }
+        }
+    }
+
+    rp::BaseRelativePointer::setUnregisteredIdHandler(&SharedMemoryUser::mapSegment);
+}
+
+void SharedMemoryUser::mapWritableDataSegment() const noexcept
+{
+    cxx::optional<uint64_t> writableSegmentId;
+    {
+        auto& mapping = lazySegmentMapping();
+        std::lock_guard<std::mutex> lock(mapping.m_mutex);
+        writableSegmentId = mapping.m_writableSegmentId;
+    }
+
+    writableSegmentId.and_then([](const auto segmentId) {
+        // resolving the base pointer maps the segment if this did not yet happen
+        IOX_DISCARD_RESULT(rp::BaseRelativePointer::getBasePtr(rp::BaseRelativePointer::id_t{segmentId}));
+    });
+}
+
+cxx::optional<SharedMemoryUser::SharedMemoryLocation>
+SharedMemoryUser::findSharedMemory(const void* const address) noexcept
+{
+    const auto segmentId = rp::BaseRelativePointer::searchId(const_cast<void*>(address));
+    auto& repository = rp::BaseRelativePointer::getRepository();
+    const auto baseAddress = repository.getBasePtr(segmentId);
+    if (segmentId == 0U || baseAddress == nullptr)
     {
-        auto accessMode = segment.m_isWritable ? posix::AccessMode::READ_WRITE : posix::AccessMode::READ_ONLY;
-        posix::SharedMemoryObjectBuilder()
-            .name(segment.m_sharedMemoryName)
-            .memorySizeInBytes(segment.m_size)
-            .accessMode(accessMode)
-            .openMode(posix::OpenMode::OPEN_EXISTING)
-            .permissions(SHM_SEGMENT_PERMISSIONS)
-            .create()
-            .and_then([this, &segment](auto& sharedMemoryObject) {
-                if (static_cast<uint32_t>(m_dataShmObjects.size()) >= MAX_SHM_SEGMENTS)
-                {
-                    errorHandler(PoshError::POSH__SHM_APP_SEGMENT_COUNT_OVERFLOW);
-                }
-
-                rp::BaseRelativePointer::registerPtr(rp::BaseRelativePointer::id_t{segment.m_segmentId},
-                                                     sharedMemoryObject.getBaseAddress(),
-                                                     sharedMemoryObject.getSizeInBytes());
+        return cxx::nullopt;
+    }
+
+    auto& mapping = lazySegmentMapping();
+    std::lock_guard<std::mutex> lock(mapping.m_mutex);
+
+    cxx::optional<SharedMemoryLocation> location;
+    auto setLocation = [&](const ShmName_t& name, const uint64_t size) {
+        location.emplace();
+        location->m_sharedMemoryName = name;
+        location->m_baseAddress = baseAddress;
+        location->m_size = size;
+    };
+
+    for (const auto& segment : mapping.m_dataSegments)
+    {
+        if (segment.m_segmentId == segmentId)
+        {
+            setLocation(segment.m_sharedMemoryName, segment.m_size);
+            return location;
+        }
+    }
+
+    if (mapping.m_segmentManager != nullptr)
+    {
+        mapping.m_segmentManager->forEachSegment([&](mepoo::MePooSegment<>& segment) {
+            segment.findExtentMemory(segmentId).and_then([&](auto& extentMemory) {
+                setLocation(extentMemory.m_sharedMemoryName, extentMemory.m_size);
+            });
+        });
+    }
+    return location;
+}
+
+void SharedMemoryUser::mapSegment(const rp::BaseRelativePointer::id_underlying_t segmentId) noexcept
+{
+    auto& mapping = lazySegmentMapping();
+    std::lock_guard<std::mutex> lock(mapping.m_mutex);
+
+    // another thread could have mapped the segment in the meantime; the repository is queried directly since
+    // BaseRelativePointer::getBasePtr would call this handler again
+    if (mapping.m_segmentManager == nullptr
+        || rp::BaseRelativePointer::getRepository().getBasePtr(segmentId) != nullptr)
+    {
+        return;
+    }
+
+    auto registerSegment = [&](posix::SharedMemoryObject& sharedMemoryObject) {
+        // the mutex only serializes the mapping; the entry is published with release semantic by the repository,
+        // therefore threads which resolve relative pointers without the mutex see either nothing or the whole entry
+        rp::BaseRelativePointer::registerPtr(rp::BaseRelativePointer::id_t{segmentId},
+                                             sharedMemoryObject.getBaseAddress(),
+                                             sharedMemoryObject.getSizeInBytes());
+        mapping.m_mappedIds.emplace_back(segmentId);
+    };
+
+    for (const auto& segment : mapping.m_dataSegments)
+    {
+        if (segment.m_segmentId != segmentId)
+        {
+            continue;
+        }
+
+        openSegment(segment.m_sharedMemoryName, segment.m_size, segment.m_isWritable, SHM_SEGMENT_PERMISSIONS)
+            .and_then([&](auto& sharedMemoryObject) {
+                registerSegment(sharedMemoryObject);
 
                 LogDebug() << "Application registered payload data segment "
                            << iox::log::HexFormat(reinterpret_cast<uint64_t>(sharedMemoryObject.getBaseAddress()))
-                           << " with size " << sharedMemoryObject.getSizeInBytes() << " to id " << segment.m_segmentId;
+                           << " with size " << sharedMemoryObject.getSizeInBytes() << " to id " << segmentId;
 
-                m_dataShmObjects.emplace_back(std::move(sharedMemoryObject));
+                mapping.m_dataShmObjects.emplace_back(std::move(sharedMemoryObject));
             })
             .or_else([](auto&) { errorHandler(PoshError::POSH__SHM_APP_SEGMENT_MAPP_ERR); });
+        return;
     }
+
+    mapping.m_segmentManager->forEachSegment([&](mepoo::MePooSegment<>& segment) {
+        segment.findExtentMemory(segmentId).and_then([&](auto& extentMemory) {
+            // the chunk memory can only be written by the writers of the segment, the chunk management by every user
+            const bool isWritable =
+                !extentMemory.m_isChunkMemory
+                || (mapping.m_writableSegmentId.has_value()
+                    && mapping.m_writableSegmentId.value() == segment.getSegmentId());
+
+            openSegment(extentMemory.m_sharedMemoryName, extentMemory.m_size, isWritable, SHM_SEGMENT_PERMISSIONS)
+                .and_then([&](auto& sharedMemoryObject) {
+                    if (mapping.m_extentShmObjects.size() >= mapping.m_extentShmObjects.capacity())
+                    {
+                        errorHandler(PoshError::POSH__SHM_APP_SEGMENT_COUNT_OVERFLOW);
+                        return;
+                    }
+
+                    registerSegment(sharedMemoryObject);
+
+                    LogDebug() << "Application registered mempool extent " << extentMemory.m_sharedMemoryName
+                               << " with size " << sharedMemoryObject.getSizeInBytes() << " to id " << segmentId;
+
+                    mapping.m_extentShmObjects.emplace_back(std::move(sharedMemoryObject));
+                })
+                .or_else([](auto&) { errorHandler(PoshError::POSH__SHM_APP_SEGMENT_MAPP_ERR); });
+        });
+    });
 }
 } // namespace runtime
 } // namespace iox
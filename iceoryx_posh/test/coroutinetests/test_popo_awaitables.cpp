@@ -0,0 +1,378 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_hoofs/testing/watch_dog.hpp"
+#include "iceoryx_posh/popo/awaitable_client.hpp"
+#include "iceoryx_posh/popo/awaitable_server.hpp"
+#include "iceoryx_posh/popo/awaitable_subscriber.hpp"
+#include "iceoryx_posh/popo/coroutine_scheduler.hpp"
+#include "iceoryx_posh/popo/publisher.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iceoryx_posh/testing/roudi_gtest.hpp"
+
+#include "test.hpp"
+
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+
+using namespace iox::popo;
+using namespace iox::capro;
+using namespace iox::runtime;
+using namespace iox::units::duration_literals;
+
+struct DummyRequest
+{
+    uint64_t augend{0U};
+    uint64_t addend{0U};
+};
+
+struct DummyResponse
+{
+    uint64_t sum{0U};
+};
+
+/// @brief a minimal coroutine type which starts eagerly and keeps its frame until it is destroyed
+class Task
+{
+  public:
+    struct promise_type
+    {
+        Task get_return_object() noexcept
+        {
+            return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+        std::suspend_never initial_suspend() noexcept
+        {
+            return {};
+        }
+        std::suspend_always final_suspend() noexcept
+        {
+            return {};
+        }
+        void return_void() noexcept
+        {
+        }
+        void unhandled_exception() noexcept
+        {
+            std::terminate();
+        }
+    };
+
+    explicit Task(std::coroutine_handle<promise_type> handle) noexcept
+        : m_handle(handle)
+    {
+    }
+    Task(const Task&) = delete;
+    Task(Task&& rhs) noexcept
+        : m_handle(rhs.m_handle)
+    {
+        rhs.m_handle = nullptr;
+    }
+    Task& operator=(const Task&) = delete;
+    Task& operator=(Task&&) = delete;
+    ~Task() noexcept
+    {
+        if (m_handle)
+        {
+            m_handle.destroy();
+        }
+    }
+
+    bool isDone() const noexcept
+    {
+        return m_handle.done();
+    }
+
+  private:
+    std::coroutine_handle<promise_type> m_handle;
+};
+
+class Awaitables_test : public RouDi_GTest
+{
+  public:
+    void SetUp() override
+    {
+        PoshRuntime::initRuntime("awaitables");
+        sut.emplace();
+        publisher.emplace(sd);
+        deadlockWatchdog.watchAndActOnFailure([] { std::terminate(); });
+    }
+
+    void runUntil(const std::function<bool()>& isDone)
+    {
+        for (uint64_t i = 0U; i < MAX_NUMBER_OF_RUNS && !isDone(); ++i)
+        {
+            sut->runOnce(RUN_TIMEOUT);
+        }
+    }
+
+    void publish(const uint64_t value)
+    {
+        ASSERT_FALSE(publisher->loan().and_then([&](auto& sample) {
+            *sample = value;
+            sample.publish();
+        }).has_error());
+    }
+
+    static constexpr iox::units::Duration DEADLOCK_TIMEOUT{5_s};
+    static constexpr iox::units::Duration RUN_TIMEOUT{10_ms};
+    static constexpr uint64_t MAX_NUMBER_OF_RUNS{200U};
+
+    Watchdog deadlockWatchdog{DEADLOCK_TIMEOUT};
+    ServiceDescription sd{"Radar", "FrontLeft", "Object"};
+    iox::cxx::optional<CoroutineScheduler> sut;
+    iox::cxx::optional<Publisher<uint64_t>> publisher;
+};
+constexpr iox::units::Duration Awaitables_test::DEADLOCK_TIMEOUT;
+constexpr iox::units::Duration Awaitables_test::RUN_TIMEOUT;
+constexpr uint64_t Awaitables_test::MAX_NUMBER_OF_RUNS;
+
+TEST_F(Awaitables_test, NextProvidesAlreadyReceivedSampleWithoutSuspending)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ee88ff82-0113-4b12-8e9b-3b1b8af211aa");
+    constexpr uint64_t VALUE{73U};
+    AwaitableSubscriber<uint64_t> subscriber(*sut, sd);
+    publish(VALUE);
+
+    uint64_t receivedValue{0U};
+    auto task = [&]() -> Task {
+        auto result = co_await subscriber.next();
+        EXPECT_FALSE(result.has_error());
+        receivedValue = *result.value();
+    }();
+
+    EXPECT_TRUE(task.isDone());
+    EXPECT_THAT(receivedValue, Eq(VALUE));
+}
+
+TEST_F(Awaitables_test, NextResumesCoroutineWhenSampleIsReceived)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f04d7f3d-3faa-4c6f-9d28-9db87441b730");
+    constexpr uint64_t VALUE{37U};
+    AwaitableSubscriber<uint64_t> subscriber(*sut, sd);
+
+    uint64_t receivedValue{0U};
+    auto task = [&]() -> Task {
+        auto result = co_await subscriber.next();
+        EXPECT_FALSE(result.has_error());
+        receivedValue = *result.value();
+    }();
+    EXPECT_FALSE(task.isDone());
+
+    publish(VALUE);
+    runUntil([&] { return task.isDone(); });
+
+    EXPECT_TRUE(task.isDone());
+    EXPECT_THAT(receivedValue, Eq(VALUE));
+}
+
+TEST_F(Awaitables_test, NextProvidesAllSamplesInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e5073110-ac7b-4acd-808c-42850a28e868");
+    constexpr uint64_t NUMBER_OF_SAMPLES{5U};
+    AwaitableSubscriber<uint64_t> subscriber(*sut, sd);
+
+    std::vector<uint64_t> receivedValues;
+    auto task = [&]() -> Task {
+        while (receivedValues.size() < NUMBER_OF_SAMPLES)
+        {
+            auto result = co_await subscriber.next();
+            EXPECT_FALSE(result.has_error());
+            receivedValues.push_back(*result.value());
+        }
+    }();
+
+    publish(0U);
+    publish(1U);
+    runUntil([&] { return receivedValues.size() >= 2U; });
+    for (uint64_t i = 2U; i < NUMBER_OF_SAMPLES; ++i)
+    {
+        publish(i);
+    }
+    runUntil([&] { return task.isDone(); });
+
+    ASSERT_TRUE(task.isDone());
+    for (uint64_t i = 0U; i < NUMBER_OF_SAMPLES; ++i)
+    {
+        EXPECT_THAT(receivedValues[i], Eq(i));
+    }
+}
+
+TEST_F(Awaitables_test, CustomExecutorResumesCoroutines)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d9b9373e-a596-4b01-bad7-055f731be820");
+    std::vector<std::coroutine_handle<>> readyQueue;
+    CoroutineScheduler scheduler([&](auto handle) { readyQueue.push_back(handle); });
+    AwaitableSubscriber<uint64_t> subscriber(scheduler, sd);
+
+    auto task = [&]() -> Task { co_await subscriber.next(); }();
+    publish(1U);
+    for (uint64_t i = 0U; i < MAX_NUMBER_OF_RUNS && readyQueue.empty(); ++i)
+    {
+        scheduler.runOnce(RUN_TIMEOUT);
+    }
+
+    ASSERT_THAT(readyQueue.size(), Eq(1U));
+    EXPECT_FALSE(task.isDone());
+    readyQueue.front().resume();
+    EXPECT_TRUE(task.isDone());
+}
+
+TEST_F(Awaitables_test, CallReceivesResponseFromAwaitingServer)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b67571af-ea73-4708-a5f0-2d1791a038b5");
+    constexpr uint64_t AUGEND{13U};
+    constexpr uint64_t ADDEND{42U};
+    AwaitableServer<DummyRequest, DummyResponse> server(*sut, sd);
+    AwaitableClient<DummyRequest, DummyResponse> client(*sut, sd);
+
+    auto serverTask = [&]() -> Task {
+        auto result = co_await server.nextRequest();
+        EXPECT_FALSE(result.has_error());
+        auto& request = result.value();
+        server.loan(request)
+            .and_then([&](auto& response) {
+                response->sum = request->augend + request->addend;
+                EXPECT_FALSE(server.send(std::move(response)).has_error());
+            })
+            .or_else([](auto&) { ADD_FAILURE() << "Expected a loaned response"; });
+    }();
+
+    uint64_t sum{0U};
+    auto clientTask = [&]() -> Task {
+        auto loanResult = client.loan();
+        EXPECT_FALSE(loanResult.has_error());
+        loanResult.value()->augend = AUGEND;
+        loanResult.value()->addend = ADDEND;
+        auto result = co_await client.call(std::move(loanResult.value()), 1_s);
+        EXPECT_FALSE(result.has_error());
+        sum = result.value()->sum;
+    }();
+
+    runUntil([&] { return serverTask.isDone() && clientTask.isDone(); });
+
+    EXPECT_TRUE(serverTask.isDone());
+    EXPECT_TRUE(clientTask.isDone());
+    EXPECT_THAT(sum, Eq(AUGEND + ADDEND));
+    EXPECT_THAT(client.numberOfRequestsInFlight(), Eq(0U));
+}
+
+TEST_F(Awaitables_test, CallFailsWithoutSuspendingWhenRequestCannotBeSent)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bd916643-f4bf-495f-9b52-a1c8fcd16878");
+    AwaitableClient<DummyRequest, DummyResponse> client(*sut, sd);
+
+    iox::cxx::optional<AsyncCallError> error;
+    auto task = [&]() -> Task {
+        auto loanResult = client.loan();
+        EXPECT_FALSE(loanResult.has_error());
+        auto result = co_await client.call(std::move(loanResult.value()));
+        EXPECT_TRUE(result.has_error());
+        error = result.get_error();
+    }();
+
+    EXPECT_TRUE(task.isDone());
+    ASSERT_TRUE(error.has_value());
+    EXPECT_THAT(error.value(), Eq(AsyncCallError::SERVER_NOT_AVAILABLE));
+}
+
+TEST_F(Awaitables_test, CallTimesOutWhenServerDoesNotRespond)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "367ed497-779c-49e4-b975-a1ab094ce129");
+    AwaitableServer<DummyRequest, DummyResponse> server(*sut, sd);
+    AwaitableClient<DummyRequest, DummyResponse> client(*sut, sd);
+
+    iox::cxx::optional<AsyncCallError> error;
+    auto task = [&]() -> Task {
+        auto loanResult = client.loan();
+        EXPECT_FALSE(loanResult.has_error());
+        auto result = co_await client.call(std::move(loanResult.value()), 20_ms);
+        EXPECT_TRUE(result.has_error());
+        error = result.get_error();
+    }();
+    EXPECT_FALSE(task.isDone());
+
+    runUntil([&] { return task.isDone(); });
+
+    EXPECT_TRUE(task.isDone());
+    ASSERT_TRUE(error.has_value());
+    EXPECT_THAT(error.value(), Eq(AsyncCallError::TIMED_OUT));
+}
+
+TEST_F(Awaitables_test, RunOnceWithoutTimeoutWakesUpWhenCallTimesOut)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cd7566b1-2ab0-4b6e-9e5b-a700e70a0faf");
+    AwaitableServer<DummyRequest, DummyResponse> server(*sut, sd);
+    AwaitableClient<DummyRequest, DummyResponse> client(*sut, sd);
+
+    iox::cxx::optional<AsyncCallError> error;
+    auto task = [&]() -> Task {
+        auto loanResult = client.loan();
+        EXPECT_FALSE(loanResult.has_error());
+        auto result = co_await client.call(std::move(loanResult.value()), 20_ms);
+        EXPECT_TRUE(result.has_error());
+        error = result.get_error();
+    }();
+
+    // the deadlock watchdog terminates the test when runOnce does not return at the timeout of the call
+    for (uint64_t i = 0U; i < MAX_NUMBER_OF_RUNS && !task.isDone(); ++i)
+    {
+        sut->runOnce();
+    }
+
+    EXPECT_TRUE(task.isDone());
+    ASSERT_TRUE(error.has_value());
+    EXPECT_THAT(error.value(), Eq(AsyncCallError::TIMED_OUT));
+}
+
+TEST_F(Awaitables_test, DestroyingAwaitingCoroutineCancelsCall)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d8a780c4-2e7a-4c65-b532-4d428ebf423e");
+    AwaitableServer<DummyRequest, DummyResponse> server(*sut, sd);
+    AwaitableClient<DummyRequest, DummyResponse> client(*sut, sd);
+
+    {
+        auto task = [&]() -> Task {
+            auto loanResult = client.loan();
+            EXPECT_FALSE(loanResult.has_error());
+            co_await client.call(std::move(loanResult.value()));
+            ADD_FAILURE() << "The coroutine must not be resumed";
+        }();
+        EXPECT_FALSE(task.isDone());
+        EXPECT_THAT(client.numberOfRequestsInFlight(), Eq(1U));
+    }
+
+    EXPECT_THAT(client.numberOfRequestsInFlight(), Eq(0U));
+}
+
+TEST_F(Awaitables_test, DetachedSubscriberIsNotDispatched)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ee1a4e40-b400-4734-b0b5-adb019b4971c");
+    {
+        AwaitableSubscriber<uint64_t> subscriber(*sut, sd);
+    }
+    AwaitableSubscriber<uint64_t> subscriber(*sut, sd);
+    publish(1U);
+
+    EXPECT_THAT(sut->runOnce(RUN_TIMEOUT), Eq(1U));
+    EXPECT_THAT(sut->runOnce(0_ms), Eq(0U));
+}
+
+} // namespace
@@ -0,0 +1,306 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_hoofs/testing/watch_dog.hpp"
+#include "iceoryx_posh/gateway/channel.hpp"
+#include "iceoryx_posh/gateway/gateway_generic.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/popo/subscriber.hpp"
+#include "iceoryx_posh/popo/untyped_publisher.hpp"
+#include "iceoryx_posh/popo/untyped_subscriber.hpp"
+#include "iceoryx_posh/roudi/introspection_types.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iceoryx_posh/testing/roudi_gtest.hpp"
+
+#include "test.hpp"
+
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+
+// ======================================== Helpers ======================================== //
+
+constexpr char ROUND_TRIP_EVENT_SUFFIX[] = "_roundtrip";
+constexpr char RUNTIME_NAME[] = "GatewayCodecRoundTrip_test";
+
+/// @brief The external terminal of the round-trip gateway. Instead of sending the encoded frames to another system,
+/// it decodes them and publishes the result on the event of the channel with ROUND_TRIP_EVENT_SUFFIX appended.
+class RoundTripTerminal
+{
+  public:
+    RoundTripTerminal(const capro::IdString_t& service,
+                      const capro::IdString_t& instance,
+                      const capro::IdString_t& event) noexcept
+        : m_publisher({service,
+                       instance,
+                       capro::IdString_t(cxx::TruncateToCapacity,
+                                         std::string(event.c_str()) + ROUND_TRIP_EVENT_SUFFIX)})
+    {
+    }
+
+    void write(const mepoo::ChunkHeader* const chunkHeader,
+               const uint8_t* const frame,
+               const uint64_t frameSize,
+               gw::ChannelCodec& codec) noexcept
+    {
+        constexpr uint32_t USER_HEADER_ALIGNMENT{1U};
+        auto decodedSize = codec.decodedSize(frame, frameSize);
+        if (decodedSize.has_error())
+        {
+            return;
+        }
+        m_publisher
+            .loan(decodedSize.value(),
+                  chunkHeader->userPayloadAlignment(),
+                  chunkHeader->userHeaderSize(),
+                  USER_HEADER_ALIGNMENT)
+            .and_then([&](void* userPayload) {
+                auto roundTripChunkHeader = mepoo::ChunkHeader::fromUserPayload(userPayload);
+                std::memcpy(
+                    roundTripChunkHeader->userHeader(), chunkHeader->userHeader(), chunkHeader->userHeaderSize());
+                if (codec.decode(frame, frameSize, userPayload, decodedSize.value()).has_error())
+                {
+                    m_publisher.release(userPayload);
+                    return;
+                }
+                m_publisher.publish(userPayload);
+            });
+    }
+
+  private:
+    popo::UntypedPublisher m_publisher;
+};
+
+using RoundTripChannel = gw::Channel<popo::UntypedSubscriber, RoundTripTerminal>;
+
+/// @brief A gateway which forwards every offered service through the codec stage and back into the local system. It
+/// shows the compression ratio and the codec time of a payload without a second system.
+/// @note The runtime of the RouDi environment is only available in the test thread, therefore the test drives the
+/// gateway instead of runMultithreaded
+class RoundTripGateway : public gw::GatewayGeneric<RoundTripChannel>
+{
+  public:
+    explicit RoundTripGateway(const gw::CodecType codec) noexcept
+        : gw::GatewayGeneric<RoundTripChannel>(capro::Interfaces::MTA)
+        , m_codec(codec)
+    {
+        enableCodecIntrospection();
+    }
+
+    using gw::GatewayGeneric<RoundTripChannel>::publishCodecIntrospection;
+
+    void forwardAll() noexcept
+    {
+        forEachChannel([this](RoundTripChannel& channel) { forward(channel); });
+    }
+
+    void loadConfiguration(const config::GatewayConfig& config) noexcept override
+    {
+        for (const auto& service : config.m_configuredServices)
+        {
+            IOX_DISCARD_RESULT(setupChannel(service.m_serviceDescription, service.m_codec));
+        }
+    }
+
+    void discover(const capro::CaproMessage& msg) noexcept override
+    {
+        const auto& service = msg.m_serviceDescription;
+        if (service.getServiceIDString() == capro::IdString_t(roudi::INTROSPECTION_SERVICE_ID)
+            || msg.m_serviceType != capro::CaproServiceType::PUBLISHER)
+        {
+            return;
+        }
+        // the republished samples must not be forwarded again
+        const std::string event(service.getEventIDString().c_str());
+        const std::string suffix(ROUND_TRIP_EVENT_SUFFIX);
+        if (event.size() >= suffix.size() && event.compare(event.size() - suffix.size(), suffix.size(), suffix) == 0)
+        {
+            return;
+        }
+
+        if (msg.m_type == capro::CaproMessageType::OFFER && !findChannel(service).has_value())
+        {
+            IOX_DISCARD_RESULT(setupChannel(service, m_codec));
+        }
+        else if (msg.m_type == capro::CaproMessageType::STOP_OFFER && findChannel(service).has_value())
+        {
+            IOX_DISCARD_RESULT(discardChannel(service));
+        }
+    }
+
+    void forward(const RoundTripChannel& channel) noexcept override
+    {
+        auto subscriber = channel.getIceoryxTerminal();
+        auto codec = channel.getCodec();
+        while (subscriber->hasData())
+        {
+            subscriber->take().and_then([&](const void* userPayload) {
+                auto chunkHeader = mepoo::ChunkHeader::fromUserPayload(userPayload);
+                m_frame.resize(gw::ChannelCodec::maxEncodedSize(chunkHeader->userPayloadSize()));
+                codec->encode(userPayload, chunkHeader->userPayloadSize(), m_frame.data(), m_frame.size())
+                    .and_then([&](const uint64_t frameSize) {
+                        channel.getExternalTerminal()->write(chunkHeader, m_frame.data(), frameSize, *codec);
+                    });
+                subscriber->release(userPayload);
+            });
+        }
+    }
+
+  private:
+    cxx::expected<RoundTripChannel, gw::GatewayError> setupChannel(const capro::ServiceDescription& service,
+                                                                   const gw::CodecType codec) noexcept
+    {
+        popo::SubscriberOptions options;
+        options.queueCapacity = 64U;
+        return addChannel(service, options, codec).and_then([](auto& channel) {
+            channel.getIceoryxTerminal()->subscribe();
+        });
+    }
+
+    gw::CodecType m_codec{gw::CodecType::NONE};
+    std::vector<uint8_t> m_frame;
+};
+
+struct GridHeader
+{
+    uint64_t sequenceNumber{0U};
+};
+
+// ======================================== Fixture ======================================== //
+class GatewayCodecRoundTrip_test : public RouDi_GTest
+{
+  public:
+    void SetUp() override
+    {
+        runtime::PoshRuntime::initRuntime(RUNTIME_NAME);
+        m_watchdog.watchAndActOnFailure([] { std::terminate(); });
+    }
+
+    template <typename Condition>
+    bool waitFor(const Condition& condition)
+    {
+        for (uint32_t i = 0U; i < 500U; ++i)
+        {
+            if (condition())
+            {
+                return true;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        return false;
+    }
+
+    /// @brief an occupancy grid where a few cells change with every update
+    std::vector<uint8_t> createGrid(const uint64_t sequenceNumber)
+    {
+        std::vector<uint8_t> grid(GRID_SIZE, 0U);
+        for (uint64_t i = sequenceNumber; i < GRID_SIZE; i += 251U)
+        {
+            grid[i] = 100U;
+        }
+        return grid;
+    }
+
+    static constexpr uint32_t GRID_SIZE{4096U};
+    static constexpr uint64_t NUMBER_OF_GRIDS{40U};
+
+    Watchdog m_watchdog{units::Duration::fromSeconds(10)};
+};
+
+constexpr uint32_t GatewayCodecRoundTrip_test::GRID_SIZE;
+constexpr uint64_t GatewayCodecRoundTrip_test::NUMBER_OF_GRIDS;
+
+// ======================================== Tests ======================================== //
+TEST_F(GatewayCodecRoundTrip_test, PayloadsAreRestoredAndStatisticsArePublished)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5f610b7c-dc4a-4110-a4c2-d838702f98b7");
+    RoundTripGateway gateway(gw::CodecType::XOR_DELTA_LZ);
+    const capro::ServiceDescription service{"Radar", "FrontLeft", "Grid"};
+    const capro::ServiceDescription roundTripService{"Radar", "FrontLeft", "Grid_roundtrip"};
+
+    popo::UntypedPublisher publisher(service);
+    gateway.discover({capro::CaproMessageType::OFFER, service, capro::CaproServiceType::PUBLISHER});
+    gateway.discover({capro::CaproMessageType::OFFER, roundTripService, capro::CaproServiceType::PUBLISHER});
+    ASSERT_THAT(gateway.getNumberOfChannels(), Eq(1U));
+
+    popo::UntypedSubscriber roundTripSubscriber(roundTripService);
+    popo::SubscriberOptions introspectionOptions;
+    introspectionOptions.historyRequest = 1U;
+    popo::Subscriber<roudi::GatewayCodecIntrospectionTopic> introspectionSubscriber(
+        {roudi::INTROSPECTION_SERVICE_ID, RUNTIME_NAME, roudi::INTROSPECTION_GATEWAY_CODEC_EVENT_ID},
+        introspectionOptions);
+
+    ASSERT_TRUE(waitFor([&] {
+        return publisher.hasSubscribers()
+               && roundTripSubscriber.getSubscriptionState() == SubscribeState::SUBSCRIBED;
+    }));
+
+    for (uint64_t i = 0U; i < NUMBER_OF_GRIDS; ++i)
+    {
+        const auto grid = createGrid(i);
+        publisher.loan(GRID_SIZE, alignof(uint64_t), sizeof(GridHeader), alignof(GridHeader))
+            .and_then([&](void* userPayload) {
+                auto chunkHeader = mepoo::ChunkHeader::fromUserPayload(userPayload);
+                static_cast<GridHeader*>(chunkHeader->userHeader())->sequenceNumber = i;
+                std::memcpy(userPayload, grid.data(), GRID_SIZE);
+                publisher.publish(userPayload);
+            })
+            .or_else([](auto&) { GTEST_FAIL() << "Could not loan a chunk"; });
+    }
+
+    uint64_t numberOfReceivedGrids{0U};
+    ASSERT_TRUE(waitFor([&] {
+        gateway.forwardAll();
+        roundTripSubscriber.take().and_then([&](const void* userPayload) {
+            auto chunkHeader = mepoo::ChunkHeader::fromUserPayload(userPayload);
+            const auto grid = createGrid(numberOfReceivedGrids);
+            EXPECT_THAT(static_cast<const GridHeader*>(chunkHeader->userHeader())->sequenceNumber,
+                        Eq(numberOfReceivedGrids));
+            EXPECT_THAT(chunkHeader->userPayloadSize(), Eq(GRID_SIZE));
+            EXPECT_THAT(std::memcmp(userPayload, grid.data(), GRID_SIZE), Eq(0));
+            ++numberOfReceivedGrids;
+            roundTripSubscriber.release(userPayload);
+        });
+        return numberOfReceivedGrids == NUMBER_OF_GRIDS;
+    }));
+
+    bool hasStatisticsOfAllGrids{false};
+    ASSERT_TRUE(waitFor([&] {
+        gateway.publishCodecIntrospection();
+        introspectionSubscriber.take().and_then([&](const auto& sample) {
+            if (sample->m_caproEventMethodID == capro::IdString_t("Grid")
+                && sample->m_decodedFrames == NUMBER_OF_GRIDS)
+            {
+                EXPECT_THAT(sample->m_codec, Eq(cxx::string<roudi::MAX_CODEC_NAME_LENGTH>("xor-delta-lz")));
+                EXPECT_THAT(sample->m_encodedFrames, Eq(NUMBER_OF_GRIDS));
+                EXPECT_THAT(sample->m_codecErrors, Eq(0U));
+                EXPECT_THAT(sample->m_rawBytes, Eq(NUMBER_OF_GRIDS * GRID_SIZE));
+                EXPECT_THAT(sample->m_compressionRatio, Gt(10.0));
+                hasStatisticsOfAllGrids = true;
+            }
+        });
+        return hasStatisticsOfAllGrids;
+    }));
+}
+
+} // namespace
@@ -0,0 +1,351 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_hoofs/platform/stat.hpp"
+#include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
+#include "iceoryx_hoofs/testing/watch_dog.hpp"
+#include "iceoryx_posh/gateway/shm_bridge.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/popo/untyped_publisher.hpp"
+#include "iceoryx_posh/popo/untyped_subscriber.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iceoryx_posh/testing/roudi_gtest.hpp"
+
+#include "test.hpp"
+
+#include <cstring>
+#include <string>
+#include <thread>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::units::duration_literals;
+
+// ======================================== Helpers ======================================== //
+
+constexpr char RUNTIME_NAME[] = "ShmBridge_test";
+constexpr char BRIDGE_NAME[] = "ShmBridge_test";
+constexpr char SHM_DIRECTORY[] = "/dev/shm";
+
+/// @note The runtime of the RouDi environment is only available in the test thread, therefore the test drives both
+/// halves of the bridge instead of runMultithreaded. Both halves are in the same iceoryx system, the receiver maps
+/// the shared memory of its own system as the one of the sender.
+class TestShmBridgeSender : public gw::ShmBridgeSender<>
+{
+  public:
+    using gw::ShmBridgeSender<>::ShmBridgeSender;
+    using gw::ShmBridgeSender<>::waitForData;
+
+    void forwardAll() noexcept
+    {
+        forEachChannel([this](gw::Channel<popo::UntypedSubscriber, gw::ShmBridgeLane>& channel) { forward(channel); });
+        waitForData(1_ms);
+    }
+
+  protected:
+    /// @brief the RouDi environment maps the payload segment without the runtime, it is named after the group of
+    /// the process
+    cxx::optional<runtime::SharedMemoryUser::SharedMemoryLocation>
+    findSharedMemory(const mepoo::ChunkHeader* const chunkHeader) noexcept override
+    {
+        const auto segmentId = rp::BaseRelativePointer::searchId(const_cast<mepoo::ChunkHeader*>(chunkHeader));
+        runtime::SharedMemoryUser::SharedMemoryLocation location;
+        location.m_sharedMemoryName =
+            ShmName_t(cxx::TruncateToCapacity, posix::PosixGroup::getGroupOfCurrentProcess().getName().c_str());
+        location.m_baseAddress = rp::BaseRelativePointer::getRepository().getBasePtr(segmentId);
+
+        struct stat fileStat;
+        const std::string path{std::string(SHM_DIRECTORY) + "/" + location.m_sharedMemoryName.c_str()};
+        if (location.m_baseAddress == nullptr || stat(path.c_str(), &fileStat) != 0)
+        {
+            return cxx::nullopt;
+        }
+        location.m_size = static_cast<uint64_t>(fileStat.st_size);
+        return location;
+    }
+};
+
+class TestShmBridgeReceiver : public gw::ShmBridgeReceiver<>
+{
+  public:
+    using gw::ShmBridgeReceiver<>::ShmBridgeReceiver;
+    using gw::ShmBridgeReceiver<>::waitForData;
+
+    void forwardAll() noexcept
+    {
+        forEachChannel([this](gw::Channel<popo::UntypedPublisher, gw::ShmBridgeLane>& channel) { forward(channel); });
+        waitForData(1_ms);
+    }
+};
+
+struct PointCloudHeader
+{
+    uint64_t sequenceNumber{0U};
+};
+
+// ======================================== Fixture ======================================== //
+class ShmBridge_test : public RouDi_GTest
+{
+  public:
+    void SetUp() override
+    {
+        runtime::PoshRuntime::initRuntime(RUNTIME_NAME);
+        m_watchdog.watchAndActOnFailure([] { std::terminate(); });
+    }
+
+    std::unique_ptr<TestShmBridgeSender> createSender()
+    {
+        auto transfer = gw::ShmBridgeTransfer::create(BRIDGE_NAME);
+        EXPECT_FALSE(transfer.has_error());
+        return std::make_unique<TestShmBridgeSender>(std::move(transfer.value()));
+    }
+
+    std::unique_ptr<TestShmBridgeReceiver> createReceiver()
+    {
+        const std::string transferSegmentPath{std::string(SHM_DIRECTORY) + "/"
+                                              + gw::ShmBridgeTransfer::transferSegmentName(BRIDGE_NAME).c_str()};
+        return std::make_unique<TestShmBridgeReceiver>(transferSegmentPath, SHM_DIRECTORY);
+    }
+
+    template <typename Condition>
+    bool waitFor(const Condition& condition)
+    {
+        for (uint32_t i = 0U; i < 500U; ++i)
+        {
+            if (condition())
+            {
+                return true;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        return false;
+    }
+
+    static constexpr uint32_t PAYLOAD_SIZE{1000U};
+    static constexpr uint32_t PAYLOAD_ALIGNMENT{64U};
+    static constexpr uint64_t NUMBER_OF_SAMPLES{100U};
+
+    const capro::ServiceDescription m_service{"Lidar", "Roof", "PointCloud"};
+    Watchdog m_watchdog{units::Duration::fromSeconds(10)};
+};
+
+constexpr uint32_t ShmBridge_test::PAYLOAD_SIZE;
+constexpr uint32_t ShmBridge_test::PAYLOAD_ALIGNMENT;
+constexpr uint64_t ShmBridge_test::NUMBER_OF_SAMPLES;
+
+// ======================================== Tests ======================================== //
+TEST_F(ShmBridge_test, SamplesAreRepublishedByTheReceiver)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e3499a15-add0-4ae7-ada8-1d8cd116b2c1");
+    auto sender = createSender();
+    auto receiver = createReceiver();
+    popo::UntypedPublisher publisher(m_service);
+    popo::SubscriberOptions subscriberOptions;
+    subscriberOptions.queueCapacity = 256U;
+    popo::UntypedSubscriber subscriber(m_service, subscriberOptions);
+
+    sender->discover({capro::CaproMessageType::OFFER, m_service, capro::CaproServiceType::PUBLISHER});
+    ASSERT_THAT(sender->getNumberOfChannels(), Eq(1U));
+    receiver->forwardAll();
+    ASSERT_THAT(receiver->getNumberOfChannels(), Eq(1U));
+
+    // the subscriber is connected to the publisher and the publisher of the receiver
+    ASSERT_TRUE(waitFor([&] {
+        return publisher.hasSubscribers() && subscriber.getSubscriptionState() == SubscribeState::SUBSCRIBED;
+    }));
+
+    uint64_t numberOfBridgedSamples{0U};
+    uint64_t numberOfPublishedSamples{0U};
+    ASSERT_TRUE(waitFor([&] {
+        if (numberOfPublishedSamples < NUMBER_OF_SAMPLES)
+        {
+            publisher.loan(PAYLOAD_SIZE, PAYLOAD_ALIGNMENT, sizeof(PointCloudHeader), alignof(PointCloudHeader))
+                .and_then([&](void* userPayload) {
+                    auto chunkHeader = mepoo::ChunkHeader::fromUserPayload(userPayload);
+                    static_cast<PointCloudHeader*>(chunkHeader->userHeader())->sequenceNumber =
+                        numberOfPublishedSamples;
+                    std::memset(userPayload, static_cast<int>(numberOfPublishedSamples), PAYLOAD_SIZE);
+                    publisher.publish(userPayload);
+                    ++numberOfPublishedSamples;
+                });
+        }
+        sender->forwardAll();
+        receiver->forwardAll();
+
+        while (true)
+        {
+            auto takeResult = subscriber.take();
+            if (takeResult.has_error())
+            {
+                break;
+            }
+            auto chunkHeader = mepoo::ChunkHeader::fromUserPayload(takeResult.value());
+            if (chunkHeader->originId() != publisher.getUid())
+            {
+                const auto sequenceNumber =
+                    static_cast<const PointCloudHeader*>(chunkHeader->userHeader())->sequenceNumber;
+                EXPECT_THAT(sequenceNumber, Eq(numberOfBridgedSamples));
+                EXPECT_THAT(chunkHeader->userPayloadSize(), Eq(PAYLOAD_SIZE));
+                EXPECT_THAT(chunkHeader->userPayloadAlignment(), Eq(PAYLOAD_ALIGNMENT));
+                EXPECT_THAT(static_cast<const uint8_t*>(takeResult.value())[PAYLOAD_SIZE - 1U],
+                            Eq(static_cast<uint8_t>(sequenceNumber)));
+                ++numberOfBridgedSamples;
+            }
+            subscriber.release(takeResult.value());
+        }
+        return numberOfBridgedSamples == NUMBER_OF_SAMPLES;
+    }));
+
+    // the sender releases every chunk which was copied by the receiver
+    sender->forwardAll();
+    auto transfer = gw::ShmBridgeTransfer::open(std::string(SHM_DIRECTORY) + "/"
+                                                + gw::ShmBridgeTransfer::transferSegmentName(BRIDGE_NAME).c_str());
+    ASSERT_FALSE(transfer.has_error());
+    EXPECT_THAT(transfer->data().m_lanes[0].m_readIndex.load(), Eq(NUMBER_OF_SAMPLES));
+    EXPECT_THAT(transfer->data().m_lanes[0].m_writeIndex.load(), Eq(NUMBER_OF_SAMPLES));
+}
+
+TEST_F(ShmBridge_test, MultiChunkSampleIsDroppedAndReleasedBySender)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "868a9b56-c89b-498e-9af0-0fc5f621775b");
+    auto sender = createSender();
+    auto receiver = createReceiver();
+    popo::UntypedPublisher publisher(m_service);
+    popo::UntypedSubscriber subscriber(m_service);
+
+    sender->discover({capro::CaproMessageType::OFFER, m_service, capro::CaproServiceType::PUBLISHER});
+    receiver->forwardAll();
+    ASSERT_THAT(receiver->getNumberOfChannels(), Eq(1U));
+    ASSERT_TRUE(waitFor([&] {
+        return publisher.hasSubscribers() && subscriber.getSubscriptionState() == SubscribeState::SUBSCRIBED;
+    }));
+
+    mepoo::MultiChunkTable::PartSizes_t partSizes;
+    partSizes.emplace_back(PAYLOAD_SIZE);
+    partSizes.emplace_back(PAYLOAD_SIZE);
+    auto multiChunkTable = publisher.loanMultiChunk(partSizes);
+    ASSERT_FALSE(multiChunkTable.has_error());
+    publisher.publish(multiChunkTable.value());
+    publisher.loan(PAYLOAD_SIZE).and_then([&](void* userPayload) {
+        std::memset(userPayload, 42, PAYLOAD_SIZE);
+        publisher.publish(userPayload);
+    });
+
+    // only the single chunk sample is republished by the receiver
+    uint64_t numberOfBridgedSamples{0U};
+    EXPECT_TRUE(waitFor([&] {
+        sender->forwardAll();
+        receiver->forwardAll();
+        while (true)
+        {
+            auto takeResult = subscriber.take();
+            if (takeResult.has_error())
+            {
+                break;
+            }
+            auto chunkHeader = mepoo::ChunkHeader::fromUserPayload(takeResult.value());
+            if (chunkHeader->originId() != publisher.getUid())
+            {
+                EXPECT_FALSE(chunkHeader->isMultiChunk());
+                EXPECT_THAT(chunkHeader->userPayloadSize(), Eq(PAYLOAD_SIZE));
+                ++numberOfBridgedSamples;
+            }
+            subscriber.release(takeResult.value());
+        }
+        return numberOfBridgedSamples == 1U;
+    }));
+
+    // the dropped sample was released right away and never written to the lane
+    sender->forwardAll();
+    auto transfer = gw::ShmBridgeTransfer::open(std::string(SHM_DIRECTORY) + "/"
+                                                + gw::ShmBridgeTransfer::transferSegmentName(BRIDGE_NAME).c_str());
+    ASSERT_FALSE(transfer.has_error());
+    EXPECT_THAT(transfer->data().m_lanes[0].m_writeIndex.load(), Eq(1U));
+    EXPECT_THAT(transfer->data().m_lanes[0].m_readIndex.load(), Eq(1U));
+}
+
+TEST_F(ShmBridge_test, StopOfferDiscardsTheChannelOfTheReceiver)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "53f4ee20-1f91-489d-b354-1e316014be49");
+    auto sender = createSender();
+    auto receiver = createReceiver();
+
+    sender->discover({capro::CaproMessageType::OFFER, m_service, capro::CaproServiceType::PUBLISHER});
+    receiver->forwardAll();
+    ASSERT_THAT(receiver->getNumberOfChannels(), Eq(1U));
+
+    sender->discover({capro::CaproMessageType::STOP_OFFER, m_service, capro::CaproServiceType::PUBLISHER});
+    EXPECT_THAT(sender->getNumberOfChannels(), Eq(0U));
+    receiver->forwardAll();
+    EXPECT_THAT(receiver->getNumberOfChannels(), Eq(0U));
+}
+
+TEST_F(ShmBridge_test, ReceiverReconnectsToARestartedSender)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a81bd00c-4f15-46d7-b990-0d1100dd6fbe");
+    auto sender = createSender();
+    auto receiver = createReceiver();
+    sender->discover({capro::CaproMessageType::OFFER, m_service, capro::CaproServiceType::PUBLISHER});
+    receiver->forwardAll();
+    ASSERT_THAT(receiver->getNumberOfChannels(), Eq(1U));
+
+    sender.reset();
+    receiver->forwardAll();
+    EXPECT_THAT(receiver->getNumberOfChannels(), Eq(0U));
+
+    sender = createSender();
+    sender->discover({capro::CaproMessageType::OFFER, m_service, capro::CaproServiceType::PUBLISHER});
+    // the receiver detects the new transfer segment when no data arrives on the old one
+    EXPECT_TRUE(waitFor([&] {
+        receiver->forwardAll();
+        return receiver->getNumberOfChannels() == 1U;
+    }));
+}
+
+TEST_F(ShmBridge_test, RepublishedServiceIsNotOfferedToTheSender)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a1777903-adcb-49f5-a649-36dc5834583f");
+    auto sender = createSender();
+    auto receiver = createReceiver();
+    popo::UntypedPublisher publisher(m_service);
+
+    sender->discover({capro::CaproMessageType::OFFER, m_service, capro::CaproServiceType::PUBLISHER});
+    receiver->forwardAll();
+    ASSERT_THAT(receiver->getNumberOfChannels(), Eq(1U));
+
+    // only the offer of the publisher reaches the sender, the one of the receiver has the SHM_BRIDGE interface
+    uint32_t numberOfOffers{0U};
+    auto collectOffers = [&] {
+        capro::CaproMessage msg;
+        while (sender->getCaProMessage(msg))
+        {
+            if (msg.m_type == capro::CaproMessageType::OFFER && msg.m_serviceDescription == m_service)
+            {
+                EXPECT_THAT(msg.m_serviceDescription.getSourceInterface(), Eq(capro::Interfaces::INTERNAL));
+                ++numberOfOffers;
+            }
+        }
+        return numberOfOffers > 0U;
+    };
+    ASSERT_TRUE(waitFor(collectOffers));
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    collectOffers();
+}
+
+} // namespace
@@ -0,0 +1,164 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/relocatable_pointer/base_relative_pointer.hpp"
+#include "iceoryx_posh/internal/runtime/posh_runtime_impl.hpp"
+#include "iceoryx_posh/popo/untyped_publisher.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iceoryx_posh/testing/roudi_gtest.hpp"
+
+#include "test.hpp"
+
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::runtime;
+using iox::rp::BaseRelativePointer;
+
+/// @brief a runtime which maps the shared memory itself like a runtime in a separate process; the runtimes of the
+/// RouDiEnvironment use the memory which is already mapped by RouDi
+class SeparateProcessRuntime : public PoshRuntimeImpl
+{
+  public:
+    explicit SeparateProcessRuntime(const iox::RuntimeName_t& name)
+        : PoshRuntimeImpl(iox::cxx::make_optional<const iox::RuntimeName_t*>(&name),
+                          RuntimeLocation::SEPARATE_PROCESS_FROM_ROUDI)
+    {
+    }
+};
+
+/// @note RouDi and the runtimes share one PointerRepository in this test. The data segment which was registered by
+/// RouDi is unregistered before a SeparateProcessRuntime is created, so that the runtime behaves like one in a
+/// separate process which has not mapped the data segment yet.
+class LazySegmentMapping_test : public RouDi_GTest
+{
+  public:
+    void SetUp() override
+    {
+        PoshRuntime::initRuntime("discoverer");
+        {
+            iox::popo::UntypedPublisher publisher({"Lazy", "Segment", "Discovery"});
+            publisher.loan(sizeof(uint64_t)).and_then([&](auto userPayload) {
+                m_dataSegmentId = BaseRelativePointer::searchId(userPayload);
+                publisher.release(userPayload);
+            });
+        }
+        ASSERT_THAT(m_dataSegmentId, Ne(0U));
+
+        BaseRelativePointer::unregisterPtr(BaseRelativePointer::id_t{m_dataSegmentId});
+    }
+
+    void* registeredBasePtr() const
+    {
+        // the repository is queried directly since BaseRelativePointer::getBasePtr maps an unregistered segment
+        return BaseRelativePointer::getRepository().getBasePtr(m_dataSegmentId);
+    }
+
+    BaseRelativePointer::id_underlying_t m_dataSegmentId{0U};
+    const iox::capro::ServiceDescription m_service{"Lazy", "Segment", "Mapping"};
+};
+
+TEST_F(LazySegmentMapping_test, DataSegmentIsNotMappedWhenTheRuntimeIsCreated)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f6b413cd-9215-4968-8589-917b4ed0cca4");
+    SeparateProcessRuntime runtime{"lazy"};
+
+    EXPECT_THAT(registeredBasePtr(), Eq(nullptr));
+}
+
+TEST_F(LazySegmentMapping_test, FirstAccessOfAnUnmappedSegmentMapsIt)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7a4e0bd7-4339-4e64-a5d5-c38a6d100bda");
+    SeparateProcessRuntime runtime{"lazy"};
+
+    auto basePtr = BaseRelativePointer::getBasePtr(BaseRelativePointer::id_t{m_dataSegmentId});
+
+    EXPECT_THAT(basePtr, Ne(nullptr));
+    EXPECT_THAT(registeredBasePtr(), Eq(basePtr));
+}
+
+TEST_F(LazySegmentMapping_test, ConcurrentFirstAccessesResolveTheSameMapping)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "54fed7e7-8101-46b7-a690-a419467cf021");
+    constexpr uint64_t NUMBER_OF_THREADS{8U};
+    SeparateProcessRuntime runtime{"lazy"};
+
+    std::vector<void*> basePtrs(NUMBER_OF_THREADS, nullptr);
+    std::vector<std::thread> threads;
+    for (uint64_t i = 0U; i < NUMBER_OF_THREADS; ++i)
+    {
+        threads.emplace_back([&, i] {
+            basePtrs[i] = BaseRelativePointer::getBasePtr(BaseRelativePointer::id_t{m_dataSegmentId});
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_THAT(registeredBasePtr(), Ne(nullptr));
+    EXPECT_THAT(basePtrs, Each(Eq(registeredBasePtr())));
+}
+
+TEST_F(LazySegmentMapping_test, WritableDataSegmentIsMappedWhenAPublisherIsCreated)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3fcf4b1c-fee6-4de8-8dc0-bd0a58f6b311");
+    SeparateProcessRuntime runtime{"lazy"};
+
+    EXPECT_THAT(runtime.getMiddlewarePublisher(m_service), Ne(nullptr));
+
+    EXPECT_THAT(registeredBasePtr(), Ne(nullptr));
+}
+
+TEST_F(LazySegmentMapping_test, WritableDataSegmentIsMappedWhenAClientIsCreated)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6c11a8ff-3a71-4aa3-8439-b77a6f19f981");
+    SeparateProcessRuntime runtime{"lazy"};
+
+    EXPECT_THAT(runtime.getMiddlewareClient(m_service), Ne(nullptr));
+
+    EXPECT_THAT(registeredBasePtr(), Ne(nullptr));
+}
+
+TEST_F(LazySegmentMapping_test, WritableDataSegmentIsMappedWhenAServerIsCreated)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "997b995f-b80a-4b5b-a630-68d6151abbc1");
+    SeparateProcessRuntime runtime{"lazy"};
+
+    EXPECT_THAT(runtime.getMiddlewareServer(m_service), Ne(nullptr));
+
+    EXPECT_THAT(registeredBasePtr(), Ne(nullptr));
+}
+
+TEST_F(LazySegmentMapping_test, SegmentsOfThePreviousRuntimeAreUnregisteredWhenANewRuntimeIsCreated)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "62be8969-3da6-4a5f-a685-5589c7c29071");
+    {
+        SeparateProcessRuntime runtime{"lazy"};
+        ASSERT_THAT(BaseRelativePointer::getBasePtr(BaseRelativePointer::id_t{m_dataSegmentId}), Ne(nullptr));
+    }
+
+    SeparateProcessRuntime runtime{"lazier"};
+
+    EXPECT_THAT(registeredBasePtr(), Eq(nullptr));
+    EXPECT_THAT(BaseRelativePointer::getBasePtr(BaseRelativePointer::id_t{m_dataSegmentId}), Ne(nullptr));
+    EXPECT_THAT(registeredBasePtr(), Ne(nullptr));
+}
+
+} // namespace
@@ -16,6 +16,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_hoofs/testing/mocks/error_handler_mock.hpp"
 #include "iceoryx_hoofs/testing/timing_test.hpp"
 #include "iceoryx_hoofs/testing/watch_dog.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
@@ -205,6 +206,61 @@ TEST_F(ServiceDiscoveryBase_test, FindServiceWithWildcardsReturnsOnlyIntrospecti
     }
 }
 
+TEST_F(ServiceDiscoveryBase_test, FindServiceCanBeCalledFromCallableOfFindService)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f9582482-af0e-4e24-85a7-0d33db331caf");
+    uint64_t numberOfOuterResults{0U};
+    uint64_t numberOfInnerResults{0U};
+    bool hasCalledInnerFindService{false};
+    sut.findService(
+        iox::capro::Wildcard,
+        iox::capro::Wildcard,
+        iox::capro::Wildcard,
+        [&](const ServiceDescription&) {
+            ++numberOfOuterResults;
+            if (!hasCalledInnerFindService)
+            {
+                hasCalledInnerFindService = true;
+                sut.findService(
+                    iox::capro::Wildcard,
+                    iox::capro::Wildcard,
+                    iox::capro::Wildcard,
+                    [&](const ServiceDescription&) { ++numberOfInnerResults; },
+                    MessagingPattern::PUB_SUB);
+            }
+        },
+        MessagingPattern::PUB_SUB);
+
+    // the internal services are found by both calls
+    EXPECT_TRUE(hasCalledInnerFindService);
+    EXPECT_THAT(numberOfInnerResults, Eq(numberOfOuterResults));
+}
+
+TYPED_TEST(ServiceDiscovery_test, ServiceWhichIsOfferedFromCallableOfFindServiceIsFoundLater)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f64e0783-749f-4740-a6cb-80f7429bd7f0");
+    const iox::capro::ServiceDescription SERVICE_DESCRIPTION("john", "lennon", "guitar");
+    iox::cxx::optional<typename TestFixture::CommunicationKind::Producer> producer;
+
+    // the internal services are always found, i.e. the callable is called at least once
+    this->sut.findService(
+        iox::capro::Wildcard,
+        iox::capro::Wildcard,
+        iox::capro::Wildcard,
+        [&](const ServiceDescription&) {
+            if (!producer.has_value())
+            {
+                producer.emplace(SERVICE_DESCRIPTION);
+            }
+        },
+        MessagingPattern::PUB_SUB);
+    ASSERT_TRUE(producer.has_value());
+
+    this->waitUntilEventuallyFound(SERVICE_DESCRIPTION);
+    ASSERT_THAT(serviceContainer.size(), Eq(1U));
+    EXPECT_THAT(*serviceContainer.begin(), Eq(SERVICE_DESCRIPTION));
+}
+
 //
 // Offer, StopOffer, Reoffer
 // Variation of PUB/SUB and REQ/RES
@@ -27,6 +27,29 @@ class MePooMemoryManager_MOCK
         return iox::MAX_NUMBER_OF_MEMPOOLS;
     }
     MOCK_CONST_METHOD1(getMemPoolInfo, iox::mepoo::MemPoolInfo(uint32_t));
+    uint32_t getNumberOfReservedChunks(const uint32_t) const
+    {
+        return 0U;
+    }
+    uint64_t getNumberOfRejectedChunkRequests(const uint32_t) const
+    {
+        return 0U;
+    }
+    uint64_t getNumberOfReclaimedChunks(const uint32_t) const
+    {
+        return 0U;
+    }
+    uint32_t getMemPoolNumaNode(const uint32_t) const
+    {
+        return iox::NO_NUMA_NODE;
+    }
+    void sampleMemPoolNumaDistribution(const uint32_t, uint32_t (&pagesPerNode)[iox::MAX_NUMBER_OF_NUMA_NODES]) const
+    {
+        for (auto& pages : pagesPerNode)
+        {
+            pages = 0U;
+        }
+    }
 };
 
 #endif // IOX_POSH_MOCKS_MEPOO_MEMORY_MANAGER_MOCK_HPP
@@ -56,6 +56,9 @@ class MockPublisherPortUser
     MOCK_METHOD4(tryAllocateChunk,
                  iox::cxx::expected<iox::mepoo::ChunkHeader*, iox::popo::AllocationError>(
                      const uint32_t, const uint32_t, const uint32_t, const uint32_t));
+    MOCK_METHOD4(tryAllocateMultiChunk,
+                 iox::cxx::expected<iox::mepoo::ChunkHeader*, iox::popo::AllocationError>(
+                     const iox::mepoo::MultiChunkTable::PartSizes_t&, const uint32_t, const uint32_t, const uint32_t));
     MOCK_METHOD1(releaseChunk, void(iox::mepoo::ChunkHeader* const));
     MOCK_METHOD1(sendChunk, void(iox::mepoo::ChunkHeader* const));
     MOCK_METHOD0(tryGetPreviousChunk, iox::cxx::optional<iox::mepoo::ChunkHeader*>());
@@ -54,6 +54,9 @@ class MockSubscriberPortUser
     MOCK_METHOD0(tryGetChunk, iox::cxx::expected<const iox::mepoo::ChunkHeader*, iox::popo::ChunkReceiveResult>());
     MOCK_METHOD1(releaseChunk, void(const void* const));
     MOCK_METHOD0(releaseQueuedChunks, void());
+    MOCK_METHOD0(updateWindow, uint64_t());
+    MOCK_CONST_METHOD0(getWindow, const iox::popo::SubscriberPortData::ChunkWindow_t&());
+    MOCK_METHOD0(releaseWindow, void());
     MOCK_CONST_METHOD0(hasNewChunks, bool());
     MOCK_METHOD0(hasLostChunksSinceLastCall, bool());
     MOCK_METHOD2(setConditionVariable, bool(iox::popo::ConditionVariableData&, uint64_t));
@@ -80,6 +83,8 @@ class MockBaseSubscriber
     MOCK_METHOD0(hasMissedData, bool());
     MOCK_METHOD0(takeChunk, iox::cxx::expected<const iox::mepoo::ChunkHeader*, iox::popo::ChunkReceiveResult>());
     MOCK_METHOD0(releaseQueuedData, void());
+    MOCK_METHOD0(updateWindow, const iox::popo::SubscriberPortData::ChunkWindow_t&());
+    MOCK_METHOD0(releaseWindow, bool());
     MOCK_METHOD1(invalidateTrigger, bool(const uint64_t));
     MOCK_METHOD1(disableEvent, void(const iox::popo::SubscriberEvent));
 
@@ -95,6 +100,7 @@ class MockBaseSubscriber
 
     Port m_port;
     iox::popo::TriggerHandle m_trigger;
+    bool m_isWindowInUse{false};
 };
 
 #endif // IOX_POSH_MOCKS_SUBSCRIBER_MOCK_HPP
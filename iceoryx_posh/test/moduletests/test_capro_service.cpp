@@ -449,6 +449,45 @@ TEST_F(ServiceDescription_test, LogStreamConvertsServiceDescriptionToString)
     EXPECT_THAT(loggerMock.m_logs[0].message, StrEq(SERVICE_DESCRIPTION_AS_STRING));
 }
 
+TEST_F(ServiceDescription_test, EqualServiceDescriptionsHaveEqualHashes)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "97e4b7fd-3e48-41ab-b55b-e14484099d5a");
+    ServiceDescription serviceDescription1("TestService", "TestInstance", "TestEvent", {1U, 2U, 3U, 4U});
+    ServiceDescription serviceDescription2("TestService", "TestInstance", "TestEvent", {5U, 6U, 7U, 8U});
+
+    EXPECT_THAT(serviceDescription1.getHash(), Eq(serviceDescription2.getHash()));
+}
+
+TEST_F(ServiceDescription_test, ServiceDescriptionsWithShiftedStringsHaveDifferentHashes)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9f48d315-8b3c-4b5c-a92e-95248c5f3d4a");
+    ServiceDescription serviceDescription1("TestService", "TestInstance", "TestEvent");
+    ServiceDescription serviceDescription2("TestServiceT", "estInstance", "TestEvent");
+
+    EXPECT_THAT(serviceDescription1.getHash(), Ne(serviceDescription2.getHash()));
+    EXPECT_FALSE(serviceDescription1 == serviceDescription2);
+}
+
+TEST_F(ServiceDescription_test, DeserializedServiceDescriptionHasTheHashOfTheOriginal)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b1c53b5a-779a-47fd-a504-33e866c03515");
+    ServiceDescription serviceDescription("TestService", "TestInstance", "TestEvent");
+
+    auto deserialized = ServiceDescription::deserialize(serviceDescription.operator iox::cxx::Serialization());
+
+    ASSERT_FALSE(deserialized.has_error());
+    EXPECT_THAT(deserialized.value().getHash(), Eq(serviceDescription.getHash()));
+}
+
+TEST_F(ServiceDescription_test, DefaultServiceDescriptionHasHashOfEmptyStrings)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c8c5f908-113f-494e-9405-fc1dc5976d9b");
+    ServiceDescription serviceDescription1;
+    ServiceDescription serviceDescription2("", "", "");
+
+    EXPECT_THAT(serviceDescription1.getHash(), Eq(serviceDescription2.getHash()));
+}
+
 /// END SERVICEDESCRIPTION TESTS
 
 } // namespace
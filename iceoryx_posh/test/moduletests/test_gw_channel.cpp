@@ -62,4 +62,42 @@ TEST_F(ChannelTest, ReturnsEmptyOptionalIfObjectPoolExhausted)
     EXPECT_FALSE(channel.has_error());
 }
 
+TEST_F(ChannelTest, ChannelWithoutCodecHasNoCodecStage)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1221ce3b-de7f-41b0-bef0-f03e796656fe");
+    auto channel = TestChannel::create({"", "", ""}, StubbedIceoryxTerminal::Options());
+    ASSERT_FALSE(channel.has_error());
+    EXPECT_EQ(nullptr, channel.value().getCodec());
+}
+
+TEST_F(ChannelTest, ChannelWithCodecHasCodecStageOfRequestedType)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e77c2db5-b9b6-44c4-9114-3e25c15a8f6e");
+    auto channel =
+        TestChannel::create({"", "", ""}, StubbedIceoryxTerminal::Options(), iox::gw::CodecType::XOR_DELTA_LZ);
+    ASSERT_FALSE(channel.has_error());
+    ASSERT_NE(nullptr, channel.value().getCodec());
+    EXPECT_EQ(iox::gw::CodecType::XOR_DELTA_LZ, channel.value().getCodec()->codec());
+}
+
+TEST_F(ChannelTest, ChannelWithCodecHasCodecStageOfRequestedMaxPayloadSize)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0ecb46c7-299e-4e6e-ac52-b46743eb6b06");
+    constexpr uint32_t MAX_PAYLOAD_SIZE{4096U};
+    auto channel = TestChannel::create(
+        {"", "", ""}, StubbedIceoryxTerminal::Options(), iox::gw::CodecType::XOR_DELTA, MAX_PAYLOAD_SIZE);
+    ASSERT_FALSE(channel.has_error());
+    ASSERT_NE(nullptr, channel.value().getCodec());
+    EXPECT_EQ(MAX_PAYLOAD_SIZE, channel.value().getCodec()->maxPayloadSize());
+}
+
+TEST_F(ChannelTest, CopiesOfChannelShareTheCodecStage)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ff192c04-3bde-47d4-b518-84708b3ea545");
+    auto channel = TestChannel::create({"", "", ""}, StubbedIceoryxTerminal::Options(), iox::gw::CodecType::LZ);
+    ASSERT_FALSE(channel.has_error());
+    auto copy = channel.value();
+    EXPECT_EQ(channel.value().getCodec(), copy.getCodec());
+}
+
 } // namespace
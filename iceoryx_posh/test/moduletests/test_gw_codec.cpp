@@ -0,0 +1,347 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/gateway/codec.hpp"
+
+#include "test.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::gw;
+
+// ======================================== Helpers ======================================== //
+
+/// @brief an occupancy grid like payload with long runs and a few changing cells
+std::vector<uint8_t> createCompressiblePayload(const uint32_t size, const uint8_t seed)
+{
+    std::vector<uint8_t> payload(size, 0U);
+    for (uint32_t i = 0U; i < size; i += 97U)
+    {
+        payload[i] = static_cast<uint8_t>(seed + i);
+    }
+    return payload;
+}
+
+std::vector<uint8_t> createIncompressiblePayload(const uint32_t size)
+{
+    std::vector<uint8_t> payload(size);
+    uint32_t state{0x12345678U};
+    for (auto& byte : payload)
+    {
+        state = state * 1664525U + 1013904223U;
+        byte = static_cast<uint8_t>(state >> 24U);
+    }
+    return payload;
+}
+
+// ======================================== Fixture ======================================== //
+class ChannelCodec_test : public Test
+{
+  public:
+    void SetUp(){};
+    void TearDown(){};
+
+    uint64_t encode(ChannelCodec& codec, const std::vector<uint8_t>& payload)
+    {
+        frame.resize(ChannelCodec::maxEncodedSize(static_cast<uint32_t>(payload.size())));
+        auto result = codec.encode(payload.data(), static_cast<uint32_t>(payload.size()), frame.data(), frame.size());
+        EXPECT_FALSE(result.has_error());
+        return result.has_error() ? 0U : result.value();
+    }
+
+    std::vector<uint8_t> frame;
+    std::vector<uint8_t> decoded = std::vector<uint8_t>(PAYLOAD_SIZE);
+
+    static constexpr uint32_t PAYLOAD_SIZE{4096U};
+};
+
+constexpr uint32_t ChannelCodec_test::PAYLOAD_SIZE;
+
+// ======================================== Tests ======================================== //
+TEST_F(ChannelCodec_test, LzCompressesRepetitiveDataAndRestoresIt)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "dcfd5a03-e5bc-489f-8158-d37dad912bb2");
+    const auto payload = createCompressiblePayload(PAYLOAD_SIZE, 3U);
+    std::vector<uint8_t> block(PAYLOAD_SIZE);
+
+    auto compressed = lz::compress(payload.data(), payload.size(), block.data(), block.size());
+    ASSERT_FALSE(compressed.has_error());
+    EXPECT_THAT(compressed.value(), Lt(PAYLOAD_SIZE / 4U));
+
+    auto decompressed = lz::decompress(block.data(), compressed.value(), decoded.data(), decoded.size());
+    ASSERT_FALSE(decompressed.has_error());
+    EXPECT_THAT(decompressed.value(), Eq(PAYLOAD_SIZE));
+    EXPECT_THAT(decoded, Eq(payload));
+}
+
+TEST_F(ChannelCodec_test, LzRestoresIncompressibleData)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e17e3ce0-389a-4867-9cb8-98cdef766d4e");
+    const auto payload = createIncompressiblePayload(PAYLOAD_SIZE);
+    std::vector<uint8_t> block(2U * PAYLOAD_SIZE);
+
+    auto compressed = lz::compress(payload.data(), payload.size(), block.data(), block.size());
+    ASSERT_FALSE(compressed.has_error());
+
+    auto decompressed = lz::decompress(block.data(), compressed.value(), decoded.data(), decoded.size());
+    ASSERT_FALSE(decompressed.has_error());
+    EXPECT_THAT(decompressed.value(), Eq(PAYLOAD_SIZE));
+    EXPECT_THAT(decoded, Eq(payload));
+}
+
+TEST_F(ChannelCodec_test, LzRestoresEmptyAndShortData)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "31f55e9e-8fdb-428f-8f76-bb582043c8c3");
+    for (const uint32_t size : {0U, 1U, 12U, 13U, 17U})
+    {
+        const auto payload = std::vector<uint8_t>(size, 42U);
+        std::vector<uint8_t> block(size + 2U);
+
+        auto compressed = lz::compress(payload.data(), payload.size(), block.data(), block.size());
+        ASSERT_FALSE(compressed.has_error());
+
+        auto decompressed = lz::decompress(block.data(), compressed.value(), decoded.data(), decoded.size());
+        ASSERT_FALSE(decompressed.has_error());
+        ASSERT_THAT(decompressed.value(), Eq(size));
+        EXPECT_TRUE(std::equal(payload.begin(), payload.end(), decoded.begin()));
+    }
+}
+
+TEST_F(ChannelCodec_test, LzCompressIntoTooSmallBufferFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f0bac241-6e98-437a-8dc5-4d3b4624d792");
+    const auto payload = createIncompressiblePayload(PAYLOAD_SIZE);
+    std::vector<uint8_t> block(PAYLOAD_SIZE / 2U);
+
+    auto compressed = lz::compress(payload.data(), payload.size(), block.data(), block.size());
+    ASSERT_TRUE(compressed.has_error());
+    EXPECT_THAT(compressed.get_error(), Eq(CodecError::BUFFER_TOO_SMALL));
+}
+
+TEST_F(ChannelCodec_test, LzDecompressOfTruncatedOrCorruptedBlockFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "efe82ec8-f9cd-47d4-b029-635bcc72a689");
+    const auto payload = createCompressiblePayload(PAYLOAD_SIZE, 7U);
+    std::vector<uint8_t> block(PAYLOAD_SIZE);
+    auto compressed = lz::compress(payload.data(), payload.size(), block.data(), block.size());
+    ASSERT_FALSE(compressed.has_error());
+
+    auto truncated = lz::decompress(block.data(), compressed.value() / 2U, decoded.data(), decoded.size());
+    EXPECT_TRUE(truncated.has_error());
+
+    // an offset which points before the start of the decoded data
+    const uint8_t invalidOffset[] = {0x14U, 0xAAU, 0xFFU, 0x00U};
+    auto corrupted = lz::decompress(invalidOffset, sizeof(invalidOffset), decoded.data(), decoded.size());
+    ASSERT_TRUE(corrupted.has_error());
+    EXPECT_THAT(corrupted.get_error(), Eq(CodecError::INVALID_DATA));
+
+    auto tooSmall = lz::decompress(block.data(), compressed.value(), decoded.data(), PAYLOAD_SIZE / 2U);
+    ASSERT_TRUE(tooSmall.has_error());
+    EXPECT_THAT(tooSmall.get_error(), Eq(CodecError::BUFFER_TOO_SMALL));
+}
+
+TEST_F(ChannelCodec_test, FramesOfAllCodecsDecodeToThePayload)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b16af20d-fdc9-42ff-baf2-67d95fba64b7");
+    for (const auto codecType : {CodecType::NONE, CodecType::LZ, CodecType::XOR_DELTA, CodecType::XOR_DELTA_LZ})
+    {
+        ChannelCodec sut(codecType);
+        for (uint8_t i = 0U; i < 4U; ++i)
+        {
+            const auto payload = (i == 2U) ? createIncompressiblePayload(PAYLOAD_SIZE)
+                                           : createCompressiblePayload(PAYLOAD_SIZE, i);
+            const auto frameSize = encode(sut, payload);
+
+            auto size = sut.decodedSize(frame.data(), frameSize);
+            ASSERT_FALSE(size.has_error());
+            EXPECT_THAT(size.value(), Eq(PAYLOAD_SIZE));
+
+            auto result = sut.decode(frame.data(), frameSize, decoded.data(), decoded.size());
+            ASSERT_FALSE(result.has_error()) << asStringLiteral(codecType);
+            EXPECT_THAT(result.value(), Eq(PAYLOAD_SIZE));
+            EXPECT_THAT(decoded, Eq(payload)) << asStringLiteral(codecType);
+        }
+    }
+}
+
+TEST_F(ChannelCodec_test, DeltaFrameOfSlowlyChangingPayloadIsSmallerThanKeyFrame)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "084b45c5-bbd1-4547-be34-9da14372cb4b");
+    ChannelCodec sut(CodecType::XOR_DELTA_LZ);
+    const auto firstPayload = createIncompressiblePayload(PAYLOAD_SIZE);
+    auto secondPayload = firstPayload;
+    secondPayload[100U] = static_cast<uint8_t>(~secondPayload[100U]);
+
+    const auto keyFrameSize = encode(sut, firstPayload);
+    const auto deltaFrameSize = encode(sut, secondPayload);
+
+    EXPECT_THAT(keyFrameSize, Eq(ChannelCodec::maxEncodedSize(PAYLOAD_SIZE)));
+    EXPECT_THAT(deltaFrameSize, Lt(keyFrameSize / 20U));
+}
+
+TEST_F(ChannelCodec_test, LostDeltaFrameIsDetectedAndDecoderRecoversWithNextKeyFrame)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8f3e616d-a59e-476e-bff5-7ffbb4b5fe26");
+    ChannelCodec encoder(CodecType::XOR_DELTA);
+    ChannelCodec decoder(CodecType::XOR_DELTA);
+
+    for (uint64_t i = 0U; i < ChannelCodec::KEY_FRAME_INTERVAL + 1U; ++i)
+    {
+        const auto payload = createCompressiblePayload(PAYLOAD_SIZE, static_cast<uint8_t>(i));
+        const auto frameSize = encode(encoder, payload);
+        if (i == 1U)
+        {
+            // the frame is lost
+            continue;
+        }
+
+        auto result = decoder.decode(frame.data(), frameSize, decoded.data(), decoded.size());
+        if (i == 0U || i == ChannelCodec::KEY_FRAME_INTERVAL)
+        {
+            ASSERT_FALSE(result.has_error());
+            EXPECT_THAT(decoded, Eq(payload));
+        }
+        else
+        {
+            ASSERT_TRUE(result.has_error());
+            EXPECT_THAT(result.get_error(), Eq(CodecError::MISSING_REFERENCE));
+        }
+    }
+}
+
+TEST_F(ChannelCodec_test, KeyFrameIsEncodedEveryKeyFrameIntervalAndOnSizeChange)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "434f84c3-fe60-46b7-b179-864f3972b9a7");
+    ChannelCodec sut(CodecType::XOR_DELTA);
+    for (uint64_t i = 0U; i < 2U * ChannelCodec::KEY_FRAME_INTERVAL; ++i)
+    {
+        encode(sut, createCompressiblePayload(PAYLOAD_SIZE, static_cast<uint8_t>(i)));
+    }
+    EXPECT_THAT(sut.statistics().m_keyFrames, Eq(2U));
+
+    encode(sut, createCompressiblePayload(PAYLOAD_SIZE / 2U, 0U));
+    EXPECT_THAT(sut.statistics().m_keyFrames, Eq(3U));
+}
+
+TEST_F(ChannelCodec_test, MaxPayloadSizeIsTheConfiguredOneOrTheDefault)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "292a7b90-d9d6-430d-a2ed-9150fe01836f");
+    ChannelCodec defaultSut(CodecType::XOR_DELTA);
+    ChannelCodec sut(CodecType::XOR_DELTA, PAYLOAD_SIZE);
+
+    EXPECT_THAT(defaultSut.maxPayloadSize(), Eq(ChannelCodec::DEFAULT_MAX_PAYLOAD_SIZE));
+    EXPECT_THAT(sut.maxPayloadSize(), Eq(PAYLOAD_SIZE));
+}
+
+TEST_F(ChannelCodec_test, PayloadLargerThanTheMaxPayloadSizeIsAlwaysEncodedAsKeyFrame)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d28753d1-568c-4fec-9b0d-c759f40eb63e");
+    ChannelCodec encoder(CodecType::XOR_DELTA, PAYLOAD_SIZE / 2U);
+    ChannelCodec decoder(CodecType::XOR_DELTA, PAYLOAD_SIZE / 2U);
+
+    constexpr uint64_t NUMBER_OF_FRAMES{3U};
+    for (uint64_t i = 0U; i < NUMBER_OF_FRAMES; ++i)
+    {
+        const auto payload = createCompressiblePayload(PAYLOAD_SIZE, static_cast<uint8_t>(i));
+        const auto frameSize = encode(encoder, payload);
+
+        auto result = decoder.decode(frame.data(), frameSize, decoded.data(), decoded.size());
+        ASSERT_FALSE(result.has_error());
+        EXPECT_THAT(decoded, Eq(payload));
+    }
+    EXPECT_THAT(encoder.statistics().m_keyFrames, Eq(NUMBER_OF_FRAMES));
+}
+
+TEST_F(ChannelCodec_test, DeltaFramesResumeWhenThePayloadFitsTheMaxPayloadSizeAgain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5151ee95-cc4f-4149-b979-6406b8697cef");
+    ChannelCodec encoder(CodecType::XOR_DELTA, PAYLOAD_SIZE / 2U);
+    ChannelCodec decoder(CodecType::XOR_DELTA, PAYLOAD_SIZE / 2U);
+
+    encode(encoder, createCompressiblePayload(PAYLOAD_SIZE, 0U));
+    for (uint64_t i = 0U; i < 2U; ++i)
+    {
+        const auto payload = createCompressiblePayload(PAYLOAD_SIZE / 2U, static_cast<uint8_t>(i));
+        const auto frameSize = encode(encoder, payload);
+
+        auto result = decoder.decode(frame.data(), frameSize, decoded.data(), decoded.size());
+        ASSERT_FALSE(result.has_error());
+        EXPECT_TRUE(std::equal(payload.begin(), payload.end(), decoded.begin()));
+    }
+    EXPECT_THAT(encoder.statistics().m_keyFrames, Eq(2U));
+}
+
+TEST_F(ChannelCodec_test, EncodeIntoTooSmallFrameFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "89a21219-f627-4a04-a35c-ee30082d3a69");
+    ChannelCodec sut(CodecType::LZ);
+    const auto payload = createCompressiblePayload(PAYLOAD_SIZE, 0U);
+    frame.resize(PAYLOAD_SIZE);
+
+    auto result = sut.encode(payload.data(), PAYLOAD_SIZE, frame.data(), frame.size());
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(CodecError::BUFFER_TOO_SMALL));
+    EXPECT_THAT(sut.statistics().m_codecErrors, Eq(1U));
+}
+
+TEST_F(ChannelCodec_test, DecodeOfFrameFromOtherCodecFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d3f953ca-beae-4050-93de-934cbd73de0b");
+    ChannelCodec encoder(CodecType::LZ);
+    ChannelCodec decoder(CodecType::XOR_DELTA);
+    const auto frameSize = encode(encoder, createCompressiblePayload(PAYLOAD_SIZE, 0U));
+
+    auto result = decoder.decode(frame.data(), frameSize, decoded.data(), decoded.size());
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(CodecError::INVALID_DATA));
+
+    auto truncated =
+        encoder.decode(frame.data(), sizeof(ChannelCodec::FrameHeader) - 1U, decoded.data(), decoded.size());
+    ASSERT_TRUE(truncated.has_error());
+    EXPECT_THAT(truncated.get_error(), Eq(CodecError::INVALID_DATA));
+}
+
+TEST_F(ChannelCodec_test, StatisticsContainFramesBytesAndCompressionRatio)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6620f328-4435-40d1-b776-73c79d0a3469");
+    ChannelCodec sut(CodecType::LZ);
+    EXPECT_THAT(sut.statistics().compressionRatio(), Eq(0.0));
+
+    uint64_t encodedBytes{0U};
+    for (uint8_t i = 0U; i < 3U; ++i)
+    {
+        const auto frameSize = encode(sut, createCompressiblePayload(PAYLOAD_SIZE, i));
+        encodedBytes += frameSize;
+        ASSERT_FALSE(sut.decode(frame.data(), frameSize, decoded.data(), decoded.size()).has_error());
+    }
+
+    const auto statistics = sut.statistics();
+    EXPECT_THAT(statistics.m_encodedFrames, Eq(3U));
+    EXPECT_THAT(statistics.m_decodedFrames, Eq(3U));
+    EXPECT_THAT(statistics.m_rawBytes, Eq(3U * PAYLOAD_SIZE));
+    EXPECT_THAT(statistics.m_encodedBytes, Eq(encodedBytes));
+    EXPECT_THAT(statistics.compressionRatio(),
+                DoubleEq(static_cast<double>(3U * PAYLOAD_SIZE) / static_cast<double>(encodedBytes)));
+    EXPECT_THAT(statistics.compressionRatio(), Gt(4.0));
+}
+
+} // namespace
@@ -76,6 +76,28 @@ TEST_F(GatewayGenericTest, AddedChannelsAreStored)
     EXPECT_EQ(1U, sut->getNumberOfChannels());
 }
 
+TEST_F(GatewayGenericTest, AddedChannelsHaveTheRequestedCodec)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "66aba759-1fa0-4669-8811-fff369905ba1");
+    // ===== Setup
+    EXPECT_CALL(*sut, getInterface()).WillRepeatedly(Return(iox::capro::Interfaces::INTERNAL));
+    auto rawService = iox::capro::ServiceDescription("service", "instance", "raw");
+    auto encodedService = iox::capro::ServiceDescription("service", "instance", "encoded");
+
+    // ===== Test
+    ASSERT_FALSE(sut->addChannel(rawService, StubbedIceoryxTerminal::Options()).has_error());
+    ASSERT_FALSE(
+        sut->addChannel(encodedService, StubbedIceoryxTerminal::Options(), iox::gw::CodecType::XOR_DELTA).has_error());
+
+    auto rawChannel = sut->findChannel(rawService);
+    auto encodedChannel = sut->findChannel(encodedService);
+    ASSERT_TRUE(rawChannel.has_value());
+    ASSERT_TRUE(encodedChannel.has_value());
+    EXPECT_EQ(nullptr, rawChannel->getCodec());
+    ASSERT_NE(nullptr, encodedChannel->getCodec());
+    EXPECT_EQ(iox::gw::CodecType::XOR_DELTA, encodedChannel->getCodec()->codec());
+}
+
 TEST_F(GatewayGenericTest, DoesNotAddDuplicateChannels)
 {
     ::testing::Test::RecordProperty("TEST_ID", "fdd568b4-b377-48a3-8d2a-7f131bf1bba6");
@@ -0,0 +1,313 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object.hpp"
+#include "iceoryx_posh/gateway/shm_bridge_transfer.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/mepoo/chunk_settings.hpp"
+
+#include "test.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <new>
+#include <string>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::gw;
+
+// ======================================== Helpers ======================================== //
+
+constexpr char BRIDGE_NAME[] = "ShmBridgeTransfer_test";
+constexpr char PEER_SEGMENT_NAME[] = "iox_shm_bridge_test_peer_segment";
+constexpr char SHM_DIRECTORY[] = "/dev/shm";
+
+std::string transferSegmentPath()
+{
+    return std::string(SHM_DIRECTORY) + "/" + ShmBridgeTransfer::transferSegmentName(BRIDGE_NAME).c_str();
+}
+
+// ======================================== Fixture ======================================== //
+class ShmBridgeTransfer_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        auto transfer = ShmBridgeTransfer::create(BRIDGE_NAME);
+        ASSERT_FALSE(transfer.has_error());
+        m_sender.emplace(std::move(transfer.value()));
+    }
+
+    /// @brief a shared memory of the sending system with a single chunk
+    void createPeerSegment()
+    {
+        auto sharedMemory = posix::SharedMemoryObjectBuilder()
+                                .name(PEER_SEGMENT_NAME)
+                                .memorySizeInBytes(PEER_SEGMENT_SIZE)
+                                .accessMode(posix::AccessMode::READ_WRITE)
+                                .openMode(posix::OpenMode::PURGE_AND_CREATE)
+                                .permissions(cxx::perms::owner_all)
+                                .create();
+        ASSERT_FALSE(sharedMemory.has_error());
+        m_peerSegment.emplace(std::move(sharedMemory.value()));
+
+        auto chunkSettings = mepoo::ChunkSettings::create(
+            USER_PAYLOAD_SIZE, USER_PAYLOAD_ALIGNMENT, sizeof(uint64_t), alignof(uint64_t));
+        ASSERT_FALSE(chunkSettings.has_error());
+        auto base = static_cast<uint8_t*>(m_peerSegment->getBaseAddress());
+        m_peerChunk = new (base + CHUNK_OFFSET) mepoo::ChunkHeader(chunkSettings->requiredChunkSize(), *chunkSettings);
+        static_cast<uint8_t*>(m_peerChunk->userPayload())[0] = 73U;
+    }
+
+    static constexpr uint64_t PEER_SEGMENT_SIZE{4096U};
+    static constexpr uint64_t CHUNK_OFFSET{512U};
+    static constexpr uint32_t USER_PAYLOAD_SIZE{256U};
+    static constexpr uint32_t USER_PAYLOAD_ALIGNMENT{32U};
+
+    cxx::optional<ShmBridgeTransfer> m_sender;
+    cxx::optional<posix::SharedMemoryObject> m_peerSegment;
+    mepoo::ChunkHeader* m_peerChunk{nullptr};
+};
+
+constexpr uint64_t ShmBridgeTransfer_test::PEER_SEGMENT_SIZE;
+constexpr uint64_t ShmBridgeTransfer_test::CHUNK_OFFSET;
+constexpr uint32_t ShmBridgeTransfer_test::USER_PAYLOAD_SIZE;
+constexpr uint32_t ShmBridgeTransfer_test::USER_PAYLOAD_ALIGNMENT;
+
+// ======================================== Tests ======================================== //
+TEST_F(ShmBridgeTransfer_test, ReceiverSharesTheTransferSegmentOfTheSender)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d25d4d5e-6b8b-49f6-99a4-afdff1182625");
+    auto receiver = ShmBridgeTransfer::open(transferSegmentPath());
+    ASSERT_FALSE(receiver.has_error());
+
+    m_sender->data().m_lanes[3].m_writeIndex.store(42U);
+    EXPECT_THAT(receiver->data().m_lanes[3].m_writeIndex.load(), Eq(42U));
+    receiver->data().m_lanes[3].m_readIndex.store(42U);
+    EXPECT_THAT(m_sender->data().m_lanes[3].m_readIndex.load(), Eq(42U));
+}
+
+TEST_F(ShmBridgeTransfer_test, OpeningAMissingTransferSegmentFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cb501379-1346-4ded-8170-fafe2c0fdf7b");
+    auto receiver = ShmBridgeTransfer::open(std::string(SHM_DIRECTORY) + "/iox_shm_bridge_does_not_exist");
+    ASSERT_TRUE(receiver.has_error());
+    EXPECT_THAT(receiver.get_error(), Eq(ShmBridgeError::UNABLE_TO_OPEN_TRANSFER_SEGMENT));
+}
+
+TEST_F(ShmBridgeTransfer_test, OpeningAnIncompatibleTransferSegmentFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "30b25788-bbb5-4eab-bc17-9c651cc2a2e1");
+    const std::string path{std::string(SHM_DIRECTORY) + "/iox_shm_bridge_incompatible"};
+    {
+        std::ofstream file(path);
+        file << "this is not a transfer segment";
+    }
+
+    auto receiver = ShmBridgeTransfer::open(path);
+    std::remove(path.c_str());
+
+    ASSERT_TRUE(receiver.has_error());
+    EXPECT_THAT(receiver.get_error(), Eq(ShmBridgeError::INCOMPATIBLE_TRANSFER_SEGMENT));
+}
+
+TEST_F(ShmBridgeTransfer_test, RecreatedTransferSegmentIsStale)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "65934e3b-8b76-44a0-93ab-3d4466236766");
+    auto receiver = ShmBridgeTransfer::open(transferSegmentPath());
+    ASSERT_FALSE(receiver.has_error());
+    EXPECT_FALSE(receiver->isStale());
+
+    m_sender.reset();
+    EXPECT_TRUE(receiver->isStale());
+
+    SetUp();
+    EXPECT_TRUE(receiver->isStale());
+    auto reopenedReceiver = ShmBridgeTransfer::open(transferSegmentPath());
+    ASSERT_FALSE(reopenedReceiver.has_error());
+    EXPECT_FALSE(reopenedReceiver->isStale());
+}
+
+TEST_F(ShmBridgeTransfer_test, OpenLanePublishesTheService)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "467855cc-bd89-43f8-938b-53264c2c6009");
+    const capro::ServiceDescription service{"Radar", "Front", "Objects"};
+    const auto generation = m_sender->data().m_laneGeneration.load();
+
+    auto laneIndex = m_sender->openLane(service);
+    ASSERT_FALSE(laneIndex.has_error());
+
+    const auto& lane = m_sender->data().m_lanes[laneIndex.value()];
+    EXPECT_TRUE(lane.m_isOpen.load());
+    EXPECT_THAT(lane.m_activation.load(), Eq(1U));
+    EXPECT_THAT(lane.m_service, Eq(service));
+    EXPECT_THAT(m_sender->data().m_laneGeneration.load(), Gt(generation));
+}
+
+TEST_F(ShmBridgeTransfer_test, ClosedLaneIsReusedWhenItWasConsumed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "25326a45-64e2-4ff0-869f-8e948594a426");
+    auto firstLane = m_sender->openLane({"Radar", "Front", "Objects"});
+    ASSERT_FALSE(firstLane.has_error());
+    auto& lane = m_sender->data().m_lanes[firstLane.value()];
+    lane.m_writeIndex.store(5U);
+    m_sender->closeLane(firstLane.value());
+    EXPECT_FALSE(lane.m_isOpen.load());
+
+    auto secondLane = m_sender->openLane({"Radar", "Rear", "Objects"});
+    ASSERT_FALSE(secondLane.has_error());
+    EXPECT_THAT(secondLane.value(), Ne(firstLane.value()));
+
+    lane.m_readIndex.store(5U);
+    auto thirdLane = m_sender->openLane({"Radar", "Left", "Objects"});
+    ASSERT_FALSE(thirdLane.has_error());
+    EXPECT_THAT(thirdLane.value(), Eq(firstLane.value()));
+    EXPECT_THAT(lane.m_activation.load(), Eq(2U));
+}
+
+TEST_F(ShmBridgeTransfer_test, OpeningMoreLanesThanAvailableFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f165e2ba-f8c9-47ba-9f09-9f5e98b00dd2");
+    for (uint32_t i = 0U; i < ShmBridgeTransferData::MAX_LANES; ++i)
+    {
+        ASSERT_FALSE(m_sender->openLane({"Radar", "Front", "Objects"}).has_error());
+    }
+
+    auto laneIndex = m_sender->openLane({"Radar", "Front", "Objects"});
+    ASSERT_TRUE(laneIndex.has_error());
+    EXPECT_THAT(laneIndex.get_error(), Eq(ShmBridgeError::TOO_MANY_LANES));
+}
+
+TEST_F(ShmBridgeTransfer_test, SegmentNameIsAddedOnlyOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1e372a97-7a67-4776-9451-84daf3c988cc");
+    auto first = m_sender->segmentIndex("segment_a");
+    auto second = m_sender->segmentIndex("segment_b");
+    auto firstAgain = m_sender->segmentIndex("segment_a");
+
+    ASSERT_FALSE(first.has_error());
+    ASSERT_FALSE(second.has_error());
+    ASSERT_FALSE(firstAgain.has_error());
+    EXPECT_THAT(second.value(), Ne(first.value()));
+    EXPECT_THAT(firstAgain.value(), Eq(first.value()));
+    EXPECT_THAT(m_sender->data().m_numberOfSegments.load(), Eq(2U));
+    EXPECT_THAT(m_sender->data().m_segmentNames[second.value()], Eq(ShmName_t("segment_b")));
+}
+
+TEST_F(ShmBridgeTransfer_test, PeerChunkIsResolvedFromItsDescriptor)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f9359971-bd06-4475-afb3-f5e0a6ab0cae");
+    createPeerSegment();
+    auto segmentIndex = m_sender->segmentIndex(PEER_SEGMENT_NAME);
+    ASSERT_FALSE(segmentIndex.has_error());
+
+    ShmBridgeChunkDescriptor descriptor;
+    descriptor.m_segmentIndex = segmentIndex.value();
+    descriptor.m_chunkOffset = CHUNK_OFFSET;
+    ShmBridgePeerSegments peerSegments(SHM_DIRECTORY);
+    auto chunkHeader = peerSegments.resolve(m_sender->data(), descriptor);
+
+    ASSERT_FALSE(chunkHeader.has_error());
+    EXPECT_THAT(chunkHeader.value(), Ne(m_peerChunk));
+    EXPECT_THAT(chunkHeader.value()->userPayloadSize(), Eq(USER_PAYLOAD_SIZE));
+    EXPECT_THAT(chunkHeader.value()->userPayloadAlignment(), Eq(USER_PAYLOAD_ALIGNMENT));
+    EXPECT_THAT(static_cast<const uint8_t*>(chunkHeader.value()->userPayload())[0], Eq(73U));
+}
+
+TEST_F(ShmBridgeTransfer_test, DescriptorOutsideOfThePeerSegmentIsRejected)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c49c69a3-f385-41f4-9c72-2673e2c1d438");
+    createPeerSegment();
+    auto segmentIndex = m_sender->segmentIndex(PEER_SEGMENT_NAME);
+    ASSERT_FALSE(segmentIndex.has_error());
+    ShmBridgePeerSegments peerSegments(SHM_DIRECTORY);
+
+    ShmBridgeChunkDescriptor descriptor;
+    descriptor.m_segmentIndex = segmentIndex.value();
+    descriptor.m_chunkOffset = PEER_SEGMENT_SIZE - 8U;
+    auto chunkHeader = peerSegments.resolve(m_sender->data(), descriptor);
+    ASSERT_TRUE(chunkHeader.has_error());
+    EXPECT_THAT(chunkHeader.get_error(), Eq(ShmBridgeError::INVALID_CHUNK));
+
+    descriptor.m_segmentIndex = segmentIndex.value() + 1U;
+    descriptor.m_chunkOffset = CHUNK_OFFSET;
+    chunkHeader = peerSegments.resolve(m_sender->data(), descriptor);
+    ASSERT_TRUE(chunkHeader.has_error());
+    EXPECT_THAT(chunkHeader.get_error(), Eq(ShmBridgeError::INVALID_CHUNK));
+}
+
+TEST_F(ShmBridgeTransfer_test, ChunkExceedingThePeerSegmentIsRejected)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "43c9c028-79cf-4a48-a9d0-27ee86434fef");
+    createPeerSegment();
+    auto segmentIndex = m_sender->segmentIndex(PEER_SEGMENT_NAME);
+    ASSERT_FALSE(segmentIndex.has_error());
+    ShmBridgePeerSegments peerSegments(SHM_DIRECTORY);
+
+    // a chunk header in the last bytes of the segment which claims a larger chunk
+    ShmBridgeChunkDescriptor descriptor;
+    descriptor.m_segmentIndex = segmentIndex.value();
+    descriptor.m_chunkOffset = PEER_SEGMENT_SIZE - sizeof(mepoo::ChunkHeader);
+    std::memcpy(static_cast<uint8_t*>(m_peerSegment->getBaseAddress()) + descriptor.m_chunkOffset,
+                m_peerChunk,
+                sizeof(mepoo::ChunkHeader));
+
+    auto chunkHeader = peerSegments.resolve(m_sender->data(), descriptor);
+    ASSERT_TRUE(chunkHeader.has_error());
+    EXPECT_THAT(chunkHeader.get_error(), Eq(ShmBridgeError::INVALID_CHUNK));
+}
+
+TEST_F(ShmBridgeTransfer_test, HeadChunkOfAMultiChunkSampleIsRejected)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "526581ff-5393-42a7-8f73-1f1136a6549a");
+    createPeerSegment();
+    auto segmentIndex = m_sender->segmentIndex(PEER_SEGMENT_NAME);
+    ASSERT_FALSE(segmentIndex.has_error());
+    ShmBridgePeerSegments peerSegments(SHM_DIRECTORY);
+
+    // the flags directly follow the chunk header version, bit 0 marks the head chunk of a multi-chunk sample
+    constexpr uint64_t CHUNK_HEADER_FLAGS_OFFSET{sizeof(uint32_t) + sizeof(uint8_t)};
+    reinterpret_cast<uint8_t*>(m_peerChunk)[CHUNK_HEADER_FLAGS_OFFSET] = 1U;
+    ASSERT_TRUE(m_peerChunk->isMultiChunk());
+
+    ShmBridgeChunkDescriptor descriptor;
+    descriptor.m_segmentIndex = segmentIndex.value();
+    descriptor.m_chunkOffset = CHUNK_OFFSET;
+    auto chunkHeader = peerSegments.resolve(m_sender->data(), descriptor);
+    ASSERT_TRUE(chunkHeader.has_error());
+    EXPECT_THAT(chunkHeader.get_error(), Eq(ShmBridgeError::MULTI_CHUNK_SAMPLE));
+}
+
+TEST_F(ShmBridgeTransfer_test, SegmentNameWithAPathIsNotMapped)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a2511959-8eec-46d8-b271-557deeced90e");
+    auto segmentIndex = m_sender->segmentIndex("../etc/passwd");
+    ASSERT_FALSE(segmentIndex.has_error());
+    ShmBridgePeerSegments peerSegments(SHM_DIRECTORY);
+
+    ShmBridgeChunkDescriptor descriptor;
+    descriptor.m_segmentIndex = segmentIndex.value();
+    auto chunkHeader = peerSegments.resolve(m_sender->data(), descriptor);
+    ASSERT_TRUE(chunkHeader.has_error());
+    EXPECT_THAT(chunkHeader.get_error(), Eq(ShmBridgeError::UNABLE_TO_MAP_PEER_SEGMENT));
+}
+
+} // namespace
@@ -55,6 +55,8 @@ TEST(ChunkHeader_test, ChunkHeaderHasInitializedMembers)
 
     EXPECT_THAT(sut.sequenceNumber(), Eq(0U));
 
+    EXPECT_FALSE(sut.isMultiChunk());
+
     EXPECT_THAT(sut.userHeaderId(), Eq(ChunkHeader::NO_USER_HEADER));
     EXPECT_THAT(sut.userHeaderSize(), Eq(0U));
     EXPECT_THAT(sut.userPayloadSize(), Eq(USER_PAYLOAD_SIZE));
@@ -78,7 +80,7 @@ TEST(ChunkHeader_test, ChunkHeaderBinaryCompatibilityCheck)
     {
         uint32_t chunkSize{0U};
         uint8_t chunkHeaderVersion{0U};
-        uint8_t reserved{0U};
+        uint8_t flags{0U};
         uint16_t userHeaderId{0};
         uint64_t originId{0U};
         uint64_t sequenceNumber{0U};
@@ -128,6 +130,11 @@ TEST(ChunkHeader_test, ChunkHeaderBinaryCompatibilityCheck)
     auto originId = static_cast<OriginIdType>(reinterpret_cast<ChunkHeader*>(&sut)->originId());
     EXPECT_THAT(originId, Eq(PATTERN));
 
+    // special handling for flags since only the single bits can be accessed
+    zeroizeSut();
+    sut.flags = 1U;
+    EXPECT_TRUE(reinterpret_cast<ChunkHeader*>(&sut)->isMultiChunk());
+
     // special handling for userPayloadOffset since it cannot easily be accessed
     zeroizeSut();
     sut.userPayloadOffset = PATTERN;
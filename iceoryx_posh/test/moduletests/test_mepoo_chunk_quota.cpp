@@ -0,0 +1,209 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/internal/mepoo/chunk_quota.hpp"
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+using iox::mepoo::ChunkQuota;
+using iox::mepoo::MemPoolAccounting;
+using iox::mepoo::MemPoolQuota;
+
+class ChunkQuota_test : public Test
+{
+  public:
+    /// @brief accounts a chunk like the MemoryManager and takes it from the simulated mempool
+    iox::cxx::expected<MemPoolAccounting::Error> acquireChunk(MemPoolQuota* const quota)
+    {
+        auto result = sut.acquireChunk(quota, usedChunks);
+        if (!result.has_error())
+        {
+            ++usedChunks;
+        }
+        return result;
+    }
+
+    void acquireChunks(MemPoolQuota* const quota, const uint32_t numberOfChunks)
+    {
+        for (uint32_t i = 0U; i < numberOfChunks; ++i)
+        {
+            ASSERT_FALSE(acquireChunk(quota).has_error());
+        }
+    }
+
+    void releaseChunk(MemPoolQuota* const quota)
+    {
+        --usedChunks;
+        sut.releaseChunk(quota);
+    }
+
+    static constexpr uint32_t CAPACITY{10U};
+    uint32_t usedChunks{0U};
+    MemPoolAccounting sut{CAPACITY};
+    ChunkQuota chunkQuota;
+    MemPoolQuota& quota{chunkQuota.memPoolQuota(0U)};
+};
+
+TEST_F(ChunkQuota_test, ChunksWithoutQuotaCanBeAcquiredUpToTheCapacity)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c995b278-55ec-41d0-8451-9e27edabce0b");
+    acquireChunks(nullptr, CAPACITY);
+
+    auto result = acquireChunk(nullptr);
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(MemPoolAccounting::Error::NO_UNRESERVED_CHUNKS));
+    EXPECT_THAT(sut.getNumberOfRejectedRequests(), Eq(1U));
+}
+
+TEST_F(ChunkQuota_test, ReservationIsMadeWithTheFirstChunkAndKeptFreeForTheQuota)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "be07f96d-77c3-4b08-b3e8-e67de54ba1f6");
+    constexpr uint32_t RESERVED_CHUNKS{4U};
+    quota.reset(RESERVED_CHUNKS, 0U);
+    EXPECT_THAT(sut.getReservedChunks(), Eq(0U));
+
+    acquireChunks(&quota, 1U);
+    EXPECT_THAT(sut.getReservedChunks(), Eq(RESERVED_CHUNKS));
+    EXPECT_THAT(quota.getReservedChunks(), Eq(RESERVED_CHUNKS));
+
+    acquireChunks(nullptr, CAPACITY - RESERVED_CHUNKS);
+    EXPECT_TRUE(acquireChunk(nullptr).has_error());
+
+    acquireChunks(&quota, RESERVED_CHUNKS - 1U);
+    EXPECT_THAT(quota.getUsedChunks(), Eq(RESERVED_CHUNKS));
+    EXPECT_TRUE(acquireChunk(&quota).has_error());
+}
+
+TEST_F(ChunkQuota_test, ReservationIsLimitedToTheChunksWhichAreNotInUse)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "25442d06-38d0-470e-9d27-4d0769a2834c");
+    constexpr uint32_t USED_CHUNKS{8U};
+    quota.reset(CAPACITY, 0U);
+    acquireChunks(nullptr, USED_CHUNKS);
+
+    acquireChunks(&quota, 1U);
+
+    EXPECT_THAT(quota.getReservedChunks(), Eq(CAPACITY - USED_CHUNKS));
+    EXPECT_THAT(sut.getReservedChunks(), Eq(CAPACITY - USED_CHUNKS));
+}
+
+TEST_F(ChunkQuota_test, ChunksBeyondTheReservationAreTakenFromTheUnreservedChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7ab33dd4-ce17-4f12-a4ac-d28461a55590");
+    constexpr uint32_t RESERVED_CHUNKS{2U};
+    constexpr uint32_t UNRESERVED_CHUNKS{3U};
+    quota.reset(RESERVED_CHUNKS, 0U);
+
+    acquireChunks(&quota, RESERVED_CHUNKS + UNRESERVED_CHUNKS);
+    EXPECT_THAT(sut.getUnreservedUsedChunks(), Eq(UNRESERVED_CHUNKS));
+
+    for (uint32_t i = 0U; i < UNRESERVED_CHUNKS + 1U; ++i)
+    {
+        releaseChunk(&quota);
+    }
+    EXPECT_THAT(sut.getUnreservedUsedChunks(), Eq(0U));
+    EXPECT_THAT(quota.getUsedChunks(), Eq(RESERVED_CHUNKS - 1U));
+}
+
+TEST_F(ChunkQuota_test, AcquiringMoreChunksThanTheMaximumFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c02ee107-53b2-4800-af74-b9b2acd2d07d");
+    constexpr uint32_t MAX_CHUNKS{3U};
+    quota.reset(0U, MAX_CHUNKS);
+    acquireChunks(&quota, MAX_CHUNKS);
+
+    auto result = acquireChunk(&quota);
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(MemPoolAccounting::Error::CHUNK_QUOTA_EXCEEDED));
+    EXPECT_THAT(sut.getNumberOfRejectedRequests(), Eq(1U));
+
+    releaseChunk(&quota);
+    EXPECT_FALSE(acquireChunk(&quota).has_error());
+}
+
+TEST_F(ChunkQuota_test, ReturningTheReservationAccountsTheUsedChunksAsUnreserved)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9d666355-9ff2-4d1d-90a7-b6930e9ff86c");
+    constexpr uint32_t RESERVED_CHUNKS{4U};
+    constexpr uint32_t USED_CHUNKS{2U};
+    quota.reset(RESERVED_CHUNKS, 0U);
+    acquireChunks(&quota, USED_CHUNKS);
+
+    sut.returnReservation(quota);
+
+    EXPECT_THAT(sut.getReservedChunks(), Eq(0U));
+    EXPECT_THAT(sut.getUnreservedUsedChunks(), Eq(USED_CHUNKS));
+    EXPECT_FALSE(chunkQuota.isDrained());
+
+    releaseChunk(&quota);
+    releaseChunk(&quota);
+    EXPECT_THAT(sut.getUnreservedUsedChunks(), Eq(0U));
+    EXPECT_TRUE(chunkQuota.isDrained());
+}
+
+TEST_F(ChunkQuota_test, AddedCapacityCanBeAcquired)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "360a6d7b-f3ca-4fb6-a48a-eb995463f003");
+    constexpr uint32_t ADDED_CHUNKS{5U};
+    acquireChunks(nullptr, CAPACITY);
+
+    sut.addCapacity(ADDED_CHUNKS);
+
+    EXPECT_THAT(sut.getCapacity(), Eq(CAPACITY + ADDED_CHUNKS));
+    acquireChunks(nullptr, ADDED_CHUNKS);
+    EXPECT_TRUE(acquireChunk(nullptr).has_error());
+}
+
+TEST_F(ChunkQuota_test, ChunksWithoutAccountingAreNotReserved)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "61e4001f-7c3c-4d98-ac25-689a0885f1f8");
+    constexpr uint32_t CHUNKS_WITHOUT_ACCOUNTING{8U};
+    EXPECT_FALSE(sut.hasReservedChunks());
+    usedChunks += CHUNKS_WITHOUT_ACCOUNTING;
+    quota.reset(CAPACITY, 0U);
+
+    acquireChunks(&quota, 1U);
+
+    EXPECT_TRUE(sut.hasReservedChunks());
+    EXPECT_THAT(quota.getReservedChunks(), Eq(CAPACITY - CHUNKS_WITHOUT_ACCOUNTING));
+    EXPECT_THAT(sut.getUnreservedUsedChunks(), Eq(0U));
+}
+
+TEST_F(ChunkQuota_test, ChunksWithoutAccountingAreNotAvailableForRequestsWithoutQuota)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cc055887-b5ac-4260-9108-d29a93d8dd55");
+    constexpr uint32_t RESERVED_CHUNKS{2U};
+    constexpr uint32_t CHUNKS_WITHOUT_ACCOUNTING{5U};
+    quota.reset(RESERVED_CHUNKS, 0U);
+    acquireChunks(&quota, 1U);
+    usedChunks += CHUNKS_WITHOUT_ACCOUNTING;
+
+    acquireChunks(nullptr, CAPACITY - RESERVED_CHUNKS - CHUNKS_WITHOUT_ACCOUNTING);
+    EXPECT_TRUE(acquireChunk(nullptr).has_error());
+
+    // the chunks without accounting are returned to the mempool without releasing them from the accounting
+    usedChunks -= CHUNKS_WITHOUT_ACCOUNTING;
+    acquireChunks(nullptr, CHUNKS_WITHOUT_ACCOUNTING);
+    EXPECT_TRUE(acquireChunk(nullptr).has_error());
+    acquireChunks(&quota, RESERVED_CHUNKS - 1U);
+}
+
+} // namespace
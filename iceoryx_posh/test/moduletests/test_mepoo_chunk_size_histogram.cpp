@@ -0,0 +1,171 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/internal/mepoo/chunk_size_histogram.hpp"
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+using iox::mepoo::ChunkSizeHistogram;
+
+class ChunkSizeHistogram_test : public Test
+{
+  public:
+    ChunkSizeHistogram sut;
+};
+
+TEST_F(ChunkSizeHistogram_test, SizesUpToTheMinimalUpperBoundAreInTheFirstBucket)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "abe93fec-bc6f-4457-8283-e0a0f9fa1992");
+    EXPECT_THAT(ChunkSizeHistogram::bucketIndex(0U), Eq(0U));
+    EXPECT_THAT(ChunkSizeHistogram::bucketIndex(ChunkSizeHistogram::MIN_BUCKET_UPPER_BOUND), Eq(0U));
+    EXPECT_THAT(ChunkSizeHistogram::bucketIndex(ChunkSizeHistogram::MIN_BUCKET_UPPER_BOUND + 1U), Eq(1U));
+    EXPECT_THAT(ChunkSizeHistogram::bucketUpperBound(0U), Eq(ChunkSizeHistogram::MIN_BUCKET_UPPER_BOUND));
+}
+
+TEST_F(ChunkSizeHistogram_test, EveryPowerOfTwoIsSplitIntoFourBuckets)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9f1514e0-3156-4c99-95fb-7982491dd42f");
+    const auto bucket = ChunkSizeHistogram::bucketIndex(1024U);
+
+    EXPECT_THAT(ChunkSizeHistogram::bucketUpperBound(bucket), Eq(1024U));
+    EXPECT_THAT(ChunkSizeHistogram::bucketIndex(1025U), Eq(bucket + 1U));
+    EXPECT_THAT(ChunkSizeHistogram::bucketUpperBound(bucket + 1U), Eq(1280U));
+    EXPECT_THAT(ChunkSizeHistogram::bucketUpperBound(bucket + 2U), Eq(1536U));
+    EXPECT_THAT(ChunkSizeHistogram::bucketUpperBound(bucket + 3U), Eq(1792U));
+    EXPECT_THAT(ChunkSizeHistogram::bucketUpperBound(bucket + 4U), Eq(2048U));
+}
+
+TEST_F(ChunkSizeHistogram_test, EverySizeIsInTheBucketWithTheNextLargerOrEqualUpperBound)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "481a43d6-2d8a-4798-ad01-0600e4c2e1f7");
+    for (uint64_t size = ChunkSizeHistogram::MIN_BUCKET_UPPER_BOUND + 1U; size < 100000U; ++size)
+    {
+        const auto bucket = ChunkSizeHistogram::bucketIndex(size);
+        ASSERT_THAT(bucket, Gt(0U));
+        EXPECT_THAT(ChunkSizeHistogram::bucketUpperBound(bucket), Ge(size));
+        EXPECT_THAT(ChunkSizeHistogram::bucketUpperBound(bucket - 1U), Lt(size));
+    }
+}
+
+TEST_F(ChunkSizeHistogram_test, TheLargestSizeIsInTheLastBucket)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "17916cee-a317-4fc4-b37c-7e4942ea0d29");
+    constexpr uint32_t LAST_BUCKET{ChunkSizeHistogram::NUMBER_OF_BUCKETS - 1U};
+
+    EXPECT_THAT(ChunkSizeHistogram::bucketIndex(ChunkSizeHistogram::MAX_SIZE), Eq(LAST_BUCKET));
+    EXPECT_THAT(ChunkSizeHistogram::bucketIndex(ChunkSizeHistogram::MAX_SIZE - 1U), Eq(LAST_BUCKET));
+    EXPECT_THAT(ChunkSizeHistogram::bucketUpperBound(LAST_BUCKET), Eq(ChunkSizeHistogram::MAX_SIZE));
+}
+
+TEST_F(ChunkSizeHistogram_test, RecordIncrementsTheCountOfTheBucket)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "da3ed8ee-65de-47a5-ad60-6756e16dc9a7");
+    sut.record(100U);
+    sut.record(100U);
+    sut.record(5000U);
+
+    for (uint32_t bucket = 0U; bucket < ChunkSizeHistogram::NUMBER_OF_BUCKETS; ++bucket)
+    {
+        uint64_t expectedCount{0U};
+        if (bucket == ChunkSizeHistogram::bucketIndex(100U))
+        {
+            expectedCount = 2U;
+        }
+        else if (bucket == ChunkSizeHistogram::bucketIndex(5000U))
+        {
+            expectedCount = 1U;
+        }
+        EXPECT_THAT(sut.count(bucket), Eq(expectedCount));
+    }
+}
+
+TEST_F(ChunkSizeHistogram_test, RecordAddsTheCountAtPowersOfTwoUpToTheSampleInterval)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "93fc627d-93ec-4d76-b02b-c7d3ecbb7ff8");
+    constexpr uint64_t SIZE{100U};
+    const auto bucket = ChunkSizeHistogram::bucketIndex(SIZE);
+
+    uint64_t expectedCount{1U};
+    for (uint64_t i = 1U; i <= ChunkSizeHistogram::SAMPLE_INTERVAL; ++i)
+    {
+        sut.record(SIZE);
+        if (i == 2U * expectedCount)
+        {
+            expectedCount = i;
+        }
+        EXPECT_THAT(sut.count(bucket), Eq(expectedCount));
+    }
+    EXPECT_THAT(sut.count(bucket), Eq(ChunkSizeHistogram::SAMPLE_INTERVAL));
+}
+
+TEST_F(ChunkSizeHistogram_test, RecordIsSampledBeyondTheSampleInterval)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c25ba460-34f9-43ad-b002-5c109bf81209");
+    constexpr uint64_t SIZE{100U};
+    constexpr uint64_t NUMBER_OF_SAMPLES{3U};
+    const auto bucket = ChunkSizeHistogram::bucketIndex(SIZE);
+
+    for (uint64_t i = 0U; i < (NUMBER_OF_SAMPLES + 1U) * ChunkSizeHistogram::SAMPLE_INTERVAL - 1U; ++i)
+    {
+        sut.record(SIZE);
+    }
+    EXPECT_THAT(sut.count(bucket), Eq(NUMBER_OF_SAMPLES * ChunkSizeHistogram::SAMPLE_INTERVAL));
+
+    sut.record(SIZE);
+    EXPECT_THAT(sut.count(bucket), Eq((NUMBER_OF_SAMPLES + 1U) * ChunkSizeHistogram::SAMPLE_INTERVAL));
+}
+
+TEST_F(ChunkSizeHistogram_test, SampledCountsOfInterleavedBucketsAreIndependent)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "79b17e46-a50f-4ab0-81d3-531b3042fa1d");
+    constexpr uint64_t FREQUENT_SIZE{100U};
+    constexpr uint64_t RARE_SIZE{5000U};
+    constexpr uint64_t NUMBER_OF_SAMPLES{10U};
+
+    // every SAMPLE_INTERVAL-th request is the rare size, a sample counter shared by the buckets would credit all
+    // samples to it
+    for (uint64_t i = 1U; i <= NUMBER_OF_SAMPLES * ChunkSizeHistogram::SAMPLE_INTERVAL; ++i)
+    {
+        sut.record((i % ChunkSizeHistogram::SAMPLE_INTERVAL == 0U) ? RARE_SIZE : FREQUENT_SIZE);
+    }
+
+    const auto frequentCount = sut.count(ChunkSizeHistogram::bucketIndex(FREQUENT_SIZE));
+    EXPECT_THAT(frequentCount, Ge((NUMBER_OF_SAMPLES - 1U) * (ChunkSizeHistogram::SAMPLE_INTERVAL - 1U)));
+    EXPECT_THAT(frequentCount, Le(NUMBER_OF_SAMPLES * (ChunkSizeHistogram::SAMPLE_INTERVAL - 1U)));
+    EXPECT_THAT(sut.count(ChunkSizeHistogram::bucketIndex(RARE_SIZE)), Eq(8U));
+}
+
+TEST_F(ChunkSizeHistogram_test, SampledCountsOfInterleavedHistogramsAreIndependent)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b348a5c2-f24f-479c-b738-66277fbe1b2c");
+    constexpr uint64_t SIZE{100U};
+    const auto bucket = ChunkSizeHistogram::bucketIndex(SIZE);
+    ChunkSizeHistogram otherHistogram;
+
+    for (uint64_t i = 0U; i < 2U * ChunkSizeHistogram::SAMPLE_INTERVAL; ++i)
+    {
+        sut.record(SIZE);
+        otherHistogram.record(SIZE);
+    }
+
+    EXPECT_THAT(sut.count(bucket), Eq(2U * ChunkSizeHistogram::SAMPLE_INTERVAL));
+    EXPECT_THAT(otherHistogram.count(bucket), Eq(2U * ChunkSizeHistogram::SAMPLE_INTERVAL));
+}
+
+} // namespace
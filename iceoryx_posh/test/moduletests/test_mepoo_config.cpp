@@ -113,6 +113,43 @@ TEST_F(MePooConfig_Test, OptimizeMethodCombinesTwoMempoolWithSameSizeAndDoublesT
     EXPECT_THAT(sut.m_mempoolConfig[0].m_chunkCount, Eq(CHUNK_COUNT * 2U));
 }
 
+TEST_F(MePooConfig_Test, OptimizeMethodKeepsTheLargestExtentChunkCountWhenCombiningMempoolsWithSameSize)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fd9c6e5c-966d-4554-8c90-bc591717bde1");
+    MePooConfig sut;
+    constexpr uint32_t CHUNK_COUNT{100U};
+    constexpr uint32_t SIZE{100U};
+    constexpr uint32_t EXTENT_CHUNK_COUNT{42U};
+    sut.addMemPool({SIZE, CHUNK_COUNT});
+    sut.addMemPool({SIZE, CHUNK_COUNT, EXTENT_CHUNK_COUNT});
+    sut.addMemPool({SIZE, CHUNK_COUNT, EXTENT_CHUNK_COUNT / 2U});
+
+    sut.optimize();
+
+    ASSERT_THAT(sut.m_mempoolConfig.size(), Eq(1U));
+    EXPECT_THAT(sut.m_mempoolConfig[0].m_chunkCount, Eq(CHUNK_COUNT * 3U));
+    EXPECT_THAT(sut.m_mempoolConfig[0].m_extentChunkCount, Eq(EXTENT_CHUNK_COUNT));
+}
+
+TEST_F(MePooConfig_Test, OptimizeMethodKeepsMempoolsWithSameSizeOnDifferentNumaNodesSeparate)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a468fe5d-e1b0-4f38-8b86-f1f50fb2ce1f");
+    MePooConfig sut;
+    constexpr uint32_t CHUNK_COUNT{100U};
+    constexpr uint32_t SIZE{100U};
+    sut.addMemPool({SIZE, CHUNK_COUNT, 0U, 1U});
+    sut.addMemPool({SIZE, CHUNK_COUNT, 0U, 0U});
+    sut.addMemPool({SIZE, CHUNK_COUNT, 0U, 1U});
+
+    sut.optimize();
+
+    ASSERT_THAT(sut.m_mempoolConfig.size(), Eq(2U));
+    EXPECT_THAT(sut.m_mempoolConfig[0].m_numaNode, Eq(0U));
+    EXPECT_THAT(sut.m_mempoolConfig[0].m_chunkCount, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut.m_mempoolConfig[1].m_numaNode, Eq(1U));
+    EXPECT_THAT(sut.m_mempoolConfig[1].m_chunkCount, Eq(CHUNK_COUNT * 2U));
+}
+
 TEST_F(MePooConfig_Test, OptimizeMethodRemovesTheMempoolWithSizeZeroInTheMemPoolConfigContainer)
 {
     ::testing::Test::RecordProperty("TEST_ID", "56209c3e-8b69-45cd-8ea5-ef347152ff7c");
@@ -18,7 +18,9 @@
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
 #include "iceoryx_hoofs/testing/mocks/logger_mock.hpp"
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/unique_port_id.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iceoryx_posh/mepoo/numa_placement.hpp"
 #include "test.hpp"
 
 namespace
@@ -475,6 +477,414 @@ TEST_F(MemoryManager_test, addMemPoolWithChunkCountZeroShouldFail)
     EXPECT_DEATH({ sut->configureMemoryManager(mempoolconf, *allocator, *allocator); }, ".*");
 }
 
+TEST_F(MemoryManager_test, GetChunkRecordsTheRequestedChunkPayloadSizes)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "14dd8bed-86ff-4c20-8a1c-228423d71401");
+    using iox::mepoo::ChunkSizeHistogram;
+    constexpr uint32_t CHUNK_COUNT{10U};
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_256, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore32 = getChunksFromSut(2U, chunkSettings_32);
+    auto chunkStore128 = getChunksFromSut(4U, chunkSettings_128);
+
+    const auto& histogram = sut->getRequestedChunkPayloadSizes();
+    EXPECT_THAT(histogram.count(ChunkSizeHistogram::bucketIndex(32U)), Eq(2U));
+    EXPECT_THAT(histogram.count(ChunkSizeHistogram::bucketIndex(128U)), Eq(4U));
+    EXPECT_THAT(histogram.count(ChunkSizeHistogram::bucketIndex(64U)), Eq(0U));
+    EXPECT_THAT(sut->getNumberOfTooLargeRequests(), Eq(0U));
+}
+
+TEST_F(MemoryManager_test, GetChunkWithoutFittingMemPoolIncrementsTheNumberOfTooLargeRequests)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "026e08b7-a27c-4164-80a4-075e600047f7");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [](const iox::PoshError, const iox::ErrorLevel) {});
+
+    sut->getChunk(chunkSettings_64).and_then([](auto&) { GTEST_FAIL() << "getChunk should fail but did not fail"; });
+    sut->getChunk(chunkSettings_128).and_then([](auto&) { GTEST_FAIL() << "getChunk should fail but did not fail"; });
+
+    EXPECT_THAT(sut->getNumberOfTooLargeRequests(), Eq(2U));
+    EXPECT_THAT(sut->getRequestedChunkPayloadSizes().count(iox::mepoo::ChunkSizeHistogram::bucketIndex(128U)), Eq(1U));
+}
+
+TEST_F(MemoryManager_test, GetChunkTakesChunksFromTheMemPoolExtentWhenTheMemPoolIsExhausted)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2f892097-1364-4f09-ba5b-8169b2653d2c");
+    constexpr uint32_t CHUNK_COUNT{2U};
+    constexpr uint32_t EXTENT_CHUNK_COUNT{3U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT, EXTENT_CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    const uint32_t chunkSize = sut->getMemPoolInfo(0U).m_chunkSize;
+    const uint64_t extentChunkMemorySize =
+        iox::mepoo::MemoryManager::requiredExtentChunkMemorySize(chunkSize, EXTENT_CHUNK_COUNT);
+    const uint64_t extentManagementMemorySize =
+        iox::mepoo::MemoryManager::requiredExtentManagementMemorySize(EXTENT_CHUNK_COUNT);
+    std::vector<uint8_t> extentChunkMemory(extentChunkMemorySize);
+    std::vector<uint8_t> extentManagementMemory(extentManagementMemorySize);
+    iox::posix::Allocator extentChunkAllocator(extentChunkMemory.data(), extentChunkMemorySize);
+    iox::posix::Allocator extentManagementAllocator(extentManagementMemory.data(), extentManagementMemorySize);
+    sut->addMemPoolExtent(0U, extentManagementAllocator, extentChunkAllocator);
+
+    ASSERT_THAT(sut->getNumberOfMemPoolExtents(), Eq(1U));
+    EXPECT_THAT(sut->getMemPoolExtentInfo(0U).m_chunkSize, Eq(chunkSize));
+    EXPECT_THAT(sut->getMemPoolExtentInfo(0U).m_numChunks, Eq(EXTENT_CHUNK_COUNT));
+    EXPECT_THAT(sut->getNumberOfFreeChunks(0U), Eq(CHUNK_COUNT + EXTENT_CHUNK_COUNT));
+
+    auto chunkStore = getChunksFromSut(CHUNK_COUNT + EXTENT_CHUNK_COUNT, chunkSettings_32);
+
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut->getMemPoolExtentInfo(0U).m_usedChunks, Eq(EXTENT_CHUNK_COUNT));
+    EXPECT_THAT(sut->getNumberOfFreeChunks(0U), Eq(0U));
+
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [](const iox::PoshError, const iox::ErrorLevel) {});
+    EXPECT_THAT(sut->getChunk(chunkSettings_32).get_error(),
+                Eq(iox::mepoo::MemoryManager::Error::MEMPOOL_OUT_OF_CHUNKS));
+
+    chunkStore.clear();
+
+    EXPECT_THAT(sut->getMemPoolExtentInfo(0U).m_usedChunks, Eq(0U));
+    EXPECT_THAT(sut->getNumberOfFreeChunks(0U), Eq(CHUNK_COUNT + EXTENT_CHUNK_COUNT));
+}
+
+TEST_F(MemoryManager_test, MemPoolExtentIsOnlyUsedForTheChunkSizeOfItsMemPool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3e23a32b-dad7-4585-b291-fc5868168c04");
+    constexpr uint32_t CHUNK_COUNT{2U};
+    constexpr uint32_t EXTENT_CHUNK_COUNT{4U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT, EXTENT_CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    sut->addMemPoolExtent(0U, *allocator, *allocator);
+
+    auto chunkStore = getChunksFromSut(CHUNK_COUNT, chunkSettings_64);
+
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [](const iox::PoshError, const iox::ErrorLevel) {});
+    EXPECT_THAT(sut->getChunk(chunkSettings_64).get_error(),
+                Eq(iox::mepoo::MemoryManager::Error::MEMPOOL_OUT_OF_CHUNKS));
+    EXPECT_THAT(sut->getMemPoolExtentInfo(0U).m_usedChunks, Eq(0U));
+    EXPECT_THAT(sut->getNumberOfFreeChunks(1U), Eq(0U));
+}
+
+TEST_F(MemoryManager_test, ExtentChunkCountIsTakenFromTheConfig)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d1a955bf-8257-4ea4-b0e4-c6f9e2dd919f");
+    constexpr uint32_t CHUNK_COUNT{2U};
+    constexpr uint32_t EXTENT_CHUNK_COUNT{7U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT, EXTENT_CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    EXPECT_THAT(sut->getExtentChunkCount(0U), Eq(0U));
+    EXPECT_THAT(sut->getExtentChunkCount(1U), Eq(EXTENT_CHUNK_COUNT));
+    EXPECT_THAT(sut->getExtentChunkCount(2U), Eq(0U));
+    EXPECT_THAT(sut->getNumberOfMemPoolExtents(), Eq(0U));
+}
+
+TEST_F(MemoryManager_test, ReservedChunksAreKeptFreeForThePublisherWithTheChunkQuota)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ab4f0acf-df71-4ade-81bc-e864a2fe8a65");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    constexpr uint32_t RESERVED_CHUNKS{4U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    auto chunkQuota = sut->acquireChunkQuota(RESERVED_CHUNKS, 0U);
+    ASSERT_THAT(chunkQuota, Ne(nullptr));
+
+    auto reservedChunk = sut->getChunk(chunkSettings_32, chunkQuota);
+    ASSERT_FALSE(reservedChunk.has_error());
+    EXPECT_THAT(sut->getNumberOfReservedChunks(0U), Eq(RESERVED_CHUNKS));
+    EXPECT_THAT(sut->getNumberOfReservedChunks(1U), Eq(0U));
+
+    auto chunkStore = getChunksFromSut(CHUNK_COUNT - RESERVED_CHUNKS, chunkSettings_32);
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [](const iox::PoshError, const iox::ErrorLevel) {});
+    EXPECT_THAT(sut->getChunk(chunkSettings_32).get_error(),
+                Eq(iox::mepoo::MemoryManager::Error::MEMPOOL_OUT_OF_CHUNKS));
+    EXPECT_THAT(sut->getNumberOfRejectedChunkRequests(0U), Eq(1U));
+
+    for (uint32_t i = 1U; i < RESERVED_CHUNKS; ++i)
+    {
+        auto chunk = sut->getChunk(chunkSettings_32, chunkQuota);
+        ASSERT_FALSE(chunk.has_error());
+        chunkStore.push_back(chunk.value());
+    }
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks, Eq(CHUNK_COUNT));
+}
+
+TEST_F(MemoryManager_test, ChunksTakenWithoutChunkQuotaBeforeTheReservationAreNotReserved)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bb66c5fd-68ef-42a9-b33a-16ab8aa2b3bb");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    constexpr uint32_t USED_CHUNKS{7U};
+    constexpr uint32_t RESERVED_CHUNKS{CHUNK_COUNT - USED_CHUNKS};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    auto chunkStore = getChunksFromSut(USED_CHUNKS, chunkSettings_32);
+    auto chunkQuota = sut->acquireChunkQuota(CHUNK_COUNT, 0U);
+    ASSERT_THAT(chunkQuota, Ne(nullptr));
+
+    auto reservedChunk = sut->getChunk(chunkSettings_32, chunkQuota);
+    ASSERT_FALSE(reservedChunk.has_error());
+    EXPECT_THAT(sut->getNumberOfReservedChunks(0U), Eq(RESERVED_CHUNKS));
+
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [](const iox::PoshError, const iox::ErrorLevel) {});
+    EXPECT_THAT(sut->getChunk(chunkSettings_32).get_error(),
+                Eq(iox::mepoo::MemoryManager::Error::MEMPOOL_OUT_OF_CHUNKS));
+
+    chunkStore.clear();
+    chunkStore = getChunksFromSut(USED_CHUNKS, chunkSettings_32);
+    EXPECT_THAT(sut->getChunk(chunkSettings_32).get_error(),
+                Eq(iox::mepoo::MemoryManager::Error::MEMPOOL_OUT_OF_CHUNKS));
+
+    for (uint32_t i = 1U; i < RESERVED_CHUNKS; ++i)
+    {
+        auto chunk = sut->getChunk(chunkSettings_32, chunkQuota);
+        ASSERT_FALSE(chunk.has_error());
+        chunkStore.push_back(chunk.value());
+    }
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks, Eq(CHUNK_COUNT));
+}
+
+TEST_F(MemoryManager_test, GetChunkFailsWhenTheChunkQuotaIsExceeded)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "71761095-14fb-4204-b446-8e88768585fb");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    constexpr uint32_t MAX_CHUNKS{2U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    auto chunkQuota = sut->acquireChunkQuota(0U, MAX_CHUNKS);
+    ASSERT_THAT(chunkQuota, Ne(nullptr));
+
+    ChunkStore chunkStore;
+    for (uint32_t i = 0U; i < MAX_CHUNKS; ++i)
+    {
+        auto chunk = sut->getChunk(chunkSettings_32, chunkQuota);
+        ASSERT_FALSE(chunk.has_error());
+        chunkStore.push_back(chunk.value());
+    }
+
+    EXPECT_THAT(sut->getChunk(chunkSettings_32, chunkQuota).get_error(),
+                Eq(iox::mepoo::MemoryManager::Error::CHUNK_QUOTA_EXCEEDED));
+    EXPECT_THAT(sut->getNumberOfRejectedChunkRequests(0U), Eq(1U));
+
+    chunkStore.pop_back();
+    EXPECT_FALSE(sut->getChunk(chunkSettings_32, chunkQuota).has_error());
+}
+
+TEST_F(MemoryManager_test, ReleasedChunkQuotaReturnsTheReservationAndIsReusedWhenDrained)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "92b71280-e6df-4b24-98bf-3f4016bfa4a1");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    constexpr uint32_t RESERVED_CHUNKS{4U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    std::vector<iox::mepoo::ChunkQuota*> chunkQuotas;
+    for (uint32_t i = 0U; i < iox::MAX_NUMBER_OF_CHUNK_QUOTAS; ++i)
+    {
+        chunkQuotas.push_back(sut->acquireChunkQuota(RESERVED_CHUNKS, 0U));
+        ASSERT_THAT(chunkQuotas.back(), Ne(nullptr));
+    }
+    EXPECT_THAT(sut->acquireChunkQuota(RESERVED_CHUNKS, 0U), Eq(nullptr));
+
+    auto chunk = sut->getChunk(chunkSettings_32, chunkQuotas.front());
+    ASSERT_FALSE(chunk.has_error());
+    EXPECT_THAT(sut->getNumberOfReservedChunks(0U), Eq(RESERVED_CHUNKS));
+
+    sut->releaseChunkQuota(chunkQuotas.front());
+    EXPECT_THAT(sut->getNumberOfReservedChunks(0U), Eq(0U));
+    EXPECT_THAT(sut->acquireChunkQuota(RESERVED_CHUNKS, 0U), Eq(nullptr));
+    auto chunkStore = getChunksFromSut(CHUNK_COUNT - 1U, chunkSettings_32);
+
+    chunk.value() = iox::mepoo::SharedChunk();
+    EXPECT_THAT(sut->acquireChunkQuota(RESERVED_CHUNKS, 0U), Eq(chunkQuotas.front()));
+}
+
+TEST_F(MemoryManager_test, AddingMempoolsWithTheSameChunkSizeOnTheSameNumaNodeReturnsError)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6efd0e76-ead9-4355-86b2-b7dce0164126");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    constexpr uint32_t NUMA_NODE{0U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT, 0U, NUMA_NODE});
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT, 0U, NUMA_NODE});
+    iox::cxx::optional<iox::PoshError> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [&detectedError](const iox::PoshError error, const iox::ErrorLevel) { detectedError.emplace(error); });
+
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    ASSERT_TRUE(detectedError.has_value());
+    EXPECT_EQ(detectedError.value(), iox::PoshError::MEPOO__MEMPOOL_CONFIG_MUST_BE_ORDERED_BY_INCREASING_SIZE);
+}
+
+TEST_F(MemoryManager_test, GetMemPoolNumaNodeReturnsTheConfiguredNumaNode)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "797e450d-7484-4baf-91ec-9ccdf1f9aad9");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    constexpr uint32_t NUMA_NODE{0U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT, 0U, NUMA_NODE});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    EXPECT_THAT(sut->getMemPoolNumaNode(0U), Eq(iox::NO_NUMA_NODE));
+    EXPECT_THAT(sut->getMemPoolNumaNode(1U), Eq(NUMA_NODE));
+    EXPECT_THAT(sut->getMemPoolNumaNode(2U), Eq(iox::NO_NUMA_NODE));
+}
+
+TEST_F(MemoryManager_test, GetChunkPrefersTheMempoolOnTheNumaNodeOfTheCaller)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "21e03753-dd06-4faa-b166-038d7f57fe97");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    const uint32_t currentNumaNode = iox::mepoo::getCurrentNumaNode();
+    const uint32_t otherNumaNode = (currentNumaNode + 1U) % iox::MAX_NUMBER_OF_NUMA_NODES;
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT, 0U, otherNumaNode});
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT, 0U, currentNumaNode});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore = getChunksFromSut(1U, chunkSettings_32);
+
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(1U).m_usedChunks, Eq(1U));
+}
+
+TEST_F(MemoryManager_test, GetChunkUsesTheMempoolOnAnotherNumaNodeWhenThePreferredOneIsExhausted)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7686b204-01c9-4223-a569-220e807015e6");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    const uint32_t currentNumaNode = iox::mepoo::getCurrentNumaNode();
+    const uint32_t otherNumaNode = (currentNumaNode + 1U) % iox::MAX_NUMBER_OF_NUMA_NODES;
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT, 0U, currentNumaNode});
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT, 0U, otherNumaNode});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore = getChunksFromSut(CHUNK_COUNT + 1U, chunkSettings_32);
+
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut->getMemPoolInfo(1U).m_usedChunks, Eq(1U));
+}
+
+TEST_F(MemoryManager_test, ReleaseChunksOfLostOwnersReleasesTheReferenceOfALostOwner)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1d607262-3df0-4748-8d9f-736c102c9712");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    const iox::popo::UniquePortId lostOwner;
+
+    auto chunkStore = getChunksFromSut(1U, chunkSettings_64);
+    chunkStore.front().setOwner(lostOwner);
+    // the process of the owner terminates while it holds the chunk
+    static_cast<void>(chunkStore.front().release());
+    ASSERT_THAT(sut->getMemPoolInfo(1U).m_usedChunks, Eq(1U));
+
+    auto releasedChunks =
+        sut->releaseChunksOfLostOwners(0U, sut->getNumberOfChunkManagements(), [&](const uint64_t owner) {
+            return owner == static_cast<uint64_t>(lostOwner);
+        });
+
+    EXPECT_THAT(releasedChunks, Eq(1U));
+    EXPECT_THAT(sut->getMemPoolInfo(1U).m_usedChunks, Eq(0U));
+    EXPECT_THAT(sut->getNumberOfReclaimedChunks(0U), Eq(0U));
+    EXPECT_THAT(sut->getNumberOfReclaimedChunks(1U), Eq(1U));
+}
+
+TEST_F(MemoryManager_test, ReleaseChunksOfLostOwnersKeepsTheChunksOfOtherOwnersAndWithoutOwner)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3f8615a7-f210-45a1-96ae-37a208c0ca00");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    const iox::popo::UniquePortId lostOwner;
+    const iox::popo::UniquePortId runningOwner;
+
+    auto chunkStore = getChunksFromSut(2U, chunkSettings_32);
+    chunkStore[0].setOwner(runningOwner);
+    chunkStore[1].setOwner(lostOwner);
+    chunkStore[1].resetOwner();
+
+    auto releasedChunks =
+        sut->releaseChunksOfLostOwners(0U, sut->getNumberOfChunkManagements(), [&](const uint64_t owner) {
+            return owner == static_cast<uint64_t>(lostOwner);
+        });
+
+    EXPECT_THAT(releasedChunks, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks, Eq(2U));
+    EXPECT_THAT(sut->getNumberOfReclaimedChunks(0U), Eq(0U));
+}
+
+TEST_F(MemoryManager_test, ReleaseChunksOfLostOwnersKeepsTheChunkWhenItHasFurtherReferences)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b9007dde-f205-4a38-9921-6f06931617b6");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    const iox::popo::UniquePortId lostOwner;
+
+    auto chunkStore = getChunksFromSut(1U, chunkSettings_32);
+    // e.g. the chunk was already delivered to a subscriber
+    auto deliveredChunk = chunkStore.front();
+    chunkStore.front().setOwner(lostOwner);
+    static_cast<void>(chunkStore.front().release());
+
+    auto releasedChunks =
+        sut->releaseChunksOfLostOwners(0U, sut->getNumberOfChunkManagements(), [&](const uint64_t owner) {
+            return owner == static_cast<uint64_t>(lostOwner);
+        });
+
+    EXPECT_THAT(releasedChunks, Eq(1U));
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks, Eq(1U));
+    deliveredChunk = nullptr;
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks, Eq(0U));
+}
+
+TEST_F(MemoryManager_test, ReleaseChunksOfLostOwnersChecksOnlyTheProvidedChunkManagementsIncludingTheExtents)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "69a6542a-eb4c-481d-9b17-94079ff16e16");
+    constexpr uint32_t CHUNK_COUNT{2U};
+    constexpr uint32_t EXTENT_CHUNK_COUNT{3U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT, EXTENT_CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    const uint32_t chunkSize = sut->getMemPoolInfo(0U).m_chunkSize;
+    const uint64_t extentChunkMemorySize =
+        iox::mepoo::MemoryManager::requiredExtentChunkMemorySize(chunkSize, EXTENT_CHUNK_COUNT);
+    const uint64_t extentManagementMemorySize =
+        iox::mepoo::MemoryManager::requiredExtentManagementMemorySize(EXTENT_CHUNK_COUNT);
+    std::vector<uint8_t> extentChunkMemory(extentChunkMemorySize);
+    std::vector<uint8_t> extentManagementMemory(extentManagementMemorySize);
+    iox::posix::Allocator extentChunkAllocator(extentChunkMemory.data(), extentChunkMemorySize);
+    iox::posix::Allocator extentManagementAllocator(extentManagementMemory.data(), extentManagementMemorySize);
+    sut->addMemPoolExtent(0U, extentManagementAllocator, extentChunkAllocator);
+    ASSERT_THAT(sut->getNumberOfChunkManagements(), Eq(CHUNK_COUNT + EXTENT_CHUNK_COUNT));
+
+    const iox::popo::UniquePortId lostOwner;
+    auto chunkStore = getChunksFromSut(CHUNK_COUNT + EXTENT_CHUNK_COUNT, chunkSettings_32);
+    for (auto& chunk : chunkStore)
+    {
+        chunk.setOwner(lostOwner);
+        static_cast<void>(chunk.release());
+    }
+    auto isLostOwner = [&](const uint64_t owner) { return owner == static_cast<uint64_t>(lostOwner); };
+
+    EXPECT_THAT(sut->releaseChunksOfLostOwners(0U, 1U, isLostOwner), Eq(1U));
+    EXPECT_THAT(sut->releaseChunksOfLostOwners(1U, 3U, isLostOwner), Eq(3U));
+    EXPECT_THAT(sut->releaseChunksOfLostOwners(4U, 100U, isLostOwner), Eq(1U));
+    EXPECT_THAT(sut->getNumberOfFreeChunks(0U), Eq(CHUNK_COUNT + EXTENT_CHUNK_COUNT));
+    EXPECT_THAT(sut->getNumberOfReclaimedChunks(0U), Eq(CHUNK_COUNT + EXTENT_CHUNK_COUNT));
+}
+
 TEST(MemoryManagerEnumString_test, asStringLiteralConvertsEnumValuesToStrings)
 {
     ::testing::Test::RecordProperty("TEST_ID", "5f6c3942-0af5-4c48-b44c-7268191dbac5");
@@ -483,8 +893,10 @@ TEST(MemoryManagerEnumString_test, asStringLiteralConvertsEnumValuesToStrings)
     // each bit corresponds to an enum value and must be set to true on test
     uint64_t testedEnumValues{0U};
     uint64_t loopCounter{0U};
-    for (const auto& sut :
-         {Error::NO_MEMPOOLS_AVAILABLE, Error::NO_MEMPOOL_FOR_REQUESTED_CHUNK_SIZE, Error::MEMPOOL_OUT_OF_CHUNKS})
+    for (const auto& sut : {Error::NO_MEMPOOLS_AVAILABLE,
+                            Error::NO_MEMPOOL_FOR_REQUESTED_CHUNK_SIZE,
+                            Error::MEMPOOL_OUT_OF_CHUNKS,
+                            Error::CHUNK_QUOTA_EXCEEDED})
     {
         auto enumString = iox::mepoo::asStringLiteral(sut);
 
@@ -499,6 +911,9 @@ TEST(MemoryManagerEnumString_test, asStringLiteralConvertsEnumValuesToStrings)
         case Error::MEMPOOL_OUT_OF_CHUNKS:
             EXPECT_THAT(enumString, StrEq("MemoryManager::Error::MEMPOOL_OUT_OF_CHUNKS"));
             break;
+        case Error::CHUNK_QUOTA_EXCEEDED:
+            EXPECT_THAT(enumString, StrEq("MemoryManager::Error::CHUNK_QUOTA_EXCEEDED"));
+            break;
         }
 
         testedEnumValues |= 1U << static_cast<uint64_t>(sut);
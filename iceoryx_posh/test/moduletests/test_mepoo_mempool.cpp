@@ -209,6 +209,25 @@ TEST_F(MemPool_test, GetMinFreeMethodReturnsTheNumberOfFreeChunks)
     }
 }
 
+TEST_F(MemPool_test, GetAllocationFailuresReturnsTheNumberOfFailedGetChunkCalls)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "dea3f4ef-6bbc-4e03-b682-ab25c7fe0276");
+    constexpr uint64_t NUMBER_OF_FAILED_CALLS{3U};
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        ASSERT_THAT(sut.getChunk(), Ne(nullptr));
+    }
+    EXPECT_THAT(sut.getAllocationFailures(), Eq(0U));
+
+    for (uint64_t i = 0U; i < NUMBER_OF_FAILED_CALLS; ++i)
+    {
+        EXPECT_THAT(sut.getChunk(), Eq(nullptr));
+    }
+
+    EXPECT_THAT(sut.getAllocationFailures(), Eq(NUMBER_OF_FAILED_CALLS));
+    EXPECT_THAT(sut.getInfo().m_allocationFailures, Eq(NUMBER_OF_FAILED_CALLS));
+}
+
 TEST_F(MemPool_test, dieWhenMempoolChunkSizeIsSmallerThan32Bytes)
 {
     ::testing::Test::RecordProperty("TEST_ID", "7704246e-42b5-46fd-8827-ebac200390e1");
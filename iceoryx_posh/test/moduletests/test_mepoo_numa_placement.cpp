@@ -0,0 +1,119 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_hoofs/internal/posix_wrapper/system_configuration.hpp"
+#include "iceoryx_posh/mepoo/numa_placement.hpp"
+#include "test.hpp"
+
+#include <cstdlib>
+
+namespace
+{
+using namespace ::testing;
+using iox::mepoo::NumaPlacement;
+using iox::mepoo::NumaPolicy;
+
+TEST(NumaPlacement_test, DefaultPlacementIsValid)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7f21d0da-944d-4b9e-84b2-aacd9be37a2d");
+    NumaPlacement sut;
+
+    EXPECT_TRUE(sut.isDefault());
+    EXPECT_TRUE(sut.isValid());
+}
+
+TEST(NumaPlacement_test, PlacementOnNodeSelectsOnlyThisNode)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f591a94b-55bb-47a2-bb7c-8efa4f1d3095");
+    auto sut = NumaPlacement::onNode(3U);
+
+    EXPECT_FALSE(sut.isDefault());
+    EXPECT_TRUE(sut.isValid());
+    EXPECT_THAT(sut.m_policy, Eq(NumaPolicy::PREFERRED));
+    EXPECT_THAT(sut.m_nodeMask, Eq(1U << 3U));
+}
+
+TEST(NumaPlacement_test, PlacementOnNodeOutOfRangeIsInvalid)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ff46d10e-120d-4ff7-b3b5-f9756958f33e");
+    auto sut = NumaPlacement::onNode(iox::MAX_NUMBER_OF_NUMA_NODES, NumaPolicy::BIND);
+
+    EXPECT_FALSE(sut.isValid());
+}
+
+TEST(NumaPlacement_test, PlacementWithNodesBeyondTheMaximumIsInvalid)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "19febb7b-9d73-4963-95f9-e07de8822479");
+    NumaPlacement sut;
+    sut.m_policy = NumaPolicy::INTERLEAVE;
+    sut.m_nodeMask = 1ULL | (1ULL << iox::MAX_NUMBER_OF_NUMA_NODES);
+
+    EXPECT_FALSE(sut.isValid());
+}
+
+TEST(NumaPlacement_test, NumaPolicyIsParsedFromItsName)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "34e775f9-b6a0-4042-8707-8d5bda3501d9");
+    EXPECT_THAT(iox::mepoo::numaPolicyFromString("default").value(), Eq(NumaPolicy::DEFAULT));
+    EXPECT_THAT(iox::mepoo::numaPolicyFromString("preferred").value(), Eq(NumaPolicy::PREFERRED));
+    EXPECT_THAT(iox::mepoo::numaPolicyFromString("bind").value(), Eq(NumaPolicy::BIND));
+    EXPECT_THAT(iox::mepoo::numaPolicyFromString("interleave").value(), Eq(NumaPolicy::INTERLEAVE));
+    EXPECT_FALSE(iox::mepoo::numaPolicyFromString("nearest").has_value());
+}
+
+TEST(NumaPlacement_test, ApplyingTheDefaultPlacementSucceeds)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7a72244a-c12d-453d-921c-61362b976809");
+    uint8_t memory[64];
+
+    EXPECT_TRUE(iox::mepoo::applyNumaPlacement(&memory[0], sizeof(memory), NumaPlacement()));
+}
+
+TEST(NumaPlacement_test, ApplyingAnInvalidPlacementFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a5c555fa-27c0-4828-a45e-81ed9551d49f");
+    uint8_t memory[64];
+
+    EXPECT_FALSE(iox::mepoo::applyNumaPlacement(
+        &memory[0], sizeof(memory), NumaPlacement::onNode(iox::MAX_NUMBER_OF_NUMA_NODES)));
+}
+
+TEST(NumaPlacement_test, SampledNumaDistributionDoesNotCountMorePagesThanTheMemoryHas)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9b95ef32-643a-480b-a0bf-817afc74cc19");
+    constexpr uint64_t NUMBER_OF_PAGES{4U};
+    const uint64_t size = NUMBER_OF_PAGES * iox::posix::pageSize();
+    auto memory = static_cast<uint8_t*>(malloc(size));
+    ASSERT_THAT(memory, Ne(nullptr));
+    for (uint64_t i = 0U; i < size; ++i)
+    {
+        memory[i] = 0U;
+    }
+
+    uint32_t pagesPerNode[iox::MAX_NUMBER_OF_NUMA_NODES];
+    iox::mepoo::sampleNumaDistribution(memory, size, pagesPerNode);
+
+    uint32_t sampledPages{0U};
+    for (const auto pages : pagesPerNode)
+    {
+        sampledPages += pages;
+    }
+    EXPECT_THAT(sampledPages, Le(NUMBER_OF_PAGES));
+    free(memory);
+}
+
+} // namespace
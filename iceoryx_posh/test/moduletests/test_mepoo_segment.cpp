@@ -22,6 +22,7 @@
 #include "iceoryx_hoofs/platform/stat.hpp"
 #include "iceoryx_hoofs/platform/types.hpp"
 #include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
+#include "iceoryx_hoofs/testing/mocks/error_handler_mock.hpp"
 #include "iceoryx_hoofs/testing/test_definitions.hpp"
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/internal/mepoo/mepoo_segment.hpp"
@@ -30,6 +31,8 @@
 
 #include <functional>
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace
 {
@@ -107,6 +110,7 @@ class MePooSegment_test : public Test
         std::shared_ptr<iox::posix::Allocator> allocator{new iox::posix::Allocator(memory, MEM_SIZE)};
         int filehandle;
         static createFct createVerificator;
+        static bool isCreationFailing;
     };
 
     class SharedMemoryObject_MOCKBuilder
@@ -126,6 +130,19 @@ class MePooSegment_test : public Test
       public:
         iox::cxx::expected<SharedMemoryObject_MOCK, SharedMemoryObjectError> create() noexcept
         {
+            if (SharedMemoryObject_MOCK::isCreationFailing)
+            {
+                if (SharedMemoryObject_MOCK::createVerificator)
+                {
+                    SharedMemoryObject_MOCK::createVerificator(m_name,
+                                                               m_memorySizeInBytes,
+                                                               m_accessMode,
+                                                               m_openMode,
+                                                               (m_baseAddressHint) ? *m_baseAddressHint : nullptr,
+                                                               m_permissions);
+                }
+                return iox::cxx::error<SharedMemoryObjectError>(SharedMemoryObjectError::SHARED_MEMORY_CREATION_FAILED);
+            }
             return iox::cxx::success<SharedMemoryObject_MOCK>(
                 SharedMemoryObject_MOCK(m_name,
                                         m_memorySizeInBytes,
@@ -147,7 +164,7 @@ class MePooSegment_test : public Test
         return config;
     }
 
-    static constexpr uint64_t RawMemorySize{20000};
+    static constexpr uint64_t RawMemorySize{40000};
     uint8_t m_rawMemory[RawMemorySize];
     iox::posix::Allocator m_managementAllocator{iox::posix::Allocator(m_rawMemory, RawMemorySize)};
 
@@ -156,6 +173,7 @@ class MePooSegment_test : public Test
         mepooConfig, m_managementAllocator, PosixGroup{"iox_roudi_test1"}, PosixGroup{"iox_roudi_test2"}};
 };
 MePooSegment_test::SharedMemoryObject_MOCK::createFct MePooSegment_test::SharedMemoryObject_MOCK::createVerificator;
+bool MePooSegment_test::SharedMemoryObject_MOCK::isCreationFailing{false};
 
 TEST_F(MePooSegment_test, DISABLED_sharedMemoryFileHandleRightsAfterConstructor)
 {
@@ -232,4 +250,41 @@ TEST_F(MePooSegment_test, ADD_TEST_WITH_ADDITIONAL_USER(GetMemoryManager))
         .or_else([](auto& error) { GTEST_FAIL() << "getChunk failed with: " << error; });
 }
 
+TEST_F(MePooSegment_test, ADD_TEST_WITH_ADDITIONAL_USER(MemPoolExtentIsNamedAfterTheWriterGroupAndReplacesALeftover))
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1b94dc88-3aa8-45b8-baf5-d4ccf5f20ab3");
+    MePooConfig extentConfig;
+    extentConfig.addMemPool({128U, 10U, 10U});
+    MePooSegment<SharedMemoryObject_MOCK, MemoryManager> sut2{
+        extentConfig, m_managementAllocator, PosixGroup{"iox_roudi_test1"}, PosixGroup{"iox_roudi_test2"}};
+
+    std::vector<std::string> names;
+    MePooSegment_test::SharedMemoryObject_MOCK::createVerificator = [&](const SharedMemory::Name_t name,
+                                                                        const uint64_t,
+                                                                        const iox::posix::AccessMode,
+                                                                        const iox::posix::OpenMode openMode,
+                                                                        const void*,
+                                                                        const iox::cxx::perms) {
+        names.emplace_back(name.c_str());
+        EXPECT_THAT(openMode, Eq(iox::posix::OpenMode::PURGE_AND_CREATE));
+    };
+    MePooSegment_test::SharedMemoryObject_MOCK::isCreationFailing = true;
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [](const iox::PoshError, const iox::ErrorLevel) {});
+
+    // a failed attempt uses the same names again since a leftover of it is replaced
+    EXPECT_FALSE(sut2.addMemPoolExtent(0U));
+    EXPECT_FALSE(sut2.addMemPoolExtent(0U));
+
+    MePooSegment_test::SharedMemoryObject_MOCK::isCreationFailing = false;
+    MePooSegment_test::SharedMemoryObject_MOCK::createVerificator =
+        MePooSegment_test::SharedMemoryObject_MOCK::createFct();
+
+    EXPECT_THAT(names,
+                ElementsAre("iox_roudi_test2_extent_0",
+                            "iox_roudi_test2_extent_0_mgmt",
+                            "iox_roudi_test2_extent_0",
+                            "iox_roudi_test2_extent_0_mgmt"));
+}
+
 } // namespace
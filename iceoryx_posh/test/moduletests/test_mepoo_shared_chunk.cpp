@@ -53,7 +53,7 @@ class SharedChunk_Test : public Test
         return v;
     }
 
-    static constexpr uint32_t CHUNK_SIZE{64U};
+    static constexpr uint32_t CHUNK_SIZE{sizeof(ChunkManagement)};
     static constexpr uint32_t NUMBER_OF_CHUNKS{10U};
     static constexpr uint32_t USER_PAYLOAD_SIZE{64U};
 
@@ -322,4 +322,59 @@ TEST_F(SharedChunk_Test, ReleaseMethodReturnsChunkManagementPointerOfSharedChunk
     EXPECT_EQ(sut.getChunkHeader(), nullptr);
 }
 
+TEST_F(SharedChunk_Test, HasPartsReturnsFalseWhenNoPartWasAdded)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "29ea2c13-652c-46cf-b86f-91ff83dd98c8");
+    EXPECT_FALSE(sut.hasParts());
+}
+
+TEST_F(SharedChunk_Test, HasPartsReturnsTrueWhenAPartWasAdded)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5641f0e9-a2f5-4e10-908f-376affb2e53c");
+    sut.addPart(SharedChunk(GetChunkManagement(mempool.getChunk())));
+
+    EXPECT_TRUE(sut.hasParts());
+}
+
+TEST_F(SharedChunk_Test, PartsAreReleasedTogetherWithTheHeadChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "99cafafa-eca2-406f-9b95-a4965e74adfd");
+    constexpr uint32_t NUMBER_OF_PARTS{3U};
+    for (uint32_t i = 0U; i < NUMBER_OF_PARTS; ++i)
+    {
+        sut.addPart(SharedChunk(GetChunkManagement(mempool.getChunk())));
+    }
+    ASSERT_THAT(mempool.getUsedChunks(), Eq(NUMBER_OF_PARTS + 1U));
+
+    sut = SharedChunk();
+
+    EXPECT_THAT(mempool.getUsedChunks(), Eq(0U));
+    EXPECT_THAT(chunkMgmtPool.getUsedChunks(), Eq(0U));
+}
+
+TEST_F(SharedChunk_Test, ReleasePartsReleasesOnlyTheParts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b08f40d3-57d8-4c07-9e7f-11194e6b3c2d");
+    sut.addPart(SharedChunk(GetChunkManagement(mempool.getChunk())));
+    sut.addPart(SharedChunk(GetChunkManagement(mempool.getChunk())));
+
+    sut.releaseParts();
+
+    EXPECT_FALSE(sut.hasParts());
+    EXPECT_THAT(mempool.getUsedChunks(), Eq(1U));
+    EXPECT_THAT(sut.getChunkHeader(), Ne(nullptr));
+}
+
+TEST_F(SharedChunk_Test, PartsAreNotReleasedAsLongAsTheHeadChunkHasAnotherOwner)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c9ee4d49-070a-47a3-9ccc-2b157c5633fe");
+    sut.addPart(SharedChunk(GetChunkManagement(mempool.getChunk())));
+    SharedChunk otherOwner(sut);
+
+    sut = SharedChunk();
+
+    EXPECT_TRUE(otherOwner.hasParts());
+    EXPECT_THAT(mempool.getUsedChunks(), Eq(2U));
+}
+
 } // namespace
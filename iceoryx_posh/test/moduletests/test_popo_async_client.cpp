@@ -0,0 +1,441 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/popo/async_client.hpp"
+#include "iceoryx_posh/testing/mocks/chunk_mock.hpp"
+#include "mocks/client_mock.hpp"
+
+#include "test.hpp"
+
+#include <memory>
+#include <thread>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::capro;
+using namespace iox::popo;
+using namespace iox::units::duration_literals;
+using ::testing::_;
+
+struct DummyRequest
+{
+    uint64_t data{0};
+};
+struct DummyResponse
+{
+    uint64_t data{0};
+};
+
+using TestAsyncClient = AsyncClientImpl<DummyRequest, DummyResponse, MockBaseClient>;
+using Future_t = ResponseFuture<DummyResponse>;
+
+class AsyncClient_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        EXPECT_CALL(sut->mockPort, releaseResponse(_)).Times(AnyNumber());
+    }
+
+    void TearDown() override
+    {
+    }
+
+    void expectSuccessfulSend()
+    {
+        const iox::cxx::expected<RequestHeader*, AllocationError> allocateRequestResult =
+            iox::cxx::success<RequestHeader*>{requestMock.userHeader()};
+        EXPECT_CALL(sut->mockPort, allocateRequest(_, _)).WillOnce(Return(allocateRequestResult));
+        EXPECT_CALL(sut->mockPort, sendRequest(requestMock.userHeader())).WillOnce(Return(iox::cxx::success<void>()));
+    }
+
+    Future_t sendRequest(const iox::units::Duration timeout = iox::units::Duration::max())
+    {
+        expectSuccessfulSend();
+        auto result = sut->sendAsync(std::move(sut->loan().value()), timeout);
+        EXPECT_FALSE(result.has_error());
+        return std::move(result.value());
+    }
+
+    /// @brief provides a response with the given sequence id with the next getResponse call of the port
+    const ResponseHeader* provideResponse(const int64_t sequenceId, const uint64_t data)
+    {
+        responseMocks.emplace_back(new ChunkMock<DummyResponse, ResponseHeader>());
+        auto& responseMock = *responseMocks.back();
+        new (responseMock.userHeader()) ResponseHeader(iox::cxx::UniqueId(), 0U, sequenceId);
+        responseMock.sample()->data = data;
+        responses.push_back(responseMock.userHeader());
+        return responseMock.userHeader();
+    }
+
+    void expectResponses(const bool expectEmptyQueue = true)
+    {
+        InSequence sequence;
+        for (auto response : responses)
+        {
+            const iox::cxx::expected<const ResponseHeader*, ChunkReceiveResult> getResponseResult =
+                iox::cxx::success<const ResponseHeader*>{response};
+            EXPECT_CALL(sut->mockPort, getResponse()).WillOnce(Return(getResponseResult));
+        }
+        if (expectEmptyQueue)
+        {
+            const iox::cxx::expected<const ResponseHeader*, ChunkReceiveResult> noChunkResult =
+                iox::cxx::error<ChunkReceiveResult>{ChunkReceiveResult::NO_CHUNK_AVAILABLE};
+            EXPECT_CALL(sut->mockPort, getResponse()).WillOnce(Return(noChunkResult));
+        }
+        responses.clear();
+    }
+
+    ChunkMock<DummyRequest, RequestHeader> requestMock;
+    std::vector<std::unique_ptr<ChunkMock<DummyResponse, ResponseHeader>>> responseMocks;
+    std::vector<const ResponseHeader*> responses;
+
+    ServiceDescription sd{"the", "answer", "is"};
+    static constexpr uint64_t MAX_OUTSTANDING_REQUESTS{3U};
+    ClientOptions options = [] {
+        ClientOptions options;
+        options.maxOutstandingRequests = MAX_OUTSTANDING_REQUESTS;
+        return options;
+    }();
+    std::unique_ptr<TestAsyncClient> sut{new TestAsyncClient(sd, options)};
+};
+
+TEST_F(AsyncClient_test, SendAsyncAssignsDistinctSequenceIds)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f3491f5c-470a-4b9c-b5f9-00db5555a2a7");
+    auto future1 = sendRequest();
+    const auto sequenceId1 = requestMock.userHeader()->getSequenceId();
+    auto future2 = sendRequest();
+    const auto sequenceId2 = requestMock.userHeader()->getSequenceId();
+
+    EXPECT_THAT(future1.getSequenceId(), Eq(sequenceId1));
+    EXPECT_THAT(future2.getSequenceId(), Eq(sequenceId2));
+    EXPECT_THAT(sequenceId1, Ne(sequenceId2));
+    EXPECT_THAT(sut->numberOfRequestsInFlight(), Eq(2U));
+}
+
+TEST_F(AsyncClient_test, SendAsyncFailsWhenMaxOutstandingRequestsAreInFlight)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d49611ec-04c3-415a-9986-6e51fa9461fc");
+    std::vector<Future_t> futures;
+    for (uint64_t i = 0U; i < MAX_OUTSTANDING_REQUESTS; ++i)
+    {
+        futures.emplace_back(sendRequest());
+    }
+
+    const iox::cxx::expected<RequestHeader*, AllocationError> allocateRequestResult =
+        iox::cxx::success<RequestHeader*>{requestMock.userHeader()};
+    EXPECT_CALL(sut->mockPort, allocateRequest(_, _)).WillOnce(Return(allocateRequestResult));
+    EXPECT_CALL(sut->mockPort, sendRequest(_)).Times(0);
+    EXPECT_CALL(sut->mockPort, releaseRequest(requestMock.userHeader())).Times(1);
+
+    auto result = sut->sendAsync(std::move(sut->loan().value()));
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(AsyncSendError::TOO_MANY_REQUESTS_IN_FLIGHT));
+}
+
+TEST_F(AsyncClient_test, SendAsyncForwardsSendErrorAndDoesNotKeepTheRequestInFlight)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cf9409d7-d0b1-4c05-a40d-ff7231e3b5ac");
+    const iox::cxx::expected<RequestHeader*, AllocationError> allocateRequestResult =
+        iox::cxx::success<RequestHeader*>{requestMock.userHeader()};
+    EXPECT_CALL(sut->mockPort, allocateRequest(_, _)).WillOnce(Return(allocateRequestResult));
+    const iox::cxx::expected<ClientSendError> sendRequestResult =
+        iox::cxx::error<ClientSendError>(ClientSendError::SERVER_NOT_AVAILABLE);
+    EXPECT_CALL(sut->mockPort, sendRequest(_)).WillOnce(Return(sendRequestResult));
+
+    auto result = sut->sendAsync(std::move(sut->loan().value()));
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(AsyncSendError::SERVER_NOT_AVAILABLE));
+    EXPECT_THAT(sut->numberOfRequestsInFlight(), Eq(0U));
+}
+
+TEST_F(AsyncClient_test, FutureIsPendingUntilTheResponseIsProcessed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6ee334cc-d50a-45eb-893a-11a4b0fc9e1c");
+    auto future = sendRequest();
+
+    EXPECT_FALSE(future.isReady());
+    auto result = future.take();
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(AsyncResponseError::PENDING));
+}
+
+TEST_F(AsyncClient_test, ResponsesAreCorrelatedWithTheirFuturesOutOfOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0c12b52a-cfb7-40b1-ac86-d6a684442957");
+    constexpr uint64_t DATA1{42U};
+    constexpr uint64_t DATA2{73U};
+    auto future1 = sendRequest();
+    auto future2 = sendRequest();
+    provideResponse(future2.getSequenceId(), DATA2);
+    provideResponse(future1.getSequenceId(), DATA1);
+    expectResponses();
+
+    EXPECT_THAT(sut->processResponses(), Eq(2U));
+
+    EXPECT_TRUE(future1.isReady());
+    EXPECT_TRUE(future2.isReady());
+    auto response1 = future1.take();
+    auto response2 = future2.take();
+    ASSERT_FALSE(response1.has_error());
+    ASSERT_FALSE(response2.has_error());
+    EXPECT_THAT(response1.value()->data, Eq(DATA1));
+    EXPECT_THAT(response2.value()->data, Eq(DATA2));
+    EXPECT_THAT(sut->numberOfRequestsInFlight(), Eq(0U));
+}
+
+TEST_F(AsyncClient_test, TakingTheResponseTwiceFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "da25d202-fca5-41a9-9c56-f4437bf18606");
+    auto future = sendRequest();
+    provideResponse(future.getSequenceId(), 1U);
+    expectResponses();
+    sut->processResponses();
+
+    EXPECT_FALSE(future.take().has_error());
+    auto result = future.take();
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(AsyncResponseError::NO_PENDING_REQUEST));
+}
+
+TEST_F(AsyncClient_test, RequestTimesOutAndLateResponseIsReleased)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8b5aa1ad-9784-49c8-99de-69bc618d654f");
+    auto future = sendRequest(1_ns);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    expectResponses();
+    sut->processResponses();
+
+    EXPECT_TRUE(future.isReady());
+    auto result = future.take();
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(AsyncResponseError::TIMED_OUT));
+
+    auto lateResponse = provideResponse(future.getSequenceId(), 1U);
+    expectResponses();
+    EXPECT_CALL(sut->mockPort, releaseResponse(lateResponse)).Times(1);
+    EXPECT_THAT(sut->processResponses(), Eq(1U));
+    EXPECT_THAT(sut->numberOfRequestsInFlight(), Eq(0U));
+}
+
+TEST_F(AsyncClient_test, CancelledFutureFailsAndLateResponseIsReleased)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "16f54faa-fe4b-416e-84fd-142be261068d");
+    auto future = sendRequest();
+    future.cancel();
+
+    auto result = future.take();
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(AsyncResponseError::CANCELLED));
+    EXPECT_THAT(sut->numberOfRequestsInFlight(), Eq(0U));
+
+    auto lateResponse = provideResponse(future.getSequenceId(), 1U);
+    expectResponses();
+    EXPECT_CALL(sut->mockPort, releaseResponse(lateResponse)).Times(1);
+    sut->processResponses();
+}
+
+TEST_F(AsyncClient_test, DestroyingAFutureCancelsTheRequest)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4054c55f-5af7-458e-b844-093ae5e8cdbf");
+    {
+        auto future = sendRequest();
+        EXPECT_THAT(sut->numberOfRequestsInFlight(), Eq(1U));
+    }
+
+    EXPECT_THAT(sut->numberOfRequestsInFlight(), Eq(0U));
+}
+
+TEST_F(AsyncClient_test, CallbackIsCalledWithTheResponse)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "28e9bdab-4f27-462e-89e5-bce6c84f2bba");
+    constexpr uint64_t DATA{1337U};
+    uint64_t receivedData{0U};
+    expectSuccessfulSend();
+    auto sequenceId = sut->sendAsync(std::move(sut->loan().value()), [&](auto& result) {
+        ASSERT_FALSE(result.has_error());
+        receivedData = result.value()->data;
+    });
+    ASSERT_FALSE(sequenceId.has_error());
+    provideResponse(sequenceId.value(), DATA);
+    expectResponses();
+
+    sut->processResponses();
+
+    EXPECT_THAT(receivedData, Eq(DATA));
+    EXPECT_THAT(sut->numberOfRequestsInFlight(), Eq(0U));
+}
+
+TEST_F(AsyncClient_test, CallbackIsCalledWhenTheRequestIsCancelled)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c42283ec-b262-4417-b667-9e8320096727");
+    iox::cxx::optional<AsyncResponseError> receivedError;
+    expectSuccessfulSend();
+    auto sequenceId = sut->sendAsync(std::move(sut->loan().value()), [&](auto& result) {
+        ASSERT_TRUE(result.has_error());
+        receivedError.emplace(result.get_error());
+    });
+    ASSERT_FALSE(sequenceId.has_error());
+
+    EXPECT_TRUE(sut->cancel(sequenceId.value()));
+
+    ASSERT_TRUE(receivedError.has_value());
+    EXPECT_THAT(receivedError.value(), Eq(AsyncResponseError::CANCELLED));
+    EXPECT_FALSE(sut->cancel(sequenceId.value()));
+}
+
+TEST_F(AsyncClient_test, CallbackIsCalledWhenTheRequestTimesOut)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d7975d02-c901-44fe-9a61-e70765b942d6");
+    iox::cxx::optional<AsyncResponseError> receivedError;
+    expectSuccessfulSend();
+    auto sequenceId = sut->sendAsync(
+        std::move(sut->loan().value()),
+        [&](auto& result) {
+            ASSERT_TRUE(result.has_error());
+            receivedError.emplace(result.get_error());
+        },
+        1_ns);
+    ASSERT_FALSE(sequenceId.has_error());
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    expectResponses();
+
+    sut->processResponses();
+
+    ASSERT_TRUE(receivedError.has_value());
+    EXPECT_THAT(receivedError.value(), Eq(AsyncResponseError::TIMED_OUT));
+}
+
+TEST_F(AsyncClient_test, SequenceIdOfALongRunningRequestIsSkipped)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "762dc1e7-d621-4017-801e-ca72045c132c");
+    auto longRunningFuture = sendRequest();
+    for (uint64_t i = 0U; i < InFlightRequests<DummyResponse>::CAPACITY + 1U; ++i)
+    {
+        auto future = sendRequest();
+        EXPECT_THAT(future.getSequenceId(), Ne(longRunningFuture.getSequenceId()));
+    }
+
+    provideResponse(longRunningFuture.getSequenceId(), 42U);
+    expectResponses();
+    sut->processResponses();
+
+    auto response = longRunningFuture.take();
+    ASSERT_FALSE(response.has_error());
+    EXPECT_THAT(response.value()->data, Eq(42U));
+}
+
+TEST_F(AsyncClient_test, ProcessResponsesKeepsResponsesQueuedWhenTooManyAreHeld)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e2d5c278-fb1c-4dc6-b6e9-cedbe7d020ab");
+    options.maxOutstandingRequests = iox::MAX_OUTSTANDING_REQUESTS_PER_CLIENT;
+    sut.reset(new TestAsyncClient(sd, options));
+    EXPECT_CALL(sut->mockPort, releaseResponse(_)).Times(AnyNumber());
+
+    std::vector<Future_t> futures;
+    for (uint64_t i = 0U; i < iox::MAX_RESPONSES_PROCESSED_SIMULTANEOUSLY; ++i)
+    {
+        futures.emplace_back(sendRequest());
+        provideResponse(futures.back().getSequenceId(), i);
+    }
+    constexpr bool EXPECT_EMPTY_QUEUE{false};
+    expectResponses(EXPECT_EMPTY_QUEUE);
+    EXPECT_THAT(sut->processResponses(), Eq(iox::MAX_RESPONSES_PROCESSED_SIMULTANEOUSLY));
+
+    EXPECT_CALL(sut->mockPort, getResponse()).Times(0);
+    EXPECT_THAT(sut->processResponses(), Eq(0U));
+}
+
+TEST_F(AsyncClient_test, RequestsInFlightAreLimitedToTheResponseQueueCapacity)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "37242ba1-4b46-49fa-bc54-e33cc4c7639a");
+    constexpr uint64_t RESPONSE_QUEUE_CAPACITY{2U};
+    options.maxOutstandingRequests = iox::MAX_OUTSTANDING_REQUESTS_PER_CLIENT;
+    options.responseQueueCapacity = RESPONSE_QUEUE_CAPACITY;
+    sut.reset(new TestAsyncClient(sd, options));
+    EXPECT_CALL(sut->mockPort, releaseResponse(_)).Times(AnyNumber());
+
+    std::vector<Future_t> futures;
+    for (uint64_t i = 0U; i < RESPONSE_QUEUE_CAPACITY; ++i)
+    {
+        futures.emplace_back(sendRequest());
+    }
+
+    const iox::cxx::expected<RequestHeader*, AllocationError> allocateRequestResult =
+        iox::cxx::success<RequestHeader*>{requestMock.userHeader()};
+    EXPECT_CALL(sut->mockPort, allocateRequest(_, _)).WillOnce(Return(allocateRequestResult));
+    EXPECT_CALL(sut->mockPort, sendRequest(_)).Times(0);
+    EXPECT_CALL(sut->mockPort, releaseRequest(requestMock.userHeader())).Times(1);
+
+    auto result = sut->sendAsync(std::move(sut->loan().value()));
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(AsyncSendError::TOO_MANY_REQUESTS_IN_FLIGHT));
+}
+
+TEST_F(AsyncClient_test, FutureTimesOutWithoutProcessingResponses)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4f695037-8b87-4588-bd47-424763cb4c41");
+    auto future = sendRequest(1_ns);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    EXPECT_TRUE(future.isReady());
+    auto result = future.take();
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(AsyncResponseError::TIMED_OUT));
+    EXPECT_THAT(sut->numberOfRequestsInFlight(), Eq(0U));
+}
+
+TEST_F(AsyncClient_test, TimeUntilNextTimeoutIsMaxWithoutTimeout)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c42a32d7-4aa4-415b-941a-411399163686");
+    EXPECT_THAT(sut->timeUntilNextTimeout(), Eq(iox::units::Duration::max()));
+
+    auto future = sendRequest();
+
+    EXPECT_THAT(sut->timeUntilNextTimeout(), Eq(iox::units::Duration::max()));
+}
+
+TEST_F(AsyncClient_test, TimeUntilNextTimeoutIsTheEarliestTimeoutOfTheRequestsInFlight)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1f140e23-5b39-4d4c-9e06-62d67f49f78f");
+    auto laterFuture = sendRequest(10_s);
+    auto earlierFuture = sendRequest(5_s);
+
+    EXPECT_THAT(sut->timeUntilNextTimeout(), Le(5_s));
+    EXPECT_THAT(sut->timeUntilNextTimeout(), Gt(4_s));
+
+    earlierFuture.cancel();
+
+    EXPECT_THAT(sut->timeUntilNextTimeout(), Gt(5_s));
+}
+
+TEST_F(AsyncClient_test, TimeUntilNextTimeoutIsZeroWhenATimeoutExpired)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3eadbde6-3189-4a85-86f3-0c7eb6883a39");
+    auto future = sendRequest(1_ns);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    EXPECT_THAT(sut->timeUntilNextTimeout(), Eq(0_s));
+}
+
+} // namespace
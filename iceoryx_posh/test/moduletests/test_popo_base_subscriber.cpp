@@ -21,6 +21,7 @@
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/popo/base_subscriber.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/popo/sample_window.hpp"
 #include "iceoryx_posh/popo/wait_set.hpp"
 
 #include "iceoryx_posh/testing/mocks/chunk_mock.hpp"
@@ -60,6 +61,8 @@ class StubbedBaseSubscriber : public iox::popo::BaseSubscriber<port_t>
     using SubscriberParent::enableEvent;
     using SubscriberParent::enableState;
     using SubscriberParent::takeChunk;
+    using SubscriberParent::updateWindow;
+    using SubscriberParent::m_isWindowInUse;
 
     using SubscriberParent::port;
 };
@@ -174,6 +177,49 @@ TEST_F(BaseSubscriberTest, ClearReceiveBufferCallForwardedToUnderlyingSubscriber
     // ===== Cleanup ===== //
 }
 
+TEST_F(BaseSubscriberTest, UpdateWindowCallForwardedToUnderlyingSubscriberPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cfc73c9e-eb6c-4d2d-84ff-d21a11975e3b");
+    // ===== Setup ===== //
+    const iox::popo::SubscriberPortData::ChunkWindow_t window;
+    EXPECT_CALL(sut.port(), updateWindow).Times(1);
+    EXPECT_CALL(sut.port(), getWindow).WillOnce(ReturnRef(window));
+    // ===== Test ===== //
+    const auto& result = sut.updateWindow();
+    // ===== Verify ===== //
+    EXPECT_THAT(&result, Eq(&window));
+    // ===== Cleanup ===== //
+}
+
+TEST_F(BaseSubscriberTest, ReleaseWindowCallForwardedToUnderlyingSubscriberPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b1dd333d-6dee-4f48-b424-79c761f4e29f");
+    // ===== Setup ===== //
+    EXPECT_CALL(sut.port(), releaseWindow).Times(1);
+    // ===== Test ===== //
+    // ===== Verify ===== //
+    EXPECT_TRUE(sut.releaseWindow());
+    // ===== Cleanup ===== //
+}
+
+TEST_F(BaseSubscriberTest, ReleaseWindowIsRejectedWhileTheWindowIsInUse)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "40fcbb16-111e-46f4-aacf-c29a32f8ba97");
+    // ===== Setup ===== //
+    const iox::popo::SubscriberPortData::ChunkWindow_t window;
+    EXPECT_CALL(sut.port(), updateWindow).Times(1);
+    EXPECT_CALL(sut.port(), getWindow).WillOnce(ReturnRef(window));
+    EXPECT_CALL(sut.port(), releaseWindow).Times(1);
+    // ===== Test ===== //
+    {
+        iox::popo::SampleWindow<void> sampleWindow(sut.updateWindow(), sut.m_isWindowInUse);
+        // ===== Verify ===== //
+        EXPECT_FALSE(sut.releaseWindow());
+    }
+    EXPECT_TRUE(sut.releaseWindow());
+    // ===== Cleanup ===== //
+}
+
 TEST_F(BaseSubscriberTest, AttachStateToWaitsetForwardedToUnderlyingSubscriberPort)
 {
     ::testing::Test::RecordProperty("TEST_ID", "2b4c16fd-bb9d-4a4e-bc55-521be5c1ae18");
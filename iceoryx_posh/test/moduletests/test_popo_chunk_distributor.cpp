@@ -24,8 +24,11 @@
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_popper.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/popo/static_port_policy.hpp"
 #include "test.hpp"
 
 #include <memory>
@@ -39,6 +42,11 @@ using namespace iox::mepoo;
 
 using ChunkDistributorTestSubjects = Types<ThreadSafePolicy, SingleThreadedPolicy>;
 
+using PolicyWithHistory =
+    StaticPortPolicy<QueueFullPolicy::DISCARD_OLDEST_DATA, ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA, 16U>;
+using PolicyWithoutHistory =
+    StaticPortPolicy<QueueFullPolicy::DISCARD_OLDEST_DATA, ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA, 0U>;
+
 #ifdef __clang__
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wgnu-zero-variadic-macro-arguments"
@@ -124,6 +132,12 @@ class ChunkDistributor_test : public Test
         return std::make_shared<ChunkDistributorData_t>(policy, HISTORY_SIZE);
     }
 
+    std::shared_ptr<ChunkDistributorData_t> getChunkDistributorDataWithoutHistory(
+        const ConsumerTooSlowPolicy policy = ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA)
+    {
+        return std::make_shared<ChunkDistributorData_t>(policy, 0U);
+    }
+
     static constexpr std::chrono::milliseconds BLOCKING_DURATION{100};
 
     static constexpr iox::units::Duration DEADLOCK_TIMEOUT{2_s};
@@ -830,4 +844,329 @@ TYPED_TEST(ChunkDistributor_test, MultipleBlockingQueuesWillBeFilledWhenThereBec
     }
 }
 
+TYPED_TEST(ChunkDistributor_test, FastPathIsActiveWithOneQueueAndNoHistory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1dfb2cdf-d44a-454d-9151-4dd20c8bd803");
+    auto sutData = this->getChunkDistributorDataWithoutHistory();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    EXPECT_FALSE(sut.isFastPathActive());
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    EXPECT_TRUE(sut.isFastPathActive());
+}
+
+TYPED_TEST(ChunkDistributor_test, FastPathIsNotActiveWithHistory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2e40eac9-8695-4709-bcfa-9114cab020c2");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    EXPECT_FALSE(sut.isFastPathActive());
+}
+
+TYPED_TEST(ChunkDistributor_test, FastPathIsNotActiveWithBlockingQueue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a8fea2e7-cbe7-41cb-87c4-6a14d9572883");
+    auto sutData = this->getChunkDistributorDataWithoutHistory(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_SingleProducerSingleConsumer);
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    EXPECT_FALSE(sut.isFastPathActive());
+}
+
+TYPED_TEST(ChunkDistributor_test, FastPathDeliversChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c1b55b7f-baca-49a8-b94b-be51eb0869e2");
+    auto sutData = this->getChunkDistributorDataWithoutHistory();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+    ASSERT_TRUE(sut.isFastPathActive());
+
+    EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunk(8111U)), Eq(1U));
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(8111U));
+    EXPECT_THAT(sut.getHistorySize(), Eq(0U));
+}
+
+TYPED_TEST(ChunkDistributor_test, FastPathReportsLostChunkWhenQueueOverflows)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "25c3e3af-8e72-4016-8596-f023beff27c1");
+    constexpr uint64_t QUEUE_CAPACITY{2U};
+    auto sutData = this->getChunkDistributorDataWithoutHistory();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(QUEUE_CAPACITY);
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    for (uint64_t i = 0U; i <= QUEUE_CAPACITY; ++i)
+    {
+        EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunk(i)), Eq(1U));
+    }
+
+    EXPECT_TRUE(queue.hasLostChunks());
+    EXPECT_THAT(queue.size(), Eq(QUEUE_CAPACITY));
+}
+
+TYPED_TEST(ChunkDistributor_test, AddingSecondQueueFallsBackToLockedDelivery)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ca5c09bb-191a-4844-af06-82c396b7781f");
+    auto sutData = this->getChunkDistributorDataWithoutHistory();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData1 = this->getChunkQueueData();
+    auto queueData2 = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData1.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(queueData2.get()).has_error());
+
+    EXPECT_FALSE(sut.isFastPathActive());
+    EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunk(3113U)), Eq(2U));
+
+    for (auto& queueData : {queueData1, queueData2})
+    {
+        ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+        auto maybeSharedChunk = queue.tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(3113U));
+    }
+}
+
+TYPED_TEST(ChunkDistributor_test, RemovingSecondQueueReactivatesFastPath)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c3a6ce46-790b-4fff-8fe1-c70ec1722a0a");
+    auto sutData = this->getChunkDistributorDataWithoutHistory();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData1 = this->getChunkQueueData();
+    auto queueData2 = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData1.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(queueData2.get()).has_error());
+    ASSERT_FALSE(sut.tryRemoveQueue(queueData1.get()).has_error());
+
+    EXPECT_TRUE(sut.isFastPathActive());
+    EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunk(1337U)), Eq(1U));
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue1(queueData1.get());
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue2(queueData2.get());
+    EXPECT_TRUE(queue1.empty());
+    auto maybeSharedChunk = queue2.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(1337U));
+}
+
+TYPED_TEST(ChunkDistributor_test, RemovingAllQueuesDeactivatesFastPath)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "782b4985-92eb-4d6e-8a17-3991b4e013a9");
+    auto sutData = this->getChunkDistributorDataWithoutHistory();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+    sut.removeAllQueues();
+
+    EXPECT_FALSE(sut.isFastPathActive());
+    EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunk(42U)), Eq(0U));
+}
+
+TYPED_TEST(ChunkDistributor_test, ClosingAnAbandonedFastPathAllowsRemovingTheQueues)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f1fc8e19-a2b4-4d8d-bf8f-54c5ec765b02");
+    auto sutData = this->getChunkDistributorDataWithoutHistory();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+    // a sender which terminated while delivering via the fast path never leaves the gate
+    ASSERT_TRUE(sutData->m_fastPathGate.tryEnter());
+
+    sut.closeAbandonedFastPath();
+    sut.removeAllQueues();
+
+    EXPECT_FALSE(sut.isFastPathActive());
+    EXPECT_FALSE(sut.hasStoredQueues());
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverToQueueWorksWhileFastPathIsActive)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0a9e9ea5-0f98-4c5c-acc9-3728b7f5c012");
+    constexpr uint32_t QUEUE_INDEX{0U};
+    auto sutData = this->getChunkDistributorDataWithoutHistory();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+    ASSERT_TRUE(sut.isFastPathActive());
+
+    EXPECT_FALSE(sut.deliverToQueue(queueData->m_uniqueId, QUEUE_INDEX, this->allocateChunk(73U)).has_error());
+
+    EXPECT_TRUE(sut.isFastPathActive());
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(73U));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverToAllStoredQueuesWithStaticPolicyDeliversToMultipleQueuesAndHistory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "05c4a839-1483-4149-bf3e-f41633566017");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    constexpr uint64_t NUMBER_OF_QUEUES = 3U;
+    std::vector<std::shared_ptr<typename TestFixture::ChunkQueueData_t>> queueData;
+    for (auto i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        queueData.emplace_back(this->getChunkQueueData());
+        ASSERT_FALSE(sut.tryAddQueue(queueData.back().get()).has_error());
+    }
+
+    auto numberOfDeliveries = sut.template deliverToAllStoredQueues<PolicyWithHistory>(this->allocateChunk(4711U));
+    EXPECT_THAT(numberOfDeliveries, Eq(NUMBER_OF_QUEUES));
+
+    for (auto i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData[i].get());
+        auto maybeSharedChunk = queue.tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(4711U));
+    }
+    EXPECT_THAT(sut.getHistorySize(), Eq(1U));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverToAllStoredQueuesWithStaticPolicyWithoutHistoryUsesFastPath)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3f15c210-5579-4f8e-8acb-8da95eff5ec4");
+    auto sutData = this->getChunkDistributorDataWithoutHistory();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+    ASSERT_TRUE(sut.isFastPathActive());
+
+    EXPECT_THAT(sut.template deliverToAllStoredQueues<PolicyWithoutHistory>(this->allocateChunk(815U)), Eq(1U));
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(815U));
+    EXPECT_THAT(sut.getHistorySize(), Eq(0U));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverToAllStoredQueuesWithStaticPolicyAndFullQueueLosesChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1f966aee-eaff-4875-83e1-107cfc78cb88");
+    auto sutData = this->getChunkDistributorDataWithoutHistory();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    auto otherQueueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(otherQueueData.get()).has_error());
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+    EXPECT_THAT(sut.template deliverToAllStoredQueues<PolicyWithoutHistory>(this->allocateChunk(1U)), Eq(2U));
+    EXPECT_THAT(sut.template deliverToAllStoredQueues<PolicyWithoutHistory>(this->allocateChunk(2U)), Eq(2U));
+
+    EXPECT_TRUE(queue.hasLostChunks());
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(2U));
+    EXPECT_FALSE(queue.tryPop().has_value());
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverMultipleToAllStoredQueuesDeliversTheChunksInOrderAndAddsThemToTheHistory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e8d00c7b-e36d-404c-8018-1f03dcaa4c1c");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    constexpr uint64_t NUMBER_OF_QUEUES = 3U;
+    constexpr uint64_t NUMBER_OF_CHUNKS = 5U;
+    std::vector<std::shared_ptr<typename TestFixture::ChunkQueueData_t>> queueData;
+    for (auto i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        queueData.emplace_back(this->getChunkQueueData());
+        ASSERT_FALSE(sut.tryAddQueue(queueData.back().get()).has_error());
+    }
+
+    std::vector<SharedChunk> chunks;
+    for (auto i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        chunks.emplace_back(this->allocateChunk(i * 21U));
+    }
+    EXPECT_THAT(sut.deliverMultipleToAllStoredQueues(chunks.data(), NUMBER_OF_CHUNKS),
+                Eq(NUMBER_OF_QUEUES * NUMBER_OF_CHUNKS));
+
+    for (auto i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData[i].get());
+        for (auto k = 0U; k < NUMBER_OF_CHUNKS; ++k)
+        {
+            auto maybeSharedChunk = queue.tryPop();
+            ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+            EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(k * 21U));
+        }
+        EXPECT_FALSE(queue.tryPop().has_value());
+    }
+    EXPECT_THAT(sut.getHistorySize(), Eq(NUMBER_OF_CHUNKS));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverMultipleViaFastPathNotifiesTheQueueAfterTheLastChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c3098306-fba7-402c-942d-22c49eb92bd8");
+    constexpr uint64_t NUMBER_OF_CHUNKS = 4U;
+    auto sutData = this->getChunkDistributorDataWithoutHistory();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    ConditionVariableData condVar("Horscht");
+    ConditionListener condVarWaiter{condVar};
+    queue.setConditionVariable(condVar, 0U);
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+    ASSERT_TRUE(sut.isFastPathActive());
+
+    std::vector<SharedChunk> chunks;
+    for (auto i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        chunks.emplace_back(this->allocateChunk(i));
+    }
+    EXPECT_THAT(sut.deliverMultipleToAllStoredQueues(chunks.data(), NUMBER_OF_CHUNKS), Eq(NUMBER_OF_CHUNKS));
+
+    EXPECT_THAT(condVarWaiter.timedWait(1_ns).size(), Eq(1U));
+    EXPECT_THAT(queue.size(), Eq(NUMBER_OF_CHUNKS));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverMultipleWithWaitForConsumerDeliversEveryChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "196aa0d1-fc0f-4d3f-94b2-1334bb587225");
+    auto sutData = this->getChunkDistributorDataWithoutHistory(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER);
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    std::vector<SharedChunk> chunks{this->allocateChunk(1U), this->allocateChunk(2U)};
+    EXPECT_THAT(sut.deliverMultipleToAllStoredQueues(chunks.data(), chunks.size()), Eq(2U));
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    EXPECT_THAT(this->getSharedChunkValue(*queue.tryPop()), Eq(1U));
+    EXPECT_THAT(this->getSharedChunkValue(*queue.tryPop()), Eq(2U));
+}
+
 } // namespace
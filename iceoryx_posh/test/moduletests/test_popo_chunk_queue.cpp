@@ -187,6 +187,27 @@ TYPED_TEST(ChunkQueue_test, PushedChunksMustBePoppedInTheSameOrder)
     }
 }
 
+TYPED_TEST(ChunkQueue_test, PushedChunksMustBePoppedInTheSameOrderWithStaticQueueType)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b29f32cf-a7bd-4c94-b500-33853084c748");
+    constexpr int32_t NUMBER_CHUNKS{5};
+    for (int i = 0; i < NUMBER_CHUNKS; ++i)
+    {
+        auto chunk = this->allocateChunk();
+        *reinterpret_cast<int32_t*>(chunk.getUserPayload()) = i;
+        this->m_pusher.push(chunk);
+    }
+
+    for (int i = 0; i < NUMBER_CHUNKS; ++i)
+    {
+        auto maybeSharedChunk = this->m_popper.template tryPop<TypeParam::variantQueueType>();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        auto data = *reinterpret_cast<int32_t*>((*maybeSharedChunk).getUserPayload());
+        EXPECT_THAT(data, Eq(i));
+    }
+    EXPECT_FALSE(this->m_popper.template tryPop<TypeParam::variantQueueType>().has_value());
+}
+
 TYPED_TEST(ChunkQueue_test, PopChunkWithIncompatibleChunkHeaderCallsErrorHandler)
 {
     ::testing::Test::RecordProperty("TEST_ID", "597f1da3-6f64-4254-9e41-0c4776746a14");
@@ -210,6 +231,25 @@ TYPED_TEST(ChunkQueue_test, PopChunkWithIncompatibleChunkHeaderCallsErrorHandler
     EXPECT_EQ(receivedError, iox::PoshError::POPO__CHUNK_QUEUE_POPPER_CHUNK_WITH_INCOMPATIBLE_CHUNK_HEADER_VERSION);
 }
 
+TYPED_TEST(ChunkQueue_test, PopChunkWithIncompatibleChunkHeaderAndStaticQueueTypeCallsErrorHandler)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b2071e57-0b67-4e6e-b74f-9ba0811c63ce");
+    auto chunk = this->allocateChunk();
+    auto chunkHeaderAddress = reinterpret_cast<uint64_t>(chunk.getChunkHeader());
+    auto chunkHeaderVersionAddress = chunkHeaderAddress + sizeof(uint32_t);
+    auto chunkHeaderVersionPointer = reinterpret_cast<uint8_t*>(chunkHeaderVersionAddress);
+    *chunkHeaderVersionPointer = std::numeric_limits<uint8_t>::max();
+
+    this->m_pusher.push(chunk);
+
+    iox::PoshError receivedError{iox::PoshError::NO_ERROR};
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [&](const iox::PoshError error, const iox::ErrorLevel) { receivedError = error; });
+
+    EXPECT_FALSE(this->m_popper.template tryPop<TypeParam::variantQueueType>().has_value());
+    EXPECT_EQ(receivedError, iox::PoshError::POPO__CHUNK_QUEUE_POPPER_CHUNK_WITH_INCOMPATIBLE_CHUNK_HEADER_VERSION);
+}
+
 TYPED_TEST(ChunkQueue_test, ClearOnEmpty)
 {
     ::testing::Test::RecordProperty("TEST_ID", "9923de92-5c69-4b79-9f3b-793e790d07f3");
@@ -439,4 +479,33 @@ TYPED_TEST(ChunkQueueSoFi_test, LostChunkInfoIsResetAfterRead)
     EXPECT_FALSE(this->m_popper.hasLostChunks());
 }
 
+TYPED_TEST(ChunkQueue_test, PushWithoutNotificationNotifiesOnlyWithNotify)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "27dcd64e-91b1-4459-ac52-40ea7720f46b");
+    ConditionVariableData condVar("Horscht");
+    ConditionListener condVarWaiter{condVar};
+    this->m_popper.setConditionVariable(condVar, 0U);
+
+    EXPECT_TRUE(this->m_pusher.pushWithoutNotification(this->allocateChunk()));
+    EXPECT_TRUE(this->m_pusher.pushWithoutNotification(this->allocateChunk()));
+    EXPECT_FALSE(condVarWaiter.wasNotified());
+    EXPECT_THAT(this->m_popper.size(), Eq(2U));
+
+    this->m_pusher.notify(2U);
+
+    EXPECT_THAT(condVarWaiter.timedWait(1_ns).size(), Eq(1U));
+}
+
+TYPED_TEST(ChunkQueue_test, NotifyWithoutPushedChunksDoesNotNotify)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f0a998da-7b4c-486d-8ceb-93a31c3fbaf4");
+    ConditionVariableData condVar("Horscht");
+    ConditionListener condVarWaiter{condVar};
+    this->m_popper.setConditionVariable(condVar, 0U);
+
+    this->m_pusher.notify(0U);
+
+    EXPECT_FALSE(condVarWaiter.wasNotified());
+}
+
 } // namespace
@@ -184,6 +184,119 @@ TEST_F(ChunkReceiver_test, getTooMuchWithoutRelease)
     EXPECT_THAT(maybeChunkHeader.get_error(), Eq(iox::popo::ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL));
 }
 
+TEST_F(ChunkReceiver_test, getAndReleaseOneChunkWithStaticQueueType)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6585f67f-dac3-48bd-a5d0-f4b03cff9b4a");
+    constexpr auto QUEUE_TYPE = iox::cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer;
+    {
+        auto sharedChunk = getChunkFromMemoryManager();
+        EXPECT_TRUE(sharedChunk);
+        m_chunkQueuePusher.push(sharedChunk);
+
+        auto maybeChunkHeader = m_chunkReceiver.tryGet<QUEUE_TYPE>();
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+
+        EXPECT_TRUE(sharedChunk.getUserPayload() == (*maybeChunkHeader)->userPayload());
+        m_chunkReceiver.release(*maybeChunkHeader);
+    }
+
+    auto maybeChunkHeader = m_chunkReceiver.tryGet<QUEUE_TYPE>();
+    ASSERT_TRUE(maybeChunkHeader.has_error());
+    EXPECT_THAT(maybeChunkHeader.get_error(), Eq(iox::popo::ChunkReceiveResult::NO_CHUNK_AVAILABLE));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
+TEST_F(ChunkReceiver_test, getTooMuchWithoutReleaseWithStaticQueueType)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cf115dd7-9cde-4edd-8f66-9c390555e563");
+    constexpr auto QUEUE_TYPE = iox::cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer;
+    for (size_t i = 0; i < iox::MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY + 1; i++)
+    {
+        m_chunkQueuePusher.push(getChunkFromMemoryManager());
+        ASSERT_FALSE(m_chunkReceiver.tryGet<QUEUE_TYPE>().has_error());
+    }
+
+    m_chunkQueuePusher.push(getChunkFromMemoryManager());
+
+    auto maybeChunkHeader = m_chunkReceiver.tryGet<QUEUE_TYPE>();
+    ASSERT_TRUE(maybeChunkHeader.has_error());
+    EXPECT_THAT(maybeChunkHeader.get_error(), Eq(iox::popo::ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL));
+}
+
+TEST_F(ChunkReceiver_test, getMultipleFromEmptyQueueReturnsNoChunkAvailable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e8a11a64-a5fd-4247-91b8-8e283f1b7fb8");
+    uint64_t numberOfCalls{0U};
+    auto numberOfChunks = m_chunkReceiver.tryGetMultiple(4U, [&](const iox::mepoo::ChunkHeader*) { ++numberOfCalls; });
+    ASSERT_TRUE(numberOfChunks.has_error());
+    EXPECT_THAT(numberOfChunks.get_error(), Eq(iox::popo::ChunkReceiveResult::NO_CHUNK_AVAILABLE));
+    EXPECT_THAT(numberOfCalls, Eq(0U));
+}
+
+TEST_F(ChunkReceiver_test, getMultipleReturnsTheOldestChunksFirstAndAtMostTheRequestedNumber)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "73f9e7a9-3081-488c-98e0-b622ea567d33");
+    constexpr uint64_t NUMBER_OF_PUSHED_CHUNKS{5U};
+    std::vector<void*> userPayloads;
+    for (uint64_t i = 0U; i < NUMBER_OF_PUSHED_CHUNKS; ++i)
+    {
+        auto sharedChunk = getChunkFromMemoryManager();
+        userPayloads.push_back(sharedChunk.getUserPayload());
+        m_chunkQueuePusher.push(sharedChunk);
+    }
+
+    std::vector<const iox::mepoo::ChunkHeader*> chunkHeaders;
+    auto collect = [&](const iox::mepoo::ChunkHeader* chunkHeader) { chunkHeaders.push_back(chunkHeader); };
+    auto numberOfChunks = m_chunkReceiver.tryGetMultiple(3U, collect);
+    ASSERT_FALSE(numberOfChunks.has_error());
+    ASSERT_THAT(numberOfChunks.value(), Eq(3U));
+    numberOfChunks = m_chunkReceiver.tryGetMultiple(NUMBER_OF_PUSHED_CHUNKS, collect);
+    ASSERT_FALSE(numberOfChunks.has_error());
+    ASSERT_THAT(numberOfChunks.value(), Eq(2U));
+    ASSERT_THAT(chunkHeaders.size(), Eq(NUMBER_OF_PUSHED_CHUNKS));
+
+    for (uint64_t i = 0U; i < NUMBER_OF_PUSHED_CHUNKS; ++i)
+    {
+        EXPECT_THAT(chunkHeaders[i]->userPayload(), Eq(userPayloads[i]));
+        m_chunkReceiver.release(chunkHeaders[i]);
+    }
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
+TEST_F(ChunkReceiver_test, getMultipleWhenTooManyChunksAreHeldKeepsTheChunksInTheQueue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7bdecd20-c01d-46f7-a239-47a803cfa67c");
+    constexpr uint64_t MAX_CHUNKS_IN_USE{iox::MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY + 1U};
+    std::vector<const iox::mepoo::ChunkHeader*> chunkHeaders;
+    auto collect = [&](const iox::mepoo::ChunkHeader* chunkHeader) { chunkHeaders.push_back(chunkHeader); };
+    for (uint64_t i = 0U; i < MAX_CHUNKS_IN_USE - 1U; ++i)
+    {
+        m_chunkQueuePusher.push(getChunkFromMemoryManager());
+        auto maybeChunkHeader = m_chunkReceiver.tryGet();
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        chunkHeaders.push_back(maybeChunkHeader.value());
+    }
+    for (uint64_t i = 0U; i < 3U; ++i)
+    {
+        m_chunkQueuePusher.push(getChunkFromMemoryManager());
+    }
+
+    auto numberOfChunks = m_chunkReceiver.tryGetMultiple(3U, collect);
+    ASSERT_FALSE(numberOfChunks.has_error());
+    EXPECT_THAT(numberOfChunks.value(), Eq(1U));
+
+    auto failedGet = m_chunkReceiver.tryGetMultiple(2U, collect);
+    ASSERT_TRUE(failedGet.has_error());
+    EXPECT_THAT(failedGet.get_error(), Eq(iox::popo::ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL));
+
+    // the chunks which could not be held were not dropped
+    m_chunkReceiver.release(chunkHeaders[0U]);
+    m_chunkReceiver.release(chunkHeaders[1U]);
+    numberOfChunks = m_chunkReceiver.tryGetMultiple(2U, collect);
+    ASSERT_FALSE(numberOfChunks.has_error());
+    EXPECT_THAT(numberOfChunks.value(), Eq(2U));
+}
+
 TEST_F(ChunkReceiver_test, releaseInvalidChunk)
 {
     ::testing::Test::RecordProperty("TEST_ID", "2a47fd0e-a217-4565-98af-05779c938340");
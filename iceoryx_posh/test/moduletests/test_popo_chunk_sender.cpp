@@ -34,6 +34,7 @@
 #include "iceoryx_posh/testing/mocks/chunk_mock.hpp"
 #include "test.hpp"
 
+#include <cstring>
 #include <memory>
 
 namespace
@@ -205,6 +206,28 @@ TEST_F(ChunkSender_test, allocate_Overflow)
                 Eq(iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY));
 }
 
+TEST_F(ChunkSender_test, allocate_FailsWhenTheChunkQuotaIsExceeded)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "93d75482-2152-4920-938d-a0263379b189");
+    constexpr uint32_t MAX_CHUNKS{2U};
+    m_chunkSenderData.m_chunkQuota = m_memoryManager.acquireChunkQuota(0U, MAX_CHUNKS);
+    ASSERT_THAT(m_chunkSenderData.m_chunkQuota.get(), Ne(nullptr));
+
+    for (uint32_t i = 0U; i < MAX_CHUNKS; ++i)
+    {
+        auto maybeChunkHeader = m_chunkSender.tryAllocate(
+            UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+    }
+
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(
+        UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_TRUE(maybeChunkHeader.has_error());
+    EXPECT_THAT(maybeChunkHeader.get_error(), Eq(iox::popo::AllocationError::CHUNK_QUOTA_EXCEEDED));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(MAX_CHUNKS));
+    EXPECT_THAT(m_memoryManager.getNumberOfRejectedChunkRequests(0), Eq(1U));
+}
+
 TEST_F(ChunkSender_test, freeChunk)
 {
     ::testing::Test::RecordProperty("TEST_ID", "b4a6eb09-a431-4f38-bd0c-38baf896a639");
@@ -696,6 +719,28 @@ TEST_F(ChunkSender_test, ReuseOfLastIfBiggerButFitsInChunk)
     EXPECT_TRUE((*chunkBigger)->userPayload() == (*maybeLastChunk)->userPayload());
 }
 
+TEST_F(ChunkSender_test, ReuseOfLastChunkIsRecordedAsChunkRequest)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b32aeb1c-72ff-4528-bfe6-fd2ea23f5be2");
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(
+        UniquePortId(), BIG_CHUNK, USER_PAYLOAD_ALIGNMENT, USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT(m_chunkSender.send(*maybeChunkHeader), Eq(0U));
+
+    auto chunkSmaller = m_chunkSender.tryAllocate(
+        UniquePortId(), SMALL_CHUNK, USER_PAYLOAD_ALIGNMENT, USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(chunkSmaller.has_error());
+
+    // the reused chunk does not pass getChunk but must be visible in the histogram nevertheless
+    const auto& histogram = m_memoryManager.getRequestedChunkPayloadSizes();
+    uint64_t numberOfRequests{0U};
+    for (uint32_t bucket = 0U; bucket < iox::mepoo::ChunkSizeHistogram::NUMBER_OF_BUCKETS; ++bucket)
+    {
+        numberOfRequests += histogram.count(bucket);
+    }
+    EXPECT_THAT(numberOfRequests, Eq(2U));
+}
+
 TEST_F(ChunkSender_test, Cleanup)
 {
     ::testing::Test::RecordProperty("TEST_ID", "5e5ab921-24bf-45a9-9572-68e444120baa");
@@ -725,6 +770,49 @@ TEST_F(ChunkSender_test, Cleanup)
     EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
 }
 
+TEST_F(ChunkSender_test, ReusedChunkHasTheOriginIdOfTheAllocatingPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d836e27d-17fc-4f27-a56f-668feec21d1c");
+    const UniquePortId originId;
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(
+        originId, sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    auto firstChunkHeader = *maybeChunkHeader;
+    m_chunkSender.send(firstChunkHeader);
+
+    const UniquePortId otherOriginId;
+    maybeChunkHeader = m_chunkSender.tryAllocate(
+        otherOriginId, sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+
+    ASSERT_THAT(*maybeChunkHeader, Eq(firstChunkHeader));
+    EXPECT_THAT((*maybeChunkHeader)->originId(), Eq(otherOriginId));
+}
+
+TEST_F(ChunkSender_test, AllocatedAndSentChunksAreNotReclaimedForTheOriginId)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ad13789b-69d8-4c1a-8ea3-859db4145611");
+    const UniquePortId originId;
+    auto loanedChunk = m_chunkSender.tryAllocate(
+        originId, sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(loanedChunk.has_error());
+    auto sentChunk = m_chunkSender.tryAllocate(
+        originId, sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(sentChunk.has_error());
+    m_chunkSender.send(*sentChunk);
+    auto reusedChunk = m_chunkSender.tryAllocate(
+        originId, sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(reusedChunk.has_error());
+
+    const auto numberOfReleasedChunks = m_memoryManager.releaseChunksOfLostOwners(
+        0U, m_memoryManager.getNumberOfChunkManagements(), [&](const uint64_t owner) {
+            return owner == static_cast<uint64_t>(originId);
+        });
+
+    EXPECT_THAT(numberOfReleasedChunks, Eq(0U));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(2U));
+}
+
 TEST_F(ChunkSender_test, asStringLiteralConvertsAllocationErrorValuesToStrings)
 {
     ::testing::Test::RecordProperty("TEST_ID", "fdb713e1-0e2c-411e-a3ee-02c216d510d0");
@@ -738,7 +826,8 @@ TEST_F(ChunkSender_test, asStringLiteralConvertsAllocationErrorValuesToStrings)
                             AllocationError::RUNNING_OUT_OF_CHUNKS,
                             AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL,
                             AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER,
-                            AllocationError::INVALID_PARAMETER_FOR_REQUEST_HEADER})
+                            AllocationError::INVALID_PARAMETER_FOR_REQUEST_HEADER,
+                            AllocationError::CHUNK_QUOTA_EXCEEDED})
     {
         auto enumString = iox::popo::asStringLiteral(sut);
 
@@ -762,6 +851,9 @@ TEST_F(ChunkSender_test, asStringLiteralConvertsAllocationErrorValuesToStrings)
         case AllocationError::INVALID_PARAMETER_FOR_REQUEST_HEADER:
             EXPECT_THAT(enumString, StrEq("AllocationError::INVALID_PARAMETER_FOR_REQUEST_HEADER"));
             break;
+        case AllocationError::CHUNK_QUOTA_EXCEEDED:
+            EXPECT_THAT(enumString, StrEq("AllocationError::CHUNK_QUOTA_EXCEEDED"));
+            break;
         }
 
         testedEnumValues |= 1U << static_cast<uint64_t>(sut);
@@ -788,4 +880,233 @@ TEST_F(ChunkSender_test, LogStreamConvertsAllocationErrorValueToString)
     EXPECT_THAT(loggerMock.m_logs[0].message, StrEq(iox::popo::asStringLiteral(sut)));
 }
 
+class ChunkSenderMultiChunk_test : public Test
+{
+  protected:
+    ChunkSenderMultiChunk_test()
+    {
+        m_mempoolconf.addMemPool({PART_CHUNK, NUM_CHUNKS_IN_POOL});
+        m_mempoolconf.addMemPool({HEAD_CHUNK, NUM_CHUNKS_IN_POOL});
+        m_memoryManager.configureMemoryManager(m_mempoolconf, m_memoryAllocator, m_memoryAllocator);
+    }
+
+    iox::cxx::expected<iox::mepoo::MultiChunkTable*, iox::popo::AllocationError>
+    allocateMultiChunk(const UniquePortId originId, const iox::mepoo::MultiChunkTable::PartSizes_t& partSizes)
+    {
+        auto maybeChunkHeader = m_chunkSender.tryAllocateMultiChunk(
+            originId, partSizes, USER_PAYLOAD_ALIGNMENT, USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+        if (maybeChunkHeader.has_error())
+        {
+            return iox::cxx::error<iox::popo::AllocationError>(maybeChunkHeader.get_error());
+        }
+        return iox::cxx::success<iox::mepoo::MultiChunkTable*>(
+            static_cast<iox::mepoo::MultiChunkTable*>((*maybeChunkHeader)->userPayload()));
+    }
+
+    static iox::mepoo::MultiChunkTable::PartSizes_t toPartSizes(std::initializer_list<uint32_t> sizes)
+    {
+        iox::mepoo::MultiChunkTable::PartSizes_t partSizes;
+        for (const auto size : sizes)
+        {
+            partSizes.emplace_back(size);
+        }
+        return partSizes;
+    }
+
+    static iox::mepoo::ChunkHeader* headOf(iox::mepoo::MultiChunkTable* const multiChunkTable)
+    {
+        return iox::mepoo::ChunkHeader::fromUserPayload(multiChunkTable);
+    }
+
+    static constexpr size_t MEMORY_SIZE = 1024 * 1024;
+    uint8_t m_memory[MEMORY_SIZE];
+    static constexpr uint32_t NUM_CHUNKS_IN_POOL = 20;
+    static constexpr uint32_t PART_CHUNK = 128;
+    static constexpr uint32_t HEAD_CHUNK = 1024;
+    static constexpr uint32_t PART_SIZE = 64;
+
+    static constexpr uint32_t USER_PAYLOAD_ALIGNMENT = iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT;
+    static constexpr uint32_t USER_HEADER_SIZE = iox::CHUNK_NO_USER_HEADER_SIZE;
+    static constexpr uint32_t USER_HEADER_ALIGNMENT = iox::CHUNK_NO_USER_HEADER_ALIGNMENT;
+
+    iox::posix::Allocator m_memoryAllocator{m_memory, MEMORY_SIZE};
+    iox::mepoo::MePooConfig m_mempoolconf;
+    iox::mepoo::MemoryManager m_memoryManager;
+
+    struct ChunkDistributorConfig
+    {
+        static constexpr uint32_t MAX_QUEUES = 1;
+        static constexpr uint64_t MAX_HISTORY_CAPACITY = iox::MAX_PUBLISHER_HISTORY;
+    };
+
+    struct ChunkQueueConfig
+    {
+        static constexpr uint64_t MAX_QUEUE_CAPACITY = NUM_CHUNKS_IN_POOL;
+    };
+
+    using ChunkQueueData_t = iox::popo::ChunkQueueData<ChunkQueueConfig, iox::popo::ThreadSafePolicy>;
+    using ChunkDistributorData_t = iox::popo::ChunkDistributorData<ChunkDistributorConfig,
+                                                                   iox::popo::ThreadSafePolicy,
+                                                                   iox::popo::ChunkQueuePusher<ChunkQueueData_t>>;
+    using ChunkSenderData_t =
+        iox::popo::ChunkSenderData<iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY, ChunkDistributorData_t>;
+
+    ChunkSenderData_t m_chunkSenderData{&m_memoryManager, iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA, 0};
+    iox::popo::ChunkSender<ChunkSenderData_t> m_chunkSender{&m_chunkSenderData};
+};
+
+TEST_F(ChunkSenderMultiChunk_test, allocateMultiChunk_TableContainsAllParts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b01c2afd-13cf-4e7d-af34-79cec87f1909");
+    const UniquePortId originId;
+    const auto partSizes = toPartSizes({PART_SIZE, PART_SIZE / 2, PART_SIZE / 4});
+    auto maybeTable = allocateMultiChunk(originId, partSizes);
+    ASSERT_FALSE(maybeTable.has_error());
+
+    auto multiChunkTable = *maybeTable;
+    ASSERT_THAT(multiChunkTable->numberOfParts(), Eq(partSizes.size()));
+    EXPECT_THAT(multiChunkTable->totalSize(), Eq(PART_SIZE + PART_SIZE / 2 + PART_SIZE / 4));
+    for (uint32_t i = 0U; i < multiChunkTable->numberOfParts(); ++i)
+    {
+        EXPECT_THAT(multiChunkTable->partSize(i), Eq(partSizes[i]));
+        auto partChunkHeader = iox::mepoo::ChunkHeader::fromUserPayload(multiChunkTable->part(i));
+        EXPECT_THAT(partChunkHeader->userPayloadSize(), Eq(partSizes[i]));
+        EXPECT_THAT(partChunkHeader->originId(), Eq(originId));
+    }
+    EXPECT_THAT(headOf(multiChunkTable)->originId(), Eq(originId));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(partSizes.size()));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(1).m_usedChunks, Eq(1U));
+}
+
+TEST_F(ChunkSenderMultiChunk_test, allocateMultiChunk_OnlyTheHeadChunkIsFlaggedAsMultiChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "52757b7a-cee0-4aea-a06d-6774d7235216");
+    auto maybeTable = allocateMultiChunk(UniquePortId(), toPartSizes({PART_SIZE, PART_SIZE}));
+    ASSERT_FALSE(maybeTable.has_error());
+
+    auto multiChunkTable = *maybeTable;
+    EXPECT_TRUE(headOf(multiChunkTable)->isMultiChunk());
+    for (uint32_t i = 0U; i < multiChunkTable->numberOfParts(); ++i)
+    {
+        EXPECT_FALSE(iox::mepoo::ChunkHeader::fromUserPayload(multiChunkTable->part(i))->isMultiChunk());
+    }
+}
+
+TEST_F(ChunkSenderMultiChunk_test, allocate_ReusedHeadChunkOfAMultiChunkSampleIsNotFlaggedAsMultiChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "486fdbf6-a2dd-4c64-96aa-1f5ff1e36444");
+    auto maybeTable = allocateMultiChunk(UniquePortId(), toPartSizes({PART_SIZE}));
+    ASSERT_FALSE(maybeTable.has_error());
+    auto firstHead = headOf(*maybeTable);
+    m_chunkSender.send(firstHead);
+
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(
+        UniquePortId(), PART_SIZE, USER_PAYLOAD_ALIGNMENT, USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+
+    EXPECT_THAT(*maybeChunkHeader, Eq(firstHead));
+    EXPECT_FALSE((*maybeChunkHeader)->isMultiChunk());
+}
+
+TEST_F(ChunkSenderMultiChunk_test, releaseMultiChunk_ReleasesTheHeadAndAllParts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7b5a26d0-1502-491c-8ce4-d9fe0dec67b4");
+    auto maybeTable = allocateMultiChunk(UniquePortId(), toPartSizes({PART_SIZE, PART_SIZE, PART_SIZE}));
+    ASSERT_FALSE(maybeTable.has_error());
+
+    m_chunkSender.release(headOf(*maybeTable));
+
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(1).m_usedChunks, Eq(0U));
+}
+
+TEST_F(ChunkSenderMultiChunk_test, allocateMultiChunk_FailsAndReleasesEverythingWhenAPartCannotBeAllocated)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1f588586-3c2e-4a3e-9a2a-52616449743f");
+    constexpr uint32_t MAX_PART_CHUNKS{2U};
+    m_chunkSenderData.m_chunkQuota = m_memoryManager.acquireChunkQuota(0U, MAX_PART_CHUNKS);
+    ASSERT_THAT(m_chunkSenderData.m_chunkQuota.get(), Ne(nullptr));
+
+    auto maybeTable = allocateMultiChunk(UniquePortId(), toPartSizes({PART_SIZE, PART_SIZE, PART_SIZE}));
+
+    ASSERT_TRUE(maybeTable.has_error());
+    EXPECT_THAT(maybeTable.get_error(), Eq(iox::popo::AllocationError::CHUNK_QUOTA_EXCEEDED));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(1).m_usedChunks, Eq(0U));
+    EXPECT_FALSE(m_chunkSender.tryGetPreviousChunk().has_value());
+}
+
+TEST_F(ChunkSenderMultiChunk_test, allocateMultiChunk_ReusedLastChunkReleasesTheOldParts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0ab2ef97-9e97-4006-98ef-09b635de5905");
+    auto maybeTable = allocateMultiChunk(UniquePortId(), toPartSizes({PART_SIZE, PART_SIZE, PART_SIZE}));
+    ASSERT_FALSE(maybeTable.has_error());
+    auto firstHead = headOf(*maybeTable);
+    m_chunkSender.send(firstHead);
+
+    maybeTable = allocateMultiChunk(UniquePortId(), toPartSizes({PART_SIZE}));
+    ASSERT_FALSE(maybeTable.has_error());
+
+    EXPECT_THAT(headOf(*maybeTable), Eq(firstHead));
+    EXPECT_THAT((*maybeTable)->numberOfParts(), Eq(1U));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1U));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(1).m_usedChunks, Eq(1U));
+}
+
+TEST_F(ChunkSenderMultiChunk_test, gatherCopiesThePartsInTheirOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "52881f3c-c684-4379-ab85-7b0266e2d1ca");
+    auto maybeTable = allocateMultiChunk(UniquePortId(), toPartSizes({PART_SIZE, PART_SIZE / 2}));
+    ASSERT_FALSE(maybeTable.has_error());
+    auto multiChunkTable = *maybeTable;
+    std::memset(multiChunkTable->part(0U), 1, multiChunkTable->partSize(0U));
+    std::memset(multiChunkTable->part(1U), 2, multiChunkTable->partSize(1U));
+
+    uint8_t buffer[PART_SIZE * 2U]{};
+    EXPECT_THAT(multiChunkTable->gather(buffer, sizeof(buffer)), Eq(PART_SIZE + PART_SIZE / 2));
+    EXPECT_THAT(buffer[0U], Eq(1U));
+    EXPECT_THAT(buffer[PART_SIZE - 1U], Eq(1U));
+    EXPECT_THAT(buffer[PART_SIZE], Eq(2U));
+    EXPECT_THAT(buffer[PART_SIZE + PART_SIZE / 2 - 1U], Eq(2U));
+    EXPECT_THAT(buffer[PART_SIZE + PART_SIZE / 2], Eq(0U));
+
+    constexpr uint64_t SHORT_BUFFER_SIZE{PART_SIZE + 1U};
+    EXPECT_THAT(multiChunkTable->gather(buffer, SHORT_BUFFER_SIZE), Eq(SHORT_BUFFER_SIZE));
+}
+
+TEST_F(ChunkSender_test, sendMultipleChunksWithSingleCallDeliversThemInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8460176b-054b-4ce6-8e25-9c4cf9754666");
+    constexpr uint64_t NUMBER_OF_CHUNKS{3U};
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+
+    iox::mepoo::ChunkHeader* chunkHeaders[NUMBER_OF_CHUNKS];
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto maybeChunkHeader = m_chunkSender.tryAllocate(
+            UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        chunkHeaders[i] = *maybeChunkHeader;
+        new (chunkHeaders[i]->userPayload()) DummySample{i};
+    }
+
+    EXPECT_THAT(m_chunkSender.sendMultiple(chunkHeaders, NUMBER_OF_CHUNKS), Eq(NUMBER_OF_CHUNKS));
+
+    auto maybeLastChunk = m_chunkSender.tryGetPreviousChunk();
+    ASSERT_TRUE(maybeLastChunk.has_value());
+    EXPECT_THAT(*maybeLastChunk, Eq(chunkHeaders[NUMBER_OF_CHUNKS - 1U]));
+
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> myQueue(&m_chunkQueueData);
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto popRet = myQueue.tryPop();
+        ASSERT_TRUE(popRet.has_value());
+        EXPECT_THAT(popRet->getChunkHeader()->sequenceNumber(), Eq(i));
+        EXPECT_THAT(static_cast<DummySample*>(popRet->getUserPayload())->dummy, Eq(i));
+    }
+    EXPECT_TRUE(myQueue.empty());
+    // only the last chunk is still held by the sender
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1U));
+}
+
 } // namespace
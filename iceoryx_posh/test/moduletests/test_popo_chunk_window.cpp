@@ -0,0 +1,194 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/internal/popo/chunk_window.hpp"
+
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+
+#include "test.hpp"
+
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::mepoo;
+using namespace iox::popo;
+
+class ChunkWindow_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        MePooConfig mempoolconf;
+        mempoolconf.addMemPool({CHUNK_SIZE, NUM_CHUNKS_IN_POOL});
+
+        iox::posix::Allocator memoryAllocator{m_memory.get(), MEMORY_SIZE};
+        memoryManager.configureMemoryManager(mempoolconf, memoryAllocator, memoryAllocator);
+    };
+
+    void TearDown() override{};
+
+    SharedChunk getChunkFromMemoryManager()
+    {
+        constexpr uint32_t USER_PAYLOAD_SIZE{32U};
+        auto chunkSettingsResult =
+            iox::mepoo::ChunkSettings::create(USER_PAYLOAD_SIZE, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+        iox::cxx::Ensures(!chunkSettingsResult.has_error());
+        auto& chunkSettings = chunkSettingsResult.value();
+
+        auto getChunkResult = memoryManager.getChunk(chunkSettings);
+        iox::cxx::Ensures(!getChunkResult.has_error());
+        return getChunkResult.value();
+    }
+
+    std::vector<const ChunkHeader*> pushChunks(uint32_t numberOfChunks)
+    {
+        std::vector<const ChunkHeader*> chunkHeaders;
+        for (uint32_t i = 0; i < numberOfChunks; ++i)
+        {
+            auto chunk = getChunkFromMemoryManager();
+            chunkHeaders.push_back(chunk.getChunkHeader());
+            EXPECT_TRUE(sut.push(std::move(chunk)));
+        }
+        return chunkHeaders;
+    }
+
+    uint32_t usedChunks()
+    {
+        return memoryManager.getMemPoolInfo(0U).m_usedChunks;
+    }
+
+    static constexpr uint32_t NUM_CHUNKS_IN_POOL = 100U;
+    static constexpr uint32_t CHUNK_SIZE = 128U;
+
+    MemoryManager memoryManager;
+
+    static constexpr uint32_t CHUNK_WINDOW_CAPACITY{10U};
+    static constexpr uint32_t WINDOW_SIZE{4U};
+    ChunkWindow<CHUNK_WINDOW_CAPACITY> sut{WINDOW_SIZE};
+
+  private:
+    static constexpr size_t MEGABYTE = 1U << 20U;
+    static constexpr size_t MEMORY_SIZE = 4U * MEGABYTE;
+    std::unique_ptr<char[]> m_memory{new char[MEMORY_SIZE]};
+};
+
+TEST_F(ChunkWindow_test, InitiallyEmpty)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "280a6701-87c4-4a55-a0ef-e64472c0919d");
+    EXPECT_THAT(sut.size(), Eq(0U));
+    EXPECT_THAT(sut.windowSize(), Eq(WINDOW_SIZE));
+}
+
+TEST_F(ChunkWindow_test, WindowSizeIsLimitedToCapacity)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "39dd6d27-10a2-4b66-a213-05892ce2de23");
+    ChunkWindow<CHUNK_WINDOW_CAPACITY> window{CHUNK_WINDOW_CAPACITY + 1U};
+    EXPECT_THAT(window.windowSize(), Eq(CHUNK_WINDOW_CAPACITY));
+}
+
+TEST_F(ChunkWindow_test, DisabledWindowReleasesThePushedChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ce24a44d-87f1-4ad0-939e-6d861c774e02");
+    ChunkWindow<CHUNK_WINDOW_CAPACITY> window;
+
+    EXPECT_FALSE(window.push(getChunkFromMemoryManager()));
+
+    EXPECT_THAT(window.size(), Eq(0U));
+    EXPECT_THAT(usedChunks(), Eq(0U));
+}
+
+TEST_F(ChunkWindow_test, PushedChunksAreOrderedFromTheOldestToTheLatest)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "04d4781c-b493-4ae6-a8f3-826a2031d9ae");
+    auto chunkHeaders = pushChunks(WINDOW_SIZE - 1U);
+
+    ASSERT_THAT(sut.size(), Eq(WINDOW_SIZE - 1U));
+    for (uint32_t i = 0; i < sut.size(); ++i)
+    {
+        EXPECT_THAT(sut.getChunkHeader(i), Eq(chunkHeaders[i]));
+    }
+    EXPECT_THAT(usedChunks(), Eq(WINDOW_SIZE - 1U));
+}
+
+TEST_F(ChunkWindow_test, FullWindowReleasesTheOldestChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6c21fe40-f85b-42c3-ac4c-8b11a9397b0e");
+    constexpr uint32_t NUMBER_OF_EVICTED_CHUNKS{3U};
+    auto chunkHeaders = pushChunks(WINDOW_SIZE + NUMBER_OF_EVICTED_CHUNKS);
+
+    ASSERT_THAT(sut.size(), Eq(WINDOW_SIZE));
+    for (uint32_t i = 0; i < sut.size(); ++i)
+    {
+        EXPECT_THAT(sut.getChunkHeader(i), Eq(chunkHeaders[i + NUMBER_OF_EVICTED_CHUNKS]));
+    }
+    EXPECT_THAT(usedChunks(), Eq(WINDOW_SIZE));
+}
+
+TEST_F(ChunkWindow_test, ChunkInTheWindowIsKeptWhenTheOtherReferencesAreDropped)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0f7e72bd-889e-4589-a149-c79ddc14a10e");
+    {
+        auto chunk = getChunkFromMemoryManager();
+        auto copy = chunk;
+        EXPECT_TRUE(sut.push(std::move(copy)));
+    }
+
+    EXPECT_THAT(sut.size(), Eq(1U));
+    EXPECT_THAT(usedChunks(), Eq(1U));
+}
+
+TEST_F(ChunkWindow_test, ClearReleasesAllChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1c7e9835-d249-4171-a6a8-85f8ac21762c");
+    pushChunks(WINDOW_SIZE + 1U);
+
+    sut.clear();
+
+    EXPECT_THAT(sut.size(), Eq(0U));
+    EXPECT_THAT(usedChunks(), Eq(0U));
+}
+
+TEST_F(ChunkWindow_test, WindowCanBeFilledAgainAfterClear)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4b792097-d0b6-4216-bc41-3fed38e32b30");
+    pushChunks(WINDOW_SIZE + 1U);
+    sut.clear();
+
+    auto chunkHeaders = pushChunks(WINDOW_SIZE);
+
+    ASSERT_THAT(sut.size(), Eq(WINDOW_SIZE));
+    EXPECT_THAT(sut.getChunkHeader(0U), Eq(chunkHeaders.front()));
+    EXPECT_THAT(sut.getChunkHeader(WINDOW_SIZE - 1U), Eq(chunkHeaders.back()));
+    EXPECT_THAT(usedChunks(), Eq(WINDOW_SIZE));
+}
+
+TEST_F(ChunkWindow_test, CleanupReleasesAllChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "96f68390-5d05-4928-b2b8-341ec262bceb");
+    pushChunks(WINDOW_SIZE + 1U);
+
+    sut.cleanup();
+
+    EXPECT_THAT(sut.size(), Eq(0U));
+    EXPECT_THAT(usedChunks(), Eq(0U));
+}
+
+} // namespace
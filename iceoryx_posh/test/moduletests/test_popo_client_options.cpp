@@ -34,6 +34,7 @@ TEST(ClientOptions_test, SerializationRoundTripIsSuccessful)
     testOptions.connectOnCreate = false;
     testOptions.responseQueueFullPolicy = iox::popo::QueueFullPolicy::BLOCK_PRODUCER;
     testOptions.serverTooSlowPolicy = iox::popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    testOptions.maxOutstandingRequests = 73U;
 
     iox::popo::ClientOptions::deserialize(testOptions.serialize())
         .and_then([&](auto& roundTripOptions) {
@@ -51,6 +52,9 @@ TEST(ClientOptions_test, SerializationRoundTripIsSuccessful)
 
             EXPECT_THAT(roundTripOptions.serverTooSlowPolicy, Ne(defaultOptions.serverTooSlowPolicy));
             EXPECT_THAT(roundTripOptions.serverTooSlowPolicy, Eq(testOptions.serverTooSlowPolicy));
+
+            EXPECT_THAT(roundTripOptions.maxOutstandingRequests, Ne(defaultOptions.maxOutstandingRequests));
+            EXPECT_THAT(roundTripOptions.maxOutstandingRequests, Eq(testOptions.maxOutstandingRequests));
         })
         .or_else([&](auto&) {
             constexpr bool DESERIALZATION_ERROR_OCCURED{true};
@@ -81,9 +85,14 @@ iox::cxx::Serialization enumSerialization(QueueFullPolicyUT responseQueueFullPol
     constexpr uint64_t RESPONSE_QUEUE_CAPACITY{42U};
     const iox::NodeName_t NODE_NAME{"harr-harr"};
     constexpr bool CONNECT_ON_CREATE{true};
-
-    return iox::cxx::Serialization::create(
-        RESPONSE_QUEUE_CAPACITY, NODE_NAME, CONNECT_ON_CREATE, responseQueueFullPolicy, serverTooSlowPolicy);
+    constexpr uint64_t MAX_OUTSTANDING_REQUESTS{13U};
+
+    return iox::cxx::Serialization::create(RESPONSE_QUEUE_CAPACITY,
+                                           NODE_NAME,
+                                           CONNECT_ON_CREATE,
+                                           responseQueueFullPolicy,
+                                           serverTooSlowPolicy,
+                                           MAX_OUTSTANDING_REQUESTS);
 }
 
 TEST(ClientOptions_test, DeserializingValidResponseQueueFullAndServerTooSlowPolicyIsSuccessful)
@@ -215,4 +224,16 @@ TEST(ClientOptions_test, ComparisonOperatorReturnsFalseServerTooSlowPolicyDoesNo
     EXPECT_FALSE(options2 == options1);
 }
 
+TEST(ClientOptions_test, ComparisonOperatorReturnsFalseMaxOutstandingRequestsDoesNotMatch)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c99b78ff-a87b-413e-ad06-39850a0cae0a");
+    ClientOptions options1;
+    options1.maxOutstandingRequests = 42U;
+    ClientOptions options2;
+    options2.maxOutstandingRequests = 73U;
+
+    EXPECT_FALSE(options1 == options2);
+    EXPECT_FALSE(options2 == options1);
+}
+
 } // namespace
@@ -23,6 +23,7 @@
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
 #include "test.hpp"
 
+#include <array>
 #include <atomic>
 #include <memory>
 #include <thread>
@@ -494,4 +495,180 @@ TEST_F(ConditionVariable_test, TimedWaitReturnsSortedListWhenTriggeredInReverseO
         *this, [this] { return m_waiter.timedWait(iox::units::Duration::fromSeconds(1)); });
 }
 
+TEST_F(ConditionVariable_test, NotifyDoesNotPostSemaphoreWhenListenerIsPolling)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "90893d71-c5e6-4b4e-b1a1-204891e8ec4e");
+    m_condVarData.m_isListenerPolling.store(true);
+    m_signaler.notify();
+
+    EXPECT_TRUE(m_waiter.wasNotified());
+    EXPECT_FALSE(m_condVarData.m_semaphore->tryWait().value());
+}
+
+TEST_F(ConditionVariable_test, NotifyPostsSemaphoreWhenListenerIsNotPolling)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "725ff3a4-b75d-40dc-ab7d-e45c7b1e88b1");
+    m_signaler.notify();
+
+    EXPECT_TRUE(m_condVarData.m_semaphore->tryWait().value());
+}
+
+TEST_F(ConditionVariable_test, PollingWaitReturnsNotificationFromOtherThread)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "98a3032b-ab56-442c-b1b2-d8ec2bca0e0d");
+    constexpr uint64_t NUMBER_OF_NOTIFICATIONS{1000U};
+    ConditionListener sut(m_condVarData, WaitStrategy{100U, 10U});
+
+    std::atomic<uint64_t> counter{0U};
+    std::thread notifier([&] {
+        for (uint64_t i = 0U; i < NUMBER_OF_NOTIFICATIONS; ++i)
+        {
+            while (counter.load() != i)
+            {
+                std::this_thread::yield();
+            }
+            m_notifiers[i % m_notifiers.size()].notify();
+        }
+    });
+
+    for (uint64_t i = 0U; i < NUMBER_OF_NOTIFICATIONS; ++i)
+    {
+        auto notifications = sut.wait();
+        ASSERT_THAT(notifications.size(), Eq(1U));
+        EXPECT_THAT(notifications[0], Eq(i % m_notifiers.size()));
+        counter.store(i + 1U);
+    }
+    notifier.join();
+    EXPECT_FALSE(m_condVarData.m_isListenerPolling.load());
+}
+
+TEST_F(ConditionVariable_test, PollingTimedWaitWithoutNotificationReturnsEmptyVector)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f4a9f7e0-cc97-45f1-bb21-562a3f86ebcf");
+    ConditionListener sut(m_condVarData, WaitStrategy{100U, 10U});
+    EXPECT_TRUE(sut.timedWait(iox::units::Duration::fromMilliseconds(10)).empty());
+    EXPECT_FALSE(m_condVarData.m_isListenerPolling.load());
+}
+
+TEST_F(ConditionVariable_test, PollingWaitDoesNotReturnWithStaleNotificationFlag)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "adc5768c-d00a-4801-b760-cef8d84a03e2");
+    ConditionListener sut(m_condVarData, WaitStrategy{100U, 10U});
+    m_condVarData.m_wasNotified.store(true);
+
+    std::atomic_bool hasWaitReturned{false};
+    std::thread waiter([&] {
+        auto notifications = sut.wait();
+        EXPECT_THAT(notifications.size(), Eq(1U));
+        hasWaitReturned = true;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_FALSE(hasWaitReturned.load());
+    m_signaler.notify();
+    waiter.join();
+    EXPECT_TRUE(hasWaitReturned.load());
+}
+
+TEST_F(ConditionVariable_test, NotifyWithoutConsumedNotificationDoesNotPostSemaphoreAgain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0783f484-6bc7-4faf-b3d1-0005ad127220");
+    m_signaler.notify();
+    m_signaler.notify();
+    m_notifiers[1U].notify();
+
+    EXPECT_TRUE(m_condVarData.m_semaphore->tryWait().value());
+    EXPECT_FALSE(m_condVarData.m_semaphore->tryWait().value());
+}
+
+TEST_F(ConditionVariable_test, NotifyAfterWaitConsumedTheNotificationPostsSemaphoreAgain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "56f5c3fe-e558-474d-a427-27789c246cb2");
+    m_signaler.notify();
+    EXPECT_THAT(m_waiter.wait().size(), Eq(1U));
+
+    m_signaler.notify();
+
+    EXPECT_TRUE(m_condVarData.m_semaphore->tryWait().value());
+}
+
+TEST_F(ConditionVariable_test, CoalescedNotificationsOfAllNotifiersAreCollected)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "466a7d3c-8df7-44fa-a978-81c26cfd8a48");
+    for (auto& notifier : m_notifiers)
+    {
+        notifier.notify();
+    }
+
+    auto notifications = m_waiter.wait();
+
+    ASSERT_THAT(notifications.size(), Eq(iox::MAX_NUMBER_OF_NOTIFIERS));
+    for (uint64_t i = 0U; i < notifications.size(); ++i)
+    {
+        EXPECT_THAT(notifications[i], Eq(i));
+    }
+}
+
+TEST_F(ConditionVariable_test, WaitDoesNotBlockOnNotificationWhichWasCoalescedWithAnAlreadyCollectedOne)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6d9e0562-a0b9-478b-a866-71d9dddd696e");
+    m_signaler.notify();
+    EXPECT_THAT(m_waiter.wait().size(), Eq(1U));
+
+    // the first wait consumed the notification flag, therefore the second notification must post the semaphore again
+    m_notifiers[1U].notify();
+    auto notifications = m_waiter.timedWait(m_timeToWait);
+
+    ASSERT_THAT(notifications.size(), Eq(1U));
+    EXPECT_THAT(notifications[0U], Eq(1U));
+}
+
+TEST_F(ConditionVariable_test, ConcurrentNotifiersDoNotLoseWakeups)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "91f27f6f-4eec-4100-af93-43d602fe01d2");
+    constexpr uint64_t NUMBER_OF_NOTIFIER_THREADS{4U};
+    constexpr uint64_t NUMBER_OF_ROUNDS{200U};
+    std::atomic<uint64_t> round{0U};
+
+    std::vector<std::thread> notifierThreads;
+    for (uint64_t t = 0U; t < NUMBER_OF_NOTIFIER_THREADS; ++t)
+    {
+        notifierThreads.emplace_back([&, t] {
+            for (uint64_t i = 0U; i < NUMBER_OF_ROUNDS; ++i)
+            {
+                while (round.load() < i)
+                {
+                    std::this_thread::yield();
+                }
+                m_notifiers[t].notify();
+            }
+        });
+    }
+
+    for (uint64_t i = 0U; i < NUMBER_OF_ROUNDS; ++i)
+    {
+        // every notifier thread notifies exactly once per round; a lost wakeup would block the wait call
+        uint64_t collectedNotifiers{0U};
+        std::array<bool, NUMBER_OF_NOTIFIER_THREADS> hasNotified{};
+        while (collectedNotifiers < NUMBER_OF_NOTIFIER_THREADS)
+        {
+            for (auto index : m_waiter.wait())
+            {
+                ASSERT_THAT(index, Lt(NUMBER_OF_NOTIFIER_THREADS));
+                if (!hasNotified[index])
+                {
+                    hasNotified[index] = true;
+                    ++collectedNotifiers;
+                }
+            }
+        }
+        round.store(i + 1U);
+    }
+
+    for (auto& thread : notifierThreads)
+    {
+        thread.join();
+    }
+}
+
 } // namespace
@@ -0,0 +1,121 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_hoofs/testing/watch_dog.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/fast_path_gate.hpp"
+#include "test.hpp"
+
+#include <atomic>
+#include <thread>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::units::duration_literals;
+using iox::popo::FastPathGate;
+
+class FastPathGate_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        deadlockWatchdog.watchAndActOnFailure([] { std::terminate(); });
+    }
+
+    FastPathGate sut;
+    Watchdog deadlockWatchdog{5_s};
+};
+
+TEST_F(FastPathGate_test, NewGateIsClosed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a8e5c5fa-3754-4b1f-a9d0-5bdca6878246");
+    EXPECT_FALSE(sut.isOpen());
+    EXPECT_FALSE(sut.tryEnter());
+}
+
+TEST_F(FastPathGate_test, OpenGateCanBeEnteredAndLeft)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "58d519a7-5edb-4469-863e-a6231dbeba26");
+    sut.open();
+
+    EXPECT_TRUE(sut.tryEnter());
+    sut.leave();
+    EXPECT_TRUE(sut.tryEnter());
+    sut.leave();
+    EXPECT_TRUE(sut.isOpen());
+}
+
+TEST_F(FastPathGate_test, ClosedGateCannotBeEntered)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fbe2166b-9fd2-4de9-89a9-f8f5e23f36cb");
+    sut.open();
+    sut.close();
+
+    EXPECT_FALSE(sut.isOpen());
+    EXPECT_FALSE(sut.tryEnter());
+}
+
+TEST_F(FastPathGate_test, CloseWaitsUntilTheSenderHasLeft)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f6e65a49-9df5-4d6d-9756-d1d016e304c7");
+    std::atomic_bool isClosed{false};
+    sut.open();
+    ASSERT_TRUE(sut.tryEnter());
+
+    std::thread closer([&] {
+        sut.close();
+        isClosed = true;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_FALSE(isClosed.load());
+    sut.leave();
+    closer.join();
+
+    EXPECT_TRUE(isClosed.load());
+    EXPECT_FALSE(sut.tryEnter());
+}
+
+TEST_F(FastPathGate_test, CloseAbandonedDoesNotWaitForTheSenderInside)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1d4ffe91-0aa0-44df-8e57-10b1b224b4d6");
+    sut.open();
+    // a sender which terminated inside of the gate never leaves it
+    ASSERT_TRUE(sut.tryEnter());
+
+    sut.closeAbandoned();
+
+    EXPECT_FALSE(sut.isOpen());
+    EXPECT_FALSE(sut.tryEnter());
+    sut.close();
+    EXPECT_FALSE(sut.isOpen());
+}
+
+TEST_F(FastPathGate_test, AbandonedGateCanBeOpenedAgain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9b91aa5f-d133-4888-98d6-6128ee3811dd");
+    sut.open();
+    ASSERT_TRUE(sut.tryEnter());
+    sut.closeAbandoned();
+
+    sut.open();
+
+    EXPECT_TRUE(sut.tryEnter());
+    sut.leave();
+}
+
+} // namespace
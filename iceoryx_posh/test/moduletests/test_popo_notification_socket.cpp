@@ -0,0 +1,166 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/notification_socket.hpp"
+#include "test.hpp"
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+
+class NotificationSocket_test : public Test
+{
+  public:
+    static bool isReadable(const int32_t fileDescriptor, const int timeoutInMs = 0)
+    {
+        pollfd fd{fileDescriptor, POLLIN, 0};
+        return poll(&fd, 1U, timeoutInMs) == 1 && (fd.revents & POLLIN) != 0;
+    }
+
+    ConditionVariableData m_condVarData{"Ferdinand"};
+};
+
+TEST_F(NotificationSocket_test, CreateEnablesSocketNotificationOfConditionVariable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5f19b7ba-1497-4650-83f3-c957c9984f65");
+    auto sut = NotificationSocket::create(m_condVarData);
+
+    ASSERT_FALSE(sut.has_error());
+    EXPECT_THAT(sut->getFileDescriptor(), Ge(0));
+    EXPECT_TRUE(m_condVarData.m_isNotificationSocketEnabled.load());
+    EXPECT_FALSE(m_condVarData.m_notificationSocketPath.empty());
+    EXPECT_THAT(access(m_condVarData.m_notificationSocketPath.c_str(), F_OK), Eq(0));
+}
+
+TEST_F(NotificationSocket_test, CreateFailsWhenSocketNotificationIsAlreadyEnabled)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "52a0193a-1a30-43d8-a5bf-28700a19b4fc");
+    auto sut = NotificationSocket::create(m_condVarData);
+    ASSERT_FALSE(sut.has_error());
+
+    auto secondSut = NotificationSocket::create(m_condVarData);
+
+    ASSERT_TRUE(secondSut.has_error());
+    EXPECT_THAT(secondSut.get_error(), Eq(NotificationSocketError::ALREADY_ENABLED));
+}
+
+TEST_F(NotificationSocket_test, FileDescriptorIsNotReadableWithoutNotification)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5b6d58b9-5ebe-4c41-8e25-f3aee98e1179");
+    auto sut = NotificationSocket::create(m_condVarData);
+    ASSERT_FALSE(sut.has_error());
+
+    EXPECT_FALSE(isReadable(sut->getFileDescriptor()));
+}
+
+TEST_F(NotificationSocket_test, NotifyMakesFileDescriptorReadableUntilItIsDrained)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0fb682ca-d28c-4bf6-9e66-8067087c3a47");
+    auto sut = NotificationSocket::create(m_condVarData);
+    ASSERT_FALSE(sut.has_error());
+    ConditionNotifier notifier(m_condVarData, 0U);
+
+    notifier.notify();
+
+    EXPECT_TRUE(isReadable(sut->getFileDescriptor(), 1000));
+    sut->drain();
+    EXPECT_FALSE(isReadable(sut->getFileDescriptor()));
+}
+
+TEST_F(NotificationSocket_test, NotificationWhichIsPendingOnCreationMakesFileDescriptorReadable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "050584ae-03d1-4cf9-86a9-ce6b3a1c6112");
+    ConditionNotifier notifier(m_condVarData, 0U);
+    notifier.notify();
+
+    auto sut = NotificationSocket::create(m_condVarData);
+    ASSERT_FALSE(sut.has_error());
+
+    EXPECT_TRUE(isReadable(sut->getFileDescriptor(), 1000));
+}
+
+TEST_F(NotificationSocket_test, RearmMakesFileDescriptorReadableAgain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6014c7ac-1a98-43a2-86e7-e980c951b7ee");
+    auto sut = NotificationSocket::create(m_condVarData);
+    ASSERT_FALSE(sut.has_error());
+
+    sut->rearm();
+
+    EXPECT_TRUE(isReadable(sut->getFileDescriptor(), 1000));
+    sut->drain();
+    EXPECT_FALSE(isReadable(sut->getFileDescriptor()));
+}
+
+TEST_F(NotificationSocket_test, CoalescedNotificationsSignalTheSocketOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5b7bbe6c-7e92-4dfd-b86e-7f2bbbd31d0d");
+    auto sut = NotificationSocket::create(m_condVarData);
+    ASSERT_FALSE(sut.has_error());
+    ConditionNotifier notifier1(m_condVarData, 0U);
+    ConditionNotifier notifier2(m_condVarData, 1U);
+
+    notifier1.notify();
+    notifier2.notify();
+    notifier1.notify();
+
+    ASSERT_TRUE(isReadable(sut->getFileDescriptor(), 1000));
+    uint8_t buffer[16U];
+    EXPECT_THAT(recv(sut->getFileDescriptor(), &buffer[0], sizeof(buffer), MSG_DONTWAIT), Eq(1));
+    EXPECT_FALSE(isReadable(sut->getFileDescriptor()));
+}
+
+TEST_F(NotificationSocket_test, DestructionDisablesSocketNotificationAndRemovesSocket)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "54f7e220-d238-4185-8364-b1e5fe052b7b");
+    {
+        auto sut = NotificationSocket::create(m_condVarData);
+        ASSERT_FALSE(sut.has_error());
+    }
+
+    EXPECT_FALSE(m_condVarData.m_isNotificationSocketEnabled.load());
+    EXPECT_THAT(access(m_condVarData.m_notificationSocketPath.c_str(), F_OK), Ne(0));
+
+    ConditionNotifier notifier(m_condVarData, 0U);
+    notifier.notify();
+    EXPECT_FALSE(NotificationSocket::create(m_condVarData).has_error());
+}
+
+TEST_F(NotificationSocket_test, MoveTransfersOwnershipOfSocket)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "624e21ea-c25b-41bb-84f9-b6cd73934c11");
+    auto sut = NotificationSocket::create(m_condVarData);
+    ASSERT_FALSE(sut.has_error());
+    const auto fileDescriptor = sut->getFileDescriptor();
+
+    {
+        NotificationSocket movedSut(std::move(sut.value()));
+        EXPECT_THAT(movedSut.getFileDescriptor(), Eq(fileDescriptor));
+        EXPECT_TRUE(m_condVarData.m_isNotificationSocketEnabled.load());
+    }
+
+    EXPECT_FALSE(m_condVarData.m_isNotificationSocketEnabled.load());
+}
+
+} // namespace
@@ -32,6 +32,8 @@ TEST(PublisherOptions_test, SerializationRoundTripIsSuccessful)
     testOptions.nodeName = "hypnotoad";
     testOptions.offerOnCreate = false;
     testOptions.subscriberTooSlowPolicy = iox::popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    testOptions.reservedChunks = 13;
+    testOptions.maxChunksPerMemPool = 37;
 
     iox::popo::PublisherOptions::deserialize(testOptions.serialize())
         .and_then([&](auto& roundTripOptions) {
@@ -46,6 +48,12 @@ TEST(PublisherOptions_test, SerializationRoundTripIsSuccessful)
 
             EXPECT_THAT(roundTripOptions.subscriberTooSlowPolicy, Ne(defaultOptions.subscriberTooSlowPolicy));
             EXPECT_THAT(roundTripOptions.subscriberTooSlowPolicy, Eq(testOptions.subscriberTooSlowPolicy));
+
+            EXPECT_THAT(roundTripOptions.reservedChunks, Ne(defaultOptions.reservedChunks));
+            EXPECT_THAT(roundTripOptions.reservedChunks, Eq(testOptions.reservedChunks));
+
+            EXPECT_THAT(roundTripOptions.maxChunksPerMemPool, Ne(defaultOptions.maxChunksPerMemPool));
+            EXPECT_THAT(roundTripOptions.maxChunksPerMemPool, Eq(testOptions.maxChunksPerMemPool));
         })
         .or_else([&](auto&) { GTEST_FAIL() << "Serialization/Deserialization of PublisherOptions failed!"; });
 }
@@ -66,9 +74,15 @@ TEST(PublisherOptions_test, DeserializingInvalidSubscriberTooSlowPolicyFails)
     const iox::NodeName_t NODE_NAME{"harr-harr"};
     constexpr bool OFFER_ON_CREATE{true};
     constexpr std::underlying_type_t<iox::popo::ConsumerTooSlowPolicy> SUBSCRIBER_TOO_SLOW_POLICY{111};
+    constexpr uint32_t RESERVED_CHUNKS{0U};
+    constexpr uint32_t MAX_CHUNKS_PER_MEMPOOL{0U};
 
-    const auto serialized =
-        iox::cxx::Serialization::create(HISTORY_CAPACITY, NODE_NAME, OFFER_ON_CREATE, SUBSCRIBER_TOO_SLOW_POLICY);
+    const auto serialized = iox::cxx::Serialization::create(HISTORY_CAPACITY,
+                                                            NODE_NAME,
+                                                            OFFER_ON_CREATE,
+                                                            SUBSCRIBER_TOO_SLOW_POLICY,
+                                                            RESERVED_CHUNKS,
+                                                            MAX_CHUNKS_PER_MEMPOOL);
     iox::popo::PublisherOptions::deserialize(serialized)
         .and_then([&](auto&) { GTEST_FAIL() << "Deserialization is expected to fail!"; })
         .or_else([&](auto&) { GTEST_SUCCEED(); });
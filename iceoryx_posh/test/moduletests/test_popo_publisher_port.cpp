@@ -26,6 +26,7 @@
 #include "iceoryx_posh/internal/popo/ports/publisher_port_roudi.hpp"
 #include "iceoryx_posh/internal/popo/ports/publisher_port_user.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iceoryx_posh/popo/static_port_policy.hpp"
 #include "test.hpp"
 
 #include <memory>
@@ -580,4 +581,69 @@ TEST_F(PublisherPort_test, cleanupReleasesAllChunks)
     EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
 }
 
+TEST_F(PublisherPort_test, staticPublisherPortDeliversAChunkWhenSubscribed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b45688cb-79c4-4b20-ad86-ad81c1b7bf5d");
+    using PortPolicy = iox::popo::StaticPortPolicy<>;
+    iox::popo::StaticPublisherPortUser<PortPolicy> sut{&m_publisherPortDataNoOfferOnCreate};
+    sut.offer();
+    m_sutNoOfferOnCreateRouDiSide.tryGetCaProMessage();
+    ChunkQueueData_t m_chunkQueueData{iox::popo::QueueFullPolicy::DISCARD_OLDEST_DATA, PortPolicy::QUEUE_TYPE};
+    iox::capro::CaproMessage caproMessage(iox::capro::CaproMessageType::SUB,
+                                          iox::capro::ServiceDescription("a", "b", "c"));
+    caproMessage.m_chunkQueueData = &m_chunkQueueData;
+    caproMessage.m_historyCapacity = 0U;
+    m_sutNoOfferOnCreateRouDiSide.dispatchCaProMessageAndGetPossibleResponse(caproMessage);
+    auto maybeChunkHeader =
+        sut.tryAllocateChunk(sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    auto chunkHeader = maybeChunkHeader.value();
+    auto sample = chunkHeader->userPayload();
+    new (sample) DummySample();
+    static_cast<DummySample*>(sample)->dummy = 73;
+    sut.sendChunk(chunkHeader);
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> m_chunkQueuePopper(&m_chunkQueueData);
+
+    auto maybeSharedChunk = m_chunkQueuePopper.tryPop();
+
+    ASSERT_TRUE(maybeSharedChunk.has_value());
+    auto dummySample = *reinterpret_cast<DummySample*>(maybeSharedChunk.value().getUserPayload());
+    EXPECT_THAT(dummySample.dummy, Eq(73U));
+    EXPECT_TRUE(sut.tryGetPreviousChunk().has_value());
+}
+
+TEST_F(PublisherPort_test, staticPublisherPortStoresChunkInHistoryWhenNotOffered)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "49c91696-57d7-4254-8ab3-1377518f1559");
+    using PortPolicy = iox::popo::StaticPortPolicy<iox::popo::QueueFullPolicy::DISCARD_OLDEST_DATA,
+                                                   iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA,
+                                                   1U>;
+    iox::popo::PublisherPortData publisherPortData{iox::capro::ServiceDescription("x", "y", "z"),
+                                                   "myApp",
+                                                   &m_memoryManager,
+                                                   PortPolicy::apply(iox::popo::PublisherOptions())};
+    iox::popo::StaticPublisherPortUser<PortPolicy> sutUserSide{&publisherPortData};
+    iox::popo::PublisherPortRouDi sutRouDiSide{&publisherPortData};
+    auto maybeChunkHeader = sutUserSide.tryAllocateChunk(
+        sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    auto chunkHeader = maybeChunkHeader.value();
+    new (chunkHeader->userPayload()) DummySample();
+    static_cast<DummySample*>(chunkHeader->userPayload())->dummy = 37;
+    sutUserSide.sendChunk(chunkHeader);
+    sutUserSide.offer();
+    sutRouDiSide.tryGetCaProMessage();
+    ChunkQueueData_t m_chunkQueueData{iox::popo::QueueFullPolicy::DISCARD_OLDEST_DATA, PortPolicy::QUEUE_TYPE};
+    iox::capro::CaproMessage caproMessage(iox::capro::CaproMessageType::SUB,
+                                          iox::capro::ServiceDescription("x", "y", "z"));
+    caproMessage.m_chunkQueueData = &m_chunkQueueData;
+    caproMessage.m_historyCapacity = 1U;
+    sutRouDiSide.dispatchCaProMessageAndGetPossibleResponse(caproMessage);
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> m_chunkQueuePopper(&m_chunkQueueData);
+
+    auto maybeSharedChunk = m_chunkQueuePopper.tryPop();
+
+    ASSERT_TRUE(maybeSharedChunk.has_value());
+    auto dummySample = *reinterpret_cast<DummySample*>(maybeSharedChunk.value().getUserPayload());
+    EXPECT_THAT(dummySample.dummy, Eq(37U));
+}
+
 } // namespace
@@ -0,0 +1,90 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/popo/static_port_policy.hpp"
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+using iox::cxx::VariantQueueTypes;
+
+TEST(StaticPortPolicy_test, DefaultPolicyDiscardsOldestDataWithoutHistory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "21224c22-a533-44a0-9b42-5f3fb4fbef30");
+    using sut = StaticPortPolicy<>;
+    EXPECT_THAT(sut::QUEUE_FULL_POLICY, Eq(QueueFullPolicy::DISCARD_OLDEST_DATA));
+    EXPECT_THAT(sut::SUBSCRIBER_TOO_SLOW_POLICY, Eq(ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA));
+    EXPECT_THAT(sut::HISTORY_CAPACITY, Eq(0U));
+}
+
+TEST(StaticPortPolicy_test, QueueTypeIsTheSameAsTheOneRouDiUsesForTheQueueFullPolicy)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "affdd3c4-5d71-4ad8-98de-46e46c3324e1");
+    using DiscardingPolicy = StaticPortPolicy<QueueFullPolicy::DISCARD_OLDEST_DATA>;
+    using BlockingPolicy = StaticPortPolicy<QueueFullPolicy::BLOCK_PRODUCER>;
+    EXPECT_THAT(DiscardingPolicy::QUEUE_TYPE, Eq(subscriberQueueType(QueueFullPolicy::DISCARD_OLDEST_DATA)));
+    EXPECT_THAT(BlockingPolicy::QUEUE_TYPE, Eq(subscriberQueueType(QueueFullPolicy::BLOCK_PRODUCER)));
+}
+
+TEST(StaticPortPolicy_test, SubscriberQueueTypeDependsOnCommunicationPolicy)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "eb6a6916-f5d4-40e2-a89e-ec86c07d716a");
+    EXPECT_THAT(subscriberQueueType<iox::build::OneToManyPolicy>(QueueFullPolicy::DISCARD_OLDEST_DATA),
+                Eq(VariantQueueTypes::SoFi_SingleProducerSingleConsumer));
+    EXPECT_THAT(subscriberQueueType<iox::build::OneToManyPolicy>(QueueFullPolicy::BLOCK_PRODUCER),
+                Eq(VariantQueueTypes::FiFo_SingleProducerSingleConsumer));
+    EXPECT_THAT(subscriberQueueType<iox::build::ManyToManyPolicy>(QueueFullPolicy::DISCARD_OLDEST_DATA),
+                Eq(VariantQueueTypes::SoFi_MultiProducerSingleConsumer));
+    EXPECT_THAT(subscriberQueueType<iox::build::ManyToManyPolicy>(QueueFullPolicy::BLOCK_PRODUCER),
+                Eq(VariantQueueTypes::FiFo_MultiProducerSingleConsumer));
+}
+
+TEST(StaticPortPolicy_test, ApplyOverwritesPublisherOptionsOfThePolicyOnly)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7513db80-46d0-4214-b409-302a8dfbbd28");
+    using sut = StaticPortPolicy<QueueFullPolicy::BLOCK_PRODUCER, ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER, 3U>;
+    PublisherOptions options;
+    options.historyCapacity = 7U;
+    options.nodeName = "Pumuckl";
+    options.offerOnCreate = false;
+
+    auto appliedOptions = sut::apply(options);
+
+    EXPECT_THAT(appliedOptions.historyCapacity, Eq(3U));
+    EXPECT_THAT(appliedOptions.subscriberTooSlowPolicy, Eq(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER));
+    EXPECT_THAT(appliedOptions.nodeName, Eq(options.nodeName));
+    EXPECT_FALSE(appliedOptions.offerOnCreate);
+}
+
+TEST(StaticPortPolicy_test, ApplyOverwritesSubscriberOptionsOfThePolicyOnly)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2ed36497-aafb-4a6e-8ae8-56c1d7b7bf3f");
+    using sut = StaticPortPolicy<QueueFullPolicy::BLOCK_PRODUCER>;
+    SubscriberOptions options;
+    options.queueCapacity = 5U;
+    options.historyRequest = 2U;
+
+    auto appliedOptions = sut::apply(options);
+
+    EXPECT_THAT(appliedOptions.queueFullPolicy, Eq(QueueFullPolicy::BLOCK_PRODUCER));
+    EXPECT_THAT(appliedOptions.queueCapacity, Eq(5U));
+    EXPECT_THAT(appliedOptions.historyRequest, Eq(2U));
+}
+
+} // namespace
@@ -179,6 +179,40 @@ TEST_F(SubscriberTest, ReceivedSamplesAreAutomaticallyDeletedWhenOutOfScope)
     // ===== Cleanup ===== //
 }
 
+TEST_F(SubscriberTest, TakeWindowReturnsViewOfTheWindowUpdatedByBaseSubscriber)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7448faf7-c2c9-483d-8e68-aab69b8ec513");
+    // ===== Setup ===== //
+    const iox::popo::SubscriberPortData::ChunkWindow_t window(4U);
+    EXPECT_CALL(sut, updateWindow).WillOnce(ReturnRef(window));
+    // ===== Test ===== //
+    auto sampleWindow = sut.takeWindow();
+    // ===== Verify ===== //
+    ASSERT_TRUE(sampleWindow.has_value());
+    EXPECT_TRUE(sampleWindow->empty());
+    EXPECT_THAT(sampleWindow->size(), Eq(0U));
+    EXPECT_TRUE(sampleWindow->begin() == sampleWindow->end());
+    // ===== Cleanup ===== //
+}
+
+TEST_F(SubscriberTest, TakeWindowIsRejectedWhileThePreviousViewIsAlive)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6140b92b-d9c1-4987-bb67-ac91abdb3847");
+    // ===== Setup ===== //
+    const iox::popo::SubscriberPortData::ChunkWindow_t window(4U);
+    EXPECT_CALL(sut, updateWindow).Times(2).WillRepeatedly(ReturnRef(window));
+    // ===== Test ===== //
+    {
+        auto sampleWindow = sut.takeWindow();
+        ASSERT_TRUE(sampleWindow.has_value());
+        auto movedSampleWindow = std::move(sampleWindow.value());
+        // ===== Verify ===== //
+        EXPECT_FALSE(sut.takeWindow().has_value());
+    }
+    EXPECT_TRUE(sut.takeWindow().has_value());
+    // ===== Cleanup ===== //
+}
+
 TEST_F(SubscriberTest, ReleasesQueuedDataViaBaseSubscriber)
 {
     ::testing::Test::RecordProperty("TEST_ID", "f30fe1ae-046c-48b3-b5cd-b9adbf9b864f");
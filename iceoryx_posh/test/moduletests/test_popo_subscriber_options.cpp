@@ -34,6 +34,7 @@ TEST(SubscriberOptions_test, SerializationRoundTripIsSuccessful)
     testOptions.subscribeOnCreate = false;
     testOptions.queueFullPolicy = iox::popo::QueueFullPolicy::BLOCK_PRODUCER;
     testOptions.requiresPublisherHistorySupport = true;
+    testOptions.windowSize = 17U;
 
     iox::popo::SubscriberOptions::deserialize(testOptions.serialize())
         .and_then([&](auto& roundTripOptions) {
@@ -53,6 +54,9 @@ TEST(SubscriberOptions_test, SerializationRoundTripIsSuccessful)
             EXPECT_THAT(roundTripOptions.queueFullPolicy, Eq(testOptions.queueFullPolicy));
             EXPECT_THAT(roundTripOptions.requiresPublisherHistorySupport,
                         Eq(testOptions.requiresPublisherHistorySupport));
+
+            EXPECT_THAT(roundTripOptions.windowSize, Ne(defaultOptions.windowSize));
+            EXPECT_THAT(roundTripOptions.windowSize, Eq(testOptions.windowSize));
         })
         .or_else([&](auto&) { GTEST_FAIL() << "Serialization/Deserialization of SubscriberOptions failed!"; });
 }
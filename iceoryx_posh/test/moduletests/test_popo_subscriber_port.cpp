@@ -19,10 +19,12 @@
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_popper.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_multi_producer.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_single_producer.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_user.hpp"
+#include "iceoryx_posh/popo/sample_window.hpp"
 #include "iceoryx_posh/popo/subscriber_options.hpp"
 
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
@@ -544,4 +546,144 @@ TEST_F(SubscriberPortMultiProducer_test, InvalidMessageResultsInError)
     ASSERT_THAT(receivedError, Eq(iox::PoshError::POPO__CAPRO_PROTOCOL_ERROR));
 }
 
+class SubscriberPortWindow_test : public Test
+{
+  protected:
+    SubscriberPortWindow_test()
+    {
+        m_mempoolconf.addMemPool({CHUNK_SIZE, NUM_CHUNKS_IN_POOL});
+        m_memoryManager.configureMemoryManager(m_mempoolconf, m_memoryAllocator, m_memoryAllocator);
+    }
+
+    static iox::popo::SubscriberOptions windowOptions(const uint64_t windowSize)
+    {
+        iox::popo::SubscriberOptions options;
+        options.windowSize = windowSize;
+        return options;
+    }
+
+    void pushChunksToQueue(const uint64_t firstValue, const uint64_t numberOfChunks)
+    {
+        auto chunkSettingsResult = iox::mepoo::ChunkSettings::create(sizeof(uint64_t), alignof(uint64_t));
+        ASSERT_FALSE(chunkSettingsResult.has_error());
+        for (uint64_t value = firstValue; value < firstValue + numberOfChunks; ++value)
+        {
+            auto getChunkResult = m_memoryManager.getChunk(chunkSettingsResult.value());
+            ASSERT_FALSE(getChunkResult.has_error());
+            *static_cast<uint64_t*>(getChunkResult.value().getUserPayload()) = value;
+            m_chunkQueuePusher.push(getChunkResult.value());
+        }
+    }
+
+    uint32_t usedChunks()
+    {
+        return m_memoryManager.getMemPoolInfo(0U).m_usedChunks;
+    }
+
+    static constexpr uint64_t WINDOW_SIZE{3U};
+    static constexpr size_t MEGABYTE = 1U << 20U;
+    static constexpr size_t MEMORY_SIZE = 4U * MEGABYTE;
+    static constexpr uint32_t NUM_CHUNKS_IN_POOL{20U};
+    static constexpr uint32_t CHUNK_SIZE{128U};
+
+    std::unique_ptr<char[]> m_memory{new char[MEMORY_SIZE]};
+    iox::posix::Allocator m_memoryAllocator{m_memory.get(), MEMORY_SIZE};
+    iox::mepoo::MePooConfig m_mempoolconf;
+    iox::mepoo::MemoryManager m_memoryManager;
+
+    iox::popo::SubscriberPortData m_subscriberPortData{
+        SubscriberPortSingleProducer_test::TEST_SERVICE_DESCRIPTION,
+        "myApp",
+        iox::cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer,
+        windowOptions(WINDOW_SIZE)};
+    iox::popo::SubscriberPortUser m_sutUserSide{&m_subscriberPortData};
+    iox::popo::SubscriberPortSingleProducer m_sutRouDiSide{&m_subscriberPortData};
+    iox::popo::ChunkQueuePusher<iox::popo::SubscriberPortData::ChunkQueueData_t> m_chunkQueuePusher{
+        &m_subscriberPortData.m_chunkReceiverData};
+};
+
+TEST_F(SubscriberPortWindow_test, UpdateWindowMovesTheQueuedChunksIntoTheWindow)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f9c90d11-7c8e-42f5-bb80-9242c70cce3b");
+    pushChunksToQueue(0U, WINDOW_SIZE - 1U);
+
+    EXPECT_THAT(m_sutUserSide.updateWindow(), Eq(WINDOW_SIZE - 1U));
+
+    EXPECT_FALSE(m_sutUserSide.hasNewChunks());
+    EXPECT_THAT(m_sutUserSide.getWindow().size(), Eq(WINDOW_SIZE - 1U));
+    EXPECT_THAT(usedChunks(), Eq(WINDOW_SIZE - 1U));
+}
+
+TEST_F(SubscriberPortWindow_test, WindowContainsTheLatestChunksFromTheOldestToTheLatest)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9b9190e2-212e-4e3a-903b-b6845e4c2e68");
+    constexpr uint64_t NUMBER_OF_CHUNKS{WINDOW_SIZE + 4U};
+    pushChunksToQueue(0U, 2U);
+    m_sutUserSide.updateWindow();
+    pushChunksToQueue(2U, NUMBER_OF_CHUNKS - 2U);
+    m_sutUserSide.updateWindow();
+
+    bool isWindowInUse{false};
+    iox::popo::SampleWindow<uint64_t> sampleWindow(m_sutUserSide.getWindow(), isWindowInUse);
+
+    ASSERT_THAT(sampleWindow.size(), Eq(WINDOW_SIZE));
+    EXPECT_THAT(sampleWindow.front(), Eq(NUMBER_OF_CHUNKS - WINDOW_SIZE));
+    EXPECT_THAT(sampleWindow.back(), Eq(NUMBER_OF_CHUNKS - 1U));
+    uint64_t expectedValue{NUMBER_OF_CHUNKS - WINDOW_SIZE};
+    for (const auto& value : sampleWindow)
+    {
+        EXPECT_THAT(value, Eq(expectedValue));
+        ++expectedValue;
+    }
+    EXPECT_THAT(usedChunks(), Eq(WINDOW_SIZE));
+}
+
+TEST_F(SubscriberPortWindow_test, UpdateWindowKeepsTheChunksInTheQueueWhenTheWindowIsDisabled)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6c688571-e7d4-4063-b40a-9ae4fea3dee2");
+    iox::popo::SubscriberPortData subscriberPortData{SubscriberPortSingleProducer_test::TEST_SERVICE_DESCRIPTION,
+                                                     "myApp",
+                                                     iox::cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer,
+                                                     windowOptions(0U)};
+    iox::popo::SubscriberPortUser sut{&subscriberPortData};
+    iox::popo::ChunkQueuePusher<iox::popo::SubscriberPortData::ChunkQueueData_t> chunkQueuePusher{
+        &subscriberPortData.m_chunkReceiverData};
+    auto chunkSettingsResult = iox::mepoo::ChunkSettings::create(sizeof(uint64_t), alignof(uint64_t));
+    ASSERT_FALSE(chunkSettingsResult.has_error());
+    auto getChunkResult = m_memoryManager.getChunk(chunkSettingsResult.value());
+    ASSERT_FALSE(getChunkResult.has_error());
+    chunkQueuePusher.push(getChunkResult.value());
+
+    EXPECT_THAT(sut.updateWindow(), Eq(0U));
+
+    EXPECT_TRUE(sut.hasNewChunks());
+    EXPECT_THAT(sut.getWindow().size(), Eq(0U));
+    sut.releaseQueuedChunks();
+}
+
+TEST_F(SubscriberPortWindow_test, ReleaseWindowReleasesTheChunksOfTheWindow)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3863c4e9-caea-4331-a470-f8c9598a7b41");
+    pushChunksToQueue(0U, WINDOW_SIZE);
+    m_sutUserSide.updateWindow();
+
+    m_sutUserSide.releaseWindow();
+
+    EXPECT_THAT(m_sutUserSide.getWindow().size(), Eq(0U));
+    EXPECT_THAT(usedChunks(), Eq(0U));
+}
+
+TEST_F(SubscriberPortWindow_test, ReleaseAllChunksOfRouDiSideReleasesTheChunksOfTheWindow)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9006d9f6-2ee6-4d4e-9cb6-6914a5d5e4d4");
+    pushChunksToQueue(0U, WINDOW_SIZE);
+    m_sutUserSide.updateWindow();
+    pushChunksToQueue(WINDOW_SIZE, 1U);
+
+    m_sutRouDiSide.releaseAllChunks();
+
+    EXPECT_THAT(m_sutUserSide.getWindow().size(), Eq(0U));
+    EXPECT_THAT(usedChunks(), Eq(0U));
+}
+
 } // namespace
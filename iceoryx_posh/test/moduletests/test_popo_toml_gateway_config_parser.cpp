@@ -399,6 +399,125 @@ TEST_F(TomlGatewayConfigParserSuiteTest,
     EXPECT_EQ(result.get_error(), MAXIMUM_NUMBER_OF_ENTRIES_EXCEEDED);
 }
 
+TEST_F(TomlGatewayConfigParserSuiteTest, ParseServiceWithCodecReturnsTheCodec)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2fae005f-b48a-411c-8d9e-9eb04986ddc4");
+    auto toml = cpptoml::make_table();
+    auto serviceArray = cpptoml::make_table_array();
+
+    constexpr uint8_t NUMBER_OF_CODECS{static_cast<uint8_t>(iox::gw::CodecType::XOR_DELTA_LZ) + 1U};
+    for (uint8_t i = 0U; i < NUMBER_OF_CODECS; ++i)
+    {
+        auto serviceEntry = cpptoml::make_table();
+        std::string stringentry = "service" + std::to_string(i);
+        serviceEntry->insert("service", stringentry);
+        serviceEntry->insert("instance", stringentry);
+        serviceEntry->insert("event", stringentry);
+        serviceEntry->insert("codec", std::string(iox::gw::CODEC_TYPE_STRINGS[i]));
+        serviceArray->push_back(serviceEntry);
+    }
+
+    toml->insert("services", serviceArray);
+    CreateTmpTomlFile(toml);
+
+    auto result = TomlGatewayConfigParser::parse(m_configFilePath);
+
+    ASSERT_FALSE(result.has_error());
+    ASSERT_EQ(result.value().m_configuredServices.size(), NUMBER_OF_CODECS);
+    for (uint8_t i = 0U; i < NUMBER_OF_CODECS; ++i)
+    {
+        EXPECT_EQ(result.value().m_configuredServices[i].m_codec, static_cast<iox::gw::CodecType>(i));
+    }
+}
+
+TEST_F(TomlGatewayConfigParserSuiteTest, ParseServiceWithoutCodecReturnsNoCodec)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9e729914-7210-4e22-9220-bbfaca4c2f70");
+    auto toml = cpptoml::make_table();
+    auto serviceArray = cpptoml::make_table_array();
+    auto serviceEntry = cpptoml::make_table();
+    serviceEntry->insert("service", "service");
+    serviceEntry->insert("instance", "instance");
+    serviceEntry->insert("event", "event");
+    serviceArray->push_back(serviceEntry);
+
+    toml->insert("services", serviceArray);
+    CreateTmpTomlFile(toml);
+
+    auto result = TomlGatewayConfigParser::parse(m_configFilePath);
+
+    ASSERT_FALSE(result.has_error());
+    ASSERT_EQ(result.value().m_configuredServices.size(), 1U);
+    EXPECT_EQ(result.value().m_configuredServices[0].m_codec, iox::gw::CodecType::NONE);
+    EXPECT_EQ(result.value().m_configuredServices[0].m_codecMaxPayloadSize,
+              iox::gw::ChannelCodec::DEFAULT_MAX_PAYLOAD_SIZE);
+}
+
+TEST_F(TomlGatewayConfigParserSuiteTest, ParseServiceWithCodecMaxPayloadSizeReturnsTheMaxPayloadSize)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d405f703-7ee7-4eea-9de8-b9bb81990f05");
+    constexpr int64_t MAX_PAYLOAD_SIZE{4096};
+    auto toml = cpptoml::make_table();
+    auto serviceArray = cpptoml::make_table_array();
+    auto serviceEntry = cpptoml::make_table();
+    serviceEntry->insert("service", "service");
+    serviceEntry->insert("instance", "instance");
+    serviceEntry->insert("event", "event");
+    serviceEntry->insert("codec", "xor-delta");
+    serviceEntry->insert("codec-max-payload-size", MAX_PAYLOAD_SIZE);
+    serviceArray->push_back(serviceEntry);
+
+    toml->insert("services", serviceArray);
+    CreateTmpTomlFile(toml);
+
+    auto result = TomlGatewayConfigParser::parse(m_configFilePath);
+
+    ASSERT_FALSE(result.has_error());
+    ASSERT_EQ(result.value().m_configuredServices.size(), 1U);
+    EXPECT_EQ(result.value().m_configuredServices[0].m_codecMaxPayloadSize, MAX_PAYLOAD_SIZE);
+}
+
+TEST_F(TomlGatewayConfigParserSuiteTest, InvalidCodecMaxPayloadSizeReturnInvalidCodecError)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e18a5a9f-0da3-402c-af84-c120379529c2");
+    for (const int64_t maxPayloadSize : {int64_t{0}, int64_t{-1}, int64_t{1} << 32U})
+    {
+        auto toml = cpptoml::make_table();
+        auto serviceArray = cpptoml::make_table_array();
+        auto serviceEntry = cpptoml::make_table();
+        serviceEntry->insert("service", "service");
+        serviceEntry->insert("instance", "instance");
+        serviceEntry->insert("event", "event");
+        serviceEntry->insert("codec-max-payload-size", maxPayloadSize);
+        serviceArray->push_back(serviceEntry);
+        toml->insert("services", serviceArray);
+
+        auto result = StubbedTomlGatewayConfigParser::validate(*toml);
+
+        ASSERT_TRUE(result.has_error()) << maxPayloadSize;
+        EXPECT_EQ(TomlGatewayConfigParseError::INVALID_CODEC, result.get_error());
+    }
+}
+
+TEST_F(TomlGatewayConfigParserSuiteTest, UnknownCodecReturnInvalidCodecError)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cd481e8e-7092-4130-8e1d-c1092c6251cf");
+    auto toml = cpptoml::make_table();
+    auto serviceArray = cpptoml::make_table_array();
+    auto serviceEntry = cpptoml::make_table();
+    serviceEntry->insert("service", "service");
+    serviceEntry->insert("instance", "instance");
+    serviceEntry->insert("event", "event");
+    serviceEntry->insert("codec", "zip");
+    serviceArray->push_back(serviceEntry);
+    toml->insert("services", serviceArray);
+
+    auto result = StubbedTomlGatewayConfigParser::validate(*toml);
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_EQ(TomlGatewayConfigParseError::INVALID_CODEC, result.get_error());
+}
+
 INSTANTIATE_TEST_SUITE_P(
     ParseAllMalformedInputConfigFiles,
     TomlGatewayConfigParserTest,
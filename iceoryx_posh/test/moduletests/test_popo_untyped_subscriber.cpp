@@ -160,6 +160,37 @@ TEST_F(UntypedSubscriberTest, TakeReturnsAllocatedMemoryChunk)
     sut.release(maybeChunk.value());
 }
 
+TEST_F(UntypedSubscriberTest, TakeWindowReturnsViewOfTheWindowUpdatedByBaseSubscriber)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f892ac6d-47d6-427c-82c6-db1b86bacbfb");
+    // ===== Setup ===== //
+    const iox::popo::SubscriberPortData::ChunkWindow_t window(4U);
+    EXPECT_CALL(sut, updateWindow).WillOnce(ReturnRef(window));
+    // ===== Test ===== //
+    auto sampleWindow = sut.takeWindow();
+    // ===== Verify ===== //
+    ASSERT_TRUE(sampleWindow.has_value());
+    EXPECT_TRUE(sampleWindow->empty());
+    // ===== Cleanup ===== //
+}
+
+TEST_F(UntypedSubscriberTest, TakeWindowIsRejectedWhileThePreviousViewIsAlive)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3320c224-81f8-471e-92c9-190d9cad4bcd");
+    // ===== Setup ===== //
+    const iox::popo::SubscriberPortData::ChunkWindow_t window(4U);
+    EXPECT_CALL(sut, updateWindow).Times(2).WillRepeatedly(ReturnRef(window));
+    // ===== Test ===== //
+    {
+        auto sampleWindow = sut.takeWindow();
+        ASSERT_TRUE(sampleWindow.has_value());
+        // ===== Verify ===== //
+        EXPECT_FALSE(sut.takeWindow().has_value());
+    }
+    EXPECT_TRUE(sut.takeWindow().has_value());
+    // ===== Cleanup ===== //
+}
+
 TEST_F(UntypedSubscriberTest, ReleasesQueuedDataViaBaseSubscriber)
 {
     ::testing::Test::RecordProperty("TEST_ID", "66c0fb02-aa6d-48dd-8439-754e05cd29af");
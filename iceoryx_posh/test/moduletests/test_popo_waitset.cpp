@@ -27,6 +27,7 @@
 
 #include <chrono>
 #include <memory>
+#include <poll.h>
 #include <thread>
 
 namespace
@@ -1044,6 +1045,40 @@ TEST_F(WaitSet_test, TimedWaitReturnsAllTriggeredConditionWhenAllAreTriggered)
     WaitReturnsAllTriggeredConditionWhenAllAreTriggered(this, [&] { return m_sut->timedWait(10_ms); });
 }
 
+TEST_F(WaitSet_test, WaitAndVisitVisitsAllTriggeredConditionsWhenMultipleAreTriggered)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2fe055f1-ceb6-4837-889e-3de60d5fb360");
+    WaitReturnsAllTriggeredConditionWhenMultipleAreTriggered(this, [&] {
+        WaitSet<>::NotificationInfoVector triggerVector;
+        const auto numberOfTriggers = m_sut->waitAndVisit(
+            [&](const NotificationInfo& notificationInfo) { triggerVector.push_back(&notificationInfo); });
+        EXPECT_THAT(numberOfTriggers, Eq(triggerVector.size()));
+        return triggerVector;
+    });
+}
+
+TEST_F(WaitSet_test, TimedWaitAndVisitVisitsAllTriggeredConditionsWhenAllAreTriggered)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4e716b6e-0a31-480c-a809-8b7085e9ff2b");
+    WaitReturnsAllTriggeredConditionWhenAllAreTriggered(this, [&] {
+        WaitSet<>::NotificationInfoVector triggerVector;
+        const auto numberOfTriggers = m_sut->timedWaitAndVisit(
+            10_ms, [&](const NotificationInfo& notificationInfo) { triggerVector.push_back(&notificationInfo); });
+        EXPECT_THAT(numberOfTriggers, Eq(triggerVector.size()));
+        return triggerVector;
+    });
+}
+
+TEST_F(WaitSet_test, TimedWaitAndVisitVisitsNothingWhenNothingTriggered)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a4706c2e-ff95-4ee5-af74-b8a2dddcd786");
+    ASSERT_FALSE(m_sut->attachEvent(m_simpleEvents[0U], 5U).has_error());
+
+    uint64_t numberOfVisits{0U};
+    EXPECT_THAT(m_sut->timedWaitAndVisit(10_ms, [&](const NotificationInfo&) { ++numberOfVisits; }), Eq(0U));
+    EXPECT_THAT(numberOfVisits, Eq(0U));
+}
+
 void WaitReturnsEventTriggersWithOneCorrectCallback(WaitSet_test* test,
                                                     const std::function<WaitSet<>::NotificationInfoVector()>& waitCall)
 {
@@ -1532,4 +1567,73 @@ TEST_F(WaitSet_test, TimedWaitUnblocksAfterMarkForDestructionCall)
     t.join();
 }
 
+TEST_F(WaitSet_test, GetFileDescriptorReturnsTheSameDescriptorOnEveryCall)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "14df7e2c-640c-40be-9042-44ce8c959083");
+    auto fileDescriptor = m_sut->getFileDescriptor();
+    ASSERT_FALSE(fileDescriptor.has_error());
+
+    auto secondFileDescriptor = m_sut->getFileDescriptor();
+    ASSERT_FALSE(secondFileDescriptor.has_error());
+    EXPECT_THAT(secondFileDescriptor.value(), Eq(fileDescriptor.value()));
+    EXPECT_TRUE(m_condVarData.m_isNotificationSocketEnabled.load());
+}
+
+TEST_F(WaitSet_test, FileDescriptorBecomesReadableWhenEventIsTriggeredAndIsDrainedByTimedWait)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "15169f50-1d93-4e29-8ee8-d910fe0e2872");
+    ASSERT_FALSE(m_sut->attachEvent(m_simpleEvents[0U], 0U).has_error());
+    auto fileDescriptor = m_sut->getFileDescriptor();
+    ASSERT_FALSE(fileDescriptor.has_error());
+    pollfd fd{fileDescriptor.value(), POLLIN, 0};
+
+    EXPECT_THAT(poll(&fd, 1U, 0), Eq(0));
+
+    m_simpleEvents[0U].trigger();
+    ASSERT_THAT(poll(&fd, 1U, 1000), Eq(1));
+
+    auto triggerVector = m_sut->timedWait(0_ms);
+    ASSERT_THAT(triggerVector.size(), Eq(1U));
+    EXPECT_TRUE(doesNotificationInfoVectorContain(triggerVector, 0U, m_simpleEvents[0U]));
+    EXPECT_THAT(poll(&fd, 1U, 0), Eq(0));
+}
+
+TEST_F(WaitSet_test, FileDescriptorIsReadableWhenEventWasTriggeredBeforeItWasCreated)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2606bf85-f265-40ea-91a1-c9fbeee41a0d");
+    ASSERT_FALSE(m_sut->attachEvent(m_simpleEvents[0U], 0U).has_error());
+    m_simpleEvents[0U].trigger();
+
+    auto fileDescriptor = m_sut->getFileDescriptor();
+    ASSERT_FALSE(fileDescriptor.has_error());
+    pollfd fd{fileDescriptor.value(), POLLIN, 0};
+
+    ASSERT_THAT(poll(&fd, 1U, 1000), Eq(1));
+    auto triggerVector = m_sut->timedWait(0_ms);
+    ASSERT_THAT(triggerVector.size(), Eq(1U));
+    EXPECT_TRUE(doesNotificationInfoVectorContain(triggerVector, 0U, m_simpleEvents[0U]));
+}
+
+TEST_F(WaitSet_test, FileDescriptorStaysReadableWhileStateBasedTriggerIsSatisfied)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "857304a4-ca2a-45d3-8638-d73126bd0cb9");
+    m_simpleEvents[0U].m_autoResetTrigger = false;
+    ASSERT_FALSE(m_sut->attachState(m_simpleEvents[0U], 0U).has_error());
+    auto fileDescriptor = m_sut->getFileDescriptor();
+    ASSERT_FALSE(fileDescriptor.has_error());
+    pollfd fd{fileDescriptor.value(), POLLIN, 0};
+
+    m_simpleEvents[0U].trigger();
+    ASSERT_THAT(poll(&fd, 1U, 1000), Eq(1));
+    EXPECT_THAT(m_sut->timedWait(0_ms).size(), Eq(1U));
+
+    ASSERT_THAT(poll(&fd, 1U, 1000), Eq(1));
+    EXPECT_THAT(m_sut->timedWait(0_ms).size(), Eq(1U));
+
+    m_simpleEvents[0U].resetTrigger();
+    ASSERT_THAT(poll(&fd, 1U, 1000), Eq(1));
+    EXPECT_THAT(m_sut->timedWait(0_ms).size(), Eq(0U));
+    EXPECT_THAT(poll(&fd, 1U, 0), Eq(0));
+}
+
 } // namespace
@@ -0,0 +1,185 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/unique_port_id.hpp"
+#include "iceoryx_posh/internal/roudi/chunk_reclaimer.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::roudi;
+using iox::popo::UniquePortId;
+
+class ChunkReclaimer_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        m_rawMemory = malloc(RAW_MEMORY_SIZE);
+        m_allocator.emplace(m_rawMemory, RAW_MEMORY_SIZE);
+        iox::mepoo::MePooConfig mempoolconf;
+        mempoolconf.addMemPool({CHUNK_SIZE, NUMBER_OF_CHUNKS});
+        m_memoryManager.configureMemoryManager(mempoolconf, *m_allocator, *m_allocator);
+        m_memoryManagers.emplace_back(&m_memoryManager);
+    }
+
+    void TearDown() override
+    {
+        free(m_rawMemory);
+    }
+
+    /// @brief acquires a chunk for the owner and drops the reference of the owner like a terminated process would do
+    void loseChunk(const UniquePortId& owner)
+    {
+        auto chunkSettings =
+            iox::mepoo::ChunkSettings::create(CHUNK_SIZE / 2U, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+        ASSERT_FALSE(chunkSettings.has_error());
+        auto chunk = m_memoryManager.getChunk(chunkSettings.value());
+        ASSERT_FALSE(chunk.has_error());
+        chunk.value().setOwner(owner);
+        static_cast<void>(chunk.value().release());
+    }
+
+    uint64_t usedChunks()
+    {
+        return m_memoryManager.getMemPoolInfo(0U).m_usedChunks;
+    }
+
+    static constexpr uint64_t RAW_MEMORY_SIZE{1000000U};
+    static constexpr uint32_t CHUNK_SIZE{128U};
+    static constexpr uint32_t NUMBER_OF_CHUNKS{10U};
+
+    void* m_rawMemory{nullptr};
+    iox::cxx::optional<iox::posix::Allocator> m_allocator;
+    iox::mepoo::MemoryManager m_memoryManager;
+    ChunkReclaimer::MemoryManagerList_t m_memoryManagers;
+};
+
+TEST_F(ChunkReclaimer_test, NoSweepIsPendingWithoutLostOwners)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c1cb03ef-7b67-4d13-a2d9-7f025bd1d962");
+    ChunkReclaimer sut;
+
+    EXPECT_FALSE(sut.isSweepPending());
+    EXPECT_THAT(sut.sweepStep(m_memoryManagers), Eq(0U));
+    EXPECT_THAT(sut.getNumberOfSweeps(), Eq(0U));
+}
+
+TEST_F(ChunkReclaimer_test, AddingAnInvalidOwnerFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fdd45a24-332e-4566-aa68-daddba2db46c");
+    ChunkReclaimer sut;
+
+    EXPECT_FALSE(sut.addLostOwner(UniquePortId(iox::popo::InvalidPortId)));
+    EXPECT_FALSE(sut.isSweepPending());
+}
+
+TEST_F(ChunkReclaimer_test, SweepReclaimsTheChunksOfALostOwner)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "01716411-be4a-4833-ba74-c31b9b2c4710");
+    ChunkReclaimer sut;
+    const UniquePortId lostOwner;
+    loseChunk(lostOwner);
+    loseChunk(lostOwner);
+    ASSERT_THAT(usedChunks(), Eq(2U));
+
+    ASSERT_TRUE(sut.addLostOwner(lostOwner));
+    EXPECT_TRUE(sut.isSweepPending());
+    EXPECT_THAT(sut.sweepStep(m_memoryManagers), Eq(2U));
+
+    EXPECT_FALSE(sut.isSweepPending());
+    EXPECT_THAT(usedChunks(), Eq(0U));
+    EXPECT_THAT(sut.getNumberOfReclaimedChunks(), Eq(2U));
+    EXPECT_THAT(sut.getNumberOfSweeps(), Eq(1U));
+}
+
+TEST_F(ChunkReclaimer_test, SweepIsSplitIntoStepsWithTheConfiguredNumberOfChunkManagements)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7aea6bb7-1baf-4da3-9ac7-ffd01329dab5");
+    constexpr uint64_t CHUNK_MANAGEMENTS_PER_SWEEP_STEP{3U};
+    ChunkReclaimer sut(CHUNK_MANAGEMENTS_PER_SWEEP_STEP);
+    const UniquePortId lostOwner;
+    loseChunk(lostOwner);
+    const auto numberOfChunkManagements = m_memoryManager.getNumberOfChunkManagements();
+    const auto expectedNumberOfSweepSteps =
+        (numberOfChunkManagements + CHUNK_MANAGEMENTS_PER_SWEEP_STEP - 1U) / CHUNK_MANAGEMENTS_PER_SWEEP_STEP;
+
+    ASSERT_TRUE(sut.addLostOwner(lostOwner));
+    uint64_t numberOfSweepSteps{0U};
+    while (sut.isSweepPending() && numberOfSweepSteps <= expectedNumberOfSweepSteps)
+    {
+        sut.sweepStep(m_memoryManagers);
+        ++numberOfSweepSteps;
+    }
+
+    EXPECT_THAT(numberOfSweepSteps, Eq(expectedNumberOfSweepSteps));
+    EXPECT_THAT(usedChunks(), Eq(0U));
+    EXPECT_THAT(sut.getNumberOfReclaimedChunks(), Eq(1U));
+    EXPECT_THAT(sut.getNumberOfSweeps(), Eq(1U));
+}
+
+TEST_F(ChunkReclaimer_test, OwnerWhichIsAddedDuringASweepIsHandledByTheNextSweep)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "23eba9bf-52ab-4f90-aa28-3ec879b26a55");
+    ChunkReclaimer sut(1U);
+    const UniquePortId firstLostOwner;
+    const UniquePortId secondLostOwner;
+    loseChunk(firstLostOwner);
+    loseChunk(secondLostOwner);
+
+    ASSERT_TRUE(sut.addLostOwner(firstLostOwner));
+    sut.sweepStep(m_memoryManagers);
+    ASSERT_TRUE(sut.addLostOwner(secondLostOwner));
+    while (sut.getNumberOfSweeps() == 0U)
+    {
+        sut.sweepStep(m_memoryManagers);
+    }
+
+    EXPECT_THAT(usedChunks(), Eq(1U));
+    EXPECT_TRUE(sut.isSweepPending());
+
+    while (sut.isSweepPending())
+    {
+        sut.sweepStep(m_memoryManagers);
+    }
+
+    EXPECT_THAT(usedChunks(), Eq(0U));
+    EXPECT_THAT(sut.getNumberOfReclaimedChunks(), Eq(2U));
+    EXPECT_THAT(sut.getNumberOfSweeps(), Eq(2U));
+}
+
+TEST_F(ChunkReclaimer_test, SweepKeepsTheChunksOfOtherOwners)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "847f2ca2-7ffe-41e2-ae11-117cae87297e");
+    ChunkReclaimer sut;
+    const UniquePortId lostOwner;
+    const UniquePortId runningOwner;
+    loseChunk(runningOwner);
+
+    ASSERT_TRUE(sut.addLostOwner(lostOwner));
+    EXPECT_THAT(sut.sweepStep(m_memoryManagers), Eq(0U));
+
+    EXPECT_THAT(usedChunks(), Eq(1U));
+    EXPECT_THAT(sut.getNumberOfSweeps(), Eq(1U));
+}
+
+} // namespace
@@ -37,7 +37,8 @@ bool operator==(const CmdLineArgs_t& lhs, const CmdLineArgs_t& rhs)
     return (lhs.monitoringMode == rhs.monitoringMode) && (lhs.logLevel == rhs.logLevel)
            && (lhs.compatibilityCheckLevel == rhs.compatibilityCheckLevel)
            && (lhs.processKillDelay == rhs.processKillDelay) && (lhs.uniqueRouDiId == rhs.uniqueRouDiId)
-           && (lhs.run == rhs.run) && (lhs.configFilePath == rhs.configFilePath);
+           && (lhs.run == rhs.run) && (lhs.configFilePath == rhs.configFilePath)
+           && (lhs.mempoolProfilePath == rhs.mempoolProfilePath);
 }
 } // namespace config
 } // namespace iox
@@ -346,6 +347,46 @@ TEST_F(CmdLineParser_test, KillDelayOptionOutOfBoundsLeadsToProgrammNotRunning)
     EXPECT_FALSE(result.value().run);
 }
 
+TEST_F(CmdLineParser_test, MempoolProfileLongOptionLeadsToCorrectPath)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d8512a4e-9cdf-457f-ace5-5f5babf3ede9");
+    constexpr uint8_t NUMBER_OF_ARGS{3U};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char option[] = "--mempool-profile";
+    char value[] = "/tmp/mempool.profile";
+    args[0] = &appName[0];
+    args[1] = &option[0];
+    args[2] = &value[0];
+
+    CmdLineParser sut;
+    auto result = sut.parse(NUMBER_OF_ARGS, args);
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_EQ(result.value().mempoolProfilePath, ConfigFilePathString_t("/tmp/mempool.profile"));
+    EXPECT_TRUE(result.value().run);
+}
+
+TEST_F(CmdLineParser_test, MempoolProfileShortOptionLeadsToCorrectPath)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5df08861-d9ee-4302-94fd-1e422316b5bc");
+    constexpr uint8_t NUMBER_OF_ARGS{3U};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char option[] = "-p";
+    char value[] = "profile.txt";
+    args[0] = &appName[0];
+    args[1] = &option[0];
+    args[2] = &value[0];
+
+    CmdLineParser sut;
+    auto result = sut.parse(NUMBER_OF_ARGS, args);
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_EQ(result.value().mempoolProfilePath, ConfigFilePathString_t("profile.txt"));
+    EXPECT_TRUE(result.value().run);
+}
+
 TEST_F(CmdLineParser_test, CompatibilityLevelOptionsLeadToCorrectCompatibilityLevel)
 {
     ::testing::Test::RecordProperty("TEST_ID", "62b7d5c9-0638-4314-b4f7-c622ef101045");
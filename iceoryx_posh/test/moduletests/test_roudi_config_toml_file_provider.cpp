@@ -55,6 +55,27 @@ TEST_F(RoudiConfigTomlFileProvider_test, ParseDefaultConfigIsSuccessful)
     EXPECT_FALSE(result.has_error());
 }
 
+TEST_F(RoudiConfigTomlFileProvider_test, ParseNumaPlacementIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9326dfe4-e394-4fb9-9406-ae77e8cbc02d");
+    m_cmdLineArgs.configFilePath.append(iox::cxx::TruncateToCapacity, "roudi_config_numa_placement.toml");
+
+    iox::config::TomlRouDiConfigFileProvider sut(m_cmdLineArgs);
+
+    auto result = sut.parse();
+
+    ASSERT_FALSE(result.has_error());
+    const auto& config = result.value();
+    EXPECT_THAT(config.m_managementNumaPlacement, Eq(iox::mepoo::NumaPlacement::onNode(1U)));
+    ASSERT_THAT(config.m_sharedMemorySegments.size(), Eq(1U));
+    const auto& segment = config.m_sharedMemorySegments.front();
+    EXPECT_THAT(segment.m_numaPlacement.m_policy, Eq(iox::mepoo::NumaPolicy::INTERLEAVE));
+    EXPECT_THAT(segment.m_numaPlacement.m_nodeMask, Eq(3U));
+    ASSERT_THAT(segment.m_mempoolConfig.m_mempoolConfig.size(), Eq(2U));
+    EXPECT_THAT(segment.m_mempoolConfig.m_mempoolConfig[0].m_numaNode, Eq(0U));
+    EXPECT_THAT(segment.m_mempoolConfig.m_mempoolConfig[1].m_numaNode, Eq(1U));
+}
+
 INSTANTIATE_TEST_SUITE_P(
     ParseAllMalformedInputConfigFiles,
     RoudiConfigTomlFileProvider_test,
@@ -74,6 +95,10 @@ INSTANTIATE_TEST_SUITE_P(
                                  "roudi_config_error_mempool_without_chunk_size.toml"},
            ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::MEMPOOL_WITHOUT_CHUNK_COUNT,
                                  "roudi_config_error_mempool_without_chunk_count.toml"},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_NUMA_PLACEMENT,
+                                 "roudi_config_error_invalid_numa_policy.toml"},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_NUMA_PLACEMENT,
+                                 "roudi_config_error_numa_node_out_of_range.toml"},
            ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::EXCEPTION_IN_PARSER,
                                  "toml_parser_exception.toml"}));
 
@@ -0,0 +1,143 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/roudi/hash_bucket_index.hpp"
+
+#include "test.hpp"
+
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using iox::roudi::HashBucketIndex;
+
+class HashBucketIndex_test : public Test
+{
+  public:
+    static constexpr uint64_t CAPACITY{5U};
+
+    std::vector<int> valuesOf(const uint64_t hash)
+    {
+        std::vector<int> values;
+        sut.forEach(hash, [&](const int& value) { values.emplace_back(value); });
+        return values;
+    }
+
+    static bool isAny(const int&)
+    {
+        return true;
+    }
+
+    HashBucketIndex<int, CAPACITY> sut;
+};
+
+constexpr uint64_t HashBucketIndex_test::CAPACITY;
+
+TEST_F(HashBucketIndex_test, EmptyIndexHasNoValues)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cf7629f9-504f-4257-915b-9157eb1f51b5");
+    EXPECT_THAT(sut.size(), Eq(0U));
+    EXPECT_TRUE(valuesOf(42U).empty());
+    EXPECT_FALSE(sut.find(42U, isAny).has_value());
+}
+
+TEST_F(HashBucketIndex_test, ForEachFindsOnlyValuesWithTheHash)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1f79230a-ef3f-47c3-bf4c-3733dc0e6095");
+    EXPECT_TRUE(sut.add(1U, 10));
+    EXPECT_TRUE(sut.add(1U, 11));
+    EXPECT_TRUE(sut.add(2U, 20));
+    // same bucket as the hash 1 but a different hash
+    EXPECT_TRUE(sut.add(1U + 8U, 90));
+
+    EXPECT_THAT(sut.size(), Eq(4U));
+    EXPECT_THAT(valuesOf(1U), UnorderedElementsAre(10, 11));
+    EXPECT_THAT(valuesOf(2U), ElementsAre(20));
+    EXPECT_THAT(valuesOf(1U + 8U), ElementsAre(90));
+}
+
+TEST_F(HashBucketIndex_test, FindReturnsValueWhichMatchesThePredicate)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "74a93e27-0d08-4914-bb74-c555f453d88d");
+    sut.add(1U, 10);
+    sut.add(1U, 11);
+
+    auto value = sut.find(1U, [](const int& value) { return value == 11; });
+    ASSERT_TRUE(value.has_value());
+    EXPECT_THAT(value.value(), Eq(11));
+    EXPECT_FALSE(sut.find(1U, [](const int& value) { return value == 12; }).has_value());
+}
+
+TEST_F(HashBucketIndex_test, RemovedValueIsNotFoundAnymore)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "872ffc3a-124b-4b65-9a48-f0f06e452197");
+    sut.add(1U, 10);
+    sut.add(1U, 11);
+    sut.add(1U, 12);
+
+    EXPECT_TRUE(sut.remove(1U, [](const int& value) { return value == 11; }));
+    EXPECT_FALSE(sut.remove(1U, [](const int& value) { return value == 11; }));
+    EXPECT_FALSE(sut.remove(2U, isAny));
+
+    EXPECT_THAT(sut.size(), Eq(2U));
+    EXPECT_THAT(valuesOf(1U), UnorderedElementsAre(10, 12));
+}
+
+TEST_F(HashBucketIndex_test, AddFailsWhenCapacityIsExhausted)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0ae51566-936e-46a1-af84-5fac31f89ef5");
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        EXPECT_TRUE(sut.add(i, static_cast<int>(i)));
+    }
+    EXPECT_FALSE(sut.add(CAPACITY, 0));
+    EXPECT_THAT(sut.size(), Eq(CAPACITY));
+}
+
+TEST_F(HashBucketIndex_test, RemovedEntriesAreReused)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "36ba397d-e240-4be2-a35c-531c6fe0bfd1");
+    for (int round = 0; round < 3; ++round)
+    {
+        for (uint64_t i = 0U; i < CAPACITY; ++i)
+        {
+            EXPECT_TRUE(sut.add(i, round));
+        }
+        for (uint64_t i = 0U; i < CAPACITY; ++i)
+        {
+            EXPECT_TRUE(sut.remove(i, isAny));
+        }
+    }
+    EXPECT_THAT(sut.size(), Eq(0U));
+}
+
+TEST_F(HashBucketIndex_test, ClearRemovesAllEntries)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "08fe43c7-555a-4832-b58c-9be06a5d28df");
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        sut.add(i, static_cast<int>(i));
+    }
+
+    sut.clear();
+
+    EXPECT_THAT(sut.size(), Eq(0U));
+    EXPECT_TRUE(valuesOf(0U).empty());
+    EXPECT_TRUE(sut.add(0U, 0));
+}
+
+} // namespace
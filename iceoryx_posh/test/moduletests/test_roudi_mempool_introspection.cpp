@@ -229,7 +229,7 @@ TEST_F(MemPoolIntrospection_test, DISABLED_send_withSubscribers)
         m_rouDiInternalMemoryManager_mock, m_segmentManager_mock, std::move(m_publisherPortImpl_mock));
 
     MemPoolInfoContainer memPoolInfoContainer;
-    MemPoolInfo memPoolInfo{0, 0, 0, 0};
+    MemPoolInfo memPoolInfo{0, 0, 0, 0, 0};
     initMemPoolInfoContainer(memPoolInfoContainer);
 
     EXPECT_CALL(m_segmentManager_mock.m_segmentContainer.front().getMemoryManager(), getMemPoolInfo(_))
@@ -256,7 +256,7 @@ TIMING_TEST_F(MemPoolIntrospection_test, thread, Repeat(5), [&] {
         m_rouDiInternalMemoryManager_mock, m_segmentManager_mock, std::move(m_publisherPortImpl_mock));
 
     MemPoolInfoContainer memPoolInfoContainer;
-    MemPoolInfo memPoolInfo(0, 0, 0, 0);
+    MemPoolInfo memPoolInfo(0, 0, 0, 0, 0);
     initMemPoolInfoContainer(memPoolInfoContainer);
 
     EXPECT_CALL(m_rouDiInternalMemoryManager_mock, getMemPoolInfo(_)).WillRepeatedly(Invoke([&](uint32_t index) {
@@ -0,0 +1,138 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/internal/roudi/mempool_profile.hpp"
+#include "test.hpp"
+
+#include <sstream>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::roudi;
+
+class MemPoolProfile_test : public Test
+{
+  public:
+    SegmentProfiles_t createProfile()
+    {
+        SegmentProfiles_t profile;
+        SegmentProfile segment;
+        segment.m_writerGroup = "writer";
+        segment.m_readerGroup = "reader";
+        segment.m_mempools.push_back({128U, 100U, 42U, 0U});
+        segment.m_mempools.push_back({1024U, 10U, 10U, 3U});
+        segment.m_requests.push_back({96U, 1000U});
+        segment.m_requests.push_back({1024U, 13U});
+        segment.m_tooLargeRequests = 7U;
+        profile.push_back(segment);
+
+        SegmentProfile unusedSegment;
+        unusedSegment.m_writerGroup = "foo";
+        unusedSegment.m_readerGroup = "bar";
+        unusedSegment.m_mempools.push_back({64U, 1U, 0U, 0U});
+        profile.push_back(unusedSegment);
+        return profile;
+    }
+
+    std::stringstream stream;
+};
+
+TEST_F(MemPoolProfile_test, ReadingAWrittenProfileResultsInTheSameProfile)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bc41b729-6c32-4e2e-82d5-34168e0b95ce");
+    const auto profile = createProfile();
+    writeMemPoolProfile(stream, profile);
+
+    auto result = readMemPoolProfile(stream);
+
+    ASSERT_FALSE(result.has_error());
+    const auto& readProfile = result.value();
+    ASSERT_THAT(readProfile.size(), Eq(profile.size()));
+    for (uint64_t i = 0U; i < profile.size(); ++i)
+    {
+        EXPECT_THAT(readProfile[i].m_writerGroup, Eq(profile[i].m_writerGroup));
+        EXPECT_THAT(readProfile[i].m_readerGroup, Eq(profile[i].m_readerGroup));
+        EXPECT_THAT(readProfile[i].m_tooLargeRequests, Eq(profile[i].m_tooLargeRequests));
+        ASSERT_THAT(readProfile[i].m_mempools.size(), Eq(profile[i].m_mempools.size()));
+        for (uint64_t k = 0U; k < profile[i].m_mempools.size(); ++k)
+        {
+            EXPECT_THAT(readProfile[i].m_mempools[k].m_chunkPayloadSize,
+                        Eq(profile[i].m_mempools[k].m_chunkPayloadSize));
+            EXPECT_THAT(readProfile[i].m_mempools[k].m_numberOfChunks, Eq(profile[i].m_mempools[k].m_numberOfChunks));
+            EXPECT_THAT(readProfile[i].m_mempools[k].m_maxUsedChunks, Eq(profile[i].m_mempools[k].m_maxUsedChunks));
+            EXPECT_THAT(readProfile[i].m_mempools[k].m_allocationFailures,
+                        Eq(profile[i].m_mempools[k].m_allocationFailures));
+        }
+        ASSERT_THAT(readProfile[i].m_requests.size(), Eq(profile[i].m_requests.size()));
+        for (uint64_t k = 0U; k < profile[i].m_requests.size(); ++k)
+        {
+            EXPECT_THAT(readProfile[i].m_requests[k].m_maxChunkPayloadSize,
+                        Eq(profile[i].m_requests[k].m_maxChunkPayloadSize));
+            EXPECT_THAT(readProfile[i].m_requests[k].m_count, Eq(profile[i].m_requests[k].m_count));
+        }
+    }
+}
+
+TEST_F(MemPoolProfile_test, ReadingAProfileWithInvalidHeaderFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "30c8f273-3846-4c04-840c-450691c0acd4");
+    stream << "some-other-file 1\n";
+
+    auto result = readMemPoolProfile(stream);
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(MemPoolProfileError::INVALID_HEADER));
+}
+
+TEST_F(MemPoolProfile_test, ReadingAProfileWithIncompatibleVersionFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "81fa578b-e341-433b-acf4-2686dff6f041");
+    stream << MEMPOOL_PROFILE_HEADER << " " << MEMPOOL_PROFILE_VERSION + 1U << "\n";
+
+    auto result = readMemPoolProfile(stream);
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(MemPoolProfileError::INCOMPATIBLE_VERSION));
+}
+
+TEST_F(MemPoolProfile_test, ReadingAProfileWithMempoolBeforeSegmentFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d8169848-a175-48d8-af46-f25ecd7c7428");
+    stream << MEMPOOL_PROFILE_HEADER << " " << MEMPOOL_PROFILE_VERSION << "\n";
+    stream << "mempool 128 10 1 0\n";
+
+    auto result = readMemPoolProfile(stream);
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(MemPoolProfileError::ENTRY_WITHOUT_SEGMENT));
+}
+
+TEST_F(MemPoolProfile_test, ReadingAProfileWithIncompleteLineFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4a48f845-b304-4cdd-bb17-16c35d847a9c");
+    stream << MEMPOOL_PROFILE_HEADER << " " << MEMPOOL_PROFILE_VERSION << "\n";
+    stream << "segment writer reader\n";
+    stream << "mempool 128 10\n";
+
+    auto result = readMemPoolProfile(stream);
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(MemPoolProfileError::INVALID_LINE));
+}
+
+} // namespace
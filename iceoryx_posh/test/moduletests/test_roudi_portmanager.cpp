@@ -146,6 +146,50 @@ TEST_F(PortManager_test, DoDiscoveryWithSubscribersCreatedBeforeAndAfterCreation
     EXPECT_THAT(subscriber2.getSubscriptionState(), Eq(iox::SubscribeState::SUBSCRIBED));
 }
 
+TEST_F(PortManager_test, GatewaySubscriberDoesNotPreventInternalSubscribersFromConnectingToGatewayPublisher)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d17e2145-ead9-4b9f-81ed-d259631ffc90");
+    PublisherOptions publisherOptions{1U, iox::NodeName_t("node"), false};
+    SubscriberOptions subscriberOptions{1U, 1U, iox::NodeName_t("node"), false};
+    const ServiceDescription gatewayService{"1", "1", "1", {0U, 0U, 0U, 0U}, iox::capro::Interfaces::DDS};
+
+    // the gateway subscriber is in between the internal ones to be independent of the matching order
+    SubscriberPortUser subscriber1(
+        m_portManager->acquireSubscriberPortData({"1", "1", "1"}, subscriberOptions, "schlomo", PortConfigInfo())
+            .value());
+    SubscriberPortUser gatewaySubscriber(
+        m_portManager->acquireSubscriberPortData(gatewayService, subscriberOptions, "gateway", PortConfigInfo())
+            .value());
+    SubscriberPortUser subscriber2(
+        m_portManager->acquireSubscriberPortData({"1", "1", "1"}, subscriberOptions, "ingnatz", PortConfigInfo())
+            .value());
+    subscriber1.subscribe();
+    gatewaySubscriber.subscribe();
+    subscriber2.subscribe();
+
+    m_portManager->doDiscovery();
+
+    PublisherPortUser gatewayPublisher(m_portManager
+                                           ->acquirePublisherPortData(gatewayService,
+                                                                      publisherOptions,
+                                                                      "gateway",
+                                                                      m_payloadDataSegmentMemoryManager,
+                                                                      PortConfigInfo())
+                                           .value());
+    gatewayPublisher.offer();
+
+    m_portManager->doDiscovery();
+
+    auto maybeChunk = gatewayPublisher.tryAllocateChunk(42U, 8U);
+    ASSERT_FALSE(maybeChunk.has_error());
+    gatewayPublisher.sendChunk(maybeChunk.value());
+
+    // only the subscriber of the gateway is skipped, it would forward the samples of its own publisher
+    EXPECT_TRUE(gatewaySubscriber.tryGetChunk().has_error());
+    EXPECT_FALSE(subscriber1.tryGetChunk().has_error());
+    EXPECT_FALSE(subscriber2.tryGetChunk().has_error());
+}
+
 TEST_F(PortManager_test, SubscribeOnCreateSubscribesWithoutDiscoveryLoopWhenPublisherAvailable)
 {
     ::testing::Test::RecordProperty("TEST_ID", "5a94cf82-d1f6-4129-88ca-34344d94e04e");
@@ -680,6 +724,69 @@ TEST_F(PortManager_test, AcquireConditionVariablesDataAfterDestroyingPreviouslyA
     acquireMaxNumberOfConditionVariables(runtimeName);
 }
 
+TEST_F(PortManager_test, AcquiringOneMoreThanMaximumNumberOfRuntimeRequestChannelsFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3c35c3bd-5ed8-40af-8170-0295a5514ba7");
+    for (uint32_t i = 0U; i < iox::MAX_PROCESS_NUMBER; ++i)
+    {
+        auto newProcessName = "HypnoToadForEver" + iox::cxx::convert::toString(i);
+        auto requestChannelResult = m_portManager->acquireRuntimeRequestChannelData(
+            iox::RuntimeName_t(iox::cxx::TruncateToCapacity, newProcessName));
+        ASSERT_FALSE(requestChannelResult.has_error());
+    }
+
+    auto errorHandlerCalled{false};
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [&errorHandlerCalled](const iox::PoshError, const iox::ErrorLevel) { errorHandlerCalled = true; });
+
+    auto requestChannelResult = m_portManager->acquireRuntimeRequestChannelData("AnotherToad");
+    ASSERT_TRUE(requestChannelResult.has_error());
+    EXPECT_TRUE(errorHandlerCalled);
+    EXPECT_THAT(requestChannelResult.get_error(), Eq(PortPoolError::RUNTIME_REQUEST_CHANNEL_LIST_FULL));
+}
+
+TEST_F(PortManager_test, RuntimeRequestChannelIsNotReleasedWhenPortsOfProcessAreDeleted)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4b74aca6-5358-41e7-8907-acbf5af9f358");
+    for (uint32_t i = 0U; i < iox::MAX_PROCESS_NUMBER; ++i)
+    {
+        auto newProcessName = "HypnoToadForEver" + iox::cxx::convert::toString(i);
+        ASSERT_FALSE(m_portManager
+                         ->acquireRuntimeRequestChannelData(
+                             iox::RuntimeName_t(iox::cxx::TruncateToCapacity, newProcessName))
+                         .has_error());
+    }
+
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [](const iox::PoshError, const iox::ErrorLevel) {});
+
+    // the response to the TERMINATION request is sent via the request channel after the ports were deleted
+    m_portManager->deletePortsOfProcess("HypnoToadForEver0");
+
+    EXPECT_TRUE(m_portManager->acquireRuntimeRequestChannelData("AnotherToad").has_error());
+}
+
+TEST_F(PortManager_test, RuntimeRequestChannelCanBeAcquiredAgainAfterItWasReleased)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9744cfd8-0ba6-4726-ba98-89a00e698e91");
+    iox::runtime::RuntimeRequestChannelData* firstRequestChannel{nullptr};
+    for (uint32_t i = 0U; i < iox::MAX_PROCESS_NUMBER; ++i)
+    {
+        auto newProcessName = "HypnoToadForEver" + iox::cxx::convert::toString(i);
+        auto requestChannelResult = m_portManager->acquireRuntimeRequestChannelData(
+            iox::RuntimeName_t(iox::cxx::TruncateToCapacity, newProcessName));
+        ASSERT_FALSE(requestChannelResult.has_error());
+        if (firstRequestChannel == nullptr)
+        {
+            firstRequestChannel = requestChannelResult.value();
+        }
+    }
+
+    m_portManager->releaseRuntimeRequestChannelData(firstRequestChannel);
+
+    EXPECT_FALSE(m_portManager->acquireRuntimeRequestChannelData("AnotherToad").has_error());
+}
+
 TEST_F(PortManager_test, AcquiringMaximumNumberOfNodesWorks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "7c4e697e-c379-44f5-a081-5903d9b287f5");
@@ -1000,4 +1107,37 @@ TEST_F(PortManager_test, PortsDestroyInProcess2ChangeStatesOfPortsInProcess1)
     }
 }
 
+TEST_F(PortManager_test, DeletingPortsOfProcessWhichTerminatedInsideTheFastPathDoesNotBlock)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1fa230fd-9a16-48d8-8217-5c272b03ecdd");
+    const iox::RuntimeName_t publisherRuntimeName{"guiseppe"};
+    PublisherOptions publisherOptions{0U, iox::NodeName_t("node")};
+    SubscriberOptions subscriberOptions{1U, 0U, iox::NodeName_t("node")};
+    auto publisherData = m_portManager
+                             ->acquirePublisherPortData({"1", "1", "1"},
+                                                        publisherOptions,
+                                                        publisherRuntimeName,
+                                                        m_payloadDataSegmentMemoryManager,
+                                                        PortConfigInfo())
+                             .value();
+    SubscriberPortUser subscriber(
+        m_portManager->acquireSubscriberPortData({"1", "1", "1"}, subscriberOptions, "schlomo", PortConfigInfo())
+            .value());
+    ASSERT_THAT(subscriber.getSubscriptionState(), Eq(iox::SubscribeState::SUBSCRIBED));
+
+    // the publisher process terminated while delivering a chunk via the fast path
+    ASSERT_TRUE(publisherData->m_chunkSenderData.m_fastPathGate.tryEnter());
+
+    constexpr iox::units::Duration DEADLOCK_TIMEOUT{5_s};
+    Watchdog deadlockWatchdog{DEADLOCK_TIMEOUT};
+    deadlockWatchdog.watchAndActOnFailure([] { std::terminate(); });
+
+    m_portManager->deletePortsOfProcess(publisherRuntimeName);
+
+    if (std::is_same<iox::build::CommunicationPolicy, iox::build::OneToManyPolicy>::value)
+    {
+        EXPECT_THAT(subscriber.getSubscriptionState(), Eq(iox::SubscribeState::WAIT_FOR_OFFER));
+    }
+}
+
 } // namespace iox_test_roudi_portmanager
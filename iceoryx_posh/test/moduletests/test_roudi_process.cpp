@@ -24,6 +24,11 @@
 #include "iceoryx_posh/version/compatibility_check_level.hpp"
 #include "test.hpp"
 
+#if !defined(_WIN32)
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
 namespace
 {
 using namespace ::testing;
@@ -119,4 +124,65 @@ TEST_F(Process_test, TimeStamp)
     EXPECT_THAT(roudiproc.getTimestamp(), Eq(timestmp));
 }
 
+TEST_F(Process_test, UnmonitoredProcessHasNoPidFileDescriptor)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1a170b0c-e433-4f4d-a6f2-64025f50773b");
+    Process roudiproc(processname, static_cast<uint32_t>(getpid()), user, false, sessionId);
+
+    EXPECT_FALSE(roudiproc.getPidFileDescriptor().has_value());
+    EXPECT_FALSE(roudiproc.hasTerminated());
+}
+
+#if !defined(_WIN32)
+TEST_F(Process_test, RunningProcessHasNotTerminated)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "aa562951-de72-438d-9ad0-6ec323581967");
+    Process roudiproc(processname, static_cast<uint32_t>(getpid()), user, isMonitored, sessionId);
+    if (!roudiproc.getPidFileDescriptor().has_value())
+    {
+        GTEST_SKIP() << "process file descriptors are not supported on this platform";
+    }
+
+    EXPECT_FALSE(roudiproc.hasTerminated());
+}
+
+TEST_F(Process_test, TerminatedProcessIsDetectedViaPidFileDescriptor)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1d6ed6c1-a639-4cf1-bde2-6668c0d05ee9");
+    int terminatePipe[2];
+    ASSERT_EQ(pipe(terminatePipe), 0);
+
+    auto childProcessId = fork();
+    ASSERT_NE(childProcessId, -1);
+    if (childProcessId == 0)
+    {
+        // terminates when the parent closes the pipe
+        close(terminatePipe[1]);
+        char dummy{0};
+        static_cast<void>(read(terminatePipe[0], &dummy, 1U));
+        _exit(0);
+    }
+    close(terminatePipe[0]);
+
+    {
+        Process roudiproc(processname, static_cast<uint32_t>(childProcessId), user, isMonitored, sessionId);
+        const bool hasPidFileDescriptor = roudiproc.getPidFileDescriptor().has_value();
+        if (hasPidFileDescriptor)
+        {
+            EXPECT_FALSE(roudiproc.hasTerminated());
+        }
+
+        close(terminatePipe[1]);
+        int status{0};
+        waitpid(childProcessId, &status, 0);
+
+        if (!hasPidFileDescriptor)
+        {
+            GTEST_SKIP() << "process file descriptors are not supported on this platform";
+        }
+        EXPECT_TRUE(roudiproc.hasTerminated());
+    }
+}
+#endif
+
 } // namespace
@@ -14,13 +14,17 @@
 //
 // SPDX-License-Identifier: Apache-2.0
 
+#include "iceoryx_hoofs/cxx/convert.hpp"
 #include "iceoryx_hoofs/cxx/string.hpp"
+#include "iceoryx_hoofs/internal/relocatable_pointer/base_relative_pointer.hpp"
 #include "iceoryx_hoofs/platform/types.hpp"
+#include "iceoryx_hoofs/platform/unistd.hpp"
 #include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
 #include "iceoryx_hoofs/testing/watch_dog.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/roudi/process_manager.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_interface_creator.hpp"
+#include "iceoryx_posh/internal/runtime/runtime_request_channel.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iceoryx_posh/roudi/memory/iceoryx_roudi_memory_manager.hpp"
 #include "iceoryx_posh/roudi/memory/roudi_memory_interface.hpp"
@@ -35,6 +39,7 @@ using namespace iox::popo;
 using namespace iox::runtime;
 using namespace iox::posix;
 using namespace iox::version;
+using namespace iox::units::duration_literals;
 
 class ProcessManager_test : public Test
 {
@@ -54,6 +59,62 @@ class ProcessManager_test : public Test
     {
     }
 
+    /// @brief registers a process with the pid of the test, i.e. a process which is alive, and acquires its request
+    /// channel from the REG_ACK like the runtime does
+    RuntimeRequestChannelData* registerRunningProcessWithRequestChannel()
+    {
+        const auto pid = static_cast<uint32_t>(getpid());
+        if (!m_sut->registerProcess(m_processname, pid, m_user, m_isMonitored, 1U, 1U, m_versionInfo))
+        {
+            return nullptr;
+        }
+
+        IpcMessage regAck;
+        if (!m_processIpcInterface.timedReceive(1_s, regAck))
+        {
+            return nullptr;
+        }
+        iox::rp::BaseRelativePointer::id_underlying_t segmentId{0U};
+        iox::rp::BaseRelativePointer::offset_t requestChannelOffset{0U};
+        iox::cxx::convert::fromString(regAck.getElementAtIndex(4U).c_str(), segmentId);
+        iox::cxx::convert::fromString(regAck.getElementAtIndex(6U).c_str(), requestChannelOffset);
+        return static_cast<RuntimeRequestChannelData*>(
+            iox::rp::BaseRelativePointer::getPtr(iox::rp::BaseRelativePointer::id_t{segmentId}, requestChannelOffset));
+    }
+
+    /// @brief sends the TERMINATION request via the request channel and lets the ProcessManager process it like RouDi
+    void terminateViaRequestChannel(RuntimeRequestChannel& requestChannel)
+    {
+        IpcMessage request;
+        request << IpcMessageTypeToString(IpcMessageType::TERMINATION) << m_processname;
+        ASSERT_TRUE(requestChannel.sendRequest(request));
+
+        auto requests = m_sut->takePendingRuntimeRequests();
+        ASSERT_THAT(requests.size(), Eq(1U));
+        ASSERT_THAT(stringToIpcMessageType(requests[0].message.getElementAtIndex(0U).c_str()),
+                    Eq(IpcMessageType::TERMINATION));
+        EXPECT_TRUE(m_sut->unregisterProcess(requests[0].runtimeName));
+    }
+
+    /// @brief acquires request channels for other runtimes until the pool is exhausted
+    /// @return the number of acquired request channels
+    uint64_t acquireAllRemainingRequestChannels()
+    {
+        auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+            [](const iox::PoshError, const iox::ErrorLevel) {});
+
+        uint64_t numberOfAcquiredChannels{0U};
+        while (!m_portManager
+                    ->acquireRuntimeRequestChannelData(
+                        iox::RuntimeName_t(iox::cxx::TruncateToCapacity,
+                                           "OtherProcess" + iox::cxx::convert::toString(numberOfAcquiredChannels)))
+                    .has_error())
+        {
+            ++numberOfAcquiredChannels;
+        }
+        return numberOfAcquiredChannels;
+    }
+
     const iox::RuntimeName_t m_processname{"TestProcess"};
     const uint32_t m_pid{42U};
     PosixUser m_user{iox::posix::PosixUser::getUserOfCurrentProcess().getName()};
@@ -157,4 +218,39 @@ TEST_F(ProcessManager_test, HandleProcessShutdownPreparationRequestWorks)
     ASSERT_FALSE(publisher.isOffered());
 }
 
+TEST_F(ProcessManager_test, TerminationViaRequestChannelIsAcknowledgedViaRequestChannel)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "07795986-3c4c-408b-85d6-95ef1d622e11");
+    auto requestChannelData = registerRunningProcessWithRequestChannel();
+    ASSERT_THAT(requestChannelData, Ne(nullptr));
+    RuntimeRequestChannel requestChannel(*requestChannelData);
+
+    terminateViaRequestChannel(requestChannel);
+
+    ASSERT_TRUE(requestChannel.isResponsePending());
+    IpcMessage response;
+    ASSERT_TRUE(requestChannel.waitForResponse(response));
+    EXPECT_THAT(stringToIpcMessageType(response.getElementAtIndex(0U).c_str()), Eq(IpcMessageType::TERMINATION_ACK));
+}
+
+TEST_F(ProcessManager_test, RequestChannelIsReleasedAfterRunningProcessHasTakenTheTerminationAck)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "765b813c-6efe-4b8c-bf51-5d64dfcf725c");
+    auto requestChannelData = registerRunningProcessWithRequestChannel();
+    ASSERT_THAT(requestChannelData, Ne(nullptr));
+    RuntimeRequestChannel requestChannel(*requestChannelData);
+
+    terminateViaRequestChannel(requestChannel);
+    m_sut->run();
+
+    // the request channel of the terminating process is still in use and must not be handed out again
+    EXPECT_THAT(acquireAllRemainingRequestChannels(), Eq(iox::MAX_PROCESS_NUMBER - 1U));
+
+    IpcMessage response;
+    ASSERT_TRUE(requestChannel.waitForResponse(response));
+    m_sut->run();
+
+    EXPECT_THAT(acquireAllRemainingRequestChannels(), Eq(1U));
+}
+
 } // namespace
@@ -0,0 +1,132 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#if !defined(_WIN32)
+#include "iceoryx_hoofs/internal/units/duration.hpp"
+#include "iceoryx_hoofs/platform/pidfd.hpp"
+#include "iceoryx_posh/internal/roudi/process_termination_monitor.hpp"
+
+#include "test.hpp"
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::roudi;
+using namespace iox::units::duration_literals;
+
+/// @brief a child process which terminates when terminate() is called
+class ChildProcess
+{
+  public:
+    ChildProcess() noexcept
+    {
+        if (pipe(m_terminatePipe) != 0)
+        {
+            return;
+        }
+        m_pid = fork();
+        if (m_pid == 0)
+        {
+            close(m_terminatePipe[1]);
+            char dummy{0};
+            static_cast<void>(read(m_terminatePipe[0], &dummy, 1U));
+            _exit(0);
+        }
+        close(m_terminatePipe[0]);
+    }
+
+    ~ChildProcess() noexcept
+    {
+        terminate();
+    }
+
+    ChildProcess(const ChildProcess&) = delete;
+    ChildProcess(ChildProcess&&) = delete;
+    ChildProcess& operator=(const ChildProcess&) = delete;
+    ChildProcess& operator=(ChildProcess&&) = delete;
+
+    void terminate() noexcept
+    {
+        if (m_pid > 0)
+        {
+            close(m_terminatePipe[1]);
+            int status{0};
+            waitpid(m_pid, &status, 0);
+            m_pid = -1;
+        }
+    }
+
+    pid_t pid() const noexcept
+    {
+        return m_pid;
+    }
+
+  private:
+    int m_terminatePipe[2]{-1, -1};
+    pid_t m_pid{-1};
+};
+
+class ProcessTerminationMonitor_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        if (!sut.isAvailable())
+        {
+            GTEST_SKIP() << "process file descriptors are not supported on this platform";
+        }
+    }
+
+    ProcessTerminationMonitor sut;
+};
+
+TEST_F(ProcessTerminationMonitor_test, WaitWithoutProcessesTimesOut)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "93613467-7648-4be6-93ad-50dc60e55249");
+    EXPECT_FALSE(sut.wait(10_ms));
+}
+
+TEST_F(ProcessTerminationMonitor_test, AddingInvalidPidFileDescriptorFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "eae80538-36d4-451e-9f7c-6c6286d52aec");
+    EXPECT_FALSE(sut.add(-1));
+}
+
+TEST_F(ProcessTerminationMonitor_test, WaitReturnsWhenMonitoredProcessTerminates)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8a950ace-4a40-43be-8d24-775839e5dfc4");
+    ChildProcess child;
+    ASSERT_GT(child.pid(), 0);
+    const int pidFileDescriptor = iox_pidfd_open(child.pid());
+    ASSERT_NE(pidFileDescriptor, -1);
+    ASSERT_TRUE(sut.add(pidFileDescriptor));
+
+    EXPECT_FALSE(sut.wait(10_ms));
+
+    child.terminate();
+    EXPECT_TRUE(sut.wait(10_s));
+
+    // closing the process file descriptor removes the process from the monitor
+    iox_pidfd_close(pidFileDescriptor);
+    EXPECT_FALSE(sut.wait(10_ms));
+}
+
+} // namespace
+#endif
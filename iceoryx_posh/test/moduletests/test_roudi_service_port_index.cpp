@@ -0,0 +1,102 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/internal/roudi/service_port_index.hpp"
+
+#include "test.hpp"
+
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using iox::capro::ServiceDescription;
+using iox::roudi::ServicePortIndex;
+
+struct PortDataStub
+{
+    explicit PortDataStub(const ServiceDescription& service)
+        : m_serviceDescription(service)
+    {
+    }
+
+    ServiceDescription m_serviceDescription;
+};
+
+class ServicePortIndex_test : public Test
+{
+  public:
+    std::vector<PortDataStub*> portsOf(const ServiceDescription& service)
+    {
+        std::vector<PortDataStub*> ports;
+        sut.forEach(service, [&](auto port) { ports.emplace_back(port); });
+        return ports;
+    }
+
+    const ServiceDescription m_service1{"Foo", "Bar", "Baz"};
+    const ServiceDescription m_service2{"Ping", "Pong", "Pang"};
+    PortDataStub m_port1{m_service1};
+    PortDataStub m_port2{m_service1};
+    PortDataStub m_port3{m_service2};
+
+    ServicePortIndex<PortDataStub, 8U> sut;
+};
+
+TEST_F(ServicePortIndex_test, EmptyIndexHasNoPorts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e1100fcb-6f52-453f-95b5-de31a042237d");
+    EXPECT_THAT(sut.size(), Eq(0U));
+    EXPECT_TRUE(portsOf(m_service1).empty());
+}
+
+TEST_F(ServicePortIndex_test, ForEachFindsOnlyPortsWithTheServiceDescription)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c5e4c98e-4ced-412c-9069-eb8cf36ca526");
+    sut.add(&m_port1);
+    sut.add(&m_port2);
+    sut.add(&m_port3);
+
+    EXPECT_THAT(sut.size(), Eq(3U));
+    EXPECT_THAT(portsOf(m_service1), UnorderedElementsAre(&m_port1, &m_port2));
+    EXPECT_THAT(portsOf(m_service2), ElementsAre(&m_port3));
+}
+
+TEST_F(ServicePortIndex_test, RemovedPortIsNotFoundAnymore)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e4d641cd-c6cb-408d-ab52-398afacca4f6");
+    sut.add(&m_port1);
+    sut.add(&m_port2);
+
+    sut.remove(&m_port1);
+
+    EXPECT_THAT(sut.size(), Eq(1U));
+    EXPECT_THAT(portsOf(m_service1), ElementsAre(&m_port2));
+}
+
+TEST_F(ServicePortIndex_test, RemovingPortWhichIsNotContainedDoesNothing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2a6f7e96-b871-4b6b-affd-9b1e4a05f8cb");
+    sut.add(&m_port1);
+
+    sut.remove(&m_port2);
+    sut.remove(&m_port3);
+
+    EXPECT_THAT(sut.size(), Eq(1U));
+    EXPECT_THAT(portsOf(m_service1), ElementsAre(&m_port1));
+}
+
+} // namespace
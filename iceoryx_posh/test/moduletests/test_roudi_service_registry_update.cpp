@@ -0,0 +1,177 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/internal/roudi/service_registry_update.hpp"
+
+#include "test.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::roudi;
+using iox::capro::ServiceDescription;
+
+class ServiceRegistryUpdate_test : public Test
+{
+  public:
+    using Entries_t = std::vector<ServiceRegistry::ServiceDescriptionEntry>;
+
+    ServiceRegistryUpdate* createSnapshot(const uint64_t version)
+    {
+        auto memory = memoryOfSize(ServiceRegistryUpdate::requiredSnapshotSize(m_producer));
+        return ServiceRegistryUpdate::createSnapshot(memory, version, m_producer);
+    }
+
+    ServiceRegistryUpdate*
+    createChange(const uint64_t version, const ServiceRegistryUpdate::Type type, const ServiceDescription& service)
+    {
+        auto memory = memoryOfSize(ServiceRegistryUpdate::requiredSize(1U));
+        return ServiceRegistryUpdate::createChange(memory, version, type, service);
+    }
+
+    static Entries_t entriesOf(const ServiceRegistry& registry)
+    {
+        Entries_t entries;
+        registry.forEach([&](const auto& entry) { entries.emplace_back(entry); });
+        return entries;
+    }
+
+    static bool areEqual(const ServiceRegistry& lhs, const ServiceRegistry& rhs)
+    {
+        auto lhsEntries = entriesOf(lhs);
+        auto rhsEntries = entriesOf(rhs);
+        return std::equal(lhsEntries.begin(),
+                          lhsEntries.end(),
+                          rhsEntries.begin(),
+                          rhsEntries.end(),
+                          [](const auto& lhsEntry, const auto& rhsEntry) {
+                              return lhsEntry.serviceDescription == rhsEntry.serviceDescription
+                                     && lhsEntry.publisherCount == rhsEntry.publisherCount
+                                     && lhsEntry.serverCount == rhsEntry.serverCount;
+                          });
+    }
+
+    void* memoryOfSize(const uint64_t size)
+    {
+        // uint64_t elements provide the alignment required by the update
+        m_memory.resize(size / sizeof(uint64_t) + 1U);
+        return m_memory.data();
+    }
+
+    ServiceRegistry m_producer;
+    ServiceRegistry m_consumer;
+    std::vector<uint64_t> m_memory;
+
+    const ServiceDescription m_service1{"Foo", "Bar", "Baz"};
+    const ServiceDescription m_service2{"Ping", "Pong", "Pang"};
+};
+
+TEST_F(ServiceRegistryUpdate_test, SnapshotContainsAllEntriesOfTheRegistry)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a0b62436-b1b7-47f7-91c5-5d5a35ee2719");
+    ASSERT_FALSE(m_producer.addPublisher(m_service1).has_error());
+    ASSERT_FALSE(m_producer.addPublisher(m_service1).has_error());
+    ASSERT_FALSE(m_producer.addServer(m_service2).has_error());
+
+    auto sut = createSnapshot(42U);
+
+    EXPECT_THAT(sut->version(), Eq(42U));
+    EXPECT_THAT(sut->type(), Eq(ServiceRegistryUpdate::Type::SNAPSHOT));
+    EXPECT_THAT(sut->numberOfEntries(), Eq(2U));
+}
+
+TEST_F(ServiceRegistryUpdate_test, AppliedSnapshotReplicatesTheRegistry)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "797638a6-e1d9-4b8b-aa1d-5b126b2870be");
+    ASSERT_FALSE(m_producer.addPublisher(m_service1).has_error());
+    ASSERT_FALSE(m_producer.addPublisher(m_service1).has_error());
+    ASSERT_FALSE(m_producer.addServer(m_service1).has_error());
+    ASSERT_FALSE(m_producer.addServer(m_service2).has_error());
+
+    createSnapshot(0U)->applyTo(m_consumer);
+
+    EXPECT_TRUE(areEqual(m_consumer, m_producer));
+}
+
+TEST_F(ServiceRegistryUpdate_test, AppliedSnapshotReplacesPreviousEntries)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d9d88087-bcc5-4e9e-9761-52dbb7348af6");
+    ASSERT_FALSE(m_consumer.addPublisher(m_service1).has_error());
+    ASSERT_FALSE(m_producer.addServer(m_service2).has_error());
+
+    createSnapshot(0U)->applyTo(m_consumer);
+
+    EXPECT_TRUE(areEqual(m_consumer, m_producer));
+}
+
+TEST_F(ServiceRegistryUpdate_test, AppliedSnapshotOfEmptyRegistryClearsRegistry)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "52e48ded-6ebc-41c0-a409-462df6299013");
+    ASSERT_FALSE(m_consumer.addPublisher(m_service1).has_error());
+
+    auto sut = createSnapshot(0U);
+    EXPECT_THAT(sut->numberOfEntries(), Eq(0U));
+    sut->applyTo(m_consumer);
+
+    EXPECT_TRUE(entriesOf(m_consumer).empty());
+}
+
+TEST_F(ServiceRegistryUpdate_test, ChangeContainsOneEntry)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "46fafb8d-e243-45ea-8cff-d34cd58f5cf1");
+    auto sut = createChange(7U, ServiceRegistryUpdate::Type::ADD_SERVER, m_service1);
+
+    EXPECT_THAT(sut->version(), Eq(7U));
+    EXPECT_THAT(sut->type(), Eq(ServiceRegistryUpdate::Type::ADD_SERVER));
+    EXPECT_THAT(sut->numberOfEntries(), Eq(1U));
+}
+
+TEST_F(ServiceRegistryUpdate_test, AppliedChangesReplicateTheRegistry)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "95551419-7e5a-4385-8bf5-6c423e086e00");
+    createSnapshot(0U)->applyTo(m_consumer);
+
+    ASSERT_FALSE(m_producer.addPublisher(m_service1).has_error());
+    createChange(1U, ServiceRegistryUpdate::Type::ADD_PUBLISHER, m_service1)->applyTo(m_consumer);
+    ASSERT_FALSE(m_producer.addServer(m_service1).has_error());
+    createChange(2U, ServiceRegistryUpdate::Type::ADD_SERVER, m_service1)->applyTo(m_consumer);
+    ASSERT_FALSE(m_producer.addServer(m_service2).has_error());
+    createChange(3U, ServiceRegistryUpdate::Type::ADD_SERVER, m_service2)->applyTo(m_consumer);
+
+    EXPECT_TRUE(areEqual(m_consumer, m_producer));
+}
+
+TEST_F(ServiceRegistryUpdate_test, AppliedRemoveChangesReplicateTheRegistry)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ed164774-e60c-4371-8bcc-3da4fc5aaf30");
+    ASSERT_FALSE(m_producer.addPublisher(m_service1).has_error());
+    ASSERT_FALSE(m_producer.addServer(m_service2).has_error());
+    createSnapshot(0U)->applyTo(m_consumer);
+
+    m_producer.removePublisher(m_service1);
+    createChange(1U, ServiceRegistryUpdate::Type::REMOVE_PUBLISHER, m_service1)->applyTo(m_consumer);
+    m_producer.removeServer(m_service2);
+    createChange(2U, ServiceRegistryUpdate::Type::REMOVE_SERVER, m_service2)->applyTo(m_consumer);
+
+    EXPECT_TRUE(entriesOf(m_consumer).empty());
+    EXPECT_TRUE(areEqual(m_consumer, m_producer));
+}
+
+} // namespace
@@ -0,0 +1,148 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/testing/watch_dog.hpp"
+#include "iceoryx_posh/internal/runtime/runtime_request_channel.hpp"
+#include "test.hpp"
+
+#include <atomic>
+#include <thread>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::runtime;
+using namespace iox::units::duration_literals;
+
+class RuntimeRequestChannel_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        deadlockWatchdog.watchAndActOnFailure([] { std::terminate(); });
+    }
+
+    bool hasDoorbellRung()
+    {
+        auto result = doorbell.tryWait();
+        return !result.has_error() && result.value();
+    }
+
+    iox::concurrent::FutexEvent doorbell;
+    RuntimeRequestChannelData data{"hypnotoad", doorbell};
+    RuntimeRequestChannel runtimeSide{data};
+    RuntimeRequestChannel roudiSide{data};
+    const IpcMessage request{"CREATE_NODE", "hypnotoad", "all glory"};
+    const IpcMessage response{"CREATE_NODE_ACK", "0815"};
+    Watchdog deadlockWatchdog{5_s};
+};
+
+TEST_F(RuntimeRequestChannel_test, TakeRequestWithoutPendingRequestReturnsNullopt)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0d43a9ea-3ca1-49a1-9a37-4512643d170d");
+    EXPECT_FALSE(roudiSide.takeRequest().has_value());
+    EXPECT_FALSE(roudiSide.isRequestInProgress());
+}
+
+TEST_F(RuntimeRequestChannel_test, SentRequestRingsDoorbellAndCanBeTakenOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0c864fd1-5f47-42e6-9089-1f6c3e60a354");
+    ASSERT_TRUE(runtimeSide.sendRequest(request));
+    EXPECT_TRUE(hasDoorbellRung());
+
+    auto takenRequest = roudiSide.takeRequest();
+    ASSERT_TRUE(takenRequest.has_value());
+    EXPECT_THAT(takenRequest->getMessage(), Eq(request.getMessage()));
+    EXPECT_TRUE(roudiSide.isRequestInProgress());
+    EXPECT_FALSE(roudiSide.takeRequest().has_value());
+}
+
+TEST_F(RuntimeRequestChannel_test, SecondRequestFailsWhileFirstIsOngoing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5521804d-f288-4d48-8a77-2c5f88a3ab3c");
+    ASSERT_TRUE(runtimeSide.sendRequest(request));
+    EXPECT_FALSE(runtimeSide.sendRequest(request));
+}
+
+TEST_F(RuntimeRequestChannel_test, ResponseIsReceivedAndChannelCanBeReused)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "58ec24cc-a644-4944-95b5-10fec1df85c6");
+    ASSERT_TRUE(runtimeSide.sendRequest(request));
+    ASSERT_TRUE(roudiSide.takeRequest().has_value());
+    ASSERT_TRUE(roudiSide.sendResponse(response));
+    EXPECT_FALSE(roudiSide.isRequestInProgress());
+
+    IpcMessage receivedResponse;
+    ASSERT_TRUE(runtimeSide.waitForResponse(receivedResponse));
+    EXPECT_THAT(receivedResponse.getMessage(), Eq(response.getMessage()));
+
+    EXPECT_TRUE(runtimeSide.sendRequest(request));
+}
+
+TEST_F(RuntimeRequestChannel_test, SendResponseWithoutRequestInProgressFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6ba974e5-cb04-412a-b6dc-e68c7969a48d");
+    EXPECT_FALSE(roudiSide.sendResponse(response));
+
+    ASSERT_TRUE(runtimeSide.sendRequest(request));
+    EXPECT_FALSE(roudiSide.sendResponse(response));
+}
+
+TEST_F(RuntimeRequestChannel_test, OversizedRequestIsRejected)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4a0ac8b2-3fd1-4427-a9e7-2d81fef24193");
+    const IpcMessage oversizedRequest{std::string(RuntimeRequestChannelData::MAX_MESSAGE_SIZE, 'x')};
+    EXPECT_FALSE(runtimeSide.sendRequest(oversizedRequest));
+    EXPECT_FALSE(hasDoorbellRung());
+    EXPECT_TRUE(runtimeSide.sendRequest(request));
+}
+
+TEST_F(RuntimeRequestChannel_test, OversizedResponseUnblocksRuntimeWithEmptyResponse)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "751320e1-84b5-4756-bdb7-d2b47c4b15c1");
+    const IpcMessage oversizedResponse{std::string(RuntimeRequestChannelData::MAX_MESSAGE_SIZE, 'x')};
+    ASSERT_TRUE(runtimeSide.sendRequest(request));
+    ASSERT_TRUE(roudiSide.takeRequest().has_value());
+    EXPECT_FALSE(roudiSide.sendResponse(oversizedResponse));
+
+    IpcMessage receivedResponse;
+    ASSERT_TRUE(runtimeSide.waitForResponse(receivedResponse));
+    EXPECT_THAT(receivedResponse.getNumberOfElements(), Eq(0U));
+}
+
+TEST_F(RuntimeRequestChannel_test, WaitForResponseBlocksUntilResponseIsSent)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f154f0b9-ba56-4ee2-8822-635485108c22");
+    std::atomic_bool hasReceivedResponse{false};
+    IpcMessage receivedResponse;
+    ASSERT_TRUE(runtimeSide.sendRequest(request));
+
+    std::thread runtime([&] {
+        EXPECT_TRUE(runtimeSide.waitForResponse(receivedResponse));
+        hasReceivedResponse.store(true);
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_FALSE(hasReceivedResponse.load());
+    ASSERT_TRUE(roudiSide.takeRequest().has_value());
+    ASSERT_TRUE(roudiSide.sendResponse(response));
+    runtime.join();
+
+    EXPECT_TRUE(hasReceivedResponse.load());
+    EXPECT_THAT(receivedResponse.getMessage(), Eq(response.getMessage()));
+}
+
+} // namespace
@@ -58,9 +58,10 @@ class StubbedGatewayGeneric : public TestGatewayGeneric<channel_t>
 
     template <typename IceoryxPubSubOptions>
     iox::cxx::expected<channel_t, iox::gw::GatewayError> addChannel(const iox::capro::ServiceDescription& service,
-                                                                    const IceoryxPubSubOptions& options) noexcept
+                                                                    const IceoryxPubSubOptions& options,
+                                                                    const CodecType codec = CodecType::NONE) noexcept
     {
-        return TestGatewayGeneric<channel_t>::addChannel(service, options);
+        return TestGatewayGeneric<channel_t>::addChannel(service, options, codec);
     }
 
     iox::cxx::optional<channel_t> findChannel(const iox::capro::ServiceDescription& service) noexcept
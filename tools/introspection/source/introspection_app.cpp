@@ -272,16 +272,27 @@ void IntrospectionApp::printMemPoolInfo(const MemPoolIntrospectionInfo& introspe
     constexpr int32_t usedchunksWidth{14};
     constexpr int32_t numchunksWidth{9};
     constexpr int32_t minFreechunksWidth{9};
+    constexpr int32_t reservedChunksWidth{9};
+    constexpr int32_t rejectedChunkRequestsWidth{9};
+    constexpr int32_t reclaimedChunksWidth{9};
     constexpr int32_t chunkSizeWidth{11};
     constexpr int32_t chunkPayloadSizeWidth{13};
+    constexpr int32_t numaNodeWidth{5};
 
     wprintw(pad, "%*s |", memPoolWidth, "MemPool");
     wprintw(pad, "%*s |", usedchunksWidth, "Chunks In Use");
     wprintw(pad, "%*s |", numchunksWidth, "Total");
     wprintw(pad, "%*s |", minFreechunksWidth, "Min Free");
+    wprintw(pad, "%*s |", reservedChunksWidth, "Reserved");
+    wprintw(pad, "%*s |", rejectedChunkRequestsWidth, "Rejected");
+    wprintw(pad, "%*s |", reclaimedChunksWidth, "Reclaimed");
     wprintw(pad, "%*s |", chunkSizeWidth, "Chunk Size");
-    wprintw(pad, "%*s\n", chunkPayloadSizeWidth, "Chunk Payload Size");
-    wprintw(pad, "--------------------------------------------------------------------------------\n");
+    wprintw(pad, "%*s |", chunkPayloadSizeWidth, "Chunk Payload Size");
+    wprintw(pad, "%*s |", numaNodeWidth, "Node");
+    wprintw(pad, " %s\n", "Sampled Pages per NUMA Node");
+    wprintw(pad,
+            "--------------------------------------------------------------------------------"
+            "----------------------------------------------------------------------\n");
 
     for (size_t i = 0u; i < introspectionInfo.m_mempoolInfo.size(); ++i)
     {
@@ -292,8 +303,29 @@ void IntrospectionApp::printMemPoolInfo(const MemPoolIntrospectionInfo& introspe
             wprintw(pad, "%*d |", usedchunksWidth, info.m_usedChunks);
             wprintw(pad, "%*d |", numchunksWidth, info.m_numChunks);
             wprintw(pad, "%*d |", minFreechunksWidth, info.m_minFreeChunks);
+            wprintw(pad, "%*d |", reservedChunksWidth, info.m_reservedChunks);
+            wprintw(pad, "%*llu |",
+                    rejectedChunkRequestsWidth,
+                    static_cast<unsigned long long>(info.m_rejectedChunkRequests));
+            wprintw(pad, "%*llu |", reclaimedChunksWidth, static_cast<unsigned long long>(info.m_reclaimedChunks));
             wprintw(pad, "%*d |", chunkSizeWidth, info.m_chunkSize);
-            wprintw(pad, "%*d\n", chunkPayloadSizeWidth, info.m_chunkPayloadSize);
+            wprintw(pad, "%*d |", chunkPayloadSizeWidth, info.m_chunkPayloadSize);
+            if (info.m_numaNode == iox::NO_NUMA_NODE)
+            {
+                wprintw(pad, "%*s |", numaNodeWidth, "-");
+            }
+            else
+            {
+                wprintw(pad, "%*u |", numaNodeWidth, info.m_numaNode);
+            }
+            for (uint32_t node = 0U; node < iox::MAX_NUMBER_OF_NUMA_NODES; ++node)
+            {
+                if (info.m_sampledPagesPerNumaNode[node] > 0U)
+                {
+                    wprintw(pad, " %u:%u", node, info.m_sampledPagesPerNumaNode[node]);
+                }
+            }
+            wprintw(pad, "\n");
         }
     }
     wprintw(pad, "\n");
@@ -0,0 +1,67 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_TOOLS_MEMPOOL_ADVISOR_MEMPOOL_ADVISOR_HPP
+#define IOX_TOOLS_MEMPOOL_ADVISOR_MEMPOOL_ADVISOR_HPP
+
+#include "iceoryx_posh/internal/roudi/mempool_profile.hpp"
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace iox
+{
+namespace mempool_advisor
+{
+constexpr uint32_t DEFAULT_HEADROOM_IN_PERCENT{20U};
+
+struct MemPoolAdvice
+{
+    uint32_t m_size{0U};
+    uint32_t m_count{0U};
+};
+
+struct SegmentAdvice
+{
+    posix::PosixGroup::groupName_t m_writerGroup;
+    posix::PosixGroup::groupName_t m_readerGroup;
+    std::vector<MemPoolAdvice> m_mempools;
+    /// @brief explains the changes which cannot be derived from the profile with certainty
+    std::vector<std::string> m_notes;
+};
+
+/// @brief Derives a mempool configuration from the recorded usage of every segment
+///   - the chunk-payload size of a mempool is reduced to the largest size which was requested from it; since the
+///     sizes are recorded in a histogram this overestimates the size by at most 25%
+///   - the chunk count is the maximum number of simultaneously used chunks plus the failed allocations, increased by
+///     the headroom
+///   - mempools which were never used are removed
+///   - requests without a fitting mempool result in an additional mempool
+///   - segments without any request keep their configuration
+/// @param[in] profile the usage profile written by RouDi
+/// @param[in] headroomInPercent the additional chunks relative to the recorded usage
+std::vector<SegmentAdvice> advise(const roudi::SegmentProfiles_t& profile, const uint32_t headroomInPercent) noexcept;
+
+/// @brief writes the advice as RouDi config file in the TOML format
+void writeConfig(std::ostream& stream, const std::vector<SegmentAdvice>& advice) noexcept;
+
+} // namespace mempool_advisor
+} // namespace iox
+
+#endif // IOX_TOOLS_MEMPOOL_ADVISOR_MEMPOOL_ADVISOR_HPP
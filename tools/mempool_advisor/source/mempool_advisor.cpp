@@ -0,0 +1,198 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_mempool_advisor/mempool_advisor.hpp"
+#include "iceoryx_hoofs/cxx/algorithm.hpp"
+#include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/chunk_size_histogram.hpp"
+#include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+
+#include <limits>
+
+namespace iox
+{
+namespace mempool_advisor
+{
+namespace
+{
+using mepoo::ChunkSizeHistogram;
+using mepoo::MemPool;
+
+constexpr uint64_t MAX_CHUNK_PAYLOAD_SIZE{
+    (std::numeric_limits<uint32_t>::max() - sizeof(mepoo::ChunkHeader)) / MemPool::CHUNK_MEMORY_ALIGNMENT
+    * MemPool::CHUNK_MEMORY_ALIGNMENT};
+
+/// @brief the requests of a histogram bucket have a size in (lower bound, upper bound]
+uint64_t bucketLowerBound(const uint64_t upperBound) noexcept
+{
+    const auto bucket = ChunkSizeHistogram::bucketIndex(upperBound);
+    return (bucket == 0U) ? 0U : ChunkSizeHistogram::bucketUpperBound(bucket - 1U);
+}
+
+uint32_t alignedSize(const uint64_t size) noexcept
+{
+    const auto aligned =
+        cxx::align(algorithm::max(size, MemPool::CHUNK_MEMORY_ALIGNMENT), MemPool::CHUNK_MEMORY_ALIGNMENT);
+    return static_cast<uint32_t>(algorithm::min(aligned, MAX_CHUNK_PAYLOAD_SIZE));
+}
+
+uint32_t withHeadroom(const uint64_t numberOfChunks, const uint32_t headroomInPercent) noexcept
+{
+    const uint64_t count = (numberOfChunks * (100U + headroomInPercent) + 99U) / 100U;
+    return static_cast<uint32_t>(
+        algorithm::min(algorithm::max(count, uint64_t{1U}), uint64_t{std::numeric_limits<uint32_t>::max()}));
+}
+
+SegmentAdvice adviseSegment(const roudi::SegmentProfile& segment, const uint32_t headroomInPercent) noexcept
+{
+    SegmentAdvice advice;
+    advice.m_writerGroup = segment.m_writerGroup;
+    advice.m_readerGroup = segment.m_readerGroup;
+
+    if (segment.m_requests.empty())
+    {
+        for (const auto& mempool : segment.m_mempools)
+        {
+            advice.m_mempools.push_back({mempool.m_chunkPayloadSize, mempool.m_numberOfChunks});
+        }
+        advice.m_notes.emplace_back("the segment was not used, the configuration is unchanged");
+        return advice;
+    }
+
+    // a histogram bucket can span multiple mempools, the largest possible size is assigned to each of them
+    std::vector<uint64_t> maxRequestedSize(segment.m_mempools.size(), 0U);
+    uint64_t maxTooLargeSize{0U};
+    for (const auto& request : segment.m_requests)
+    {
+        const auto lowerBound = bucketLowerBound(request.m_maxChunkPayloadSize);
+        uint64_t previousSize{0U};
+        for (uint64_t i = 0U; i < segment.m_mempools.size(); ++i)
+        {
+            const uint64_t size = segment.m_mempools[i].m_chunkPayloadSize;
+            if (lowerBound < size && previousSize < request.m_maxChunkPayloadSize)
+            {
+                maxRequestedSize[i] = algorithm::max(maxRequestedSize[i],
+                                                     algorithm::min(request.m_maxChunkPayloadSize, size));
+            }
+            previousSize = size;
+        }
+        if (request.m_maxChunkPayloadSize > previousSize)
+        {
+            maxTooLargeSize = algorithm::max(maxTooLargeSize, request.m_maxChunkPayloadSize);
+        }
+    }
+
+    for (uint64_t i = 0U; i < segment.m_mempools.size(); ++i)
+    {
+        const auto& mempool = segment.m_mempools[i];
+        if (mempool.m_maxUsedChunks == 0U && mempool.m_allocationFailures == 0U)
+        {
+            continue;
+        }
+
+        const uint32_t size =
+            (maxRequestedSize[i] == 0U) ? mempool.m_chunkPayloadSize : alignedSize(maxRequestedSize[i]);
+        const uint32_t count = withHeadroom(mempool.m_maxUsedChunks + mempool.m_allocationFailures, headroomInPercent);
+        if (!advice.m_mempools.empty() && advice.m_mempools.back().m_size == size)
+        {
+            advice.m_mempools.back().m_count += count;
+        }
+        else
+        {
+            advice.m_mempools.push_back({size, count});
+        }
+
+        if (mempool.m_allocationFailures > 0U)
+        {
+            advice.m_notes.emplace_back("the mempool with size " + std::to_string(mempool.m_chunkPayloadSize)
+                                        + " ran out of chunks " + std::to_string(mempool.m_allocationFailures)
+                                        + " times, its chunk count is an estimate");
+        }
+    }
+
+    if (segment.m_tooLargeRequests > 0U && maxTooLargeSize > 0U)
+    {
+        // the simultaneous usage of these requests is unknown, the largest mempool is taken as reference
+        const uint64_t referenceCount =
+            segment.m_mempools.empty() ? 1U : segment.m_mempools.back().m_numberOfChunks;
+        const uint32_t size = alignedSize(maxTooLargeSize);
+        const uint32_t count =
+            withHeadroom(algorithm::min(segment.m_tooLargeRequests, referenceCount), headroomInPercent);
+        if (advice.m_mempools.size() < MAX_NUMBER_OF_MEMPOOLS)
+        {
+            advice.m_mempools.push_back({size, count});
+        }
+        else
+        {
+            advice.m_mempools.back().m_size = size;
+            advice.m_mempools.back().m_count += count;
+        }
+        advice.m_notes.emplace_back(std::to_string(segment.m_tooLargeRequests)
+                                    + " requests had no fitting mempool, the chunk count of the mempool with size "
+                                    + std::to_string(size) + " is an estimate");
+    }
+
+    if (advice.m_mempools.empty())
+    {
+        for (const auto& mempool : segment.m_mempools)
+        {
+            advice.m_mempools.push_back({mempool.m_chunkPayloadSize, mempool.m_numberOfChunks});
+        }
+        advice.m_notes.emplace_back("no chunk was in use, the configuration is unchanged");
+    }
+
+    return advice;
+}
+} // namespace
+
+std::vector<SegmentAdvice> advise(const roudi::SegmentProfiles_t& profile, const uint32_t headroomInPercent) noexcept
+{
+    std::vector<SegmentAdvice> advice;
+    for (const auto& segment : profile)
+    {
+        advice.push_back(adviseSegment(segment, headroomInPercent));
+    }
+    return advice;
+}
+
+void writeConfig(std::ostream& stream, const std::vector<SegmentAdvice>& advice) noexcept
+{
+    stream << "# generated by iox-mempool-advisor\n";
+    stream << "[general]\n";
+    stream << "version = 1\n";
+    for (const auto& segment : advice)
+    {
+        stream << "\n[[segment]]\n";
+        stream << "writer = \"" << segment.m_writerGroup << "\"\n";
+        stream << "reader = \"" << segment.m_readerGroup << "\"\n";
+        for (const auto& note : segment.m_notes)
+        {
+            stream << "# " << note << "\n";
+        }
+        for (const auto& mempool : segment.m_mempools)
+        {
+            stream << "\n[[segment.mempool]]\n";
+            stream << "size = " << mempool.m_size << "\n";
+            stream << "count = " << mempool.m_count << "\n";
+        }
+    }
+    stream.flush();
+}
+
+} // namespace mempool_advisor
+} // namespace iox
@@ -0,0 +1,141 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_hoofs/cxx/convert.hpp"
+#include "iceoryx_hoofs/platform/getopt.hpp"
+#include "iceoryx_mempool_advisor/mempool_advisor.hpp"
+
+#include <fstream>
+#include <iostream>
+
+namespace
+{
+void printHelp() noexcept
+{
+    std::cout << "Usage:\n"
+                 "  iox-mempool-advisor [OPTIONS] -p <profile>\n"
+                 "\nDerives a RouDi config from a mempool profile written by 'iox-roudi --mempool-profile <file>'.\n"
+                 "\nOptions:\n"
+                 "  -h, --help                  Display help and exit.\n"
+                 "  -p, --profile <file>        The mempool profile to process.\n"
+                 "  -o, --output <file>         The TOML config file to write [default: stdout]\n"
+                 "  -r, --headroom <percent>    Additional chunks relative to the recorded usage [default: "
+              << iox::mempool_advisor::DEFAULT_HEADROOM_IN_PERCENT << "]\n"
+              << std::endl;
+}
+
+const char* asStringLiteral(const iox::roudi::MemPoolProfileError error) noexcept
+{
+    switch (error)
+    {
+    case iox::roudi::MemPoolProfileError::INVALID_HEADER:
+        return "invalid header";
+    case iox::roudi::MemPoolProfileError::INCOMPATIBLE_VERSION:
+        return "incompatible version";
+    case iox::roudi::MemPoolProfileError::INVALID_LINE:
+        return "invalid line";
+    case iox::roudi::MemPoolProfileError::ENTRY_WITHOUT_SEGMENT:
+        return "entry without segment";
+    }
+    return "unknown error";
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    constexpr option LONG_OPTIONS[] = {{"help", no_argument, nullptr, 'h'},
+                                       {"profile", required_argument, nullptr, 'p'},
+                                       {"output", required_argument, nullptr, 'o'},
+                                       {"headroom", required_argument, nullptr, 'r'},
+                                       {nullptr, 0, nullptr, 0}};
+    constexpr const char SHORT_OPTIONS[] = "hp:o:r:";
+
+    std::string profilePath;
+    std::string outputPath;
+    uint32_t headroomInPercent{iox::mempool_advisor::DEFAULT_HEADROOM_IN_PERCENT};
+
+    int32_t opt{0};
+    int32_t index{0};
+    while ((opt = getopt_long(argc, argv, SHORT_OPTIONS, LONG_OPTIONS, &index)) != -1)
+    {
+        switch (opt)
+        {
+        case 'h':
+            printHelp();
+            return EXIT_SUCCESS;
+        case 'p':
+            profilePath = optarg;
+            break;
+        case 'o':
+            outputPath = optarg;
+            break;
+        case 'r':
+        {
+            constexpr uint32_t MAX_HEADROOM_IN_PERCENT{1000U};
+            if (!iox::cxx::convert::fromString(optarg, headroomInPercent)
+                || headroomInPercent > MAX_HEADROOM_IN_PERCENT)
+            {
+                std::cerr << "Invalid headroom, it must be in the range of [0, " << MAX_HEADROOM_IN_PERCENT << "]"
+                          << std::endl;
+                return EXIT_FAILURE;
+            }
+            break;
+        }
+        default:
+            printHelp();
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (profilePath.empty())
+    {
+        std::cerr << "A mempool profile has to be provided." << std::endl;
+        printHelp();
+        return EXIT_FAILURE;
+    }
+
+    std::ifstream profileFile(profilePath);
+    if (!profileFile)
+    {
+        std::cerr << "Unable to open the mempool profile '" << profilePath << "'" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    auto profile = iox::roudi::readMemPoolProfile(profileFile);
+    if (profile.has_error())
+    {
+        std::cerr << "Unable to read the mempool profile '" << profilePath
+                  << "': " << asStringLiteral(profile.get_error()) << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const auto advice = iox::mempool_advisor::advise(profile.value(), headroomInPercent);
+    if (outputPath.empty())
+    {
+        iox::mempool_advisor::writeConfig(std::cout, advice);
+        return EXIT_SUCCESS;
+    }
+
+    std::ofstream outputFile(outputPath);
+    if (!outputFile)
+    {
+        std::cerr << "Unable to write the config to '" << outputPath << "'" << std::endl;
+        return EXIT_FAILURE;
+    }
+    iox::mempool_advisor::writeConfig(outputFile, advice);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,121 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_TOOLS_RECORD_REPLAY_RECORD_FORMAT_HPP
+#define IOX_TOOLS_RECORD_REPLAY_RECORD_FORMAT_HPP
+
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace record_replay
+{
+/// @brief The on-disk layout of a recording. A recording is a directory with a sequence of segment files
+/// ("segment-<n>.iox") and the corresponding index files ("segment-<n>.idx"). Both are memory-mapped and only appended
+/// to, therefore storing a chunk is a plain memcpy without any syscall.
+///
+/// segment file: | SegmentHeader | RecordEntry | raw chunk | padding | RecordEntry | raw chunk | padding | ...
+/// index file:   | IndexHeader | IndexEntry | IndexEntry | ...
+///
+/// The raw chunk is a copy of the chunk starting at the ChunkHeader, including the user-header and the user-payload.
+/// With a limit on the number of segments the files form a ring, segment n is stored in the file with the number
+/// n % maxNumberOfSegments and overwrites the oldest segment. The reader starts with the lowest segment number found.
+/// @note the m_chunkHeaderVersion of the recorded ChunkHeader is used to detect incompatible recordings
+
+constexpr uint64_t SEGMENT_FILE_MAGIC{0x004745535f584f49U}; // "IOX_SEG"
+constexpr uint64_t INDEX_FILE_MAGIC{0x005844495f584f49U}; // "IOX_IDX"
+constexpr uint32_t RECORD_FORMAT_VERSION{1U};
+constexpr uint32_t MAX_RECORDED_TOPICS{64U};
+constexpr uint64_t RECORD_ALIGNMENT{alignof(mepoo::ChunkHeader)};
+constexpr uint64_t DEFAULT_SEGMENT_SIZE{1024U * 1024U * 1024U};
+constexpr uint64_t MIN_SEGMENT_SIZE{1024U * 1024U};
+/// @brief 0 means that the number of segments is not limited
+constexpr uint32_t UNLIMITED_SEGMENTS{0U};
+constexpr uint32_t DEFAULT_MAX_NUMBER_OF_SEGMENTS{16U};
+
+constexpr const char SEGMENT_FILE_PREFIX[] = "segment-";
+constexpr const char SEGMENT_FILE_SUFFIX[] = ".iox";
+constexpr const char INDEX_FILE_SUFFIX[] = ".idx";
+
+/// @brief The service description of a recorded topic; plain char arrays are used to have a well defined layout
+struct RecordedTopic
+{
+    static constexpr uint64_t ID_STRING_SIZE{capro::IdString_t::capacity() + 1U};
+
+    char m_service[ID_STRING_SIZE]{};
+    char m_instance[ID_STRING_SIZE]{};
+    char m_event[ID_STRING_SIZE]{};
+};
+
+struct SegmentHeader
+{
+    uint64_t m_magic{SEGMENT_FILE_MAGIC};
+    uint32_t m_formatVersion{RECORD_FORMAT_VERSION};
+    uint8_t m_chunkHeaderVersion{mepoo::ChunkHeader::CHUNK_HEADER_VERSION};
+    uint8_t m_reserved[3]{};
+    /// @brief the number of the segment within the recording, starting with 0
+    uint64_t m_segmentNumber{0U};
+    /// @brief the size of the file
+    uint64_t m_capacity{0U};
+    /// @brief end of the last completely written record; everything behind this offset is invalid
+    uint64_t m_writePosition{0U};
+    uint32_t m_numberOfTopics{0U};
+    /// @brief number of segment files in the ring or UNLIMITED_SEGMENTS
+    uint32_t m_maxNumberOfSegments{UNLIMITED_SEGMENTS};
+    RecordedTopic m_topics[MAX_RECORDED_TOPICS];
+};
+
+struct RecordEntry
+{
+    /// @brief time when the chunk was received by the recorder, in nanoseconds since epoch
+    uint64_t m_timestamp{0U};
+    /// @brief sequence number of the chunk assigned by the publisher
+    uint64_t m_sequenceNumber{0U};
+    /// @brief index into SegmentHeader::m_topics
+    uint32_t m_topicIndex{0U};
+    /// @brief number of chunk bytes following this entry, without padding
+    uint32_t m_chunkSize{0U};
+};
+
+struct IndexHeader
+{
+    uint64_t m_magic{INDEX_FILE_MAGIC};
+    uint32_t m_formatVersion{RECORD_FORMAT_VERSION};
+    uint32_t m_reserved{0U};
+    uint64_t m_capacity{0U};
+    uint64_t m_numberOfEntries{0U};
+};
+
+struct IndexEntry
+{
+    uint64_t m_timestamp{0U};
+    uint64_t m_sequenceNumber{0U};
+    /// @brief offset of the RecordEntry in the segment file
+    uint64_t m_offset{0U};
+    uint32_t m_topicIndex{0U};
+    uint32_t m_reserved{0U};
+};
+
+static_assert(sizeof(SegmentHeader) % RECORD_ALIGNMENT == 0U, "SegmentHeader must keep the records aligned");
+static_assert(sizeof(RecordEntry) % RECORD_ALIGNMENT == 0U, "RecordEntry must keep the chunks aligned");
+
+} // namespace record_replay
+} // namespace iox
+
+#endif // IOX_TOOLS_RECORD_REPLAY_RECORD_FORMAT_HPP
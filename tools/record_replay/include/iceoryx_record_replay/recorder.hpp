@@ -0,0 +1,73 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_TOOLS_RECORD_REPLAY_RECORDER_HPP
+#define IOX_TOOLS_RECORD_REPLAY_RECORDER_HPP
+
+#include "iceoryx_hoofs/cxx/vector.hpp"
+#include "iceoryx_posh/popo/untyped_subscriber.hpp"
+#include "iceoryx_posh/popo/wait_set.hpp"
+#include "iceoryx_record_replay/segment_file.hpp"
+
+#include <atomic>
+#include <string>
+
+namespace iox
+{
+namespace record_replay
+{
+/// @brief Subscribes to a list of topics and copies every received chunk, including the ChunkHeader and the
+/// user-header, into a RecordingWriter. The chunks are released right after they are copied, therefore the recorder
+/// holds at most one chunk per topic at a time.
+class Recorder
+{
+  public:
+    static constexpr char NODE_NAME[] = "iox-record";
+
+    Recorder(const TopicList_t& topics,
+             const std::string& directory,
+             const uint64_t segmentSize,
+             const uint32_t maxNumberOfSegments) noexcept;
+
+    Recorder(const Recorder&) = delete;
+    Recorder(Recorder&&) = delete;
+    Recorder& operator=(const Recorder&) = delete;
+    Recorder& operator=(Recorder&&) = delete;
+    ~Recorder() = default;
+
+    /// @brief records until stop is called or an error occurs
+    /// @return error which terminated the recording
+    cxx::expected<RecordError> run() noexcept;
+
+    /// @brief stops the recording; can be called from a signal handler
+    void stop() noexcept;
+
+    uint64_t numberOfRecordedChunks() const noexcept;
+
+  private:
+    cxx::expected<RecordError> drain(const uint32_t topicIndex) noexcept;
+
+  private:
+    std::atomic_bool m_keepRunning{true};
+    cxx::vector<popo::UntypedSubscriber, MAX_RECORDED_TOPICS> m_subscribers;
+    popo::WaitSet<MAX_RECORDED_TOPICS> m_waitset;
+    RecordingWriter m_writer;
+};
+
+} // namespace record_replay
+} // namespace iox
+
+#endif // IOX_TOOLS_RECORD_REPLAY_RECORDER_HPP
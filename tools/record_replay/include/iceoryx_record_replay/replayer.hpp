@@ -0,0 +1,93 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_TOOLS_RECORD_REPLAY_REPLAYER_HPP
+#define IOX_TOOLS_RECORD_REPLAY_REPLAYER_HPP
+
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/cxx/vector.hpp"
+#include "iceoryx_hoofs/posix_wrapper/unnamed_semaphore.hpp"
+#include "iceoryx_posh/popo/untyped_publisher.hpp"
+#include "iceoryx_record_replay/segment_file.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <string>
+
+namespace iox
+{
+namespace record_replay
+{
+struct ReplayOptions
+{
+    /// @brief the recorded time between two chunks is divided by this factor; ignored when maxSpeed is set
+    double speedFactor{1.0};
+
+    /// @brief publish the chunks as fast as possible without preserving the recorded timing
+    bool maxSpeed{false};
+
+    /// @brief time to wait after the publishers are offered to give the subscribers a chance to connect
+    std::chrono::milliseconds startupDelay{500};
+};
+
+/// @brief Republishes a recording. For every recorded topic an UntypedPublisher is created and each recorded chunk is
+/// copied into a newly loaned chunk with the same user-header and user-payload layout.
+/// @note the sequence numbers and the origin ids are assigned by the new publishers and do not match the recording
+class Replayer
+{
+  public:
+    static constexpr char NODE_NAME[] = "iox-replay";
+
+    Replayer(const std::string& directory, const ReplayOptions& options) noexcept;
+
+    Replayer(const Replayer&) = delete;
+    Replayer(Replayer&&) = delete;
+    Replayer& operator=(const Replayer&) = delete;
+    Replayer& operator=(Replayer&&) = delete;
+    ~Replayer() = default;
+
+    /// @brief replays the whole recording or until stop is called
+    cxx::expected<RecordError> run() noexcept;
+
+    /// @brief stops the replay, a run which waits for the publish time of the next chunk returns immediately; can be
+    /// called from a signal handler
+    void stop() noexcept;
+
+    uint64_t numberOfReplayedChunks() const noexcept;
+
+  private:
+    void publish(const RecordedChunk& chunk) noexcept;
+    /// @brief waits until the publish time of the chunk or until stop is called
+    void waitUntilPublishTime(const uint64_t timestamp) noexcept;
+    /// @brief waits until the deadline or until stop is called
+    void waitUntil(const std::chrono::steady_clock::time_point deadline) noexcept;
+
+  private:
+    std::atomic_bool m_keepRunning{true};
+    /// @brief posted by stop, sem_post is async-signal-safe in contrast to a condition variable
+    cxx::optional<posix::UnnamedSemaphore> m_stopSemaphore;
+    ReplayOptions m_options;
+    RecordingReader m_reader;
+    cxx::vector<popo::UntypedPublisher, MAX_RECORDED_TOPICS> m_publishers;
+    uint64_t m_firstTimestamp{0U};
+    std::chrono::steady_clock::time_point m_startTime;
+    uint64_t m_numberOfReplayedChunks{0U};
+};
+
+} // namespace record_replay
+} // namespace iox
+
+#endif // IOX_TOOLS_RECORD_REPLAY_REPLAYER_HPP
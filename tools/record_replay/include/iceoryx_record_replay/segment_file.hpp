@@ -0,0 +1,180 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_TOOLS_RECORD_REPLAY_SEGMENT_FILE_HPP
+#define IOX_TOOLS_RECORD_REPLAY_SEGMENT_FILE_HPP
+
+#include "iceoryx_hoofs/cxx/expected.hpp"
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/cxx/vector.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/memory_map.hpp"
+#include "iceoryx_record_replay/record_format.hpp"
+
+#include <string>
+
+namespace iox
+{
+namespace record_replay
+{
+enum class RecordError
+{
+    UNABLE_TO_OPEN_FILE,
+    UNABLE_TO_RESIZE_FILE,
+    UNABLE_TO_MAP_FILE,
+    INVALID_FILE,
+    INCOMPATIBLE_FORMAT_VERSION,
+    INCOMPATIBLE_CHUNK_HEADER_VERSION,
+    TOO_MANY_TOPICS,
+    CHUNK_TOO_LARGE,
+    MULTI_CHUNK_SAMPLE,
+    END_OF_RECORDING
+};
+
+const char* asStringLiteral(const RecordError error) noexcept;
+
+using TopicList_t = cxx::vector<capro::ServiceDescription, MAX_RECORDED_TOPICS>;
+
+/// @brief a file which is mapped into the process space and closed when the object goes out of scope
+class MappedFile
+{
+  public:
+    /// @brief opens or creates the file and maps it
+    /// @param[in] path of the file
+    /// @param[in] accessMode READ_WRITE creates/truncates the file to size, READ_ONLY maps the whole existing file
+    /// @param[in] size of the file when it is created, ignored for READ_ONLY
+    static cxx::expected<MappedFile, RecordError>
+    open(const std::string& path, const posix::AccessMode accessMode, const uint64_t size) noexcept;
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& rhs) noexcept;
+    MappedFile& operator=(MappedFile&& rhs) noexcept;
+    ~MappedFile() noexcept;
+
+    void* data() noexcept;
+    const void* data() const noexcept;
+    uint64_t size() const noexcept;
+
+    /// @brief unmaps the file and shrinks it to the provided size
+    void close(const uint64_t finalSize) noexcept;
+
+  private:
+    MappedFile(const int32_t fileDescriptor, const uint64_t size, posix::MemoryMap&& memoryMap) noexcept;
+    void destroy() noexcept;
+
+    int32_t m_fileDescriptor{-1};
+    uint64_t m_size{0U};
+    cxx::optional<posix::MemoryMap> m_memoryMap;
+};
+
+/// @brief Appends chunks to a recording. The segment file is preallocated and mapped once, storing a chunk is a copy
+/// into the mapping. When a segment is full the next one is started. When maxNumberOfSegments is reached the next
+/// segment replaces the oldest one, so the recording keeps at most maxNumberOfSegments * segmentSize bytes on disk.
+class RecordingWriter
+{
+  public:
+    RecordingWriter(const std::string& directory,
+                    const uint64_t segmentSize,
+                    const uint32_t maxNumberOfSegments,
+                    const TopicList_t& topics) noexcept;
+
+    RecordingWriter(const RecordingWriter&) = delete;
+    RecordingWriter(RecordingWriter&&) = delete;
+    RecordingWriter& operator=(const RecordingWriter&) = delete;
+    RecordingWriter& operator=(RecordingWriter&&) = delete;
+    ~RecordingWriter() noexcept;
+
+    /// @brief copies the chunk into the recording
+    /// @param[in] topicIndex index of the topic in the topic list provided in the constructor
+    /// @param[in] chunkHeader of the chunk to record
+    /// @param[in] timestamp in nanoseconds since epoch
+    /// @return RecordError::MULTI_CHUNK_SAMPLE for the head chunk of a multi-chunk sample, its parts are not part of
+    /// the chunk and cannot be recorded
+    cxx::expected<RecordError>
+    append(const uint32_t topicIndex, const mepoo::ChunkHeader* const chunkHeader, const uint64_t timestamp) noexcept;
+
+    /// @brief finishes the current segment and shrinks the files to the written size
+    void close() noexcept;
+
+    uint64_t numberOfRecordedChunks() const noexcept;
+
+  private:
+    cxx::expected<RecordError> openSegment(const uint64_t segmentNumber) noexcept;
+    void closeSegment() noexcept;
+    SegmentHeader* segmentHeader() noexcept;
+    IndexHeader* indexHeader() noexcept;
+
+  private:
+    std::string m_directory;
+    uint64_t m_segmentSize{DEFAULT_SEGMENT_SIZE};
+    uint32_t m_maxNumberOfSegments{UNLIMITED_SEGMENTS};
+    TopicList_t m_topics;
+    cxx::optional<MappedFile> m_segment;
+    cxx::optional<MappedFile> m_index;
+    uint64_t m_nextSegmentNumber{0U};
+    uint64_t m_numberOfRecordedChunks{0U};
+};
+
+/// @brief a recorded chunk as it is stored in a segment file
+struct RecordedChunk
+{
+    const RecordEntry* entry{nullptr};
+    const mepoo::ChunkHeader* chunkHeader{nullptr};
+};
+
+/// @brief Reads the segments of a recording in order
+class RecordingReader
+{
+  public:
+    explicit RecordingReader(const std::string& directory) noexcept;
+
+    /// @brief opens the oldest segment of the recording
+    cxx::expected<RecordError> open() noexcept;
+
+    /// @brief returns the topics of the recording; valid after a successful open
+    const TopicList_t& topics() const noexcept;
+
+    /// @brief returns the next chunk of the recording, the pointers are valid until the next call
+    /// @return RecordError::END_OF_RECORDING when all segments are read, RecordError::MULTI_CHUNK_SAMPLE when the
+    /// recorded chunk is the head chunk of a multi-chunk sample; it is skipped and the next call continues behind it
+    cxx::expected<RecordedChunk, RecordError> next() noexcept;
+
+  private:
+    static cxx::expected<MappedFile, RecordError> openSegmentFile(const std::string& directory,
+                                                                  const uint64_t fileNumber) noexcept;
+    cxx::expected<RecordError> openSegment(const uint64_t segmentNumber) noexcept;
+    const SegmentHeader* segmentHeader() const noexcept;
+
+  private:
+    std::string m_directory;
+    TopicList_t m_topics;
+    cxx::optional<MappedFile> m_segment;
+    uint32_t m_maxNumberOfSegments{UNLIMITED_SEGMENTS};
+    uint64_t m_segmentNumber{0U};
+    uint64_t m_readPosition{0U};
+};
+
+/// @brief returns the path of the segment or index file with the given file number
+std::string segmentFilePath(const std::string& directory, const uint64_t fileNumber) noexcept;
+std::string indexFilePath(const std::string& directory, const uint64_t fileNumber) noexcept;
+
+/// @brief returns the number of the file in which a segment is stored
+uint64_t segmentFileNumber(const uint64_t segmentNumber, const uint32_t maxNumberOfSegments) noexcept;
+
+} // namespace record_replay
+} // namespace iox
+
+#endif // IOX_TOOLS_RECORD_REPLAY_SEGMENT_FILE_HPP
@@ -0,0 +1,165 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/cxx/convert.hpp"
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/platform/getopt.hpp"
+#include "iceoryx_hoofs/posix_wrapper/signal_handler.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iceoryx_record_replay/recorder.hpp"
+
+#include <iostream>
+
+namespace
+{
+iox::cxx::optional<iox::record_replay::Recorder> recorder;
+
+void sigHandler(int sig IOX_MAYBE_UNUSED)
+{
+    if (recorder)
+    {
+        recorder->stop();
+    }
+}
+
+void printHelp() noexcept
+{
+    std::cout << "Usage:\n"
+                 "  iox-record [OPTIONS] -t <Service/Instance/Event> [-t ...]\n"
+                 "\nOptions:\n"
+                 "  -h, --help                  Display help and exit.\n"
+                 "  -t, --topic <S/I/E>         Topic to record, can be provided up to "
+              << iox::record_replay::MAX_RECORDED_TOPICS
+              << " times.\n"
+                 "  -o, --output <dir>          Existing directory for the recording [default: .]\n"
+                 "  -s, --segment-size <MiB>    Size of a segment file before the next one is started [default: "
+              << iox::record_replay::DEFAULT_SEGMENT_SIZE / (1024U * 1024U)
+              << "]\n"
+                 "  -m, --max-segments <N>      Number of segments after which the oldest one is overwritten,\n"
+                 "                              0 keeps all segments [default: "
+              << iox::record_replay::DEFAULT_MAX_NUMBER_OF_SEGMENTS << "]\n"
+              << std::endl;
+}
+
+iox::cxx::optional<iox::capro::ServiceDescription> parseTopic(const std::string& topic) noexcept
+{
+    const auto firstSeparator = topic.find('/');
+    const auto secondSeparator = topic.find('/', firstSeparator + 1U);
+    if (firstSeparator == std::string::npos || secondSeparator == std::string::npos
+        || topic.find('/', secondSeparator + 1U) != std::string::npos)
+    {
+        return iox::cxx::nullopt;
+    }
+
+    using iox::capro::IdString_t;
+    return iox::capro::ServiceDescription(
+        IdString_t(iox::cxx::TruncateToCapacity, topic.substr(0U, firstSeparator)),
+        IdString_t(iox::cxx::TruncateToCapacity,
+                   topic.substr(firstSeparator + 1U, secondSeparator - firstSeparator - 1U)),
+        IdString_t(iox::cxx::TruncateToCapacity, topic.substr(secondSeparator + 1U)));
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    constexpr option LONG_OPTIONS[] = {{"help", no_argument, nullptr, 'h'},
+                                       {"topic", required_argument, nullptr, 't'},
+                                       {"output", required_argument, nullptr, 'o'},
+                                       {"segment-size", required_argument, nullptr, 's'},
+                                       {"max-segments", required_argument, nullptr, 'm'},
+                                       {nullptr, 0, nullptr, 0}};
+    constexpr const char SHORT_OPTIONS[] = "ht:o:s:m:";
+
+    iox::record_replay::TopicList_t topics;
+    std::string directory{"."};
+    uint64_t segmentSize{iox::record_replay::DEFAULT_SEGMENT_SIZE};
+    uint32_t maxNumberOfSegments{iox::record_replay::DEFAULT_MAX_NUMBER_OF_SEGMENTS};
+
+    int32_t opt{0};
+    int32_t index{0};
+    while ((opt = getopt_long(argc, argv, SHORT_OPTIONS, LONG_OPTIONS, &index)) != -1)
+    {
+        switch (opt)
+        {
+        case 'h':
+            printHelp();
+            return EXIT_SUCCESS;
+        case 't':
+        {
+            auto topic = parseTopic(optarg);
+            if (!topic || topics.size() == topics.capacity())
+            {
+                std::cerr << "Invalid or too many topics: '" << optarg << "'" << std::endl;
+                return EXIT_FAILURE;
+            }
+            topics.emplace_back(topic.value());
+            break;
+        }
+        case 'o':
+            directory = optarg;
+            break;
+        case 's':
+        {
+            uint64_t segmentSizeInMiB{0U};
+            if (!iox::cxx::convert::fromString(optarg, segmentSizeInMiB) || segmentSizeInMiB == 0U)
+            {
+                std::cerr << "Invalid segment size: '" << optarg << "'" << std::endl;
+                return EXIT_FAILURE;
+            }
+            segmentSize = segmentSizeInMiB * 1024U * 1024U;
+            break;
+        }
+        case 'm':
+            if (!iox::cxx::convert::fromString(optarg, maxNumberOfSegments))
+            {
+                std::cerr << "Invalid number of segments: '" << optarg << "'" << std::endl;
+                return EXIT_FAILURE;
+            }
+            break;
+        default:
+            printHelp();
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (topics.empty())
+    {
+        std::cerr << "At least one topic has to be provided." << std::endl;
+        printHelp();
+        return EXIT_FAILURE;
+    }
+
+    iox::runtime::PoshRuntime::initRuntime(iox::record_replay::Recorder::NODE_NAME);
+
+    recorder.emplace(topics, directory, segmentSize, maxNumberOfSegments);
+
+    auto signalGuard =
+        iox::posix::registerSignalHandler(iox::posix::Signal::INT, sigHandler).expect("failed to register SIGINT");
+    auto signalTermGuard =
+        iox::posix::registerSignalHandler(iox::posix::Signal::TERM, sigHandler).expect("failed to register SIGTERM");
+
+    auto result = recorder->run();
+    std::cout << "recorded " << recorder->numberOfRecordedChunks() << " chunks to '" << directory << "'" << std::endl;
+    recorder.reset();
+
+    if (result.has_error())
+    {
+        std::cerr << "recording failed: " << iox::record_replay::asStringLiteral(result.get_error()) << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,119 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_record_replay/recorder.hpp"
+
+#include <chrono>
+#include <iostream>
+
+namespace iox
+{
+namespace record_replay
+{
+constexpr char Recorder::NODE_NAME[];
+
+Recorder::Recorder(const TopicList_t& topics,
+                   const std::string& directory,
+                   const uint64_t segmentSize,
+                   const uint32_t maxNumberOfSegments) noexcept
+    : m_writer(directory, segmentSize, maxNumberOfSegments, topics)
+{
+    popo::SubscriberOptions options;
+    options.queueCapacity = MAX_SUBSCRIBER_QUEUE_CAPACITY;
+    options.nodeName = NodeName_t(cxx::TruncateToCapacity, NODE_NAME);
+
+    for (uint32_t i = 0U; i < topics.size(); ++i)
+    {
+        m_subscribers.emplace_back(topics[i], options);
+        m_waitset.attachState(m_subscribers.back(), popo::SubscriberState::HAS_DATA, i).or_else([](auto) {
+            std::cerr << "failed to attach subscriber to the recorder" << std::endl;
+            std::exit(EXIT_FAILURE);
+        });
+    }
+}
+
+cxx::expected<RecordError> Recorder::run() noexcept
+{
+    while (m_keepRunning)
+    {
+        auto notificationVector = m_waitset.wait();
+        for (auto& notification : notificationVector)
+        {
+            auto result = drain(static_cast<uint32_t>(notification->getNotificationId()));
+            if (result.has_error())
+            {
+                return result;
+            }
+        }
+    }
+
+    m_writer.close();
+    return cxx::success<>();
+}
+
+cxx::expected<RecordError> Recorder::drain(const uint32_t topicIndex) noexcept
+{
+    auto& subscriber = m_subscribers[topicIndex];
+    while (true)
+    {
+        auto takeResult = subscriber.take();
+        if (takeResult.has_error())
+        {
+            if (takeResult.get_error() != popo::ChunkReceiveResult::NO_CHUNK_AVAILABLE)
+            {
+                std::cerr << "failed to take chunk for topic " << topicIndex << std::endl;
+            }
+            return cxx::success<>();
+        }
+
+        const void* userPayload = takeResult.value();
+        const auto timestamp = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch())
+                .count());
+        auto appendResult = m_writer.append(topicIndex, mepoo::ChunkHeader::fromUserPayload(userPayload), timestamp);
+        subscriber.release(userPayload);
+
+        if (appendResult.has_error())
+        {
+            if (appendResult.get_error() == RecordError::CHUNK_TOO_LARGE)
+            {
+                std::cerr << "chunk of topic " << topicIndex << " exceeds the segment size and is skipped" << std::endl;
+                continue;
+            }
+            if (appendResult.get_error() == RecordError::MULTI_CHUNK_SAMPLE)
+            {
+                std::cerr << "multi-chunk sample of topic " << topicIndex << " is not supported and skipped"
+                          << std::endl;
+                continue;
+            }
+            return appendResult;
+        }
+    }
+}
+
+void Recorder::stop() noexcept
+{
+    m_keepRunning = false;
+    m_waitset.markForDestruction();
+}
+
+uint64_t Recorder::numberOfRecordedChunks() const noexcept
+{
+    return m_writer.numberOfRecordedChunks();
+}
+
+} // namespace record_replay
+} // namespace iox
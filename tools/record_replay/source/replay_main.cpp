@@ -0,0 +1,124 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/cxx/convert.hpp"
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/platform/getopt.hpp"
+#include "iceoryx_hoofs/posix_wrapper/signal_handler.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iceoryx_record_replay/replayer.hpp"
+
+#include <iostream>
+
+namespace
+{
+iox::cxx::optional<iox::record_replay::Replayer> replayer;
+
+void sigHandler(int sig IOX_MAYBE_UNUSED)
+{
+    if (replayer)
+    {
+        replayer->stop();
+    }
+}
+
+void printHelp() noexcept
+{
+    std::cout << "Usage:\n"
+                 "  iox-replay [OPTIONS]\n"
+                 "\nOptions:\n"
+                 "  -h, --help                  Display help and exit.\n"
+                 "  -i, --input <dir>           Directory of the recording [default: .]\n"
+                 "  -s, --speed <factor>        Replay speed relative to the recording [default: 1.0]\n"
+                 "  -m, --max-speed             Publish as fast as possible, ignoring the recorded timing.\n"
+                 "  -d, --delay <ms>            Time to wait for subscribers before the replay starts [default: 500]\n"
+              << std::endl;
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    constexpr option LONG_OPTIONS[] = {{"help", no_argument, nullptr, 'h'},
+                                       {"input", required_argument, nullptr, 'i'},
+                                       {"speed", required_argument, nullptr, 's'},
+                                       {"max-speed", no_argument, nullptr, 'm'},
+                                       {"delay", required_argument, nullptr, 'd'},
+                                       {nullptr, 0, nullptr, 0}};
+    constexpr const char SHORT_OPTIONS[] = "hi:s:md:";
+
+    std::string directory{"."};
+    iox::record_replay::ReplayOptions options;
+
+    int32_t opt{0};
+    int32_t index{0};
+    while ((opt = getopt_long(argc, argv, SHORT_OPTIONS, LONG_OPTIONS, &index)) != -1)
+    {
+        switch (opt)
+        {
+        case 'h':
+            printHelp();
+            return EXIT_SUCCESS;
+        case 'i':
+            directory = optarg;
+            break;
+        case 's':
+            if (!iox::cxx::convert::fromString(optarg, options.speedFactor) || options.speedFactor <= 0.0)
+            {
+                std::cerr << "Invalid speed factor: '" << optarg << "'" << std::endl;
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'm':
+            options.maxSpeed = true;
+            break;
+        case 'd':
+        {
+            uint64_t delayInMs{0U};
+            if (!iox::cxx::convert::fromString(optarg, delayInMs))
+            {
+                std::cerr << "Invalid delay: '" << optarg << "'" << std::endl;
+                return EXIT_FAILURE;
+            }
+            options.startupDelay = std::chrono::milliseconds(delayInMs);
+            break;
+        }
+        default:
+            printHelp();
+            return EXIT_FAILURE;
+        }
+    }
+
+    iox::runtime::PoshRuntime::initRuntime(iox::record_replay::Replayer::NODE_NAME);
+
+    replayer.emplace(directory, options);
+
+    auto signalGuard =
+        iox::posix::registerSignalHandler(iox::posix::Signal::INT, sigHandler).expect("failed to register SIGINT");
+    auto signalTermGuard =
+        iox::posix::registerSignalHandler(iox::posix::Signal::TERM, sigHandler).expect("failed to register SIGTERM");
+
+    auto result = replayer->run();
+    std::cout << "replayed " << replayer->numberOfReplayedChunks() << " chunks from '" << directory << "'" << std::endl;
+    replayer.reset();
+
+    if (result.has_error())
+    {
+        std::cerr << "replay failed: " << iox::record_replay::asStringLiteral(result.get_error()) << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
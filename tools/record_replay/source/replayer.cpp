@@ -0,0 +1,176 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_record_replay/replayer.hpp"
+#include "iceoryx_hoofs/cxx/attributes.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+namespace iox
+{
+namespace record_replay
+{
+namespace
+{
+/// @brief the user-header alignment is not part of the ChunkHeader; since the user-header is placed directly after the
+/// ChunkHeader and its size is a multiple of its alignment, the largest fitting power of two is a valid choice
+uint32_t userHeaderAlignment(const uint32_t userHeaderSize) noexcept
+{
+    uint32_t alignment{static_cast<uint32_t>(alignof(mepoo::ChunkHeader))};
+    while (alignment > 1U && (userHeaderSize % alignment) != 0U)
+    {
+        alignment /= 2U;
+    }
+    return alignment;
+}
+} // namespace
+
+constexpr char Replayer::NODE_NAME[];
+
+Replayer::Replayer(const std::string& directory, const ReplayOptions& options) noexcept
+    : m_options(options)
+    , m_reader(directory)
+{
+    posix::UnnamedSemaphoreBuilder().initialValue(0U).isInterProcessCapable(false).create(m_stopSemaphore).or_else(
+        [](auto) {
+            std::cerr << "unable to create the stop semaphore of the replayer" << std::endl;
+            std::exit(EXIT_FAILURE);
+        });
+}
+
+cxx::expected<RecordError> Replayer::run() noexcept
+{
+    auto openResult = m_reader.open();
+    if (openResult.has_error())
+    {
+        return openResult;
+    }
+
+    popo::PublisherOptions publisherOptions;
+    publisherOptions.nodeName = NodeName_t(cxx::TruncateToCapacity, NODE_NAME);
+    for (const auto& topic : m_reader.topics())
+    {
+        m_publishers.emplace_back(topic, publisherOptions);
+    }
+    waitUntil(std::chrono::steady_clock::now() + m_options.startupDelay);
+
+    bool isFirstChunk{true};
+    while (m_keepRunning)
+    {
+        auto chunk = m_reader.next();
+        if (chunk.has_error())
+        {
+            if (chunk.get_error() == RecordError::END_OF_RECORDING)
+            {
+                break;
+            }
+            if (chunk.get_error() == RecordError::MULTI_CHUNK_SAMPLE)
+            {
+                std::cerr << "multi-chunk sample is not supported and skipped" << std::endl;
+                continue;
+            }
+            return cxx::error<RecordError>(chunk.get_error());
+        }
+
+        if (isFirstChunk)
+        {
+            isFirstChunk = false;
+            m_firstTimestamp = chunk->entry->m_timestamp;
+            m_startTime = std::chrono::steady_clock::now();
+        }
+
+        waitUntilPublishTime(chunk->entry->m_timestamp);
+        if (!m_keepRunning)
+        {
+            break;
+        }
+        publish(chunk.value());
+    }
+
+    return cxx::success<>();
+}
+
+void Replayer::waitUntilPublishTime(const uint64_t timestamp) noexcept
+{
+    if (m_options.maxSpeed || timestamp <= m_firstTimestamp)
+    {
+        return;
+    }
+
+    const auto recordedOffset = static_cast<double>(timestamp - m_firstTimestamp) / m_options.speedFactor;
+    waitUntil(m_startTime + std::chrono::nanoseconds(static_cast<int64_t>(recordedOffset)));
+}
+
+void Replayer::waitUntil(const std::chrono::steady_clock::time_point deadline) noexcept
+{
+    while (m_keepRunning)
+    {
+        const auto now = std::chrono::steady_clock::now();
+        if (now >= deadline)
+        {
+            return;
+        }
+
+        const auto remaining = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - now).count();
+        auto waitResult = m_stopSemaphore->timedWait(units::Duration::fromNanoseconds(remaining));
+        if (waitResult.has_error() || waitResult.value() == posix::SemaphoreWaitState::NO_TIMEOUT)
+        {
+            return;
+        }
+    }
+}
+
+void Replayer::publish(const RecordedChunk& chunk) noexcept
+{
+    const auto& recordedHeader = *chunk.chunkHeader;
+    auto& publisher = m_publishers[chunk.entry->m_topicIndex];
+
+    publisher
+        .loan(recordedHeader.userPayloadSize(),
+              recordedHeader.userPayloadAlignment(),
+              recordedHeader.userHeaderSize(),
+              userHeaderAlignment(recordedHeader.userHeaderSize()))
+        .and_then([&](void* userPayload) {
+            auto chunkHeader = mepoo::ChunkHeader::fromUserPayload(userPayload);
+            if (recordedHeader.userHeaderSize() > 0U)
+            {
+                std::memcpy(chunkHeader->userHeader(), recordedHeader.userHeader(), recordedHeader.userHeaderSize());
+            }
+            std::memcpy(userPayload, recordedHeader.userPayload(), recordedHeader.userPayloadSize());
+            publisher.publish(userPayload);
+            ++m_numberOfReplayedChunks;
+        })
+        .or_else([&](auto& error) {
+            std::cerr << "unable to loan chunk for topic " << chunk.entry->m_topicIndex << ", error code "
+                      << static_cast<uint64_t>(error) << std::endl;
+        });
+}
+
+void Replayer::stop() noexcept
+{
+    m_keepRunning = false;
+    IOX_DISCARD_RESULT(m_stopSemaphore->post());
+}
+
+uint64_t Replayer::numberOfReplayedChunks() const noexcept
+{
+    return m_numberOfReplayedChunks;
+}
+
+} // namespace record_replay
+} // namespace iox
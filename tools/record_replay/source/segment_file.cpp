@@ -0,0 +1,564 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_record_replay/segment_file.hpp"
+#include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_hoofs/platform/fcntl.hpp"
+#include "iceoryx_hoofs/platform/stat.hpp"
+#include "iceoryx_hoofs/platform/unistd.hpp"
+#include "iceoryx_hoofs/posix_wrapper/posix_call.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+namespace iox
+{
+namespace record_replay
+{
+namespace
+{
+void copyIdString(char (&destination)[RecordedTopic::ID_STRING_SIZE], const capro::IdString_t& source) noexcept
+{
+    std::memcpy(&destination[0], source.c_str(), source.size());
+    destination[source.size()] = '\0';
+}
+
+capro::IdString_t toIdString(const char (&source)[RecordedTopic::ID_STRING_SIZE]) noexcept
+{
+    return capro::IdString_t(cxx::TruncateToCapacity, &source[0], strnlen(&source[0], capro::IdString_t::capacity()));
+}
+
+constexpr uint64_t indexCapacity(const uint64_t segmentSize) noexcept
+{
+    // every record consists at least of a RecordEntry and a ChunkHeader
+    return (segmentSize / (sizeof(RecordEntry) + sizeof(mepoo::ChunkHeader))) + 1U;
+}
+} // namespace
+
+const char* asStringLiteral(const RecordError error) noexcept
+{
+    switch (error)
+    {
+    case RecordError::UNABLE_TO_OPEN_FILE:
+        return "RecordError::UNABLE_TO_OPEN_FILE";
+    case RecordError::UNABLE_TO_RESIZE_FILE:
+        return "RecordError::UNABLE_TO_RESIZE_FILE";
+    case RecordError::UNABLE_TO_MAP_FILE:
+        return "RecordError::UNABLE_TO_MAP_FILE";
+    case RecordError::INVALID_FILE:
+        return "RecordError::INVALID_FILE";
+    case RecordError::INCOMPATIBLE_FORMAT_VERSION:
+        return "RecordError::INCOMPATIBLE_FORMAT_VERSION";
+    case RecordError::INCOMPATIBLE_CHUNK_HEADER_VERSION:
+        return "RecordError::INCOMPATIBLE_CHUNK_HEADER_VERSION";
+    case RecordError::TOO_MANY_TOPICS:
+        return "RecordError::TOO_MANY_TOPICS";
+    case RecordError::CHUNK_TOO_LARGE:
+        return "RecordError::CHUNK_TOO_LARGE";
+    case RecordError::MULTI_CHUNK_SAMPLE:
+        return "RecordError::MULTI_CHUNK_SAMPLE";
+    case RecordError::END_OF_RECORDING:
+        return "RecordError::END_OF_RECORDING";
+    }
+
+    return "[Undefined RecordError]";
+}
+
+std::string segmentFilePath(const std::string& directory, const uint64_t fileNumber) noexcept
+{
+    return directory + "/" + SEGMENT_FILE_PREFIX + std::to_string(fileNumber) + SEGMENT_FILE_SUFFIX;
+}
+
+std::string indexFilePath(const std::string& directory, const uint64_t fileNumber) noexcept
+{
+    return directory + "/" + SEGMENT_FILE_PREFIX + std::to_string(fileNumber) + INDEX_FILE_SUFFIX;
+}
+
+uint64_t segmentFileNumber(const uint64_t segmentNumber, const uint32_t maxNumberOfSegments) noexcept
+{
+    return (maxNumberOfSegments == UNLIMITED_SEGMENTS) ? segmentNumber : segmentNumber % maxNumberOfSegments;
+}
+
+///////////////////
+// MappedFile
+///////////////////
+cxx::expected<MappedFile, RecordError>
+MappedFile::open(const std::string& path, const posix::AccessMode accessMode, const uint64_t size) noexcept
+{
+    const bool isWritable = (accessMode == posix::AccessMode::READ_WRITE);
+    const int oflags = isWritable ? (O_RDWR | O_CREAT | O_TRUNC) : O_RDONLY;
+    constexpr mode_t FILE_PERMISSIONS{S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH};
+
+    auto openCall =
+        posix::posixCall(iox_open)(path.c_str(), oflags, FILE_PERMISSIONS).failureReturnValue(-1).evaluate();
+    if (openCall.has_error())
+    {
+        std::cerr << "Unable to open \"" << path << "\" : " << openCall.get_error().getHumanReadableErrnum()
+                  << std::endl;
+        return cxx::error<RecordError>(RecordError::UNABLE_TO_OPEN_FILE);
+    }
+    const int32_t fileDescriptor = openCall->value;
+
+    auto closeOnError = [&](const RecordError error) {
+        posix::posixCall(iox_close)(fileDescriptor).failureReturnValue(-1).evaluate().or_else([&](auto& r) {
+            std::cerr << "Unable to close \"" << path << "\" : " << r.getHumanReadableErrnum() << std::endl;
+        });
+        return cxx::error<RecordError>(error);
+    };
+
+    uint64_t fileSize{size};
+    if (isWritable)
+    {
+        // the file is resized only once, appending a record afterwards is a plain memcpy into the mapping
+        if (posix::posixCall(ftruncate)(fileDescriptor, static_cast<off_t>(size))
+                .failureReturnValue(-1)
+                .evaluate()
+                .has_error())
+        {
+            return closeOnError(RecordError::UNABLE_TO_RESIZE_FILE);
+        }
+    }
+    else
+    {
+        struct stat fileStat;
+        if (posix::posixCall(fstat)(fileDescriptor, &fileStat).failureReturnValue(-1).evaluate().has_error())
+        {
+            return closeOnError(RecordError::UNABLE_TO_OPEN_FILE);
+        }
+        fileSize = static_cast<uint64_t>(fileStat.st_size);
+    }
+
+    if (fileSize == 0U)
+    {
+        return closeOnError(RecordError::INVALID_FILE);
+    }
+
+    auto memoryMap = posix::MemoryMapBuilder()
+                         .length(fileSize)
+                         .fileDescriptor(fileDescriptor)
+                         .accessMode(accessMode)
+                         .flags(posix::MemoryMapFlags::SHARE_CHANGES)
+                         .create();
+    if (memoryMap.has_error())
+    {
+        return closeOnError(RecordError::UNABLE_TO_MAP_FILE);
+    }
+
+    return cxx::success<MappedFile>(MappedFile(fileDescriptor, fileSize, std::move(memoryMap.value())));
+}
+
+MappedFile::MappedFile(const int32_t fileDescriptor, const uint64_t size, posix::MemoryMap&& memoryMap) noexcept
+    : m_fileDescriptor(fileDescriptor)
+    , m_size(size)
+    , m_memoryMap(std::move(memoryMap))
+{
+}
+
+MappedFile::MappedFile(MappedFile&& rhs) noexcept
+{
+    *this = std::move(rhs);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& rhs) noexcept
+{
+    if (this != &rhs)
+    {
+        destroy();
+        m_fileDescriptor = rhs.m_fileDescriptor;
+        m_size = rhs.m_size;
+        m_memoryMap = std::move(rhs.m_memoryMap);
+
+        rhs.m_fileDescriptor = -1;
+        rhs.m_size = 0U;
+        rhs.m_memoryMap.reset();
+    }
+    return *this;
+}
+
+MappedFile::~MappedFile() noexcept
+{
+    destroy();
+}
+
+void* MappedFile::data() noexcept
+{
+    return m_memoryMap ? m_memoryMap->getBaseAddress() : nullptr;
+}
+
+const void* MappedFile::data() const noexcept
+{
+    return m_memoryMap ? m_memoryMap->getBaseAddress() : nullptr;
+}
+
+uint64_t MappedFile::size() const noexcept
+{
+    return m_size;
+}
+
+void MappedFile::close(const uint64_t finalSize) noexcept
+{
+    if (m_fileDescriptor == -1)
+    {
+        return;
+    }
+
+    m_memoryMap.reset();
+    if (finalSize < m_size)
+    {
+        posix::posixCall(ftruncate)(m_fileDescriptor, static_cast<off_t>(finalSize))
+            .failureReturnValue(-1)
+            .evaluate()
+            .or_else([](auto& r) {
+                std::cerr << "Unable to shrink recording file : " << r.getHumanReadableErrnum() << std::endl;
+            });
+        m_size = finalSize;
+    }
+    destroy();
+}
+
+void MappedFile::destroy() noexcept
+{
+    m_memoryMap.reset();
+    if (m_fileDescriptor != -1)
+    {
+        posix::posixCall(iox_close)(m_fileDescriptor).failureReturnValue(-1).evaluate().or_else([](auto& r) {
+            std::cerr << "Unable to close recording file : " << r.getHumanReadableErrnum() << std::endl;
+        });
+        m_fileDescriptor = -1;
+    }
+}
+
+///////////////////
+// RecordingWriter
+///////////////////
+RecordingWriter::RecordingWriter(const std::string& directory,
+                                 const uint64_t segmentSize,
+                                 const uint32_t maxNumberOfSegments,
+                                 const TopicList_t& topics) noexcept
+    : m_directory(directory)
+    , m_segmentSize(cxx::align(std::max(segmentSize, MIN_SEGMENT_SIZE), RECORD_ALIGNMENT))
+    , m_maxNumberOfSegments(maxNumberOfSegments)
+    , m_topics(topics)
+{
+}
+
+RecordingWriter::~RecordingWriter() noexcept
+{
+    close();
+}
+
+SegmentHeader* RecordingWriter::segmentHeader() noexcept
+{
+    return static_cast<SegmentHeader*>(m_segment->data());
+}
+
+IndexHeader* RecordingWriter::indexHeader() noexcept
+{
+    return static_cast<IndexHeader*>(m_index->data());
+}
+
+cxx::expected<RecordError> RecordingWriter::openSegment(const uint64_t segmentNumber) noexcept
+{
+    // in a ring the file of the oldest segment is truncated and reused
+    const uint64_t fileNumber = segmentFileNumber(segmentNumber, m_maxNumberOfSegments);
+    auto segment =
+        MappedFile::open(segmentFilePath(m_directory, fileNumber), posix::AccessMode::READ_WRITE, m_segmentSize);
+    if (segment.has_error())
+    {
+        return cxx::error<RecordError>(segment.get_error());
+    }
+
+    const uint64_t indexSize = sizeof(IndexHeader) + indexCapacity(m_segmentSize) * sizeof(IndexEntry);
+    auto index = MappedFile::open(indexFilePath(m_directory, fileNumber), posix::AccessMode::READ_WRITE, indexSize);
+    if (index.has_error())
+    {
+        return cxx::error<RecordError>(index.get_error());
+    }
+
+    m_segment.emplace(std::move(segment.value()));
+    m_index.emplace(std::move(index.value()));
+    m_nextSegmentNumber = segmentNumber + 1U;
+
+    auto header = new (m_segment->data()) SegmentHeader();
+    header->m_segmentNumber = segmentNumber;
+    header->m_capacity = m_segmentSize;
+    header->m_writePosition = sizeof(SegmentHeader);
+    header->m_numberOfTopics = static_cast<uint32_t>(m_topics.size());
+    header->m_maxNumberOfSegments = m_maxNumberOfSegments;
+    for (uint64_t i = 0U; i < m_topics.size(); ++i)
+    {
+        copyIdString(header->m_topics[i].m_service, m_topics[i].getServiceIDString());
+        copyIdString(header->m_topics[i].m_instance, m_topics[i].getInstanceIDString());
+        copyIdString(header->m_topics[i].m_event, m_topics[i].getEventIDString());
+    }
+
+    auto idxHeader = new (m_index->data()) IndexHeader();
+    idxHeader->m_capacity = indexCapacity(m_segmentSize);
+
+    return cxx::success<>();
+}
+
+void RecordingWriter::closeSegment() noexcept
+{
+    if (m_segment)
+    {
+        const uint64_t writePosition = segmentHeader()->m_writePosition;
+        const uint64_t indexSize = sizeof(IndexHeader) + indexHeader()->m_numberOfEntries * sizeof(IndexEntry);
+        m_segment->close(writePosition);
+        m_index->close(indexSize);
+        m_segment.reset();
+        m_index.reset();
+    }
+}
+
+cxx::expected<RecordError> RecordingWriter::append(const uint32_t topicIndex,
+                                                   const mepoo::ChunkHeader* const chunkHeader,
+                                                   const uint64_t timestamp) noexcept
+{
+    if (topicIndex >= m_topics.size())
+    {
+        return cxx::error<RecordError>(RecordError::TOO_MANY_TOPICS);
+    }
+    if (chunkHeader->isMultiChunk())
+    {
+        return cxx::error<RecordError>(RecordError::MULTI_CHUNK_SAMPLE);
+    }
+
+    const uint64_t chunkSize = chunkHeader->usedSizeOfChunk();
+    const uint64_t recordSize = cxx::align(sizeof(RecordEntry) + chunkSize, RECORD_ALIGNMENT);
+    if (sizeof(SegmentHeader) + recordSize > m_segmentSize)
+    {
+        return cxx::error<RecordError>(RecordError::CHUNK_TOO_LARGE);
+    }
+
+    if (m_segment && (segmentHeader()->m_writePosition + recordSize > m_segmentSize))
+    {
+        closeSegment();
+    }
+
+    if (!m_segment)
+    {
+        auto result = openSegment(m_nextSegmentNumber);
+        if (result.has_error())
+        {
+            return result;
+        }
+    }
+
+    auto header = segmentHeader();
+    const uint64_t offset = header->m_writePosition;
+    auto record = static_cast<uint8_t*>(m_segment->data()) + offset;
+
+    auto entry = new (record) RecordEntry();
+    entry->m_timestamp = timestamp;
+    entry->m_sequenceNumber = chunkHeader->sequenceNumber();
+    entry->m_topicIndex = topicIndex;
+    entry->m_chunkSize = static_cast<uint32_t>(chunkSize);
+    std::memcpy(record + sizeof(RecordEntry), chunkHeader, chunkSize);
+
+    // the write position is advanced after the record is complete, a crashed recorder leaves a readable segment
+    header->m_writePosition = offset + recordSize;
+
+    auto idxHeader = indexHeader();
+    if (idxHeader->m_numberOfEntries < idxHeader->m_capacity)
+    {
+        auto indexEntries = reinterpret_cast<IndexEntry*>(static_cast<uint8_t*>(m_index->data()) + sizeof(IndexHeader));
+        auto& indexEntry = indexEntries[idxHeader->m_numberOfEntries];
+        indexEntry.m_timestamp = timestamp;
+        indexEntry.m_sequenceNumber = entry->m_sequenceNumber;
+        indexEntry.m_offset = offset;
+        indexEntry.m_topicIndex = topicIndex;
+        ++idxHeader->m_numberOfEntries;
+    }
+
+    ++m_numberOfRecordedChunks;
+    return cxx::success<>();
+}
+
+void RecordingWriter::close() noexcept
+{
+    closeSegment();
+}
+
+uint64_t RecordingWriter::numberOfRecordedChunks() const noexcept
+{
+    return m_numberOfRecordedChunks;
+}
+
+///////////////////
+// RecordingReader
+///////////////////
+RecordingReader::RecordingReader(const std::string& directory) noexcept
+    : m_directory(directory)
+{
+}
+
+const SegmentHeader* RecordingReader::segmentHeader() const noexcept
+{
+    return static_cast<const SegmentHeader*>(m_segment->data());
+}
+
+cxx::expected<RecordError> RecordingReader::open() noexcept
+{
+    // the file with number 0 exists in every recording, it contains the topics and the ring size
+    auto firstFile = openSegmentFile(m_directory, 0U);
+    if (firstFile.has_error())
+    {
+        return cxx::error<RecordError>(firstFile.get_error());
+    }
+
+    m_topics.clear();
+    auto header = static_cast<const SegmentHeader*>(firstFile->data());
+    for (uint32_t i = 0U; i < header->m_numberOfTopics; ++i)
+    {
+        m_topics.emplace_back(toIdString(header->m_topics[i].m_service),
+                              toIdString(header->m_topics[i].m_instance),
+                              toIdString(header->m_topics[i].m_event));
+    }
+    m_maxNumberOfSegments = header->m_maxNumberOfSegments;
+
+    // in a ring the oldest segment can be stored in any file
+    uint64_t oldestSegmentNumber = header->m_segmentNumber;
+    for (uint64_t fileNumber = 1U; fileNumber < m_maxNumberOfSegments; ++fileNumber)
+    {
+        if (access(segmentFilePath(m_directory, fileNumber).c_str(), F_OK) != 0)
+        {
+            break;
+        }
+        auto file = openSegmentFile(m_directory, fileNumber);
+        if (!file.has_error())
+        {
+            oldestSegmentNumber =
+                std::min(oldestSegmentNumber, static_cast<const SegmentHeader*>(file->data())->m_segmentNumber);
+        }
+    }
+
+    return openSegment(oldestSegmentNumber);
+}
+
+const TopicList_t& RecordingReader::topics() const noexcept
+{
+    return m_topics;
+}
+
+cxx::expected<MappedFile, RecordError> RecordingReader::openSegmentFile(const std::string& directory,
+                                                                        const uint64_t fileNumber) noexcept
+{
+    auto segment = MappedFile::open(segmentFilePath(directory, fileNumber), posix::AccessMode::READ_ONLY, 0U);
+    if (segment.has_error())
+    {
+        return segment;
+    }
+
+    if (segment->size() < sizeof(SegmentHeader))
+    {
+        return cxx::error<RecordError>(RecordError::INVALID_FILE);
+    }
+
+    auto header = static_cast<const SegmentHeader*>(segment->data());
+    if (header->m_magic != SEGMENT_FILE_MAGIC || header->m_numberOfTopics > MAX_RECORDED_TOPICS
+        || header->m_writePosition > segment->size())
+    {
+        return cxx::error<RecordError>(RecordError::INVALID_FILE);
+    }
+    if (header->m_formatVersion != RECORD_FORMAT_VERSION)
+    {
+        return cxx::error<RecordError>(RecordError::INCOMPATIBLE_FORMAT_VERSION);
+    }
+    if (header->m_chunkHeaderVersion != mepoo::ChunkHeader::CHUNK_HEADER_VERSION)
+    {
+        return cxx::error<RecordError>(RecordError::INCOMPATIBLE_CHUNK_HEADER_VERSION);
+    }
+
+    return segment;
+}
+
+cxx::expected<RecordError> RecordingReader::openSegment(const uint64_t segmentNumber) noexcept
+{
+    m_segment.reset();
+
+    auto segment = openSegmentFile(m_directory, segmentFileNumber(segmentNumber, m_maxNumberOfSegments));
+    if (segment.has_error())
+    {
+        return cxx::error<RecordError>(segment.get_error());
+    }
+    if (static_cast<const SegmentHeader*>(segment->data())->m_segmentNumber != segmentNumber)
+    {
+        // the file still contains an older segment of the ring, the newest segment was read already
+        return cxx::error<RecordError>(RecordError::END_OF_RECORDING);
+    }
+
+    m_segment.emplace(std::move(segment.value()));
+    m_segmentNumber = segmentNumber;
+    m_readPosition = sizeof(SegmentHeader);
+
+    return cxx::success<>();
+}
+
+cxx::expected<RecordedChunk, RecordError> RecordingReader::next() noexcept
+{
+    if (!m_segment)
+    {
+        return cxx::error<RecordError>(RecordError::END_OF_RECORDING);
+    }
+
+    if (m_readPosition + sizeof(RecordEntry) > segmentHeader()->m_writePosition)
+    {
+        // a missing next segment marks the end of the recording
+        const uint64_t nextSegmentNumber = m_segmentNumber + 1U;
+        const std::string nextSegment =
+            segmentFilePath(m_directory, segmentFileNumber(nextSegmentNumber, m_maxNumberOfSegments));
+        if (access(nextSegment.c_str(), F_OK) != 0)
+        {
+            m_segment.reset();
+            return cxx::error<RecordError>(RecordError::END_OF_RECORDING);
+        }
+
+        auto result = openSegment(nextSegmentNumber);
+        if (result.has_error())
+        {
+            return cxx::error<RecordError>(result.get_error());
+        }
+        return next();
+    }
+
+    auto record = static_cast<const uint8_t*>(m_segment->data()) + m_readPosition;
+    auto entry = reinterpret_cast<const RecordEntry*>(record);
+    auto chunkHeader = reinterpret_cast<const mepoo::ChunkHeader*>(record + sizeof(RecordEntry));
+
+    const uint64_t recordSize = cxx::align(sizeof(RecordEntry) + entry->m_chunkSize, RECORD_ALIGNMENT);
+    if (m_readPosition + recordSize > segmentHeader()->m_writePosition || entry->m_topicIndex >= m_topics.size()
+        || entry->m_chunkSize < sizeof(mepoo::ChunkHeader))
+    {
+        return cxx::error<RecordError>(RecordError::INVALID_FILE);
+    }
+    if (chunkHeader->chunkHeaderVersion() != mepoo::ChunkHeader::CHUNK_HEADER_VERSION)
+    {
+        return cxx::error<RecordError>(RecordError::INCOMPATIBLE_CHUNK_HEADER_VERSION);
+    }
+
+    m_readPosition += recordSize;
+    // the relative pointers to the parts are meaningless without the shared memory they were recorded from
+    if (chunkHeader->isMultiChunk())
+    {
+        return cxx::error<RecordError>(RecordError::MULTI_CHUNK_SAMPLE);
+    }
+    return cxx::success<RecordedChunk>(RecordedChunk{entry, chunkHeader});
+}
+
+} // namespace record_replay
+} // namespace iox
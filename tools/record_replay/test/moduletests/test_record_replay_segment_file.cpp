@@ -0,0 +1,387 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/mepoo/chunk_settings.hpp"
+#include "iceoryx_record_replay/segment_file.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::record_replay;
+using iox::mepoo::ChunkHeader;
+
+constexpr uint64_t SEGMENT_SIZE{MIN_SEGMENT_SIZE};
+constexpr uint32_t SMALL_USER_PAYLOAD_SIZE{64U};
+// large enough that a few of them fill a segment
+constexpr uint32_t LARGE_USER_PAYLOAD_SIZE{static_cast<uint32_t>(SEGMENT_SIZE / 4U)};
+// the flags directly follow the chunk header version and never change their position
+constexpr uint64_t CHUNK_HEADER_FLAGS_OFFSET{sizeof(uint32_t) + sizeof(uint8_t)};
+constexpr uint8_t MULTI_CHUNK_FLAG{1U};
+
+/// @brief a chunk with a ChunkHeader which is located on the heap and can be appended to a recording
+class TestChunk
+{
+  public:
+    TestChunk(const uint32_t userPayloadSize, const uint64_t marker)
+    {
+        auto chunkSettings = iox::mepoo::ChunkSettings::create(userPayloadSize, alignof(uint64_t)).value();
+        m_memory.resize(chunkSettings.requiredChunkSize() / sizeof(uint64_t) + 1U);
+        m_chunkHeader = new (m_memory.data()) ChunkHeader(chunkSettings.requiredChunkSize(), chunkSettings);
+        std::memset(m_chunkHeader->userPayload(), 0, userPayloadSize);
+        std::memcpy(m_chunkHeader->userPayload(), &marker, sizeof(marker));
+    }
+
+    ChunkHeader* header() const
+    {
+        return m_chunkHeader;
+    }
+
+    void markAsMultiChunk()
+    {
+        reinterpret_cast<uint8_t*>(m_chunkHeader)[CHUNK_HEADER_FLAGS_OFFSET] = MULTI_CHUNK_FLAG;
+    }
+
+  private:
+    std::vector<uint64_t> m_memory;
+    ChunkHeader* m_chunkHeader{nullptr};
+};
+
+uint64_t markerOf(const ChunkHeader* chunkHeader)
+{
+    uint64_t marker{0U};
+    std::memcpy(&marker, chunkHeader->userPayload(), sizeof(marker));
+    return marker;
+}
+
+uint64_t fileSize(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    return file ? static_cast<uint64_t>(file.tellg()) : 0U;
+}
+
+bool fileExists(const std::string& path)
+{
+    return access(path.c_str(), F_OK) == 0;
+}
+
+void overwriteByte(const std::string& path, const uint64_t offset, const uint8_t value)
+{
+    std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+    file.seekp(static_cast<std::streamoff>(offset));
+    file.put(static_cast<char>(value));
+}
+
+class SegmentFile_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        char directoryTemplate[] = "/tmp/iox_record_replay_test_XXXXXX";
+        ASSERT_THAT(mkdtemp(&directoryTemplate[0]), Ne(nullptr));
+        m_directory = &directoryTemplate[0];
+
+        m_topics.emplace_back("Radar", "FrontLeft", "Objects");
+        m_topics.emplace_back("Lidar", "Roof", "PointCloud");
+    }
+
+    void TearDown() override
+    {
+        for (uint64_t fileNumber = 0U; fileNumber < MAX_FILES_TO_REMOVE; ++fileNumber)
+        {
+            std::remove(segmentFilePath(m_directory, fileNumber).c_str());
+            std::remove(indexFilePath(m_directory, fileNumber).c_str());
+        }
+        rmdir(m_directory.c_str());
+    }
+
+    /// @brief appends the chunks with the markers [0, numberOfChunks) alternating to both topics
+    void record(const uint32_t maxNumberOfSegments, const uint32_t userPayloadSize, const uint64_t numberOfChunks)
+    {
+        RecordingWriter sut(m_directory, SEGMENT_SIZE, maxNumberOfSegments, m_topics);
+        for (uint64_t i = 0U; i < numberOfChunks; ++i)
+        {
+            TestChunk chunk(userPayloadSize, i);
+            ASSERT_FALSE(sut.append(static_cast<uint32_t>(i % m_topics.size()), chunk.header(), TIMESTAMP_BASE + i)
+                             .has_error());
+        }
+        EXPECT_THAT(sut.numberOfRecordedChunks(), Eq(numberOfChunks));
+    }
+
+    /// @brief reads the whole recording and returns the markers of the chunks
+    std::vector<uint64_t> replay()
+    {
+        std::vector<uint64_t> markers;
+        RecordingReader reader(m_directory);
+        EXPECT_FALSE(reader.open().has_error());
+        while (true)
+        {
+            auto chunk = reader.next();
+            if (chunk.has_error())
+            {
+                EXPECT_THAT(chunk.get_error(), Eq(RecordError::END_OF_RECORDING));
+                break;
+            }
+            markers.push_back(markerOf(chunk->chunkHeader));
+        }
+        return markers;
+    }
+
+    static constexpr uint64_t MAX_FILES_TO_REMOVE{16U};
+    static constexpr uint64_t TIMESTAMP_BASE{1000000U};
+
+    std::string m_directory;
+    TopicList_t m_topics;
+};
+
+constexpr uint64_t SegmentFile_test::MAX_FILES_TO_REMOVE;
+constexpr uint64_t SegmentFile_test::TIMESTAMP_BASE;
+
+TEST_F(SegmentFile_test, RecordedChunksAreReadBackInOrderWithTopicsAndTimestamps)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d1493c0a-a5df-4fdc-b50f-dceeda848d51");
+    constexpr uint64_t NUMBER_OF_CHUNKS{10U};
+    record(UNLIMITED_SEGMENTS, SMALL_USER_PAYLOAD_SIZE, NUMBER_OF_CHUNKS);
+
+    RecordingReader sut(m_directory);
+    ASSERT_FALSE(sut.open().has_error());
+    ASSERT_THAT(sut.topics().size(), Eq(m_topics.size()));
+    EXPECT_THAT(sut.topics()[0], Eq(m_topics[0]));
+    EXPECT_THAT(sut.topics()[1], Eq(m_topics[1]));
+
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto chunk = sut.next();
+        ASSERT_FALSE(chunk.has_error());
+        EXPECT_THAT(markerOf(chunk->chunkHeader), Eq(i));
+        EXPECT_THAT(chunk->chunkHeader->userPayloadSize(), Eq(SMALL_USER_PAYLOAD_SIZE));
+        EXPECT_THAT(chunk->entry->m_topicIndex, Eq(i % m_topics.size()));
+        EXPECT_THAT(chunk->entry->m_timestamp, Eq(TIMESTAMP_BASE + i));
+    }
+
+    auto endOfRecording = sut.next();
+    ASSERT_TRUE(endOfRecording.has_error());
+    EXPECT_THAT(endOfRecording.get_error(), Eq(RecordError::END_OF_RECORDING));
+}
+
+TEST_F(SegmentFile_test, FullSegmentRollsOverToTheNextSegment)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4394def6-fa16-47e6-80cb-741a16d50271");
+    constexpr uint64_t NUMBER_OF_CHUNKS{10U};
+    record(UNLIMITED_SEGMENTS, LARGE_USER_PAYLOAD_SIZE, NUMBER_OF_CHUNKS);
+
+    // three large chunks fit into one segment
+    EXPECT_TRUE(fileExists(segmentFilePath(m_directory, 3U)));
+    EXPECT_FALSE(fileExists(segmentFilePath(m_directory, 4U)));
+
+    std::vector<uint64_t> expectedMarkers;
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        expectedMarkers.push_back(i);
+    }
+    EXPECT_THAT(replay(), Eq(expectedMarkers));
+}
+
+TEST_F(SegmentFile_test, ClosedSegmentIsTrimmedToTheWrittenSize)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "60f03988-297d-4c60-ab73-608e223a648d");
+    constexpr uint64_t NUMBER_OF_CHUNKS{3U};
+    record(UNLIMITED_SEGMENTS, SMALL_USER_PAYLOAD_SIZE, NUMBER_OF_CHUNKS);
+
+    const uint64_t recordSize = iox::cxx::align(
+        sizeof(RecordEntry) + TestChunk(SMALL_USER_PAYLOAD_SIZE, 0U).header()->usedSizeOfChunk(), RECORD_ALIGNMENT);
+    EXPECT_THAT(fileSize(segmentFilePath(m_directory, 0U)), Eq(sizeof(SegmentHeader) + NUMBER_OF_CHUNKS * recordSize));
+    EXPECT_THAT(fileSize(indexFilePath(m_directory, 0U)),
+                Eq(sizeof(IndexHeader) + NUMBER_OF_CHUNKS * sizeof(IndexEntry)));
+}
+
+TEST_F(SegmentFile_test, IndexContainsTimestampTopicAndOffsetOfEveryRecord)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9a0cc375-3358-4366-81e8-71f30034fc14");
+    constexpr uint64_t NUMBER_OF_CHUNKS{5U};
+    record(UNLIMITED_SEGMENTS, SMALL_USER_PAYLOAD_SIZE, NUMBER_OF_CHUNKS);
+
+    std::ifstream indexFile(indexFilePath(m_directory, 0U), std::ios::binary);
+    IndexHeader indexHeader;
+    ASSERT_TRUE(indexFile.read(reinterpret_cast<char*>(&indexHeader), sizeof(indexHeader)));
+    EXPECT_THAT(indexHeader.m_magic, Eq(INDEX_FILE_MAGIC));
+    EXPECT_THAT(indexHeader.m_formatVersion, Eq(RECORD_FORMAT_VERSION));
+    ASSERT_THAT(indexHeader.m_numberOfEntries, Eq(NUMBER_OF_CHUNKS));
+
+    std::ifstream segmentFile(segmentFilePath(m_directory, 0U), std::ios::binary);
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        IndexEntry indexEntry;
+        ASSERT_TRUE(indexFile.read(reinterpret_cast<char*>(&indexEntry), sizeof(indexEntry)));
+        EXPECT_THAT(indexEntry.m_timestamp, Eq(TIMESTAMP_BASE + i));
+        EXPECT_THAT(indexEntry.m_topicIndex, Eq(i % m_topics.size()));
+
+        // the offset points to the RecordEntry of the chunk in the segment file
+        RecordEntry recordEntry;
+        segmentFile.seekg(static_cast<std::streamoff>(indexEntry.m_offset));
+        ASSERT_TRUE(segmentFile.read(reinterpret_cast<char*>(&recordEntry), sizeof(recordEntry)));
+        EXPECT_THAT(recordEntry.m_timestamp, Eq(indexEntry.m_timestamp));
+        EXPECT_THAT(recordEntry.m_topicIndex, Eq(indexEntry.m_topicIndex));
+    }
+}
+
+TEST_F(SegmentFile_test, OldestSegmentIsOverwrittenWhenTheMaximumNumberOfSegmentsIsReached)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9f525a04-f181-40f1-8955-15edb229a45c");
+    constexpr uint32_t MAX_NUMBER_OF_SEGMENTS{2U};
+    // five segments with three chunks each, only the last two segments are kept
+    constexpr uint64_t NUMBER_OF_CHUNKS{14U};
+    record(MAX_NUMBER_OF_SEGMENTS, LARGE_USER_PAYLOAD_SIZE, NUMBER_OF_CHUNKS);
+
+    EXPECT_TRUE(fileExists(segmentFilePath(m_directory, 1U)));
+    EXPECT_FALSE(fileExists(segmentFilePath(m_directory, 2U)));
+
+    EXPECT_THAT(replay(), ElementsAre(9U, 10U, 11U, 12U, 13U));
+}
+
+TEST_F(SegmentFile_test, RingWhichIsNotFullYetIsReadFromTheFirstSegment)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9286bb87-627b-4c75-8768-0539c30caa11");
+    constexpr uint32_t MAX_NUMBER_OF_SEGMENTS{4U};
+    constexpr uint64_t NUMBER_OF_CHUNKS{7U};
+    record(MAX_NUMBER_OF_SEGMENTS, LARGE_USER_PAYLOAD_SIZE, NUMBER_OF_CHUNKS);
+
+    EXPECT_THAT(replay(), ElementsAre(0U, 1U, 2U, 3U, 4U, 5U, 6U));
+}
+
+TEST_F(SegmentFile_test, ChunkLargerThanASegmentIsRejected)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9b79558c-b335-4767-95ff-934372619567");
+    RecordingWriter sut(m_directory, SEGMENT_SIZE, UNLIMITED_SEGMENTS, m_topics);
+    TestChunk chunk(static_cast<uint32_t>(SEGMENT_SIZE), 0U);
+
+    auto result = sut.append(0U, chunk.header(), TIMESTAMP_BASE);
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(RecordError::CHUNK_TOO_LARGE));
+    EXPECT_THAT(sut.numberOfRecordedChunks(), Eq(0U));
+}
+
+TEST_F(SegmentFile_test, MultiChunkSampleIsRejected)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ca47427f-50a1-4def-a649-61504f038172");
+    RecordingWriter sut(m_directory, SEGMENT_SIZE, UNLIMITED_SEGMENTS, m_topics);
+    TestChunk chunk(SMALL_USER_PAYLOAD_SIZE, 0U);
+    chunk.markAsMultiChunk();
+    ASSERT_TRUE(chunk.header()->isMultiChunk());
+
+    auto result = sut.append(0U, chunk.header(), TIMESTAMP_BASE);
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(RecordError::MULTI_CHUNK_SAMPLE));
+    EXPECT_THAT(sut.numberOfRecordedChunks(), Eq(0U));
+}
+
+TEST_F(SegmentFile_test, RecordedMultiChunkSampleIsSkippedByTheReader)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "95dc320f-5fbe-400f-a999-d01c8097703c");
+    record(UNLIMITED_SEGMENTS, SMALL_USER_PAYLOAD_SIZE, 2U);
+    overwriteByte(segmentFilePath(m_directory, 0U),
+                  sizeof(SegmentHeader) + sizeof(RecordEntry) + CHUNK_HEADER_FLAGS_OFFSET,
+                  MULTI_CHUNK_FLAG);
+
+    RecordingReader sut(m_directory);
+    ASSERT_FALSE(sut.open().has_error());
+    auto result = sut.next();
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(RecordError::MULTI_CHUNK_SAMPLE));
+    auto nextChunk = sut.next();
+    ASSERT_FALSE(nextChunk.has_error());
+    EXPECT_THAT(markerOf(nextChunk->chunkHeader), Eq(1U));
+}
+
+TEST_F(SegmentFile_test, AppendWithUnknownTopicIndexFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2df21632-8020-4ae2-8e5e-044bab67e454");
+    RecordingWriter sut(m_directory, SEGMENT_SIZE, UNLIMITED_SEGMENTS, m_topics);
+    TestChunk chunk(SMALL_USER_PAYLOAD_SIZE, 0U);
+
+    auto result = sut.append(static_cast<uint32_t>(m_topics.size()), chunk.header(), TIMESTAMP_BASE);
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(RecordError::TOO_MANY_TOPICS));
+}
+
+TEST_F(SegmentFile_test, SegmentWithIncompatibleChunkHeaderVersionIsRejected)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3339a61b-c4af-48cb-ae21-9f21de7d8d6d");
+    record(UNLIMITED_SEGMENTS, SMALL_USER_PAYLOAD_SIZE, 1U);
+    overwriteByte(segmentFilePath(m_directory, 0U),
+                  offsetof(SegmentHeader, m_chunkHeaderVersion),
+                  ChunkHeader::CHUNK_HEADER_VERSION + 1U);
+
+    RecordingReader sut(m_directory);
+    auto result = sut.open();
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(RecordError::INCOMPATIBLE_CHUNK_HEADER_VERSION));
+}
+
+TEST_F(SegmentFile_test, RecordedChunkWithIncompatibleChunkHeaderVersionIsRejected)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "666f0209-bdbf-4ab3-81ba-a181b3a70405");
+    record(UNLIMITED_SEGMENTS, SMALL_USER_PAYLOAD_SIZE, 1U);
+    // the chunk header version directly follows the 32 bit chunk size and never changes its position
+    constexpr uint64_t CHUNK_HEADER_VERSION_OFFSET{sizeof(uint32_t)};
+    overwriteByte(segmentFilePath(m_directory, 0U),
+                  sizeof(SegmentHeader) + sizeof(RecordEntry) + CHUNK_HEADER_VERSION_OFFSET,
+                  ChunkHeader::CHUNK_HEADER_VERSION + 1U);
+
+    RecordingReader sut(m_directory);
+    ASSERT_FALSE(sut.open().has_error());
+    auto result = sut.next();
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(RecordError::INCOMPATIBLE_CHUNK_HEADER_VERSION));
+}
+
+TEST_F(SegmentFile_test, SegmentWithIncompatibleFormatVersionIsRejected)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6bf71b92-25e1-457d-9cbd-6312cba17b72");
+    record(UNLIMITED_SEGMENTS, SMALL_USER_PAYLOAD_SIZE, 1U);
+    overwriteByte(segmentFilePath(m_directory, 0U),
+                  offsetof(SegmentHeader, m_formatVersion),
+                  static_cast<uint8_t>(RECORD_FORMAT_VERSION + 1U));
+
+    RecordingReader sut(m_directory);
+    auto result = sut.open();
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(RecordError::INCOMPATIBLE_FORMAT_VERSION));
+}
+
+TEST_F(SegmentFile_test, OpeningAMissingRecordingFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "510224c0-8fad-4a50-97f3-34cfdb660f1c");
+    RecordingReader sut(m_directory);
+    auto result = sut.open();
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(RecordError::UNABLE_TO_OPEN_FILE));
+}
+
+} // namespace